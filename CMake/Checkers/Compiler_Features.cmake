@@ -161,7 +161,7 @@ macro(get_au_flag auflag)
 endmacro()
 
 macro(get_avx2fma_flag fmaflag)
-  set(${fmaflag} -mavx2 -mfma)
+  set(${fmaflag} -mavx2 -mfma -mf16c)
 endmacro()
 
 macro(get_fastmath_flag fmflag)
@@ -27,3 +27,4 @@
 
 option(BUILD_SHARED_LIBS "Build shared libraries" ON )
 option(OPTION_BUILD_TESTS "Enable the tests." OFF)
+option(ALM_STATS "Build with slow-path statistics counters, see amd_libm_stats_get()" OFF)
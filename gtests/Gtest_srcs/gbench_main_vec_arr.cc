@@ -39,6 +39,13 @@ void LibmPerfTestaf(benchmark::State& st, InputParams* param) {
   if(nargs == 2)
     data.ip1 = (void *) objtest.inpbuff1;
 
+  if (param->ttype == TestType::E_Latency) {
+    LibmLatencyTest(st, param, objtest.inpbuff, objtest.outbuff,
+                    (int64_t)param->count,
+                    [&](int64_t) { test_vas(&data, param->count); });
+    return;
+  }
+
   for (auto _ : st) {
     test_vas(&data, param->count);
   }
@@ -58,6 +65,13 @@ void LibmPerfTestad(benchmark::State& st, InputParams* param) {
   if(nargs == 2)
     data.ip1 = (void *) objtest.inpbuff1;
 
+  if (param->ttype == TestType::E_Latency) {
+    LibmLatencyTest(st, param, objtest.inpbuff, objtest.outbuff,
+                    (int64_t)param->count,
+                    [&](int64_t) { test_vad(&data, param->count); });
+    return;
+  }
+
   for (auto _ : st) {
     test_vad(&data, param->count);
   }
@@ -42,6 +42,12 @@ void LibmPerfTestf(benchmark::State& st, InputParams* param) {
   if(nargs == 2)
     data.ip1 = (void *) objtest.inpbuff1;
 
+  if (param->ttype == TestType::E_Latency) {
+    LibmLatencyTest(st, param, objtest.inpbuff, objtest.outbuff, 1,
+                    [&](int64_t i) { test_s1s(&data, (int)i); });
+    return;
+  }
+
   for (auto _ : st) {
     for (int64_t i =  0 ; i < param->count; i++) {
       test_s1s(&data, i);
@@ -63,6 +69,12 @@ void LibmPerfTest4f(benchmark::State& st, InputParams* param) {
   if(nargs == 2)
     data.ip1 = (void *) objtest.inpbuff1;
 
+  if (param->ttype == TestType::E_Latency) {
+    LibmLatencyTest(st, param, objtest.inpbuff, objtest.outbuff, 4,
+                    [&](int64_t i) { test_v4s(&data, (int)i); });
+    return;
+  }
+
   for (auto _ : st) {
     for (int64_t i =  0 ; i < param->count; i += 4) {
       test_v4s(&data, i);
@@ -84,6 +96,12 @@ void LibmPerfTest8f(benchmark::State& st, InputParams* param) {
   if(nargs == 2)
     data.ip1 = (void *) objtest.inpbuff1;
 
+  if (param->ttype == TestType::E_Latency) {
+    LibmLatencyTest(st, param, objtest.inpbuff, objtest.outbuff, 8,
+                    [&](int64_t i) { test_v8s(&data, (int)i); });
+    return;
+  }
+
   for (auto _ : st) {
     for (int64_t i =  0 ; i < param->count; i += 8) {
       test_v8s(&data, i);
@@ -105,6 +123,12 @@ void LibmPerfTest16f(benchmark::State& st, InputParams* param) {
   if(nargs == 2)
     data.ip1 = (void *) objtest.inpbuff1;
 
+  if (param->ttype == TestType::E_Latency) {
+    LibmLatencyTest(st, param, objtest.inpbuff, objtest.outbuff, 16,
+                    [&](int64_t i) { test_v16s(&data, (int)i); });
+    return;
+  }
+
   for (auto _ : st) {
     for (int64_t i =  0 ; i < param->count; i += 16) {
       test_v16s(&data, i);
@@ -126,6 +150,12 @@ void LibmPerfTestd(benchmark::State& st, InputParams* param) {
   if(nargs == 2)
     data.ip1 = (void *) objtest.inpbuff1;
 
+  if (param->ttype == TestType::E_Latency) {
+    LibmLatencyTest(st, param, objtest.inpbuff, objtest.outbuff, 1,
+                    [&](int64_t i) { test_s1d(&data, (int)i); });
+    return;
+  }
+
   for (auto _ : st) {
     for (int64_t i =  0 ; i < param->count; i++) {
       test_s1d(&data, i);
@@ -147,6 +177,12 @@ void LibmPerfTest2d(benchmark::State& st, InputParams* param) {
   if(nargs == 2)
     data.ip1 = (void *) objtest.inpbuff1;
 
+  if (param->ttype == TestType::E_Latency) {
+    LibmLatencyTest(st, param, objtest.inpbuff, objtest.outbuff, 2,
+                    [&](int64_t i) { test_v2d(&data, (int)i); });
+    return;
+  }
+
   for (auto _ : st) {
     for (int64_t i =  0 ; i < param->count; i += 2) {
       test_v2d(&data, i);
@@ -168,6 +204,12 @@ void LibmPerfTest4d(benchmark::State& st, InputParams* param) {
   if(nargs == 2)
     data.ip1 = (void *) objtest.inpbuff1;
 
+  if (param->ttype == TestType::E_Latency) {
+    LibmLatencyTest(st, param, objtest.inpbuff, objtest.outbuff, 4,
+                    [&](int64_t i) { test_v4d(&data, (int)i); });
+    return;
+  }
+
   for (auto _ : st) {
     for (int64_t i =  0 ; i < param->count; i += 4) {
       test_v4d(&data, i);
@@ -189,6 +231,12 @@ void LibmPerfTest8d(benchmark::State& st, InputParams* param) {
   if(nargs == 2)
     data.ip1 = (void *) objtest.inpbuff1;
 
+  if (param->ttype == TestType::E_Latency) {
+    LibmLatencyTest(st, param, objtest.inpbuff, objtest.outbuff, 8,
+                    [&](int64_t i) { test_v8d(&data, (int)i); });
+    return;
+  }
+
   for (auto _ : st) {
     for (int64_t i =  0 ; i < param->count; i += 8) {
       test_v8d(&data, i);
@@ -72,6 +72,7 @@ TEST_P(AccuTestFixtureFloat, ACCURACY_SCALAR_FLOAT) {
     if ((vflag == 1) && (ulp > inData->ulp_threshold))
         PrintUlpResultsFloat(nargs, ip[0], ip[1], exptd, aop[0], ulp);
   }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[0]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Scalar","Accuracy","s1s",count,(count-nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
@@ -112,6 +113,7 @@ TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_4FLOATS) {
         PrintUlpResultsFloat(nargs, ip[0], ip[1], exptd, aop[j], ulp);
     }
   }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[0]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Vector","Accuracy","v4s",count,(count-nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
@@ -152,6 +154,7 @@ TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_8FLOATS) {
         PrintUlpResultsFloat(nargs, ip[0], ip[1], exptd, aop[j], ulp);
     }
   }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[0]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Vector","Accuracy","v8s",count,(count-nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
@@ -192,6 +195,7 @@ TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_16FLOATS) {
         PrintUlpResultsFloat(nargs, ip[0], ip[1], exptd, aop[j], ulp);
     }
   }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[0]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Vector","Accuracy","v16s",count,(count-nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
@@ -225,6 +229,7 @@ TEST_P(AccuTestFixtureDouble, ACCURACY_SCALAR_DOUBLE) {
         PrintUlpResultsDouble(nargs, ip[0], ip[1], exptd, aop[0], ulp);
   }
 
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[1]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Scalar","Accuracy","s1d",count,(count-nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
@@ -264,6 +269,7 @@ TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_2DOUBLES) {
         PrintUlpResultsDouble(nargs, ip[0], ip[1], exptd, aop[j], ulp);
     }
   }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[1]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Vector","Accuracy","v2d",count,(count-nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
@@ -304,6 +310,7 @@ TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_4DOUBLES) {
         PrintUlpResultsDouble(nargs, ip[0], ip[1], exptd, aop[j], ulp);
     }
   }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[1]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Vector","Accuracy","v4d",count,(count-nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
@@ -338,6 +345,7 @@ TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_8DOUBLES) {
         PrintUlpResultsDouble(nargs, ip[0], ip[1], exptd, aop[j], ulp);
     }
   }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[1]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Vector","Accuracy","v8d",count,(count-nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
@@ -457,6 +465,7 @@ TEST_P(AccuTestFixtureComplexFloat, ACCURACY_SCALAR_COMPLEX_FLOAT) {
     if ((vflag == 1) && (ulp > inData->ulp_threshold))
         PrintUlpResultsComplexFloat(nargs, ip[0], ip[1], exptd, aop[0], ulp);
   }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[0]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Scalar","Accuracy","s1s complex",count*count,(count*count - nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
@@ -490,11 +499,152 @@ TEST_P(AccuTestFixtureComplexDouble, ACCURACY_SCALAR_COMPLEX_DOUBLE) {
     if ((vflag == 1) && (ulp > inData->ulp_threshold))
         PrintUlpResultsComplexDouble(nargs, ip[0], ip[1], exptd, aop[0], ulp);
   }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[1]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Scalar","Accuracy","s1d complex",count*count,(count*count - nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
 }
 
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_8COMPLEX_FLOATS) {
+  int nfail = 0;
+  double max_ulp_err = inData->max_ulp_err;
+  test_data data;
+  data.ip  = (void *)complex_inpbuff;
+  data.op  = (void *)aop;
+  float _Complex ip[2];
+
+  if(nargs == 2)
+    data.ip1 = (void *)complex_inpbuff1;
+
+  for (uint32_t i = 0; i < count*count; i += 8) {
+    test_v8s(&data, i);
+
+    for (uint32_t j = 0; j < 8; j++) {
+      ip[0] = complex_inpbuff[i + j];
+      if(nargs == 2)
+        ip[1] = complex_inpbuff1[i + j];
+
+      double _Complex exptd = getExpected(ip);
+      double ulp = getUlp(aop[j], exptd);
+      if(!update_ulp(ulp, max_ulp_err, inData->ulp_threshold)) {
+        nfail++;
+      }
+
+      if ((vflag == 1) && (ulp > inData->ulp_threshold))
+        PrintUlpResultsComplexFloat(nargs, ip[0], ip[1], exptd, aop[j], ulp);
+    }
+  }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[0]);
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
+  "Vector","Accuracy","v8s complex",count*count,(count*count - nfail), nfail, max_ulp_err);
+  ptr->tstcnt++;
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_16COMPLEX_FLOATS) {
+  int nfail = 0;
+  double max_ulp_err = inData->max_ulp_err;
+  test_data data;
+  data.ip  = (void *)complex_inpbuff;
+  data.op  = (void *)aop;
+  float _Complex ip[2];
+
+  if(nargs == 2)
+    data.ip1 = (void *)complex_inpbuff1;
+
+  for (uint32_t i = 0; i < count*count; i += 16) {
+    test_v16s(&data, i);
+
+    for (uint32_t j = 0; j < 16; j++) {
+      ip[0] = complex_inpbuff[i + j];
+      if(nargs == 2)
+        ip[1] = complex_inpbuff1[i + j];
+
+      double _Complex exptd = getExpected(ip);
+      double ulp = getUlp(aop[j], exptd);
+      if(!update_ulp(ulp, max_ulp_err, inData->ulp_threshold)) {
+        nfail++;
+      }
+
+      if ((vflag == 1) && (ulp > inData->ulp_threshold))
+        PrintUlpResultsComplexFloat(nargs, ip[0], ip[1], exptd, aop[j], ulp);
+    }
+  }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[0]);
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
+  "Vector","Accuracy","v16s complex",count*count,(count*count - nfail), nfail, max_ulp_err);
+  ptr->tstcnt++;
+}
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_4COMPLEX_DOUBLES) {
+  int nfail = 0;
+  double max_ulp_err = inData->max_ulp_err;
+  test_data data;
+  data.ip  = (void *)complex_inpbuff;
+  data.op  = (void *)aop;
+  double _Complex ip[2];
+
+  if(nargs == 2)
+    data.ip1 = (void *)complex_inpbuff1;
+
+  for (uint32_t i = 0; i < count*count; i += 4) {
+    test_v4d(&data, i);
+
+    for (uint32_t j = 0; j < 4; j++) {
+      ip[0] = complex_inpbuff[i + j];
+      if(nargs == 2)
+        ip[1] = complex_inpbuff1[i + j];
+
+      long double _Complex exptd = getExpected(ip);
+      double ulp = getUlp(aop[j], exptd);
+      if(!update_ulp(ulp, max_ulp_err, inData->ulp_threshold)) {
+        nfail++;
+      }
+
+      if ((vflag == 1) && (ulp > inData->ulp_threshold))
+        PrintUlpResultsComplexDouble(nargs, ip[0], ip[1], exptd, aop[j], ulp);
+    }
+  }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[1]);
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
+  "Vector","Accuracy","v4d complex",count*count,(count*count - nfail), nfail, max_ulp_err);
+  ptr->tstcnt++;
+}
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_8COMPLEX_DOUBLES) {
+  int nfail = 0;
+  double max_ulp_err = inData->max_ulp_err;
+  test_data data;
+  data.ip  = (void *)complex_inpbuff;
+  data.op  = (void *)aop;
+  double _Complex ip[2];
+
+  if(nargs == 2)
+    data.ip1 = (void *)complex_inpbuff1;
+
+  for (uint32_t i = 0; i < count*count; i += 8) {
+    test_v8d(&data, i);
+
+    for (uint32_t j = 0; j < 8; j++) {
+      ip[0] = complex_inpbuff[i + j];
+      if(nargs == 2)
+        ip[1] = complex_inpbuff1[i + j];
+
+      long double _Complex exptd = getExpected(ip);
+      double ulp = getUlp(aop[j], exptd);
+      if(!update_ulp(ulp, max_ulp_err, inData->ulp_threshold)) {
+        nfail++;
+      }
+
+      if ((vflag == 1) && (ulp > inData->ulp_threshold))
+        PrintUlpResultsComplexDouble(nargs, ip[0], ip[1], exptd, aop[j], ulp);
+    }
+  }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[1]);
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
+  "Vector","Accuracy","v8d complex",count*count,(count*count - nfail), nfail, max_ulp_err);
+  ptr->tstcnt++;
+}
+
 TEST_P(SpecTestFixtureComplexFloat, CONFORMANCE_COMPLEX_FLOAT) {
   int nfail = 0;
   float _Complex aop, op;
@@ -56,6 +56,7 @@ TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS) {
     if ((vflag == 1) && (ulp > inData->ulp_threshold))
         PrintUlpResultsFloat(nargs, ip[0], ip[1], exptd, aop[i], ulp);
   }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[0]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Vec_Array","Accuracy","vas",count,(count-nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
@@ -89,7 +90,76 @@ TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES) {
     if ((vflag == 1) && (ulp > inData->ulp_threshold))
         PrintUlpResultsDouble(nargs, ip[0], ip[1], exptd, aop[i], ulp);
   }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[1]);
   sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
   "Vec_Array","Accuracy","vad",count,(count-nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
 }
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS) {
+  int nfail = 0;
+  double max_ulp_err = inData->max_ulp_err;
+  test_data data;
+  data.ip  = (void *)complex_inpbuff;
+  data.op  = (void *)aop;
+  float _Complex ip[2];
+
+  if(nargs == 2)
+    data.ip1 = (void *)complex_inpbuff1;
+
+  test_vas(&data, count*count);
+  for (uint32_t i = 0; i < count*count; i++)
+  {
+    ip[0] = complex_inpbuff[i];
+    if(nargs == 2)
+      ip[1] = complex_inpbuff1[i];
+
+    double _Complex exptd = getExpected(ip);
+    double ulp = getUlp(aop[i], exptd);
+    if(!update_ulp(ulp, max_ulp_err, inData->ulp_threshold))
+    {
+      nfail++;
+    }
+
+    if ((vflag == 1) && (ulp > inData->ulp_threshold))
+        PrintUlpResultsComplexFloat(nargs, ip[0], ip[1], exptd, aop[i], ulp);
+  }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[0]);
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
+  "Vec_Array","Accuracy","vas complex",count*count,(count*count - nfail), nfail, max_ulp_err);
+  ptr->tstcnt++;
+}
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES) {
+  int nfail = 0;
+  double max_ulp_err = inData->max_ulp_err;
+  test_data data;
+  data.ip  = (void *)complex_inpbuff;
+  data.op  = (void *)aop;
+  double _Complex ip[2];
+
+  if(nargs == 2)
+    data.ip1 = (void *)complex_inpbuff1;
+
+  test_vad(&data, count*count);
+  for (uint32_t i = 0; i < count*count; i++)
+  {
+    ip[0] = complex_inpbuff[i];
+    if(nargs == 2)
+      ip[1] = complex_inpbuff1[i];
+
+    long double _Complex exptd = getExpected(ip);
+    double ulp = getUlp(aop[i], exptd);
+    if(!update_ulp(ulp, max_ulp_err, inData->ulp_threshold))
+    {
+      nfail++;
+    }
+
+    if ((vflag == 1) && (ulp > inData->ulp_threshold))
+        PrintUlpResultsComplexDouble(nargs, ip[0], ip[1], exptd, aop[i], ulp);
+  }
+  CheckUlpBound(max_ulp_err, inData->ulp_bound[1]);
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
+  "Vec_Array","Accuracy","vad complex",count*count,(count*count - nfail), nfail, max_ulp_err);
+  ptr->tstcnt++;
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/*
+ * The fused activation kernels against the same function composed from
+ * array passes over the expf, log1pf, erff and tanhf kernels, which is
+ * what a caller without the fused kernels would write. Each benchmark
+ * reports the elements per second for arrays of 1024 and 65536 floats
+ * uniform in [-8, 8].
+ *
+ *   ./test_activation --bench [--benchmark_filter=gelu]
+ */
+
+#include <cstring>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <immintrin.h>
+#include "benchmark.h"
+#define AMD_LIBM_VEC_EXPERIMENTAL
+#include <external/amdlibm_vec.h>
+
+static const float sqrt1_2 = 0.70710678f;
+static const float gelu_tanh_c0 = 0.79788456f, gelu_tanh_c1 = 0.044715f;
+
+struct ActBufs {
+  std::vector<float> x, t, r;
+
+  explicit ActBufs(int n) : x(n), t(n), r(n) {
+    std::mt19937 gen(n);
+    std::uniform_real_distribution<float> dist(-8.0f, 8.0f);
+    for (float &v : x)
+      v = dist(gen);
+  }
+};
+
+/* y = f(x) for the vrs8 kernels that have no array form, 8 at a time */
+static void Vrs8Pass(__m256 (*f)(__m256), int n, const float *x, float *y) {
+  int i = 0;
+  for (; i <= n - 8; i += 8)
+    _mm256_storeu_ps(y + i, f(_mm256_loadu_ps(x + i)));
+  if (i < n) {
+    float v[8] = {0};
+    memcpy(v, x + i, (n - i) * sizeof(float));
+    _mm256_storeu_ps(v, f(_mm256_loadu_ps(v)));
+    memcpy(y + i, v, (n - i) * sizeof(float));
+  }
+}
+
+static void ComposedSigmoid(int n, float *x, float *t, float *r) {
+  for (int i = 0; i < n; i++)
+    t[i] = -x[i];
+  amd_vrsa_expf(n, t, t);
+  for (int i = 0; i < n; i++)
+    r[i] = 1.0f / (1.0f + t[i]);
+}
+
+static void ComposedSilu(int n, float *x, float *t, float *r) {
+  ComposedSigmoid(n, x, t, r);
+  for (int i = 0; i < n; i++)
+    r[i] *= x[i];
+}
+
+static void ComposedSoftplus(int n, float *x, float *t, float *r) {
+  amd_vrsa_expf(n, x, t);
+  amd_vrsa_log1pf(n, t, r);
+}
+
+static void ComposedGelu(int n, float *x, float *t, float *r) {
+  for (int i = 0; i < n; i++)
+    t[i] = x[i] * sqrt1_2;
+  Vrs8Pass(amd_vrs8_erff, n, t, t);
+  for (int i = 0; i < n; i++)
+    r[i] = 0.5f * x[i] * (1.0f + t[i]);
+}
+
+static void ComposedGeluTanh(int n, float *x, float *t, float *r) {
+  for (int i = 0; i < n; i++)
+    t[i] = gelu_tanh_c0 * (x[i] + gelu_tanh_c1 * x[i] * x[i] * x[i]);
+  Vrs8Pass(amd_vrs8_tanhf, n, t, t);
+  for (int i = 0; i < n; i++)
+    r[i] = 0.5f * x[i] * (1.0f + t[i]);
+}
+
+static void ComposedSoftmax(int n, float *x, float *t, float *r) {
+  float m = *std::max_element(x, x + n), s = 0.0f;
+  for (int i = 0; i < n; i++)
+    t[i] = x[i] - m;
+  amd_vrsa_expf(n, t, r);
+  for (int i = 0; i < n; i++)
+    s += r[i];
+  for (int i = 0; i < n; i++)
+    r[i] *= 1.0f / s;
+}
+
+static void Fused(benchmark::State &state, void (*fn)(int, float *, float *)) {
+  int n = (int)state.range(0);
+  ActBufs b(n);
+  for (auto _ : state) {
+    fn(n, b.x.data(), b.r.data());
+    benchmark::DoNotOptimize(b.r.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void Composed(benchmark::State &state, void (*fn)(int, float *, float *, float *)) {
+  int n = (int)state.range(0);
+  ActBufs b(n);
+  for (auto _ : state) {
+    fn(n, b.x.data(), b.t.data(), b.r.data());
+    benchmark::DoNotOptimize(b.r.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void FusedSoftmax(int n, float *x, float *r) { amd_vrsa_softmaxf(1, n, x, r); }
+
+BENCHMARK_CAPTURE(Fused, sigmoidf, amd_vrsa_sigmoidf)->Arg(1024)->Arg(65536);
+BENCHMARK_CAPTURE(Composed, sigmoidf, ComposedSigmoid)->Arg(1024)->Arg(65536);
+BENCHMARK_CAPTURE(Fused, siluf, amd_vrsa_siluf)->Arg(1024)->Arg(65536);
+BENCHMARK_CAPTURE(Composed, siluf, ComposedSilu)->Arg(1024)->Arg(65536);
+BENCHMARK_CAPTURE(Fused, softplusf, amd_vrsa_softplusf)->Arg(1024)->Arg(65536);
+BENCHMARK_CAPTURE(Composed, softplusf, ComposedSoftplus)->Arg(1024)->Arg(65536);
+BENCHMARK_CAPTURE(Fused, geluf, amd_vrsa_geluf)->Arg(1024)->Arg(65536);
+BENCHMARK_CAPTURE(Composed, geluf, ComposedGelu)->Arg(1024)->Arg(65536);
+BENCHMARK_CAPTURE(Fused, gelu_tanhf, amd_vrsa_gelu_tanhf)->Arg(1024)->Arg(65536);
+BENCHMARK_CAPTURE(Composed, gelu_tanhf, ComposedGeluTanh)->Arg(1024)->Arg(65536);
+BENCHMARK_CAPTURE(Fused, softmaxf, FusedSoftmax)->Arg(1024)->Arg(65536);
+BENCHMARK_CAPTURE(Composed, softmaxf, ComposedSoftmax)->Arg(1024)->Arg(65536);
@@ -0,0 +1,447 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/*
+ * Accuracy of the activation array kernels.
+ *
+ * The float kernels (vrsa_sigmoidf, _siluf, _softplusf, _geluf,
+ * _gelu_tanhf) of each uarch row the host can run are checked over a
+ * sweep of float bit patterns, which covers both signs, denormals, inf
+ * and NaN, against long double references, within a stated max ULP
+ * error. Zeros must carry the sign of the reference.
+ *
+ * The bfloat16 kernels (vrba_<fn>bf16) are checked over every bfloat16
+ * input: the result must be the correctly rounded bfloat16 or one of its
+ * two neighbours, as the kernels round a float result once more.
+ *
+ * vrsa_softmaxf and vrba_softmaxbf16 are checked row by row against a
+ * long double softmax, for rows of 1 to 37 and 1000 elements.
+ *
+ * Run with --bench for the fused kernels against the composed passes,
+ * see gbench_activation.cc.
+ */
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "gtest.h"
+#include "benchmark.h"
+#include <external/amdlibm.h>
+#include <libm/iface.h>
+
+typedef long double (*refl_t)(long double);
+typedef void (*f32_arr_t)(int, float *, float *);
+typedef void (*bf16_arr_t)(int, bf16_t *, bf16_t *);
+typedef void (*f32_softmax_t)(int, int, float *, float *);
+typedef void (*bf16_softmax_t)(int, int, bf16_t *, bf16_t *);
+
+static const char *uarch_names[ALM_UARCH_MAX] = {
+    "default", "base64", "fma3", "zen", "zen2", "zen3", "zen4", "zen5",
+};
+
+/*
+ * Stated max error of the float kernels in float ulps: the error of the
+ * vrs8/vrs16 exp, log and erf kernels plus the roundings of the float
+ * arithmetic around them. The lanes evaluated in double (gelu below -1,
+ * silu below -80) are within an ulp.
+ */
+static const double sigmoid_ulp = 4.5, silu_ulp = 5.5, softplus_ulp = 5.0;
+static const double gelu_ulp = 5.0, gelu_tanh_ulp = 4.0, softmax_ulp = 5.0;
+
+/* sqrt(2 / pi) and the cubic term of the tanh form */
+static const long double gelu_tanh_c0 = 0.797884560802865355879892119868763737L;
+static const long double gelu_tanh_c1 = 0.044715L;
+
+static long double Sigmoid(long double x) {
+  long double e = expl(-fabsl(x));
+  return x < 0 ? e / (1 + e) : 1 / (1 + e);
+}
+
+static long double Silu(long double x) { return x * Sigmoid(x); }
+
+static long double Softplus(long double x) {
+  return x > 0 ? x + log1pl(expl(-x)) : log1pl(expl(x));
+}
+
+static long double Gelu(long double x) {
+  return x / 2 * erfcl(-x / sqrtl(2));
+}
+
+/* x / 2 * (1 + tanh(u)) = x / (1 + exp(-2u)) */
+static long double GeluTanh(long double x) {
+  long double u = gelu_tanh_c0 * (x + gelu_tanh_c1 * x * x * x);
+  return x / (1 + expl(-2 * u));
+}
+
+static float BF16ToFloat(uint16_t h) {
+  uint32_t u = (uint32_t)h << 16;
+  float f;
+  memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+static uint32_t FloatBits(float f) {
+  uint32_t u;
+  memcpy(&u, &f, sizeof(u));
+  return u;
+}
+
+/* Round to nearest even, the scaled significands are exact in double */
+static uint16_t DoubleToBF16(double d) {
+  uint16_t s = std::signbit(d) ? 0x8000 : 0;
+  double a = fabs(d);
+  int e;
+
+  if (std::isnan(d))
+    return s | 0x7fc0;
+  if (a < 0x1p-126)                     /* subnormal, 128 is the smallest normal */
+    return s | (uint16_t)nearbyint(a * 0x1p133);
+  if (a >= 0x1.ffp127)                  /* halfway from the largest to 2^128 */
+    return s | 0x7f80;
+
+  frexp(a, &e);                         /* a in [2^(e-1), 2^e) */
+  uint32_t m = (uint32_t)nearbyint(ldexp(a, 8 - e));
+  if (m == 256) {
+    m = 128;
+    e++;
+  }
+  return s | (uint16_t)(((e + 126) << 7) | (m - 128));
+}
+
+/*
+ * Distance in bf16 ulps from the expected e to the actual a, -1 for a
+ * class mismatch or a zero of the wrong sign
+ */
+static int BF16Distance(uint16_t e, uint16_t a) {
+  bool ne = (e & 0x7fff) > 0x7f80, na = (a & 0x7fff) > 0x7f80;
+
+  if (ne || na)
+    return (ne && na) ? 0 : -1;
+  if (e != a && (e & 0x7fff) == 0 && (a & 0x7fff) == 0)
+    return -1;
+  int oe = (e & 0x8000) ? -(e & 0x7fff) : e;
+  int oa = (a & 0x8000) ? -(a & 0x7fff) : a;
+  return oe > oa ? oe - oa : oa - oe;
+}
+
+/* Error of a in float ulps of the reference e, infinite for a class mismatch */
+static double FloatUlp(float a, long double e) {
+  float r = (float)e;
+
+  if (std::isnan(a) || std::isnan(r))
+    return (std::isnan(a) && std::isnan(r)) ? 0.0 : INFINITY;
+  if (std::isinf(a) || std::isinf(r))
+    return (a == r) ? 0.0 : INFINITY;
+  if (a == 0 && r == 0 && std::signbit(a) != std::signbit(r))
+    return INFINITY;
+  int exp = std::max(std::ilogb(r), -126);
+  if (r == 0)
+    exp = -126;
+  return (double)(fabsl((long double)a - e) / ldexpl(1, exp - 23));
+}
+
+static const struct alm_arch_funcs *Funcs(const char *func) {
+  for (int e = 1; e < C_AMD_LAST_ENTRY; e++)
+    if (alm_iface_name(e) && !strcmp(alm_iface_name(e), func))
+      return alm_iface_funcs(e);
+  return NULL;
+}
+
+/* Calls of 1 to 37 elements for the tails */
+template <typename T>
+static void RunArr(void (*fn)(int, T *, T *), std::vector<T> &x, std::vector<T> &r) {
+  size_t n = x.size();
+  for (size_t i = 0, len = 1; i < n; i += len, len = len % 37 + 1) {
+    int k = (int)(n - i < len ? n - i : len);
+    fn(k, x.data() + i, r.data() + i);
+  }
+}
+
+/* Every 1009th float bit pattern, the two zeros and the two infinities */
+static std::vector<float> FloatSweep(void) {
+  std::vector<float> x;
+  for (uint64_t u = 0; u <= 0xffffffffu; u += 1009) {
+    uint32_t b = (uint32_t)u;
+    float f;
+    memcpy(&f, &b, sizeof(f));
+    x.push_back(f);
+  }
+  for (float f : {0.0f, -0.0f, INFINITY, -INFINITY, 1.0f, -1.0f})
+    x.push_back(f);
+  return x;
+}
+
+static void CheckFloat(const char *func, refl_t ref, double maxulp) {
+  const struct alm_arch_funcs *t = Funcs(func);
+  ASSERT_TRUE(t != NULL) << func << " is not in the dispatch tables";
+
+  std::vector<float> x = FloatSweep(), r(x.size());
+  std::vector<long double> e(x.size());
+  std::vector<void *> seen;
+  for (size_t i = 0; i < x.size(); i++)
+    e[i] = ref(x[i]);
+
+  for (int row = (int)alm_iface_uarch(); row >= 0; row--) {
+    void *fn = t->funcs[row][ALM_FUNC_VECT_SP_ARR];
+    if (!fn || std::find(seen.begin(), seen.end(), fn) != seen.end())
+      continue;
+    seen.push_back(fn);
+
+    double worst = 0;
+    size_t nfail = 0;
+    RunArr(reinterpret_cast<f32_arr_t>(fn), x, r);
+    for (size_t i = 0; i < x.size(); i++) {
+      double ulp = FloatUlp(r[i], e[i]);
+      if (!std::isinf(ulp))
+        worst = std::max(worst, ulp);
+      if (ulp > maxulp && nfail++ < 4)
+        ADD_FAILURE() << func << "/" << uarch_names[row] << ": input " << std::hexfloat
+                      << x[i] << " expected " << (float)e[i] << " actual " << r[i]
+                      << " (" << std::defaultfloat << ulp << " ulp)";
+    }
+    printf("%s/%s/vas: max %.3f ulp\n", func, uarch_names[row], worst);
+    EXPECT_EQ(nfail, 0u) << func << "/" << uarch_names[row] << " failed";
+  }
+  EXPECT_FALSE(seen.empty()) << func << " has no float kernel";
+}
+
+static void CheckBF16(const char *func, refl_t ref) {
+  const struct alm_arch_funcs *t = Funcs(func);
+  ASSERT_TRUE(t != NULL) << func << " is not in the dispatch tables";
+
+  std::vector<uint16_t> x(0x10000), e(0x10000), r(0x10000);
+  std::vector<void *> seen;
+  for (size_t i = 0; i < x.size(); i++) {
+    x[i] = (uint16_t)i;
+    e[i] = DoubleToBF16((double)ref(BF16ToFloat((uint16_t)i)));
+  }
+
+  for (int row = (int)alm_iface_uarch(); row >= 0; row--) {
+    void *fn = t->funcs[row][ALM_FUNC_VECT_BF16_ARR];
+    if (!fn || std::find(seen.begin(), seen.end(), fn) != seen.end())
+      continue;
+    seen.push_back(fn);
+
+    size_t nfail = 0, noff = 0;
+    RunArr(reinterpret_cast<void (*)(int, uint16_t *, uint16_t *)>(fn), x, r);
+    for (size_t i = 0; i < x.size(); i++) {
+      int d = BF16Distance(e[i], r[i]);
+      noff += d == 1;
+      if ((d < 0 || d > 1) && nfail++ < 4)
+        ADD_FAILURE() << func << "/" << uarch_names[row] << "/vab: input 0x" << std::hex
+                      << x[i] << " expected 0x" << e[i] << " actual 0x" << r[i];
+    }
+    printf("%s/%s/vab: %zu of %zu results one bf16 ulp off\n", func,
+           uarch_names[row], noff, x.size());
+    EXPECT_EQ(nfail, 0u) << func << "/" << uarch_names[row] << " failed";
+  }
+  EXPECT_FALSE(seen.empty()) << func << " has no bfloat16 kernel";
+}
+
+/*
+ * Softmax of one row in long double. A row holding a NaN or +inf, or
+ * only -inf, is a row of NaN.
+ */
+static void SoftmaxRef(const float *x, int n, long double *y) {
+  long double m = -INFINITY, s = 0;
+  bool nan = false;
+
+  for (int j = 0; j < n; j++) {
+    nan |= std::isnan(x[j]) || x[j] == INFINITY;
+    m = std::max(m, (long double)x[j]);
+  }
+  nan |= m == -INFINITY;
+  for (int j = 0; j < n; j++)
+    s += (y[j] = expl(x[j] - m));
+  for (int j = 0; j < n; j++)
+    y[j] = nan ? NAN : y[j] / s;
+}
+
+static std::vector<float> SoftmaxRow(int n, int kind, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> dist(-20.0f, 20.0f);
+  std::vector<float> x(n);
+  for (float &v : x)
+    v = dist(gen);
+  switch (kind) {
+  case 1:                               /* overflows without the max shift */
+    for (float &v : x)
+      v += 100.0f;
+    break;
+  case 2:                               /* -inf elements contribute 0 */
+    for (int j = 0; j < n; j += 3)
+      x[j] = -INFINITY;
+    if (n == 1)
+      x[0] = 1.0f;
+    break;
+  case 3:
+    x[seed % n] = NAN;
+    break;
+  case 4:
+    x[seed % n] = INFINITY;
+    break;
+  case 5:
+    std::fill(x.begin(), x.end(), -INFINITY);
+    break;
+  }
+  return x;
+}
+
+static const int softmax_cols[] = {1, 2, 3, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 37, 1000};
+
+TEST(ACTIVATION, ACCURACY_FLOAT) {
+  CheckFloat("sigmoid", Sigmoid, sigmoid_ulp);
+  CheckFloat("silu", Silu, silu_ulp);
+  CheckFloat("softplus", Softplus, softplus_ulp);
+  CheckFloat("gelu", Gelu, gelu_ulp);
+  CheckFloat("gelu_tanh", GeluTanh, gelu_tanh_ulp);
+}
+
+TEST(ACTIVATION, EXHAUSTIVE_BF16) {
+  CheckBF16("sigmoid", Sigmoid);
+  CheckBF16("silu", Silu);
+  CheckBF16("softplus", Softplus);
+  CheckBF16("gelu", Gelu);
+  CheckBF16("gelu_tanh", GeluTanh);
+}
+
+/* gelu(-0) and silu(-0) are -0, the products must not lose the sign */
+TEST(ACTIVATION, SIGNED_ZERO) {
+  std::vector<float> x(19, -0.0f), r(19);
+  std::vector<uint16_t> xb(19, 0x8000), rb(19);
+
+  for (const char *func : {"silu", "gelu", "gelu_tanh"}) {
+    const struct alm_arch_funcs *t = Funcs(func);
+    ASSERT_TRUE(t != NULL) << func;
+    for (int row = (int)alm_iface_uarch(); row >= 0; row--) {
+      if (void *fn = t->funcs[row][ALM_FUNC_VECT_SP_ARR]) {
+        reinterpret_cast<f32_arr_t>(fn)((int)x.size(), x.data(), r.data());
+        for (float v : r)
+          EXPECT_EQ(FloatBits(v), 0x80000000u) << func << "/" << uarch_names[row];
+      }
+      if (void *fn = t->funcs[row][ALM_FUNC_VECT_BF16_ARR]) {
+        reinterpret_cast<bf16_arr_t>(fn)((int)xb.size(), (bf16_t *)xb.data(),
+                                         (bf16_t *)rb.data());
+        for (uint16_t v : rb)
+          EXPECT_EQ(v, 0x8000) << func << "/" << uarch_names[row] << "/vab";
+      }
+    }
+  }
+}
+
+TEST(ACTIVATION, SOFTMAX) {
+  const struct alm_arch_funcs *t = Funcs("softmax");
+  ASSERT_TRUE(t != NULL) << "softmax is not in the dispatch tables";
+  std::vector<void *> seen;
+
+  for (int row = (int)alm_iface_uarch(); row >= 0; row--) {
+    void *f32 = t->funcs[row][ALM_FUNC_VECT_SP_ARR];
+    void *bf16 = t->funcs[row][ALM_FUNC_VECT_BF16_ARR];
+    if (!f32 || std::find(seen.begin(), seen.end(), f32) != seen.end())
+      continue;
+    seen.push_back(f32);
+    double worst = 0;
+
+    for (int n : softmax_cols) {
+      for (int kind = 0; kind < 6; kind++) {
+        /* three rows, the last one in place */
+        std::vector<float> x;
+        for (int i = 0; i < 3; i++) {
+          std::vector<float> v = SoftmaxRow(n, kind, n * 7 + i);
+          x.insert(x.end(), v.begin(), v.end());
+        }
+        std::vector<float> r(x), y(3 * n + 1);
+        std::vector<long double> e(3 * n);
+        for (int i = 0; i < 3; i++)
+          SoftmaxRef(&x[i * n], n, &e[i * n]);
+
+        /* one past the end must not be written */
+        y[3 * n] = -7.0f;
+        reinterpret_cast<f32_softmax_t>(f32)(2, n, x.data(), y.data());
+        reinterpret_cast<f32_softmax_t>(f32)(1, n, &r[2 * n], &r[2 * n]);
+        std::copy(&r[2 * n], &r[3 * n], &y[2 * n]);
+        EXPECT_EQ(y[3 * n], -7.0f) << "softmax wrote past the matrix";
+
+        int nfail = 0;
+        for (int j = 0; j < 3 * n; j++) {
+          double ulp = FloatUlp(y[j], e[j]);
+          if (!std::isinf(ulp))
+            worst = std::max(worst, ulp);
+          if (ulp > softmax_ulp && nfail++ < 4)
+            ADD_FAILURE() << "softmax/" << uarch_names[row] << " n=" << n
+                          << " kind=" << kind << " j=" << j << std::hexfloat
+                          << " x " << x[j] << " expected " << (float)e[j]
+                          << " actual " << y[j];
+        }
+
+        if (!bf16)
+          continue;
+        std::vector<uint16_t> xb(3 * n), yb(3 * n);
+        std::vector<float> xf(3 * n);
+        for (int j = 0; j < 3 * n; j++) {
+          xb[j] = DoubleToBF16(x[j]);
+          xf[j] = BF16ToFloat(xb[j]);
+        }
+        for (int i = 0; i < 3; i++)
+          SoftmaxRef(&xf[i * n], n, &e[i * n]);
+        reinterpret_cast<bf16_softmax_t>(bf16)(3, n, (bf16_t *)xb.data(),
+                                               (bf16_t *)yb.data());
+        nfail = 0;
+        for (int j = 0; j < 3 * n; j++) {
+          int d = BF16Distance(DoubleToBF16((double)e[j]), yb[j]);
+          if ((d < 0 || d > 1) && nfail++ < 4)
+            ADD_FAILURE() << "softmax/" << uarch_names[row] << "/vab n=" << n
+                          << " kind=" << kind << " j=" << j << " x " << xf[j]
+                          << " expected " << (float)e[j] << " actual "
+                          << BF16ToFloat(yb[j]);
+        }
+      }
+    }
+    printf("softmax/%s/vas: max %.3f ulp\n", uarch_names[row], worst);
+  }
+  EXPECT_FALSE(seen.empty()) << "softmax has no float kernel";
+}
+
+int main(int argc, char **argv) {
+  /* --bench runs the benchmarks of gbench_activation.cc instead */
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--bench")) {
+      argv[i] = argv[--argc];
+      benchmark::Initialize(&argc, argv);
+      benchmark::RunSpecifiedBenchmarks();
+      return 0;
+    }
+  }
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/*
+ * The fused affine array kernels against the two-pass composition.
+ *
+ * dst[i] = c * f(a * src[i] + b) + d must be bit-identical to
+ * vrda_linearfrac(src, a, b, 0, 1), then vrda_<f>, then
+ * vrda_linearfrac(r, c, d, 0, 1), and the same for the float variants.
+ * Lengths 0 to 37 cover the masked tails, the inputs mix random values
+ * with zeros, denormals, inf and NaN.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include "gtest.h"
+#define AMD_LIBM_VEC_EXPERIMENTAL
+#include <external/amdlibm_vec.h>
+
+template <typename T> struct Affine;
+
+template <> struct Affine<double> {
+  typedef uint64_t bits;
+  typedef void (*arr_t)(int, double *, double *);
+  typedef void (*arr2_t)(int, double *, double *, double *);
+  typedef void (*affine_t)(int, double *, double, double, double, double, double *);
+  typedef void (*affine2_t)(int, double *, double *, double, double, double, double, double *);
+  static void lf(int n, double *x, double a, double b, double *y) {
+    amd_vrda_linearfrac(n, x, x, a, b, 0.0, 1.0, y);
+  }
+};
+
+template <> struct Affine<float> {
+  typedef uint32_t bits;
+  typedef void (*arr_t)(int, float *, float *);
+  typedef void (*arr2_t)(int, float *, float *, float *);
+  typedef void (*affine_t)(int, float *, float, float, float, float, float *);
+  typedef void (*affine2_t)(int, float *, float *, float, float, float, float, float *);
+  static void lf(int n, float *x, float a, float b, float *y) {
+    amd_vrsa_linearfracf(n, x, x, a, b, 0.0f, 1.0f, y);
+  }
+};
+
+static const int lengths[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                              16, 17, 23, 31, 32, 33, 37, 1000, 1003};
+
+/* { a, b, c, d } */
+static const double params[][4] = {
+    {1.0, 0.0, 1.0, 0.0},
+    {0.5, -1.0, 2.0, 3.0},
+    {-3.0, 0.25, -0.5, 1e-3},
+    {1e-3, 2.0, 1e3, -1.0},
+};
+
+template <typename T>
+static std::vector<T> Inputs(int n, T lo, T hi, unsigned seed) {
+  static const T special[] = {
+      T(0), -T(0), std::numeric_limits<T>::denorm_min(),
+      std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+      std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::max(),
+  };
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<T> dist(lo, hi);
+  std::vector<T> v(n);
+  for (int i = 0; i < n; i++)
+    v[i] = (i % 7 == 3) ? special[(i / 7) % 7] : dist(gen);
+  return v;
+}
+
+template <typename T>
+static bool SameBits(T e, T a) {
+  typename Affine<T>::bits ue, ua;
+  memcpy(&ue, &e, sizeof(ue));
+  memcpy(&ua, &a, sizeof(ua));
+  return ue == ua || (std::isnan(e) && std::isnan(a));
+}
+
+template <typename T>
+static void Compare(const char *name, const T *p, int n, const std::vector<T> &x,
+                    const std::vector<T> &ref, const std::vector<T> &out) {
+  int nfail = 0;
+  for (int i = 0; i < n; i++) {
+    if (SameBits(ref[i], out[i]) || nfail++ >= 5)
+      continue;
+    ADD_FAILURE() << name << " n=" << n << " {" << p[0] << ", " << p[1] << ", " << p[2]
+                  << ", " << p[3] << "} x=" << std::hexfloat << x[i]
+                  << " expected " << ref[i] << " actual " << out[i];
+  }
+}
+
+template <typename T>
+static void CheckAffine(const char *name, typename Affine<T>::affine_t fused,
+                        typename Affine<T>::arr_t fn, T lo, T hi) {
+  for (const double *pd : params) {
+    const T p[4] = {T(pd[0]), T(pd[1]), T(pd[2]), T(pd[3])};
+    for (int n : lengths) {
+      std::vector<T> x = Inputs<T>(n, lo, hi, n), t(n + 1), r(n + 1), ref(n + 1), out(n + 1);
+      /* one past the end must not be written */
+      out[n] = T(-7);
+      Affine<T>::lf(n, x.data(), p[0], p[1], t.data());
+      fn(n, t.data(), r.data());
+      Affine<T>::lf(n, r.data(), p[2], p[3], ref.data());
+      fused(n, x.data(), p[0], p[1], p[2], p[3], out.data());
+      Compare<T>(name, p, n, x, ref, out);
+      EXPECT_EQ(out[n], T(-7)) << name << " wrote past n=" << n;
+    }
+  }
+}
+
+template <typename T>
+static void CheckAffine2(const char *name, typename Affine<T>::affine2_t fused,
+                         typename Affine<T>::arr2_t fn, T lo, T hi) {
+  for (const double *pd : params) {
+    const T p[4] = {T(pd[0]), T(pd[1]), T(pd[2]), T(pd[3])};
+    for (int n : lengths) {
+      std::vector<T> x = Inputs<T>(n, lo, hi, n), y = Inputs<T>(n, T(-4), T(4), n + 1000);
+      std::vector<T> t(n + 1), r(n + 1), ref(n + 1), out(n + 1);
+      out[n] = T(-7);
+      Affine<T>::lf(n, x.data(), p[0], p[1], t.data());
+      fn(n, t.data(), y.data(), r.data());
+      Affine<T>::lf(n, r.data(), p[2], p[3], ref.data());
+      fused(n, x.data(), y.data(), p[0], p[1], p[2], p[3], out.data());
+      Compare<T>(name, p, n, x, ref, out);
+      EXPECT_EQ(out[n], T(-7)) << name << " wrote past n=" << n;
+    }
+  }
+}
+
+/* there is no vrsa_tanhf, the composition runs vrs8_tanhf over the blocks */
+static void VrsaTanhf(int n, float *x, float *y) {
+  for (int i = 0; i < n; i += 8) {
+    alignas(32) float v[8] = {0};
+    int k = std::min(8, n - i);
+    memcpy(v, x + i, k * sizeof(float));
+    _mm256_store_ps(v, amd_vrs8_tanhf(_mm256_load_ps(v)));
+    memcpy(y + i, v, k * sizeof(float));
+  }
+}
+
+TEST(AFFINE, BITWISE_DOUBLE) {
+  CheckAffine<double>("vrda_exp_affine", amd_vrda_exp_affine, amd_vrda_exp, -20.0, 20.0);
+  CheckAffine<double>("vrda_log_affine", amd_vrda_log_affine, amd_vrda_log, 0.0, 100.0);
+  CheckAffine<double>("vrda_sin_affine", amd_vrda_sin_affine, amd_vrda_sin, -100.0, 100.0);
+  CheckAffine<double>("vrda_cos_affine", amd_vrda_cos_affine, amd_vrda_cos, -100.0, 100.0);
+  CheckAffine2<double>("vrda_pow_affine", amd_vrda_pow_affine, amd_vrda_pow, 0.0, 10.0);
+}
+
+TEST(AFFINE, BITWISE_FLOAT) {
+  CheckAffine<float>("vrsa_expf_affine", amd_vrsa_expf_affine, amd_vrsa_expf, -20.0f, 20.0f);
+  CheckAffine<float>("vrsa_logf_affine", amd_vrsa_logf_affine, amd_vrsa_logf, 0.0f, 100.0f);
+  CheckAffine<float>("vrsa_sinf_affine", amd_vrsa_sinf_affine, amd_vrsa_sinf, -100.0f, 100.0f);
+  CheckAffine<float>("vrsa_cosf_affine", amd_vrsa_cosf_affine, amd_vrsa_cosf, -100.0f, 100.0f);
+  CheckAffine<float>("vrsa_tanhf_affine", amd_vrsa_tanhf_affine, VrsaTanhf, -10.0f, 10.0f);
+  CheckAffine2<float>("vrsa_powf_affine", amd_vrsa_powf_affine, amd_vrsa_powf, 0.0f, 10.0f);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
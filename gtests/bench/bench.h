@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2008-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+ * Shared by the driver (bench_main.cc), the glibc side (bench_glibc.cc)
+ * the multi-thread runs (bench_scale.cc), the exhaustive sweep
+ * (bench_exhaustive.cc) and the cold runs (bench_cache.cc)
+ */
+
+enum BenchSig {
+    SIG_UNARY,          /* y = f(x) */
+    SIG_BINARY,         /* z = f(x, y) */
+    SIG_POWX,           /* z = f(x, scalar y) */
+    SIG_POWN,           /* z = f(x, int n) */
+    SIG_LINEARFRAC,     /* z = (a*x + b) / (c*y + d) */
+    SIG_NONE,           /* not benchmarked, see 'why' */
+};
+
+struct BenchFunc {
+    const char *name;
+    BenchSig    sig;
+    double      lo, hi;         /* range of x */
+    double      lo2, hi2;       /* range of y, the exponent for powx/pown */
+    const char *why;            /* reason, for SIG_NONE */
+};
+
+struct BenchBufs {
+    void   *x, *y, *r;
+    int     n;
+    double  s;                  /* powx exponent, pown n */
+};
+
+/*
+ * One benchmark. 'slot' is how fn is called, 'var' the variant it is
+ * reported as: they differ when a glibc scalar or vector function stands
+ * in for an AOCL vector or array one.
+ */
+struct BenchCase {
+    BenchFunc        func;
+    int              slot;
+    int              var;
+    const char      *tag;               /* uarch row, "libm" or "libmvec" */
+    void            *fn;
+    void            *ref;               /* for the max ULP, or NULL */
+    bool             dispatched;        /* what the host resolves to */
+    double           special;           /* fraction of special inputs */
+};
+
+/* Longest vector, the element count is rounded up to a multiple of it */
+#define BENCH_MAX_LANES 32
+
+/* Runs fn over b, NULL where a slot cannot be called with a signature */
+typedef void (*bench_kernel_t)(void *fn, const BenchBufs &b);
+
+bench_kernel_t bench_kernel(BenchSig sig, int slot);
+size_t slot_size(int slot, bool result);
+extern const char *slot_names[];        /* short variant names, "v4s" */
+
+/*
+ * glibc libm and libmvec, loaded with dlopen() for --compare. All of
+ * them give false/NULL where glibc is not available.
+ */
+bool bench_glibc_open(void);
+void *bench_glibc_libm(const char *name, int slot);
+void *bench_glibc_libmvec(const char *name, int slot, bool binary,
+                          bool avx512, int *kslot);
+void *bench_glibc_ref(const char *name, int slot);
+double bench_max_ulp(const BenchCase &c, const BenchBufs &b);
+
+/* A --threads level, the cores its threads are pinned to */
+struct BenchLevel {
+    std::string      name;              /* 1, ccd, socket, all or a count */
+    std::vector<int> cpus;
+};
+
+struct BenchFreq {
+    uint64_t         tsc, aperf, mperf;
+    double           secs;
+    bool             msr;               /* APERF/MPERF readable */
+};
+
+bool bench_scale_levels(const std::vector<std::string> &spec,
+                        std::vector<BenchLevel> &out);
+bool bench_pin(int cpu);
+
+/*
+ * Clock of the calling thread's core between start and stop: the TSC
+ * rate, and the effective one from APERF/MPERF or -1 if not readable.
+ */
+void bench_freq_start(BenchFreq &f, int cpu);
+bool bench_freq_stop(const BenchFreq &f, int cpu, double *ghz, double *tsc_ghz);
+
+/*
+ * Every float input of the unary float kernels in cases, all of one
+ * function, on 'jobs' threads (bench_exhaustive.cc). False if there is
+ * no reference for the function.
+ */
+bool bench_exhaustive(const char *name, const std::vector<BenchCase> &cases,
+                      int jobs, bool has_range, double lo, double hi);
+
+/*
+ * A --cold mode, what is evicted before each timed call: a buffer of
+ * 'bytes' is read over, or with flush the lines the kernel touches are
+ * flushed. "warm" evicts nothing.
+ */
+struct BenchCold {
+    std::string      name;              /* warm, l1, l2, l3, flush or a size */
+    size_t           bytes;
+    bool             flush;
+};
+
+bool bench_cold_modes(const std::vector<std::string> &spec,
+                      std::vector<BenchCold> &out);
+void bench_thrash(const std::vector<char> &buf);
+void bench_flush(const std::vector<const char *> &lines);
+
+/*
+ * Bytes of the library's data one k(fn, b) call brings into the cache,
+ * the lines in 'lines', or -1 if that cannot be measured.
+ */
+long bench_footprint(bench_kernel_t k, void *fn, const BenchBufs &b,
+                     std::vector<const char *> &lines);
+
+#endif  /* __BENCH_H__ */
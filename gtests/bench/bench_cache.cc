@@ -0,0 +1,306 @@
+/*
+ * Copyright (C) 2008-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * --cold: what is evicted between the timed calls of a kernel, and the
+ * data (tables and constants) one call of it touches.
+ *
+ * A cache level is evicted by reading a buffer half again its size, so
+ * that "l2" leaves the tables (and the inputs) in L3 at best. "flush"
+ * evicts only the lines the kernel touches, with clflush, so that they
+ * come from memory while the inputs stay cached.
+ *
+ * The footprint is found with flush and reload: every line of the data
+ * segments of the library the kernel is in is flushed, the kernel is
+ * called once and each line is timed as it is read back, a fast one was
+ * brought in by the call. The hardware prefetchers are not turned off,
+ * so the count includes the lines they bring in next to the touched ones.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
+
+#include "bench.h"
+
+using namespace std;
+
+#define BENCH_LINE      64
+#define FP_REPS         5               /* a line counts if hit in all */
+#define FP_CHUNK        512             /* lines flushed and read per call */
+
+/* "48K", "2M" or a byte count, 0 if not a size */
+static size_t
+parse_size(const string &s)
+{
+    char *end;
+    unsigned long long v = strtoull(s.c_str(), &end, 10);
+
+    if (end == s.c_str())
+        return 0;
+
+    switch (toupper((unsigned char)*end)) {
+    case 'K': v <<= 10; end++; break;
+    case 'M': v <<= 20; end++; break;
+    case 'G': v <<= 30; end++; break;
+    }
+
+    return *end ? 0 : (size_t)v;
+}
+
+void
+bench_thrash(const vector<char> &buf)
+{
+    const volatile char *p = buf.data();
+    char sum = 0;
+
+    for (size_t i = 0; i < buf.size(); i += BENCH_LINE)
+        sum += p[i];
+
+    (void)sum;
+}
+
+#if defined(_WIN64) || defined(_WIN32)
+
+static size_t cache_size(int level) { return 0; }
+
+long
+bench_footprint(bench_kernel_t k, void *fn, const BenchBufs &b,
+                vector<const char *> &lines)
+{
+    return -1;
+}
+
+void bench_flush(const vector<const char *> &lines) {}
+
+#else
+
+#include <dlfcn.h>
+#include <link.h>
+#include <x86intrin.h>
+
+/* Data or unified cache of cpu0 at a level, from sysfs */
+static size_t
+cache_size(int level)
+{
+    for (int i = 0; ; i++) {
+        string dir = "/sys/devices/system/cpu/cpu0/cache/index" + to_string(i) + "/";
+        char lvl[16] = "", type[32] = "", size[32] = "";
+        FILE *f;
+
+        for (auto &e : {make_pair("level", lvl), make_pair("type", type),
+                        make_pair("size", size)}) {
+            if (!(f = fopen((dir + e.first).c_str(), "r")))
+                return 0;
+            if (fscanf(f, "%15s", e.second) != 1)
+                e.second[0] = 0;
+            fclose(f);
+        }
+
+        if (atoi(lvl) == level && strcmp(type, "Instruction") != 0)
+            return parse_size(size);
+    }
+}
+
+/* The non-executable PT_LOAD segments of the object that has fn */
+struct SegSearch {
+    const char                        *fn;
+    vector<pair<const char *, const char *>> segs;
+};
+
+static int
+seg_find(struct dl_phdr_info *info, size_t, void *arg)
+{
+    SegSearch *s = (SegSearch *)arg;
+    bool mine = false;
+
+    for (int i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr) &ph = info->dlpi_phdr[i];
+        const char *lo = (const char *)info->dlpi_addr + ph.p_vaddr;
+
+        if (ph.p_type == PT_LOAD && (ph.p_flags & PF_X) &&
+            s->fn >= lo && s->fn < lo + ph.p_memsz)
+            mine = true;
+    }
+    if (!mine)
+        return 0;
+
+    for (int i = 0; i < info->dlpi_phnum; i++) {
+        const ElfW(Phdr) &ph = info->dlpi_phdr[i];
+        uintptr_t lo = info->dlpi_addr + ph.p_vaddr;
+        uintptr_t hi = lo + ph.p_memsz;
+
+        if (ph.p_type != PT_LOAD || (ph.p_flags & PF_X))
+            continue;
+
+        /* The segments are mapped whole pages, so whole lines are there */
+        lo &= ~(uintptr_t)(BENCH_LINE - 1);
+        hi = (hi + BENCH_LINE - 1) & ~(uintptr_t)(BENCH_LINE - 1);
+        s->segs.push_back({(const char *)lo, (const char *)hi});
+    }
+
+    return 1;
+}
+
+static inline uint64_t
+load_time(const char *p)
+{
+    unsigned aux;
+    uint64_t t0, t1;
+
+    t0 = __rdtscp(&aux);
+    _mm_lfence();
+    (void)*(const volatile char *)p;
+    t1 = __rdtscp(&aux);
+    _mm_lfence();
+
+    return t1 - t0;
+}
+
+/* Halfway between a cached and a flushed load, 0 if they do not differ */
+static uint64_t
+load_threshold(void)
+{
+    alignas(BENCH_LINE) static char line[BENCH_LINE];
+    vector<uint64_t> hit, miss;
+
+    for (int i = 0; i < 101; i++) {
+        (void)*(volatile char *)line;
+        hit.push_back(load_time(line));
+
+        _mm_clflush(line);
+        _mm_mfence();
+        miss.push_back(load_time(line));
+    }
+
+    nth_element(hit.begin(), hit.begin() + 50, hit.end());
+    nth_element(miss.begin(), miss.begin() + 50, miss.end());
+    if (miss[50] < 2 * hit[50])
+        return 0;
+
+    return (hit[50] + miss[50]) / 2;
+}
+
+/*
+ * The lines are done a chunk at a time, flush, call, read back, so that
+ * reading the misses does not push the touched lines out to L3 first.
+ * Even and odd lines are read back in separate runs, in random order,
+ * so that neither the adjacent line nor the stream prefetcher turns the
+ * read of one line into a hit on another.
+ */
+long
+bench_footprint(bench_kernel_t k, void *fn, const BenchBufs &b,
+                vector<const char *> &lines)
+{
+    SegSearch s = {(const char *)fn, {}};
+    vector<const char *> all, chunk;
+    vector<size_t> order;
+    uint64_t thr = load_threshold();
+    mt19937 gen(1);
+
+    lines.clear();
+    if (!thr || !dl_iterate_phdr(seg_find, &s))
+        return -1;
+
+    for (auto &seg : s.segs)
+        for (const char *p = seg.first; p < seg.second; p += BENCH_LINE)
+            all.push_back(p);
+
+    vector<uint8_t> hits(all.size());
+
+    k(fn, b);                           /* code and TLB warm */
+
+    for (size_t c = 0; c < all.size(); c += FP_CHUNK) {
+        size_t end = min(all.size(), c + FP_CHUNK);
+
+        chunk.assign(all.begin() + c, all.begin() + end);
+
+        for (int rep = 0; rep < 2 * FP_REPS; rep++) {
+            order.clear();
+            for (size_t i = c + (rep & 1); i < end; i += 2)
+                order.push_back(i);
+            shuffle(order.begin(), order.end(), gen);
+
+            bench_flush(chunk);
+            k(fn, b);
+            _mm_mfence();
+
+            for (size_t i : order)
+                if (load_time(all[i]) < thr)
+                    hits[i]++;
+        }
+    }
+
+    for (size_t i = 0; i < all.size(); i++)
+        if (hits[i] == FP_REPS)
+            lines.push_back(all[i]);
+
+    return (long)(lines.size() * BENCH_LINE);
+}
+
+void
+bench_flush(const vector<const char *> &lines)
+{
+    for (const char *p : lines)
+        _mm_clflush(p);
+    _mm_mfence();
+}
+
+#endif
+
+bool
+bench_cold_modes(const vector<string> &spec, vector<BenchCold> &out)
+{
+    out.push_back({"warm", 0, false});
+
+    for (const string &s : spec) {
+        BenchCold c = {s, 0, s == "flush"};
+
+        if (s.size() == 2 && tolower((unsigned char)s[0]) == 'l' &&
+            s[1] >= '1' && s[1] <= '3') {
+            if (!(c.bytes = cache_size(s[1] - '0'))) {
+                fprintf(stderr, "--cold: cannot read the %s size\n", s.c_str());
+                return false;
+            }
+        } else if (!c.flush && !(c.bytes = parse_size(s))) {
+            fprintf(stderr, "--cold: %s is not l1, l2, l3, flush or a size\n",
+                    s.c_str());
+            return false;
+        }
+
+        c.bytes += c.bytes / 2;
+        out.push_back(c);
+    }
+
+    return true;
+}
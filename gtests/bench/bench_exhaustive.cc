@@ -0,0 +1,386 @@
+/*
+ * Copyright (C) 2008-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * --exhaustive: all 2^32 inputs of the unary float kernels.
+ *
+ * The input space is cut into 2^16 chunks of consecutive bit patterns,
+ * one sign/exponent/7 mantissa bits prefix each, handed out to the
+ * threads. For every chunk the reference is computed once and shared by
+ * all the kernels of the function: the glibc double function (well
+ * under 1 double ulp, i.e. 2^-29 float ulp), and mparith only when that
+ * lands within 2^-20 ulp of the midpoint between two floats, where the
+ * double is too close to tell which way the float result rounds. Without
+ * a glibc double function every input goes through mparith.
+ *
+ * Each chunk is also timed per kernel, which gives the ns/elem by input
+ * range.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <cfloat>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <chrono>
+
+#include <libm/iface.h>
+#include "bench.h"
+#include "../libs/mparith/alm_mp_funcs.h"
+
+using namespace std;
+
+#define EXH_CHUNKS      (1 << 16)
+#define EXH_CHUNK       (1 << 16)       /* inputs per chunk */
+#define EXH_NEAR        0x1p-20         /* ulp from a midpoint to use mparith */
+
+/*
+ * Error buckets: correctly rounded, then by ulps, and last a NaN or inf
+ * that should not be one or the other way round
+ */
+static const double exh_bounds[] = {0, 1, 2, 4, 16, INFINITY};
+static const char *exh_buckets[] = {"rounded", "<=1", "<=2", "<=4", "<=16",
+                                    ">16", "wrong"};
+#define EXH_BUCKETS     7
+
+/* Sign, then zero/subnormal, 8 groups of 32 binades, inf/nan */
+#define EXH_GROUPS      10
+#define EXH_RANGES      (2 * EXH_GROUPS)
+
+static const struct {
+    const char *name;
+    double    (*mp)(float);
+} mp_funcs[] = {
+    {"acos",  alm_mp_acosf},  {"acosh", alm_mp_acoshf}, {"asin",  alm_mp_asinf},
+    {"asinh", alm_mp_asinhf}, {"atan",  alm_mp_atanf},  {"atanh", alm_mp_atanhf},
+    {"cbrt",  alm_mp_cbrtf},  {"ceil",  alm_mp_ceilf},  {"cos",   alm_mp_cosf},
+    {"cosh",  alm_mp_coshf},  {"cospi", alm_mp_cospif}, {"erf",   alm_mp_erff},
+    {"exp",   alm_mp_expf},   {"exp2",  alm_mp_exp2f},  {"exp10", alm_mp_exp10f},
+    {"expm1", alm_mp_expm1f}, {"fabs",  alm_mp_fabsf},  {"floor", alm_mp_floorf},
+    {"log",   alm_mp_logf},   {"log2",  alm_mp_log2f},  {"log10", alm_mp_log10f},
+    {"log1p", alm_mp_log1pf}, {"logb",  alm_mp_logbf},  {"rint",  alm_mp_rintf},
+    {"round", alm_mp_roundf}, {"sin",   alm_mp_sinf},   {"sinh",  alm_mp_sinhf},
+    {"sinpi", alm_mp_sinpif}, {"sqrt",  alm_mp_sqrtf},  {"tan",   alm_mp_tanf},
+    {"tanh",  alm_mp_tanhf},  {"tanpi", alm_mp_tanpif}, {"trunc", alm_mp_truncf},
+};
+
+struct ExhStat {
+    double   max_ulp = 0;
+    uint32_t worst = 0;                 /* bits of the x with max_ulp */
+    uint64_t hist[EXH_BUCKETS] = {};
+    double   ns[EXH_RANGES] = {};
+    uint64_t n[EXH_RANGES] = {};
+
+    void merge(const ExhStat &o) {
+        if (o.max_ulp > max_ulp) {
+            max_ulp = o.max_ulp;
+            worst = o.worst;
+        }
+        for (int i = 0; i < EXH_BUCKETS; i++)
+            hist[i] += o.hist[i];
+        for (int i = 0; i < EXH_RANGES; i++) {
+            ns[i] += o.ns[i];
+            n[i] += o.n[i];
+        }
+    }
+};
+
+static int
+exh_range(uint32_t chunk)
+{
+    int e = (chunk >> 7) & 0xff;
+    int g = e == 0 ? 0 : e == 0xff ? EXH_GROUPS - 1 : 1 + (e - 1) / 32;
+
+    return (int)(chunk >> 15) * EXH_GROUPS + g;
+}
+
+static string
+exh_range_name(int r)
+{
+    int g = r % EXH_GROUPS;
+    char buf[64];
+    char s = r >= EXH_GROUPS ? '-' : '+';
+
+    if (g == 0)
+        snprintf(buf, sizeof(buf), "%c0/denormal", s);
+    else if (g == EXH_GROUPS - 1)
+        snprintf(buf, sizeof(buf), "%cinf/nan", s);
+    else
+        snprintf(buf, sizeof(buf), "%c[2^%d,2^%d)", s, 32 * (g - 1) - 126,
+                 g == EXH_GROUPS - 2 ? 128 : 32 * g - 126);
+
+    return buf;
+}
+
+/*
+ * The reference of one input: the exact value, its float rounding and
+ * 1 / ulp there, computed once for all the kernels
+ */
+struct ExhRef {
+    double  ref;
+    float   fr;
+    double  inv;
+};
+
+static ExhRef
+exh_ref(double ref)
+{
+    ExhRef r = {ref, (float)ref, 0x1p-104};
+    int e;
+
+    if (std::isfinite(r.fr)) {
+        e = ref == 0 ? -126 : ilogb(ref);
+        r.inv = ldexp(1, 23 - (e < -126 ? -126 : e));
+    }
+
+    return r;
+}
+
+/* Error of r in float ulps, INFINITY for a wrong NaN/inf */
+static double
+exh_ulp(float r, const ExhRef &x)
+{
+    if (std::isnan(x.fr))
+        return std::isnan(r) ? 0 : INFINITY;
+    if (std::isinf(x.fr) && r == x.fr)
+        return 0;
+    if (std::isinf(r) || std::isnan(r))
+        return INFINITY;
+
+    return fabs((double)r - x.ref) * x.inv;
+}
+
+/* Whether ref is too close to a float midpoint to round it with confidence */
+static bool
+exh_near_midpoint(double ref)
+{
+    float f = (float)ref;
+
+    if (!std::isfinite(ref) || std::isinf(f) || ref == (double)f)
+        return false;
+
+    double u = ldexp(1, (ilogb(f) < -126 ? -126 : ilogb(f)) - 23);
+    double frac = fabs(ref - (double)f) / u;     /* at most 0.5 */
+
+    return 0.5 - frac < EXH_NEAR;
+}
+
+struct ExhJob {
+    const vector<BenchCase>  *cases;
+    double                  (*fast)(double);
+    double                  (*mp)(float);
+    bool                      has_range;
+    double                    lo, hi;
+    atomic<uint32_t>          next{0};
+    atomic<uint64_t>          inputs{0}, mp_calls{0};
+    mutex                     lock;
+    vector<ExhStat>           stats;
+};
+
+static void
+exh_worker(ExhJob *job)
+{
+    const vector<BenchCase> &cases = *job->cases;
+    size_t nk = cases.size();
+    vector<ExhStat> stats(nk);
+    vector<float> x(EXH_CHUNK + BENCH_MAX_LANES), r(x.size());
+    vector<ExhRef> ref(x.size());
+    vector<bench_kernel_t> kern(nk);
+    uint64_t inputs = 0, mp_calls = 0;
+    uint32_t chunk;
+
+    for (size_t k = 0; k < nk; k++)
+        kern[k] = bench_kernel(SIG_UNARY, cases[k].slot);
+
+    while ((chunk = job->next.fetch_add(1)) < EXH_CHUNKS) {
+        int n = 0, range = exh_range(chunk);
+
+        for (uint32_t i = 0; i < EXH_CHUNK; i++) {
+            uint32_t u = chunk << 16 | i;
+            float v;
+
+            memcpy(&v, &u, sizeof(v));
+            if (job->has_range && !(v >= job->lo && v <= job->hi))
+                continue;
+            x[n++] = v;
+        }
+        if (n == 0)
+            continue;
+
+        for (int i = 0; i < n; i++) {
+            double v = job->fast ? job->fast(x[i]) : job->mp(x[i]);
+
+            if (job->fast && job->mp && exh_near_midpoint(v)) {
+                v = job->mp(x[i]);
+                mp_calls++;
+            }
+            ref[i] = exh_ref(v);
+        }
+        inputs += n;
+
+        /* Whole vectors, the padding lanes are not checked */
+        int padded = (n + BENCH_MAX_LANES - 1) / BENCH_MAX_LANES * BENCH_MAX_LANES;
+        for (int i = n; i < padded; i++)
+            x[i] = x[n - 1];
+
+        BenchBufs b = {x.data(), x.data(), r.data(), padded, 0};
+
+        for (size_t k = 0; k < nk; k++) {
+            ExhStat &st = stats[k];
+            auto t0 = chrono::steady_clock::now();
+
+            kern[k](cases[k].fn, b);
+
+            st.ns[range] += chrono::duration<double, nano>(
+                chrono::steady_clock::now() - t0).count();
+            st.n[range] += padded;
+
+            for (int i = 0; i < n; i++) {
+                double err = exh_ulp(r[i], ref[i]);
+                int bk = 1;
+
+                if (r[i] == ref[i].fr || (std::isnan(r[i]) && std::isnan(ref[i].fr)))
+                    bk = 0;
+                else
+                    while (bk < EXH_BUCKETS - 1 && !(err <= exh_bounds[bk]))
+                        bk++;
+                st.hist[bk]++;
+
+                if (std::isfinite(err) && err > st.max_ulp) {
+                    st.max_ulp = err;
+                    memcpy(&st.worst, &x[i], sizeof(st.worst));
+                }
+            }
+        }
+    }
+
+    lock_guard<mutex> g(job->lock);
+    for (size_t k = 0; k < nk; k++)
+        job->stats[k].merge(stats[k]);
+    job->inputs += inputs;
+    job->mp_calls += mp_calls;
+}
+
+bool
+bench_exhaustive(const char *name, const vector<BenchCase> &cases, int jobs,
+                 bool has_range, double lo, double hi)
+{
+    ExhJob job;
+
+    job.cases = &cases;
+    job.fast = (double (*)(double))bench_glibc_libm(name, ALM_FUNC_SCAL_DP);
+    job.mp = NULL;
+    for (const auto &m : mp_funcs)
+        if (strcmp(m.name, name) == 0)
+            job.mp = m.mp;
+    job.has_range = has_range;
+    job.lo = lo;
+    job.hi = hi;
+    job.stats.resize(cases.size());
+
+    if (!job.fast && !job.mp) {
+        printf("# %s: skipped, no glibc double or mparith reference\n", name);
+        return false;
+    }
+
+    auto t0 = chrono::steady_clock::now();
+    vector<thread> pool;
+
+    for (int i = 0; i < jobs; i++)
+        pool.emplace_back(exh_worker, &job);
+    for (thread &t : pool)
+        t.join();
+
+    double secs = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+    uint64_t inputs = job.inputs;
+
+    printf("\n# %s: %llu inputs, %d threads, %.1f s, %.1f Minputs/s\n", name,
+           (unsigned long long)inputs, jobs, secs, inputs / secs / 1e6);
+    if (job.fast)
+        printf("# reference glibc %s, mparith for %llu inputs near a rounding "
+               "midpoint\n", name, (unsigned long long)job.mp_calls);
+    else
+        printf("# reference mparith %sf\n", name);
+
+    printf("%-16s %-6s %-8s %-2s %9s %-10s", "function", "var", "impl", "",
+           "max ulp", "at x");
+    for (int b = 0; b < EXH_BUCKETS; b++)
+        printf(" %11s", exh_buckets[b]);
+    printf(" %8s\n", "ns/elem");
+
+    for (size_t k = 0; k < cases.size(); k++) {
+        const BenchCase &c = cases[k];
+        const ExhStat &st = job.stats[k];
+        double ns = 0;
+        uint64_t n = 0;
+
+        for (int i = 0; i < EXH_RANGES; i++) {
+            ns += st.ns[i];
+            n += st.n[i];
+        }
+
+        printf("%-16s %-6s %-8s %-2s %9.3f 0x%08x", name, slot_names[c.var],
+               c.tag, c.dispatched ? "*" : "", st.max_ulp, st.worst);
+        for (int b = 0; b < EXH_BUCKETS; b++)
+            printf(" %11llu", (unsigned long long)st.hist[b]);
+        printf(" %8.3f\n", n ? ns / n : 0);
+    }
+
+    /* Throughput by range of x, for the kernels the library dispatches to */
+    printf("\n# %s ns/elem by range of x, dispatched kernels\n%-18s", name, "x");
+    for (const BenchCase &c : cases)
+        if (c.dispatched)
+            printf(" %8s", slot_names[c.var]);
+    printf("\n");
+
+    for (int i = 0; i < EXH_RANGES; i++) {
+        bool any = false;
+
+        for (size_t k = 0; k < cases.size(); k++)
+            any |= job.stats[k].n[i] != 0;
+        if (!any)
+            continue;
+
+        printf("%-18s", exh_range_name(i).c_str());
+        for (size_t k = 0; k < cases.size(); k++) {
+            const ExhStat &st = job.stats[k];
+
+            if (cases[k].dispatched)
+                printf(" %8.3f", st.n[i] ? st.ns[i] / st.n[i] : 0);
+        }
+        printf("\n");
+    }
+    fflush(stdout);
+
+    return true;
+}
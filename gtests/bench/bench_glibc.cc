@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2008-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * glibc side of --compare: libm.so.6 and libmvec.so.1 are loaded with
+ * dlopen(), as in gtests/dynamic, so that the same process can run the
+ * same inputs through AOCL-LibM and glibc.
+ *
+ * The max ULP of a result is measured against the next wider glibc
+ * function: the double one for float results (exp for expf) and the
+ * long double one for double results (expl for exp).
+ */
+
+#include <cmath>
+#include <cstring>
+#include <cstdio>
+#include <string>
+
+#include <libm/iface.h>
+#include "bench.h"
+
+#if defined(_WIN64) || defined(_WIN32)
+
+bool bench_glibc_open(void) { return false; }
+void *bench_glibc_libm(const char *, int) { return NULL; }
+void *bench_glibc_libmvec(const char *, int, bool, bool, int *) { return NULL; }
+void *bench_glibc_ref(const char *, int) { return NULL; }
+double bench_max_ulp(const BenchCase &, const BenchBufs &) { return -1; }
+
+#else
+
+#include <dlfcn.h>
+#include <link.h>
+
+using namespace std;
+
+static void *libm_handle, *libmvec_handle;
+
+bool
+bench_glibc_open(void)
+{
+    libm_handle = dlopen("libm.so.6", RTLD_NOW);
+    if (!libm_handle) {
+        fprintf(stderr, "%s\n", dlerror());
+        return false;
+    }
+
+    /* Older glibc has no libmvec, the vector columns are left empty */
+    libmvec_handle = dlopen("libmvec.so.1", RTLD_NOW);
+
+    return true;
+}
+
+/*
+ * dlsym() on a handle also searches the library's dependencies, make
+ * sure the symbol is the library's own (div() is in libc, not libm).
+ */
+static void *
+bench_dlsym(void *handle, const string &name)
+{
+    struct link_map *lm;
+    Dl_info info;
+    void *fn;
+
+    if (!handle || !(fn = dlsym(handle, name.c_str())))
+        return NULL;
+
+    if (dlinfo(handle, RTLD_DI_LINKMAP, &lm) != 0 ||
+        !dladdr(fn, &info) || !info.dli_fname ||
+        strcmp(lm->l_name, info.dli_fname) != 0)
+        return NULL;
+
+    return fn;
+}
+
+static bool
+slot_is_float(int slot)
+{
+    return slot_size(slot, false) == sizeof(float);
+}
+
+void *
+bench_glibc_libm(const char *name, int slot)
+{
+    return bench_dlsym(libm_handle, string(name) + (slot_is_float(slot) ? "f" : ""));
+}
+
+/*
+ * x86_64 vector ABI names, _ZGV<isa>N<lanes><args>_<name>: isa is b for
+ * SSE, d for AVX2 and e for AVX512. An array is run with the widest
+ * vector function there is.
+ */
+void *
+bench_glibc_libmvec(const char *name, int slot, bool binary, bool avx512,
+                    int *kslot)
+{
+    static const struct {
+        int         slot;
+        const char *prefix;
+        bool        is512;
+    } vecs[] = {
+        {ALM_FUNC_VECT_SP_16, "_ZGVeN16", true},
+        {ALM_FUNC_VECT_SP_8,  "_ZGVdN8",  false},
+        {ALM_FUNC_VECT_SP_4,  "_ZGVbN4",  false},
+        {ALM_FUNC_VECT_DP_8,  "_ZGVeN8",  true},
+        {ALM_FUNC_VECT_DP_4,  "_ZGVdN4",  false},
+        {ALM_FUNC_VECT_DP_2,  "_ZGVbN2",  false},
+    };
+    bool arr = slot == ALM_FUNC_VECT_SP_ARR || slot == ALM_FUNC_VECT_DP_ARR;
+    bool fp = slot_is_float(slot);
+
+    for (const auto &v : vecs) {
+        if (v.slot != slot && !(arr && slot_is_float(v.slot) == fp))
+            continue;
+        if (v.is512 && !avx512)
+            continue;
+
+        void *fn = bench_dlsym(libmvec_handle,
+                               string(v.prefix) + (binary ? "vv_" : "v_") +
+                               name + (fp ? "f" : ""));
+        if (fn) {
+            *kslot = v.slot;
+            return fn;
+        }
+    }
+
+    return NULL;
+}
+
+void *
+bench_glibc_ref(const char *name, int slot)
+{
+    return bench_dlsym(libm_handle, string(name) + (slot_is_float(slot) ? "" : "l"));
+}
+
+/* Error of r in units of the last place of the result type at ref */
+static double
+ulp_err(long double r, long double ref, int mant, int emin)
+{
+    if (std::isnan(ref))
+        return std::isnan(r) ? 0 : INFINITY;
+    if (std::isinf(ref) || std::isinf(r))
+        return r == ref ? 0 : INFINITY;
+
+    int e = ref == 0 ? emin : ilogbl(ref);
+    if (e < emin)
+        e = emin;
+
+    return (double)(fabsl(r - ref) / ldexpl(1, e - mant));
+}
+
+double
+bench_max_ulp(const BenchCase &c, const BenchBufs &b)
+{
+    bool binary = c.func.sig == SIG_BINARY;
+    double worst = 0;
+
+    if (!c.ref)
+        return -1;
+
+    for (int i = 0; i < b.n; i++) {
+        double err;
+
+        if (slot_is_float(c.slot)) {
+            float x = ((float *)b.x)[i], y = ((float *)b.y)[i];
+            double ref = binary ? ((double (*)(double, double))c.ref)(x, y) :
+                                  ((double (*)(double))c.ref)(x);
+
+            err = ulp_err(((float *)b.r)[i], ref, 23, -126);
+        } else {
+            double x = ((double *)b.x)[i], y = ((double *)b.y)[i];
+            long double ref = binary ?
+                ((long double (*)(long double, long double))c.ref)(x, y) :
+                ((long double (*)(long double))c.ref)(x);
+
+            err = ulp_err(((double *)b.r)[i], ref, 52, -1022);
+        }
+
+        if (err > worst)
+            worst = err;
+    }
+
+    return worst;
+}
+
+#endif
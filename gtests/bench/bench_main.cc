@@ -0,0 +1,1643 @@
+/*
+ * Copyright (C) 2008-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Table driven benchmark of every kernel in the dispatch tables.
+ *
+ * The functions and their variants are not listed here, they are read
+ * from the library's own tables (src/iface/ *.c) through
+ * alm_iface_name()/alm_iface_funcs(). Every non-NULL real, half and
+ * bfloat16 slot of every uarch row the host can run is registered as
+ * one benchmark named function/variant/uarch, e.g. "exp/v4d/zen4".
+ *
+ * All that is kept per function is how to call it (bench_funcs[], one
+ * row per function that is not a plain y = f(x)) and the default input
+ * range, so a new function in the library is benchmarked without any
+ * change here.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <random>
+#include <cmath>
+#include <thread>
+#include <chrono>
+#include <immintrin.h>
+#if defined(_WIN64) || defined(_WIN32)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+#include "benchmark.h"
+#include <external/amdlibm.h>
+#include <libm/iface.h>
+#include "bench.h"
+
+using namespace std;
+
+
+
+#define BENCH_DEF_LO    -10.0
+#define BENCH_DEF_HI     10.0
+
+/*
+ * Functions that are not y = f(x) on [-10, 10]. Anything not listed here
+ * is benchmarked as unary with the default range.
+ */
+static const BenchFunc bench_funcs[] = {
+    {"acos",         SIG_UNARY,      -1,     1,     0,  0, NULL},
+    {"asin",         SIG_UNARY,      -1,     1,     0,  0, NULL},
+    {"atanh",        SIG_UNARY,      -1,     1,     0,  0, NULL},
+    {"erfinv",       SIG_UNARY,      -1,     1,     0,  0, NULL},
+    {"erfcinv",      SIG_UNARY,       0,     2,     0,  0, NULL},
+    {"cdfnorminv",   SIG_UNARY,       0,     1,     0,  0, NULL},
+    {"acosh",        SIG_UNARY,       1,   100,     0,  0, NULL},
+    {"log",          SIG_UNARY,   0.001,  1000,     0,  0, NULL},
+    {"log2",         SIG_UNARY,   0.001,  1000,     0,  0, NULL},
+    {"log10",        SIG_UNARY,   0.001,  1000,     0,  0, NULL},
+    {"log1p",        SIG_UNARY,   -0.99,  1000,     0,  0, NULL},
+    {"sqrt",         SIG_UNARY,       0,  1000,     0,  0, NULL},
+    {"rsqrt",        SIG_UNARY,   0.001,  1000,     0,  0, NULL},
+    {"rsqrt_approx", SIG_UNARY,   0.001,  1000,     0,  0, NULL},
+    {"invcbrt",      SIG_UNARY,   0.001,  1000,     0,  0, NULL},
+    {"lgamma",       SIG_UNARY,     0.1,    20,     0,  0, NULL},
+    {"tgamma",       SIG_UNARY,     0.1,    20,     0,  0, NULL},
+    {"digamma",      SIG_UNARY,     0.1,    20,     0,  0, NULL},
+
+    {"atan2",        SIG_BINARY,    -10,    10,   -10, 10, NULL},
+    {"hypot",        SIG_BINARY,    -10,    10,   -10, 10, NULL},
+    {"rhypot",       SIG_BINARY,    -10,    10,   -10, 10, NULL},
+    {"pow",          SIG_BINARY,  0.001,    10,   -10, 10, NULL},
+    {"fmod",         SIG_BINARY,    -10,    10,     1, 10, NULL},
+    {"remainder",    SIG_BINARY,    -10,    10,     1, 10, NULL},
+    {"fdim",         SIG_BINARY,    -10,    10,   -10, 10, NULL},
+    {"fmax",         SIG_BINARY,    -10,    10,   -10, 10, NULL},
+    {"fmin",         SIG_BINARY,    -10,    10,   -10, 10, NULL},
+    {"copysign",     SIG_BINARY,    -10,    10,   -10, 10, NULL},
+    {"nextafter",    SIG_BINARY,    -10,    10,   -10, 10, NULL},
+    {"add",          SIG_BINARY,    -10,    10,   -10, 10, NULL},
+    {"sub",          SIG_BINARY,    -10,    10,   -10, 10, NULL},
+    {"mul",          SIG_BINARY,    -10,    10,   -10, 10, NULL},
+    {"div",          SIG_BINARY,    -10,    10,     1, 10, NULL},
+    {"powx",         SIG_POWX,    0.001,    10,   2.5,  0, NULL},
+    {"pown",         SIG_POWN,      -10,    10,     3,  0, NULL},
+    {"rootn",        SIG_POWN,    0.001,  1000,     3,  0, NULL},
+    {"linearfrac",   SIG_LINEARFRAC, -10,   10,     1, 10, NULL},
+
+    {"sincos",       SIG_NONE, 0, 0, 0, 0, "two outputs"},
+    {"frexp",        SIG_NONE, 0, 0, 0, 0, "int output"},
+    {"modf",         SIG_NONE, 0, 0, 0, 0, "two outputs"},
+    {"remquo",       SIG_NONE, 0, 0, 0, 0, "two outputs"},
+    {"ldexp",        SIG_NONE, 0, 0, 0, 0, "int argument"},
+    {"scalbn",       SIG_NONE, 0, 0, 0, 0, "int argument"},
+    {"scalbln",      SIG_NONE, 0, 0, 0, 0, "long argument"},
+    {"nexttoward",   SIG_NONE, 0, 0, 0, 0, "long double argument"},
+    {"fma",          SIG_NONE, 0, 0, 0, 0, "three arguments"},
+    {"nan",          SIG_NONE, 0, 0, 0, 0, "string argument"},
+    {"finite",       SIG_NONE, 0, 0, 0, 0, "int output"},
+    {"ilogb",        SIG_NONE, 0, 0, 0, 0, "int output"},
+    {"lrint",        SIG_NONE, 0, 0, 0, 0, "integer output"},
+    {"llrint",       SIG_NONE, 0, 0, 0, 0, "integer output"},
+    {"lround",       SIG_NONE, 0, 0, 0, 0, "integer output"},
+    {"llround",      SIG_NONE, 0, 0, 0, 0, "integer output"},
+    {"addi",         SIG_NONE, 0, 0, 0, 0, "strided arrays"},
+    {"subi",         SIG_NONE, 0, 0, 0, 0, "strided arrays"},
+    {"muli",         SIG_NONE, 0, 0, 0, 0, "strided arrays"},
+    {"divi",         SIG_NONE, 0, 0, 0, 0, "strided arrays"},
+    {"fmaxi",        SIG_NONE, 0, 0, 0, 0, "strided arrays"},
+    {"fmini",        SIG_NONE, 0, 0, 0, 0, "strided arrays"},
+    {"exp_affine",   SIG_NONE, 0, 0, 0, 0, "affine arguments"},
+    {"log_affine",   SIG_NONE, 0, 0, 0, 0, "affine arguments"},
+    {"pow_affine",   SIG_NONE, 0, 0, 0, 0, "affine arguments"},
+    {"sin_affine",   SIG_NONE, 0, 0, 0, 0, "affine arguments"},
+    {"cos_affine",   SIG_NONE, 0, 0, 0, 0, "affine arguments"},
+    {"tanh_affine",  SIG_NONE, 0, 0, 0, 0, "affine arguments"},
+    {"sumexp",       SIG_NONE, 0, 0, 0, 0, "reduction"},
+    {"logsumexp",    SIG_NONE, 0, 0, 0, 0, "reduction"},
+    {"sumlog",       SIG_NONE, 0, 0, 0, 0, "reduction"},
+    {"softmax",      SIG_NONE, 0, 0, 0, 0, "reduction"},
+    {"cis",          SIG_NONE, 0, 0, 0, 0, "complex output"},
+    {"polar",        SIG_NONE, 0, 0, 0, 0, "complex output"},
+    {"boxmuller",    SIG_NONE, 0, 0, 0, 0, "two inputs, two outputs"},
+};
+
+static const BenchFunc *
+bench_func(const char *name)
+{
+    static BenchFunc def;
+
+    for (const BenchFunc &f : bench_funcs)
+        if (strcmp(f.name, name) == 0)
+            return &f;
+
+    def = {name, SIG_UNARY, BENCH_DEF_LO, BENCH_DEF_HI,
+           BENCH_DEF_LO, BENCH_DEF_HI, NULL};
+    return &def;
+}
+
+static const char *uarch_names[ALM_UARCH_MAX] = {
+    "default", "base64", "fma3", "zen", "zen2", "zen3", "zen4", "zen5",
+};
+
+/*
+ * Short variant names, indexed by ALM_FUNC_*: s1 for scalar, vN for N
+ * lanes, va for array, then the element type (s, d, h, b, bf for bfloat16
+ * in and float out).
+ */
+const char *slot_names[ALM_FUNC_VAR_MAX] = {
+    "s1s",  "s1d",                      /* ALM_FUNC_SCAL_SP, _DP */
+    "v4s",  "v8s",  "v2d",  "v4d",      /* ALM_FUNC_VECT_SP_4 .. _DP_4 */
+    "vas",  "vad",                      /* ALM_FUNC_VECT_SP_ARR, _DP_ARR */
+    "s1h",  "v8h",  "v16h", "v32h",     /* ALM_FUNC_SCAL_HP .. _HP_32 */
+    "vah",  "vab",  "vabf",             /* ALM_FUNC_VECT_HP_ARR .. _BF16_F32_ARR */
+    "v16s", "v8d",                      /* ALM_FUNC_VECT_SP_16, _DP_8 */
+};
+
+/*
+ * Element type T, result element type R and register type V of a slot.
+ * The kernels below take them from here rather than as template
+ * arguments, which would drop the vector types' attributes.
+ */
+template <int S> struct BenchSlot;
+
+#define BENCH_SLOT(s, t, r, v, a)                                       \
+    template <> struct BenchSlot<s> {                                   \
+        typedef t T; typedef r R; typedef v V;                          \
+        static const bool arr = a;                                      \
+    }
+
+BENCH_SLOT(ALM_FUNC_SCAL_SP,           float,   float,   float,   false);
+BENCH_SLOT(ALM_FUNC_SCAL_DP,           double,  double,  double,  false);
+BENCH_SLOT(ALM_FUNC_VECT_SP_4,         float,   float,   __m128,  false);
+BENCH_SLOT(ALM_FUNC_VECT_SP_8,         float,   float,   __m256,  false);
+BENCH_SLOT(ALM_FUNC_VECT_DP_2,         double,  double,  __m128d, false);
+BENCH_SLOT(ALM_FUNC_VECT_DP_4,         double,  double,  __m256d, false);
+BENCH_SLOT(ALM_FUNC_VECT_SP_ARR,       float,   float,   float,   true);
+BENCH_SLOT(ALM_FUNC_VECT_DP_ARR,       double,  double,  double,  true);
+BENCH_SLOT(ALM_FUNC_SCAL_HP,           int16_t, int16_t, int16_t, false);
+BENCH_SLOT(ALM_FUNC_VECT_HP_8,         int16_t, int16_t, __m128i, false);
+BENCH_SLOT(ALM_FUNC_VECT_HP_16,        int16_t, int16_t, __m256i, false);
+BENCH_SLOT(ALM_FUNC_VECT_HP_ARR,       int16_t, int16_t, int16_t, true);
+BENCH_SLOT(ALM_FUNC_VECT_BF16_ARR,     int16_t, int16_t, int16_t, true);
+BENCH_SLOT(ALM_FUNC_VECT_BF16_F32_ARR, int16_t, float,   int16_t, true);
+#if defined(__AVX512__)
+BENCH_SLOT(ALM_FUNC_VECT_HP_32,        int16_t, int16_t, __m512i, false);
+BENCH_SLOT(ALM_FUNC_VECT_SP_16,        float,   float,   __m512,  false);
+BENCH_SLOT(ALM_FUNC_VECT_DP_8,         double,  double,  __m512d, false);
+#endif
+
+/*
+ * One call per register, or one call for the whole array. Vectors are
+ * loaded and stored with memcpy() so that any element count and
+ * alignment is fine.
+ */
+template <int S> static void
+bench_unary(void *fn, const BenchBufs &b)
+{
+    typedef typename BenchSlot<S>::T T;
+    typedef typename BenchSlot<S>::R R;
+    typedef typename BenchSlot<S>::V V;
+
+    if (BenchSlot<S>::arr) {
+        ((void (*)(int, T *, R *))fn)(b.n, (T *)b.x, (R *)b.r);
+        return;
+    }
+
+    V (*f)(V) = (V (*)(V))fn;
+    char *x = (char *)b.x, *r = (char *)b.r;
+
+    for (size_t i = 0; i < b.n * sizeof(T); i += sizeof(V)) {
+        V v;
+        memcpy(&v, x + i, sizeof(v));
+        v = f(v);
+        memcpy(r + i, &v, sizeof(v));
+    }
+}
+
+template <int S> static void
+bench_binary(void *fn, const BenchBufs &b)
+{
+    typedef typename BenchSlot<S>::T T;
+    typedef typename BenchSlot<S>::V V;
+
+    if (BenchSlot<S>::arr) {
+        ((void (*)(int, T *, T *, T *))fn)(b.n, (T *)b.x, (T *)b.y, (T *)b.r);
+        return;
+    }
+
+    V (*f)(V, V) = (V (*)(V, V))fn;
+    char *x = (char *)b.x, *y = (char *)b.y, *r = (char *)b.r;
+
+    for (size_t i = 0; i < b.n * sizeof(T); i += sizeof(V)) {
+        V u, v;
+        memcpy(&u, x + i, sizeof(u));
+        memcpy(&v, y + i, sizeof(v));
+        u = f(u, v);
+        memcpy(r + i, &u, sizeof(u));
+    }
+}
+
+template <int S> static void
+bench_powx(void *fn, const BenchBufs &b)
+{
+    typedef typename BenchSlot<S>::T T;
+    typedef typename BenchSlot<S>::V V;
+    T s = (T)b.s;
+
+    if (BenchSlot<S>::arr) {
+        ((void (*)(int, T *, T, T *))fn)(b.n, (T *)b.x, s, (T *)b.r);
+        return;
+    }
+
+    V (*f)(V, T) = (V (*)(V, T))fn;
+    char *x = (char *)b.x, *r = (char *)b.r;
+
+    for (size_t i = 0; i < b.n * sizeof(T); i += sizeof(V)) {
+        V v;
+        memcpy(&v, x + i, sizeof(v));
+        v = f(v, s);
+        memcpy(r + i, &v, sizeof(v));
+    }
+}
+
+template <int S> static void
+bench_pown(void *fn, const BenchBufs &b)
+{
+    typedef typename BenchSlot<S>::T T;
+    typedef typename BenchSlot<S>::V V;
+    int k = (int)b.s;
+
+    if (BenchSlot<S>::arr) {
+        ((void (*)(int, T *, int, T *))fn)(b.n, (T *)b.x, k, (T *)b.r);
+        return;
+    }
+
+    V (*f)(V, int) = (V (*)(V, int))fn;
+    char *x = (char *)b.x, *r = (char *)b.r;
+
+    for (size_t i = 0; i < b.n * sizeof(T); i += sizeof(V)) {
+        V v;
+        memcpy(&v, x + i, sizeof(v));
+        v = f(v, k);
+        memcpy(r + i, &v, sizeof(v));
+    }
+}
+
+template <int S> static void
+bench_linearfrac(void *fn, const BenchBufs &b)
+{
+    typedef typename BenchSlot<S>::T T;
+    typedef typename BenchSlot<S>::V V;
+    T sx = (T)2, tx = (T)1, sy = (T)3, ty = (T)40;
+
+    if (BenchSlot<S>::arr) {
+        ((void (*)(int, T *, T *, T, T, T, T, T *))fn)
+            (b.n, (T *)b.x, (T *)b.y, sx, tx, sy, ty, (T *)b.r);
+        return;
+    }
+
+    V (*f)(V, V, T, T, T, T) = (V (*)(V, V, T, T, T, T))fn;
+    char *x = (char *)b.x, *y = (char *)b.y, *r = (char *)b.r;
+
+    for (size_t i = 0; i < b.n * sizeof(T); i += sizeof(V)) {
+        V u, v;
+        memcpy(&u, x + i, sizeof(u));
+        memcpy(&v, y + i, sizeof(v));
+        u = f(u, v, sx, tx, sy, ty);
+        memcpy(r + i, &u, sizeof(u));
+    }
+}
+
+template <int S> static bench_kernel_t
+bench_pick(BenchSig sig)
+{
+    switch (sig) {
+    case SIG_UNARY:      return bench_unary<S>;
+    case SIG_BINARY:     return bench_binary<S>;
+    case SIG_POWX:       return bench_powx<S>;
+    case SIG_POWN:       return bench_pown<S>;
+    case SIG_LINEARFRAC: return bench_linearfrac<S>;
+    default:             return NULL;
+    }
+}
+
+bench_kernel_t
+bench_kernel(BenchSig sig, int slot)
+{
+#define BENCH_CASE(s) case s: return bench_pick<s>(sig)
+    switch (slot) {
+    BENCH_CASE(ALM_FUNC_SCAL_SP);
+    BENCH_CASE(ALM_FUNC_SCAL_DP);
+    BENCH_CASE(ALM_FUNC_VECT_SP_4);
+    BENCH_CASE(ALM_FUNC_VECT_SP_8);
+    BENCH_CASE(ALM_FUNC_VECT_DP_2);
+    BENCH_CASE(ALM_FUNC_VECT_DP_4);
+    BENCH_CASE(ALM_FUNC_VECT_SP_ARR);
+    BENCH_CASE(ALM_FUNC_VECT_DP_ARR);
+    BENCH_CASE(ALM_FUNC_SCAL_HP);
+    BENCH_CASE(ALM_FUNC_VECT_HP_8);
+    BENCH_CASE(ALM_FUNC_VECT_HP_16);
+    BENCH_CASE(ALM_FUNC_VECT_HP_ARR);
+    BENCH_CASE(ALM_FUNC_VECT_BF16_ARR);
+    BENCH_CASE(ALM_FUNC_VECT_BF16_F32_ARR);
+#if defined(__AVX512__)
+    BENCH_CASE(ALM_FUNC_VECT_HP_32);
+    BENCH_CASE(ALM_FUNC_VECT_SP_16);
+    BENCH_CASE(ALM_FUNC_VECT_DP_8);
+#endif
+    default: return NULL;       /* complex, or 512-bit without __AVX512__ */
+    }
+#undef BENCH_CASE
+}
+
+static bool
+slot_is_512(int slot)
+{
+    return slot == ALM_FUNC_VECT_SP_16 || slot == ALM_FUNC_VECT_DP_8 ||
+           slot == ALM_FUNC_VECT_HP_32;
+}
+
+/* Bytes per input element and per result element */
+size_t
+slot_size(int slot, bool result)
+{
+    switch (slot) {
+    case ALM_FUNC_SCAL_DP: case ALM_FUNC_VECT_DP_2: case ALM_FUNC_VECT_DP_4:
+    case ALM_FUNC_VECT_DP_8: case ALM_FUNC_VECT_DP_ARR:
+        return sizeof(double);
+    case ALM_FUNC_SCAL_SP: case ALM_FUNC_VECT_SP_4: case ALM_FUNC_VECT_SP_8:
+    case ALM_FUNC_VECT_SP_16: case ALM_FUNC_VECT_SP_ARR:
+        return sizeof(float);
+    case ALM_FUNC_VECT_BF16_F32_ARR:
+        return result ? sizeof(float) : sizeof(int16_t);
+    default:
+        return sizeof(int16_t);
+    }
+}
+
+/*
+ * Input distributions. --dist picks how the regular values are spread
+ * over [lo, hi], --special the fraction of x replaced by values that
+ * usually leave the vector fast path, picked at random positions so
+ * that a vector of N lanes has one with probability 1 - (1 - p)^N.
+ */
+enum BenchDist {
+    DIST_UNIFORM,               /* uniform in [lo, hi] */
+    DIST_LOG,                   /* uniform exponent, down to 2^-30 of max|x| */
+    DIST_CLUSTER,               /* close to one of a few values */
+};
+
+static const char *dist_names[] = {"uniform", "log", "cluster"};
+
+enum BenchSpecial {
+    SPECIAL_NAN,
+    SPECIAL_INF,                /* +/-inf */
+    SPECIAL_HUGE,               /* +/- huge, slow sin/cos reduction, exp overflow */
+    SPECIAL_DENORMAL,           /* +/- subnormal */
+    SPECIAL_NEG,                /* -|x|, the domain error path of log, sqrt.. */
+    SPECIAL_ZERO,               /* +/-0 */
+    SPECIAL_MAX,
+};
+
+static const char *special_names[SPECIAL_MAX] = {
+    "nan", "inf", "huge", "denormal", "neg", "zero",
+};
+
+#define BENCH_CLUSTERS  4
+
+static double
+bench_regular(mt19937 &gen, BenchDist dist, double lo, double hi,
+              const double *centers)
+{
+    uniform_real_distribution<double> u(lo, hi);
+
+    switch (dist) {
+    case DIST_LOG: {
+        double top = fmax(fabs(lo), fabs(hi));
+        double bot = lo > 0 ? lo : hi < 0 ? -hi : top * 0x1p-30;
+        uniform_real_distribution<double> e(log2(bot), log2(top));
+
+        /* Random sign where the range allows it, else the range's own */
+        for (int tries = 0; tries < 8; tries++) {
+            double d = exp2(e(gen));
+
+            if (lo < 0 && (hi <= 0 || (gen() & 1)))
+                d = -d;
+            if (d >= lo && d <= hi)
+                return d;
+        }
+        return u(gen);
+    }
+    case DIST_CLUSTER: {
+        normal_distribution<double> near(0, (hi - lo) / 1000);
+        double d = centers[gen() % BENCH_CLUSTERS] + near(gen);
+
+        return fmin(fmax(d, lo), hi);
+    }
+    default:
+        return u(gen);
+    }
+}
+
+/* A special value of kind k, for elements of sz bytes */
+static double
+bench_special(mt19937 &gen, int k, size_t sz, double regular)
+{
+    double sign = (gen() & 1) ? -1.0 : 1.0;
+
+    switch (k) {
+    case SPECIAL_NAN:
+        return NAN;
+    case SPECIAL_INF:
+        return sign * INFINITY;
+    case SPECIAL_HUGE:
+        return sign * (sz == sizeof(double) ? 1e300 :
+                       sz == sizeof(float) ? 1e30 : 6e4);
+    case SPECIAL_DENORMAL:
+        return sign * (sz == sizeof(double) ? 1e-310 :
+                       sz == sizeof(float) ? 1e-40 : 1e-6);
+    case SPECIAL_NEG:
+        return regular == 0 ? -1.0 : -fabs(regular);
+    default:
+        return sign * 0.0;
+    }
+}
+
+/* Inputs as picked by --dist/--special, converted to the slot's element type */
+static void
+bench_fill(vector<char> &buf, int slot, int n, double lo, double hi,
+           unsigned seed, BenchDist dist, double special, unsigned kinds)
+{
+    mt19937 gen(seed);
+    uniform_real_distribution<double> coin(0, 1), c(lo, hi);
+    double centers[BENCH_CLUSTERS];
+    vector<int> ks;
+    bool bf16 = slot == ALM_FUNC_VECT_BF16_ARR ||
+                slot == ALM_FUNC_VECT_BF16_F32_ARR;
+    size_t sz = slot_size(slot, false);
+
+    for (int k = 0; k < SPECIAL_MAX; k++)
+        if (kinds & (1U << k))
+            ks.push_back(k);
+    for (double &ctr : centers)
+        ctr = c(gen);
+
+    buf.assign(n * sz, 0);
+
+    for (int i = 0; i < n; i++) {
+        double d = bench_regular(gen, dist, lo, hi, centers);
+
+        if (special > 0 && !ks.empty() && coin(gen) < special)
+            d = bench_special(gen, ks[gen() % ks.size()],
+                              bf16 ? sizeof(float) : sz, d);
+
+        float f = (float)d;
+        uint32_t u;
+        int16_t h;
+
+        switch (sz) {
+        case sizeof(double):
+            memcpy(&buf[i * sz], &d, sz);
+            break;
+        case sizeof(float):
+            memcpy(&buf[i * sz], &f, sz);
+            break;
+        default:
+            if (bf16) {
+                memcpy(&u, &f, sizeof(u));
+                h = (int16_t)(u >> 16);
+            } else {
+                h = (int16_t)_cvtss_sh(f, 0);
+            }
+            memcpy(&buf[i * sz], &h, sz);
+            break;
+        }
+    }
+}
+
+struct BenchOpts {
+    int             count = 1024;
+    double          min_time = 0.1;
+    int             uarch = -1;         /* highest row, -1 for the host's */
+    bool            list = false;
+    bool            has_range = false;
+    double          lo = 0, hi = 0;
+    set<string>     funcs;              /* empty for all */
+    bool            compare = false;
+    string          compare_out;
+    BenchDist       dist = DIST_UNIFORM;
+    vector<double>  special = {0};      /* fractions, one run each */
+    unsigned        kinds = (1U << SPECIAL_MAX) - 1;
+    vector<BenchLevel> levels;          /* --threads, empty for one thread */
+    bool            exhaustive = false;
+    int             jobs = 0;           /* --exhaustive threads, 0 for all */
+    vector<BenchCold> cold;             /* --cold, warm first, empty if not */
+    int             cold_iters = 1000;
+    bool            info = false;       /* --info, or run as alm-info */
+    bool            info_all = false;   /* --uarch=all */
+    bool            json = false;
+    bool            run = true;         /* --no-run: tables only */
+};
+
+/* Inputs and result buffer of c for --count elements */
+static void
+bench_bufs(const BenchCase &c, const BenchOpts &o, vector<char> &x,
+           vector<char> &y, vector<char> &r, BenchBufs &b)
+{
+    const BenchFunc *f = &c.func;
+    int n = (o.count + BENCH_MAX_LANES - 1) / BENCH_MAX_LANES * BENCH_MAX_LANES;
+    double lo = o.has_range ? o.lo : f->lo;
+    double hi = o.has_range ? o.hi : f->hi;
+
+    bench_fill(x, c.slot, n, lo, hi, 1, o.dist, c.special, o.kinds);
+    bench_fill(y, c.slot, n, f->lo2, f->hi2, 2, o.dist, 0, 0);
+    r.resize(n * slot_size(c.slot, true));
+
+    b.x = x.data();
+    b.y = y.data();
+    b.r = r.data();
+    b.n = n;
+    b.s = f->lo2;
+}
+
+/*
+ * --cold: every call is timed on its own, after the mode's eviction. The
+ * footprint is measured once, before, for the warm run (where it is
+ * reported) and for flush (which evicts just those lines).
+ */
+static void
+bench_cold(benchmark::State &st, const BenchCase &c, bench_kernel_t k,
+           const BenchBufs &b, const BenchCold &cm)
+{
+    vector<char> junk(cm.bytes, 1);     /* not 0, the zero page is shared */
+    vector<const char *> lines;
+    long bytes = -1;
+
+    if (cm.flush || cm.name == "warm")
+        bytes = bench_footprint(k, c.fn, b, lines);
+    if (cm.flush && bytes < 0) {
+        st.SkipWithError("cannot measure the table footprint");
+        return;
+    }
+
+    for (auto _ : st) {
+        if (cm.flush)
+            bench_flush(lines);
+        else if (cm.bytes)
+            bench_thrash(junk);
+
+        auto t0 = chrono::steady_clock::now();
+        k(c.fn, b);
+        benchmark::DoNotOptimize(b.r);
+        benchmark::ClobberMemory();
+        auto t1 = chrono::steady_clock::now();
+
+        st.SetIterationTime(chrono::duration<double>(t1 - t0).count());
+    }
+
+    if (bytes >= 0)
+        st.counters["table_bytes"] = (double)bytes;
+}
+
+/*
+ * With a --threads level every thread pins itself to its core before
+ * touching its buffers, so that they are local to it.
+ */
+static void
+bench_run(benchmark::State &st, BenchCase c, const BenchOpts &o,
+          const BenchLevel *lv, const BenchCold *cm)
+{
+    bench_kernel_t k = bench_kernel(c.func.sig, c.slot);
+    vector<char> x, y, r;
+    BenchBufs b;
+    BenchFreq freq;
+    int cpu = lv ? lv->cpus[st.thread_index] : -1;
+
+    if (lv && !bench_pin(cpu)) {
+        st.SkipWithError("cannot pin the thread");
+        return;
+    }
+
+    bench_bufs(c, o, x, y, r, b);
+
+    if (lv)
+        bench_freq_start(freq, cpu);
+
+    if (cm) {
+        bench_cold(st, c, k, b, *cm);
+    } else {
+        for (auto _ : st) {
+            k(c.fn, b);
+            benchmark::DoNotOptimize(b.r);
+            benchmark::ClobberMemory();
+        }
+    }
+
+    st.SetItemsProcessed(st.iterations() * b.n);
+
+    double ghz, tsc_ghz;
+    if (lv && bench_freq_stop(freq, cpu, &ghz, &tsc_ghz)) {
+        using benchmark::Counter;
+        st.counters["tsc_ghz"] = Counter(tsc_ghz, Counter::kAvgThreads);
+        if (ghz >= 0)
+            st.counters["ghz"] = Counter(ghz, Counter::kAvgThreads);
+    }
+    if (c.dispatched)
+        st.SetLabel("*");
+
+    /* Accuracy of the last iteration's results, not timed */
+    if (c.ref)
+        st.counters["max_ulp"] = bench_max_ulp(c, b);
+}
+
+/*
+ * One line per kernel, the time per element and the element rate, in
+ * fixed units so that runs can be compared with diff/sort. With
+ * --compare the AOCL, libm and libmvec lines of each variant are also
+ * collected for the summary printed by Finalize().
+ */
+class BenchReporter : public benchmark::BenchmarkReporter {
+  public:
+    BenchReporter(int host, const BenchOpts &o)
+        : host_(host), opts_(o),
+          sp_(o.special.size() > 1 || o.special[0] > 0),
+          scale_(!o.levels.empty()), cold_(!o.cold.empty()) {}
+
+    bool ReportContext(const Context &) override {
+        printf("# host uarch %s, * marks the kernel the library dispatches to\n",
+               uarch_names[host_]);
+        if (sp_)
+            printf("# %s inputs, special %% of x drawn from:%s\n",
+                   dist_names[opts_.dist], kinds().c_str());
+        if (scale_) {
+            printf("# Melem/s of all threads and per core, eff is the per core rate\n"
+                   "# over the first level's, GHz the effective clock (APERF/MPERF)\n");
+            printf("%-16s %-6s %-8s %-2s %s%-7s %7s %12s %12s %6s %7s %7s\n",
+                   "function", "var", "impl", "", sp_ ? "special " : "",
+                   "level", "threads", "Melem/s", "per core", "eff", "GHz",
+                   "tsc GHz");
+            return true;
+        }
+        if (cold_) {
+            printf("# ns per call of --count elements (a multiple of %d), after the\n"
+                   "# mode's eviction; table bytes is the library data one call\n"
+                   "# brings into the cache\n", BENCH_MAX_LANES);
+            printf("%-16s %-6s %-8s %-2s %s%-7s %12s %12s %12s\n", "function",
+                   "var", "impl", "", sp_ ? "special " : "", "mode", "ns/call",
+                   "ns/elem", "table bytes");
+            return true;
+        }
+        printf("%-16s %-6s %-8s %-2s %s%12s %12s %10s\n", "function", "var",
+               "impl", "", sp_ ? "special " : "", "ns/elem", "Melem/s",
+               "max ulp");
+        return true;
+    }
+
+    void ReportRuns(const vector<Run> &runs) override {
+        for (const Run &run : runs) {
+            string name = run.benchmark_name();
+            string parts[5];
+            size_t p = 0;
+
+            for (int i = 0; i < 5; i++) {
+                size_t q = name.find('/', p);
+                parts[i] = name.substr(p, q == string::npos ? q : q - p);
+                p = q == string::npos ? name.size() : q + 1;
+            }
+
+            if (run.error_occurred) {
+                printf("%-16s %-6s %-8s    error: %s\n", parts[0].c_str(),
+                       parts[1].c_str(), parts[2].c_str(),
+                       run.error_message.c_str());
+                continue;
+            }
+
+            auto it = run.counters.find("items_per_second");
+            double rate = it == run.counters.end() ? 0 : (double)it->second;
+            double ns = rate > 0 ? 1e9 / rate : 0.0;
+            auto u = run.counters.find("max_ulp");
+            double ulp = u == run.counters.end() ? -1 : (double)u->second;
+            char ulps[32] = "";
+
+            if (scale_) {
+                scale(run, parts, rate);
+                continue;
+            }
+            if (cold_) {
+                cold(run, parts, ns);
+                continue;
+            }
+
+            if (ulp >= 0)
+                snprintf(ulps, sizeof(ulps), "%10.2f", ulp);
+
+            printf("%-16s %-6s %-8s %-2s ", parts[0].c_str(),
+                   parts[1].c_str(), parts[2].c_str(),
+                   run.report_label.c_str());
+            if (sp_)
+                printf("%7s ", parts[3].c_str());
+            printf("%12.3f %12.1f %10s\n", ns, rate / 1e6, ulps);
+
+            if (run.run_type != Run::RT_Iteration)
+                continue;
+
+            if (opts_.special.size() > 1) {
+                string key = parts[0] + "/" + parts[1] + "/" + parts[2];
+
+                if (!sweep_.count(key))
+                    order_.push_back(key);
+                sweep_[key].push_back(ns);
+            }
+
+            if (opts_.compare) {
+                int k = parts[2] == "libm" ? 1 : parts[2] == "libmvec" ? 2 : 0;
+                string var = parts[1] + (sp_ ? "@" + parts[3] : "");
+                Cmp &c = cmp_[parts[0] + "/" + var];
+
+                c.func = parts[0];
+                c.var = var;
+                if (k == 0)
+                    c.uarch = parts[2];
+                c.ns[k] = ns;
+                c.ulp[k] = ulp;
+            }
+        }
+        fflush(stdout);
+    }
+
+    void Finalize() override {
+        if (opts_.special.size() > 1)
+            sweep();
+        if (cold_)
+            coldsum();
+        if (!opts_.compare)
+            return;
+
+        FILE *f = NULL;
+        bool csv = false;
+
+        if (!opts_.compare_out.empty()) {
+            const string &fn = opts_.compare_out;
+
+            csv = fn.size() > 4 && fn.compare(fn.size() - 4, 4, ".csv") == 0;
+            f = fopen(fn.c_str(), "w");
+            if (!f)
+                fprintf(stderr, "cannot write %s\n", fn.c_str());
+        }
+
+        printf("\n# speedup is glibc ns/elem over AOCL ns/elem\n");
+        printf("%-16s %-10s %-8s %9s %9s %9s %9s %9s\n", "function", "var",
+               "uarch", "x libm", "x libmvec", "ulp aocl", "ulp libm",
+               "ulp mvec");
+        if (f && csv)
+            fprintf(f, "function,variant,uarch,aocl_ns,libm_ns,libmvec_ns,"
+                       "speedup_libm,speedup_libmvec,aocl_max_ulp,"
+                       "libm_max_ulp,libmvec_max_ulp\n");
+        if (f && !csv)
+            fprintf(f, "{\n  \"comparison\": [");
+
+        bool first = true;
+        for (auto &e : cmp_) {
+            Cmp &c = e.second;
+            double x[2];
+
+            if (c.ns[1] < 0 && c.ns[2] < 0)
+                continue;               /* nothing in glibc, e.g. f16 */
+
+            for (int k = 0; k < 2; k++)
+                x[k] = c.ns[0] > 0 && c.ns[k + 1] > 0 ? c.ns[k + 1] / c.ns[0] : -1;
+
+            printf("%-16s %-10s %-8s", c.func.c_str(), c.var.c_str(),
+                   c.uarch.c_str());
+            for (double v : {x[0], x[1], c.ulp[0], c.ulp[1], c.ulp[2]}) {
+                if (v < 0)
+                    printf(" %9s", "-");
+                else
+                    printf(" %9.2f", v);
+            }
+            printf("\n");
+
+            if (!f)
+                continue;
+
+            if (csv) {
+                fprintf(f, "%s,%s,%s", c.func.c_str(), c.var.c_str(),
+                        c.uarch.c_str());
+                for (double v : {c.ns[0], c.ns[1], c.ns[2], x[0], x[1],
+                                 c.ulp[0], c.ulp[1], c.ulp[2]}) {
+                    if (v < 0)
+                        fprintf(f, ",");
+                    else
+                        fprintf(f, ",%g", v);
+                }
+                fprintf(f, "\n");
+            } else {
+                const char *keys[] = {"aocl_ns", "libm_ns", "libmvec_ns",
+                                      "speedup_libm", "speedup_libmvec",
+                                      "aocl_max_ulp", "libm_max_ulp",
+                                      "libmvec_max_ulp"};
+                double vals[] = {c.ns[0], c.ns[1], c.ns[2], x[0], x[1],
+                                 c.ulp[0], c.ulp[1], c.ulp[2]};
+
+                fprintf(f, "%s\n    {\"function\": \"%s\", \"variant\": \"%s\", "
+                           "\"uarch\": \"%s\"", first ? "" : ",",
+                        c.func.c_str(), c.var.c_str(), c.uarch.c_str());
+                for (int k = 0; k < 8; k++) {
+                    if (vals[k] < 0)
+                        fprintf(f, ", \"%s\": null", keys[k]);
+                    else
+                        fprintf(f, ", \"%s\": %g", keys[k], vals[k]);
+                }
+                fprintf(f, "}");
+            }
+            first = false;
+        }
+
+        if (f) {
+            if (!csv)
+                fprintf(f, "\n  ]\n}\n");
+            fclose(f);
+        }
+    }
+
+  private:
+    string kinds() const {
+        string k;
+
+        for (int i = 0; i < SPECIAL_MAX; i++)
+            if (opts_.kinds & (1U << i))
+                k += string(" ") + special_names[i];
+        return k;
+    }
+
+    /*
+     * Throughput against the special fraction, one line per kernel, and
+     * how much slower the largest fraction is than the first.
+     */
+    void sweep() {
+        char hdr[32];
+
+        printf("\n# ns/elem by fraction of special x\n%-28s", "kernel");
+        for (double p : opts_.special) {
+            snprintf(hdr, sizeof(hdr), "%g%%", p * 100);
+            printf(" %9s", hdr);
+        }
+        printf(" %9s\n", "slowdown");
+
+        for (const string &key : order_) {
+            const vector<double> &ns = sweep_[key];
+
+            printf("%-28s", key.c_str());
+            for (double v : ns)
+                printf(" %9.3f", v);
+            if (ns.size() > 1 && ns.front() > 0)
+                printf(" %8.2fx", ns.back() / ns.front());
+            printf("\n");
+        }
+    }
+
+    /* One --threads line, parts[] is function/var/impl[/special]/level */
+    void scale(const Run &run, const string *parts, double rate) {
+        string key = parts[0] + "/" + parts[1] + "/" + parts[2] +
+                     (sp_ ? "/" + parts[3] : "");
+        const string &level = parts[sp_ ? 4 : 3];
+        double core = rate / run.threads, eff = -1;
+        double clk[2] = {-1, -1};
+        const char *names[2] = {"ghz", "tsc_ghz"};
+
+        /* The first level run of a kernel is the base of its efficiency */
+        if (run.run_type == Run::RT_Iteration && !base_.count(key))
+            base_[key] = core;
+        if (base_.count(key) && base_[key] > 0)
+            eff = core / base_[key];
+
+        for (int i = 0; i < 2; i++) {
+            auto it = run.counters.find(names[i]);
+            if (it != run.counters.end())
+                clk[i] = it->second;
+        }
+
+        printf("%-16s %-6s %-8s %-2s ", parts[0].c_str(), parts[1].c_str(),
+               parts[2].c_str(), run.report_label.c_str());
+        if (sp_)
+            printf("%7s ", parts[3].c_str());
+        printf("%-7s %7d %12.1f %12.1f", level.c_str(), (int)run.threads,
+               rate / 1e6, core / 1e6);
+        for (double v : {eff, clk[0], clk[1]}) {
+            if (v < 0)
+                printf(" %7s", "-");
+            else
+                printf(" %7.2f", v);
+        }
+        printf("\n");
+    }
+
+    /* One --cold line, parts[] is function/var/impl[/special]/mode */
+    void cold(const Run &run, const string *parts, double ns) {
+        string key = parts[0] + "/" + parts[1] + "/" + parts[2] +
+                     (sp_ ? "/" + parts[3] : "");
+        const string &mode = parts[sp_ ? 4 : 3];
+        double call = run.iterations ?
+                      run.real_accumulated_time / (double)run.iterations * 1e9 : 0;
+        auto it = run.counters.find("table_bytes");
+        char bytes[32] = "-";
+
+        if (it != run.counters.end())
+            snprintf(bytes, sizeof(bytes), "%.0f", (double)it->second);
+
+        printf("%-16s %-6s %-8s %-2s ", parts[0].c_str(), parts[1].c_str(),
+               parts[2].c_str(), run.report_label.c_str());
+        if (sp_)
+            printf("%7s ", parts[3].c_str());
+        printf("%-7s %12.1f %12.3f %12s\n", mode.c_str(), call, ns, bytes);
+
+        if (run.run_type != Run::RT_Iteration)
+            return;
+
+        Cold &c = cold_runs_[key];
+        if (c.ns.empty())
+            order_.push_back(key);
+        c.ns[mode] = call;
+        if (it != run.counters.end() && c.bytes < 0)
+            c.bytes = (long)it->second;
+    }
+
+    /* ns/call per mode, how much slower than warm, and the table bytes */
+    void coldsum() {
+        printf("\n# ns/call by mode (x warm), table bytes one call touches\n%-28s",
+               "kernel");
+        for (const BenchCold &m : opts_.cold)
+            printf(" %17s", m.name.c_str());
+        printf(" %12s\n", "table bytes");
+
+        for (const string &key : order_) {
+            Cold &c = cold_runs_[key];
+            double warm = c.ns.count("warm") ? c.ns["warm"] : 0;
+            char cell[32];
+
+            printf("%-28s", key.c_str());
+            for (const BenchCold &m : opts_.cold) {
+                if (!c.ns.count(m.name))
+                    snprintf(cell, sizeof(cell), "-");
+                else if (m.name == "warm" || warm <= 0)
+                    snprintf(cell, sizeof(cell), "%.1f", c.ns[m.name]);
+                else
+                    snprintf(cell, sizeof(cell), "%.1f (%.1fx)", c.ns[m.name],
+                             c.ns[m.name] / warm);
+                printf(" %17s", cell);
+            }
+            if (c.bytes >= 0)
+                printf(" %12ld\n", c.bytes);
+            else
+                printf(" %12s\n", "-");
+        }
+    }
+
+    struct Cold {
+        map<string, double> ns;         /* per mode */
+        long bytes = -1;
+    };
+
+    /* Index 0 is AOCL, 1 libm, 2 libmvec; -1 where there is no result */
+    struct Cmp {
+        string func, var, uarch;
+        double ns[3] = {-1, -1, -1};
+        double ulp[3] = {-1, -1, -1};
+    };
+
+    int              host_;
+    const BenchOpts &opts_;
+    bool             sp_;               /* --special given */
+    bool             scale_;            /* --threads given */
+    bool             cold_;             /* --cold given */
+    map<string, Cold> cold_runs_;
+    map<string, double> base_;          /* per core rate of the first level */
+    map<string, Cmp> cmp_;
+    map<string, vector<double>> sweep_; /* ns/elem per fraction */
+    vector<string>   order_;            /* kernels of sweep_ or cold_runs_ */
+};
+
+/*
+ * Kernels of one function the host can run, best uarch first. A kernel
+ * that appears in several rows (the default row points at the zen4
+ * kernels for the 512-bit slots) is listed once, under its highest row.
+ */
+static void
+bench_cases(int entry, int top, int host, vector<pair<BenchCase, int>> &out)
+{
+    const struct alm_arch_funcs *t = alm_iface_funcs(entry);
+    const BenchFunc *f = bench_func(alm_iface_name(entry));
+
+    if (!t)
+        return;
+
+    for (int slot = 0; slot < ALM_FUNC_VAR_MAX; slot++) {
+        set<void *> seen;
+        void *resolved = NULL;
+
+        for (int row = host; row >= 0 && !resolved; row--)
+            resolved = t->funcs[row][slot];
+
+        for (int row = top; row >= 0; row--) {
+            void *fn = t->funcs[row][slot];
+
+            if (!fn || seen.count(fn))
+                continue;
+            seen.insert(fn);
+
+            BenchCase c = {*f, slot, slot, uarch_names[row], fn, NULL,
+                           fn == resolved, 0};
+            out.push_back({c, row});
+        }
+    }
+}
+
+static void
+bench_list(int top, int host)
+{
+    printf("# host uarch %s, rows up to %s\n", uarch_names[host],
+           uarch_names[top]);
+
+    for (int e = 1; e < C_AMD_LAST_ENTRY; e++) {
+        const char *name = alm_iface_name(e);
+        vector<pair<BenchCase, int>> cases;
+
+        if (!name)
+            continue;
+
+        const BenchFunc *f = bench_func(name);
+        if (f->sig == SIG_NONE) {
+            printf("%-16s skipped, %s\n", name, f->why);
+            continue;
+        }
+
+        bench_cases(e, top, host, cases);
+
+        /* One line per variant, with the rows that have a kernel for it */
+        for (size_t i = 0; i < cases.size(); i++) {
+            const BenchCase &c = cases[i].first;
+
+            if (i == 0 || cases[i - 1].first.slot != c.slot) {
+                printf("%s%-16s %-6s", i ? "\n" : "", name,
+                       slot_names[c.slot] ? slot_names[c.slot] : "cmplx");
+                if (!bench_kernel(f->sig, c.slot))
+                    printf(" (not benchmarked)");
+                else if (slot_is_512(c.slot) && top < ALM_UARCH_VER_ZEN4)
+                    printf(" (needs zen4)");
+            }
+            printf(" %s%s", uarch_names[cases[i].second],
+                   c.dispatched ? "*" : "");
+        }
+        if (!cases.empty())
+            printf("\n");
+    }
+}
+
+/*
+ * Max ULP (-1 without a glibc reference) and TSC cycles per element of a
+ * short run of c: the best of a few timings of a few calls, so that it
+ * takes milliseconds rather than --min-time.
+ */
+static void
+bench_quick(BenchCase c, const BenchOpts &o, double *ulp, double *cyc)
+{
+    bench_kernel_t k = bench_kernel(c.func.sig, c.slot);
+    size_t sz = slot_size(c.slot, false);
+    vector<char> x, y, r;
+    uint64_t best = UINT64_MAX;
+    BenchBufs b;
+
+    if ((c.func.sig == SIG_UNARY || c.func.sig == SIG_BINARY) &&
+        (sz == sizeof(float) || sz == sizeof(double)))
+        c.ref = bench_glibc_ref(c.func.name, c.slot);
+
+    bench_bufs(c, o, x, y, r, b);
+    k(c.fn, b);
+
+    for (int rep = 0; rep < 16; rep++) {
+        uint64_t t0 = __rdtsc();
+
+        for (int i = 0; i < 8; i++) {
+            k(c.fn, b);
+            benchmark::ClobberMemory();
+        }
+        best = min(best, (uint64_t)(__rdtsc() - t0));
+    }
+
+    *cyc = (double)best / 8 / b.n;
+    *ulp = c.ref ? bench_max_ulp(c, b) : -1;
+}
+
+/*
+ * --info, and alm-info: the kernel each function and variant resolves
+ * to on the host, the --uarch or every uarch, from the library's own
+ * report (amd_libm_dispatch_get()), with the max ULP and cycles/elem of
+ * a quick run of each kernel the host can execute.
+ */
+static int
+bench_info(const BenchOpts &o, int host)
+{
+    const char *uarch = o.info_all ? "all" :
+                        o.uarch < 0 ? NULL : uarch_names[o.uarch];
+    int n = amd_libm_dispatch_get(uarch, NULL, 0);
+    vector<amd_libm_kernel> ks(n > 0 ? n : 0);
+    map<const void *, pair<double, double>> done;
+    const char *sku = NULL;
+    bool first = true;
+
+    if (n < 0)
+        return 1;
+    amd_libm_dispatch_get(uarch, ks.data(), n);
+
+    if (o.run)
+        bench_glibc_open();
+
+    if (o.json)
+        printf("{\n  \"host\": \"%s\",\n  \"kernels\": [", uarch_names[host]);
+
+    for (const amd_libm_kernel &k : ks) {
+        const BenchFunc *f = bench_func(k.func);
+        double ulp = -1, cyc = -1;
+        int slot, row;
+
+        if (!o.funcs.empty() && !o.funcs.count(k.func))
+            continue;
+
+        for (slot = 0; slot < ALM_FUNC_VAR_MAX; slot++)
+            if (slot_names[slot] && strcmp(slot_names[slot], k.variant) == 0)
+                break;
+        for (row = 0; row < ALM_UARCH_MAX; row++)
+            if (strcmp(uarch_names[row], k.uarch) == 0)
+                break;
+
+        /* Only what the host can run, and has a caller here */
+        if (o.run && slot < ALM_FUNC_VAR_MAX && row <= host &&
+            f->sig != SIG_NONE && bench_kernel(f->sig, slot) &&
+            !(slot_is_512(slot) && host < ALM_UARCH_VER_ZEN4)) {
+            if (!done.count(k.addr)) {
+                BenchCase c = {*f, slot, slot, k.uarch, (void *)k.addr, NULL,
+                               false, 0};
+
+                bench_quick(c, o, &ulp, &cyc);
+                done[k.addr] = {ulp, cyc};
+            }
+            ulp = done[k.addr].first;
+            cyc = done[k.addr].second;
+        }
+
+        if (o.json) {
+            printf("%s\n    {\"sku\": \"%s\", \"function\": \"%s\", "
+                   "\"variant\": \"%s\", \"uarch\": \"%s\", \"symbol\": ",
+                   first ? "" : ",", k.sku, k.func, k.variant, k.uarch);
+            if (k.symbol)
+                printf("\"%s\"", k.symbol);
+            else
+                printf("null");
+            printf(", \"lanes\": %d, \"avx512\": %s", k.lanes,
+                   k.avx512 ? "true" : "false");
+            if (ulp >= 0)
+                printf(", \"max_ulp\": %g", ulp);
+            else
+                printf(", \"max_ulp\": null");
+            if (cyc >= 0)
+                printf(", \"cycles_per_elem\": %g}", cyc);
+            else
+                printf(", \"cycles_per_elem\": null}");
+            first = false;
+            continue;
+        }
+
+        if (!sku || strcmp(sku, k.sku) != 0) {
+            sku = k.sku;
+            printf("%s# %s (host %s): max ulp and TSC cycles/elem of %d elements,"
+                   " - if not run\n", first ? "" : "\n", sku, uarch_names[host],
+                   o.count);
+            printf("%-16s %-6s %-8s %5s %6s %-36s %8s %9s\n", "function", "var",
+                   "uarch", "lanes", "avx512", "symbol", "max ulp", "cyc/elem");
+            first = false;
+        }
+
+        printf("%-16s %-6s %-8s %5d %6s %-36s", k.func, k.variant, k.uarch,
+               k.lanes, k.avx512 ? "yes" : "no", k.symbol ? k.symbol : "?");
+        for (double v : {ulp, cyc}) {
+            if (v < 0)
+                printf(" %8s", "-");
+            else
+                printf(" %8.2f", v);
+        }
+        printf("\n");
+    }
+
+    if (o.json)
+        printf("\n  ]\n}\n");
+
+    return 0;
+}
+
+/*
+ * Registered as function/variant/impl, e.g. "exp/v4d/zen4", once per
+ * --special fraction with the fraction appended, "exp/v4d/zen4/10%",
+ * with --threads once per level, "exp/v4d/zen4/ccd", and with --cold
+ * once per mode, "exp/v4d/zen4/warm", for a fixed number of calls.
+ */
+static void
+bench_register(const BenchCase &c, const BenchOpts &o)
+{
+    for (double p : o.special) {
+        string id = string(c.func.name) + "/" + slot_names[c.var] + "/" + c.tag;
+        BenchCase pc = c;
+        char pct[32];
+
+        if (o.special.size() > 1 || p > 0) {
+            snprintf(pct, sizeof(pct), "/%g%%", p * 100);
+            id += pct;
+        }
+        pc.special = p;
+
+        for (const BenchCold &m : o.cold) {
+            const BenchCold *cm = &m;
+
+            benchmark::RegisterBenchmark((id + "/" + m.name).c_str(),
+                                         [pc, &o, cm](benchmark::State &st) {
+                                             bench_run(st, pc, o, NULL, cm);
+                                         })
+                ->Iterations(o.cold_iters)
+                ->UseManualTime();
+        }
+        if (!o.cold.empty())
+            continue;
+
+        if (o.levels.empty()) {
+            benchmark::RegisterBenchmark(id.c_str(),
+                                         [pc, &o](benchmark::State &st) {
+                                             bench_run(st, pc, o, NULL, NULL);
+                                         })->MinTime(o.min_time);
+            continue;
+        }
+
+        for (const BenchLevel &l : o.levels) {
+            const BenchLevel *lv = &l;
+
+            benchmark::RegisterBenchmark((id + "/" + l.name).c_str(),
+                                         [pc, &o, lv](benchmark::State &st) {
+                                             bench_run(st, pc, o, lv, NULL);
+                                         })
+                ->MinTime(o.min_time)
+                ->Threads((int)l.cpus.size())
+                ->UseRealTime();
+        }
+    }
+}
+
+static void
+bench_usage(const char *prog)
+{
+    printf("Usage: %s [options] [--benchmark_*]\n"
+           "  --func=f1,f2      only these functions (default all)\n"
+           "  --uarch=name      highest row to run, default the host's;\n"
+           "                    one of default base64 fma3 zen zen2 zen3 zen4 zen5,\n"
+           "                    or all with --info\n"
+           "  --count=n         elements per iteration (default 1024)\n"
+           "  --range=lo,hi     input range, overrides the per-function one\n"
+           "  --min-time=s      seconds per kernel (default 0.1)\n"
+           "  --list            print the kernels found and exit\n"
+           "  --dist=d          uniform (default), log (uniform exponent) or\n"
+           "                    cluster (close to a few values)\n"
+           "  --special=p,..    fractions of x made special, one run each,\n"
+           "                    e.g. 0,0.01,0.1,0.5\n"
+           "  --special-kinds=k,..  nan inf huge denormal neg zero (default all)\n"
+           "  --compare         run the dispatched kernels against glibc libm\n"
+           "                    and libmvec, with speedups and max ULP\n"
+           "  --compare-out=f   also write the comparison to f, CSV if f ends\n"
+           "                    in .csv, JSON otherwise\n"
+           "  --threads=l,..    run each kernel on pinned threads, one per core,\n"
+           "                    at each level: a core count, ccd (the cores\n"
+           "                    sharing the first one's L3), socket or all\n"
+           "  --exhaustive      instead of timing, check every float input of\n"
+           "                    the unary float kernels (within --range if\n"
+           "                    given): max ULP, error histogram, ns/elem by range\n"
+           "  --jobs=n          threads for --exhaustive (default all cpus)\n"
+           "  --cold=m,..       time single calls warm and after each eviction:\n"
+           "                    l1, l2, l3 (read a buffer over the cache), a\n"
+           "                    size (64K, 4M) or flush (clflush the lines the\n"
+           "                    kernel touches); also reports those bytes\n"
+           "  --cold-iters=n    calls per --cold mode (default 1000)\n"
+           "  --info            print the kernel each function and variant\n"
+           "                    resolves to (--uarch, or all), with its symbol,\n"
+           "                    lanes, AVX-512 use, max ULP and cycles/elem;\n"
+           "                    alm-info is the same as test_bench --info\n"
+           "  --json            --info output as JSON\n"
+           "  --no-run          --info without the max ULP and cycles/elem\n"
+           "Other --benchmark_* options are passed to google benchmark,\n"
+           "e.g. --benchmark_out=f.json for JSON output.\n", prog);
+}
+
+static vector<string>
+bench_split(const string &s)
+{
+    vector<string> out;
+    size_t p = 0, q;
+
+    while ((q = s.find(',', p)) != string::npos) {
+        out.push_back(s.substr(p, q - p));
+        p = q + 1;
+    }
+    out.push_back(s.substr(p));
+
+    return out;
+}
+
+static bool
+bench_opt(const char *arg, const char *name, const char **val)
+{
+    size_t len = strlen(name);
+
+    if (strncmp(arg, name, len) != 0 || arg[len] != '=')
+        return false;
+
+    *val = arg + len + 1;
+    return true;
+}
+
+int
+main(int argc, char **argv)
+{
+    BenchOpts o;
+    vector<char *> gargs = {argv[0]};
+    const char *v;
+    int host = (int)alm_iface_uarch();
+
+#if defined(BENCH_ALM_INFO)
+    o.info = true;                      /* alm-info */
+#endif
+
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+
+        if (bench_opt(a, "--func", &v)) {
+            for (const string &f : bench_split(v))
+                o.funcs.insert(f);
+        } else if (bench_opt(a, "--uarch", &v)) {
+            o.info_all = strcmp(v, "all") == 0;
+            for (int u = 0; u < ALM_UARCH_MAX; u++)
+                if (strcmp(v, uarch_names[u]) == 0)
+                    o.uarch = u;
+            if (o.uarch < 0 && !o.info_all) {
+                fprintf(stderr, "unknown uarch %s\n", v);
+                return 1;
+            }
+        } else if (bench_opt(a, "--count", &v)) {
+            o.count = atoi(v);
+        } else if (bench_opt(a, "--range", &v)) {
+            o.has_range = sscanf(v, "%lf,%lf", &o.lo, &o.hi) == 2;
+        } else if (bench_opt(a, "--min-time", &v)) {
+            o.min_time = atof(v);
+        } else if (bench_opt(a, "--dist", &v)) {
+            int d;
+            for (d = 0; d <= DIST_CLUSTER; d++)
+                if (strcmp(v, dist_names[d]) == 0)
+                    break;
+            if (d > DIST_CLUSTER) {
+                fprintf(stderr, "unknown distribution %s\n", v);
+                return 1;
+            }
+            o.dist = (BenchDist)d;
+        } else if (bench_opt(a, "--special", &v)) {
+            o.special.clear();
+            for (const string &p : bench_split(v)) {
+                double f = atof(p.c_str());
+                if (f < 0 || f > 1) {
+                    fprintf(stderr, "--special fractions are in [0, 1]\n");
+                    return 1;
+                }
+                o.special.push_back(f);
+            }
+        } else if (bench_opt(a, "--special-kinds", &v)) {
+            o.kinds = 0;
+            for (const string &k : bench_split(v)) {
+                int i;
+                for (i = 0; i < SPECIAL_MAX; i++)
+                    if (k == special_names[i])
+                        break;
+                if (i == SPECIAL_MAX) {
+                    fprintf(stderr, "unknown special kind %s\n", k.c_str());
+                    return 1;
+                }
+                o.kinds |= 1U << i;
+            }
+        } else if (bench_opt(a, "--compare-out", &v)) {
+            o.compare = true;
+            o.compare_out = v;
+        } else if (bench_opt(a, "--threads", &v)) {
+            if (!bench_scale_levels(bench_split(v), o.levels))
+                return 1;
+        } else if (bench_opt(a, "--cold", &v)) {
+            o.cold.clear();
+            if (!bench_cold_modes(bench_split(v), o.cold))
+                return 1;
+        } else if (bench_opt(a, "--cold-iters", &v)) {
+            o.cold_iters = atoi(v);
+        } else if (bench_opt(a, "--jobs", &v)) {
+            o.jobs = atoi(v);
+        } else if (strcmp(a, "--exhaustive") == 0) {
+            o.exhaustive = true;
+        } else if (strcmp(a, "--compare") == 0) {
+            o.compare = true;
+        } else if (strcmp(a, "--list") == 0) {
+            o.list = true;
+        } else if (strcmp(a, "--info") == 0) {
+            o.info = true;
+        } else if (strcmp(a, "--json") == 0) {
+            o.json = true;
+        } else if (strcmp(a, "--no-run") == 0) {
+            o.run = false;
+        } else if (strncmp(a, "--benchmark_", 12) == 0) {
+            gargs.push_back(argv[i]);
+        } else {
+            bench_usage(argv[0]);
+            return strcmp(a, "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    if (o.count <= 0) {
+        fprintf(stderr, "--count must be positive\n");
+        return 1;
+    }
+
+    if (!o.levels.empty() && (o.compare || o.special.size() > 1)) {
+        fprintf(stderr, "--threads does not go with --compare or a --special sweep\n");
+        return 1;
+    }
+
+    if (!o.cold.empty() &&
+        (!o.levels.empty() || o.compare || o.special.size() > 1)) {
+        fprintf(stderr, "--cold does not go with --threads, --compare or a --special sweep\n");
+        return 1;
+    }
+
+    if (o.cold_iters <= 0) {
+        fprintf(stderr, "--cold-iters must be positive\n");
+        return 1;
+    }
+
+    if (o.info)
+        return bench_info(o, host);
+
+    if (o.info_all) {
+        fprintf(stderr, "--uarch=all is for --info\n");
+        return 1;
+    }
+
+    int top = o.uarch < 0 ? host : o.uarch;
+
+    if (o.list) {
+        bench_list(top, host);
+        return 0;
+    }
+
+    if (o.exhaustive) {
+        if (o.jobs <= 0)
+            o.jobs = (int)std::thread::hardware_concurrency();
+        if (o.jobs <= 0)
+            o.jobs = 1;
+
+        /* The glibc double functions are the fast reference, if there */
+        bench_glibc_open();
+
+        for (int e = 1; e < C_AMD_LAST_ENTRY; e++) {
+            const char *name = alm_iface_name(e);
+            vector<pair<BenchCase, int>> cases;
+            vector<BenchCase> fc;
+
+            if (!name || (!o.funcs.empty() && !o.funcs.count(name)))
+                continue;
+            if (bench_func(name)->sig != SIG_UNARY)
+                continue;
+
+            bench_cases(e, top, host, cases);
+            for (auto &c : cases) {
+                int slot = c.first.slot;
+
+                if (slot_size(slot, false) == sizeof(float) &&
+                    slot_size(slot, true) == sizeof(float) &&
+                    bench_kernel(SIG_UNARY, slot) &&
+                    !(slot_is_512(slot) && top < ALM_UARCH_VER_ZEN4))
+                    fc.push_back(c.first);
+            }
+
+            if (!fc.empty())
+                bench_exhaustive(name, fc, o.jobs, o.has_range, o.lo, o.hi);
+        }
+        return 0;
+    }
+
+    if (o.compare && !bench_glibc_open()) {
+        fprintf(stderr, "--compare needs glibc libm\n");
+        return 1;
+    }
+
+    for (int e = 1; e < C_AMD_LAST_ENTRY; e++) {
+        const char *name = alm_iface_name(e);
+        vector<pair<BenchCase, int>> cases;
+
+        if (!name || (!o.funcs.empty() && !o.funcs.count(name)))
+            continue;
+        if (bench_func(name)->sig == SIG_NONE)
+            continue;
+
+        bench_cases(e, top, host, cases);
+
+        for (auto &c : cases) {
+            BenchCase bc = c.first;
+
+            /* The 512-bit kernels need zen4 or later, whatever the row */
+            if (!bench_kernel(bc.func.sig, bc.slot) ||
+                (slot_is_512(bc.slot) && top < ALM_UARCH_VER_ZEN4))
+                continue;
+
+            if (!o.compare) {
+                bench_register(bc, o);
+                continue;
+            }
+
+            /*
+             * Only what the library runs is compared, on the same inputs
+             * through libm (one call per element) and the libmvec
+             * function of the same width, or the widest for arrays.
+             */
+            if (!bc.dispatched)
+                continue;
+
+            BenchSig sig = bc.func.sig;
+            size_t sz = slot_size(bc.slot, false);
+            bool cmp = (sig == SIG_UNARY || sig == SIG_BINARY) &&
+                       (sz == sizeof(float) || sz == sizeof(double));
+
+            if (cmp)
+                bc.ref = bench_glibc_ref(name, bc.slot);
+            bench_register(bc, o);
+            if (!cmp)
+                continue;
+
+            BenchCase g = bc;
+            int scal = sz == sizeof(float) ? ALM_FUNC_SCAL_SP : ALM_FUNC_SCAL_DP;
+
+            g.dispatched = false;
+            g.fn = bench_glibc_libm(name, scal);
+            if (g.fn) {
+                g.slot = scal;
+                g.tag = "libm";
+                bench_register(g, o);
+            }
+
+            g.fn = bench_glibc_libmvec(name, bc.slot, sig == SIG_BINARY,
+                                       top >= ALM_UARCH_VER_ZEN4, &g.slot);
+            if (g.fn && bench_kernel(sig, g.slot)) {
+                g.tag = "libmvec";
+                bench_register(g, o);
+            }
+        }
+    }
+
+    int gargc = (int)gargs.size();
+    gargs.push_back(NULL);
+    benchmark::Initialize(&gargc, gargs.data());
+    if (benchmark::ReportUnrecognizedArguments(gargc, gargs.data()))
+        return 1;
+
+    BenchReporter rep(host, o);
+    benchmark::RunSpecifiedBenchmarks(&rep);
+
+    return 0;
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2008-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * --threads: the cores a kernel is run on at each scaling level, thread
+ * pinning and the effective clock of a pinned thread.
+ *
+ * The topology comes from sysfs. Only the first hardware thread of each
+ * core is used, cores are ordered by socket then L3 (the CCD on zen, or
+ * the CCX before zen3), so "ccd" and "socket" are the cores sharing the
+ * L3 and the package of the first one.
+ *
+ * The effective GHz of a thread is the TSC rate scaled by the APERF/MPERF
+ * delta of its core, read through /dev/cpu/N/msr (root and the msr module),
+ * and is left out where that is not readable.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+
+#include "bench.h"
+
+using namespace std;
+
+#if defined(_WIN64) || defined(_WIN32)
+
+bool
+bench_scale_levels(const vector<string> &spec, vector<BenchLevel> &out)
+{
+    fprintf(stderr, "--threads is only supported on Linux\n");
+    return false;
+}
+
+bool bench_pin(int cpu) { return false; }
+void bench_freq_start(BenchFreq &f, int cpu) { f.msr = false; }
+bool bench_freq_stop(const BenchFreq &f, int cpu, double *ghz, double *tsc_ghz)
+{
+    return false;
+}
+
+#else
+
+#include <sched.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <x86intrin.h>
+
+#define MSR_MPERF   0xe7
+#define MSR_APERF   0xe8
+
+struct BenchCore {
+    int cpu;
+    int package;
+    int l3;
+};
+
+static bool
+read_line(const string &path, string &line)
+{
+    FILE *f = fopen(path.c_str(), "r");
+    char buf[4096];
+
+    if (!f)
+        return false;
+
+    bool ok = fgets(buf, sizeof(buf), f) != NULL;
+    fclose(f);
+    if (ok) {
+        line = buf;
+        while (!line.empty() && (line.back() == '\n' || line.back() == ' '))
+            line.pop_back();
+    }
+
+    return ok;
+}
+
+/* sysfs cpu list, "0-3,8,10-11" */
+static vector<int>
+parse_cpu_list(const string &s)
+{
+    vector<int> cpus;
+    size_t p = 0;
+
+    while (p < s.size()) {
+        size_t q = s.find(',', p);
+        string r = s.substr(p, q == string::npos ? q : q - p);
+        int a, b;
+
+        if (sscanf(r.c_str(), "%d-%d", &a, &b) == 2) {
+            for (int c = a; c <= b; c++)
+                cpus.push_back(c);
+        } else if (sscanf(r.c_str(), "%d", &a) == 1) {
+            cpus.push_back(a);
+        }
+        p = q == string::npos ? s.size() : q + 1;
+    }
+
+    return cpus;
+}
+
+static vector<BenchCore>
+bench_cores(void)
+{
+    const string sys = "/sys/devices/system/cpu/";
+    vector<BenchCore> cores;
+    cpu_set_t set;
+    string line;
+
+    if (!read_line(sys + "online", line) ||
+        sched_getaffinity(0, sizeof(set), &set) != 0)
+        return cores;
+
+    for (int cpu : parse_cpu_list(line)) {
+        string dir = sys + "cpu" + to_string(cpu) + "/";
+        BenchCore c = {cpu, 0, 0};
+        vector<int> smt;
+
+        if (!CPU_ISSET(cpu, &set))
+            continue;
+        if (read_line(dir + "topology/thread_siblings_list", line)) {
+            smt = parse_cpu_list(line);
+            if (!smt.empty() && smt[0] != cpu)
+                continue;               /* not the first thread of its core */
+        }
+        if (read_line(dir + "topology/physical_package_id", line))
+            c.package = atoi(line.c_str());
+        /* The L3 id is recent, the first cpu sharing it does as well */
+        if (read_line(dir + "cache/index3/id", line))
+            c.l3 = atoi(line.c_str());
+        else if (read_line(dir + "cache/index3/shared_cpu_list", line))
+            c.l3 = parse_cpu_list(line).front();
+
+        cores.push_back(c);
+    }
+
+    stable_sort(cores.begin(), cores.end(),
+                [](const BenchCore &a, const BenchCore &b) {
+                    return a.package != b.package ? a.package < b.package :
+                           a.l3 < b.l3;
+                });
+
+    return cores;
+}
+
+bool
+bench_scale_levels(const vector<string> &spec, vector<BenchLevel> &out)
+{
+    vector<BenchCore> cores = bench_cores();
+
+    if (cores.empty()) {
+        fprintf(stderr, "cannot read the cpu topology from sysfs\n");
+        return false;
+    }
+
+    for (const string &s : spec) {
+        int want = isdigit((unsigned char)s[0]) ? atoi(s.c_str()) : 0;
+        BenchLevel l = {s, {}};
+
+        for (const BenchCore &c : cores) {
+            bool in = s == "all" ||
+                      (s == "socket" && c.package == cores[0].package) ||
+                      (s == "ccd" && c.package == cores[0].package &&
+                       c.l3 == cores[0].l3);
+
+            if (want ? (int)l.cpus.size() < want : in)
+                l.cpus.push_back(c.cpu);
+        }
+
+        if (l.cpus.empty() || (want && (int)l.cpus.size() != want)) {
+            fprintf(stderr, "--threads: %s is not 1..%zu, ccd, socket or all\n",
+                    s.c_str(), cores.size());
+            return false;
+        }
+        out.push_back(l);
+    }
+
+    return true;
+}
+
+bool
+bench_pin(int cpu)
+{
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+static bool
+read_msr(int cpu, uint32_t msr, uint64_t *val)
+{
+    char path[64];
+    int fd;
+
+    snprintf(path, sizeof(path), "/dev/cpu/%d/msr", cpu);
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return false;
+
+    bool ok = pread(fd, val, sizeof(*val), msr) == sizeof(*val);
+    close(fd);
+
+    return ok;
+}
+
+static double
+now(void)
+{
+    return chrono::duration<double>(
+        chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void
+bench_freq_start(BenchFreq &f, int cpu)
+{
+    f.msr = read_msr(cpu, MSR_APERF, &f.aperf) &&
+            read_msr(cpu, MSR_MPERF, &f.mperf);
+    f.secs = now();
+    f.tsc = __rdtsc();
+}
+
+bool
+bench_freq_stop(const BenchFreq &f, int cpu, double *ghz, double *tsc_ghz)
+{
+    uint64_t tsc = __rdtsc(), aperf, mperf;
+    double secs = now() - f.secs;
+
+    if (secs <= 0)
+        return false;
+
+    *tsc_ghz = (double)(tsc - f.tsc) / secs / 1e9;
+    *ghz = -1;
+
+    if (f.msr && read_msr(cpu, MSR_APERF, &aperf) &&
+        read_msr(cpu, MSR_MPERF, &mperf) && mperf != f.mperf)
+        *ghz = *tsc_ghz * (double)(aperf - f.aperf) / (double)(mperf - f.mperf);
+
+    return true;
+}
+
+#endif
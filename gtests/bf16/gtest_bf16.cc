@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/*
+ * Exhaustive check of the bfloat16 array kernels.
+ *
+ * Every bfloat16 input goes through the bf16 and bf16_f32 array kernels
+ * of each uarch row the host can run, in calls of 1 to 37 elements for
+ * the tails. The references are the double precision functions.
+ *
+ * - A bf16 result passes when it is the correctly rounded bfloat16 or one
+ *   of its two neighbours (the kernels round a float result once more),
+ *   zeros must carry the right sign, a NaN matches any NaN and nothing
+ *   else.
+ * - A bf16_f32 result must be within the float ULP bound of the function.
+ * - Where a row has both kernels, the bf16 result must be the bf16_f32
+ *   result rounded to nearest even, bit for bit: ties go to even,
+ *   denormals are kept and a NaN comes back quiet with its sign. The
+ *   counts of ties, denormal and NaN results seen are printed.
+ */
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "gtest.h"
+#include <external/amdlibm.h>
+#include <libm/iface.h>
+
+typedef double (*ref1_t)(double);
+typedef void (*bf16_arr_t)(int, bf16_t *, bf16_t *);
+typedef void (*bf16_f32_arr_t)(int, bf16_t *, float *);
+
+static const char *uarch_names[ALM_UARCH_MAX] = {
+    "default", "base64", "fma3", "zen", "zen2", "zen3", "zen4", "zen5",
+};
+
+static float BF16ToFloat(uint16_t h) {
+  uint32_t u = (uint32_t)h << 16;
+  float f;
+  memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+static uint32_t FloatBits(float f) {
+  uint32_t u;
+  memcpy(&u, &f, sizeof(u));
+  return u;
+}
+
+/* Round to nearest even, the scaled significands are exact in double */
+static uint16_t DoubleToBF16(double d) {
+  uint16_t s = std::signbit(d) ? 0x8000 : 0;
+  double a = fabs(d);
+  int e;
+
+  if (std::isnan(d))
+    return s | 0x7fc0;
+  if (a < 0x1p-126)                     /* subnormal, 128 is the smallest normal */
+    return s | (uint16_t)nearbyint(a * 0x1p133);
+  if (a >= 0x1.ffp127)                  /* halfway from the largest to 2^128 */
+    return s | 0x7f80;
+
+  frexp(a, &e);                         /* a in [2^(e-1), 2^e) */
+  uint32_t m = (uint32_t)nearbyint(ldexp(a, 8 - e));
+  if (m == 256) {
+    m = 128;
+    e++;
+  }
+  return s | (uint16_t)(((e + 126) << 7) | (m - 128));
+}
+
+/* What the kernels do to their float results, see cvt_v8_f32_to_bf16() */
+static uint16_t FloatToBF16(float f) {
+  uint32_t u = FloatBits(f);
+
+  if ((u & 0x7fffffff) > 0x7f800000)
+    return (uint16_t)((u >> 16) | 0x40);
+  return (uint16_t)((u + 0x7fff + ((u >> 16) & 1)) >> 16);
+}
+
+/*
+ * Distance in units in the last place from the expected e to the actual
+ * a, both sign-magnitude patterns of 'bits' bits, -1 for a class mismatch
+ */
+static int64_t Distance(uint32_t e, uint32_t a, int bits) {
+  uint32_t sign = 1u << (bits - 1), inf = (bits == 16) ? 0x7f80 : 0x7f800000;
+  bool ne = (e & (sign - 1)) > inf, na = (a & (sign - 1)) > inf;
+
+  if (ne || na)
+    return (ne && na) ? 0 : -1;
+  if (e != a && (e & (sign - 1)) == 0 && (a & (sign - 1)) == 0)
+    return -1;                          /* zero of the wrong sign */
+  int64_t oe = (e & sign) ? -(int64_t)(e & (sign - 1)) : (int64_t)e;
+  int64_t oa = (a & sign) ? -(int64_t)(a & (sign - 1)) : (int64_t)a;
+  return oe > oa ? oe - oa : oa - oe;
+}
+
+template <typename R, typename T>
+static void RunArr(void (*fn)(int, bf16_t *, R *), std::vector<uint16_t> &x,
+                   std::vector<T> &r) {
+  size_t n = x.size();
+  for (size_t i = 0, len = 1; i < n; i += len, len = len % 37 + 1) {
+    int k = (int)(n - i < len ? n - i : len);
+    fn(k, (bf16_t *)x.data() + i, (R *)r.data() + i);
+  }
+}
+
+/* Reports up to 4 failing inputs, returns the number of them */
+static size_t Report(const char *what, size_t nfail, uint16_t x, uint32_t e,
+                     uint32_t a) {
+  if (nfail < 4)
+    ADD_FAILURE() << what << ": input 0x" << std::hex << x << " expected 0x"
+                  << e << " actual 0x" << a;
+  return nfail + 1;
+}
+
+/*
+ * Checks every bfloat16 kernel of func the host can run against ref over
+ * all bfloat16 inputs, f32_maxulp is the bound of the bf16_f32 kernels
+ * (0 for functions that have none)
+ */
+static void CheckBF16(const char *func, ref1_t ref, int f32_maxulp) {
+  int host = (int)alm_iface_uarch();
+  const struct alm_arch_funcs *t = NULL;
+  std::vector<uint16_t> x(0x10000), exp16(0x10000), r16(0x10000);
+  std::vector<uint32_t> exp32(0x10000);
+  std::vector<float> r32(0x10000);
+  std::vector<std::pair<void *, void *>> seen;
+  int nkernels = 0;
+
+  for (int e = 1; e < C_AMD_LAST_ENTRY && !t; e++)
+    if (alm_iface_name(e) && !strcmp(alm_iface_name(e), func))
+      t = alm_iface_funcs(e);
+  ASSERT_TRUE(t != NULL) << func << " is not in the dispatch tables";
+
+  for (size_t i = 0; i < x.size(); i++) {
+    double d = ref(BF16ToFloat((uint16_t)i));
+    x[i] = (uint16_t)i;
+    exp16[i] = DoubleToBF16(d);
+    exp32[i] = FloatBits((float)d);
+  }
+
+  for (int row = host; row >= 0; row--) {
+    void *f16 = t->funcs[row][ALM_FUNC_VECT_BF16_ARR];
+    void *f32 = t->funcs[row][ALM_FUNC_VECT_BF16_F32_ARR];
+    std::pair<void *, void *> k(f16, f32);
+    std::string name = std::string(func) + "/" + uarch_names[row];
+    size_t nfail = 0, noff = 0, nties = 0, ndenorm = 0, nnan = 0;
+    int64_t maxulp = 0;
+
+    if ((!f16 && !f32) || std::find(seen.begin(), seen.end(), k) != seen.end())
+      continue;
+    seen.push_back(k);
+    nkernels++;
+
+    if (f16) {
+      RunArr(reinterpret_cast<bf16_arr_t>(f16), x, r16);
+      for (size_t i = 0; i < x.size(); i++) {
+        int64_t d = Distance(exp16[i], r16[i], 16);
+        if (d == 1)
+          noff++;
+        else if (d != 0)
+          nfail = Report((name + "/vab").c_str(), nfail, x[i], exp16[i], r16[i]);
+      }
+      printf("%s/vab: %zu of %zu results one bf16 ulp off\n", name.c_str(),
+             noff, x.size());
+    }
+
+    if (f32) {
+      RunArr(reinterpret_cast<bf16_f32_arr_t>(f32), x, r32);
+      for (size_t i = 0; i < x.size(); i++) {
+        int64_t d = Distance(exp32[i], FloatBits(r32[i]), 32);
+        maxulp = std::max(maxulp, d);
+        if (d < 0 || d > f32_maxulp)
+          nfail = Report((name + "/vabs").c_str(), nfail, x[i], exp32[i],
+                         FloatBits(r32[i]));
+      }
+      printf("%s/vabs: max %lld float ulp\n", name.c_str(), (long long)maxulp);
+    }
+
+    if (f16 && f32) {
+      for (size_t i = 0; i < x.size(); i++) {
+        uint32_t u = FloatBits(r32[i]);
+        uint16_t e = FloatToBF16(r32[i]);
+
+        nties += (u & 0xffff) == 0x8000;
+        ndenorm += (e & 0x7f80) == 0 && (e & 0x7f) != 0;
+        nnan += (e & 0x7fff) > 0x7f80;
+        if (r16[i] != e)
+          nfail = Report((name + "/vab against vabs").c_str(), nfail, x[i], e,
+                         r16[i]);
+      }
+      printf("%s: rounding checked over %zu ties, %zu denormals, %zu NaNs\n",
+             name.c_str(), nties, ndenorm, nnan);
+    }
+    EXPECT_EQ(nfail, 0u) << name << " failed";
+  }
+  EXPECT_GT(nkernels, 0) << func << " has no bfloat16 kernel";
+}
+
+static double Sigmoid(double v) { return 1.0 / (1.0 + exp(-v)); }
+
+/* bf16_f32 bounds are the ones of the vrs8/vrs16 float kernels */
+TEST(BF16, EXHAUSTIVE_EXP)     { CheckBF16("exp", [](double v) { return exp(v); }, 4); }
+TEST(BF16, EXHAUSTIVE_LOG)     { CheckBF16("log", [](double v) { return log(v); }, 4); }
+TEST(BF16, EXHAUSTIVE_TANH)    { CheckBF16("tanh", [](double v) { return tanh(v); }, 4); }
+TEST(BF16, EXHAUSTIVE_ERF)     { CheckBF16("erf", [](double v) { return erf(v); }, 4); }
+TEST(BF16, EXHAUSTIVE_SIGMOID) { CheckBF16("sigmoid", Sigmoid, 4); }
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
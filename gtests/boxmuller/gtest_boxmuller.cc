@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/*
+ * The Box-Muller array kernels, vrda_boxmuller and vrsa_boxmullerf, of
+ * each uarch row the host can run.
+ *
+ * - Every element of lengths 0 to 33 and 1000 to 1016 (all the tails)
+ *   against a long double reference, the error in units of
+ *   max(r, 1) * eps where r = sqrt(-2 log(u1)), as cos and sin near
+ *   their zeros have no relative error bound. The element past the end must not be written,
+ *   and the masked tail lanes must not raise FE_DIVBYZERO.
+ * - u1 = 1 gives zeros, u1 = 0 infinities.
+ * - The mean, variance, skewness, kurtosis and the correlation of z0 and
+ *   z1 over 1 << 20 pairs are those of independent standard normals, to
+ *   five standard errors.
+ */
+
+#include <cfenv>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "gtest.h"
+#include <external/amdlibm.h>
+#include <libm/iface.h>
+
+static const char *uarch_names[ALM_UARCH_MAX] = {
+    "default", "base64", "fma3", "zen", "zen2", "zen3", "zen4", "zen5",
+};
+
+/* Stated max error of z0 and z1 in units of max(r, 1) * eps */
+static const double boxmuller_err = 4.0;
+
+template <typename T> struct BoxMuller;
+
+template <> struct BoxMuller<double> {
+  static const int slot = ALM_FUNC_VECT_DP_ARR;
+};
+
+template <> struct BoxMuller<float> {
+  static const int slot = ALM_FUNC_VECT_SP_ARR;
+};
+
+static const struct alm_arch_funcs *Funcs(const char *func) {
+  for (int e = 1; e < C_AMD_LAST_ENTRY; e++)
+    if (alm_iface_name(e) && !strcmp(alm_iface_name(e), func))
+      return alm_iface_funcs(e);
+  return NULL;
+}
+
+/* u1 in (0, 1], u2 in [0, 1) */
+template <typename T>
+static void Uniforms(int n, unsigned seed, std::vector<T> &u1, std::vector<T> &u2) {
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<T> dist(T(0), T(1));
+  u1.resize(n);
+  u2.resize(n);
+  for (int i = 0; i < n; i++) {
+    u1[i] = T(1) - dist(gen);
+    u2[i] = dist(gen);
+  }
+}
+
+template <typename T>
+static void CheckTails(const char *name, void (*fn)(int, T *, T *, T *, T *)) {
+  const T eps = std::numeric_limits<T>::epsilon();
+  std::vector<int> lengths;
+  for (int n = 0; n <= 33; n++)
+    lengths.push_back(n);
+  for (int n = 1000; n <= 1016; n++)
+    lengths.push_back(n);
+
+  double worst = 0;
+  for (int n : lengths) {
+    std::vector<T> u1, u2, z0(n + 1, T(-7)), z1(n + 1, T(-7));
+    Uniforms<T>(n, n, u1, u2);
+
+    std::feclearexcept(FE_ALL_EXCEPT);
+    fn(n, u1.data(), u2.data(), z0.data(), z1.data());
+    EXPECT_FALSE(std::fetestexcept(FE_DIVBYZERO)) << name << " n=" << n
+                                                  << " raised FE_DIVBYZERO";
+    EXPECT_TRUE(z0[n] == T(-7) && z1[n] == T(-7)) << name << " wrote past n=" << n;
+
+    int nfail = 0;
+    for (int i = 0; i < n; i++) {
+      long double r = sqrtl(-2 * logl(u1[i]));
+      long double a = 2 * 3.141592653589793238462643383279502884L * u2[i];
+      long double e0 = r * cosl(a), e1 = r * sinl(a);
+      double err = (double)(std::max(fabsl(z0[i] - e0), fabsl(z1[i] - e1)) /
+                            (std::max(r, 1.0L) * eps));
+      worst = std::max(worst, err);
+      if (!(err <= boxmuller_err) && nfail++ < 4)
+        ADD_FAILURE() << name << " n=" << n << " i=" << i << std::hexfloat << " u1 "
+                      << u1[i] << " u2 " << u2[i] << " expected " << (T)e0 << ", "
+                      << (T)e1 << " actual " << z0[i] << ", " << z1[i];
+    }
+  }
+  printf("%s: max error %.3f max(r, 1) * eps\n", name, worst);
+}
+
+template <typename T>
+static void CheckSpecial(const char *name, void (*fn)(int, T *, T *, T *, T *)) {
+  for (int n : {1, 5, 8, 13, 16, 19}) {
+    std::vector<T> u1(n, T(1)), u2(n), z0(n), z1(n);
+    for (int i = 0; i < n; i++)
+      u2[i] = T(i) / T(n);
+    fn(n, u1.data(), u2.data(), z0.data(), z1.data());
+    for (int i = 0; i < n; i++)
+      EXPECT_TRUE(z0[i] == 0 && z1[i] == 0) << name << " u1 = 1, u2 = " << u2[i]
+                                            << ": " << z0[i] << ", " << z1[i];
+
+    /* u2 away from the zeros of cos and sin, both are infinite */
+    std::fill(u1.begin(), u1.end(), T(0));
+    std::fill(u2.begin(), u2.end(), T(0.1));
+    fn(n, u1.data(), u2.data(), z0.data(), z1.data());
+    for (int i = 0; i < n; i++)
+      EXPECT_TRUE(std::isinf(z0[i]) && std::isinf(z1[i]))
+          << name << " u1 = 0: " << z0[i] << ", " << z1[i];
+  }
+}
+
+template <typename T>
+static void CheckMoments(const char *name, void (*fn)(int, T *, T *, T *, T *)) {
+  const int n = 1 << 20;
+  std::vector<T> u1, u2, z0(n), z1(n);
+  Uniforms<T>(n, 12345, u1, u2);
+  fn(n, u1.data(), u2.data(), z0.data(), z1.data());
+
+  for (const std::vector<T> *z : {&z0, &z1}) {
+    double m1 = 0, m2 = 0, m3 = 0, m4 = 0;
+    for (T v : *z)
+      m1 += v;
+    m1 /= n;
+    for (T v : *z) {
+      double d = v - m1;
+      m2 += d * d;
+      m3 += d * d * d;
+      m4 += d * d * d * d;
+    }
+    m2 /= n;
+    m3 /= n;
+    m4 /= n;
+    const char *which = (z == &z0) ? "z0" : "z1";
+    /* standard errors of the sample moments of a standard normal */
+    EXPECT_LT(fabs(m1), 5 * sqrt(1.0 / n)) << name << " " << which << " mean " << m1;
+    EXPECT_LT(fabs(m2 - 1), 5 * sqrt(2.0 / n)) << name << " " << which << " variance " << m2;
+    EXPECT_LT(fabs(m3 / pow(m2, 1.5)), 5 * sqrt(6.0 / n))
+        << name << " " << which << " skewness " << m3 / pow(m2, 1.5);
+    EXPECT_LT(fabs(m4 / (m2 * m2) - 3), 5 * sqrt(24.0 / n))
+        << name << " " << which << " kurtosis " << m4 / (m2 * m2);
+  }
+
+  double c = 0;
+  for (int i = 0; i < n; i++)
+    c += (double)z0[i] * z1[i];
+  EXPECT_LT(fabs(c / n), 5 * sqrt(1.0 / n)) << name << " correlation of z0 and z1 " << c / n;
+}
+
+template <typename T>
+static void CheckBoxMuller(void (*check)(const char *, void (*)(int, T *, T *, T *, T *))) {
+  typedef void (*boxmuller_t)(int, T *, T *, T *, T *);
+  const struct alm_arch_funcs *t = Funcs("boxmuller");
+  ASSERT_TRUE(t != NULL) << "boxmuller is not in the dispatch tables";
+  int nrows = 0;
+
+  for (int row = (int)alm_iface_uarch(); row >= 0; row--) {
+    boxmuller_t fn = (boxmuller_t)t->funcs[row][BoxMuller<T>::slot];
+    if (!fn)
+      continue;
+    nrows++;
+    std::string name = std::string(sizeof(T) == 8 ? "vrda" : "vrsa") + "/" + uarch_names[row];
+    check(name.c_str(), fn);
+  }
+  EXPECT_GT(nrows, 0) << "boxmuller has no array kernel";
+}
+
+TEST(BOXMULLER, TAILS_DOUBLE) { CheckBoxMuller<double>(CheckTails<double>); }
+TEST(BOXMULLER, TAILS_FLOAT) { CheckBoxMuller<float>(CheckTails<float>); }
+TEST(BOXMULLER, SPECIAL_DOUBLE) { CheckBoxMuller<double>(CheckSpecial<double>); }
+TEST(BOXMULLER, SPECIAL_FLOAT) { CheckBoxMuller<float>(CheckSpecial<float>); }
+TEST(BOXMULLER, MOMENTS_DOUBLE) { CheckBoxMuller<double>(CheckMoments<double>); }
+TEST(BOXMULLER, MOMENTS_FLOAT) { CheckBoxMuller<float>(CheckMoments<float>); }
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
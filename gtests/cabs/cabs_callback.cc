@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "libm_tests.h"
+#include <libm_macros.h>
+
+#define AMD_LIBM_VEC_EXPERIMENTAL
+
+#include <libm_amd.h>
+#include <libm/amd_funcs_internal.h>
+#include <fmaintrin.h>
+#include <immintrin.h>
+#include "callback.h"
+#include "test_cabs_data.h"
+#include "../libs/mparith/alm_mp_funcs.h"
+#include <libm/types.h>
+
+static uint32_t ipargs = 1;
+bool special_case = false;
+
+uint32_t GetnIpArgs( void )
+{
+	return ipargs;
+}
+
+bool getSpecialCase(void)
+{
+  return special_case;
+}
+
+void ConfSetupf32(SpecParams *specp) {
+  specp->cdata32 = test_cabsf_conformance_data;
+  specp->countf = ARRAY_SIZE(test_cabsf_conformance_data);
+}
+
+void ConfSetupf64(SpecParams *specp) {
+  specp->cdata64 = test_cabs_conformance_data;
+  specp->countd = ARRAY_SIZE(test_cabs_conformance_data);
+}
+
+/* cabs is real, the tests compare it as the real part of a complex result */
+double _Complex getExpected(float _Complex *data) {
+  double _Complex val = {alm_mpc_cabsf(data[0]), 0.0};
+  return val;
+}
+
+long double _Complex getExpected(double _Complex *data) {
+  long double _Complex val = {alm_mpc_cabs(data[0]), 0.0L};
+  return val;
+}
+
+// Used by the Real Number Functions only!
+double getExpected(float *data) {
+  return 0;
+}
+
+// Used by the Real Number Functions only!
+long double getExpected(double *data) {
+  return 0;
+}
+
+fc32_t getGlibcOp(fc32_t *data) {
+  fc32_t val = {cabsf(data[0]), 0.0f};
+  return val;
+}
+
+fc64_t getGlibcOp(fc64_t *data) {
+  fc64_t val = {cabs(data[0]), 0.0};
+  return val;
+}
+
+/*
+ * The vector variants take complex numbers in split form, a vector of
+ * real parts and a vector of imaginary parts, the test buffers hold them
+ * interleaved.
+ */
+static void SplitComplex(const fc32_t *z, float *re, float *im, int n) {
+  for (int i = 0; i < n; i++) {
+    re[i] = __real__ z[i];
+    im[i] = __imag__ z[i];
+  }
+}
+
+static void SplitComplex(const fc64_t *z, double *re, double *im, int n) {
+  for (int i = 0; i < n; i++) {
+    re[i] = __real__ z[i];
+    im[i] = __imag__ z[i];
+  }
+}
+
+static void JoinComplex(const float *re, const float *im, fc32_t *z, int n) {
+  for (int i = 0; i < n; i++) {
+    __real__ z[i] = re[i];
+    __imag__ z[i] = im ? im[i] : 0.0f;
+  }
+}
+
+static void JoinComplex(const double *re, const double *im, fc64_t *z, int n) {
+  for (int i = 0; i < n; i++) {
+    __real__ z[i] = re[i];
+    __imag__ z[i] = im ? im[i] : 0.0;
+  }
+}
+
+/**********************
+*FUNCTIONS*
+**********************/
+int test_s1s(test_data *data, int idx)  {
+  fc32_t *ip  = (fc32_t*)data->ip;
+  fc32_t *op  = (fc32_t*)data->op;
+  op[0] = {LIBM_FUNC(cabsf)(ip[idx]), 0.0f};
+  return 0;
+}
+
+int test_s1d(test_data *data, int idx)  {
+  fc64_t *ip  = (fc64_t*)data->ip;
+  fc64_t *op  = (fc64_t*)data->op;
+  op[0] = {LIBM_FUNC(cabs)(ip[idx]), 0.0};
+  return 0;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* There are no 128-bit complex variants */
+int test_v2d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4d(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc64_t *ip  = (fc64_t*)data->ip;
+  fc64_t *op  = (fc64_t*)data->op;
+  alignas(32) double re[4], im[4];
+  __m256d r;
+  SplitComplex(&ip[idx], re, im, 4);
+  r = amd_vrz4_cabs(_mm256_load_pd(re), _mm256_load_pd(im));
+  _mm256_store_pd(re, r);
+  JoinComplex(re, NULL, op, 4);
+#endif
+  return 0;
+}
+
+int test_v8s(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc32_t *ip  = (fc32_t*)data->ip;
+  fc32_t *op  = (fc32_t*)data->op;
+  alignas(32) float re[8], im[8];
+  __m256 r;
+  SplitComplex(&ip[idx], re, im, 8);
+  r = amd_vrc8_cabsf(_mm256_load_ps(re), _mm256_load_ps(im));
+  _mm256_store_ps(re, r);
+  JoinComplex(re, NULL, op, 8);
+#endif
+  return 0;
+}
+
+/* The 512-bit register forms exist for cexp, clog and cpow only */
+int test_v8d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v16s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_vas(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc32_t *ip  = (fc32_t*)data->ip;
+  fc32_t *op  = (fc32_t*)data->op;
+  std::vector<float> r(count);
+  amd_vrca_cabsf(count, ip, r.data());
+  JoinComplex(r.data(), NULL, op, count);
+#endif
+  return 0;
+}
+
+int test_vad(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc64_t *ip  = (fc64_t*)data->ip;
+  fc64_t *op  = (fc64_t*)data->op;
+  std::vector<double> r(count);
+  amd_vrza_cabs(count, ip, r.data());
+  JoinComplex(r.data(), NULL, op, count);
+#endif
+  return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_CABS_DATA_H__
+#define __TEST_CABS_DATA_H__
+
+extern "C"
+{
+    #if defined(_WIN64) || defined(_WIN32)
+        #include "complex.h"
+    #else
+        #include "/usr/include/complex.h"
+    #endif
+}
+
+#include <cmath>
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <external/amdlibm.h>
+
+/*
+ * C99 Annex G special values for cabsf(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f32
+test_cabsf_conformance_data[] = {
+    {{0.0f, 0.0f}, {0.0f, 0.0f}, 0},
+    {{0.0f, -0.0f}, {0.0f, 0.0f}, 0},
+    {{0.0f, 0x1p-140f}, {0x1p-140f, 0.0f}, 0},
+    {{0.0f, 0x1.8p+0f}, {0x1.8p+0f, 0.0f}, 0},
+    {{0.0f, -0x1.8p+0f}, {0x1.8p+0f, 0.0f}, 0},
+    {{0.0f, 0x1.66p+6f}, {0x1.66p+6f, 0.0f}, 0},
+    {{0.0f, INFINITY}, {INFINITY, 0.0f}, 0},
+    {{0.0f, -INFINITY}, {INFINITY, 0.0f}, 0},
+    {{0.0f, NAN}, {NAN, 0.0f}, 0},
+    {{-0.0f, 0.0f}, {0.0f, 0.0f}, 0},
+    {{-0.0f, -0.0f}, {0.0f, 0.0f}, 0},
+    {{-0.0f, 0x1p-140f}, {0x1p-140f, 0.0f}, 0},
+    {{-0.0f, 0x1.8p+0f}, {0x1.8p+0f, 0.0f}, 0},
+    {{-0.0f, -0x1.8p+0f}, {0x1.8p+0f, 0.0f}, 0},
+    {{-0.0f, 0x1.66p+6f}, {0x1.66p+6f, 0.0f}, 0},
+    {{-0.0f, INFINITY}, {INFINITY, 0.0f}, 0},
+    {{-0.0f, -INFINITY}, {INFINITY, 0.0f}, 0},
+    {{-0.0f, NAN}, {NAN, 0.0f}, 0},
+    {{0x1p-140f, 0.0f}, {0x1p-140f, 0.0f}, 0},
+    {{0x1p-140f, -0.0f}, {0x1p-140f, 0.0f}, 0},
+    {{0x1p-140f, 0x1p-140f}, {0x1.6ap-140f, 0.0f}, FE_UNDERFLOW},
+    {{0x1p-140f, 0x1.8p+0f}, {0x1.8p+0f, 0.0f}, 0},
+    {{0x1p-140f, -0x1.8p+0f}, {0x1.8p+0f, 0.0f}, 0},
+    {{0x1p-140f, 0x1.66p+6f}, {0x1.66p+6f, 0.0f}, 0},
+    {{0x1p-140f, INFINITY}, {INFINITY, 0.0f}, 0},
+    {{0x1p-140f, -INFINITY}, {INFINITY, 0.0f}, 0},
+    {{0x1p-140f, NAN}, {NAN, 0.0f}, 0},
+    {{0x1.8p+0f, 0.0f}, {0x1.8p+0f, 0.0f}, 0},
+    {{0x1.8p+0f, -0.0f}, {0x1.8p+0f, 0.0f}, 0},
+    {{0x1.8p+0f, 0x1p-140f}, {0x1.8p+0f, 0.0f}, 0},
+    {{0x1.8p+0f, 0x1.8p+0f}, {0x1.0f876cp+1f, 0.0f}, 0},
+    {{0x1.8p+0f, -0x1.8p+0f}, {0x1.0f876cp+1f, 0.0f}, 0},
+    {{0x1.8p+0f, 0x1.66p+6f}, {0x1.660cdep+6f, 0.0f}, 0},
+    {{0x1.8p+0f, INFINITY}, {INFINITY, 0.0f}, 0},
+    {{0x1.8p+0f, -INFINITY}, {INFINITY, 0.0f}, 0},
+    {{0x1.8p+0f, NAN}, {NAN, 0.0f}, 0},
+    {{-0x1.8p+0f, 0.0f}, {0x1.8p+0f, 0.0f}, 0},
+    {{-0x1.8p+0f, -0.0f}, {0x1.8p+0f, 0.0f}, 0},
+    {{-0x1.8p+0f, 0x1p-140f}, {0x1.8p+0f, 0.0f}, 0},
+    {{-0x1.8p+0f, 0x1.8p+0f}, {0x1.0f876cp+1f, 0.0f}, 0},
+    {{-0x1.8p+0f, -0x1.8p+0f}, {0x1.0f876cp+1f, 0.0f}, 0},
+    {{-0x1.8p+0f, 0x1.66p+6f}, {0x1.660cdep+6f, 0.0f}, 0},
+    {{-0x1.8p+0f, INFINITY}, {INFINITY, 0.0f}, 0},
+    {{-0x1.8p+0f, -INFINITY}, {INFINITY, 0.0f}, 0},
+    {{-0x1.8p+0f, NAN}, {NAN, 0.0f}, 0},
+    {{0x1.66p+6f, 0.0f}, {0x1.66p+6f, 0.0f}, 0},
+    {{0x1.66p+6f, -0.0f}, {0x1.66p+6f, 0.0f}, 0},
+    {{0x1.66p+6f, 0x1p-140f}, {0x1.66p+6f, 0.0f}, 0},
+    {{0x1.66p+6f, 0x1.8p+0f}, {0x1.660cdep+6f, 0.0f}, 0},
+    {{0x1.66p+6f, -0x1.8p+0f}, {0x1.660cdep+6f, 0.0f}, 0},
+    {{0x1.66p+6f, 0x1.66p+6f}, {0x1.fa49d8p+6f, 0.0f}, 0},
+    {{0x1.66p+6f, INFINITY}, {INFINITY, 0.0f}, 0},
+    {{0x1.66p+6f, -INFINITY}, {INFINITY, 0.0f}, 0},
+    {{0x1.66p+6f, NAN}, {NAN, 0.0f}, 0},
+    {{INFINITY, 0.0f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, -0.0f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, 0x1p-140f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, 0x1.8p+0f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, -0x1.8p+0f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, 0x1.66p+6f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, INFINITY}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, -INFINITY}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, NAN}, {INFINITY, 0.0f}, 0},
+    {{-INFINITY, 0.0f}, {INFINITY, 0.0f}, 0},
+    {{-INFINITY, -0.0f}, {INFINITY, 0.0f}, 0},
+    {{-INFINITY, 0x1p-140f}, {INFINITY, 0.0f}, 0},
+    {{-INFINITY, 0x1.8p+0f}, {INFINITY, 0.0f}, 0},
+    {{-INFINITY, -0x1.8p+0f}, {INFINITY, 0.0f}, 0},
+    {{-INFINITY, 0x1.66p+6f}, {INFINITY, 0.0f}, 0},
+    {{-INFINITY, INFINITY}, {INFINITY, 0.0f}, 0},
+    {{-INFINITY, -INFINITY}, {INFINITY, 0.0f}, 0},
+    {{-INFINITY, NAN}, {INFINITY, 0.0f}, 0},
+    {{NAN, 0.0f}, {NAN, 0.0f}, 0},
+    {{NAN, -0.0f}, {NAN, 0.0f}, 0},
+    {{NAN, 0x1p-140f}, {NAN, 0.0f}, 0},
+    {{NAN, 0x1.8p+0f}, {NAN, 0.0f}, 0},
+    {{NAN, -0x1.8p+0f}, {NAN, 0.0f}, 0},
+    {{NAN, 0x1.66p+6f}, {NAN, 0.0f}, 0},
+    {{NAN, INFINITY}, {INFINITY, 0.0f}, 0},
+    {{NAN, -INFINITY}, {INFINITY, 0.0f}, 0},
+    {{NAN, NAN}, {NAN, 0.0f}, 0},
+};
+
+/*
+ * C99 Annex G special values for cabs(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f64
+test_cabs_conformance_data[] = {
+    {{0.0, 0.0}, {0.0, 0.0}, 0},
+    {{0.0, -0.0}, {0.0, 0.0}, 0},
+    {{0.0, 0x0.000000000001p-1022}, {0x0.000000000001p-1022, 0.0}, 0},
+    {{0.0, 0x1.8p+0}, {0x1.8p+0, 0.0}, 0},
+    {{0.0, -0x1.8p+0}, {0x1.8p+0, 0.0}, 0},
+    {{0.0, 0x1.634p+9}, {0x1.634p+9, 0.0}, 0},
+    {{0.0, INFINITY}, {INFINITY, 0.0}, 0},
+    {{0.0, -INFINITY}, {INFINITY, 0.0}, 0},
+    {{0.0, NAN}, {NAN, 0.0}, 0},
+    {{-0.0, 0.0}, {0.0, 0.0}, 0},
+    {{-0.0, -0.0}, {0.0, 0.0}, 0},
+    {{-0.0, 0x0.000000000001p-1022}, {0x0.000000000001p-1022, 0.0}, 0},
+    {{-0.0, 0x1.8p+0}, {0x1.8p+0, 0.0}, 0},
+    {{-0.0, -0x1.8p+0}, {0x1.8p+0, 0.0}, 0},
+    {{-0.0, 0x1.634p+9}, {0x1.634p+9, 0.0}, 0},
+    {{-0.0, INFINITY}, {INFINITY, 0.0}, 0},
+    {{-0.0, -INFINITY}, {INFINITY, 0.0}, 0},
+    {{-0.0, NAN}, {NAN, 0.0}, 0},
+    {{0x0.000000000001p-1022, 0.0}, {0x0.000000000001p-1022, 0.0}, 0},
+    {{0x0.000000000001p-1022, -0.0}, {0x0.000000000001p-1022, 0.0}, 0},
+    {{0x0.000000000001p-1022, 0x0.000000000001p-1022}, {0x0.0000000000017p-1022, 0.0}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, 0x1.8p+0}, {0x1.8p+0, 0.0}, 0},
+    {{0x0.000000000001p-1022, -0x1.8p+0}, {0x1.8p+0, 0.0}, 0},
+    {{0x0.000000000001p-1022, 0x1.634p+9}, {0x1.634p+9, 0.0}, 0},
+    {{0x0.000000000001p-1022, INFINITY}, {INFINITY, 0.0}, 0},
+    {{0x0.000000000001p-1022, -INFINITY}, {INFINITY, 0.0}, 0},
+    {{0x0.000000000001p-1022, NAN}, {NAN, 0.0}, 0},
+    {{0x1.8p+0, 0.0}, {0x1.8p+0, 0.0}, 0},
+    {{0x1.8p+0, -0.0}, {0x1.8p+0, 0.0}, 0},
+    {{0x1.8p+0, 0x0.000000000001p-1022}, {0x1.8p+0, 0.0}, 0},
+    {{0x1.8p+0, 0x1.8p+0}, {0x1.0f876ccdf6cd9p+1, 0.0}, 0},
+    {{0x1.8p+0, -0x1.8p+0}, {0x1.0f876ccdf6cd9p+1, 0.0}, 0},
+    {{0x1.8p+0, 0x1.634p+9}, {0x1.634033e270975p+9, 0.0}, 0},
+    {{0x1.8p+0, INFINITY}, {INFINITY, 0.0}, 0},
+    {{0x1.8p+0, -INFINITY}, {INFINITY, 0.0}, 0},
+    {{0x1.8p+0, NAN}, {NAN, 0.0}, 0},
+    {{-0x1.8p+0, 0.0}, {0x1.8p+0, 0.0}, 0},
+    {{-0x1.8p+0, -0.0}, {0x1.8p+0, 0.0}, 0},
+    {{-0x1.8p+0, 0x0.000000000001p-1022}, {0x1.8p+0, 0.0}, 0},
+    {{-0x1.8p+0, 0x1.8p+0}, {0x1.0f876ccdf6cd9p+1, 0.0}, 0},
+    {{-0x1.8p+0, -0x1.8p+0}, {0x1.0f876ccdf6cd9p+1, 0.0}, 0},
+    {{-0x1.8p+0, 0x1.634p+9}, {0x1.634033e270975p+9, 0.0}, 0},
+    {{-0x1.8p+0, INFINITY}, {INFINITY, 0.0}, 0},
+    {{-0x1.8p+0, -INFINITY}, {INFINITY, 0.0}, 0},
+    {{-0x1.8p+0, NAN}, {NAN, 0.0}, 0},
+    {{0x1.634p+9, 0.0}, {0x1.634p+9, 0.0}, 0},
+    {{0x1.634p+9, -0.0}, {0x1.634p+9, 0.0}, 0},
+    {{0x1.634p+9, 0x0.000000000001p-1022}, {0x1.634p+9, 0.0}, 0},
+    {{0x1.634p+9, 0x1.8p+0}, {0x1.634033e270975p+9, 0.0}, 0},
+    {{0x1.634p+9, -0x1.8p+0}, {0x1.634033e270975p+9, 0.0}, 0},
+    {{0x1.634p+9, 0x1.634p+9}, {0x1.f6663cfbc0fbcp+9, 0.0}, 0},
+    {{0x1.634p+9, INFINITY}, {INFINITY, 0.0}, 0},
+    {{0x1.634p+9, -INFINITY}, {INFINITY, 0.0}, 0},
+    {{0x1.634p+9, NAN}, {NAN, 0.0}, 0},
+    {{INFINITY, 0.0}, {INFINITY, 0.0}, 0},
+    {{INFINITY, -0.0}, {INFINITY, 0.0}, 0},
+    {{INFINITY, 0x0.000000000001p-1022}, {INFINITY, 0.0}, 0},
+    {{INFINITY, 0x1.8p+0}, {INFINITY, 0.0}, 0},
+    {{INFINITY, -0x1.8p+0}, {INFINITY, 0.0}, 0},
+    {{INFINITY, 0x1.634p+9}, {INFINITY, 0.0}, 0},
+    {{INFINITY, INFINITY}, {INFINITY, 0.0}, 0},
+    {{INFINITY, -INFINITY}, {INFINITY, 0.0}, 0},
+    {{INFINITY, NAN}, {INFINITY, 0.0}, 0},
+    {{-INFINITY, 0.0}, {INFINITY, 0.0}, 0},
+    {{-INFINITY, -0.0}, {INFINITY, 0.0}, 0},
+    {{-INFINITY, 0x0.000000000001p-1022}, {INFINITY, 0.0}, 0},
+    {{-INFINITY, 0x1.8p+0}, {INFINITY, 0.0}, 0},
+    {{-INFINITY, -0x1.8p+0}, {INFINITY, 0.0}, 0},
+    {{-INFINITY, 0x1.634p+9}, {INFINITY, 0.0}, 0},
+    {{-INFINITY, INFINITY}, {INFINITY, 0.0}, 0},
+    {{-INFINITY, -INFINITY}, {INFINITY, 0.0}, 0},
+    {{-INFINITY, NAN}, {INFINITY, 0.0}, 0},
+    {{NAN, 0.0}, {NAN, 0.0}, 0},
+    {{NAN, -0.0}, {NAN, 0.0}, 0},
+    {{NAN, 0x0.000000000001p-1022}, {NAN, 0.0}, 0},
+    {{NAN, 0x1.8p+0}, {NAN, 0.0}, 0},
+    {{NAN, -0x1.8p+0}, {NAN, 0.0}, 0},
+    {{NAN, 0x1.634p+9}, {NAN, 0.0}, 0},
+    {{NAN, INFINITY}, {INFINITY, 0.0}, 0},
+    {{NAN, -INFINITY}, {INFINITY, 0.0}, 0},
+    {{NAN, NAN}, {NAN, 0.0}, 0},
+};
+
+#endif	/*__TEST_CABS_DATA_H__*/
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/*
+ * C99 Annex G special values through the scalar, vector and array carg
+ * variants, against the GLIBC results in the table. The array forms run
+ * every length of the table, which covers each size of the masked tail.
+ * The finite parts are checked for accuracy by the ACCURACY tests, here
+ * they only need to be close to the GLIBC result.
+ */
+
+#include "libm_tests.h"
+#include "almtestvec.h"
+#include "test_carg_data.h"
+
+static const uint64_t maxulp = 16;
+
+TEST(CARG, CONFORMANCE_COMPLEX_FLOAT_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_cargf_conformance_data);
+  ConfCheckComplexVec<float>("cargf", test_cargf_conformance_data, n, 1, 1, test_s1s, maxulp);
+  ConfCheckComplexVec<float>("vrc8_cargf", test_cargf_conformance_data, n, 1, 8, test_v8s, maxulp);
+  for (size_t len = 1; len <= n; len++) {
+    ConfCheckComplexVec<float>("vrca_cargf", test_cargf_conformance_data, len, 1, 0, test_vas, maxulp);
+  }
+}
+
+TEST(CARG, CONFORMANCE_COMPLEX_DOUBLE_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_carg_conformance_data);
+  ConfCheckComplexVec<double>("carg", test_carg_conformance_data, n, 1, 1, test_s1d, maxulp);
+  ConfCheckComplexVec<double>("vrz4_carg", test_carg_conformance_data, n, 1, 4, test_v4d, maxulp);
+  for (size_t len = 1; len <= n; len++) {
+    ConfCheckComplexVec<double>("vrza_carg", test_carg_conformance_data, len, 1, 0, test_vad, maxulp);
+  }
+}
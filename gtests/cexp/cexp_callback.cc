@@ -1,31 +1,8 @@
-/*
- * Copyright (C) 2008-2024 Advanced Micro Devices, Inc. All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without modification,
- * are permitted provided that the following conditions are met:
- * 1. Redistributions of source code must retain the above copyright notice,
- *    this list of conditions and the following disclaimer.
- * 2. Redistributions in binary form must reproduce the above copyright notice,
- *    this list of conditions and the following disclaimer in the documentation
- *    and/or other materials provided with the distribution.
- * 3. Neither the name of the copyright holder nor the names of its contributors
- *    may be used to endorse or promote products derived from this software without
- *    specific prior written permission.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
- * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
- * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
- * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
- * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
- * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
- * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
- * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
- * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
- * POSSIBILITY OF SUCH DAMAGE.
- *
- */
+
 
 #include <cmath>
+#include <cstring>
+#include <vector>
 #include "libm_tests.h"
 #include <libm_macros.h>
 
@@ -84,11 +61,59 @@ long double getExpected(double *data) {
 }
 
 fc32_t getGlibcOp(fc32_t *data) {
-  return cexpf(data[0]);
+  return ::cexpf(data[0]);
 }
 
 fc64_t getGlibcOp(fc64_t *data) {
-  return cexp(data[0]);
+  return ::cexp(data[0]);
+}
+
+/*
+ * The vector variants take complex numbers in split form, a vector of
+ * real parts and a vector of imaginary parts, the test buffers hold them
+ * interleaved.
+ */
+static void SplitComplex(const fc32_t *z, float *re, float *im, int n) {
+  for (int i = 0; i < n; i++) {
+    re[i] = __real__ z[i];
+    im[i] = __imag__ z[i];
+  }
+}
+
+static void SplitComplex(const fc64_t *z, double *re, double *im, int n) {
+  for (int i = 0; i < n; i++) {
+    re[i] = __real__ z[i];
+    im[i] = __imag__ z[i];
+  }
+}
+
+static void JoinComplex(const float *re, const float *im, fc32_t *z, int n) {
+  for (int i = 0; i < n; i++) {
+    __real__ z[i] = re[i];
+    __imag__ z[i] = im ? im[i] : 0.0f;
+  }
+}
+
+static void JoinComplex(const double *re, const double *im, fc64_t *z, int n) {
+  for (int i = 0; i < n; i++) {
+    __real__ z[i] = re[i];
+    __imag__ z[i] = im ? im[i] : 0.0;
+  }
+}
+
+/*
+ * Poisons every lane where the SoA result differs bitwise from the
+ * interleaved one in z, so the accuracy test reports it as a failure.
+ */
+template <typename T, typename C>
+static void CheckSoa(C *z, const T *rre, const T *rim, int n) {
+  for (int i = 0; i < n; i++) {
+    T re = __real__ z[i], im = __imag__ z[i];
+    if (memcmp(&re, &rre[i], sizeof(T)) || memcmp(&im, &rim[i], sizeof(T))) {
+      __real__ z[i] = NAN;
+      __imag__ z[i] = NAN;
+    }
+  }
 }
 
 /**********************
@@ -112,91 +137,126 @@ int test_s1d(test_data *data, int idx)  {
 extern "C" {
 #endif
 
-#if (LIBM_PROTOTYPE == PROTOTYPE_GLIBC)
-#define _ZGVdN2v_cexp _ZGVbN2v_cexp
-#define _ZGVdN4v_cexp _ZGVdN4v_cexp
-#define _ZGVsN4v_cexpf _ZGVbN4v_cexpf
-#define _ZGVsN8v_cexpf _ZGVdN8v_cexpf
-#endif
-
-/*vector routines*/
-#if (LIBM_PROTOTYPE != PROTOTYPE_MSVC)
-  __m128d LIBM_FUNC_VEC(d, 2, cexp)(__m128d);
-  __m256d LIBM_FUNC_VEC(d, 4, cexp)(__m256d);
-
-  __m128 LIBM_FUNC_VEC(s, 4, cexpf)(__m128);
-  __m256 LIBM_FUNC_VEC(s, 8, cexpf)(__m256);
-#endif
-
+/* There are no 128-bit complex variants */
 int test_v2d(test_data *data, int idx)  {
-#if 0
-  double *ip  = (double*)data->ip;
-  double *op  = (double*)data->op;
-  __m128d ip2 = _mm_set_pd(ip[idx+1], ip[idx]);
-  __m128d op2 = LIBM_FUNC_VEC(d, 2, cexp)(ip2);
-  _mm_store_pd(&op[0], op2);
-#endif
   return 0;
 }
 
 int test_v4s(test_data *data, int idx)  {
-#if 0
-  float *ip  = (float*)data->ip;
-  float *op  = (float*)data->op;
-  __m128 ip4 = _mm_set_ps(ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
-  __m128 op4 = LIBM_FUNC_VEC(s, 4, cexpf)(ip4);
-  _mm_store_ps(&op[0], op4);
-#endif
   return 0;
 }
 
 int test_v4d(test_data *data, int idx)  {
-#if 0
-  double *ip  = (double*)data->ip;
-  double *op  = (double*)data->op;
-  __m256d ip4 = _mm256_set_pd(ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
-  __m256d op4 = LIBM_FUNC_VEC(d, 4, cexp)(ip4);
-  _mm256_store_pd(&op[0], op4);
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc64_t *ip  = (fc64_t*)data->ip;
+  fc64_t *op  = (fc64_t*)data->op;
+  alignas(32) double re[4], im[4];
+  __m256d rre, rim;
+  SplitComplex(&ip[idx], re, im, 4);
+  amd_vrz4_cexp(_mm256_load_pd(re), _mm256_load_pd(im), &rre, &rim);
+  _mm256_store_pd(re, rre);
+  _mm256_store_pd(im, rim);
+  JoinComplex(re, im, op, 4);
 #endif
   return 0;
 }
 
 int test_v8s(test_data *data, int idx)  {
-#if 0
-  float *ip  = (float*)data->ip;
-  float *op  = (float*)data->op;
-  __m256 ip8 = _mm256_set_ps(ip[idx+7], ip[idx+6], ip[idx+5], ip[idx+4],
-                             ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
-  __m256 op8 = LIBM_FUNC_VEC(s, 8, cexpf)(ip8);
-  _mm256_store_ps(&op[0], op8);
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc32_t *ip  = (fc32_t*)data->ip;
+  fc32_t *op  = (fc32_t*)data->op;
+  alignas(32) float re[8], im[8];
+  __m256 rre, rim;
+  SplitComplex(&ip[idx], re, im, 8);
+  amd_vrc8_cexpf(_mm256_load_ps(re), _mm256_load_ps(im), &rre, &rim);
+  _mm256_store_ps(re, rre);
+  _mm256_store_ps(im, rim);
+  JoinComplex(re, im, op, 8);
 #endif
   return 0;
 }
 
 int test_v8d(test_data *data, int idx)  {
-/* later change this to #if defined(__AVX512__)*/
-#if 0
-  double *ip  = (double*)data->ip;
-  double *op  = (double*)data->op;
-  __m512d ip8 = _mm512_set_pd(ip[idx+7], ip[idx+6], ip[idx+5], ip[idx+4],
-                             ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
-  __m512d op8 = LIBM_FUNC_VEC(d, 8, exp)(ip8);
-  _mm512_store_pd(&op[0], op8);
+#if defined(__AVX512__) && (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc64_t *ip  = (fc64_t*)data->ip;
+  fc64_t *op  = (fc64_t*)data->op;
+  alignas(64) double re[8], im[8];
+  __m512d rre, rim;
+  SplitComplex(&ip[idx], re, im, 8);
+  amd_vrz8_cexp(_mm512_load_pd(re), _mm512_load_pd(im), &rre, &rim);
+  _mm512_store_pd(re, rre);
+  _mm512_store_pd(im, rim);
+  JoinComplex(re, im, op, 8);
 #endif
   return 0;
 }
 
 int test_v16s(test_data *data, int idx)  {
-/* later change this to #if defined(__AVX512__)*/
-#if 0
-  float *ip = (float*)data->ip;
-  float *op  = (float*)data->op;
-  __m512 ip16 = _mm512_set_ps(ip[idx+15], ip[idx+14], ip[idx+13], ip[idx+12],
-                              ip[idx+11], ip[idx+10], ip[idx+9], ip[idx+8],
-                              ip[idx+7], ip[idx+6], ip[idx+5], ip[idx+4],
-                             ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
-  __m512 op16 = LIBM_FUNC_VEC(s, 16, cexpf)(ip16);
-  _mm512_store_ps(&op[0], op16);
+#if defined(__AVX512__) && (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc32_t *ip  = (fc32_t*)data->ip;
+  fc32_t *op  = (fc32_t*)data->op;
+  alignas(64) float re[16], im[16];
+  __m512 rre, rim;
+  SplitComplex(&ip[idx], re, im, 16);
+  amd_vrc16_cexpf(_mm512_load_ps(re), _mm512_load_ps(im), &rre, &rim);
+  _mm512_store_ps(re, rre);
+  _mm512_store_ps(im, rim);
+  JoinComplex(re, im, op, 16);
+#endif
+  return 0;
+}
+
+/*
+ * The array callbacks also run the SoA form and report its lanes that
+ * differ from the interleaved form.
+ */
+int test_vas(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc32_t *ip  = (fc32_t*)data->ip;
+  fc32_t *op  = (fc32_t*)data->op;
+  amd_vrca_cexpf(count, ip, op);
+  std::vector<float> re(count), im(count), rre(count), rim(count);
+  SplitComplex(ip, re.data(), im.data(), count);
+  amd_vrca_cexpf_soa(count, re.data(), im.data(), rre.data(), rim.data());
+  CheckSoa(op, rre.data(), rim.data(), count);
+#endif
+  return 0;
+}
+
+int test_vad(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc64_t *ip  = (fc64_t*)data->ip;
+  fc64_t *op  = (fc64_t*)data->op;
+  amd_vrza_cexp(count, ip, op);
+  std::vector<double> re(count), im(count), rre(count), rim(count);
+  SplitComplex(ip, re.data(), im.data(), count);
+  amd_vrza_cexp_soa(count, re.data(), im.data(), rre.data(), rim.data());
+  CheckSoa(op, rre.data(), rim.data(), count);
+#endif
+  return 0;
+}
+
+/* The SoA form alone, for the special value tests */
+int test_vas_soa(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc32_t *ip  = (fc32_t*)data->ip;
+  fc32_t *op  = (fc32_t*)data->op;
+  std::vector<float> re(count), im(count), rre(count), rim(count);
+  SplitComplex(ip, re.data(), im.data(), count);
+  amd_vrca_cexpf_soa(count, re.data(), im.data(), rre.data(), rim.data());
+  JoinComplex(rre.data(), rim.data(), op, count);
+#endif
+  return 0;
+}
+
+int test_vad_soa(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  fc64_t *ip  = (fc64_t*)data->ip;
+  fc64_t *op  = (fc64_t*)data->op;
+  std::vector<double> re(count), im(count), rre(count), rim(count);
+  SplitComplex(ip, re.data(), im.data(), count);
+  amd_vrza_cexp_soa(count, re.data(), im.data(), rre.data(), rim.data());
+  JoinComplex(rre.data(), rim.data(), op, count);
 #endif
   return 0;
 }
@@ -164,4 +164,184 @@ test_cexp_conformance_data[] = {
     // For z = +∞+yi, the result is +∞cis(y)
 };
 
+/*
+ * C99 Annex G special values for cexpf(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f32
+test_cexpf_annexg_data[] = {
+    {{0.0f, 0.0f}, {0x1p+0f, 0.0f}, 0},
+    {{0.0f, -0.0f}, {0x1p+0f, -0.0f}, 0},
+    {{0.0f, 0x1p-140f}, {0x1p+0f, 0x1p-140f}, FE_UNDERFLOW},
+    {{0.0f, 0x1.8p+0f}, {0x1.21bd54p-4f, 0x1.feb7aap-1f}, 0},
+    {{0.0f, -0x1.8p+0f}, {0x1.21bd54p-4f, -0x1.feb7aap-1f}, 0},
+    {{0.0f, 0x1.66p+6f}, {0x1.21dc08p-5f, 0x1.ffadecp-1f}, 0},
+    {{0.0f, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0.0f, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0.0f, NAN}, {NAN, NAN}, FE_INVALID},
+    {{-0.0f, 0.0f}, {0x1p+0f, 0.0f}, 0},
+    {{-0.0f, -0.0f}, {0x1p+0f, -0.0f}, 0},
+    {{-0.0f, 0x1p-140f}, {0x1p+0f, 0x1p-140f}, FE_UNDERFLOW},
+    {{-0.0f, 0x1.8p+0f}, {0x1.21bd54p-4f, 0x1.feb7aap-1f}, 0},
+    {{-0.0f, -0x1.8p+0f}, {0x1.21bd54p-4f, -0x1.feb7aap-1f}, 0},
+    {{-0.0f, 0x1.66p+6f}, {0x1.21dc08p-5f, 0x1.ffadecp-1f}, 0},
+    {{-0.0f, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{-0.0f, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{-0.0f, NAN}, {NAN, NAN}, FE_INVALID},
+    {{0x1p-140f, 0.0f}, {0x1p+0f, 0.0f}, 0},
+    {{0x1p-140f, -0.0f}, {0x1p+0f, -0.0f}, 0},
+    {{0x1p-140f, 0x1p-140f}, {0x1p+0f, 0x1p-140f}, FE_UNDERFLOW},
+    {{0x1p-140f, 0x1.8p+0f}, {0x1.21bd54p-4f, 0x1.feb7aap-1f}, 0},
+    {{0x1p-140f, -0x1.8p+0f}, {0x1.21bd54p-4f, -0x1.feb7aap-1f}, 0},
+    {{0x1p-140f, 0x1.66p+6f}, {0x1.21dc08p-5f, 0x1.ffadecp-1f}, 0},
+    {{0x1p-140f, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x1p-140f, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x1p-140f, NAN}, {NAN, NAN}, FE_INVALID},
+    {{0x1.8p+0f, 0.0f}, {0x1.1ed3fep+2f, 0.0f}, 0},
+    {{0x1.8p+0f, -0.0f}, {0x1.1ed3fep+2f, -0.0f}, 0},
+    {{0x1.8p+0f, 0x1p-140f}, {0x1.1ed3fep+2f, 0x1.1eep-138f}, FE_UNDERFLOW},
+    {{0x1.8p+0f, 0x1.8p+0f}, {0x1.44a172p-2f, 0x1.1e1c0ep+2f}, 0},
+    {{0x1.8p+0f, -0x1.8p+0f}, {0x1.44a172p-2f, -0x1.1e1c0ep+2f}, 0},
+    {{0x1.8p+0f, 0x1.66p+6f}, {0x1.44c3d8p-3f, 0x1.1ea602p+2f}, 0},
+    {{0x1.8p+0f, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x1.8p+0f, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x1.8p+0f, NAN}, {NAN, NAN}, FE_INVALID},
+    {{-0x1.8p+0f, 0.0f}, {0x1.c8f878p-3f, 0.0f}, 0},
+    {{-0x1.8p+0f, -0.0f}, {0x1.c8f878p-3f, -0.0f}, 0},
+    {{-0x1.8p+0f, 0x1p-140f}, {0x1.c8f878p-3f, 0x1.c8p-143f}, FE_UNDERFLOW},
+    {{-0x1.8p+0f, 0x1.8p+0f}, {0x1.02993ap-6f, 0x1.c7d36cp-3f}, 0},
+    {{-0x1.8p+0f, -0x1.8p+0f}, {0x1.02993ap-6f, -0x1.c7d36cp-3f}, 0},
+    {{-0x1.8p+0f, 0x1.66p+6f}, {0x1.02b4a2p-7f, 0x1.c8af36p-3f}, 0},
+    {{-0x1.8p+0f, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{-0x1.8p+0f, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{-0x1.8p+0f, NAN}, {NAN, NAN}, FE_INVALID},
+    {{0x1.66p+6f, 0.0f}, {INFINITY, 0.0f}, FE_OVERFLOW},
+    {{0x1.66p+6f, -0.0f}, {INFINITY, -0.0f}, FE_OVERFLOW},
+    {{0x1.66p+6f, 0x1p-140f}, {INFINITY, 0x1.166fd2p-11f}, FE_OVERFLOW},
+    {{0x1.66p+6f, 0x1.8p+0f}, {0x1.3b2228p+125f, INFINITY}, FE_OVERFLOW},
+    {{0x1.66p+6f, -0x1.8p+0f}, {0x1.3b2228p+125f, -INFINITY}, FE_OVERFLOW},
+    {{0x1.66p+6f, 0x1.66p+6f}, {0x1.3b438cp+124f, INFINITY}, FE_OVERFLOW},
+    {{0x1.66p+6f, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x1.66p+6f, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x1.66p+6f, NAN}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, 0.0f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, -0.0f}, {INFINITY, -0.0f}, 0},
+    {{INFINITY, 0x1p-140f}, {INFINITY, INFINITY}, 0},
+    {{INFINITY, 0x1.8p+0f}, {INFINITY, INFINITY}, 0},
+    {{INFINITY, -0x1.8p+0f}, {INFINITY, -INFINITY}, 0},
+    {{INFINITY, 0x1.66p+6f}, {INFINITY, INFINITY}, 0},
+    {{INFINITY, INFINITY}, {INFINITY, NAN}, FE_INVALID},
+    {{INFINITY, -INFINITY}, {INFINITY, NAN}, FE_INVALID},
+    {{INFINITY, NAN}, {INFINITY, NAN}, 0},
+    {{-INFINITY, 0.0f}, {0.0f, 0.0f}, 0},
+    {{-INFINITY, -0.0f}, {0.0f, -0.0f}, 0},
+    {{-INFINITY, 0x1p-140f}, {0.0f, 0.0f}, 0},
+    {{-INFINITY, 0x1.8p+0f}, {0.0f, 0.0f}, 0},
+    {{-INFINITY, -0x1.8p+0f}, {0.0f, -0.0f}, 0},
+    {{-INFINITY, 0x1.66p+6f}, {0.0f, 0.0f}, 0},
+    {{-INFINITY, INFINITY}, {0.0f, 0.0f}, 0},
+    {{-INFINITY, -INFINITY}, {0.0f, -0.0f}, 0},
+    {{-INFINITY, NAN}, {0.0f, 0.0f}, 0},
+    {{NAN, 0.0f}, {NAN, 0.0f}, 0},
+    {{NAN, -0.0f}, {NAN, -0.0f}, 0},
+    {{NAN, 0x1p-140f}, {NAN, NAN}, FE_INVALID},
+    {{NAN, 0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{NAN, -0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{NAN, 0x1.66p+6f}, {NAN, NAN}, FE_INVALID},
+    {{NAN, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{NAN, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{NAN, NAN}, {NAN, NAN}, 0},
+};
+
+/*
+ * C99 Annex G special values for cexp(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f64
+test_cexp_annexg_data[] = {
+    {{0.0, 0.0}, {0x1p+0, 0.0}, 0},
+    {{0.0, -0.0}, {0x1p+0, -0.0}, 0},
+    {{0.0, 0x0.000000000001p-1022}, {0x1p+0, 0x0.000000000001p-1022}, FE_UNDERFLOW},
+    {{0.0, 0x1.8p+0}, {0x1.21bd54fc5f9a7p-4, 0x1.feb7a9b2c6d8bp-1}, 0},
+    {{0.0, -0x1.8p+0}, {0x1.21bd54fc5f9a7p-4, -0x1.feb7a9b2c6d8bp-1}, 0},
+    {{0.0, 0x1.634p+9}, {0x1.c14eb67d03eaap-1, 0x1.eafc65d3b2565p-2}, 0},
+    {{0.0, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0.0, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0.0, NAN}, {NAN, NAN}, FE_INVALID},
+    {{-0.0, 0.0}, {0x1p+0, 0.0}, 0},
+    {{-0.0, -0.0}, {0x1p+0, -0.0}, 0},
+    {{-0.0, 0x0.000000000001p-1022}, {0x1p+0, 0x0.000000000001p-1022}, FE_UNDERFLOW},
+    {{-0.0, 0x1.8p+0}, {0x1.21bd54fc5f9a7p-4, 0x1.feb7a9b2c6d8bp-1}, 0},
+    {{-0.0, -0x1.8p+0}, {0x1.21bd54fc5f9a7p-4, -0x1.feb7a9b2c6d8bp-1}, 0},
+    {{-0.0, 0x1.634p+9}, {0x1.c14eb67d03eaap-1, 0x1.eafc65d3b2565p-2}, 0},
+    {{-0.0, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{-0.0, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{-0.0, NAN}, {NAN, NAN}, FE_INVALID},
+    {{0x0.000000000001p-1022, 0.0}, {0x1p+0, 0.0}, 0},
+    {{0x0.000000000001p-1022, -0.0}, {0x1p+0, -0.0}, 0},
+    {{0x0.000000000001p-1022, 0x0.000000000001p-1022}, {0x1p+0, 0x0.000000000001p-1022}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, 0x1.8p+0}, {0x1.21bd54fc5f9a7p-4, 0x1.feb7a9b2c6d8bp-1}, 0},
+    {{0x0.000000000001p-1022, -0x1.8p+0}, {0x1.21bd54fc5f9a7p-4, -0x1.feb7a9b2c6d8bp-1}, 0},
+    {{0x0.000000000001p-1022, 0x1.634p+9}, {0x1.c14eb67d03eaap-1, 0x1.eafc65d3b2565p-2}, 0},
+    {{0x0.000000000001p-1022, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x0.000000000001p-1022, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x0.000000000001p-1022, NAN}, {NAN, NAN}, FE_INVALID},
+    {{0x1.8p+0, 0.0}, {0x1.1ed3fe64fc541p+2, 0.0}, 0},
+    {{0x1.8p+0, -0.0}, {0x1.1ed3fe64fc541p+2, -0.0}, 0},
+    {{0x1.8p+0, 0x0.000000000001p-1022}, {0x1.1ed3fe64fc541p+2, 0x0.0000000000048p-1022}, FE_UNDERFLOW},
+    {{0x1.8p+0, 0x1.8p+0}, {0x1.44a173eb24ae7p-2, 0x1.1e1c0e3d25011p+2}, 0},
+    {{0x1.8p+0, -0x1.8p+0}, {0x1.44a173eb24ae7p-2, -0x1.1e1c0e3d25011p+2}, 0},
+    {{0x1.8p+0, 0x1.634p+9}, {0x1.f76a023d6a16bp+1, 0x1.130e47d94524fp+1}, 0},
+    {{0x1.8p+0, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x1.8p+0, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x1.8p+0, NAN}, {NAN, NAN}, FE_INVALID},
+    {{-0x1.8p+0, 0.0}, {0x1.c8f87724b5c1dp-3, 0.0}, 0},
+    {{-0x1.8p+0, -0.0}, {0x1.c8f87724b5c1dp-3, -0.0}, 0},
+    {{-0x1.8p+0, 0x0.000000000001p-1022}, {0x1.c8f87724b5c1dp-3, 0x0.0000000000004p-1022}, FE_UNDERFLOW},
+    {{-0x1.8p+0, 0x1.8p+0}, {0x1.02993ad236cfap-6, 0x1.c7d36af1b9d99p-3}, 0},
+    {{-0x1.8p+0, -0x1.8p+0}, {0x1.02993ad236cfap-6, -0x1.c7d36af1b9d99p-3}, 0},
+    {{-0x1.8p+0, 0x1.634p+9}, {0x1.91042535be7e2p-3, 0x1.b6370f32bb153p-4}, 0},
+    {{-0x1.8p+0, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{-0x1.8p+0, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{-0x1.8p+0, NAN}, {NAN, NAN}, FE_INVALID},
+    {{0x1.634p+9, 0.0}, {INFINITY, 0.0}, FE_OVERFLOW},
+    {{0x1.634p+9, -0.0}, {INFINITY, -0.0}, FE_OVERFLOW},
+    {{0x1.634p+9, 0x0.000000000001p-1022}, {INFINITY, 0x1.064148abcbe6fp-45}, FE_OVERFLOW},
+    {{0x1.634p+9, 0x1.8p+0}, {0x1.28d1a84c8e118p+1021, INFINITY}, FE_OVERFLOW},
+    {{0x1.634p+9, -0x1.8p+0}, {0x1.28d1a84c8e118p+1021, -INFINITY}, FE_OVERFLOW},
+    {{0x1.634p+9, 0x1.634p+9}, {INFINITY, 0x1.f6fb85acfd913p+1023}, FE_OVERFLOW},
+    {{0x1.634p+9, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x1.634p+9, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{0x1.634p+9, NAN}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, 0.0}, {INFINITY, 0.0}, 0},
+    {{INFINITY, -0.0}, {INFINITY, -0.0}, 0},
+    {{INFINITY, 0x0.000000000001p-1022}, {INFINITY, INFINITY}, 0},
+    {{INFINITY, 0x1.8p+0}, {INFINITY, INFINITY}, 0},
+    {{INFINITY, -0x1.8p+0}, {INFINITY, -INFINITY}, 0},
+    {{INFINITY, 0x1.634p+9}, {INFINITY, INFINITY}, 0},
+    {{INFINITY, INFINITY}, {INFINITY, NAN}, FE_INVALID},
+    {{INFINITY, -INFINITY}, {INFINITY, NAN}, FE_INVALID},
+    {{INFINITY, NAN}, {INFINITY, NAN}, 0},
+    {{-INFINITY, 0.0}, {0.0, 0.0}, 0},
+    {{-INFINITY, -0.0}, {0.0, -0.0}, 0},
+    {{-INFINITY, 0x0.000000000001p-1022}, {0.0, 0.0}, 0},
+    {{-INFINITY, 0x1.8p+0}, {0.0, 0.0}, 0},
+    {{-INFINITY, -0x1.8p+0}, {0.0, -0.0}, 0},
+    {{-INFINITY, 0x1.634p+9}, {0.0, 0.0}, 0},
+    {{-INFINITY, INFINITY}, {0.0, 0.0}, 0},
+    {{-INFINITY, -INFINITY}, {0.0, -0.0}, 0},
+    {{-INFINITY, NAN}, {0.0, 0.0}, 0},
+    {{NAN, 0.0}, {NAN, 0.0}, 0},
+    {{NAN, -0.0}, {NAN, -0.0}, 0},
+    {{NAN, 0x0.000000000001p-1022}, {NAN, NAN}, FE_INVALID},
+    {{NAN, 0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{NAN, -0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{NAN, 0x1.634p+9}, {NAN, NAN}, FE_INVALID},
+    {{NAN, INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{NAN, -INFINITY}, {NAN, NAN}, FE_INVALID},
+    {{NAN, NAN}, {NAN, NAN}, 0},
+};
+
 #endif	/*__TEST_CEXP_DATA_H__*/
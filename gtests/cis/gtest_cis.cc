@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/*
+ * The cis and polar array kernels against vrda_sincos plus interleaving.
+ *
+ * For each uarch row the host can run, vrda_cis(theta) must be
+ * bit-identical to cos + i sin from the vrda_sincos of the same row, and
+ * vrda_polar(r, theta) to r * cos + i r * sin, and the same for the float
+ * variants. The lengths cover every tail, length % 8 (and % 16) of 1 to
+ * 7, on short and long arrays, and the inputs mix random angles with
+ * zeros, denormals, huge angles, inf and NaN. One element past the end
+ * of the output must not be written.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "gtest.h"
+#define AMD_LIBM_VEC_EXPERIMENTAL
+#include <external/amdlibm_vec.h>
+#include <libm/iface.h>
+
+static const char *uarch_names[ALM_UARCH_MAX] = {
+    "default", "base64", "fma3", "zen", "zen2", "zen3", "zen4", "zen5",
+};
+
+template <typename T> struct Cis;
+
+template <> struct Cis<double> {
+  typedef uint64_t bits;
+  typedef fc64_t cplx;
+  static const int slot = ALM_FUNC_VECT_DP_ARR;
+  static constexpr double huge = 1e300;
+};
+
+template <> struct Cis<float> {
+  typedef uint32_t bits;
+  typedef fc32_t cplx;
+  static const int slot = ALM_FUNC_VECT_SP_ARR;
+  static constexpr float huge = 1e30f;
+};
+
+static std::vector<int> Lengths(void) {
+  std::vector<int> n;
+  for (int i = 0; i <= 33; i++)
+    n.push_back(i);
+  for (int i = 1000; i <= 1016; i++)
+    n.push_back(i);
+  return n;
+}
+
+template <typename T>
+static std::vector<T> Inputs(int n, T lo, T hi, unsigned seed) {
+  static const T special[] = {
+      T(0), -T(0), std::numeric_limits<T>::denorm_min(), Cis<T>::huge,
+      std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+      std::numeric_limits<T>::quiet_NaN(),
+  };
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<T> dist(lo, hi);
+  std::vector<T> v(n);
+  for (int i = 0; i < n; i++)
+    v[i] = (i % 7 == 3) ? special[(i / 7) % 7] : dist(gen);
+  return v;
+}
+
+template <typename T>
+static bool SameBits(T e, T a) {
+  typename Cis<T>::bits ue, ua;
+  memcpy(&ue, &e, sizeof(ue));
+  memcpy(&ua, &a, sizeof(ua));
+  return ue == ua || (std::isnan(e) && std::isnan(a));
+}
+
+static const struct alm_arch_funcs *Funcs(const char *func) {
+  for (int e = 1; e < C_AMD_LAST_ENTRY; e++)
+    if (alm_iface_name(e) && !strcmp(alm_iface_name(e), func))
+      return alm_iface_funcs(e);
+  return NULL;
+}
+
+/*
+ * out holds n + 1 complex numbers as 2n + 2 reals, ref the expected
+ * 2n. Reports up to 5 mismatches and checks the canary.
+ */
+template <typename T>
+static void Compare(const char *name, int n, const std::vector<T> &theta,
+                    const std::vector<T> &ref, const std::vector<T> &out) {
+  int nfail = 0;
+  for (int i = 0; i < 2 * n; i++) {
+    if (SameBits(ref[i], out[i]) || nfail++ >= 5)
+      continue;
+    ADD_FAILURE() << name << " n=" << n << " i=" << i / 2 << (i % 2 ? " im" : " re")
+                  << " theta=" << std::hexfloat << theta[i / 2] << " expected "
+                  << ref[i] << " actual " << out[i];
+  }
+  EXPECT_TRUE(out[2 * n] == T(-7) && out[2 * n + 1] == T(-7))
+      << name << " wrote past n=" << n;
+}
+
+template <typename T>
+static void CheckCis(const char *cis, const char *polar) {
+  typedef void (*sincos_t)(int, T *, T *, T *);
+  typedef void (*cis_t)(int, T *, typename Cis<T>::cplx *);
+  typedef void (*polar_t)(int, T *, T *, typename Cis<T>::cplx *);
+  const struct alm_arch_funcs *ts = Funcs("sincos"), *tc = Funcs(cis), *tp = Funcs(polar);
+  ASSERT_TRUE(ts && tc && tp) << "sincos, " << cis << " or " << polar
+                              << " is not in the dispatch tables";
+  int nrows = 0;
+
+  for (int row = (int)alm_iface_uarch(); row >= 0; row--) {
+    sincos_t fsc = (sincos_t)ts->funcs[row][Cis<T>::slot];
+    cis_t fc = (cis_t)tc->funcs[row][Cis<T>::slot];
+    polar_t fp = (polar_t)tp->funcs[row][Cis<T>::slot];
+    if (!fsc || !fc || !fp)
+      continue;
+    nrows++;
+    std::string nc = std::string(cis) + "/" + uarch_names[row];
+    std::string np = std::string(polar) + "/" + uarch_names[row];
+
+    for (int n : Lengths()) {
+      std::vector<T> theta = Inputs<T>(n, T(-100), T(100), n);
+      std::vector<T> r = Inputs<T>(n, T(-10), T(10), n + 1000);
+      std::vector<T> s(n), c(n), ref(2 * n), out(2 * n + 2, T(-7));
+
+      /* vrda_sincos plus interleaving */
+      fsc(n, theta.data(), s.data(), c.data());
+      for (int i = 0; i < n; i++) {
+        ref[2 * i] = c[i];
+        ref[2 * i + 1] = s[i];
+      }
+      fc(n, theta.data(), (typename Cis<T>::cplx *)out.data());
+      Compare<T>(nc.c_str(), n, theta, ref, out);
+
+      for (int i = 0; i < n; i++) {
+        ref[2 * i] = r[i] * c[i];
+        ref[2 * i + 1] = r[i] * s[i];
+      }
+      std::fill(out.begin(), out.end(), T(-7));
+      fp(n, r.data(), theta.data(), (typename Cis<T>::cplx *)out.data());
+      Compare<T>(np.c_str(), n, theta, ref, out);
+    }
+  }
+  EXPECT_GT(nrows, 0) << cis << " has no array kernel";
+}
+
+TEST(CIS, BITWISE_DOUBLE) { CheckCis<double>("cis", "polar"); }
+
+TEST(CIS, BITWISE_FLOAT) { CheckCis<float>("cis", "polar"); }
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_CLOG_DATA_H__
+#define __TEST_CLOG_DATA_H__
+
+extern "C"
+{
+    #if defined(_WIN64) || defined(_WIN32)
+        #include "complex.h"
+    #else
+        #include "/usr/include/complex.h"
+    #endif
+}
+
+#include <cmath>
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <external/amdlibm.h>
+
+/*
+ * C99 Annex G special values for clogf(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f32
+test_clogf_conformance_data[] = {
+    {{0.0f, 0.0f}, {-INFINITY, 0.0f}, FE_DIVBYZERO},
+    {{0.0f, -0.0f}, {-INFINITY, -0.0f}, FE_DIVBYZERO},
+    {{0.0f, 0x1p-140f}, {-0x1.842994p+6f, 0x1.921fb6p+0f}, 0},
+    {{0.0f, 0x1.8p+0f}, {0x1.9f323ep-2f, 0x1.921fb6p+0f}, 0},
+    {{0.0f, -0x1.8p+0f}, {0x1.9f323ep-2f, -0x1.921fb6p+0f}, 0},
+    {{0.0f, 0x1.66p+6f}, {0x1.1fa19cp+2f, 0x1.921fb6p+0f}, 0},
+    {{0.0f, INFINITY}, {INFINITY, 0x1.921fb6p+0f}, 0},
+    {{0.0f, -INFINITY}, {INFINITY, -0x1.921fb6p+0f}, 0},
+    {{0.0f, NAN}, {NAN, NAN}, 0},
+    {{-0.0f, 0.0f}, {-INFINITY, 0x1.921fb6p+1f}, FE_DIVBYZERO},
+    {{-0.0f, -0.0f}, {-INFINITY, -0x1.921fb6p+1f}, FE_DIVBYZERO},
+    {{-0.0f, 0x1p-140f}, {-0x1.842994p+6f, 0x1.921fb6p+0f}, 0},
+    {{-0.0f, 0x1.8p+0f}, {0x1.9f323ep-2f, 0x1.921fb6p+0f}, 0},
+    {{-0.0f, -0x1.8p+0f}, {0x1.9f323ep-2f, -0x1.921fb6p+0f}, 0},
+    {{-0.0f, 0x1.66p+6f}, {0x1.1fa19cp+2f, 0x1.921fb6p+0f}, 0},
+    {{-0.0f, INFINITY}, {INFINITY, 0x1.921fb6p+0f}, 0},
+    {{-0.0f, -INFINITY}, {INFINITY, -0x1.921fb6p+0f}, 0},
+    {{-0.0f, NAN}, {NAN, NAN}, 0},
+    {{0x1p-140f, 0.0f}, {-0x1.842994p+6f, 0.0f}, 0},
+    {{0x1p-140f, -0.0f}, {-0x1.842994p+6f, -0.0f}, 0},
+    {{0x1p-140f, 0x1p-140f}, {-0x1.82c6bp+6f, 0x1.921fb6p-1f}, 0},
+    {{0x1p-140f, 0x1.8p+0f}, {0x1.9f323ep-2f, 0x1.921fb6p+0f}, 0},
+    {{0x1p-140f, -0x1.8p+0f}, {0x1.9f323ep-2f, -0x1.921fb6p+0f}, 0},
+    {{0x1p-140f, 0x1.66p+6f}, {0x1.1fa19cp+2f, 0x1.921fb6p+0f}, 0},
+    {{0x1p-140f, INFINITY}, {INFINITY, 0x1.921fb6p+0f}, 0},
+    {{0x1p-140f, -INFINITY}, {INFINITY, -0x1.921fb6p+0f}, 0},
+    {{0x1p-140f, NAN}, {NAN, NAN}, 0},
+    {{0x1.8p+0f, 0.0f}, {0x1.9f323ep-2f, 0.0f}, 0},
+    {{0x1.8p+0f, -0.0f}, {0x1.9f323ep-2f, -0.0f}, 0},
+    {{0x1.8p+0f, 0x1p-140f}, {0x1.9f323ep-2f, 0x1.55p-141f}, FE_UNDERFLOW},
+    {{0x1.8p+0f, 0x1.8p+0f}, {0x1.810b36p-1f, 0x1.921fb6p-1f}, 0},
+    {{0x1.8p+0f, -0x1.8p+0f}, {0x1.810b36p-1f, -0x1.921fb6p-1f}, 0},
+    {{0x1.8p+0f, 0x1.66p+6f}, {0x1.1fa3e8p+2f, 0x1.8dd572p+0f}, 0},
+    {{0x1.8p+0f, INFINITY}, {INFINITY, 0x1.921fb6p+0f}, 0},
+    {{0x1.8p+0f, -INFINITY}, {INFINITY, -0x1.921fb6p+0f}, 0},
+    {{0x1.8p+0f, NAN}, {NAN, NAN}, 0},
+    {{-0x1.8p+0f, 0.0f}, {0x1.9f323ep-2f, 0x1.921fb6p+1f}, 0},
+    {{-0x1.8p+0f, -0.0f}, {0x1.9f323ep-2f, -0x1.921fb6p+1f}, 0},
+    {{-0x1.8p+0f, 0x1p-140f}, {0x1.9f323ep-2f, 0x1.921fb6p+1f}, 0},
+    {{-0x1.8p+0f, 0x1.8p+0f}, {0x1.810b36p-1f, 0x1.2d97c8p+1f}, 0},
+    {{-0x1.8p+0f, -0x1.8p+0f}, {0x1.810b36p-1f, -0x1.2d97c8p+1f}, 0},
+    {{-0x1.8p+0f, 0x1.66p+6f}, {0x1.1fa3e8p+2f, 0x1.9669f8p+0f}, 0},
+    {{-0x1.8p+0f, INFINITY}, {INFINITY, 0x1.921fb6p+0f}, 0},
+    {{-0x1.8p+0f, -INFINITY}, {INFINITY, -0x1.921fb6p+0f}, 0},
+    {{-0x1.8p+0f, NAN}, {NAN, NAN}, 0},
+    {{0x1.66p+6f, 0.0f}, {0x1.1fa19cp+2f, 0.0f}, 0},
+    {{0x1.66p+6f, -0.0f}, {0x1.1fa19cp+2f, -0.0f}, 0},
+    {{0x1.66p+6f, 0x1p-140f}, {0x1.1fa19cp+2f, 0x1.8p-147f}, FE_UNDERFLOW},
+    {{0x1.66p+6f, 0x1.8p+0f}, {0x1.1fa3e8p+2f, 0x1.129106p-6f}, 0},
+    {{0x1.66p+6f, -0x1.8p+0f}, {0x1.1fa3e8p+2f, -0x1.129106p-6f}, 0},
+    {{0x1.66p+6f, 0x1.66p+6f}, {0x1.35cfdep+2f, 0x1.921fb6p-1f}, 0},
+    {{0x1.66p+6f, INFINITY}, {INFINITY, 0x1.921fb6p+0f}, 0},
+    {{0x1.66p+6f, -INFINITY}, {INFINITY, -0x1.921fb6p+0f}, 0},
+    {{0x1.66p+6f, NAN}, {NAN, NAN}, 0},
+    {{INFINITY, 0.0f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, -0.0f}, {INFINITY, -0.0f}, 0},
+    {{INFINITY, 0x1p-140f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, 0x1.8p+0f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, -0x1.8p+0f}, {INFINITY, -0.0f}, 0},
+    {{INFINITY, 0x1.66p+6f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, INFINITY}, {INFINITY, 0x1.921fb6p-1f}, 0},
+    {{INFINITY, -INFINITY}, {INFINITY, -0x1.921fb6p-1f}, 0},
+    {{INFINITY, NAN}, {INFINITY, NAN}, 0},
+    {{-INFINITY, 0.0f}, {INFINITY, 0x1.921fb6p+1f}, 0},
+    {{-INFINITY, -0.0f}, {INFINITY, -0x1.921fb6p+1f}, 0},
+    {{-INFINITY, 0x1p-140f}, {INFINITY, 0x1.921fb6p+1f}, 0},
+    {{-INFINITY, 0x1.8p+0f}, {INFINITY, 0x1.921fb6p+1f}, 0},
+    {{-INFINITY, -0x1.8p+0f}, {INFINITY, -0x1.921fb6p+1f}, 0},
+    {{-INFINITY, 0x1.66p+6f}, {INFINITY, 0x1.921fb6p+1f}, 0},
+    {{-INFINITY, INFINITY}, {INFINITY, 0x1.2d97c8p+1f}, 0},
+    {{-INFINITY, -INFINITY}, {INFINITY, -0x1.2d97c8p+1f}, 0},
+    {{-INFINITY, NAN}, {INFINITY, NAN}, 0},
+    {{NAN, 0.0f}, {NAN, NAN}, 0},
+    {{NAN, -0.0f}, {NAN, NAN}, 0},
+    {{NAN, 0x1p-140f}, {NAN, NAN}, 0},
+    {{NAN, 0x1.8p+0f}, {NAN, NAN}, 0},
+    {{NAN, -0x1.8p+0f}, {NAN, NAN}, 0},
+    {{NAN, 0x1.66p+6f}, {NAN, NAN}, 0},
+    {{NAN, INFINITY}, {INFINITY, NAN}, 0},
+    {{NAN, -INFINITY}, {INFINITY, NAN}, 0},
+    {{NAN, NAN}, {NAN, NAN}, 0},
+};
+
+/*
+ * C99 Annex G special values for clog(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f64
+test_clog_conformance_data[] = {
+    {{0.0, 0.0}, {-INFINITY, 0.0}, FE_DIVBYZERO},
+    {{0.0, -0.0}, {-INFINITY, -0.0}, FE_DIVBYZERO},
+    {{0.0, 0x0.000000000001p-1022}, {-0x1.72d57016e778ap+9, 0x1.921fb54442d18p+0}, 0},
+    {{0.0, 0x1.8p+0}, {0x1.9f323ecbf984cp-2, 0x1.921fb54442d18p+0}, 0},
+    {{0.0, -0x1.8p+0}, {0x1.9f323ecbf984cp-2, -0x1.921fb54442d18p+0}, 0},
+    {{0.0, 0x1.634p+9}, {0x1.a438d5d20e4fdp+2, 0x1.921fb54442d18p+0}, 0},
+    {{0.0, INFINITY}, {INFINITY, 0x1.921fb54442d18p+0}, 0},
+    {{0.0, -INFINITY}, {INFINITY, -0x1.921fb54442d18p+0}, 0},
+    {{0.0, NAN}, {NAN, NAN}, 0},
+    {{-0.0, 0.0}, {-INFINITY, 0x1.921fb54442d18p+1}, FE_DIVBYZERO},
+    {{-0.0, -0.0}, {-INFINITY, -0x1.921fb54442d18p+1}, FE_DIVBYZERO},
+    {{-0.0, 0x0.000000000001p-1022}, {-0x1.72d57016e778ap+9, 0x1.921fb54442d18p+0}, 0},
+    {{-0.0, 0x1.8p+0}, {0x1.9f323ecbf984cp-2, 0x1.921fb54442d18p+0}, 0},
+    {{-0.0, -0x1.8p+0}, {0x1.9f323ecbf984cp-2, -0x1.921fb54442d18p+0}, 0},
+    {{-0.0, 0x1.634p+9}, {0x1.a438d5d20e4fdp+2, 0x1.921fb54442d18p+0}, 0},
+    {{-0.0, INFINITY}, {INFINITY, 0x1.921fb54442d18p+0}, 0},
+    {{-0.0, -INFINITY}, {INFINITY, -0x1.921fb54442d18p+0}, 0},
+    {{-0.0, NAN}, {NAN, NAN}, 0},
+    {{0x0.000000000001p-1022, 0.0}, {-0x1.72d57016e778ap+9, 0.0}, 0},
+    {{0x0.000000000001p-1022, -0.0}, {-0x1.72d57016e778ap+9, -0.0}, 0},
+    {{0x0.000000000001p-1022, 0x0.000000000001p-1022}, {-0x1.72a91390e9843p+9, 0x1.921fb54442d18p-1}, 0},
+    {{0x0.000000000001p-1022, 0x1.8p+0}, {0x1.9f323ecbf984cp-2, 0x1.921fb54442d18p+0}, 0},
+    {{0x0.000000000001p-1022, -0x1.8p+0}, {0x1.9f323ecbf984cp-2, -0x1.921fb54442d18p+0}, 0},
+    {{0x0.000000000001p-1022, 0x1.634p+9}, {0x1.a438d5d20e4fdp+2, 0x1.921fb54442d18p+0}, 0},
+    {{0x0.000000000001p-1022, INFINITY}, {INFINITY, 0x1.921fb54442d18p+0}, 0},
+    {{0x0.000000000001p-1022, -INFINITY}, {INFINITY, -0x1.921fb54442d18p+0}, 0},
+    {{0x0.000000000001p-1022, NAN}, {NAN, NAN}, 0},
+    {{0x1.8p+0, 0.0}, {0x1.9f323ecbf984cp-2, 0.0}, 0},
+    {{0x1.8p+0, -0.0}, {0x1.9f323ecbf984cp-2, -0.0}, 0},
+    {{0x1.8p+0, 0x0.000000000001p-1022}, {0x1.9f323ecbf984cp-2, 0x0.000000000000bp-1022}, FE_UNDERFLOW},
+    {{0x1.8p+0, 0x1.8p+0}, {0x1.810b375dce91dp-1, 0x1.921fb54442d18p-1}, 0},
+    {{0x1.8p+0, -0x1.8p+0}, {0x1.810b375dce91dp-1, -0x1.921fb54442d18p-1}, 0},
+    {{0x1.8p+0, 0x1.634p+9}, {0x1.a438df2af2e48p+2, 0x1.91955970b81fap+0}, 0},
+    {{0x1.8p+0, INFINITY}, {INFINITY, 0x1.921fb54442d18p+0}, 0},
+    {{0x1.8p+0, -INFINITY}, {INFINITY, -0x1.921fb54442d18p+0}, 0},
+    {{0x1.8p+0, NAN}, {NAN, NAN}, 0},
+    {{-0x1.8p+0, 0.0}, {0x1.9f323ecbf984cp-2, 0x1.921fb54442d18p+1}, 0},
+    {{-0x1.8p+0, -0.0}, {0x1.9f323ecbf984cp-2, -0x1.921fb54442d18p+1}, 0},
+    {{-0x1.8p+0, 0x0.000000000001p-1022}, {0x1.9f323ecbf984cp-2, 0x1.921fb54442d18p+1}, 0},
+    {{-0x1.8p+0, 0x1.8p+0}, {0x1.810b375dce91dp-1, 0x1.2d97c7f3321d2p+1}, 0},
+    {{-0x1.8p+0, -0x1.8p+0}, {0x1.810b375dce91dp-1, -0x1.2d97c7f3321d2p+1}, 0},
+    {{-0x1.8p+0, 0x1.634p+9}, {0x1.a438df2af2e48p+2, 0x1.92aa1117cd837p+0}, 0},
+    {{-0x1.8p+0, INFINITY}, {INFINITY, 0x1.921fb54442d18p+0}, 0},
+    {{-0x1.8p+0, -INFINITY}, {INFINITY, -0x1.921fb54442d18p+0}, 0},
+    {{-0x1.8p+0, NAN}, {NAN, NAN}, 0},
+    {{0x1.634p+9, 0.0}, {0x1.a438d5d20e4fdp+2, 0.0}, 0},
+    {{0x1.634p+9, -0.0}, {0x1.a438d5d20e4fdp+2, -0.0}, 0},
+    {{0x1.634p+9, 0x0.000000000001p-1022}, {0x1.a438d5d20e4fdp+2, 0.0}, FE_UNDERFLOW},
+    {{0x1.634p+9, 0x1.8p+0}, {0x1.a438df2af2e48p+2, 0x1.14b7a71563d1cp-9}, 0},
+    {{0x1.634p+9, -0x1.8p+0}, {0x1.a438df2af2e48p+2, -0x1.14b7a71563d1cp-9}, 0},
+    {{0x1.634p+9, 0x1.634p+9}, {0x1.ba6718d10889cp+2, 0x1.921fb54442d18p-1}, 0},
+    {{0x1.634p+9, INFINITY}, {INFINITY, 0x1.921fb54442d18p+0}, 0},
+    {{0x1.634p+9, -INFINITY}, {INFINITY, -0x1.921fb54442d18p+0}, 0},
+    {{0x1.634p+9, NAN}, {NAN, NAN}, 0},
+    {{INFINITY, 0.0}, {INFINITY, 0.0}, 0},
+    {{INFINITY, -0.0}, {INFINITY, -0.0}, 0},
+    {{INFINITY, 0x0.000000000001p-1022}, {INFINITY, 0.0}, 0},
+    {{INFINITY, 0x1.8p+0}, {INFINITY, 0.0}, 0},
+    {{INFINITY, -0x1.8p+0}, {INFINITY, -0.0}, 0},
+    {{INFINITY, 0x1.634p+9}, {INFINITY, 0.0}, 0},
+    {{INFINITY, INFINITY}, {INFINITY, 0x1.921fb54442d18p-1}, 0},
+    {{INFINITY, -INFINITY}, {INFINITY, -0x1.921fb54442d18p-1}, 0},
+    {{INFINITY, NAN}, {INFINITY, NAN}, 0},
+    {{-INFINITY, 0.0}, {INFINITY, 0x1.921fb54442d18p+1}, 0},
+    {{-INFINITY, -0.0}, {INFINITY, -0x1.921fb54442d18p+1}, 0},
+    {{-INFINITY, 0x0.000000000001p-1022}, {INFINITY, 0x1.921fb54442d18p+1}, 0},
+    {{-INFINITY, 0x1.8p+0}, {INFINITY, 0x1.921fb54442d18p+1}, 0},
+    {{-INFINITY, -0x1.8p+0}, {INFINITY, -0x1.921fb54442d18p+1}, 0},
+    {{-INFINITY, 0x1.634p+9}, {INFINITY, 0x1.921fb54442d18p+1}, 0},
+    {{-INFINITY, INFINITY}, {INFINITY, 0x1.2d97c7f3321d2p+1}, 0},
+    {{-INFINITY, -INFINITY}, {INFINITY, -0x1.2d97c7f3321d2p+1}, 0},
+    {{-INFINITY, NAN}, {INFINITY, NAN}, 0},
+    {{NAN, 0.0}, {NAN, NAN}, 0},
+    {{NAN, -0.0}, {NAN, NAN}, 0},
+    {{NAN, 0x0.000000000001p-1022}, {NAN, NAN}, 0},
+    {{NAN, 0x1.8p+0}, {NAN, NAN}, 0},
+    {{NAN, -0x1.8p+0}, {NAN, NAN}, 0},
+    {{NAN, 0x1.634p+9}, {NAN, NAN}, 0},
+    {{NAN, INFINITY}, {INFINITY, NAN}, 0},
+    {{NAN, -INFINITY}, {INFINITY, NAN}, 0},
+    {{NAN, NAN}, {NAN, NAN}, 0},
+};
+
+#endif	/*__TEST_CLOG_DATA_H__*/
@@ -60,6 +60,8 @@ void RangeReader::operator()(const std::string &name, const std::string &value,
       dest.r_type = RangeType::E_Linear;
     else if (dist == "random")
       dest.r_type = RangeType::E_Random;
+    else if (dist == "special")
+      dest.r_type = RangeType::E_Special;
     else
       dest.r_type = RangeType::E_Simple;
   }
@@ -94,11 +96,12 @@ cmdLine::cmdLine() : arguments(NULL) {
       {"spec", TestType::E_SpecialCase},
       {"conf", TestType::E_Conformance},
       {"perf", TestType::E_Performance},
+      {"lat", TestType::E_Latency},
   };
 
   cmd.testtype = new args::MapFlag<std::string, TestType, ToLowerReader>(
       *cmd.parser, "type",
-      "TestType <type> = [accu, spec, conf, perf]",
+      "TestType <type> = [accu, spec, conf, perf, lat]",
       {'t', "type"}, test_map);
 
   cmd.Iterations = new args::ValueFlag<uint64_t>(
@@ -148,6 +151,24 @@ cmdLine::cmdLine() : arguments(NULL) {
   cmd.verbose = new args::ValueFlag<uint32_t>(*cmd.arguments, "verbose",
                                       "Increase verbosity", {'v', "verbose"});
 
+  cmd.savebaseline = new args::ValueFlag<std::string>(
+      *cmd.arguments, "file",
+      "Save median and MAD of each perf/lat benchmark to a baseline file",
+      {"save-baseline"});
+
+  cmd.comparebaseline = new args::ValueFlag<std::string>(
+      *cmd.arguments, "file",
+      "Compare perf/lat with a baseline file, exit with failure on a regression",
+      {"compare-baseline"});
+
+  cmd.repetitions = new args::ValueFlag<uint32_t>(
+      *cmd.arguments, "repetitions",
+      "Runs of each benchmark for a baseline (default 5)", {"repetitions"});
+
+  cmd.threshold = new args::ValueFlag<double>(
+      *cmd.arguments, "percent",
+      "Change a regression must exceed (default 5)", {"threshold"});
+
   help =
       new args::HelpFlag(*parser, "help", "Display this help", {'h', "help"});
 }
@@ -229,6 +250,32 @@ bool cmdLine::Echo(InputParams *inparams) {
       }
   }
 
+  if (*savebaseline) {
+    std::cout << "Save Baseline   : " << args::get(*savebaseline) << std::endl;
+    inparams->saveBaseline = args::get(*savebaseline);
+  }
+
+  if (*comparebaseline) {
+    std::cout << "Compare Baseline: " << args::get(*comparebaseline)
+              << std::endl;
+    inparams->compareBaseline = args::get(*comparebaseline);
+  }
+
+  inparams->repetitions = *repetitions ? args::get(*repetitions) : 5;
+  inparams->threshold = *threshold ? args::get(*threshold) : 5.0;
+  if (*savebaseline || *comparebaseline) {
+    if (inparams->ttype != ALM::TestType::E_Performance &&
+        inparams->ttype != ALM::TestType::E_Latency) {
+      cout << "Baselines are for --type=perf or lat" << endl;
+      return 1;
+    }
+    if (inparams->repetitions < 3) {
+      cout << "A baseline needs --repetitions=3 or more" << endl;
+      return 1;
+    }
+    std::cout << "Repetitions     : " << inparams->repetitions << std::endl;
+  }
+
   if (*count) {
     std::cout << "No. of Samples  : " << args::get(*count) << std::endl;
     inparams->count = args::get(*count);
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_CPOW_DATA_H__
+#define __TEST_CPOW_DATA_H__
+
+extern "C"
+{
+    #if defined(_WIN64) || defined(_WIN32)
+        #include "complex.h"
+    #else
+        #include "/usr/include/complex.h"
+    #endif
+}
+
+#include <cmath>
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <external/amdlibm.h>
+
+/*
+ * C99 Annex G special values for cpowf(), x from the special values below and real exponents y:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ * cpow is not covered by Annex G, 0^0, 0^y for y < 0 and powers of inf
+ * are left out, and 0^y for y > 0 is +0 + 0i as the kernels document.
+ */
+static libm_test_complex_data_f32
+test_cpowf_conformance_data[] = {
+    {{0.0f, 0.0f}, {0.0f, 0.0f}, FE_INVALID | FE_DIVBYZERO, {0x1p+1f, 0.0f}}, /* +0 + 0i for any sign of x */
+    {{0.0f, 0.0f}, {0.0f, 0.0f}, FE_INVALID | FE_DIVBYZERO, {0x1p-1f, 0.0f}}, /* +0 + 0i for any sign of x */
+    {{0.0f, 0.0f}, {NAN, NAN}, FE_INVALID | FE_DIVBYZERO, {NAN, 0.0f}},
+    {{-0.0f, 0.0f}, {0.0f, 0.0f}, FE_INVALID | FE_DIVBYZERO, {0x1p+1f, 0.0f}}, /* +0 + 0i for any sign of x */
+    {{-0.0f, 0.0f}, {0.0f, 0.0f}, FE_INVALID | FE_DIVBYZERO, {0x1p-1f, 0.0f}}, /* +0 + 0i for any sign of x */
+    {{-0.0f, 0.0f}, {NAN, NAN}, FE_INVALID | FE_DIVBYZERO, {NAN, 0.0f}},
+    {{0x1p-140f, 0.0f}, {0x1p+0f, 0.0f}, 0, {0.0f, 0.0f}},
+    {{0x1p-140f, 0.0f}, {0.0f, 0.0f}, FE_UNDERFLOW, {0x1p+1f, 0.0f}},
+    {{0x1p-140f, 0.0f}, {0x1.00000ep-70f, 0.0f}, 0, {0x1p-1f, 0.0f}},
+    {{0x1p-140f, 0.0f}, {INFINITY, -0.0f}, FE_OVERFLOW, {-0x1p+0f, 0.0f}},
+    {{0x1p-140f, 0.0f}, {NAN, NAN}, 0, {NAN, 0.0f}},
+    {{0x1.8p+0f, 0.0f}, {0x1p+0f, 0.0f}, 0, {0.0f, 0.0f}},
+    {{0x1.8p+0f, 0.0f}, {0x1.2p+1f, 0.0f}, 0, {0x1p+1f, 0.0f}},
+    {{0x1.8p+0f, 0.0f}, {0x1.3988e2p+0f, 0.0f}, 0, {0x1p-1f, 0.0f}},
+    {{0x1.8p+0f, 0.0f}, {0x1.555556p-1f, 0.0f}, 0, {-0x1p+0f, 0.0f}},
+    {{0x1.8p+0f, 0.0f}, {NAN, NAN}, 0, {NAN, 0.0f}},
+    {{-0x1.8p+0f, 0.0f}, {0x1p+0f, 0.0f}, 0, {0.0f, 0.0f}},
+    {{-0x1.8p+0f, 0.0f}, {0x1.2p+1f, 0x1.a669a8p-22f}, 0, {0x1p+1f, 0.0f}},
+    {{-0x1.8p+0f, 0.0f}, {-0x1.cbdd5ep-25f, 0x1.3988e2p+0f}, 0, {0x1p-1f, 0.0f}},
+    {{-0x1.8p+0f, 0.0f}, {-0x1.555556p-1f, 0x1.f4a326p-25f}, 0, {-0x1p+0f, 0.0f}},
+    {{-0x1.8p+0f, 0.0f}, {NAN, NAN}, 0, {NAN, 0.0f}},
+    {{0x1.66p+6f, 0.0f}, {0x1p+0f, 0.0f}, 0, {0.0f, 0.0f}},
+    {{0x1.66p+6f, 0.0f}, {0x1.f4a40ep+12f, 0.0f}, 0, {0x1p+1f, 0.0f}},
+    {{0x1.66p+6f, 0.0f}, {0x1.2ebbf8p+3f, 0.0f}, 0, {0x1p-1f, 0.0f}},
+    {{0x1.66p+6f, 0.0f}, {0x1.6e1f72p-7f, 0.0f}, 0, {-0x1p+0f, 0.0f}},
+    {{0x1.66p+6f, 0.0f}, {NAN, NAN}, 0, {NAN, 0.0f}},
+    {{INFINITY, 0.0f}, {NAN, NAN}, FE_INVALID, {NAN, 0.0f}},
+    {{-INFINITY, 0.0f}, {NAN, NAN}, FE_INVALID, {NAN, 0.0f}},
+    {{NAN, 0.0f}, {NAN, NAN}, 0, {0.0f, 0.0f}},
+    {{NAN, 0.0f}, {NAN, NAN}, 0, {0x1p+1f, 0.0f}},
+    {{NAN, 0.0f}, {NAN, NAN}, 0, {0x1p-1f, 0.0f}},
+    {{NAN, 0.0f}, {NAN, NAN}, 0, {-0x1p+0f, 0.0f}},
+    {{NAN, 0.0f}, {NAN, NAN}, 0, {NAN, 0.0f}},
+};
+
+/*
+ * C99 Annex G special values for cpow(), x from the special values below and real exponents y:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ * cpow is not covered by Annex G, 0^0, 0^y for y < 0 and powers of inf
+ * are left out, and 0^y for y > 0 is +0 + 0i as the kernels document.
+ */
+static libm_test_complex_data_f64
+test_cpow_conformance_data[] = {
+    {{0.0, 0.0}, {0.0, 0.0}, FE_INVALID | FE_DIVBYZERO, {0x1p+1, 0.0}}, /* +0 + 0i for any sign of x */
+    {{0.0, 0.0}, {0.0, 0.0}, FE_INVALID | FE_DIVBYZERO, {0x1p-1, 0.0}}, /* +0 + 0i for any sign of x */
+    {{0.0, 0.0}, {NAN, NAN}, FE_INVALID | FE_DIVBYZERO, {NAN, 0.0}},
+    {{-0.0, 0.0}, {0.0, 0.0}, FE_INVALID | FE_DIVBYZERO, {0x1p+1, 0.0}}, /* +0 + 0i for any sign of x */
+    {{-0.0, 0.0}, {0.0, 0.0}, FE_INVALID | FE_DIVBYZERO, {0x1p-1, 0.0}}, /* +0 + 0i for any sign of x */
+    {{-0.0, 0.0}, {NAN, NAN}, FE_INVALID | FE_DIVBYZERO, {NAN, 0.0}},
+    {{0x0.000000000001p-1022, 0.0}, {0x1p+0, 0.0}, 0, {0.0, 0.0}},
+    {{0x0.000000000001p-1022, 0.0}, {0.0, 0.0}, FE_UNDERFLOW, {0x1p+1, 0.0}},
+    {{0x0.000000000001p-1022, 0.0}, {0x1.ffffffffffee9p-536, 0.0}, 0, {0x1p-1, 0.0}},
+    {{0x0.000000000001p-1022, 0.0}, {INFINITY, -0.0}, FE_OVERFLOW, {-0x1p+0, 0.0}},
+    {{0x0.000000000001p-1022, 0.0}, {NAN, NAN}, 0, {NAN, 0.0}},
+    {{0x1.8p+0, 0.0}, {0x1p+0, 0.0}, 0, {0.0, 0.0}},
+    {{0x1.8p+0, 0.0}, {0x1.2p+1, 0.0}, 0, {0x1p+1, 0.0}},
+    {{0x1.8p+0, 0.0}, {0x1.3988e1409212ep+0, 0.0}, 0, {0x1p-1, 0.0}},
+    {{0x1.8p+0, 0.0}, {0x1.5555555555555p-1, 0.0}, 0, {-0x1p+0, 0.0}},
+    {{0x1.8p+0, 0.0}, {NAN, NAN}, 0, {NAN, 0.0}},
+    {{-0x1.8p+0, 0.0}, {0x1p+0, 0.0}, 0, {0.0, 0.0}},
+    {{-0x1.8p+0, 0.0}, {0x1.2p+1, -0x1.3daeaf976e788p-51}, 0, {0x1p+1, 0.0}},
+    {{-0x1.8p+0, 0.0}, {0x1.59d94803a35d6p-54, 0x1.3988e1409212ep+0}, 0, {0x1p-1, 0.0}},
+    {{-0x1.8p+0, 0.0}, {-0x1.5555555555555p-1, -0x1.78832eec5d009p-54}, 0, {-0x1p+0, 0.0}},
+    {{-0x1.8p+0, 0.0}, {NAN, NAN}, 0, {NAN, 0.0}},
+    {{0x1.634p+9, 0.0}, {0x1p+0, 0.0}, 0, {0.0, 0.0}},
+    {{0x1.634p+9, 0.0}, {0x1.ecfa8fffffffep+18, 0.0}, 0, {0x1p+1, 0.0}},
+    {{0x1.634p+9, 0.0}, {0x1.aa7bb926a0be1p+4, 0.0}, 0, {0x1p-1, 0.0}},
+    {{0x1.634p+9, 0.0}, {0x1.70f502b3cb652p-10, 0.0}, 0, {-0x1p+0, 0.0}},
+    {{0x1.634p+9, 0.0}, {NAN, NAN}, 0, {NAN, 0.0}},
+    {{INFINITY, 0.0}, {NAN, NAN}, FE_INVALID, {NAN, 0.0}},
+    {{-INFINITY, 0.0}, {NAN, NAN}, FE_INVALID, {NAN, 0.0}},
+    {{NAN, 0.0}, {NAN, NAN}, 0, {0.0, 0.0}},
+    {{NAN, 0.0}, {NAN, NAN}, 0, {0x1p+1, 0.0}},
+    {{NAN, 0.0}, {NAN, NAN}, 0, {0x1p-1, 0.0}},
+    {{NAN, 0.0}, {NAN, NAN}, 0, {-0x1p+0, 0.0}},
+    {{NAN, 0.0}, {NAN, NAN}, 0, {NAN, 0.0}},
+};
+
+#endif	/*__TEST_CPOW_DATA_H__*/
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_CSIN_DATA_H__
+#define __TEST_CSIN_DATA_H__
+
+extern "C"
+{
+    #if defined(_WIN64) || defined(_WIN32)
+        #include "complex.h"
+    #else
+        #include "/usr/include/complex.h"
+    #endif
+}
+
+#include <cmath>
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <external/amdlibm.h>
+
+/*
+ * C99 Annex G special values for csinf(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f32
+test_csinf_conformance_data[] = {
+    {{0.0f, 0.0f}, {0.0f, 0.0f}, 0},
+    {{0.0f, -0.0f}, {0.0f, -0.0f}, 0},
+    {{0.0f, 0x1p-140f}, {0.0f, 0x1p-140f}, FE_UNDERFLOW},
+    {{0.0f, 0x1.8p+0f}, {0.0f, 0x1.108c3ap+1f}, 0},
+    {{0.0f, -0x1.8p+0f}, {0.0f, -0x1.108c3ap+1f}, 0},
+    {{0.0f, 0x1.66p+6f}, {0.0f, INFINITY}, FE_OVERFLOW},
+    {{0.0f, INFINITY}, {0.0f, INFINITY}, 0},
+    {{0.0f, -INFINITY}, {0.0f, -INFINITY}, 0},
+    {{0.0f, NAN}, {0.0f, NAN}, 0},
+    {{-0.0f, 0.0f}, {-0.0f, 0.0f}, 0},
+    {{-0.0f, -0.0f}, {-0.0f, -0.0f}, 0},
+    {{-0.0f, 0x1p-140f}, {-0.0f, 0x1p-140f}, FE_UNDERFLOW},
+    {{-0.0f, 0x1.8p+0f}, {-0.0f, 0x1.108c3ap+1f}, 0},
+    {{-0.0f, -0x1.8p+0f}, {-0.0f, -0x1.108c3ap+1f}, 0},
+    {{-0.0f, 0x1.66p+6f}, {-0.0f, INFINITY}, FE_OVERFLOW},
+    {{-0.0f, INFINITY}, {-0.0f, INFINITY}, 0},
+    {{-0.0f, -INFINITY}, {-0.0f, -INFINITY}, 0},
+    {{-0.0f, NAN}, {-0.0f, NAN}, 0},
+    {{0x1p-140f, 0.0f}, {0x1p-140f, 0.0f}, FE_UNDERFLOW},
+    {{0x1p-140f, -0.0f}, {0x1p-140f, -0.0f}, FE_UNDERFLOW},
+    {{0x1p-140f, 0x1p-140f}, {0x1p-140f, 0x1p-140f}, FE_UNDERFLOW},
+    {{0x1p-140f, 0x1.8p+0f}, {0x1.2dp-139f, 0x1.108c3ap+1f}, FE_UNDERFLOW},
+    {{0x1p-140f, -0x1.8p+0f}, {0x1.2dp-139f, -0x1.108c3ap+1f}, FE_UNDERFLOW},
+    {{0x1p-140f, 0x1.66p+6f}, {0x1.166fd2p-12f, INFINITY}, FE_OVERFLOW},
+    {{0x1p-140f, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x1p-140f, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x1p-140f, NAN}, {NAN, NAN}, 0},
+    {{0x1.8p+0f, 0.0f}, {0x1.feb7aap-1f, 0.0f}, 0},
+    {{0x1.8p+0f, -0.0f}, {0x1.feb7aap-1f, -0.0f}, 0},
+    {{0x1.8p+0f, 0x1p-140f}, {0x1.feb7aap-1f, 0x1.2p-144f}, FE_UNDERFLOW},
+    {{0x1.8p+0f, 0x1.8p+0f}, {0x1.2c5aaap+1f, 0x1.3477dep-3f}, 0},
+    {{0x1.8p+0f, -0x1.8p+0f}, {0x1.2c5aaap+1f, -0x1.3477dep-3f}, 0},
+    {{0x1.8p+0f, 0x1.66p+6f}, {INFINITY, 0x1.3b2228p+124f}, FE_OVERFLOW},
+    {{0x1.8p+0f, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x1.8p+0f, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x1.8p+0f, NAN}, {NAN, NAN}, 0},
+    {{-0x1.8p+0f, 0.0f}, {-0x1.feb7aap-1f, 0.0f}, 0},
+    {{-0x1.8p+0f, -0.0f}, {-0x1.feb7aap-1f, -0.0f}, 0},
+    {{-0x1.8p+0f, 0x1p-140f}, {-0x1.feb7aap-1f, 0x1.2p-144f}, FE_UNDERFLOW},
+    {{-0x1.8p+0f, 0x1.8p+0f}, {-0x1.2c5aaap+1f, 0x1.3477dep-3f}, 0},
+    {{-0x1.8p+0f, -0x1.8p+0f}, {-0x1.2c5aaap+1f, -0x1.3477dep-3f}, 0},
+    {{-0x1.8p+0f, 0x1.66p+6f}, {-INFINITY, 0x1.3b2228p+124f}, FE_OVERFLOW},
+    {{-0x1.8p+0f, INFINITY}, {-INFINITY, INFINITY}, 0},
+    {{-0x1.8p+0f, -INFINITY}, {-INFINITY, -INFINITY}, 0},
+    {{-0x1.8p+0f, NAN}, {NAN, NAN}, 0},
+    {{0x1.66p+6f, 0.0f}, {0x1.ffadecp-1f, 0.0f}, 0},
+    {{0x1.66p+6f, -0.0f}, {0x1.ffadecp-1f, -0.0f}, 0},
+    {{0x1.66p+6f, 0x1p-140f}, {0x1.ffadecp-1f, 0x1.2p-145f}, FE_UNDERFLOW},
+    {{0x1.66p+6f, 0x1.8p+0f}, {0x1.2ceb7cp+1f, 0x1.34988ep-4f}, 0},
+    {{0x1.66p+6f, -0x1.8p+0f}, {0x1.2ceb7cp+1f, -0x1.34988ep-4f}, 0},
+    {{0x1.66p+6f, 0x1.66p+6f}, {INFINITY, 0x1.3b438cp+123f}, FE_OVERFLOW},
+    {{0x1.66p+6f, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x1.66p+6f, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x1.66p+6f, NAN}, {NAN, NAN}, 0},
+    {{INFINITY, 0.0f}, {NAN, 0.0f}, FE_INVALID},
+    {{INFINITY, -0.0f}, {NAN, -0.0f}, FE_INVALID},
+    {{INFINITY, 0x1p-140f}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, 0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, -0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, 0x1.66p+6f}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, INFINITY}, {NAN, INFINITY}, FE_INVALID},
+    {{INFINITY, -INFINITY}, {NAN, INFINITY}, FE_INVALID},
+    {{INFINITY, NAN}, {NAN, NAN}, 0},
+    {{-INFINITY, 0.0f}, {NAN, 0.0f}, FE_INVALID},
+    {{-INFINITY, -0.0f}, {NAN, -0.0f}, FE_INVALID},
+    {{-INFINITY, 0x1p-140f}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, 0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, -0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, 0x1.66p+6f}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, INFINITY}, {NAN, INFINITY}, FE_INVALID},
+    {{-INFINITY, -INFINITY}, {NAN, INFINITY}, FE_INVALID},
+    {{-INFINITY, NAN}, {NAN, NAN}, 0},
+    {{NAN, 0.0f}, {NAN, 0.0f}, 0},
+    {{NAN, -0.0f}, {NAN, -0.0f}, 0},
+    {{NAN, 0x1p-140f}, {NAN, NAN}, FE_INVALID},
+    {{NAN, 0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{NAN, -0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{NAN, 0x1.66p+6f}, {NAN, NAN}, FE_INVALID},
+    {{NAN, INFINITY}, {NAN, INFINITY}, 0},
+    {{NAN, -INFINITY}, {NAN, INFINITY}, 0},
+    {{NAN, NAN}, {NAN, NAN}, 0},
+};
+
+/*
+ * C99 Annex G special values for csin(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f64
+test_csin_conformance_data[] = {
+    {{0.0, 0.0}, {0.0, 0.0}, 0},
+    {{0.0, -0.0}, {0.0, -0.0}, 0},
+    {{0.0, 0x0.000000000001p-1022}, {0.0, 0x0.000000000001p-1022}, FE_UNDERFLOW},
+    {{0.0, 0x1.8p+0}, {0.0, 0x1.108c3aabd6a6p+1}, 0},
+    {{0.0, -0x1.8p+0}, {0.0, -0x1.108c3aabd6a6p+1}, 0},
+    {{0.0, 0x1.634p+9}, {0.0, INFINITY}, FE_OVERFLOW},
+    {{0.0, INFINITY}, {0.0, INFINITY}, 0},
+    {{0.0, -INFINITY}, {0.0, -INFINITY}, 0},
+    {{0.0, NAN}, {0.0, NAN}, 0},
+    {{-0.0, 0.0}, {-0.0, 0.0}, 0},
+    {{-0.0, -0.0}, {-0.0, -0.0}, 0},
+    {{-0.0, 0x0.000000000001p-1022}, {-0.0, 0x0.000000000001p-1022}, FE_UNDERFLOW},
+    {{-0.0, 0x1.8p+0}, {-0.0, 0x1.108c3aabd6a6p+1}, 0},
+    {{-0.0, -0x1.8p+0}, {-0.0, -0x1.108c3aabd6a6p+1}, 0},
+    {{-0.0, 0x1.634p+9}, {-0.0, INFINITY}, FE_OVERFLOW},
+    {{-0.0, INFINITY}, {-0.0, INFINITY}, 0},
+    {{-0.0, -INFINITY}, {-0.0, -INFINITY}, 0},
+    {{-0.0, NAN}, {-0.0, NAN}, 0},
+    {{0x0.000000000001p-1022, 0.0}, {0x0.000000000001p-1022, 0.0}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, -0.0}, {0x0.000000000001p-1022, -0.0}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, 0x0.000000000001p-1022}, {0x0.000000000001p-1022, 0x0.000000000001p-1022}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, 0x1.8p+0}, {0x0.0000000000026p-1022, 0x1.108c3aabd6a6p+1}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, -0x1.8p+0}, {0x0.0000000000026p-1022, -0x1.108c3aabd6a6p+1}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, 0x1.634p+9}, {0x1.064148abcbe6fp-46, INFINITY}, FE_OVERFLOW},
+    {{0x0.000000000001p-1022, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x0.000000000001p-1022, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x0.000000000001p-1022, NAN}, {NAN, NAN}, 0},
+    {{0x1.8p+0, 0.0}, {0x1.feb7a9b2c6d8bp-1, 0.0}, 0},
+    {{0x1.8p+0, -0.0}, {0x1.feb7a9b2c6d8bp-1, -0.0}, 0},
+    {{0x1.8p+0, 0x0.000000000001p-1022}, {0x1.feb7a9b2c6d8bp-1, 0x0.0000000000001p-1022}, FE_UNDERFLOW},
+    {{0x1.8p+0, 0x1.8p+0}, {0x1.2c5aa994b2cfep+1, 0x1.3477e03e01417p-3}, 0},
+    {{0x1.8p+0, -0x1.8p+0}, {0x1.2c5aa994b2cfep+1, -0x1.3477e03e01417p-3}, 0},
+    {{0x1.8p+0, 0x1.634p+9}, {INFINITY, 0x1.28d1a84c8e118p+1020}, FE_OVERFLOW},
+    {{0x1.8p+0, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x1.8p+0, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x1.8p+0, NAN}, {NAN, NAN}, 0},
+    {{-0x1.8p+0, 0.0}, {-0x1.feb7a9b2c6d8bp-1, 0.0}, 0},
+    {{-0x1.8p+0, -0.0}, {-0x1.feb7a9b2c6d8bp-1, -0.0}, 0},
+    {{-0x1.8p+0, 0x0.000000000001p-1022}, {-0x1.feb7a9b2c6d8bp-1, 0x0.0000000000001p-1022}, FE_UNDERFLOW},
+    {{-0x1.8p+0, 0x1.8p+0}, {-0x1.2c5aa994b2cfep+1, 0x1.3477e03e01417p-3}, 0},
+    {{-0x1.8p+0, -0x1.8p+0}, {-0x1.2c5aa994b2cfep+1, -0x1.3477e03e01417p-3}, 0},
+    {{-0x1.8p+0, 0x1.634p+9}, {-INFINITY, 0x1.28d1a84c8e118p+1020}, FE_OVERFLOW},
+    {{-0x1.8p+0, INFINITY}, {-INFINITY, INFINITY}, 0},
+    {{-0x1.8p+0, -INFINITY}, {-INFINITY, -INFINITY}, 0},
+    {{-0x1.8p+0, NAN}, {NAN, NAN}, 0},
+    {{0x1.634p+9, 0.0}, {0x1.eafc65d3b2565p-2, 0.0}, 0},
+    {{0x1.634p+9, -0.0}, {0x1.eafc65d3b2565p-2, -0.0}, 0},
+    {{0x1.634p+9, 0x0.000000000001p-1022}, {0x1.eafc65d3b2565p-2, 0x0.000000000000ep-1022}, FE_UNDERFLOW},
+    {{0x1.634p+9, 0x1.8p+0}, {0x1.20c00052dafdap+0, 0x1.de59bfea0e2edp+0}, 0},
+    {{0x1.634p+9, -0x1.8p+0}, {0x1.20c00052dafdap+0, -0x1.de59bfea0e2edp+0}, 0},
+    {{0x1.634p+9, 0x1.634p+9}, {0x1.f6fb85acfd913p+1022, 0x1.cc49234bf085ep+1023}, 0},
+    {{0x1.634p+9, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x1.634p+9, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x1.634p+9, NAN}, {NAN, NAN}, 0},
+    {{INFINITY, 0.0}, {NAN, 0.0}, FE_INVALID},
+    {{INFINITY, -0.0}, {NAN, -0.0}, FE_INVALID},
+    {{INFINITY, 0x0.000000000001p-1022}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, 0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, -0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, 0x1.634p+9}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, INFINITY}, {NAN, INFINITY}, FE_INVALID},
+    {{INFINITY, -INFINITY}, {NAN, INFINITY}, FE_INVALID},
+    {{INFINITY, NAN}, {NAN, NAN}, 0},
+    {{-INFINITY, 0.0}, {NAN, 0.0}, FE_INVALID},
+    {{-INFINITY, -0.0}, {NAN, -0.0}, FE_INVALID},
+    {{-INFINITY, 0x0.000000000001p-1022}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, 0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, -0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, 0x1.634p+9}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, INFINITY}, {NAN, INFINITY}, FE_INVALID},
+    {{-INFINITY, -INFINITY}, {NAN, INFINITY}, FE_INVALID},
+    {{-INFINITY, NAN}, {NAN, NAN}, 0},
+    {{NAN, 0.0}, {NAN, 0.0}, 0},
+    {{NAN, -0.0}, {NAN, -0.0}, 0},
+    {{NAN, 0x0.000000000001p-1022}, {NAN, NAN}, FE_INVALID},
+    {{NAN, 0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{NAN, -0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{NAN, 0x1.634p+9}, {NAN, NAN}, FE_INVALID},
+    {{NAN, INFINITY}, {NAN, INFINITY}, 0},
+    {{NAN, -INFINITY}, {NAN, INFINITY}, 0},
+    {{NAN, NAN}, {NAN, NAN}, 0},
+};
+
+#endif	/*__TEST_CSIN_DATA_H__*/
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_CSQRT_DATA_H__
+#define __TEST_CSQRT_DATA_H__
+
+extern "C"
+{
+    #if defined(_WIN64) || defined(_WIN32)
+        #include "complex.h"
+    #else
+        #include "/usr/include/complex.h"
+    #endif
+}
+
+#include <cmath>
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <external/amdlibm.h>
+
+/*
+ * C99 Annex G special values for csqrtf(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f32
+test_csqrtf_conformance_data[] = {
+    {{0.0f, 0.0f}, {0.0f, 0.0f}, 0},
+    {{0.0f, -0.0f}, {0.0f, -0.0f}, 0},
+    {{0.0f, 0x1p-140f}, {0x1.6a09e6p-71f, 0x1.6a09e6p-71f}, 0},
+    {{0.0f, 0x1.8p+0f}, {0x1.bb67aep-1f, 0x1.bb67aep-1f}, 0},
+    {{0.0f, -0x1.8p+0f}, {0x1.bb67aep-1f, -0x1.bb67aep-1f}, 0},
+    {{0.0f, 0x1.66p+6f}, {0x1.ac217ep+2f, 0x1.ac217ep+2f}, 0},
+    {{0.0f, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0.0f, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0.0f, NAN}, {NAN, NAN}, 0},
+    {{-0.0f, 0.0f}, {0.0f, 0.0f}, 0},
+    {{-0.0f, -0.0f}, {0.0f, -0.0f}, 0},
+    {{-0.0f, 0x1p-140f}, {0x1.6a09e6p-71f, 0x1.6a09e6p-71f}, 0},
+    {{-0.0f, 0x1.8p+0f}, {0x1.bb67aep-1f, 0x1.bb67aep-1f}, 0},
+    {{-0.0f, -0x1.8p+0f}, {0x1.bb67aep-1f, -0x1.bb67aep-1f}, 0},
+    {{-0.0f, 0x1.66p+6f}, {0x1.ac217ep+2f, 0x1.ac217ep+2f}, 0},
+    {{-0.0f, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{-0.0f, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{-0.0f, NAN}, {NAN, NAN}, 0},
+    {{0x1p-140f, 0.0f}, {0x1p-70f, 0.0f}, 0},
+    {{0x1p-140f, -0.0f}, {0x1p-70f, -0.0f}, 0},
+    {{0x1p-140f, 0x1p-140f}, {0x1.19435ep-70f, 0x1.d20312p-72f}, 0},
+    {{0x1p-140f, 0x1.8p+0f}, {0x1.bb67aep-1f, 0x1.bb67bp-1f}, 0},
+    {{0x1p-140f, -0x1.8p+0f}, {0x1.bb67aep-1f, -0x1.bb67bp-1f}, 0},
+    {{0x1p-140f, 0x1.66p+6f}, {0x1.ac217ep+2f, 0x1.ac217cp+2f}, 0},
+    {{0x1p-140f, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x1p-140f, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x1p-140f, NAN}, {NAN, NAN}, 0},
+    {{0x1.8p+0f, 0.0f}, {0x1.3988e2p+0f, 0.0f}, 0},
+    {{0x1.8p+0f, -0.0f}, {0x1.3988e2p+0f, -0.0f}, 0},
+    {{0x1.8p+0f, 0x1p-140f}, {0x1.3988e2p+0f, 0x1.a2p-142f}, FE_UNDERFLOW},
+    {{0x1.8p+0f, 0x1.8p+0f}, {0x1.5879cp+0f, 0x1.1d5f76p-1f}, 0},
+    {{0x1.8p+0f, -0x1.8p+0f}, {0x1.5879cp+0f, -0x1.1d5f76p-1f}, 0},
+    {{0x1.8p+0f, 0x1.66p+6f}, {0x1.afbbcp+2f, 0x1.a88eeep+2f}, 0},
+    {{0x1.8p+0f, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x1.8p+0f, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x1.8p+0f, NAN}, {NAN, NAN}, 0},
+    {{-0x1.8p+0f, 0.0f}, {0.0f, 0x1.3988e2p+0f}, 0},
+    {{-0x1.8p+0f, -0.0f}, {0.0f, -0x1.3988e2p+0f}, 0},
+    {{-0x1.8p+0f, 0x1p-140f}, {0x1.a2p-142f, 0x1.3988e2p+0f}, FE_UNDERFLOW},
+    {{-0x1.8p+0f, 0x1.8p+0f}, {0x1.1d5f76p-1f, 0x1.5879cp+0f}, 0},
+    {{-0x1.8p+0f, -0x1.8p+0f}, {0x1.1d5f76p-1f, -0x1.5879cp+0f}, 0},
+    {{-0x1.8p+0f, 0x1.66p+6f}, {0x1.a88eeep+2f, 0x1.afbbcp+2f}, 0},
+    {{-0x1.8p+0f, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{-0x1.8p+0f, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{-0x1.8p+0f, NAN}, {NAN, NAN}, 0},
+    {{0x1.66p+6f, 0.0f}, {0x1.2ebbf4p+3f, 0.0f}, 0},
+    {{0x1.66p+6f, -0.0f}, {0x1.2ebbf4p+3f, -0.0f}, 0},
+    {{0x1.66p+6f, 0x1p-140f}, {0x1.2ebbf4p+3f, 0x1.bp-145f}, FE_UNDERFLOW},
+    {{0x1.66p+6f, 0x1.8p+0f}, {0x1.2ebeaep+3f, 0x1.44b586p-4f}, 0},
+    {{0x1.66p+6f, -0x1.8p+0f}, {0x1.2ebeaep+3f, -0x1.44b586p-4f}, 0},
+    {{0x1.66p+6f, 0x1.66p+6f}, {0x1.4c9bf8p+3f, 0x1.138ae4p+2f}, 0},
+    {{0x1.66p+6f, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x1.66p+6f, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x1.66p+6f, NAN}, {NAN, NAN}, 0},
+    {{INFINITY, 0.0f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, -0.0f}, {INFINITY, -0.0f}, 0},
+    {{INFINITY, 0x1p-140f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, 0x1.8p+0f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, -0x1.8p+0f}, {INFINITY, -0.0f}, 0},
+    {{INFINITY, 0x1.66p+6f}, {INFINITY, 0.0f}, 0},
+    {{INFINITY, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{INFINITY, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{INFINITY, NAN}, {INFINITY, NAN}, 0},
+    {{-INFINITY, 0.0f}, {0.0f, INFINITY}, 0},
+    {{-INFINITY, -0.0f}, {0.0f, -INFINITY}, 0},
+    {{-INFINITY, 0x1p-140f}, {0.0f, INFINITY}, 0},
+    {{-INFINITY, 0x1.8p+0f}, {0.0f, INFINITY}, 0},
+    {{-INFINITY, -0x1.8p+0f}, {0.0f, -INFINITY}, 0},
+    {{-INFINITY, 0x1.66p+6f}, {0.0f, INFINITY}, 0},
+    {{-INFINITY, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{-INFINITY, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{-INFINITY, NAN}, {NAN, INFINITY}, 0},
+    {{NAN, 0.0f}, {NAN, NAN}, 0},
+    {{NAN, -0.0f}, {NAN, NAN}, 0},
+    {{NAN, 0x1p-140f}, {NAN, NAN}, 0},
+    {{NAN, 0x1.8p+0f}, {NAN, NAN}, 0},
+    {{NAN, -0x1.8p+0f}, {NAN, NAN}, 0},
+    {{NAN, 0x1.66p+6f}, {NAN, NAN}, 0},
+    {{NAN, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{NAN, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{NAN, NAN}, {NAN, NAN}, 0},
+};
+
+/*
+ * C99 Annex G special values for csqrt(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f64
+test_csqrt_conformance_data[] = {
+    {{0.0, 0.0}, {0.0, 0.0}, 0},
+    {{0.0, -0.0}, {0.0, -0.0}, 0},
+    {{0.0, 0x0.000000000001p-1022}, {0x1.6a09e667f3bcdp-536, 0x1.6a09e667f3bcdp-536}, 0},
+    {{0.0, 0x1.8p+0}, {0x1.bb67ae8584caap-1, 0x1.bb67ae8584caap-1}, 0},
+    {{0.0, -0x1.8p+0}, {0x1.bb67ae8584caap-1, -0x1.bb67ae8584caap-1}, 0},
+    {{0.0, 0x1.634p+9}, {0x1.2d91b9013beb5p+4, 0x1.2d91b9013beb5p+4}, 0},
+    {{0.0, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0.0, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0.0, NAN}, {NAN, NAN}, 0},
+    {{-0.0, 0.0}, {0.0, 0.0}, 0},
+    {{-0.0, -0.0}, {0.0, -0.0}, 0},
+    {{-0.0, 0x0.000000000001p-1022}, {0x1.6a09e667f3bcdp-536, 0x1.6a09e667f3bcdp-536}, 0},
+    {{-0.0, 0x1.8p+0}, {0x1.bb67ae8584caap-1, 0x1.bb67ae8584caap-1}, 0},
+    {{-0.0, -0x1.8p+0}, {0x1.bb67ae8584caap-1, -0x1.bb67ae8584caap-1}, 0},
+    {{-0.0, 0x1.634p+9}, {0x1.2d91b9013beb5p+4, 0x1.2d91b9013beb5p+4}, 0},
+    {{-0.0, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{-0.0, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{-0.0, NAN}, {NAN, NAN}, 0},
+    {{0x0.000000000001p-1022, 0.0}, {0x1p-535, 0.0}, 0},
+    {{0x0.000000000001p-1022, -0.0}, {0x1p-535, -0.0}, 0},
+    {{0x0.000000000001p-1022, 0x0.000000000001p-1022}, {0x1.19435caffa9f9p-535, 0x1.d203138f6c828p-537}, 0},
+    {{0x0.000000000001p-1022, 0x1.8p+0}, {0x1.bb67ae8584caap-1, 0x1.bb67ae8584cabp-1}, 0},
+    {{0x0.000000000001p-1022, -0x1.8p+0}, {0x1.bb67ae8584caap-1, -0x1.bb67ae8584cabp-1}, 0},
+    {{0x0.000000000001p-1022, 0x1.634p+9}, {0x1.2d91b9013beb5p+4, 0x1.2d91b9013beb5p+4}, 0},
+    {{0x0.000000000001p-1022, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x0.000000000001p-1022, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x0.000000000001p-1022, NAN}, {NAN, NAN}, 0},
+    {{0x1.8p+0, 0.0}, {0x1.3988e1409212ep+0, 0.0}, 0},
+    {{0x1.8p+0, -0.0}, {0x1.3988e1409212ep+0, -0.0}, 0},
+    {{0x1.8p+0, 0x0.000000000001p-1022}, {0x1.3988e1409212ep+0, 0x0.0000000000006p-1022}, FE_UNDERFLOW},
+    {{0x1.8p+0, 0x1.8p+0}, {0x1.5879bf978cb54p+0, 0x1.1d5f774b7f5dbp-1}, 0},
+    {{0x1.8p+0, -0x1.8p+0}, {0x1.5879bf978cb54p+0, -0x1.1d5f774b7f5dbp-1}, 0},
+    {{0x1.8p+0, 0x1.634p+9}, {0x1.2de34265e5ea4p+4, 0x1.2d4045a240dc5p+4}, 0},
+    {{0x1.8p+0, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x1.8p+0, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x1.8p+0, NAN}, {NAN, NAN}, 0},
+    {{-0x1.8p+0, 0.0}, {0.0, 0x1.3988e1409212ep+0}, 0},
+    {{-0x1.8p+0, -0.0}, {0.0, -0x1.3988e1409212ep+0}, 0},
+    {{-0x1.8p+0, 0x0.000000000001p-1022}, {0x0.0000000000006p-1022, 0x1.3988e1409212ep+0}, FE_UNDERFLOW},
+    {{-0x1.8p+0, 0x1.8p+0}, {0x1.1d5f774b7f5dbp-1, 0x1.5879bf978cb54p+0}, 0},
+    {{-0x1.8p+0, -0x1.8p+0}, {0x1.1d5f774b7f5dbp-1, -0x1.5879bf978cb54p+0}, 0},
+    {{-0x1.8p+0, 0x1.634p+9}, {0x1.2d4045a240dc5p+4, 0x1.2de34265e5ea4p+4}, 0},
+    {{-0x1.8p+0, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{-0x1.8p+0, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{-0x1.8p+0, NAN}, {NAN, NAN}, 0},
+    {{0x1.634p+9, 0.0}, {0x1.aa7bb926a0be2p+4, 0.0}, 0},
+    {{0x1.634p+9, -0.0}, {0x1.aa7bb926a0be2p+4, -0.0}, 0},
+    {{0x1.634p+9, 0x0.000000000001p-1022}, {0x1.aa7bb926a0be2p+4, 0.0}, FE_UNDERFLOW},
+    {{0x1.634p+9, 0x1.8p+0}, {0x1.aa7bc8b912705p+4, 0x1.ccff74771a6d5p-6}, 0},
+    {{0x1.634p+9, -0x1.8p+0}, {0x1.aa7bc8b912705p+4, -0x1.ccff74771a6d5p-6}, 0},
+    {{0x1.634p+9, 0x1.634p+9}, {0x1.d49207067e30dp+4, 0x1.842d2b88cd56fp+3}, 0},
+    {{0x1.634p+9, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{0x1.634p+9, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{0x1.634p+9, NAN}, {NAN, NAN}, 0},
+    {{INFINITY, 0.0}, {INFINITY, 0.0}, 0},
+    {{INFINITY, -0.0}, {INFINITY, -0.0}, 0},
+    {{INFINITY, 0x0.000000000001p-1022}, {INFINITY, 0.0}, 0},
+    {{INFINITY, 0x1.8p+0}, {INFINITY, 0.0}, 0},
+    {{INFINITY, -0x1.8p+0}, {INFINITY, -0.0}, 0},
+    {{INFINITY, 0x1.634p+9}, {INFINITY, 0.0}, 0},
+    {{INFINITY, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{INFINITY, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{INFINITY, NAN}, {INFINITY, NAN}, 0},
+    {{-INFINITY, 0.0}, {0.0, INFINITY}, 0},
+    {{-INFINITY, -0.0}, {0.0, -INFINITY}, 0},
+    {{-INFINITY, 0x0.000000000001p-1022}, {0.0, INFINITY}, 0},
+    {{-INFINITY, 0x1.8p+0}, {0.0, INFINITY}, 0},
+    {{-INFINITY, -0x1.8p+0}, {0.0, -INFINITY}, 0},
+    {{-INFINITY, 0x1.634p+9}, {0.0, INFINITY}, 0},
+    {{-INFINITY, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{-INFINITY, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{-INFINITY, NAN}, {NAN, INFINITY}, 0},
+    {{NAN, 0.0}, {NAN, NAN}, 0},
+    {{NAN, -0.0}, {NAN, NAN}, 0},
+    {{NAN, 0x0.000000000001p-1022}, {NAN, NAN}, 0},
+    {{NAN, 0x1.8p+0}, {NAN, NAN}, 0},
+    {{NAN, -0x1.8p+0}, {NAN, NAN}, 0},
+    {{NAN, 0x1.634p+9}, {NAN, NAN}, 0},
+    {{NAN, INFINITY}, {INFINITY, INFINITY}, 0},
+    {{NAN, -INFINITY}, {INFINITY, -INFINITY}, 0},
+    {{NAN, NAN}, {NAN, NAN}, 0},
+};
+
+#endif	/*__TEST_CSQRT_DATA_H__*/
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_CTAN_DATA_H__
+#define __TEST_CTAN_DATA_H__
+
+extern "C"
+{
+    #if defined(_WIN64) || defined(_WIN32)
+        #include "complex.h"
+    #else
+        #include "/usr/include/complex.h"
+    #endif
+}
+
+#include <cmath>
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <external/amdlibm.h>
+
+/*
+ * C99 Annex G special values for ctanf(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f32
+test_ctanf_conformance_data[] = {
+    {{0.0f, 0.0f}, {0.0f, 0.0f}, 0},
+    {{0.0f, -0.0f}, {0.0f, -0.0f}, 0},
+    {{0.0f, 0x1p-140f}, {0.0f, 0x1p-140f}, FE_UNDERFLOW},
+    {{0.0f, 0x1.8p+0f}, {0.0f, 0x1.cf6f98p-1f}, 0},
+    {{0.0f, -0x1.8p+0f}, {0.0f, -0x1.cf6f98p-1f}, 0},
+    {{0.0f, 0x1.66p+6f}, {0.0f, 0x1p+0f}, 0},
+    {{0.0f, INFINITY}, {0.0f, 0x1p+0f}, 0},
+    {{0.0f, -INFINITY}, {0.0f, -0x1p+0f}, 0},
+    {{0.0f, NAN}, {0.0f, NAN}, 0},
+    {{-0.0f, 0.0f}, {-0.0f, 0.0f}, 0},
+    {{-0.0f, -0.0f}, {-0.0f, -0.0f}, 0},
+    {{-0.0f, 0x1p-140f}, {-0.0f, 0x1p-140f}, FE_UNDERFLOW},
+    {{-0.0f, 0x1.8p+0f}, {-0.0f, 0x1.cf6f98p-1f}, 0},
+    {{-0.0f, -0x1.8p+0f}, {-0.0f, -0x1.cf6f98p-1f}, 0},
+    {{-0.0f, 0x1.66p+6f}, {-0.0f, 0x1p+0f}, 0},
+    {{-0.0f, INFINITY}, {-0.0f, 0x1p+0f}, 0},
+    {{-0.0f, -INFINITY}, {-0.0f, -0x1p+0f}, 0},
+    {{-0.0f, NAN}, {-0.0f, NAN}, 0},
+    {{0x1p-140f, 0.0f}, {0x1p-140f, 0.0f}, FE_UNDERFLOW},
+    {{0x1p-140f, -0.0f}, {0x1p-140f, -0.0f}, FE_UNDERFLOW},
+    {{0x1p-140f, 0x1p-140f}, {0x1p-140f, 0x1p-140f}, FE_UNDERFLOW},
+    {{0x1p-140f, 0x1.8p+0f}, {0x1.74p-143f, 0x1.cf6f98p-1f}, FE_UNDERFLOW},
+    {{0x1p-140f, -0x1.8p+0f}, {0x1.74p-143f, -0x1.cf6f98p-1f}, FE_UNDERFLOW},
+    {{0x1p-140f, 0x1.66p+6f}, {0.0f, 0x1p+0f}, FE_UNDERFLOW},
+    {{0x1p-140f, INFINITY}, {0.0f, 0x1p+0f}, 0},
+    {{0x1p-140f, -INFINITY}, {0.0f, -0x1p+0f}, 0},
+    {{0x1p-140f, NAN}, {NAN, NAN}, 0},
+    {{0x1.8p+0f, 0.0f}, {0x1.c33ed6p+3f, 0.0f}, 0},
+    {{0x1.8p+0f, -0.0f}, {0x1.c33ed6p+3f, -0.0f}, 0},
+    {{0x1.8p+0f, 0x1p-140f}, {0x1.c33ed6p+3f, 0x1.8fb3p-133f}, FE_UNDERFLOW},
+    {{0x1.8p+0f, 0x1.8p+0f}, {0x1.fd67f8p-7f, 0x1.1a83cap+0f}, 0},
+    {{0x1.8p+0f, -0x1.8p+0f}, {0x1.fd67f8p-7f, -0x1.1a83cap+0f}, 0},
+    {{0x1.8p+0f, 0x1.66p+6f}, {0.0f, 0x1p+0f}, FE_UNDERFLOW},
+    {{0x1.8p+0f, INFINITY}, {0.0f, 0x1p+0f}, 0},
+    {{0x1.8p+0f, -INFINITY}, {0.0f, -0x1p+0f}, 0},
+    {{0x1.8p+0f, NAN}, {NAN, NAN}, 0},
+    {{-0x1.8p+0f, 0.0f}, {-0x1.c33ed6p+3f, 0.0f}, 0},
+    {{-0x1.8p+0f, -0.0f}, {-0x1.c33ed6p+3f, -0.0f}, 0},
+    {{-0x1.8p+0f, 0x1p-140f}, {-0x1.c33ed6p+3f, 0x1.8fb3p-133f}, FE_UNDERFLOW},
+    {{-0x1.8p+0f, 0x1.8p+0f}, {-0x1.fd67f8p-7f, 0x1.1a83cap+0f}, 0},
+    {{-0x1.8p+0f, -0x1.8p+0f}, {-0x1.fd67f8p-7f, -0x1.1a83cap+0f}, 0},
+    {{-0x1.8p+0f, 0x1.66p+6f}, {-0.0f, 0x1p+0f}, FE_UNDERFLOW},
+    {{-0x1.8p+0f, INFINITY}, {-0.0f, 0x1p+0f}, 0},
+    {{-0x1.8p+0f, -INFINITY}, {-0.0f, -0x1p+0f}, 0},
+    {{-0x1.8p+0f, NAN}, {NAN, NAN}, 0},
+    {{0x1.66p+6f, 0.0f}, {0x1.c3e886p+4f, 0.0f}, 0},
+    {{0x1.66p+6f, -0.0f}, {0x1.c3e886p+4f, -0.0f}, 0},
+    {{0x1.66p+6f, 0x1p-140f}, {0x1.c3e886p+4f, 0x1.8f5e8p-131f}, FE_UNDERFLOW},
+    {{0x1.66p+6f, 0x1.8p+0f}, {0x1.feffcep-8f, 0x1.1abfap+0f}, 0},
+    {{0x1.66p+6f, -0x1.8p+0f}, {0x1.feffcep-8f, -0x1.1abfap+0f}, 0},
+    {{0x1.66p+6f, 0x1.66p+6f}, {0.0f, 0x1p+0f}, FE_UNDERFLOW},
+    {{0x1.66p+6f, INFINITY}, {0.0f, 0x1p+0f}, 0},
+    {{0x1.66p+6f, -INFINITY}, {0.0f, -0x1p+0f}, 0},
+    {{0x1.66p+6f, NAN}, {NAN, NAN}, 0},
+    {{INFINITY, 0.0f}, {NAN, 0.0f}, FE_INVALID},
+    {{INFINITY, -0.0f}, {NAN, -0.0f}, FE_INVALID},
+    {{INFINITY, 0x1p-140f}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, 0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, -0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, 0x1.66p+6f}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, INFINITY}, {0.0f, 0x1p+0f}, 0},
+    {{INFINITY, -INFINITY}, {0.0f, -0x1p+0f}, 0},
+    {{INFINITY, NAN}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, 0.0f}, {NAN, 0.0f}, FE_INVALID},
+    {{-INFINITY, -0.0f}, {NAN, -0.0f}, FE_INVALID},
+    {{-INFINITY, 0x1p-140f}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, 0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, -0x1.8p+0f}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, 0x1.66p+6f}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, INFINITY}, {-0.0f, 0x1p+0f}, 0},
+    {{-INFINITY, -INFINITY}, {-0.0f, -0x1p+0f}, 0},
+    {{-INFINITY, NAN}, {NAN, NAN}, FE_INVALID},
+    {{NAN, 0.0f}, {NAN, 0.0f}, 0},
+    {{NAN, -0.0f}, {NAN, -0.0f}, 0},
+    {{NAN, 0x1p-140f}, {NAN, NAN}, 0},
+    {{NAN, 0x1.8p+0f}, {NAN, NAN}, 0},
+    {{NAN, -0x1.8p+0f}, {NAN, NAN}, 0},
+    {{NAN, 0x1.66p+6f}, {NAN, NAN}, 0},
+    {{NAN, INFINITY}, {0.0f, 0x1p+0f}, 0},
+    {{NAN, -INFINITY}, {0.0f, -0x1p+0f}, 0},
+    {{NAN, NAN}, {NAN, NAN}, 0},
+};
+
+/*
+ * C99 Annex G special values for ctan(), every pair of real and imaginary parts from the special values below:
+ * +/-0, a denormal, +/-1.5, a part that overflows exp(), +/-inf and NaN.
+ * These values are as per GLIBC output, exceptions other than FE_INEXACT.
+ */
+static libm_test_complex_data_f64
+test_ctan_conformance_data[] = {
+    {{0.0, 0.0}, {0.0, 0.0}, 0},
+    {{0.0, -0.0}, {0.0, -0.0}, 0},
+    {{0.0, 0x0.000000000001p-1022}, {0.0, 0x0.000000000001p-1022}, FE_UNDERFLOW},
+    {{0.0, 0x1.8p+0}, {0.0, 0x1.cf6f9786df578p-1}, 0},
+    {{0.0, -0x1.8p+0}, {0.0, -0x1.cf6f9786df578p-1}, 0},
+    {{0.0, 0x1.634p+9}, {0.0, 0x1p+0}, 0},
+    {{0.0, INFINITY}, {0.0, 0x1p+0}, 0},
+    {{0.0, -INFINITY}, {0.0, -0x1p+0}, 0},
+    {{0.0, NAN}, {0.0, NAN}, 0},
+    {{-0.0, 0.0}, {-0.0, 0.0}, 0},
+    {{-0.0, -0.0}, {-0.0, -0.0}, 0},
+    {{-0.0, 0x0.000000000001p-1022}, {-0.0, 0x0.000000000001p-1022}, FE_UNDERFLOW},
+    {{-0.0, 0x1.8p+0}, {-0.0, 0x1.cf6f9786df578p-1}, 0},
+    {{-0.0, -0x1.8p+0}, {-0.0, -0x1.cf6f9786df578p-1}, 0},
+    {{-0.0, 0x1.634p+9}, {-0.0, 0x1p+0}, 0},
+    {{-0.0, INFINITY}, {-0.0, 0x1p+0}, 0},
+    {{-0.0, -INFINITY}, {-0.0, -0x1p+0}, 0},
+    {{-0.0, NAN}, {-0.0, NAN}, 0},
+    {{0x0.000000000001p-1022, 0.0}, {0x0.000000000001p-1022, 0.0}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, -0.0}, {0x0.000000000001p-1022, -0.0}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, 0x0.000000000001p-1022}, {0x0.000000000001p-1022, 0x0.000000000001p-1022}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, 0x1.8p+0}, {0x0.0000000000003p-1022, 0x1.cf6f9786df578p-1}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, -0x1.8p+0}, {0x0.0000000000003p-1022, -0x1.cf6f9786df578p-1}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, 0x1.634p+9}, {0.0, 0x1p+0}, FE_UNDERFLOW},
+    {{0x0.000000000001p-1022, INFINITY}, {0.0, 0x1p+0}, 0},
+    {{0x0.000000000001p-1022, -INFINITY}, {0.0, -0x1p+0}, 0},
+    {{0x0.000000000001p-1022, NAN}, {NAN, NAN}, 0},
+    {{0x1.8p+0, 0.0}, {0x1.c33ed50b88778p+3, 0.0}, 0},
+    {{0x1.8p+0, -0.0}, {0x1.c33ed50b88778p+3, -0.0}, 0},
+    {{0x1.8p+0, 0x0.000000000001p-1022}, {0x1.c33ed50b88778p+3, 0x0.0000000000c7ep-1022}, FE_UNDERFLOW},
+    {{0x1.8p+0, 0x1.8p+0}, {0x1.fd67f7aace87dp-7, 0x1.1a83c9ebd296fp+0}, 0},
+    {{0x1.8p+0, -0x1.8p+0}, {0x1.fd67f7aace87dp-7, -0x1.1a83c9ebd296fp+0}, 0},
+    {{0x1.8p+0, 0x1.634p+9}, {0.0, 0x1p+0}, FE_UNDERFLOW},
+    {{0x1.8p+0, INFINITY}, {0.0, 0x1p+0}, 0},
+    {{0x1.8p+0, -INFINITY}, {0.0, -0x1p+0}, 0},
+    {{0x1.8p+0, NAN}, {NAN, NAN}, 0},
+    {{-0x1.8p+0, 0.0}, {-0x1.c33ed50b88778p+3, 0.0}, 0},
+    {{-0x1.8p+0, -0.0}, {-0x1.c33ed50b88778p+3, -0.0}, 0},
+    {{-0x1.8p+0, 0x0.000000000001p-1022}, {-0x1.c33ed50b88778p+3, 0x0.0000000000c7ep-1022}, FE_UNDERFLOW},
+    {{-0x1.8p+0, 0x1.8p+0}, {-0x1.fd67f7aace87dp-7, 0x1.1a83c9ebd296fp+0}, 0},
+    {{-0x1.8p+0, -0x1.8p+0}, {-0x1.fd67f7aace87dp-7, -0x1.1a83c9ebd296fp+0}, 0},
+    {{-0x1.8p+0, 0x1.634p+9}, {-0.0, 0x1p+0}, FE_UNDERFLOW},
+    {{-0x1.8p+0, INFINITY}, {-0.0, 0x1p+0}, 0},
+    {{-0x1.8p+0, -INFINITY}, {-0.0, -0x1p+0}, 0},
+    {{-0x1.8p+0, NAN}, {NAN, NAN}, 0},
+    {{0x1.634p+9, 0.0}, {0x1.17bf3887a602ep-1, 0.0}, 0},
+    {{0x1.634p+9, -0.0}, {0x1.17bf3887a602ep-1, -0.0}, 0},
+    {{0x1.634p+9, 0x0.000000000001p-1022}, {0x1.17bf3887a602ep-1, 0x0.0000000000015p-1022}, FE_UNDERFLOW},
+    {{0x1.634p+9, 0x1.8p+0}, {0x1.44f0f45125edfp-4, 0x1.e3860a41b23e1p-1}, 0},
+    {{0x1.634p+9, -0x1.8p+0}, {0x1.44f0f45125edfp-4, -0x1.e3860a41b23e1p-1}, 0},
+    {{0x1.634p+9, 0x1.634p+9}, {0.0, 0x1p+0}, FE_UNDERFLOW},
+    {{0x1.634p+9, INFINITY}, {0.0, 0x1p+0}, 0},
+    {{0x1.634p+9, -INFINITY}, {0.0, -0x1p+0}, 0},
+    {{0x1.634p+9, NAN}, {NAN, NAN}, 0},
+    {{INFINITY, 0.0}, {NAN, 0.0}, FE_INVALID},
+    {{INFINITY, -0.0}, {NAN, -0.0}, FE_INVALID},
+    {{INFINITY, 0x0.000000000001p-1022}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, 0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, -0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, 0x1.634p+9}, {NAN, NAN}, FE_INVALID},
+    {{INFINITY, INFINITY}, {0.0, 0x1p+0}, 0},
+    {{INFINITY, -INFINITY}, {0.0, -0x1p+0}, 0},
+    {{INFINITY, NAN}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, 0.0}, {NAN, 0.0}, FE_INVALID},
+    {{-INFINITY, -0.0}, {NAN, -0.0}, FE_INVALID},
+    {{-INFINITY, 0x0.000000000001p-1022}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, 0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, -0x1.8p+0}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, 0x1.634p+9}, {NAN, NAN}, FE_INVALID},
+    {{-INFINITY, INFINITY}, {-0.0, 0x1p+0}, 0},
+    {{-INFINITY, -INFINITY}, {-0.0, -0x1p+0}, 0},
+    {{-INFINITY, NAN}, {NAN, NAN}, FE_INVALID},
+    {{NAN, 0.0}, {NAN, 0.0}, 0},
+    {{NAN, -0.0}, {NAN, -0.0}, 0},
+    {{NAN, 0x0.000000000001p-1022}, {NAN, NAN}, 0},
+    {{NAN, 0x1.8p+0}, {NAN, NAN}, 0},
+    {{NAN, -0x1.8p+0}, {NAN, NAN}, 0},
+    {{NAN, 0x1.634p+9}, {NAN, NAN}, 0},
+    {{NAN, INFINITY}, {0.0, 0x1p+0}, 0},
+    {{NAN, -INFINITY}, {0.0, -0x1p+0}, 0},
+    {{NAN, NAN}, {NAN, NAN}, 0},
+};
+
+#endif	/*__TEST_CTAN_DATA_H__*/
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Special values through vrd2/vrd4_erf. Vectors that span more than one
+ * region evaluate both polynomials and blend, nan lanes return nan rather
+ * than +/-1, so the rows below mix the regions, nan and inf within each
+ * group of 2 and 4 lanes. Expected values are glibc erf.
+ */
+
+#include "libm_tests.h"
+#include "almtestvec.h"
+
+/* the vector kernels are within 1 ulp of the correctly rounded table */
+static const uint64_t maxulp = 1;
+
+static libm_test_special_data_f64 test_erf_vector_special_data[] = {
+    {0x0000000000000000, 0x0000000000000000, 0,},            //0
+    {0x8000000000000000, 0x8000000000000000, 0,},            //-0
+    {0x0000000000000001, 0x0000000000000001, 0,},            //min denormal
+    {0x800fffffffffffff, 0x80120dd750429b6c, 0,},            //-max denormal
+    {0x7ff8000000000000, 0x7ff8000000000000, 0,},            //qnan
+    {0x3fe0000000000000, 0x3fe0a7ef5c18edd2, 0,},            //0.5
+    {0x4000000000000000, 0x3fefd9ae142795e3, 0,},            //2
+    {0x4020000000000000, 0x3ff0000000000000, 0,},            //8, 1
+    {0x7ff0000000000000, 0x3ff0000000000000, 0,},            //inf, 1
+    {0xfff0000000000000, 0xbff0000000000000, 0,},            //-inf, -1
+    {0xfff8000000000000, 0xfff8000000000000, 0,},            //-qnan
+    {0xbfd0000000000000, 0xbfd1af54e232d609, 0,},            //-0.25
+    {0x7ff4000000000000, 0x7ffc000000000000, FE_INVALID,},   //snan
+    {0x3e40000000000000, 0x3e420dd750429b6d, 0,},            //2^-27
+    {0xc008000000000000, 0xbfefffd1ac4135f9, 0,},            //-3
+    {0x4017b000c9539b89, 0x3ff0000000000000, 0,},            //first x with erf(x) = 1
+    {0x3ff0000000000000, 0x3feaf767a741088b, 0,},            //1
+    {0xbff0000000000000, 0xbfeaf767a741088b, 0,},            //-1
+    {0x400c000000000000, 0x3feffffe710d565e, 0,},            //3.5
+    {0xc090000000000000, 0xbff0000000000000, 0,},            //-1024, -1
+    {0x4017000000000000, 0x3feffffffffffffc, 0,},            //5.75
+    {0x7fefffffffffffff, 0x3ff0000000000000, 0,},            //max double, 1
+    {0xffefffffffffffff, 0xbff0000000000000, 0,},            //-max double, -1
+    {0x3fb999999999999a, 0x3fbcca5ea24fb334, 0,},            //0.1
+    {0x7ff8000000000000, 0x7ff8000000000000, 0,},            //all special lanes
+    {0x7ff0000000000000, 0x3ff0000000000000, 0,},
+    {0xfff8000000000000, 0xfff8000000000000, 0,},
+    {0x8000000000000000, 0x8000000000000000, 0,},
+    {0x4008000000000000, 0x3fefffd1ac4135f9, 0,},            //3
+    {0x3fe8000000000000, 0x3fe6c1c9759d0e5f, 0,},            //0.75
+    {0x4002000000000000, 0x3feff404760319b4, 0,},            //2.25
+    {0xbfe8000000000000, 0xbfe6c1c9759d0e5f, 0,},            //-0.75
+};
+
+TEST(ERF, CONFORMANCE_DOUBLE_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_erf_vector_special_data);
+  ConfCheckVec<double>("vrd2_erf", test_erf_vector_special_data, n, 1, 2, test_v2d, maxulp);
+  ConfCheckVec<double>("vrd4_erf", test_erf_vector_special_data, n, 1, 4, test_v4d, maxulp);
+}
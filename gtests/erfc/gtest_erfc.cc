@@ -0,0 +1,407 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * erfc, cdfnorm and the inverses erfinv, erfcinv and cdfnorminv against
+ * the mparith references, which evaluate erfc in 256 (128) bits and solve
+ * for the inverses by Newton's method to the same precision.
+ *
+ * Every scalar, vector and array kernel of each uarch row the host can
+ * run is checked on random arguments over the whole domain and on the
+ * tails: erfc and cdfnorm down to denormal results and to 0, the
+ * inverses at probabilities down to the smallest denormal and at the
+ * last representable steps below 1 (and 2). The endpoints 0, 1 (and 2),
+ * the arguments just outside the domain, the infinities and NaN are
+ * checked for their exact results.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+#include <immintrin.h>
+#include "gtest.h"
+#include <external/amdlibm.h>
+#include <libm/iface.h>
+
+extern "C" {
+#include "alm_mp_funcs.h"
+}
+
+static const char *uarch_names[ALM_UARCH_MAX] = {
+    "default", "base64", "fma3", "zen", "zen2", "zen3", "zen4", "zen5",
+};
+
+/*
+ * Stated max error in ulps of the result. The double kernels carry the
+ * error of the erfc polynomial and of exp, the inverses that of the
+ * rational functions of AS 241 and of log. The float kernels are
+ * evaluated in double and rounded once.
+ */
+struct Func {
+  const char *name;
+  long double (*mp)(double);
+  double (*mpf)(float);
+  double ulp, ulpf;
+};
+
+static const Func funcs[] = {
+    {"erfc",       alm_mp_erfc,       alm_mp_erfcf,       4.0, 1.0},
+    {"cdfnorm",    alm_mp_cdfnorm,    alm_mp_cdfnormf,    4.0, 1.0},
+    {"erfinv",     alm_mp_erfinv,     alm_mp_erfinvf,     5.5, 1.0},
+    {"erfcinv",    alm_mp_erfcinv,    alm_mp_erfcinvf,    5.5, 1.0},
+    {"cdfnorminv", alm_mp_cdfnorminv, alm_mp_cdfnorminvf, 5.5, 1.0},
+};
+
+template <typename T> struct Prec;
+
+template <> struct Prec<double> {
+  typedef long double ref_t;
+  static const int scal = ALM_FUNC_SCAL_DP, arr = ALM_FUNC_VECT_DP_ARR;
+  static const int v128 = ALM_FUNC_VECT_DP_2, v256 = ALM_FUNC_VECT_DP_4, v512 = ALM_FUNC_VECT_DP_8;
+  typedef __m128d V128;
+  typedef __m256d V256;
+#if defined(__AVX512F__)
+  typedef __m512d V512;
+#endif
+  static ref_t Ref(const Func &f, double x) { return f.mp(x); }
+  static double Bound(const Func &f) { return f.ulp; }
+};
+
+template <> struct Prec<float> {
+  typedef double ref_t;
+  static const int scal = ALM_FUNC_SCAL_SP, arr = ALM_FUNC_VECT_SP_ARR;
+  static const int v128 = ALM_FUNC_VECT_SP_4, v256 = ALM_FUNC_VECT_SP_8, v512 = ALM_FUNC_VECT_SP_16;
+  typedef __m128 V128;
+  typedef __m256 V256;
+#if defined(__AVX512F__)
+  typedef __m512 V512;
+#endif
+  static ref_t Ref(const Func &f, float x) { return f.mpf(x); }
+  static double Bound(const Func &f) { return f.ulpf; }
+};
+
+static const struct alm_arch_funcs *Funcs(const char *func) {
+  for (int e = 1; e < C_AMD_LAST_ENTRY; e++)
+    if (alm_iface_name(e) && !strcmp(alm_iface_name(e), func))
+      return alm_iface_funcs(e);
+  return NULL;
+}
+
+/*
+ * Error of a in ulps of T at the reference e, 0 for matching NaN and inf,
+ * infinite for a class mismatch or a zero of the wrong sign
+ */
+template <typename T>
+static double UlpError(T a, typename Prec<T>::ref_t e) {
+  T r = (T)e;
+  if (std::isnan(a) || std::isnan(r))
+    return (std::isnan(a) && std::isnan(r)) ? 0.0 : INFINITY;
+  if (std::isinf(a) || std::isinf(r))
+    return (a == r) ? 0.0 : INFINITY;
+  if (a == 0 && r == 0 && std::signbit(a) != std::signbit(r))
+    return INFINITY;
+  int exp = std::max(std::ilogb(r), std::numeric_limits<T>::min_exponent - 1);
+  long double ulp = std::ldexp((long double)1, exp - std::numeric_limits<T>::digits + 1);
+  if (r == 0)
+    ulp = std::numeric_limits<T>::denorm_min();
+  return (double)(std::fabs((long double)a - (long double)e) / ulp);
+}
+
+template <typename T>
+static void EvalScalar(void *fn, const std::vector<T> &x, std::vector<T> &r) {
+  for (size_t i = 0; i < x.size(); i++)
+    r[i] = reinterpret_cast<T (*)(T)>(fn)(x[i]);
+}
+
+/* The last vector is padded with the last argument */
+template <typename T, typename V>
+static void EvalVector(void *fn, const std::vector<T> &x, std::vector<T> &r) {
+  const size_t n = x.size(), lanes = sizeof(V) / sizeof(T);
+  T in[sizeof(V) / sizeof(T)], out[sizeof(V) / sizeof(T)];
+  V v;
+
+  for (size_t i = 0; i < n; i += lanes) {
+    for (size_t j = 0; j < lanes; j++)
+      in[j] = x[std::min(i + j, n - 1)];
+    memcpy(&v, in, sizeof(v));
+    v = reinterpret_cast<V (*)(V)>(fn)(v);
+    memcpy(out, &v, sizeof(v));
+    for (size_t j = 0; j < lanes && i + j < n; j++)
+      r[i + j] = out[j];
+  }
+}
+
+/* Calls of 1 to 37 elements for the tails */
+template <typename T>
+static void EvalArray(void *fn, const std::vector<T> &x, std::vector<T> &r) {
+  size_t n = x.size();
+  std::vector<T> in(x);
+  for (size_t i = 0, len = 1; i < n; i += len, len = len % 37 + 1) {
+    int k = (int)(n - i < len ? n - i : len);
+    reinterpret_cast<void (*)(int, T *, T *)>(fn)(k, in.data() + i, r.data() + i);
+  }
+}
+
+struct Variant {
+  const char *name;
+  int slot;
+  bool avx512;
+};
+
+/*
+ * Evaluates x with every kernel of every row the host can run and calls
+ * check(variant, row, r) with the results, once per distinct kernel
+ */
+template <typename T, typename C>
+static void ForEachKernel(const char *func, const std::vector<T> &x, C check) {
+  typedef Prec<T> P;
+  const struct alm_arch_funcs *t = Funcs(func);
+  ASSERT_TRUE(t != NULL) << func << " is not in the dispatch tables";
+
+  const Variant variants[] = {
+      {"s", P::scal, false}, {"v128", P::v128, false}, {"v256", P::v256, false},
+      {"v512", P::v512, true}, {"arr", P::arr, false},
+  };
+  bool avx512 = __builtin_cpu_supports("avx512f");
+  std::vector<void *> seen;
+  std::vector<T> r(x.size());
+
+  for (int row = (int)alm_iface_uarch(); row >= 0; row--) {
+    for (const Variant &v : variants) {
+      void *fn = t->funcs[row][v.slot];
+      if (!fn || (v.avx512 && !avx512) ||
+          std::find(seen.begin(), seen.end(), fn) != seen.end())
+        continue;
+      seen.push_back(fn);
+
+      if (v.slot == P::scal)
+        EvalScalar<T>(fn, x, r);
+      else if (v.slot == P::v128)
+        EvalVector<T, typename P::V128>(fn, x, r);
+      else if (v.slot == P::v256)
+        EvalVector<T, typename P::V256>(fn, x, r);
+#if defined(__AVX512F__)
+      else if (v.slot == P::v512)
+        EvalVector<T, typename P::V512>(fn, x, r);
+#endif
+      else if (v.slot == P::arr)
+        EvalArray<T>(fn, x, r);
+      else
+        continue;
+      check(v, row, r);
+    }
+  }
+  EXPECT_FALSE(seen.empty()) << func << " has no kernel";
+}
+
+template <typename T>
+static void Append(std::vector<T> &x, T lo, T hi, int n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<T> dist(lo, hi);
+  for (int i = 0; i < n; i++)
+    x.push_back(dist(gen));
+}
+
+/*
+ * sign * m * 2^-k for every k down to the smallest denormal, m in [1, 2),
+ * and the powers of 2 of every 8th k
+ */
+template <typename T>
+static void AppendBinades(std::vector<T> &x, T sign, unsigned seed) {
+  const int kmax = -(std::numeric_limits<T>::min_exponent - 1) +
+                   std::numeric_limits<T>::digits - 1;
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<T> dist(1, 2);
+  for (int k = 1; k <= kmax; k++) {
+    if (k % 8 == 1)
+      x.push_back(sign * std::ldexp(T(1), -k));
+    x.push_back(sign * std::ldexp(dist(gen), -k));
+  }
+}
+
+/* c - m * 2^-k for the binades of the last bits below c */
+template <typename T>
+static void AppendBelow(std::vector<T> &x, T c, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<T> dist(1, 2);
+  for (int k = 1; k <= std::numeric_limits<T>::digits; k++) {
+    x.push_back(c - std::ldexp(T(1), -k));
+    x.push_back(c - std::ldexp(dist(gen), -k));
+  }
+}
+
+/*
+ * Random arguments over the domain and the tails. erfc is below the
+ * smallest denormal from 27.3 (10.1 for float), cdfnorm from -38.5
+ * (-14.3).
+ */
+template <typename T>
+static std::vector<T> Arguments(const char *func) {
+  const bool dbl = std::numeric_limits<T>::digits > 24;
+  const T zero = dbl ? T(27.3) : T(10.1);
+  const T sqrt2 = T(1.4142135623730951);
+  std::vector<T> x;
+
+  if (!strcmp(func, "erfc")) {
+    Append<T>(x, T(-6), zero, 2000, 1);
+    Append<T>(x, zero - 8, zero + 1, 500, 2);
+    AppendBinades<T>(x, T(1), 3);
+    AppendBinades<T>(x, T(-1), 4);
+  } else if (!strcmp(func, "cdfnorm")) {
+    Append<T>(x, -(zero * sqrt2), T(9), 2000, 1);
+    Append<T>(x, -(zero + 1) * sqrt2, -(zero - 8) * sqrt2, 500, 2);
+    AppendBinades<T>(x, T(1), 3);
+    AppendBinades<T>(x, T(-1), 4);
+  } else if (!strcmp(func, "erfinv")) {
+    Append<T>(x, T(-1), T(1), 2000, 1);
+    AppendBinades<T>(x, T(1), 2);
+    AppendBinades<T>(x, T(-1), 3);
+    size_t n = x.size();
+    AppendBelow<T>(x, T(1), 4);
+    for (size_t i = n, m = x.size(); i < m; i++)
+      x.push_back(-x[i]);
+  } else if (!strcmp(func, "erfcinv")) {
+    Append<T>(x, T(0), T(2), 2000, 1);
+    AppendBinades<T>(x, T(1), 2);
+    AppendBelow<T>(x, T(2), 3);
+    AppendBelow<T>(x, T(1), 4);
+    for (int k = 1; k <= std::numeric_limits<T>::digits; k++)
+      x.push_back(1 + std::ldexp(T(1), -k));
+  } else if (!strcmp(func, "cdfnorminv")) {
+    Append<T>(x, T(0), T(1), 2000, 1);
+    AppendBinades<T>(x, T(1), 2);
+    AppendBelow<T>(x, T(1), 3);
+  }
+  return x;
+}
+
+template <typename T>
+static void CheckAccuracy(const Func &f) {
+  typedef typename Prec<T>::ref_t ref_t;
+  const double bound = Prec<T>::Bound(f);
+  std::vector<T> x = Arguments<T>(f.name);
+  std::vector<ref_t> e(x.size());
+
+  for (size_t i = 0; i < x.size(); i++)
+    e[i] = Prec<T>::Ref(f, x[i]);
+
+  ForEachKernel<T>(f.name, x, [&](const Variant &v, int row, const std::vector<T> &r) {
+    double worst = 0;
+    size_t nfail = 0;
+    for (size_t i = 0; i < x.size(); i++) {
+      double ulp = UlpError<T>(r[i], e[i]);
+      if (!std::isinf(ulp))
+        worst = std::max(worst, ulp);
+      if (ulp > bound && nfail++ < 4)
+        ADD_FAILURE() << f.name << "/" << uarch_names[row] << "/" << v.name << ": input "
+                      << std::hexfloat << x[i] << " expected " << (T)e[i] << " actual "
+                      << r[i] << " (" << std::defaultfloat << ulp << " ulp)";
+    }
+    printf("%s%s/%s/%s: max %.3f ulp\n", f.name, sizeof(T) == 4 ? "f" : "",
+           uarch_names[row], v.name, worst);
+    EXPECT_EQ(nfail, 0u) << f.name << "/" << uarch_names[row] << "/" << v.name << " failed";
+  });
+}
+
+/* The endpoints, the arguments just outside the domain, inf and NaN */
+template <typename T>
+static void CheckSpecial(const Func &f) {
+  const T inf = std::numeric_limits<T>::infinity();
+  const T nan = std::numeric_limits<T>::quiet_NaN();
+  const T max = std::numeric_limits<T>::max();
+  const T den = std::numeric_limits<T>::denorm_min();
+  const T above1 = std::nextafter(T(1), T(2));
+  const T above2 = std::nextafter(T(2), T(3));
+  std::vector<T> x, e;
+
+  auto add = [&](T in, T out) {
+    x.push_back(in);
+    e.push_back(out);
+  };
+
+  if (!strcmp(f.name, "erfc")) {
+    add(T(0), T(1));    add(-T(0), T(1));   add(den, T(1));   add(-den, T(1));
+    add(inf, T(0));     add(-inf, T(2));    add(max, T(0));   add(-max, T(2));
+    add(nan, nan);
+  } else if (!strcmp(f.name, "cdfnorm")) {
+    add(T(0), T(0.5));  add(-T(0), T(0.5)); add(inf, T(1));   add(-inf, T(0));
+    add(max, T(1));     add(-max, T(0));    add(nan, nan);
+  } else if (!strcmp(f.name, "erfinv")) {
+    add(T(0), T(0));    add(-T(0), -T(0));  add(T(1), inf);   add(T(-1), -inf);
+    add(above1, nan);   add(-above1, nan);  add(T(2), nan);   add(T(-2), nan);
+    add(max, nan);      add(inf, nan);      add(-inf, nan);   add(nan, nan);
+  } else if (!strcmp(f.name, "erfcinv")) {
+    add(T(0), inf);     add(-T(0), inf);    add(T(1), T(0));  add(T(2), -inf);
+    add(-den, nan);     add(above2, nan);   add(T(-1), nan);  add(T(3), nan);
+    add(max, nan);      add(inf, nan);      add(-inf, nan);   add(nan, nan);
+  } else if (!strcmp(f.name, "cdfnorminv")) {
+    add(T(0), -inf);    add(-T(0), -inf);   add(T(1), inf);   add(T(0.5), T(0));
+    add(-den, nan);     add(above1, nan);   add(T(-1), nan);  add(T(2), nan);
+    add(max, nan);      add(inf, nan);      add(-inf, nan);   add(nan, nan);
+  }
+
+  /* the references agree */
+  for (size_t i = 0; i < x.size(); i++)
+    EXPECT_EQ(UlpError<T>(e[i], Prec<T>::Ref(f, x[i])), 0.0)
+        << f.name << " mparith at " << std::hexfloat << x[i];
+
+  ForEachKernel<T>(f.name, x, [&](const Variant &v, int row, const std::vector<T> &r) {
+    for (size_t i = 0; i < x.size(); i++)
+      EXPECT_EQ(UlpError<T>(r[i], e[i]), 0.0)
+          << f.name << "/" << uarch_names[row] << "/" << v.name << ": input " << std::hexfloat
+          << x[i] << " expected " << e[i] << " actual " << r[i];
+  });
+}
+
+TEST(Erfc, Accuracy) {
+  for (const Func &f : funcs)
+    CheckAccuracy<double>(f);
+}
+
+TEST(Erfc, AccuracyFloat) {
+  for (const Func &f : funcs)
+    CheckAccuracy<float>(f);
+}
+
+TEST(Erfc, Special) {
+  for (const Func &f : funcs)
+    CheckSpecial<double>(f);
+}
+
+TEST(Erfc, SpecialFloat) {
+  for (const Func &f : funcs)
+    CheckSpecial<float>(f);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Special values through vrs8_expf. Lanes past the overflow and
+ * underflow thresholds are recomputed from a clamped argument in the
+ * vector unit, the range check used to be a no-op. Expected values are
+ * glibc expf, the subnormal results are rounded correctly.
+ */
+
+#include "libm_tests.h"
+#include "almtestvec.h"
+
+/* the vector kernel is within 1 ulp of the correctly rounded table */
+static const uint64_t maxulp = 1;
+
+static libm_test_special_data_f32 test_expf_vector_special_data[] = {
+    {0x00000000, 0x3f800000, 0,},             //0, 1
+    {0x80000000, 0x3f800000, 0,},             //-0, 1
+    {0x7f800000, 0x7f800000, 0,},             //inf, inf
+    {0xff800000, 0x00000000, 0,},             //-inf, 0
+    {0x7fc00000, 0x7fc00000, 0,},             //qnan
+    {0xffc00000, 0xffc00000, 0,},             //-qnan
+    {0x7fa00000, 0x7fe00000, FE_INVALID,},    //snan
+    {0x3f800000, 0x402df854, 0,},             //1, e
+    {0x42b17217, 0x7f7fff84, 0,},             //largest x with a finite result
+    {0x42b17218, 0x7f800000, FE_OVERFLOW,},
+    {0x42b20000, 0x7f800000, FE_OVERFLOW,},
+    {0x42c80000, 0x7f800000, FE_OVERFLOW,},
+    {0x7f7fffff, 0x7f800000, FE_OVERFLOW,},   //max float
+    {0xff7fffff, 0x00000000, FE_UNDERFLOW,},  //-max float
+    {0xc2aeac4f, 0x00800026, 0,},             //smallest x with a normal result
+    {0xc2aeac50, 0x007fffe6, FE_UNDERFLOW,},  //subnormal results
+    {0xc2b00000, 0x0041edc4, FE_UNDERFLOW,},
+    {0xc2c00000, 0x000005a9, FE_UNDERFLOW,},
+    {0xc2cff1b4, 0x00000001, FE_UNDERFLOW,},  //smallest x with a nonzero result
+    {0xc2cff1b5, 0x00000000, FE_UNDERFLOW,},
+    {0xc2d00000, 0x00000000, FE_UNDERFLOW,},
+    {0xc2e00000, 0x00000000, FE_UNDERFLOW,},
+    {0x00000001, 0x3f800000, 0,},             //min denormal
+    {0x80000001, 0x3f800000, 0,},
+    {0xc2a00000, 0x05bfecba, 0,},             //-80
+    {0x42a00000, 0x792abbce, 0,},             //80
+    {0x3fb8aa3b, 0x40876d40, 0,},             //log2(e)
+    {0xbf800000, 0x3ebc5ab2, 0,},             //-1
+    {0xc2b8c000, 0x0000d476, FE_UNDERFLOW,},
+    {0x42b17200, 0x7f7ff404, 0,},
+    {0xc2ce0000, 0x00000001, FE_UNDERFLOW,},
+    {0x7f800000, 0x7f800000, 0,},
+};
+
+TEST(EXP, CONFORMANCE_FLOAT_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_expf_vector_special_data);
+  ConfCheckVec<float>("vrs8_expf", test_expf_vector_special_data, n, 1, 8, test_v8s, maxulp);
+}
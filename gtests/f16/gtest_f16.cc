@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Exhaustive check of the half precision kernels.
+ *
+ * Every binary16 input goes through every kernel of the dispatch tables
+ * the host can run: the scalar, vrh8, vrh16, vrh32 and array slots of
+ * each uarch row, the array ones in calls of 1 to 37 elements for the
+ * tails. pow takes 65536 pairs of random bit patterns and 65536 pairs
+ * with x in (0, 65504] and |y| <= 16.
+ *
+ * The reference is the double precision function rounded once to half.
+ * The kernels evaluate in float and round the float result to half, so a
+ * float result within a float ulp of a half rounding midpoint can land on
+ * the neighbour of the correctly rounded half. A result passes when it is
+ * the correctly rounded half or one of its two neighbours; zeros must
+ * carry the right sign, NaNs of any sign and payload match each other and
+ * a NaN never matches a number. The count of results that are not the
+ * correctly rounded ones is printed per kernel.
+ */
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <immintrin.h>
+#include "gtest.h"
+#include <external/amdlibm.h>
+#include <libm/iface.h>
+
+typedef double (*ref1_t)(double);
+typedef double (*ref2_t)(double, double);
+
+static const char *uarch_names[ALM_UARCH_MAX] = {
+    "default", "base64", "fma3", "zen", "zen2", "zen3", "zen4", "zen5",
+};
+
+static double HalfToDouble(uint16_t h) {
+  int e = (h >> 10) & 0x1f, m = h & 0x3ff;
+  double d;
+
+  if (e == 0x1f)
+    d = m ? NAN : INFINITY;
+  else if (e == 0)
+    d = ldexp(m, -24);
+  else
+    d = ldexp(m | 0x400, e - 25);
+
+  return (h & 0x8000) ? -d : d;
+}
+
+/* Round to nearest even, the scaled significands are exact in double */
+static uint16_t DoubleToHalf(double d) {
+  uint16_t s = std::signbit(d) ? 0x8000 : 0;
+  double a = fabs(d);
+  int e;
+
+  if (std::isnan(d))
+    return s | 0x7e00;
+  if (a >= 65520.0)                     /* halfway from 65504 to 2^16 */
+    return s | 0x7c00;
+  if (a < 0x1p-14)                      /* subnormal, 1024 is the smallest normal */
+    return s | (uint16_t)nearbyint(a * 0x1p24);
+
+  frexp(a, &e);                         /* a in [2^(e-1), 2^e) */
+  uint32_t m = (uint32_t)nearbyint(ldexp(a, 11 - e));
+  if (m == 2048) {
+    m = 1024;
+    e++;
+  }
+  return s | (uint16_t)(((e + 14) << 10) | (m - 1024));
+}
+
+static bool HalfIsNan(uint16_t h) {
+  return (h & 0x7fff) > 0x7c00;
+}
+
+/* Position on the number line, consecutive halves differ by one */
+static int HalfOrdinal(uint16_t h) {
+  return (h & 0x8000) ? -(int)(h & 0x7fff) : (int)h;
+}
+
+/* Distance in half ulps from the expected e to the actual a, -1 for a class mismatch */
+static int HalfDistance(uint16_t e, uint16_t a) {
+  if (HalfIsNan(e) || HalfIsNan(a))
+    return (HalfIsNan(e) && HalfIsNan(a)) ? 0 : -1;
+  if (e != a && (e & 0x7fff) == 0 && (a & 0x7fff) == 0)
+    return -1;                          /* zero of the wrong sign */
+  return abs(HalfOrdinal(e) - HalfOrdinal(a));
+}
+
+/* Runs the kernel fn of a half precision slot over n elements, n a multiple of 32 */
+static void RunF16(int slot, void *fn, bool binary, const uint16_t *x,
+                   const uint16_t *y, uint16_t *r, size_t n) {
+  f16_t *px = (f16_t *)x, *py = (f16_t *)y, *pr = (f16_t *)r;
+
+  switch (slot) {
+  case ALM_FUNC_SCAL_HP:
+    for (size_t i = 0; i < n; i++)
+      pr[i] = binary ? ((f16_t (*)(f16_t, f16_t))fn)(px[i], py[i])
+                     : ((f16_t (*)(f16_t))fn)(px[i]);
+    break;
+  case ALM_FUNC_VECT_HP_8:
+    for (size_t i = 0; i < n; i += 8) {
+      __m128i vx = _mm_loadu_si128((const __m128i *)&x[i]);
+      __m128i vy = _mm_loadu_si128((const __m128i *)&y[i]);
+      __m128i vr = binary ? ((__m128i (*)(__m128i, __m128i))fn)(vx, vy)
+                          : ((__m128i (*)(__m128i))fn)(vx);
+      _mm_storeu_si128((__m128i *)&r[i], vr);
+    }
+    break;
+  case ALM_FUNC_VECT_HP_16:
+    for (size_t i = 0; i < n; i += 16) {
+      __m256i vx = _mm256_loadu_si256((const __m256i *)&x[i]);
+      __m256i vy = _mm256_loadu_si256((const __m256i *)&y[i]);
+      __m256i vr = binary ? ((__m256i (*)(__m256i, __m256i))fn)(vx, vy)
+                          : ((__m256i (*)(__m256i))fn)(vx);
+      _mm256_storeu_si256((__m256i *)&r[i], vr);
+    }
+    break;
+#if defined(__AVX512__)
+  case ALM_FUNC_VECT_HP_32:
+    for (size_t i = 0; i < n; i += 32) {
+      __m512i vx = _mm512_loadu_si512((const void *)&x[i]);
+      __m512i vy = _mm512_loadu_si512((const void *)&y[i]);
+      __m512i vr = binary ? ((__m512i (*)(__m512i, __m512i))fn)(vx, vy)
+                          : ((__m512i (*)(__m512i))fn)(vx);
+      _mm512_storeu_si512((void *)&r[i], vr);
+    }
+    break;
+#endif
+  case ALM_FUNC_VECT_HP_ARR:
+    for (size_t i = 0, len = 1; i < n; i += len, len = len % 37 + 1) {
+      int k = (int)(n - i < len ? n - i : len);
+      if (binary)
+        ((void (*)(int, f16_t *, f16_t *, f16_t *))fn)(k, px + i, py + i, pr + i);
+      else
+        ((void (*)(int, f16_t *, f16_t *))fn)(k, px + i, pr + i);
+    }
+    break;
+  }
+}
+
+/*
+ * Checks every half precision kernel of func the host can run against
+ * ref over the inputs x (and y for a binary ref2).
+ */
+static void CheckF16(const char *func, ref1_t ref1, ref2_t ref2,
+                     const std::vector<uint16_t> &x,
+                     const std::vector<uint16_t> &y) {
+  static const int slots[] = {ALM_FUNC_SCAL_HP, ALM_FUNC_VECT_HP_8,
+                              ALM_FUNC_VECT_HP_16, ALM_FUNC_VECT_HP_32,
+                              ALM_FUNC_VECT_HP_ARR};
+  static const char *slot_names[] = {"s1h", "v8h", "v16h", "v32h", "vah"};
+  int host = (int)alm_iface_uarch();
+  const struct alm_arch_funcs *t = NULL;
+  size_t n = x.size();
+  std::vector<uint16_t> expected(n), r(n);
+  int nkernels = 0;
+
+  for (int e = 1; e < C_AMD_LAST_ENTRY && !t; e++)
+    if (alm_iface_name(e) && !strcmp(alm_iface_name(e), func))
+      t = alm_iface_funcs(e);
+  ASSERT_TRUE(t != NULL) << func << " is not in the dispatch tables";
+
+  for (size_t i = 0; i < n; i++)
+    expected[i] = DoubleToHalf(ref2 ? ref2(HalfToDouble(x[i]), HalfToDouble(y[i]))
+                                    : ref1(HalfToDouble(x[i])));
+
+  for (size_t s = 0; s < sizeof(slots) / sizeof(slots[0]); s++) {
+    std::vector<void *> seen;
+
+#if !defined(__AVX512__)
+    if (slots[s] == ALM_FUNC_VECT_HP_32)
+      continue;
+#endif
+    if (slots[s] == ALM_FUNC_VECT_HP_32 && host < ALM_UARCH_VER_ZEN4)
+      continue;
+
+    for (int row = host; row >= 0; row--) {
+      void *fn = t->funcs[row][slots[s]];
+      size_t nfail = 0, noff = 0;
+
+      if (!fn || std::find(seen.begin(), seen.end(), fn) != seen.end())
+        continue;
+      seen.push_back(fn);
+      nkernels++;
+
+      RunF16(slots[s], fn, ref2 != NULL, x.data(), y.data(), r.data(), n);
+
+      for (size_t i = 0; i < n; i++) {
+        int d = HalfDistance(expected[i], r[i]);
+        if (d == 0)
+          continue;
+        if (d == 1) {
+          noff++;
+          continue;
+        }
+        if (nfail++ < 4) {
+          ::testing::Message msg;
+          msg << func << "/" << slot_names[s] << "/" << uarch_names[row]
+              << ": input 0x" << std::hex << x[i];
+          if (ref2)
+            msg << ", 0x" << y[i];
+          msg << " expected 0x" << expected[i] << " actual 0x" << r[i];
+          ADD_FAILURE() << msg;
+        }
+      }
+      printf("%s/%s/%s: %zu of %zu results one half ulp off\n", func,
+             slot_names[s], uarch_names[row], noff, n);
+      EXPECT_EQ(nfail, 0u) << func << "/" << slot_names[s] << "/"
+                           << uarch_names[row] << " results more than one half ulp off";
+    }
+  }
+  EXPECT_GT(nkernels, 0) << func << " has no half precision kernel";
+}
+
+static std::vector<uint16_t> AllHalves(void) {
+  std::vector<uint16_t> x(0x10000);
+  for (size_t i = 0; i < x.size(); i++)
+    x[i] = (uint16_t)i;
+  return x;
+}
+
+static void CheckUnaryF16(const char *func, ref1_t ref) {
+  std::vector<uint16_t> x = AllHalves();
+  CheckF16(func, ref, NULL, x, x);
+}
+
+TEST(F16, EXHAUSTIVE_EXP)  { CheckUnaryF16("exp",  [](double v) { return exp(v); }); }
+TEST(F16, EXHAUSTIVE_LOG)  { CheckUnaryF16("log",  [](double v) { return log(v); }); }
+TEST(F16, EXHAUSTIVE_SIN)  { CheckUnaryF16("sin",  [](double v) { return sin(v); }); }
+TEST(F16, EXHAUSTIVE_COS)  { CheckUnaryF16("cos",  [](double v) { return cos(v); }); }
+TEST(F16, EXHAUSTIVE_TANH) { CheckUnaryF16("tanh", [](double v) { return tanh(v); }); }
+TEST(F16, EXHAUSTIVE_ERF)  { CheckUnaryF16("erf",  [](double v) { return erf(v); }); }
+TEST(F16, EXHAUSTIVE_SQRT) { CheckUnaryF16("sqrt", [](double v) { return sqrt(v); }); }
+
+TEST(F16, RANDOM_POW) {
+  std::mt19937 gen(0x16);
+  std::vector<uint16_t> x(0x20000), y(0x20000);
+
+  /* random bit patterns, then x in (0, 65504] and |y| <= 16 */
+  for (size_t i = 0; i < 0x10000; i++) {
+    x[i] = (uint16_t)gen();
+    y[i] = (uint16_t)gen();
+  }
+  for (size_t i = 0x10000; i < x.size(); i++) {
+    x[i] = (uint16_t)(gen() % 0x7bff + 1);
+    y[i] = (uint16_t)((gen() % 0x4c01) | (gen() & 0x8000));
+  }
+  CheckF16("pow", NULL, [](double a, double b) { return pow(a, b); }, x, y);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -48,7 +48,13 @@ bool isComplexFunction(string s)
 {
     if( (s == "cexp") ||
         (s == "clog") ||
-        (s == "cpow") )
+        (s == "cpow") ||
+        (s == "csin") ||
+        (s == "ccos") ||
+        (s == "ctan") ||
+        (s == "csqrt") ||
+        (s == "cabs") ||
+        (s == "carg") )
     {
         return true;
     }
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef LIBM_FINITE_TEST_H_INCLUDED
+#define LIBM_FINITE_TEST_H_INCLUDED
+
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <immintrin.h>
+
+/*
+ * Number of inputs per function, and the largest error accepted from any
+ * of the scalar, vector and array variants, in ulps
+ */
+#define FINITE_TEST_COUNT   4096
+#define FINITE_MAX_ULP      4.0
+
+extern int test_exp(void*);
+extern int test_log(void*);
+
+/*scalar*/
+typedef double  (*func_d)      (double);
+typedef float   (*funcf_s)     (float);
+
+/*vector*/
+typedef __m128d (*func_v2d)    (__m128d);
+typedef __m256d (*func_v4d)    (__m256d);
+typedef __m128  (*funcf_v4s)   (__m128);
+typedef __m256  (*funcf_v8s)   (__m256);
+
+/*array*/
+typedef void    (*func_vad)    (int, double*, double*);
+typedef void    (*funcf_vas)   (int, float*, float*);
+
+typedef long double (*ref_func)(long double);
+
+/*
+ * Run every double precision variant of 'name' (amd_<name>_finite,
+ * __<name>_finite, amd_vrd2/vrd4/vrda_<name>_finite) on 'count' inputs
+ * and compare with 'ref'. Returns the number of variants exceeding
+ * FINITE_MAX_ULP or missing from the library.
+ */
+extern int check_finite_d(void *handle, const char *name, ref_func ref,
+                          double *input, int count);
+
+/* Same for the single precision variants, vrs4/vrs8/vrsa */
+extern int check_finite_s(void *handle, const char *name, ref_func ref,
+                          float *input, int count);
+
+#endif  /* LIBM_FINITE_TEST_H_INCLUDED */
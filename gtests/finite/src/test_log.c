@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <math.h>
+#include "libm_finite_test.h"
+
+/* Inputs are spread over all normal binades, and around 1.0 */
+int test_log(void* handle) {
+    static double input_d[FINITE_TEST_COUNT];
+    static float  input_s[FINITE_TEST_COUNT];
+    int i, fails = 0;
+
+    srand(2);
+    for (i = 0; i < FINITE_TEST_COUNT; i++) {
+        double m = 1.0 + (double)rand() / RAND_MAX;
+        if (i % 4 == 0) {
+            input_d[i] = 0.9 + 0.2 * (m - 1.0);
+            input_s[i] = (float)input_d[i];
+        } else {
+            input_d[i] = ldexp(m, rand() % 2046 - 1022);
+            input_s[i] = (float)ldexp(m, rand() % 254 - 126);
+        }
+    }
+
+    fails += check_finite_d(handle, "log", logl, input_d, FINITE_TEST_COUNT);
+    fails += check_finite_s(handle, "logf", logl, input_s, FINITE_TEST_COUNT);
+
+    return fails;
+}
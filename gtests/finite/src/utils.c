@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <math.h>
+#include <string.h>
+#include "libm_finite_test.h"
+
+static double ulp_error(long double ref, long double val, int mant_bits)
+{
+    int e;
+
+    frexpl(ref, &e);
+    return (double)(fabsl(val - ref) / ldexpl(1.0L, e - mant_bits));
+}
+
+static void *lookup(void *handle, const char *fmt, const char *name)
+{
+    char sym[64];
+
+    snprintf(sym, sizeof(sym), fmt, name);
+    return dlsym(handle, sym);
+}
+
+static int report(const char *fmt, const char *name, double max_ulp)
+{
+    char sym[64];
+
+    snprintf(sym, sizeof(sym), fmt, name);
+    printf("%-24s max %.3f ulp %s\n", sym, max_ulp,
+           max_ulp <= FINITE_MAX_ULP ? "PASS" : "FAIL");
+    return max_ulp > FINITE_MAX_ULP;
+}
+
+static int missing(const char *fmt, const char *name)
+{
+    char sym[64];
+
+    snprintf(sym, sizeof(sym), fmt, name);
+    printf("%-24s not found          FAIL\n", sym);
+    return 1;
+}
+
+int check_finite_d(void *handle, const char *name, ref_func ref,
+                   double *input, int count)
+{
+    static const char *scalars[] = {"amd_%s_finite", "__%s_finite"};
+    double *output = malloc(sizeof(double) * (size_t)count);
+    double max_ulp;
+    int i, j, fails = 0;
+
+    for (j = 0; j < 2; j++) {
+        func_d f = (func_d)lookup(handle, scalars[j], name);
+        if (f == NULL) {
+            fails += missing(scalars[j], name);
+            continue;
+        }
+        for (max_ulp = 0, i = 0; i < count; i++)
+            max_ulp = fmax(max_ulp, ulp_error(ref(input[i]), f(input[i]), 53));
+        fails += report(scalars[j], name, max_ulp);
+    }
+
+    func_v2d f2 = (func_v2d)lookup(handle, "amd_vrd2_%s_finite", name);
+    if (f2 == NULL) {
+        fails += missing("amd_vrd2_%s_finite", name);
+    } else {
+        for (i = 0; i + 2 <= count; i += 2)
+            _mm_storeu_pd(&output[i], f2(_mm_loadu_pd(&input[i])));
+        for (max_ulp = 0, i = 0; i < count - count % 2; i++)
+            max_ulp = fmax(max_ulp, ulp_error(ref(input[i]), output[i], 53));
+        fails += report("amd_vrd2_%s_finite", name, max_ulp);
+    }
+
+    func_v4d f4 = (func_v4d)lookup(handle, "amd_vrd4_%s_finite", name);
+    if (f4 == NULL) {
+        fails += missing("amd_vrd4_%s_finite", name);
+    } else {
+        for (i = 0; i + 4 <= count; i += 4)
+            _mm256_storeu_pd(&output[i], f4(_mm256_loadu_pd(&input[i])));
+        for (max_ulp = 0, i = 0; i < count - count % 4; i++)
+            max_ulp = fmax(max_ulp, ulp_error(ref(input[i]), output[i], 53));
+        fails += report("amd_vrd4_%s_finite", name, max_ulp);
+    }
+
+    func_vad fa = (func_vad)lookup(handle, "amd_vrda_%s_finite", name);
+    if (fa == NULL) {
+        fails += missing("amd_vrda_%s_finite", name);
+    } else {
+        /* odd length to exercise the tail handling */
+        memset(output, 0, sizeof(double) * (size_t)count);
+        fa(count - 3, input, output);
+        for (max_ulp = 0, i = 0; i < count - 3; i++)
+            max_ulp = fmax(max_ulp, ulp_error(ref(input[i]), output[i], 53));
+        fails += report("amd_vrda_%s_finite", name, max_ulp);
+    }
+
+    free(output);
+    return fails;
+}
+
+int check_finite_s(void *handle, const char *name, ref_func ref,
+                   float *input, int count)
+{
+    static const char *scalars[] = {"amd_%s_finite", "__%s_finite"};
+    float *output = malloc(sizeof(float) * (size_t)count);
+    double max_ulp;
+    int i, j, fails = 0;
+
+    for (j = 0; j < 2; j++) {
+        funcf_s f = (funcf_s)lookup(handle, scalars[j], name);
+        if (f == NULL) {
+            fails += missing(scalars[j], name);
+            continue;
+        }
+        for (max_ulp = 0, i = 0; i < count; i++)
+            max_ulp = fmax(max_ulp, ulp_error(ref(input[i]), f(input[i]), 24));
+        fails += report(scalars[j], name, max_ulp);
+    }
+
+    funcf_v4s f4 = (funcf_v4s)lookup(handle, "amd_vrs4_%s_finite", name);
+    if (f4 == NULL) {
+        fails += missing("amd_vrs4_%s_finite", name);
+    } else {
+        for (i = 0; i + 4 <= count; i += 4)
+            _mm_storeu_ps(&output[i], f4(_mm_loadu_ps(&input[i])));
+        for (max_ulp = 0, i = 0; i < count - count % 4; i++)
+            max_ulp = fmax(max_ulp, ulp_error(ref(input[i]), output[i], 24));
+        fails += report("amd_vrs4_%s_finite", name, max_ulp);
+    }
+
+    funcf_v8s f8 = (funcf_v8s)lookup(handle, "amd_vrs8_%s_finite", name);
+    if (f8 == NULL) {
+        fails += missing("amd_vrs8_%s_finite", name);
+    } else {
+        for (i = 0; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(&output[i], f8(_mm256_loadu_ps(&input[i])));
+        for (max_ulp = 0, i = 0; i < count - count % 8; i++)
+            max_ulp = fmax(max_ulp, ulp_error(ref(input[i]), output[i], 24));
+        fails += report("amd_vrs8_%s_finite", name, max_ulp);
+    }
+
+    funcf_vas fa = (funcf_vas)lookup(handle, "amd_vrsa_%s_finite", name);
+    if (fa == NULL) {
+        fails += missing("amd_vrsa_%s_finite", name);
+    } else {
+        memset(output, 0, sizeof(float) * (size_t)count);
+        fa(count - 3, input, output);
+        for (max_ulp = 0, i = 0; i < count - 3; i++)
+            max_ulp = fmax(max_ulp, ulp_error(ref(input[i]), output[i], 24));
+        fails += report("amd_vrsa_%s_finite", name, max_ulp);
+    }
+
+    free(output);
+    return fails;
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <cmath>
+#include <vector>
+#include "libm_tests.h"
+#include <libm_macros.h>
+
+#define AMD_LIBM_VEC_EXPERIMENTAL
+
+#include <libm_amd.h>
+#include <libm/amd_funcs_internal.h>
+#include <fmaintrin.h>
+#include <immintrin.h>
+#include "callback.h"
+#include "test_frexp_data.h"
+#include "../libs/mparith/alm_mp_funcs.h"
+
+static uint32_t ipargs = 1;
+bool special_case = false;
+
+uint32_t GetnIpArgs( void )
+{
+	return ipargs;
+}
+
+bool getSpecialCase(void)
+{
+  return special_case;
+}
+
+void ConfSetupf32(SpecParams *specp) {
+  specp->data32 = test_frexpf_conformance_data;
+  specp->countf = ARRAY_SIZE(test_frexpf_conformance_data);
+}
+
+void ConfSetupf64(SpecParams *specp) {
+  specp->data64 = test_frexp_conformance_data;
+  specp->countd = ARRAY_SIZE(test_frexp_conformance_data);
+}
+
+/*
+ * The framework compares one result per input, which for frexp is the
+ * mantissa. The exponent is checked against the C library here, a lane
+ * whose exponent differs reports NaN in place of its mantissa so that it
+ * is counted as a failure.
+ */
+template <typename T, typename I>
+static void CheckExpo(const T *ip, T *op, const I *expo, int n) {
+  for (int j = 0; j < n; j++) {
+    int e = 0;
+    std::frexp(ip[j], &e);
+    if (std::isfinite(ip[j]) && expo[j] != e)
+      op[j] = NAN;
+  }
+}
+
+float getFuncOp(float *data) {
+  int e;
+  return LIBM_FUNC(frexpf)(data[0], &e);
+}
+
+double getFuncOp(double *data) {
+  int e;
+  return LIBM_FUNC(frexp)(data[0], &e);
+}
+
+double getExpected(float *data) {
+  int e;
+  return frexpf(data[0], &e);
+}
+
+long double getExpected(double *data) {
+  int e;
+  return frexpl(data[0], &e);
+}
+
+// Used by the Complex Number Functions only!
+double _Complex getExpected(float _Complex *data) {
+  return {0};
+}
+
+long double _Complex getExpected(double _Complex *data) {
+  return {0};
+}
+
+float getGlibcOp(float *data) {
+  int e;
+  return frexpf(data[0], &e);
+}
+
+double getGlibcOp(double *data) {
+  int e;
+  return frexp(data[0], &e);
+}
+
+/**********************
+*FUNCTIONS*
+**********************/
+int test_s1s(test_data *data, int idx)  {
+  float *ip  = (float*)data->ip;
+  float *op  = (float*)data->op;
+  int e;
+  op[0] = LIBM_FUNC(frexpf)(ip[idx], &e);
+  CheckExpo(&ip[idx], op, &e, 1);
+  return 0;
+}
+
+int test_s1d(test_data *data, int idx)  {
+  double *ip  = (double*)data->ip;
+  double *op  = (double*)data->op;
+  int e;
+  op[0] = LIBM_FUNC(frexp)(ip[idx], &e);
+  CheckExpo(&ip[idx], op, &e, 1);
+  return 0;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// FIXME: No V2D version available for frexp
+int test_v2d(test_data *data, int idx)  {
+  return 0;
+}
+
+// FIXME: No V4S version available for frexp
+int test_v4s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4d(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  double *ip  = (double*)data->ip;
+  double *op  = (double*)data->op;
+  int64_t e[4];
+  __m256i e4;
+  __m256d ip4 = _mm256_set_pd(ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
+  __m256d op4 = amd_vrd4_frexp(ip4, &e4);
+  _mm256_store_pd(&op[0], op4);
+  _mm256_storeu_si256((__m256i*)e, e4);
+  CheckExpo(&ip[idx], op, e, 4);
+#endif
+  return 0;
+}
+
+int test_v8s(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  float *ip  = (float*)data->ip;
+  float *op  = (float*)data->op;
+  int32_t e[8];
+  __m256i e8;
+  __m256 ip8 = _mm256_set_ps(ip[idx+7], ip[idx+6], ip[idx+5], ip[idx+4],
+                             ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
+  __m256 op8 = amd_vrs8_frexpf(ip8, &e8);
+  _mm256_store_ps(&op[0], op8);
+  _mm256_storeu_si256((__m256i*)e, e8);
+  CheckExpo(&ip[idx], op, e, 8);
+#endif
+  return 0;
+}
+
+int test_v8d(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  #if defined(__AVX512__)
+    double *ip  = (double*)data->ip;
+    double *op  = (double*)data->op;
+    int64_t e[8];
+    __m512i e8;
+    __m512d ip8 = _mm512_loadu_pd(&ip[idx]);
+    __m512d op8 = amd_vrd8_frexp(ip8, &e8);
+    _mm512_store_pd(&op[0], op8);
+    _mm512_storeu_si512(e, e8);
+    CheckExpo(&ip[idx], op, e, 8);
+  #endif
+#endif
+  return 0;
+}
+
+int test_v16s(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  #if defined(__AVX512__)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    int32_t e[16];
+    __m512i e16;
+    __m512 ip16 = _mm512_loadu_ps(&ip[idx]);
+    __m512 op16 = amd_vrs16_frexpf(ip16, &e16);
+    _mm512_store_ps(&op[0], op16);
+    _mm512_storeu_si512(e, e16);
+    CheckExpo(&ip[idx], op, e, 16);
+  #endif
+#endif
+  return 0;
+}
+
+int test_vad(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  double *ip  = (double*)data->ip;
+  double *op  = (double*)data->op;
+  std::vector<int> e(count);
+  amd_vrda_frexp(count, ip, op, e.data());
+  CheckExpo(ip, op, e.data(), count);
+#endif
+  return 0;
+}
+
+int test_vas(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  float *ip  = (float*)data->ip;
+  float *op  = (float*)data->op;
+  std::vector<int> e(count);
+  amd_vrsa_frexpf(count, ip, op, e.data());
+  CheckExpo(ip, op, e.data(), count);
+#endif
+  return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
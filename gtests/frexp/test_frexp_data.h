@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Test cases to check the conformance of the frexpf() routine.
+ * The output is the mantissa, the exponent is checked by the callback.
+ */
+static libm_test_special_data_f32
+test_frexpf_conformance_data[] = {
+    /* Test Inputs of -/+0, returned unchanged with exponent 0 */
+    {POS_ZERO_F32,    POS_ZERO_F32,      0},
+    {NEG_ZERO_F32,    NEG_ZERO_F32,      0},
+
+    /* Test Inputs of -/+inf, returned unchanged */
+    {POS_INF_F32,     POS_INF_F32,       0},
+    {NEG_INF_F32,     NEG_INF_F32,       0},
+
+    /* Test Inputs that are signalling and quiet NaNs */
+    {POS_SNAN_F32,    POS_SNAN_Q_F32,    FE_INVALID},
+    {NEG_SNAN_F32,    NEG_SNAN_Q_F32,    FE_INVALID},
+    {POS_QNAN_F32,    QNANBITPATT_SP32,  0},
+    {NEG_QNAN_F32,    INDEFBITPATT_SP32, 0},
+
+    /* Test Inputs that are standard, denormalized and extreme */
+    {POS_ONE_F32,     0x3f000000,        0}, // 1 = 0.5 * 2^1
+    {NEG_ONE_F32,     0xbf000000,        0}, // -1 = -0.5 * 2^1
+    {0x40490fdb,      0x3f490fdb,        0}, // pi = 0.785398185 * 2^2
+    {POS_HDENORM_F32, 0x3f7ffffe,        0}, // 0.999999881 * 2^-126
+    {NEG_HDENORM_F32, 0xbf7ffffe,        0}, // -0.999999881 * 2^-126
+    {POS_LDENORM_F32, 0x3f000000,        0}, // 0.5 * 2^-148
+    {NEG_LDENORM_F32, 0xbf000000,        0}, // -0.5 * 2^-148
+    {0x00400000,      0x3f000000,        0}, // 0.5 * 2^-126
+    {POS_HNORMAL_F32, 0x3f7fffff,        0}, // 0.99999994 * 2^128
+    {NEG_HNORMAL_F32, 0xbf7fffff,        0}, // -0.99999994 * 2^128
+    {POS_LNORMAL_F32, 0x3f000000,        0}, // 0.5 * 2^-125
+    {NEG_LNORMAL_F32, 0xbf000000,        0}, // -0.5 * 2^-125
+    {0x3f000000,      0x3f000000,        0}, // 0.5 = 0.5 * 2^0
+    {0x3effffff,      0x3f7fffff,        0}, // 0.99999994 * 2^-1
+    {0x40400000,      0x3f400000,        0}, // 3 = 0.75 * 2^2
+    {0xc2c80000,      0xbf480000,        0}, // -100 = -0.78125 * 2^7
+    {0x4b000001,      0x3f000001,        0}, // 8388609 = 0.50000006 * 2^24
+    {0x33d6bf95,      0x3f56bf95,        0}, // 1e-07 = 0.83886081 * 2^-23
+};
+
+/*
+ * Test cases to check the conformance of the frexp() routine.
+ * The output is the mantissa, the exponent is checked by the callback.
+ */
+static libm_test_special_data_f64
+test_frexp_conformance_data[] = {
+    /* Test Inputs of -/+0, returned unchanged with exponent 0 */
+    {POS_ZERO_F64,         POS_ZERO_F64,         0},
+    {NEG_ZERO_F64,         NEG_ZERO_F64,         0},
+
+    /* Test Inputs of -/+inf, returned unchanged */
+    {POS_INF_F64,          POS_INF_F64,          0},
+    {NEG_INF_F64,          NEG_INF_F64,          0},
+
+    /* Test Inputs that are signalling and quiet NaNs */
+    {POS_SNAN_F64,         POS_SNAN_Q_F64,       FE_INVALID},
+    {NEG_SNAN_F64,         NEG_SNAN_Q_F64,       FE_INVALID},
+    {POS_QNAN_F64,         QNANBITPATT_DP64,     0},
+    {NEG_QNAN_F64,         NEG_QNAN_F64,         0},
+
+    /* Test Inputs that are standard, denormalized and extreme */
+    {POS_ONE_F64,          0x3fe0000000000000LL, 0}, // 1 = 0.5 * 2^1
+    {NEG_ONE_F64,          0xbfe0000000000000LL, 0}, // -1 = -0.5 * 2^1
+    {POS_PI_F64,           0x3fe921fb54442d18LL, 0}, // pi = 0.78539816339744828 * 2^2
+    {POS_HDENORM_F64,      0x3feffffffffffffeLL, 0}, // 0.99999999999999978 * 2^-1022
+    {NEG_HDENORM_F64,      0xbfeffffffffffffeLL, 0}, // -0.99999999999999978 * 2^-1022
+    {POS_LDENORM_F64,      0x3fe0000000000000LL, 0}, // 0.5 * 2^-1073
+    {NEG_LDENORM_F64,      0xbfe0000000000000LL, 0}, // -0.5 * 2^-1073
+    {0x0008000000000000LL, 0x3fe0000000000000LL, 0}, // 0.5 * 2^-1022
+    {POS_HNORMAL_F64,      0x3fefffffffffffffLL, 0}, // 0.99999999999999989 * 2^1024
+    {NEG_HNORMAL_F64,      0xbfefffffffffffffLL, 0}, // -0.99999999999999989 * 2^1024
+    {POS_LNORMAL_F64,      0x3fe0000000000000LL, 0}, // 0.5 * 2^-1021
+    {NEG_LNORMAL_F64,      0xbfe0000000000000LL, 0}, // -0.5 * 2^-1021
+    {0x3fe0000000000000LL, 0x3fe0000000000000LL, 0}, // 0.5 = 0.5 * 2^0
+    {0x3fdfffffffffffffLL, 0x3fefffffffffffffLL, 0}, // 0.99999999999999989 * 2^-1
+    {0x4008000000000000LL, 0x3fe8000000000000LL, 0}, // 3 = 0.75 * 2^2
+    {0xc059000000000000LL, 0xbfe9000000000000LL, 0}, // -100 = -0.78125 * 2^7
+    {0x4330000000000001LL, 0x3fe0000000000001LL, 0}, // 2^52+1 = 0.50000000000000011 * 2^53
+    {0x3d3c25c268497682LL, 0x3fec25c268497682LL, 0}, // 1e-13 = 0.87960930222080003 * 2^-43
+};
@@ -63,52 +63,58 @@ string validateFilterData(string func, string filter_data)
 
     while(getline(ss, temp, ':'))
     {
-        if( (temp.find("SCALAR_FLOAT") != string::npos) || (temp.find("SCALAR_COMPLEX_FLOAT") != string::npos) )
+        /* complex variants are listed under the real variant names */
+        string var = temp;
+        size_t pos = var.find("COMPLEX_");
+        if(pos != string::npos)
+            var.erase(pos, string("COMPLEX_").length());
+
+        if(var.find("SCALAR_FLOAT") != string::npos)
         {
             if(find(supported_vars.begin(), supported_vars.end(), "s1f") != supported_vars.end())
                 new_filter_data.append(temp + ":");
         }
-        else if( (temp.find("SCALAR_DOUBLE") != string::npos) || (temp.find("SCALAR_COMPLEX_DOUBLE") != string::npos) )
+        else if(var.find("SCALAR_DOUBLE") != string::npos)
         {
             if(find(supported_vars.begin(), supported_vars.end(), "s1d") != supported_vars.end())
                 new_filter_data.append(temp + ":");
         }
-        else if(temp.find("VECTOR_2DOUBLES") != string::npos)
+        else if(var.find("VECTOR_2DOUBLES") != string::npos)
         {
             if(find(supported_vars.begin(), supported_vars.end(), "vrd2") != supported_vars.end())
                 new_filter_data.append(temp + ":");
         }
-        else if(temp.find("VECTOR_4DOUBLES") != string::npos)
+        else if(var.find("VECTOR_4DOUBLES") != string::npos)
         {
             if(find(supported_vars.begin(), supported_vars.end(), "vrd4") != supported_vars.end())
                 new_filter_data.append(temp + ":");
         }
-        else if(temp.find("VECTOR_8DOUBLES") != string::npos)
+        else if(var.find("VECTOR_8DOUBLES") != string::npos)
         {
             if(find(supported_vars.begin(), supported_vars.end(), "vrd8") != supported_vars.end())
                 new_filter_data.append(temp + ":");
         }
-        else if(temp.find("VECTOR_4FLOATS") != string::npos)
+        else if(var.find("VECTOR_4FLOATS") != string::npos)
         {
             if(find(supported_vars.begin(), supported_vars.end(), "vrs4") != supported_vars.end())
                 new_filter_data.append(temp + ":");
         }
-        else if(temp.find("VECTOR_8FLOATS") != string::npos)
+        else if(var.find("VECTOR_8FLOATS") != string::npos)
         {
             if(find(supported_vars.begin(), supported_vars.end(), "vrs8") != supported_vars.end())
                 new_filter_data.append(temp + ":");
         }
-        else if(temp.find("VECTOR_16FLOATS") != string::npos)
+        else if(var.find("VECTOR_16FLOATS") != string::npos)
         {
             if(find(supported_vars.begin(), supported_vars.end(), "vrs16") != supported_vars.end())
                 new_filter_data.append(temp + ":");
         }
-        else if(temp.find("VECTOR_ARRAY_DOUBLE") != string::npos)
+        else if(var.find("VECTOR_ARRAY_DOUBLE") != string::npos)
         {
             if(find(supported_vars.begin(), supported_vars.end(), "vrda") != supported_vars.end())
                 new_filter_data.append(temp + ":");
         }
-        else if(temp.find("VECTOR_ARRAY_FLOAT") != string::npos)
+        else if(var.find("VECTOR_ARRAY_FLOAT") != string::npos)
         {
             if(find(supported_vars.begin(), supported_vars.end(), "vrsa") != supported_vars.end())
                 new_filter_data.append(temp + ":");
@@ -124,6 +130,17 @@ string validateFilterDataConf(InputParams *params, string filter_data)
     stringstream ss(filter_data);
     string new_filter_data, temp;
 
+    /*
+     * Functions without a scalar variant, such as powx, have their own
+     * CONFORMANCE_*_VECTORS tests, run when the array variant exists.
+     */
+    auto has = [&supported_vars](const char *scalar, const char *array) {
+        if (find(supported_vars.begin(), supported_vars.end(), scalar) != supported_vars.end())
+            return true;
+        return find(supported_vars.begin(), supported_vars.end(), "s1f") == supported_vars.end() &&
+               find(supported_vars.begin(), supported_vars.end(), "s1d") == supported_vars.end() &&
+               find(supported_vars.begin(), supported_vars.end(), array) != supported_vars.end();
+    };
 
     if((params->fqty == ALM::FloatQuantity::E_Scalar) || (params->fqty == ALM::FloatQuantity::E_All))
     {
@@ -131,15 +148,25 @@ string validateFilterDataConf(InputParams *params, string filter_data)
         {
             if( (temp.find("FLOAT") != string::npos) || (temp.find("COMPLEX_FLOAT") != string::npos) )
             {
-                if(find(supported_vars.begin(), supported_vars.end(), "s1f") != supported_vars.end())
+                if(has("s1f", "vrsa"))
                     new_filter_data.append(temp + ":");
             }
             else if( (temp.find("DOUBLE") != string::npos) || (temp.find("COMPLEX_DOUBLE") != string::npos) )
             {
-                if(find(supported_vars.begin(), supported_vars.end(), "s1d") != supported_vars.end())
+                if(has("s1d", "vrda"))
                     new_filter_data.append(temp + ":");
             }
         }
     }
     return new_filter_data;
 }
+
+double getUlpBound(string func, ALM::FloatWidth fwidth)
+{
+    if(libm_ulp_bounds.find(func) == libm_ulp_bounds.end())
+        return 0;
+    vector<double> bounds = libm_ulp_bounds[func];
+    if(fwidth == ALM::FloatWidth::E_F32)
+        return bounds[0];
+    return bounds[1];
+}
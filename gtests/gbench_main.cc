@@ -27,32 +27,424 @@
 
 
 #include <cstdio>
+#include <cmath>
 #include <iostream>
+#include <fstream>
 #include <string>
 #include <cstring>
+#include <ctime>
+#include <map>
+#include <vector>
+#include <algorithm>
 #include "almstruct.h"
 #include "benchmark.h"
 #include "defs.h"
 #include "almtestperf.h"
 #include "cmdline.h"
 #include "callback.h"
+#include "libm_tests.h"
 
 using namespace std;
 
+/*
+ * Perf baselines, --save-baseline=<file> and --compare-baseline=<file>.
+ *
+ * Every benchmark is run --repetitions times and gbench's JSON reporter
+ * writes the runs to <file>.runs, which is read back and removed. A
+ * kernel is summarized by the median and the MAD (median absolute
+ * deviation) of its runs: MOPS in Melem/s for --type=perf, ns/call for
+ * --type=lat.
+ *
+ * The baseline file has one entry per line, keyed by benchmark name,
+ * library, uarch and type. Saving into an existing file replaces this
+ * run's entries and keeps the others, so one file can hold several
+ * functions, both types and several machines. The uarch is the host's,
+ * as the library's dispatcher sees it, and "kernel" is the dispatch table
+ * row the variant resolves to on it.
+ *
+ * A kernel has regressed when its median is worse than the baseline's by
+ * more than --threshold percent and by more than three times the robust
+ * standard deviation (1.4826 * MAD) of the difference of the two.
+ */
+
+struct BaselineEntry {
+  string name;
+  string library;
+  string uarch;
+  string kernel;
+  string type;
+  string unit;
+  int    reps;
+  double median;
+  double mad;
+
+  string key() const {
+    return name + '\t' + library + '\t' + uarch + '\t' + type;
+  }
+};
+
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+static const char baseline_library[] = "aocl";
+#elif (LIBM_PROTOTYPE == PROTOTYPE_GLIBC)
+static const char baseline_library[] = "glibc";
+#elif (LIBM_PROTOTYPE == PROTOTYPE_SVML)
+static const char baseline_library[] = "svml";
+#else
+static const char baseline_library[] = "other";
+#endif
+
+/*
+ * Value of "key" in a line of JSON, both the JSON reporter and the
+ * baseline writer put a run or an entry's fields on one line each or
+ * all on one line, and never nest them.
+ */
+static bool JsonField(const string &line, const string &key, string &val) {
+  size_t pos = line.find("\"" + key + "\": ");
+
+  if (pos == string::npos)
+    return false;
+  pos += key.size() + 4;
+
+  val.clear();
+  if (line[pos] == '"') {
+    for (pos++; pos < line.size() && line[pos] != '"'; pos++) {
+      if (line[pos] == '\\' && pos + 1 < line.size())
+        pos++;
+      val += line[pos];
+    }
+  } else {
+    size_t end = line.find_first_of(",}", pos);
+    val = line.substr(pos, end == string::npos ? string::npos : end - pos);
+    while (!val.empty() && isspace((unsigned char)val.back()))
+      val.pop_back();
+  }
+
+  return true;
+}
+
+static double Median(vector<double> v) {
+  size_t n = v.size();
+
+  if (!n)
+    return 0;
+  sort(v.begin(), v.end());
+  return n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+static double Mad(const vector<double> &v, double median) {
+  vector<double> d;
+
+  for (double x : v)
+    d.push_back(fabs(x - median));
+  return Median(d);
+}
+
+/*
+ * "AoclLibm_v4d(exp)/1000/iterations:10000" is kept as
+ * "AoclLibm_v4d(exp)/1000", so that baselines taken with a different
+ * --Iterations can be compared.
+ */
+static string BaselineName(const string &run_name) {
+  string name;
+  size_t pos = 0;
+
+  while (pos <= run_name.size()) {
+    size_t end = run_name.find('/', pos);
+    string seg = run_name.substr(pos, end == string::npos ? string::npos
+                                                          : end - pos);
+    if (pos == 0 || seg.find(':') == string::npos)
+      name += (pos ? "/" : "") + seg;
+    if (end == string::npos)
+      break;
+    pos = end + 1;
+  }
+
+  return name;
+}
+
+/* Host uarch and the dispatch table row of the variant in name */
+static void BaselineUarch(const string &func, const string &name,
+                          string &uarch, string &kernel) {
+  uarch = "unknown";
+  kernel = "";
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  int n = amd_libm_dispatch_get(NULL, NULL, 0);
+  size_t v0 = name.find('_'), v1 = name.find('(');
+
+  if (n <= 0)
+    return;
+
+  vector<struct amd_libm_kernel> k(n);
+  n = amd_libm_dispatch_get(NULL, k.data(), n);
+  uarch = k[0].sku;
+
+  if (v0 == string::npos || v1 == string::npos || v1 < v0)
+    return;
+  string variant = name.substr(v0 + 1, v1 - v0 - 1);
+
+  for (int i = 0; i < n; i++) {
+    if (func == k[i].func && variant == k[i].variant) {
+      kernel = k[i].uarch;
+      break;
+    }
+  }
+#endif
+}
+
+/*
+ * Reads the runs of every benchmark from the JSON reporter's output, the
+ * aggregates and the failed runs are left out.
+ */
+static bool ReadRuns(const string &path, InputParams *params,
+                     vector<BaselineEntry> &entries) {
+  bool lat = params->ttype == ALM::TestType::E_Latency;
+  map<string, vector<double>> runs;
+  vector<string> order;
+  ifstream in(path);
+  string line, val, name;
+  bool iteration = false, error = false;
+  double value = NAN;
+
+  if (!in) {
+    cerr << "Cannot read " << path << endl;
+    return false;
+  }
+
+  while (getline(in, line)) {
+    if (JsonField(line, "run_name", val)) {
+      name = BaselineName(val);
+      iteration = error = false;
+      value = NAN;
+    } else if (JsonField(line, "run_type", val)) {
+      iteration = val == "iteration";
+    } else if (JsonField(line, "error_occurred", val)) {
+      error = val == "true";
+    } else if (!lat && JsonField(line, "MOPS", val)) {
+      value = stod(val) / 1e6;
+    } else if (lat && JsonField(line, "ns/call", val)) {
+      value = stod(val);
+    } else if (lat && JsonField(line, "us/call", val)) {
+      value = stod(val) * 1000;
+    } else if (line.find('}') != string::npos && !name.empty()) {
+      if (iteration && !error && !std::isnan(value)) {
+        if (!runs.count(name))
+          order.push_back(name);
+        runs[name].push_back(value);
+      }
+      name.clear();
+    }
+  }
+
+  for (auto &n : order) {
+    BaselineEntry e;
+    auto &v = runs[n];
+
+    e.name = n;
+    e.library = baseline_library;
+    BaselineUarch(params->testFunction, n, e.uarch, e.kernel);
+    e.type = lat ? "lat" : "perf";
+    e.unit = lat ? "ns/call" : "Melem/s";
+    e.reps = (int)v.size();
+    e.median = Median(v);
+    e.mad = Mad(v, e.median);
+    entries.push_back(e);
+  }
+
+  return true;
+}
+
+static bool LoadBaseline(const string &path, vector<BaselineEntry> &entries) {
+  ifstream in(path);
+  string line, val;
+
+  if (!in)
+    return false;
+
+  while (getline(in, line)) {
+    BaselineEntry e;
+
+    if (!JsonField(line, "name", e.name))
+      continue;
+    JsonField(line, "library", e.library);
+    JsonField(line, "uarch", e.uarch);
+    JsonField(line, "kernel", e.kernel);
+    JsonField(line, "type", e.type);
+    JsonField(line, "unit", e.unit);
+    e.reps = JsonField(line, "repetitions", val) ? stoi(val) : 0;
+    e.median = JsonField(line, "median", val) ? stod(val) : NAN;
+    e.mad = JsonField(line, "mad", val) ? stod(val) : 0;
+    entries.push_back(e);
+  }
+
+  return true;
+}
+
+static bool SaveBaseline(const string &path,
+                         const vector<BaselineEntry> &current) {
+  vector<BaselineEntry> entries;
+  map<string, size_t> index;
+  char date[32] = "";
+  time_t now = time(NULL);
+
+  LoadBaseline(path, entries);
+  for (size_t i = 0; i < entries.size(); i++)
+    index[entries[i].key()] = i;
+  for (auto &e : current) {
+    auto it = index.find(e.key());
+    if (it != index.end()) {
+      entries[it->second] = e;
+    } else {
+      index[e.key()] = entries.size();
+      entries.push_back(e);
+    }
+  }
+
+  FILE *f = fopen(path.c_str(), "w");
+  if (!f) {
+    cerr << "Cannot write " << path << endl;
+    return false;
+  }
+
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+  fprintf(f, "{\n  \"context\": {\n    \"date\": \"%s\"\n  },\n"
+             "  \"benchmarks\": [\n", date);
+  for (size_t i = 0; i < entries.size(); i++) {
+    auto &e = entries[i];
+    fprintf(f, "    {\"name\": \"%s\", \"library\": \"%s\", \"uarch\": \"%s\", "
+               "\"kernel\": \"%s\", \"type\": \"%s\", \"unit\": \"%s\", "
+               "\"repetitions\": %d, \"median\": %.6e, \"mad\": %.6e}%s\n",
+            e.name.c_str(), e.library.c_str(), e.uarch.c_str(),
+            e.kernel.c_str(), e.type.c_str(), e.unit.c_str(), e.reps,
+            e.median, e.mad, i + 1 < entries.size() ? "," : "");
+  }
+  fprintf(f, "  ]\n}\n");
+  fclose(f);
+
+  cout << "Saved " << current.size() << " baseline entries to " << path
+       << endl;
+  return true;
+}
+
+/* Returns the number of regressions, or -1 if there is no baseline */
+static int CompareBaseline(const string &path, InputParams *params,
+                           const vector<BaselineEntry> &current) {
+  vector<BaselineEntry> base;
+  map<string, const BaselineEntry *> index;
+  int regressed = 0, compared = 0;
+
+  if (!LoadBaseline(path, base)) {
+    cerr << "Cannot read " << path << endl;
+    return -1;
+  }
+  for (auto &e : base)
+    index[e.key()] = &e;
+
+  printf("\nBaseline %s, %u repetitions, threshold %g%%\n", path.c_str(),
+         params->repetitions, params->threshold);
+  printf("%-32s %-8s %10s %9s %10s %9s %8s\n", "name", "uarch",
+         "baseline", "mad", "current", "mad", "change");
+
+  for (auto &c : current) {
+    auto it = index.find(c.key());
+
+    if (it == index.end()) {
+      printf("%-32s %-8s %10s %9s %10.2f %9.2f %8s  new\n", c.name.c_str(),
+             c.uarch.c_str(), "-", "-", c.median, c.mad, "-");
+      continue;
+    }
+
+    const BaselineEntry &b = *it->second;
+    bool higher_better = c.type == "perf";
+    double change = (c.median - b.median) / b.median * 100;
+    double worse = higher_better ? -change : change;
+    double sigma = 1.4826 * sqrt(b.mad * b.mad + c.mad * c.mad);
+    bool significant = fabs(c.median - b.median) > 3 * sigma;
+    const char *verdict = "";
+
+    if (significant && worse > params->threshold) {
+      verdict = "REGRESSED";
+      regressed++;
+    } else if (significant && -worse > params->threshold) {
+      verdict = "improved";
+    }
+
+    printf("%-32s %-8s %10.2f %9.2f %10.2f %9.2f %+7.1f%%  %s", c.name.c_str(),
+           c.uarch.c_str(), b.median, b.mad, c.median, c.mad, change, verdict);
+    if (b.kernel != c.kernel)
+      printf(" (kernel %s -> %s)", b.kernel.c_str(), c.kernel.c_str());
+    printf("\n");
+    compared++;
+  }
+
+  printf("%d of %d kernels regressed (%s)\n", regressed, compared,
+         current.empty() ? "-" : current[0].unit.c_str());
+  return regressed;
+}
+
+static int BaselineReport(const string &runs, InputParams *params) {
+  vector<BaselineEntry> current;
+  bool ok = ReadRuns(runs, params, current);
+  int regressed = 0;
+
+  remove(runs.c_str());
+  if (!ok)
+    return 1;
+
+  if (!params->compareBaseline.empty()) {
+    regressed = CompareBaseline(params->compareBaseline, params, current);
+    if (regressed < 0)
+      return 1;
+  }
+
+  if (!params->saveBaseline.empty() &&
+      !SaveBaseline(params->saveBaseline, current))
+    return 1;
+
+  return regressed ? 1 : 0;
+}
+
+/*
+ * Returns non-zero when a baseline cannot be read or written, or when
+ * --compare-baseline finds a regression.
+ */
 int gbench_main(int argc, char **argv, InputParams *params) {
   AlmTestPerfFramework AlmTestPerf;
+  bool baseline = !params->saveBaseline.empty() ||
+                  !params->compareBaseline.empty();
+  std::string runs;
+
+  if (!params->compareBaseline.empty() &&
+      !ifstream(params->compareBaseline)) {
+    cerr << "Cannot read " << params->compareBaseline << endl;
+    return 1;
+  }
+
+  if (baseline)
+    runs = (params->saveBaseline.empty() ? params->compareBaseline
+                                         : params->saveBaseline) + ".runs";
 
   if (1) {
-    int argcs = 2;
-    std::string arg0 = "--benchmark_counters_tabular=true";
-    char *args[2] = {
-      const_cast<char *>(argv[0]), const_cast<char *>(arg0.c_str())};
-    benchmark::Initialize(&argcs, args);
+    std::vector<std::string> opts = {"--benchmark_counters_tabular=true"};
+    if (baseline) {
+      opts.push_back("--benchmark_repetitions=" +
+                     std::to_string(params->repetitions));
+      opts.push_back("--benchmark_display_aggregates_only=true");
+      opts.push_back("--benchmark_out=" + runs);
+      opts.push_back("--benchmark_out_format=json");
+    }
+    std::vector<char *> args = {argv[0]};
+    for (auto &o : opts)
+      args.push_back(const_cast<char *>(o.c_str()));
+    int argcs = (int)args.size();
+    benchmark::Initialize(&argcs, args.data());
   } else  {
     benchmark::Initialize(&argc, argv);
   }
 
-  int retval = AlmTestPerf.AlmTestPerformance(params);
+  AlmTestPerf.AlmTestPerformance(params);
+
+  if (baseline)
+    return BaselineReport(runs, params);
 
-  return retval;
+  return 0;
 }
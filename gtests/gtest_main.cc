@@ -86,6 +86,8 @@ int gtest_main(int argc, char **argv, InputParams *inparams) {
   memset(inData, 0, sizeof(InputData));
   inData->max_ulp_err = 0.0;
   inData->ulp_threshold = 0.5;
+  inData->ulp_bound[0] = getUlpBound(inparams->testFunction, ALM::FloatWidth::E_F32);
+  inData->ulp_bound[1] = getUlpBound(inparams->testFunction, ALM::FloatWidth::E_F64);
 
   memset(ptr, 0, sizeof(PrintTstRes));
   almTest.AlmTestType(inparams, inData, ptr);
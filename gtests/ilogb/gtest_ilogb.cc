@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Special values through the vector and array ilogb variants, the
+ * integer results are compared as floating point values.
+ */
+
+#include "libm_tests.h"
+#include "almtestvec.h"
+#include "test_ilogb_data.h"
+
+TEST(ILOGB, CONFORMANCE_FLOAT_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_ilogbf_conformance_data);
+  ConfCheckVec<float>("vrs8_ilogbf", test_ilogbf_conformance_data, n, 1, 8, test_v8s);
+#if defined(__AVX512__)
+  ConfCheckVec<float>("vrs16_ilogbf", test_ilogbf_conformance_data, n, 1, 16, test_v16s);
+#endif
+  ConfCheckVec<float>("vrsa_ilogbf", test_ilogbf_conformance_data, n, 1, 0, test_vas);
+}
+
+TEST(ILOGB, CONFORMANCE_DOUBLE_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_ilogb_conformance_data);
+  ConfCheckVec<double>("vrd4_ilogb", test_ilogb_conformance_data, n, 1, 4, test_v4d);
+#if defined(__AVX512__)
+  ConfCheckVec<double>("vrd8_ilogb", test_ilogb_conformance_data, n, 1, 8, test_v8d);
+#endif
+  ConfCheckVec<double>("vrda_ilogb", test_ilogb_conformance_data, n, 1, 0, test_vad);
+}
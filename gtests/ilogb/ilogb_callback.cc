@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <cmath>
+#include <vector>
+#include "libm_tests.h"
+#include <libm_macros.h>
+
+#define AMD_LIBM_VEC_EXPERIMENTAL
+
+#include <libm_amd.h>
+#include <libm/amd_funcs_internal.h>
+#include <fmaintrin.h>
+#include <immintrin.h>
+#include "callback.h"
+#include "test_ilogb_data.h"
+#include "../libs/mparith/alm_mp_funcs.h"
+
+static uint32_t ipargs = 1;
+bool special_case = false;
+
+uint32_t GetnIpArgs( void )
+{
+	return ipargs;
+}
+
+bool getSpecialCase(void)
+{
+  return special_case;
+}
+
+void ConfSetupf32(SpecParams *specp) {
+  specp->data32 = test_ilogbf_conformance_data;
+  specp->countf = ARRAY_SIZE(test_ilogbf_conformance_data);
+}
+
+void ConfSetupf64(SpecParams *specp) {
+  specp->data64 = test_ilogb_conformance_data;
+  specp->countd = ARRAY_SIZE(test_ilogb_conformance_data);
+}
+
+float getFuncOp(float *data) {
+  return (float)LIBM_FUNC(ilogbf)(data[0]);
+}
+
+double getFuncOp(double *data) {
+  return (double)LIBM_FUNC(ilogb)(data[0]);
+}
+
+double getExpected(float *data) {
+  return ilogbf(data[0]);
+}
+
+long double getExpected(double *data) {
+  return ilogb(data[0]);
+}
+
+// Used by the Complex Number Functions only!
+double _Complex getExpected(float _Complex *data) {
+  return {0};
+}
+
+long double _Complex getExpected(double _Complex *data) {
+  return {0};
+}
+
+float getGlibcOp(float *data) {
+  return (float)ilogbf(data[0]);
+}
+
+double getGlibcOp(double *data) {
+  return (double)ilogb(data[0]);
+}
+
+/**********************
+*FUNCTIONS*
+**********************/
+int test_s1s(test_data *data, int idx)  {
+  float *ip  = (float*)data->ip;
+  float *op  = (float*)data->op;
+  op[0] = (float)LIBM_FUNC(ilogbf)(ip[idx]);
+  return 0;
+}
+
+int test_s1d(test_data *data, int idx)  {
+  double *ip  = (double*)data->ip;
+  double *op  = (double*)data->op;
+  op[0] = (double)LIBM_FUNC(ilogb)(ip[idx]);
+  return 0;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// FIXME: No V2D version available for ilogb
+int test_v2d(test_data *data, int idx)  {
+  return 0;
+}
+
+// FIXME: No V4S version available for ilogb
+int test_v4s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4d(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  double *ip  = (double*)data->ip;
+  double *op  = (double*)data->op;
+  int64_t e[4];
+  __m256d ip4 = _mm256_set_pd(ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
+  _mm256_storeu_si256((__m256i*)e, amd_vrd4_ilogb(ip4));
+  for (int j = 0; j < 4; j++)
+    op[j] = (double)e[j];
+#endif
+  return 0;
+}
+
+int test_v8s(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  float *ip  = (float*)data->ip;
+  float *op  = (float*)data->op;
+  int32_t e[8];
+  __m256 ip8 = _mm256_set_ps(ip[idx+7], ip[idx+6], ip[idx+5], ip[idx+4],
+                             ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
+  _mm256_storeu_si256((__m256i*)e, amd_vrs8_ilogbf(ip8));
+  for (int j = 0; j < 8; j++)
+    op[j] = (float)e[j];
+#endif
+  return 0;
+}
+
+int test_v8d(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  #if defined(__AVX512__)
+    double *ip  = (double*)data->ip;
+    double *op  = (double*)data->op;
+    int64_t e[8];
+    __m512d ip8 = _mm512_loadu_pd(&ip[idx]);
+    _mm512_storeu_si512(e, amd_vrd8_ilogb(ip8));
+    for (int j = 0; j < 8; j++)
+      op[j] = (double)e[j];
+  #endif
+#endif
+  return 0;
+}
+
+int test_v16s(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  #if defined(__AVX512__)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    int32_t e[16];
+    __m512 ip16 = _mm512_loadu_ps(&ip[idx]);
+    _mm512_storeu_si512(e, amd_vrs16_ilogbf(ip16));
+    for (int j = 0; j < 16; j++)
+      op[j] = (float)e[j];
+  #endif
+#endif
+  return 0;
+}
+
+int test_vad(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  double *ip  = (double*)data->ip;
+  double *op  = (double*)data->op;
+  std::vector<int> e(count);
+  amd_vrda_ilogb(count, ip, e.data());
+  for (int j = 0; j < count; j++)
+    op[j] = (double)e[j];
+#endif
+  return 0;
+}
+
+int test_vas(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  float *ip  = (float*)data->ip;
+  float *op  = (float*)data->op;
+  std::vector<int> e(count);
+  amd_vrsa_ilogbf(count, ip, e.data());
+  for (int j = 0; j < count; j++)
+    op[j] = (float)e[j];
+#endif
+  return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * ilogb() of +/-0 is FP_ILOGB0 and of NaN is FP_ILOGBNAN, both INT_MIN,
+ * ilogb() of +/-inf is INT_MAX. Results are compared as float/double.
+ */
+#define ILOGB_MIN_F32 0xcf000000             /* (float)INT_MIN  */
+#define ILOGB_MAX_F32 0x4f000000             /* (float)INT_MAX  */
+#define ILOGB_MIN_F64 0xc1e0000000000000LL   /* (double)INT_MIN */
+#define ILOGB_MAX_F64 0x41dfffffffc00000LL   /* (double)INT_MAX */
+
+/* Test cases to check the conformance of the ilogbf() routine. */
+static libm_test_special_data_f32
+test_ilogbf_conformance_data[] = {
+    /* Test Inputs of -/+0, FP_ILOGB0 */
+    {POS_ZERO_F32,    ILOGB_MIN_F32,     FE_INVALID},
+    {NEG_ZERO_F32,    ILOGB_MIN_F32,     FE_INVALID},
+
+    /* Test Inputs of -/+inf */
+    {POS_INF_F32,     ILOGB_MAX_F32,     FE_INVALID},
+    {NEG_INF_F32,     ILOGB_MAX_F32,     FE_INVALID},
+
+    /* Test Inputs that are signalling and quiet NaNs, FP_ILOGBNAN */
+    {POS_SNAN_F32,    ILOGB_MIN_F32,     FE_INVALID},
+    {NEG_SNAN_F32,    ILOGB_MIN_F32,     FE_INVALID},
+    {POS_QNAN_F32,    ILOGB_MIN_F32,     FE_INVALID},
+    {NEG_QNAN_F32,    ILOGB_MIN_F32,     FE_INVALID},
+
+    /* Test Inputs that are standard, denormalized and extreme */
+    {POS_ONE_F32,     POS_ZERO_F32,      0},
+    {NEG_ONE_F32,     POS_ZERO_F32,      0},
+    {0x40490fdb,      0x3f800000,        0}, // pi -> 1
+    {POS_HDENORM_F32, 0xc2fe0000,        0}, // -127
+    {NEG_HDENORM_F32, 0xc2fe0000,        0}, // -127
+    {POS_LDENORM_F32, 0xc3150000,        0}, // -149
+    {NEG_LDENORM_F32, 0xc3150000,        0}, // -149
+    {0x00400000,      0xc2fe0000,        0}, // -127
+    {POS_HNORMAL_F32, 0x42fe0000,        0}, // 127
+    {NEG_HNORMAL_F32, 0x42fe0000,        0}, // 127
+    {POS_LNORMAL_F32, 0xc2fc0000,        0}, // -126
+    {NEG_LNORMAL_F32, 0xc2fc0000,        0}, // -126
+    {0x3f000000,      0xbf800000,        0}, // 0.5 -> -1
+    {0x3effffff,      0xc0000000,        0}, // 0.49999997 -> -2
+    {0x40400000,      0x3f800000,        0}, // 3 -> 1
+    {0xc2c80000,      0x40c00000,        0}, // -100 -> 6
+    {0x4b000001,      0x41b80000,        0}, // 8388609 -> 23
+    {0x33d6bf95,      0xc1c00000,        0}, // 1e-07 -> -24
+};
+
+/* Test cases to check the conformance of the ilogb() routine. */
+static libm_test_special_data_f64
+test_ilogb_conformance_data[] = {
+    /* Test Inputs of -/+0, FP_ILOGB0 */
+    {POS_ZERO_F64,         ILOGB_MIN_F64,        FE_INVALID},
+    {NEG_ZERO_F64,         ILOGB_MIN_F64,        FE_INVALID},
+
+    /* Test Inputs of -/+inf */
+    {POS_INF_F64,          ILOGB_MAX_F64,        FE_INVALID},
+    {NEG_INF_F64,          ILOGB_MAX_F64,        FE_INVALID},
+
+    /* Test Inputs that are signalling and quiet NaNs, FP_ILOGBNAN */
+    {POS_SNAN_F64,         ILOGB_MIN_F64,        FE_INVALID},
+    {NEG_SNAN_F64,         ILOGB_MIN_F64,        FE_INVALID},
+    {POS_QNAN_F64,         ILOGB_MIN_F64,        FE_INVALID},
+    {NEG_QNAN_F64,         ILOGB_MIN_F64,        FE_INVALID},
+
+    /* Test Inputs that are standard, denormalized and extreme */
+    {POS_ONE_F64,          POS_ZERO_F64,         0},
+    {NEG_ONE_F64,          POS_ZERO_F64,         0},
+    {POS_PI_F64,           0x3ff0000000000000LL, 0}, // pi -> 1
+    {POS_HDENORM_F64,      0xc08ff80000000000LL, 0}, // -1023
+    {NEG_HDENORM_F64,      0xc08ff80000000000LL, 0}, // -1023
+    {POS_LDENORM_F64,      0xc090c80000000000LL, 0}, // -1074
+    {NEG_LDENORM_F64,      0xc090c80000000000LL, 0}, // -1074
+    {0x0008000000000000LL, 0xc08ff80000000000LL, 0}, // -1023
+    {POS_HNORMAL_F64,      0x408ff80000000000LL, 0}, // 1023
+    {NEG_HNORMAL_F64,      0x408ff80000000000LL, 0}, // 1023
+    {POS_LNORMAL_F64,      0xc08ff00000000000LL, 0}, // -1022
+    {NEG_LNORMAL_F64,      0xc08ff00000000000LL, 0}, // -1022
+    {0x3fe0000000000000LL, 0xbff0000000000000LL, 0}, // 0.5 -> -1
+    {0x3fdfffffffffffffLL, 0xc000000000000000LL, 0}, // 0.49999999999999994 -> -2
+    {0x4008000000000000LL, 0x3ff0000000000000LL, 0}, // 3 -> 1
+    {0xc059000000000000LL, 0x4018000000000000LL, 0}, // -100 -> 6
+    {0x4330000000000001LL, 0x404a000000000000LL, 0}, // 2^52+1 -> 52
+    {0x3d3c25c268497682LL, 0xc046000000000000LL, 0}, // 1e-13 -> -44
+};
@@ -93,6 +93,7 @@ typedef struct {
 typedef struct {
   double max_ulp_err; /* ULP error */
   double ulp_threshold;
+  double ulp_bound[2]; /* stated max ULP error {float, double}, 0 if none */
 } InputData;
 
 typedef struct {
@@ -116,6 +117,10 @@ typedef struct {
   uint32_t count;
   std::string testFunction;
   InputRange range[MAX_INPUT_RANGES];
+  uint32_t repetitions;         /* runs per benchmark for a baseline */
+  double threshold;             /* % change a regression must exceed */
+  std::string saveBaseline;
+  std::string compareBaseline;
 } InputParams;
 
 
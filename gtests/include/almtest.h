@@ -146,6 +146,16 @@ double getUlp(float _Complex aop, double _Complex exptd);
 double getUlp(double _Complex aop, long double _Complex exptd);
 bool update_ulp(double ulp, double &, double);
 
+/*
+ * Fails the accuracy test when the max ULP error exceeds the bound
+ * stated for the function in libm_ulp_bounds; 0 means no stated bound.
+ */
+inline void CheckUlpBound(double max_ulp_err, double bound) {
+  if (bound > 0) {
+    EXPECT_LE(max_ulp_err, bound) << "stated max ULP error exceeded";
+  }
+}
+
 /*
  * The derived class for Accuracy test cases for datatype "float"
  * where data members and member functions are declared and defined
@@ -325,6 +335,15 @@ class AccuTestFixtureComplexFloat : public ::testing::TestWithParam<AccuParams>
       PopulateComplexInputSamples(complex_inpbuff1, inpbuff1, count);
     }
     unsigned int arr_size = _ALIGN_FACTOR;
+    if (GetParam().vec_input_count == (int)ALM::FloatQuantity::E_Vector_Array)
+    {
+      arr_size = count * count * sizeof(float _Complex);
+      if((arr_size % _ALIGN_FACTOR) != 0)
+      {
+        int factor = (arr_size / _ALIGN_FACTOR) + 1;
+        arr_size = _ALIGN_FACTOR * factor;
+      }
+    }
     aocl_libm_aligned_alloc(arr_size, aop);
   }
 
@@ -380,6 +399,15 @@ class AccuTestFixtureComplexDouble : public ::testing::TestWithParam<AccuParams>
       PopulateComplexInputSamples(complex_inpbuff1, inpbuff1, count);
     }
     unsigned int arr_size = _ALIGN_FACTOR;
+    if (GetParam().vec_input_count == (int)ALM::FloatQuantity::E_Vector_Array)
+    {
+      arr_size = count * count * sizeof(double _Complex);
+      if((arr_size % _ALIGN_FACTOR) != 0)
+      {
+        int factor = (arr_size / _ALIGN_FACTOR) + 1;
+        arr_size = _ALIGN_FACTOR * factor;
+      }
+    }
     aocl_libm_aligned_alloc(arr_size, aop);
   }
 
@@ -158,6 +158,7 @@ enum class RangeType {
   E_Simple,
   E_Random,
   E_Linear,
+  E_Special,
 
   E_MAX
 };
@@ -173,6 +174,9 @@ inline std::ostream& operator<<(std::ostream& os, RangeType& rt) {
     case RangeType::E_Linear:
       os << "Linear";
       break;
+    case RangeType::E_Special:
+      os << "Special";
+      break;
     default:
       os << "Unknown";
       break;
@@ -191,6 +195,7 @@ enum class TestType {
   E_SpecialCase = 1 << 3,
   E_CornerCase  = 1 << 4,
   E_Performance = 1 << 5,
+  E_Latency     = 1 << 6,
 
   E_MAX
 };
@@ -209,6 +214,9 @@ inline std::ostream& operator<<(std::ostream& os, TestType& cat) {
     case TestType::E_Performance:
       os << "PERFORMANCE";
       break;
+    case TestType::E_Latency:
+      os << "LATENCY";
+      break;
     default:
       os << "UKNOWN";
       break;
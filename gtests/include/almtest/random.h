@@ -53,6 +53,7 @@ class Random {
   int fillSimple(T *data, uint32_t nelem, T min, T max);
   int fillLinear(T *data, uint32_t nelem, T min, T max);
   int fillRandom(T *data, uint32_t nelem, T min, T max);
+  int fillSpecial(T *data, uint32_t nelem, T min, T max);
 
   int init_randfd(void) {
     uint64_t rand_val = 0xC001BEAFDEADBEAF;
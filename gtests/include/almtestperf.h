@@ -34,6 +34,7 @@
 #include <cstring>
 #include <vector>
 #include <limits>
+#include <chrono>
 #include "args.h"
 #include "almstruct.h"
 #include "defs.h"
@@ -41,6 +42,12 @@
 #include "debug.h"
 #include "benchmark.h"
 
+#if defined(_WIN64) || defined(_WIN32)
+  #include <intrin.h>
+#else
+  #include <x86intrin.h>
+#endif
+
 using namespace std;
 using namespace ALM;
 using namespace ALMTest;
@@ -58,6 +65,75 @@ void LibmPerfTest8d(benchmark::State& st, InputParams* param);
 void LibmPerfTestaf(benchmark::State& st, InputParams* param);
 void LibmPerfTestad(benchmark::State& st, InputParams* param);
 
+/*
+ * Latency mode (--type=lat): every call's inputs are made to depend on the
+ * previous call's outputs, so calls cannot overlap and the time per call is
+ * its latency. The dependency is value preserving, the output bits are
+ * masked with a zero the compiler cannot see and xored into the next input.
+ * It goes through the callbacks' in-memory buffers, so each call also pays
+ * a store-forwarding round trip, the same for every function measured.
+ */
+template <typename T>
+inline void LatencyFold(T *next, const T *out, int64_t n, int64_t ostride,
+                        uint64_t zero) {
+  for (int64_t k = 0; k < n; k++) {
+    uint64_t a = 0, b = 0;
+    memcpy(&a, &next[k], sizeof(T));
+    memcpy(&b, &out[k * ostride], sizeof(T));
+    a ^= b & zero;
+    memcpy(&next[k], &a, sizeof(T));
+  }
+}
+
+/*
+ * Runs call(i) over the input buffer with lanes elements per call. The
+ * scalar and vector callbacks write their result to out[0..lanes), and
+ * their lanes feed the lanes of the next call. An array call covers all
+ * count elements and its last result feeds every input of the next call.
+ */
+template <typename T, typename F>
+void LibmLatencyTest(benchmark::State& st, InputParams* param, T *inp, T *out,
+                     int64_t lanes, F call) {
+  static volatile uint64_t latency_zero = 0;
+  uint64_t zero = latency_zero;
+  int64_t count = param->count;
+  bool array = lanes == count;
+  double ncalls = 0, ns = 0;
+  uint64_t tsc = 0;
+
+  for (auto _ : st) {
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = __rdtsc();
+    for (int64_t i = 0; i < count; i += lanes) {
+      int64_t j = i + lanes;
+      call(i);
+      if (array)
+        LatencyFold(inp, &out[count - 1], count, 0, zero);
+      else
+        LatencyFold(&inp[j < count ? j : 0], out, lanes, 1, zero);
+    }
+    tsc += __rdtsc() - c0;
+    ns += std::chrono::duration<double, std::nano>(
+              std::chrono::steady_clock::now() - t0).count();
+    ncalls += (double)(count / lanes);
+  }
+
+  /*
+   * The console reporter prints values of 1.1k and above divided by 1000
+   * without a prefix, long array calls are reported in us and kcycles.
+   */
+  ns /= ncalls;
+  double cycles = (double)tsc / ncalls;
+  if (ns < 1000)
+    st.counters["ns/call"] = ns;
+  else
+    st.counters["us/call"] = ns / 1000;
+  if (cycles < 1000)
+    st.counters["cycles/call"] = cycles;
+  else
+    st.counters["kcycles/call"] = cycles / 1000;
+}
+
  /*
  * The Function populates the input values based on min value, max value
  * and the type of generation(simple or random or linear)
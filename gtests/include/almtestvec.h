@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Conformance checks for the vector and array variants.
+ *
+ * The CONFORMANCE_* fixtures only run the scalar routine. ConfCheckVec()
+ * feeds the inputs of the same conformance table through the vector or
+ * array callback of a test and compares every lane with the table's
+ * expected output. NaNs of either sign match each other, FP exceptions
+ * are not checked.
+ */
+
+#ifndef __ALMTESTVEC_H__
+#define __ALMTESTVEC_H__
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "almstruct.h"
+#include "callback.h"
+
+template <typename T> struct ConfTable;
+
+template <> struct ConfTable<float> {
+  typedef libm_test_special_data_f32 data;
+  typedef uint32_t bits;
+};
+
+template <> struct ConfTable<double> {
+  typedef libm_test_special_data_f64 data;
+  typedef uint64_t bits;
+};
+
+template <typename T>
+static inline T ConfAsFloat(typename ConfTable<T>::bits u) {
+  T x;
+  memcpy(&x, &u, sizeof(x));
+  return x;
+}
+
+/*
+ * A lane matches if its bits equal the expected ones, if both are NaN, or
+ * if both are finite and of the same sign within maxulp units in the last
+ * place.
+ */
+template <typename T>
+static inline bool ConfLaneMatch(T e, T a, uint64_t maxulp) {
+  typedef typename ConfTable<T>::bits U;
+  U ue, ua;
+  memcpy(&ue, &e, sizeof(ue));
+  memcpy(&ua, &a, sizeof(ua));
+  if (ue == ua || (std::isnan(e) && std::isnan(a)))
+    return true;
+  return std::isfinite(e) && std::isfinite(a) &&
+         std::signbit(e) == std::signbit(a) &&
+         (ua > ue ? ua - ue : ue - ua) <= maxulp;
+}
+
+/*
+ * Runs the callback fn over the table in blocks of width (up to 16)
+ * elements, the last block is padded with the first input. A width of 0
+ * selects an array callback, called once with the whole table. A lane
+ * passes if its bits equal the expected ones, or if both are finite and
+ * of the same sign within maxulp units in the last place.
+ * Returns the number of failing lanes, each of which is also reported as
+ * a gtest failure.
+ */
+template <typename T>
+static int ConfCheckVec(const char *name, const typename ConfTable<T>::data *tbl,
+                        size_t count, uint32_t nargs, int width,
+                        int (*fn)(test_data *, int), uint64_t maxulp = 0) {
+  typedef typename ConfTable<T>::bits U;
+  size_t n = width ? (count + width - 1) / width * width : count;
+  std::vector<T> in(n, ConfAsFloat<T>((U)tbl[0].in));
+  std::vector<T> in2(n, ConfAsFloat<T>((U)tbl[0].in2));
+  std::vector<T> out(n);
+  alignas(64) T lanes[16];
+  test_data t;
+
+  for (size_t i = 0; i < count; i++) {
+    in[i]  = ConfAsFloat<T>((U)tbl[i].in);
+    in2[i] = ConfAsFloat<T>((U)tbl[i].in2);
+  }
+
+  t.ip  = in.data();
+  t.ip1 = in2.data();
+  if (width == 0) {
+    t.op = out.data();
+    fn(&t, (int)count);
+  } else {
+    t.op = lanes;
+    for (size_t i = 0; i < n; i += width) {
+      fn(&t, (int)i);
+      memcpy(&out[i], lanes, width * sizeof(T));
+    }
+  }
+
+  int nfail = 0;
+  for (size_t i = 0; i < count; i++) {
+    U e = (U)tbl[i].out, a;
+    memcpy(&a, &out[i], sizeof(a));
+    if (ConfLaneMatch<T>(ConfAsFloat<T>(e), out[i], maxulp))
+      continue;
+    nfail++;
+    ::testing::Message msg;
+    msg << name << ": input 0x" << std::hex << (U)tbl[i].in;
+    if (nargs == 2)
+      msg << ", 0x" << (U)tbl[i].in2;
+    msg << " expected 0x" << e << " actual 0x" << a;
+    ADD_FAILURE() << msg;
+  }
+  return nfail;
+}
+
+template <typename T> struct ConfTableComplex;
+
+template <> struct ConfTableComplex<float> {
+  typedef libm_test_complex_data_f32 data;
+  typedef float _Complex type;
+};
+
+template <> struct ConfTableComplex<double> {
+  typedef libm_test_complex_data_f64 data;
+  typedef double _Complex type;
+};
+
+/*
+ * The complex counterpart of ConfCheckVec(). The callback reads and
+ * writes interleaved complex numbers, the real and imaginary part of each
+ * lane are matched separately.
+ */
+template <typename T>
+static int ConfCheckComplexVec(const char *name,
+                               const typename ConfTableComplex<T>::data *tbl,
+                               size_t count, uint32_t nargs, int width,
+                               int (*fn)(test_data *, int), uint64_t maxulp = 0) {
+  typedef typename ConfTableComplex<T>::type C;
+  size_t n = width ? (count + width - 1) / width * width : count;
+  std::vector<C> in(n, tbl[0].in);
+  std::vector<C> in2(n, tbl[0].in2);
+  std::vector<C> out(n);
+  alignas(64) C lanes[16];
+  test_data t;
+
+  for (size_t i = 0; i < count; i++) {
+    in[i]  = tbl[i].in;
+    in2[i] = tbl[i].in2;
+  }
+
+  t.ip  = in.data();
+  t.ip1 = in2.data();
+  if (width == 0) {
+    t.op = out.data();
+    fn(&t, (int)count);
+  } else {
+    t.op = lanes;
+    for (size_t i = 0; i < n; i += width) {
+      fn(&t, (int)i);
+      memcpy(&out[i], lanes, width * sizeof(C));
+    }
+  }
+
+  int nfail = 0;
+  for (size_t i = 0; i < count; i++) {
+    C e = tbl[i].out, a = out[i];
+    if (ConfLaneMatch<T>(__real__ e, __real__ a, maxulp) &&
+        ConfLaneMatch<T>(__imag__ e, __imag__ a, maxulp))
+      continue;
+    nfail++;
+    ::testing::Message msg;
+    msg << name << ": input (" << std::hexfloat << (T)__real__ tbl[i].in
+        << ", " << (T)__imag__ tbl[i].in << ")";
+    if (nargs == 2)
+      msg << ", (" << (T)__real__ tbl[i].in2 << ", " << (T)__imag__ tbl[i].in2 << ")";
+    msg << " expected (" << (T)__real__ e << ", " << (T)__imag__ e
+        << ") actual (" << (T)__real__ a << ", " << (T)__imag__ a << ")";
+    ADD_FAILURE() << msg;
+  }
+  return nfail;
+}
+
+#endif
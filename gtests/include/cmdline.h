@@ -75,6 +75,10 @@ class cmdLine {
 
   args::ValueFlag<uint32_t> *nvector;
   args::ValueFlag<uint32_t> *verbose;
+  args::ValueFlag<std::string> *savebaseline;
+  args::ValueFlag<std::string> *comparebaseline;
+  args::ValueFlag<uint32_t> *repetitions;
+  args::ValueFlag<double> *threshold;
   args::HelpFlag *help;
 
   args::ValueFlagList<Range, RangeReader> *ranges;
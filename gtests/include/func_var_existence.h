@@ -50,12 +50,20 @@ static map<string, vector<string>> libm_funcs = {
     {"atan",      {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16"}},
     {"atan2",     {"s1d", "s1f"}},
     {"atanh",     {"s1d", "s1f"}},
+    {"cabs",      {"s1d", "s1f", "vrd4", "vrs8", "vrda", "vrsa"}},
+    {"carg",      {"s1d", "s1f", "vrd4", "vrs8", "vrda", "vrsa"}},
     {"cbrt",      {"s1d", "s1f", "vrd2", "vrs4", "vrda", "vrsa"}},
+    {"ccos",      {"s1d", "s1f", "vrd4", "vrs8", "vrda", "vrsa"}},
     {"ceil",      {"s1d", "s1f"}},
-    {"cexp",      {"s1d", "s1f"}},
+    {"cexp",      {"s1d", "s1f", "vrd4", "vrd8", "vrs8", "vrs16", "vrda", "vrsa"}},
+    {"clog",      {"s1d", "s1f", "vrd4", "vrd8", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"copysign",  {"s1d", "s1f"}},
     {"cos",       {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"cosh",      {"s1d", "s1f", "vrd2", "vrs4", "vrs8"}},
+    {"cpow",      {"s1d", "s1f", "vrd4", "vrd8", "vrs8", "vrs16", "vrda", "vrsa"}},
+    {"csin",      {"s1d", "s1f", "vrd4", "vrs8", "vrda", "vrsa"}},
+    {"csqrt",     {"s1d", "s1f", "vrd4", "vrs8", "vrda", "vrsa"}},
+    {"ctan",      {"s1d", "s1f", "vrd4", "vrs8", "vrda", "vrsa"}},
     {"erf",       {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16"}},
     {"exp",       {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"exp2",      {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
@@ -67,18 +75,21 @@ static map<string, vector<string>> libm_funcs = {
     {"fmax",      {"s1d", "s1f", "vrda", "vrsa"}},
     {"fmin",      {"s1d", "s1f", "vrda", "vrsa"}},
     {"fmod",      {"s1d", "s1f"}},
+    {"frexp",     {"s1d", "s1f", "vrd4", "vrd8", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"hypot",     {"s1d", "s1f"}},
+    {"ilogb",     {"s1d", "s1f", "vrd4", "vrd8", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"log",       {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"log1p",     {"s1d", "s1f", "vrd2", "vrs4", "vrda", "vrsa"}},
     {"log2",      {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"log10",     {"s1d", "s1f", "vrd2", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
-    {"logb",      {"s1d", "s1f"}},
+    {"logb",      {"s1d", "s1f", "vrd4", "vrd8", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"nearbyint", {"s1d", "s1f"}},
     {"pow",       {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"powx",      {"vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrsa", "vrda"}},
     {"remainder", {"s1d", "s1f"}},
     {"rint",      {"s1d", "s1f"}},
     {"round",     {"s1d", "s1f"}},
+    {"scalbn",    {"s1d", "s1f", "vrd4", "vrd8", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"sincos",    {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"sin",       {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"sinh",      {"s1d", "s1f"}},
@@ -91,7 +102,26 @@ static map<string, vector<string>> libm_funcs = {
     {"sub",       {"vrda", "vrsa"}},
     {"mul",       {"vrda", "vrsa"}},
     {"nextafter", {"s1d", "s1f"}},
-    {"ldexp",     {"s1d", "s1f"}},
+    {"ldexp",     {"s1d", "s1f", "vrd4", "vrd8", "vrs8", "vrs16", "vrda", "vrsa"}},
+};
+
+/* map<string, vector<double>> libm_ulp_bounds
+ * stated max ULP error of the math function as { float, double }.
+ * The accuracy tests fail when the measured max ULP error exceeds it.
+ * Functions without an entry are only reported, not checked.
+ */
+static map<string, vector<double>> libm_ulp_bounds = {
+    // { func,   { float, double } }
+    // complex: max of the real and imaginary part errors, no bound for cpow,
+    // exp(y * log(x)) loses the relative accuracy of the smaller part
+    {"cabs",    { 2,  2 }},
+    {"carg",    { 3,  3 }},
+    {"ccos",    { 7,  6 }},
+    {"cexp",    { 6,  5 }},
+    {"clog",    { 3,  3 }},
+    {"csin",    { 7,  6 }},
+    {"csqrt",   { 3,  3 }},
+    {"ctan",    { 11, 10 }},
 };
 
 /* vector<string> getSupportedVariants(string func)
@@ -117,4 +147,10 @@ string validateFilterData(string func, string filter_data);
  */
 string validateFilterDataConf(InputParams *params, string filter_data);
 
+/* double getUlpBound(string func, ALM::FloatWidth fwidth)
+ * returns the stated max ULP error of that math function for fwidth,
+ * or 0 if no bound is stated.
+ */
+double getUlpBound(string func, ALM::FloatWidth fwidth);
+
 #endif
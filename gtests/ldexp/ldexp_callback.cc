@@ -27,6 +27,7 @@
 
 
 #include <cmath>
+#include <vector>
 #include "libm_tests.h"
 #include <libm_macros.h>
 
@@ -125,33 +126,90 @@ int test_v4s(test_data *data, int idx)  {
   return 0;
 }
 
-// FIXME: No V4D version available for ldexp
 int test_v4d(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  double *ip1 = (double*)data->ip;
+  double *ip2 = (double*)data->ip1;
+  double *op  = (double*)data->op;
+  __m256d ip4 = _mm256_set_pd(ip1[idx+3], ip1[idx+2], ip1[idx+1], ip1[idx]);
+  __m256i n4  = _mm256_set_epi64x((long long)ip2[idx+3], (long long)ip2[idx+2],
+                                  (long long)ip2[idx+1], (long long)ip2[idx]);
+  __m256d op4 = amd_vrd4_ldexp(ip4, n4);
+  _mm256_store_pd(&op[0], op4);
+#endif
   return 0;
 }
 
-// FIXME: No V8S version available for ldexp
 int test_v8s(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  float *ip1 = (float*)data->ip;
+  float *ip2 = (float*)data->ip1;
+  float *op  = (float*)data->op;
+  __m256 ip8 = _mm256_set_ps(ip1[idx+7], ip1[idx+6], ip1[idx+5], ip1[idx+4],
+                             ip1[idx+3], ip1[idx+2], ip1[idx+1], ip1[idx]);
+  __m256i n8 = _mm256_cvttps_epi32(_mm256_set_ps(ip2[idx+7], ip2[idx+6], ip2[idx+5], ip2[idx+4],
+                                                 ip2[idx+3], ip2[idx+2], ip2[idx+1], ip2[idx]));
+  __m256 op8 = amd_vrs8_ldexpf(ip8, n8);
+  _mm256_store_ps(&op[0], op8);
+#endif
   return 0;
 }
 
-// FIXME: No V8D version available for ldexp
 int test_v8d(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  #if defined(__AVX512__)
+    double *ip1 = (double*)data->ip;
+    double *ip2 = (double*)data->ip1;
+    double *op  = (double*)data->op;
+    __m512d ip8 = _mm512_set_pd(ip1[idx+7], ip1[idx+6], ip1[idx+5], ip1[idx+4],
+                                ip1[idx+3], ip1[idx+2], ip1[idx+1], ip1[idx]);
+    __m512i n8  = _mm512_cvttpd_epi64(_mm512_set_pd(ip2[idx+7], ip2[idx+6], ip2[idx+5], ip2[idx+4],
+                                                    ip2[idx+3], ip2[idx+2], ip2[idx+1], ip2[idx]));
+    __m512d op8 = amd_vrd8_ldexp(ip8, n8);
+    _mm512_store_pd(&op[0], op8);
+  #endif
+#endif
   return 0;
 }
 
-// FIXME: No V16S version available for ldexp
 int test_v16s(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  #if defined(__AVX512__)
+    float *ip1 = (float*)data->ip;
+    float *ip2 = (float*)data->ip1;
+    float *op  = (float*)data->op;
+    __m512 ip16 = _mm512_loadu_ps(&ip1[idx]);
+    __m512i n16 = _mm512_cvttps_epi32(_mm512_loadu_ps(&ip2[idx]));
+    __m512 op16 = amd_vrs16_ldexpf(ip16, n16);
+    _mm512_store_ps(&op[0], op16);
+  #endif
+#endif
   return 0;
 }
 
-// FIXME: No VAD version available for ldexp
 int test_vad(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  double *ip1 = (double*)data->ip;
+  double *ip2 = (double*)data->ip1;
+  double *op  = (double*)data->op;
+  std::vector<int> n(count);
+  for (int i = 0; i < count; i++)
+    n[i] = int(ip2[i]);
+  amd_vrda_ldexp(count, ip1, n.data(), op);
+#endif
   return 0;
 }
 
-// FIXME: No VAS version available for ldexp
 int test_vas(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  float *ip1 = (float*)data->ip;
+  float *ip2 = (float*)data->ip1;
+  float *op  = (float*)data->op;
+  std::vector<int> n(count);
+  for (int i = 0; i < count; i++)
+    n[i] = int(ip2[i]);
+  amd_vrsa_ldexpf(count, ip1, n.data(), op);
+#endif
   return 0;
 }
 
@@ -83,11 +83,22 @@ double   alm_mp_tanhf       (float x);
 double   alm_mp_tanpif      (float x);
 double   alm_mp_truncf      (float x);
 double   alm_mp_erff        (float x);
+double   alm_mp_erfcf       (float x);
+double   alm_mp_erfinvf     (float x);
+double   alm_mp_erfcinvf    (float x);
+double   alm_mp_cdfnormf    (float x);
+double   alm_mp_cdfnorminvf (float x);
+double   alm_mp_lgammaf     (float x);
+double   alm_mp_tgammaf     (float x);
+double   alm_mp_digammaf    (float x);
 double   alm_mp_linearfracf (float x, float y, float sc_x, float sh_x, float sc_y, float sh_y);
 double   alm_mp_addf        (float x, float y);
 double   alm_mp_subf        (float x, float y);
 double   alm_mp_mulf        (float x, float y);
 double   alm_mp_nextafterf  (float x, float y);
+double   alm_mp_sumexpf     (int n, const float *x);
+double   alm_mp_logsumexpf  (int n, const float *x);
+double   alm_mp_sumlogf     (int n, const float *x);
 void     alm_mp_sincosf     (float x, double* y1, double* y2);
 
 /* Single precision ULP functions */
@@ -192,11 +203,22 @@ long double  alm_mp_tanh      (double x);
 long double  alm_mp_tanpi     (double x);
 long double  alm_mp_trunc     (double x);
 long double  alm_mp_erf       (double x);
+long double  alm_mp_erfc      (double x);
+long double  alm_mp_erfinv    (double x);
+long double  alm_mp_erfcinv   (double x);
+long double  alm_mp_cdfnorm   (double x);
+long double  alm_mp_cdfnorminv (double x);
+long double  alm_mp_lgamma    (double x);
+long double  alm_mp_tgamma    (double x);
+long double  alm_mp_digamma   (double x);
 long double  alm_mp_linearfrac (double x, double y, double sc_x, double sh_x, double sc_y, double sh_y);
 long double  alm_mp_add       (double x, double y);
 long double  alm_mp_sub       (double x, double y);
 long double  alm_mp_mul       (double x, double y);
 long double  alm_mp_nextafter (double x, double y);
+long double  alm_mp_sumexp    (int n, const double *x);
+long double  alm_mp_logsumexp (int n, const double *x);
+long double  alm_mp_sumlog    (int n, const double *x);
 void         alm_mp_sincos    (double x, long double* y1, long double* y2);
 
 double  alm_mp_acosh_ULP     (double x,double z, double *, double *);
@@ -255,6 +277,22 @@ double  alm_mp_nextafter_ULP (double x, double y, double z, double *, double *);
 // Complex Variants
 double _Complex    alm_mpc_cexpf      (float _Complex x);
 long double _Complex   alm_mpc_cexp       (double _Complex x);
+double _Complex    alm_mpc_clogf      (float _Complex x);
+long double _Complex   alm_mpc_clog       (double _Complex x);
+double _Complex    alm_mpc_cpowf      (float _Complex x, float _Complex y);
+long double _Complex   alm_mpc_cpow       (double _Complex x, double _Complex y);
+double _Complex    alm_mpc_csinf      (float _Complex x);
+long double _Complex   alm_mpc_csin       (double _Complex x);
+double _Complex    alm_mpc_ccosf      (float _Complex x);
+long double _Complex   alm_mpc_ccos       (double _Complex x);
+double _Complex    alm_mpc_ctanf      (float _Complex x);
+long double _Complex   alm_mpc_ctan       (double _Complex x);
+double _Complex    alm_mpc_csqrtf     (float _Complex x);
+long double _Complex   alm_mpc_csqrt      (double _Complex x);
+double             alm_mpc_cabsf      (float _Complex x);
+long double        alm_mpc_cabs       (double _Complex x);
+double             alm_mpc_cargf      (float _Complex x);
+long double        alm_mpc_carg       (double _Complex x);
 
 #ifdef __cplusplus
 }
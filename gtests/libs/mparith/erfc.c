@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2008-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include "precision.h"
+
+
+#if defined(FLOAT)
+#define FUNC_ERFC    alm_mp_erfcf
+#define FUNC_CDFNORM alm_mp_cdfnormf
+
+#elif defined(DOUBLE)
+#define FUNC_ERFC    alm_mp_erfc
+#define FUNC_CDFNORM alm_mp_cdfnorm
+
+#else
+#error
+#endif
+
+#include <mpfr.h>
+
+static REAL_L mp_get(mpfr_t mp_rop)
+{
+#if defined(FLOAT)
+    return mpfr_get_d(mp_rop, MPFR_RNDN);
+#elif defined(DOUBLE)
+    return mpfr_get_ld(mp_rop, MPFR_RNDN);
+#endif
+}
+
+REAL_L FUNC_ERFC(REAL x)
+{
+    REAL_L y;
+
+    mpfr_rnd_t rnd = MPFR_RNDN;
+    mpfr_t mpx, mp_rop;
+
+    mpfr_inits2(ALM_MP_PRECI_BITS, mpx, mp_rop, (mpfr_ptr) 0);
+
+    mpfr_set_d(mpx, x, rnd);
+    mpfr_erfc(mp_rop, mpx, rnd);
+    y = mp_get(mp_rop);
+
+    mpfr_clears (mpx, mp_rop, (mpfr_ptr) 0);
+    return y;
+}
+
+/* cdfnorm(x) = erfc(-x / sqrt(2)) / 2 */
+REAL_L FUNC_CDFNORM(REAL x)
+{
+    REAL_L y;
+
+    mpfr_rnd_t rnd = MPFR_RNDN;
+    mpfr_t mpx, mp_rop;
+
+    mpfr_inits2(ALM_MP_PRECI_BITS, mpx, mp_rop, (mpfr_ptr) 0);
+
+    mpfr_set_d(mpx, x, rnd);
+    mpfr_sqrt_ui(mp_rop, 2, rnd);
+    mpfr_div(mpx, mpx, mp_rop, rnd);
+    mpfr_neg(mpx, mpx, rnd);
+    mpfr_erfc(mp_rop, mpx, rnd);
+    mpfr_div_2ui(mp_rop, mp_rop, 1, rnd);
+    y = mp_get(mp_rop);
+
+    mpfr_clears (mpx, mp_rop, (mpfr_ptr) 0);
+    return y;
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2008-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include "precision.h"
+
+
+#if defined(FLOAT)
+#define FUNC_ERFINV     alm_mp_erfinvf
+#define FUNC_ERFCINV    alm_mp_erfcinvf
+#define FUNC_CDFNORMINV alm_mp_cdfnorminvf
+
+#elif defined(DOUBLE)
+#define FUNC_ERFINV     alm_mp_erfinv
+#define FUNC_ERFCINV    alm_mp_erfcinv
+#define FUNC_CDFNORMINV alm_mp_cdfnorminv
+
+#else
+#error
+#endif
+
+#include <math.h>
+#include <mpfr.h>
+
+/*
+ * The inverses have no mpfr counterpart, they are solved by Newton's
+ * method in ALM_MP_PRECI_BITS on erf and erfc, each evaluated to the
+ * full precision:
+ *
+ *     erf(y) = t,      t in (0, 1/2]
+ *     erfc(y) = p,     p in (0, 1)    on log(p) - log(erfc(y))
+ *
+ * from a start bisected in long double with erfl and erfcl, which the
+ * quadratic convergence takes to the full precision in two or three
+ * steps. The iteration ends once the step is below half the precision,
+ * the next one would be below the rounding of the result. 1 - t and
+ * 2 - p are exact in ALM_MP_PRECI_BITS for the arguments that take them.
+ */
+
+#define MP_ERFC_MAX 30.0L   /* erfc is below any denormal */
+
+static REAL_L mp_get(mpfr_t mp_rop)
+{
+#if defined(FLOAT)
+    return mpfr_get_d(mp_rop, MPFR_RNDN);
+#elif defined(DOUBLE)
+    return mpfr_get_ld(mp_rop, MPFR_RNDN);
+#endif
+}
+
+/* Newton step for erf(y) = t, returns 0 once converged */
+static int mp_step_erf(mpfr_t y, mpfr_t t, mpfr_t f, mpfr_t d, mpfr_t c)
+{
+    mpfr_rnd_t rnd = MPFR_RNDN;
+
+    mpfr_erf(f, y, rnd);
+    mpfr_sub(f, f, t, rnd);
+
+    /* d = 2 / sqrt(pi) * exp(-y^2) */
+    mpfr_sqr(d, y, rnd);
+    mpfr_neg(d, d, rnd);
+    mpfr_exp(d, d, rnd);
+    mpfr_mul(d, d, c, rnd);
+
+    mpfr_div(f, f, d, rnd);
+    mpfr_sub(y, y, f, rnd);
+
+    return !mpfr_zero_p(f) &&
+           mpfr_get_exp(f) > mpfr_get_exp(y) - ALM_MP_PRECI_BITS / 2;
+}
+
+/* Newton step for log(p) - log(erfc(y)) = 0, lp = log(p) */
+static int mp_step_erfc(mpfr_t y, mpfr_t lp, mpfr_t f, mpfr_t d, mpfr_t c)
+{
+    mpfr_rnd_t rnd = MPFR_RNDN;
+
+    mpfr_erfc(f, y, rnd);
+
+    /* d = 2 / sqrt(pi) * exp(-y^2) / erfc(y) */
+    mpfr_sqr(d, y, rnd);
+    mpfr_neg(d, d, rnd);
+    mpfr_exp(d, d, rnd);
+    mpfr_mul(d, d, c, rnd);
+    mpfr_div(d, d, f, rnd);
+
+    mpfr_log(f, f, rnd);
+    mpfr_sub(f, lp, f, rnd);
+
+    mpfr_div(f, f, d, rnd);
+    mpfr_sub(y, y, f, rnd);
+
+    return !mpfr_zero_p(f) &&
+           mpfr_get_exp(f) > mpfr_get_exp(y) - ALM_MP_PRECI_BITS / 2;
+}
+
+/*
+ * y in [0, MP_ERFC_MAX] with erf(y) = t, or erfc(y) = t for cmpl, to
+ * the long double precision, a denormal t takes about 1100 halvings
+ */
+static long double mp_bisect(long double t, int cmpl)
+{
+    long double lo = 0, hi = MP_ERFC_MAX, mid = 0;
+    int i;
+
+    for (i = 0; i < 2000; i++) {
+        mid = (lo + hi) / 2;
+        if (mid == lo || mid == hi)
+            break;
+        if (cmpl ? erfcl(mid) > t : erfl(mid) < t)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    return mid;
+}
+
+/*
+ * y >= 0 with erf(y) = t for cmpl = 0, erfc(y) = t for cmpl = 1,
+ * t in (0, 1/2] and (0, 1) respectively
+ */
+static void mp_solve(mpfr_t y, mpfr_t t, int cmpl)
+{
+    mpfr_rnd_t rnd = MPFR_RNDN;
+    mpfr_t f, d, c, lp;
+    int i;
+
+    mpfr_inits2(ALM_MP_PRECI_BITS, f, d, c, lp, (mpfr_ptr) 0);
+
+    mpfr_const_pi(c, rnd);
+    mpfr_rec_sqrt(c, c, rnd);
+    mpfr_mul_2ui(c, c, 1, rnd);
+
+    mpfr_set_ld(y, mp_bisect(mpfr_get_ld(t, rnd), cmpl), rnd);
+
+    if (cmpl) {
+        mpfr_log(lp, t, rnd);
+        for (i = 0; i < 100 && mp_step_erfc(y, lp, f, d, c); i++)
+            ;
+    } else {
+        for (i = 0; i < 100 && mp_step_erf(y, t, f, d, c); i++)
+            ;
+    }
+
+    mpfr_clears(f, d, c, lp, (mpfr_ptr) 0);
+}
+
+/* erfcinv(p), p in (0, 2) */
+static void mp_erfcinv(mpfr_t y, mpfr_t p)
+{
+    mpfr_rnd_t rnd = MPFR_RNDN;
+
+    if (mpfr_cmp_ui(p, 1) == 0) {
+        mpfr_set_zero(y, 1);
+    } else if (mpfr_cmp_ui(p, 1) < 0) {
+        mp_solve(y, p, 1);
+    } else {
+        mpfr_ui_sub(p, 2, p, rnd);
+        mp_solve(y, p, 1);
+        mpfr_neg(y, y, rnd);
+    }
+}
+
+REAL_L FUNC_ERFINV(REAL x)
+{
+    REAL_L y;
+
+    mpfr_rnd_t rnd = MPFR_RNDN;
+    mpfr_t mpx, mp_rop;
+
+    if (isnan(x) || fabs(x) > 1)
+        return NAN;
+    if (fabs(x) == 1)
+        return x * INFINITY;
+    if (x == 0)
+        return x;
+
+    mpfr_inits2(ALM_MP_PRECI_BITS, mpx, mp_rop, (mpfr_ptr) 0);
+
+    mpfr_set_d(mpx, fabs(x), rnd);
+    if (fabs(x) <= 0.5) {
+        mp_solve(mp_rop, mpx, 0);
+    } else {
+        mpfr_ui_sub(mpx, 1, mpx, rnd);
+        mp_solve(mp_rop, mpx, 1);
+    }
+    y = mp_get(mp_rop);
+
+    mpfr_clears (mpx, mp_rop, (mpfr_ptr) 0);
+    return x < 0 ? -y : y;
+}
+
+REAL_L FUNC_ERFCINV(REAL x)
+{
+    REAL_L y;
+
+    mpfr_rnd_t rnd = MPFR_RNDN;
+    mpfr_t mpx, mp_rop;
+
+    if (isnan(x) || x < 0 || x > 2)
+        return NAN;
+    if (x == 0)
+        return INFINITY;
+    if (x == 2)
+        return -INFINITY;
+
+    mpfr_inits2(ALM_MP_PRECI_BITS, mpx, mp_rop, (mpfr_ptr) 0);
+
+    mpfr_set_d(mpx, x, rnd);
+    mp_erfcinv(mp_rop, mpx);
+    y = mp_get(mp_rop);
+
+    mpfr_clears (mpx, mp_rop, (mpfr_ptr) 0);
+    return y;
+}
+
+/* cdfnorminv(p) = -sqrt(2) * erfcinv(2p) */
+REAL_L FUNC_CDFNORMINV(REAL x)
+{
+    REAL_L y;
+
+    mpfr_rnd_t rnd = MPFR_RNDN;
+    mpfr_t mpx, mp_rop;
+
+    if (isnan(x) || x < 0 || x > 1)
+        return NAN;
+    if (x == 0)
+        return -INFINITY;
+    if (x == 1)
+        return INFINITY;
+    if (x == 0.5)
+        return 0;
+
+    mpfr_inits2(ALM_MP_PRECI_BITS, mpx, mp_rop, (mpfr_ptr) 0);
+
+    mpfr_set_d(mpx, x, rnd);
+    mpfr_mul_2ui(mpx, mpx, 1, rnd);
+    mp_erfcinv(mp_rop, mpx);
+    mpfr_sqrt_ui(mpx, 2, rnd);
+    mpfr_mul(mp_rop, mp_rop, mpx, rnd);
+    mpfr_neg(mp_rop, mp_rop, rnd);
+    y = mp_get(mp_rop);
+
+    mpfr_clears (mpx, mp_rop, (mpfr_ptr) 0);
+    return y;
+}
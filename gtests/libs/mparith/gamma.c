@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2008-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include "precision.h"
+
+
+#if defined(FLOAT)
+#define FUNC_LGAMMA  alm_mp_lgammaf
+#define FUNC_TGAMMA  alm_mp_tgammaf
+#define FUNC_DIGAMMA alm_mp_digammaf
+
+#elif defined(DOUBLE)
+#define FUNC_LGAMMA  alm_mp_lgamma
+#define FUNC_TGAMMA  alm_mp_tgamma
+#define FUNC_DIGAMMA alm_mp_digamma
+
+#else
+#error
+#endif
+
+#include <mpfr.h>
+
+/*
+ * mpfr evaluates the three in ALM_MP_PRECI_BITS with its own exponent
+ * range, so that tgamma is rounded to REAL_L on either side of the REAL
+ * overflow and underflow. lgamma is log |gamma(x)|, the sign is dropped.
+ */
+
+enum { MP_LGAMMA, MP_TGAMMA, MP_DIGAMMA };
+
+static REAL_L mp_gamma(REAL x, int op)
+{
+    REAL_L y;
+    int sign;
+
+    mpfr_rnd_t rnd = MPFR_RNDN;
+    mpfr_t mpx, mp_rop;
+
+    mpfr_inits2(ALM_MP_PRECI_BITS, mpx, mp_rop, (mpfr_ptr) 0);
+
+    mpfr_set_d(mpx, x, rnd);
+    if (op == MP_LGAMMA)
+        mpfr_lgamma(mp_rop, &sign, mpx, rnd);
+    else if (op == MP_TGAMMA)
+        mpfr_gamma(mp_rop, mpx, rnd);
+    else
+        mpfr_digamma(mp_rop, mpx, rnd);
+
+#if defined(FLOAT)
+    y = mpfr_get_d(mp_rop, rnd);
+#elif defined(DOUBLE)
+    y = mpfr_get_ld(mp_rop, rnd);
+#endif
+
+    mpfr_clears (mpx, mp_rop, (mpfr_ptr) 0);
+    return y;
+}
+
+REAL_L FUNC_LGAMMA(REAL x)
+{
+    return mp_gamma(x, MP_LGAMMA);
+}
+
+REAL_L FUNC_TGAMMA(REAL x)
+{
+    return mp_gamma(x, MP_TGAMMA);
+}
+
+REAL_L FUNC_DIGAMMA(REAL x)
+{
+    return mp_gamma(x, MP_DIGAMMA);
+}
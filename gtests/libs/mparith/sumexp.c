@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "precision.h"
+
+
+#if defined(FLOAT)
+#define FUNC_SUMEXP    alm_mp_sumexpf
+#define FUNC_LOGSUMEXP alm_mp_logsumexpf
+#define FUNC_SUMLOG    alm_mp_sumlogf
+
+#elif defined(DOUBLE)
+#define FUNC_SUMEXP    alm_mp_sumexp
+#define FUNC_LOGSUMEXP alm_mp_logsumexp
+#define FUNC_SUMLOG    alm_mp_sumlog
+
+#else
+#error
+#endif
+
+#include <mpfr.h>
+
+/*
+ * Array reductions. Each term is evaluated and added in ALM_MP_PRECI_BITS,
+ * nothing is shifted or rounded to REAL before the end, and mpfr has the
+ * exponent range for sums far beyond the REAL overflow threshold.
+ * An empty array sums to 0.
+ */
+
+enum { MP_SUMEXP, MP_SUMLOG };
+
+static void mp_sum(mpfr_t sum, int n, const REAL *x, int op)
+{
+    mpfr_rnd_t rnd = MPFR_RNDN;
+    mpfr_t mpx;
+
+    mpfr_init2(mpx, ALM_MP_PRECI_BITS);
+    mpfr_set_zero(sum, 1);
+
+    for (int i = 0; i < n; i++) {
+        mpfr_set_d(mpx, x[i], rnd);
+        if (op == MP_SUMEXP)
+            mpfr_exp(mpx, mpx, rnd);
+        else
+            mpfr_log(mpx, mpx, rnd);
+        mpfr_add(sum, sum, mpx, rnd);
+    }
+
+    mpfr_clear(mpx);
+}
+
+static REAL_L mp_get(mpfr_t mp_rop)
+{
+#if defined(FLOAT)
+    return mpfr_get_d(mp_rop, MPFR_RNDN);
+#elif defined(DOUBLE)
+    return mpfr_get_ld(mp_rop, MPFR_RNDN);
+#endif
+}
+
+REAL_L FUNC_SUMEXP(int n, const REAL *x)
+{
+    REAL_L y;
+    mpfr_t mp_rop;
+
+    mpfr_init2(mp_rop, ALM_MP_PRECI_BITS);
+    mp_sum(mp_rop, n, x, MP_SUMEXP);
+    y = mp_get(mp_rop);
+    mpfr_clear(mp_rop);
+
+    return y;
+}
+
+REAL_L FUNC_LOGSUMEXP(int n, const REAL *x)
+{
+    REAL_L y;
+    mpfr_t mp_rop;
+
+    mpfr_init2(mp_rop, ALM_MP_PRECI_BITS);
+    mp_sum(mp_rop, n, x, MP_SUMEXP);
+    mpfr_log(mp_rop, mp_rop, MPFR_RNDN);
+    y = mp_get(mp_rop);
+    mpfr_clear(mp_rop);
+
+    return y;
+}
+
+REAL_L FUNC_SUMLOG(int n, const REAL *x)
+{
+    REAL_L y;
+    mpfr_t mp_rop;
+
+    mpfr_init2(mp_rop, ALM_MP_PRECI_BITS);
+    mp_sum(mp_rop, n, x, MP_SUMLOG);
+    y = mp_get(mp_rop);
+    mpfr_clear(mp_rop);
+
+    return y;
+}
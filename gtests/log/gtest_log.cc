@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Special values through the vector and array logf variants: +/-0 and
+ * the denormals, which vrs8_logf used to take through the main path,
+ * negatives, inf and nan.
+ */
+
+#include "libm_tests.h"
+#include "almtestvec.h"
+#include "test_log_data.h"
+
+/* the vector kernels are within 1 ulp of the correctly rounded table */
+static const uint64_t maxulp = 1;
+
+TEST(LOG, CONFORMANCE_FLOAT_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_logf_conformance_data);
+  ConfCheckVec<float>("vrs4_logf", test_logf_conformance_data, n, 1, 4, test_v4s, maxulp);
+  ConfCheckVec<float>("vrs8_logf", test_logf_conformance_data, n, 1, 8, test_v8s, maxulp);
+#if defined(__AVX512__)
+  ConfCheckVec<float>("vrs16_logf", test_logf_conformance_data, n, 1, 16, test_v16s, maxulp);
+#endif
+  ConfCheckVec<float>("vrsa_logf", test_logf_conformance_data, n, 1, 0, test_vas, maxulp);
+}
+
+/*
+ * vrd2/vrd4_log fix up 0, denormals, negatives, inf and nan in the vector
+ * unit, they used to return finite values for 0, inf and the denormals.
+ * Expected values are glibc log, the vector kernels are exact on these.
+ */
+static libm_test_special_data_f64 test_log_vector_special_data[] = {
+    {0x0000000000000000, 0xfff0000000000000, FE_DIVBYZERO,}, //0, -inf
+    {0x8000000000000000, 0xfff0000000000000, FE_DIVBYZERO,}, //-0, -inf
+    {0x0000000000000001, 0xc0874385446d71c3, 0,},            //min denormal
+    {0x0000000000000002, 0xc0873df9b3adb335, 0,},
+    {0x0000000000000003, 0xc0873abb4f301b42, 0,},
+    {0x0000000000000fff, 0xc08700fafb748340, 0,},
+    {0x0000000123456789, 0xc086910ad2ea4ac8, 0,},
+    {0x0004a5bd4de6aa36, 0xc0862d0fc26ec507, 0,},
+    {0x0008000000000000, 0xc08628b76e3a7b61, 0,},
+    {0x000fffffffffffff, 0xc086232bdd7abcd2, 0,},            //max denormal
+    {0x0010000000000000, 0xc086232bdd7abcd2, 0,},            //min normal
+    {0x800fffffffffffff, 0x7ff8000000000000, FE_INVALID,},   //-denormal, nan
+    {0x8000000000000001, 0x7ff8000000000000, FE_INVALID,},
+    {0xbff0000000000000, 0x7ff8000000000000, FE_INVALID,},   //-1, nan
+    {0xfff0000000000000, 0x7ff8000000000000, FE_INVALID,},   //-inf, nan
+    {0x7ff0000000000000, 0x7ff0000000000000, 0,},            //inf, inf
+    {0x7fefffffffffffff, 0x40862e42fefa39ef, 0,},            //max double
+    {0x3ff0000000000000, 0x0000000000000000, 0,},            //1, 0
+    {0x4000000000000000, 0x3fe62e42fefa39ef, 0,},            //2, ln2
+    {0x7ff8000000000000, 0x7ff8000000000000, 0,},            //qnan
+    {0xfff8000000000000, 0xfff8000000000000, 0,},            //-qnan
+    {0x7ff4000000000000, 0x7ffc000000000000, FE_INVALID,},   //snan
+};
+
+TEST(LOG, CONFORMANCE_DOUBLE_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_log_vector_special_data);
+  ConfCheckVec<double>("vrd2_log", test_log_vector_special_data, n, 1, 2, test_v2d, maxulp);
+  ConfCheckVec<double>("vrd4_log", test_log_vector_special_data, n, 1, 4, test_v4d, maxulp);
+#if defined(__AVX512__)
+  ConfCheckVec<double>("vrd8_log", test_log_vector_special_data, n, 1, 8, test_v8d, maxulp);
+#endif
+  ConfCheckVec<double>("vrda_log", test_log_vector_special_data, n, 1, 0, test_vad, maxulp);
+}
@@ -138,6 +138,24 @@ extern "C" {
   __m256 LIBM_FUNC_VEC(s, 8, logbf)(__m256);
 #endif
 
+int test_vad(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  double *ip  = (double*)data->ip;
+  double *op  = (double*)data->op;
+  amd_vrda_logb(count, ip, op);
+#endif
+  return 0;
+}
+
+int test_vas(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  float *ip  = (float*)data->ip;
+  float *op  = (float*)data->op;
+  amd_vrsa_logbf(count, ip, op);
+#endif
+  return 0;
+}
+
 int test_v2d(test_data *data, int idx)  {
 #if 0
   double *ip  = (double*)data->ip;
@@ -161,7 +179,7 @@ int test_v4s(test_data *data, int idx)  {
 }
 
 int test_v4d(test_data *data, int idx)  {
-#if 0
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
   double *ip  = (double*)data->ip;
   double *op  = (double*)data->op;
   __m256d ip4 = _mm256_set_pd(ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
@@ -172,7 +190,7 @@ int test_v4d(test_data *data, int idx)  {
 }
 
 int test_v8s(test_data *data, int idx)  {
-#if 0
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
   float *ip  = (float*)data->ip;
   float *op  = (float*)data->op;
   __m256 ip8 = _mm256_set_ps(ip[idx+7], ip[idx+6], ip[idx+5], ip[idx+4],
@@ -184,8 +202,7 @@ int test_v8s(test_data *data, int idx)  {
 }
 
 int test_v8d(test_data *data, int idx)  {
-/* later change this to #if defined(__AVX512__)*/
-#if 0
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL) && defined(__AVX512__)
   double *ip  = (double*)data->ip;
   double *op  = (double*)data->op;
   __m512d ip8 = _mm512_set_pd(ip[idx+7], ip[idx+6], ip[idx+5], ip[idx+4],
@@ -197,8 +214,7 @@ int test_v8d(test_data *data, int idx)  {
 }
 
 int test_v16s(test_data *data, int idx)  {
-/* later change this to #if defined(__AVX512__)*/
-#if 0
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL) && defined(__AVX512__)
   float *ip = (float*)data->ip;
   float *op  = (float*)data->op;
   __m512 ip16 = _mm512_set_ps(ip[idx+15], ip[idx+14], ip[idx+13], ip[idx+12],
@@ -48,7 +48,7 @@ string getFunctionName(string s)
 }
 
 int main(int argc, char **argv) {
-  InputParams params;
+  InputParams params = {};
  
   ALM::Test::cmdLine *cmd = ALM::Test::cmdLineStart();
 
@@ -57,7 +57,6 @@ int main(int argc, char **argv) {
 
   cmd->Validate();
 
-  memset((void *)&params, 0, sizeof(InputParams));
   params.testFunction = getFunctionName(argv[0]);
   if (cmd->Echo(&params))
     return EXIT_FAILURE;
@@ -67,7 +66,8 @@ int main(int argc, char **argv) {
     (params.ttype == ALM::TestType::E_Conformance)) {
       gtest_main(argc, argv, &params);
     } else { 
-      gbench_main(argc, argv, &params);
+      if (gbench_main(argc, argv, &params))
+        return EXIT_FAILURE;
     } 
 
   return 0;
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/*
+ * Special values through the vector and array powf variants: zero and
+ * denormal bases, which vrs4/vrs8_powf used to take through the main
+ * path (powf(+0, -1.4e-4) gave 1.01), negative bases with integer and
+ * other exponents, inf and nan.
+ */
+
+#include "libm_tests.h"
+#include "almtestvec.h"
+
+/* { x, powf(x, y), 0, y }, results of glibc powf */
+static libm_test_special_data_f32
+test_powf_vector_special_data[] = {
+    {0x00000000, 0x7f800000, 0, 0xb914a000},   // +0 ^ -1.4e-4
+    {0x00000000, 0x00000000, 0, 0x3e99999a},   // +0 ^ 0.3
+    {0x00000000, 0x7f800000, 0, 0xbe99999a},   // +0 ^ -0.3
+    {0x00000000, 0x00000000, 0, 0x40200000},   // +0 ^ 2.5
+    {0x00000000, 0x00000000, 0, 0x40400000},   // +0 ^ 3
+    {0x00000000, 0x7f800000, 0, 0xc0400000},   // +0 ^ -3
+    {0x00000000, 0x00000000, 0, 0x3f000000},   // +0 ^ 0.5
+    {0x00000000, 0x7fc00000, 0, 0x7fc00000},   // +0 ^ nan
+    {0x80000000, 0x7f800000, 0, 0xb914a000},   // -0 ^ -1.4e-4
+    {0x80000000, 0x00000000, 0, 0x3e99999a},   // -0 ^ 0.3
+    {0x80000000, 0x7f800000, 0, 0xbe99999a},   // -0 ^ -0.3
+    {0x80000000, 0x00000000, 0, 0x40200000},   // -0 ^ 2.5
+    {0x80000000, 0x80000000, 0, 0x40400000},   // -0 ^ 3
+    {0x80000000, 0xff800000, 0, 0xc0400000},   // -0 ^ -3
+    {0x80000000, 0x00000000, 0, 0x3f000000},   // -0 ^ 0.5
+    {0x80000000, 0x7fc00000, 0, 0x7fc00000},   // -0 ^ nan
+    {0x00000001, 0x3f81e336, 0, 0xb914a000},   // 2^-149 ^ -1.4e-4
+    {0x00000001, 0x291d9617, 0, 0x3e99999a},   // 2^-149 ^ 0.3
+    {0x00000001, 0x55cfefd7, 0, 0xbe99999a},   // 2^-149 ^ -0.3
+    {0x00000001, 0x00000000, 0, 0x40200000},   // 2^-149 ^ 2.5
+    {0x00000001, 0x00000000, 0, 0x40400000},   // 2^-149 ^ 3
+    {0x00000001, 0x7f800000, 0, 0xc0400000},   // 2^-149 ^ -3
+    {0x00000001, 0x1a3504f3, 0, 0x3f000000},   // 2^-149 ^ 0.5
+    {0x00000001, 0x7fc00000, 0, 0x7fc00000},   // 2^-149 ^ nan
+    {0x00000300, 0x3f81c3ea, 0, 0xb914a000},   // 1.5*2^-140 ^ -1.4e-4
+    {0x00000300, 0x2a908e66, 0, 0x3e99999a},   // 1.5*2^-140 ^ 0.3
+    {0x00000300, 0x5462ae11, 0, 0xbe99999a},   // 1.5*2^-140 ^ -0.3
+    {0x00000300, 0x00000000, 0, 0x40200000},   // 1.5*2^-140 ^ 2.5
+    {0x00000300, 0x00000000, 0, 0x40400000},   // 1.5*2^-140 ^ 3
+    {0x00000300, 0x7f800000, 0, 0xc0400000},   // 1.5*2^-140 ^ -3
+    {0x00000300, 0x1c9cc471, 0, 0x3f000000},   // 1.5*2^-140 ^ 0.5
+    {0x00000300, 0x7fc00000, 0, 0x7fc00000},   // 1.5*2^-140 ^ nan
+    {0xc0000000, 0xffc00000, 0, 0xb914a000},   // -2 ^ -1.4e-4
+    {0xc0000000, 0xffc00000, 0, 0x3e99999a},   // -2 ^ 0.3
+    {0xc0000000, 0xffc00000, 0, 0xbe99999a},   // -2 ^ -0.3
+    {0xc0000000, 0xffc00000, 0, 0x40200000},   // -2 ^ 2.5
+    {0xc0000000, 0xc1000000, 0, 0x40400000},   // -2 ^ 3
+    {0xc0000000, 0xbe000000, 0, 0xc0400000},   // -2 ^ -3
+    {0xc0000000, 0xffc00000, 0, 0x3f000000},   // -2 ^ 0.5
+    {0xc0000000, 0x7fc00000, 0, 0x7fc00000},   // -2 ^ nan
+    {0x7f800000, 0x00000000, 0, 0xb914a000},   // inf ^ -1.4e-4
+    {0x7f800000, 0x7f800000, 0, 0x3e99999a},   // inf ^ 0.3
+    {0x7f800000, 0x00000000, 0, 0xbe99999a},   // inf ^ -0.3
+    {0x7f800000, 0x7f800000, 0, 0x40200000},   // inf ^ 2.5
+    {0x7f800000, 0x7f800000, 0, 0x40400000},   // inf ^ 3
+    {0x7f800000, 0x00000000, 0, 0xc0400000},   // inf ^ -3
+    {0x7f800000, 0x7f800000, 0, 0x3f000000},   // inf ^ 0.5
+    {0x7f800000, 0x7fc00000, 0, 0x7fc00000},   // inf ^ nan
+    {0xff800000, 0x00000000, 0, 0xb914a000},   // -inf ^ -1.4e-4
+    {0xff800000, 0x7f800000, 0, 0x3e99999a},   // -inf ^ 0.3
+    {0xff800000, 0x00000000, 0, 0xbe99999a},   // -inf ^ -0.3
+    {0xff800000, 0x7f800000, 0, 0x40200000},   // -inf ^ 2.5
+    {0xff800000, 0xff800000, 0, 0x40400000},   // -inf ^ 3
+    {0xff800000, 0x80000000, 0, 0xc0400000},   // -inf ^ -3
+    {0xff800000, 0x7f800000, 0, 0x3f000000},   // -inf ^ 0.5
+    {0xff800000, 0x7fc00000, 0, 0x7fc00000},   // -inf ^ nan
+    {0x7fc00000, 0x7fc00000, 0, 0xb914a000},   // nan ^ -1.4e-4
+    {0x7fc00000, 0x7fc00000, 0, 0x3e99999a},   // nan ^ 0.3
+    {0x7fc00000, 0x7fc00000, 0, 0xbe99999a},   // nan ^ -0.3
+    {0x7fc00000, 0x7fc00000, 0, 0x40200000},   // nan ^ 2.5
+    {0x7fc00000, 0x7fc00000, 0, 0x40400000},   // nan ^ 3
+    {0x7fc00000, 0x7fc00000, 0, 0xc0400000},   // nan ^ -3
+    {0x7fc00000, 0x7fc00000, 0, 0x3f000000},   // nan ^ 0.5
+    {0x7fc00000, 0x7fc00000, 0, 0x7fc00000},   // nan ^ nan
+    {0x3f800000, 0x3f800000, 0, 0xb914a000},   // 1 ^ -1.4e-4
+    {0x3f800000, 0x3f800000, 0, 0x3e99999a},   // 1 ^ 0.3
+    {0x3f800000, 0x3f800000, 0, 0xbe99999a},   // 1 ^ -0.3
+    {0x3f800000, 0x3f800000, 0, 0x40200000},   // 1 ^ 2.5
+    {0x3f800000, 0x3f800000, 0, 0x40400000},   // 1 ^ 3
+    {0x3f800000, 0x3f800000, 0, 0xc0400000},   // 1 ^ -3
+    {0x3f800000, 0x3f800000, 0, 0x3f000000},   // 1 ^ 0.5
+    {0x3f800000, 0x3f800000, 0, 0x7fc00000},   // 1 ^ nan
+};
+
+/* the vector kernels are within 2 ulp */
+static const uint64_t maxulp = 2;
+
+TEST(POW, CONFORMANCE_FLOAT_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_powf_vector_special_data);
+  ConfCheckVec<float>("vrs4_powf", test_powf_vector_special_data, n, 2, 4, test_v4s, maxulp);
+  ConfCheckVec<float>("vrs8_powf", test_powf_vector_special_data, n, 2, 8, test_v8s, maxulp);
+#if defined(__AVX512__)
+  ConfCheckVec<float>("vrs16_powf", test_powf_vector_special_data, n, 2, 16, test_v16s, maxulp);
+#endif
+  ConfCheckVec<float>("vrsa_powf", test_powf_vector_special_data, n, 2, 0, test_vas, maxulp);
+}
+
+/*
+ * vrd2/vrd4_pow fix up the same bases and exponents with blends, and
+ * recompute the lanes whose result overflows or underflows from a clamped
+ * y*log(x). The last group mixes those with normal lanes.
+ * { x, pow(x, y), 0, y }, results of glibc pow
+ */
+static libm_test_special_data_f64
+test_pow_vector_special_data[] = {
+    {0x0000000000000000, 0x0000000000000000, 0, 0x3fd3333333333333},   // +0 ^ 0.3
+    {0x0000000000000000, 0x7ff0000000000000, 0, 0xbfd3333333333333},   // +0 ^ -0.3
+    {0x0000000000000000, 0x0000000000000000, 0, 0x4004000000000000},   // +0 ^ 2.5
+    {0x0000000000000000, 0x0000000000000000, 0, 0x4008000000000000},   // +0 ^ 3
+    {0x0000000000000000, 0x7ff0000000000000, 0, 0xc008000000000000},   // +0 ^ -3
+    {0x0000000000000000, 0x0000000000000000, 0, 0x7ff0000000000000},   // +0 ^ inf
+    {0x0000000000000000, 0x7ff0000000000000, 0, 0xfff0000000000000},   // +0 ^ -inf
+    {0x0000000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // +0 ^ nan
+    {0x8000000000000000, 0x0000000000000000, 0, 0x3fd3333333333333},   // -0 ^ 0.3
+    {0x8000000000000000, 0x7ff0000000000000, 0, 0xbfd3333333333333},   // -0 ^ -0.3
+    {0x8000000000000000, 0x0000000000000000, 0, 0x4004000000000000},   // -0 ^ 2.5
+    {0x8000000000000000, 0x8000000000000000, 0, 0x4008000000000000},   // -0 ^ 3
+    {0x8000000000000000, 0xfff0000000000000, 0, 0xc008000000000000},   // -0 ^ -3
+    {0x8000000000000000, 0x0000000000000000, 0, 0x7ff0000000000000},   // -0 ^ inf
+    {0x8000000000000000, 0x7ff0000000000000, 0, 0xfff0000000000000},   // -0 ^ -inf
+    {0x8000000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -0 ^ nan
+    {0x0000000000000001, 0x2bcbdb8cdadbe161, 0, 0x3fd3333333333333},   // 2^-1074 ^ 0.3
+    {0x0000000000000001, 0x5412611186bae64a, 0, 0xbfd3333333333333},   // 2^-1074 ^ -0.3
+    {0x0000000000000001, 0x0000000000000000, 0, 0x4004000000000000},   // 2^-1074 ^ 2.5
+    {0x0000000000000001, 0x0000000000000000, 0, 0x4008000000000000},   // 2^-1074 ^ 3
+    {0x0000000000000001, 0x7ff0000000000000, 0, 0xc008000000000000},   // 2^-1074 ^ -3
+    {0x0000000000000001, 0x0000000000000000, 0, 0x7ff0000000000000},   // 2^-1074 ^ inf
+    {0x0000000000000001, 0x7ff0000000000000, 0, 0xfff0000000000000},   // 2^-1074 ^ -inf
+    {0x0000000000000001, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // 2^-1074 ^ nan
+    {0x800fffffffffffff, 0x7ff8000000000000, 0, 0x3fd3333333333333},   // -max denormal ^ 0.3
+    {0x800fffffffffffff, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // -max denormal ^ -0.3
+    {0x800fffffffffffff, 0x7ff8000000000000, 0, 0x4004000000000000},   // -max denormal ^ 2.5
+    {0x800fffffffffffff, 0x8000000000000000, 0, 0x4008000000000000},   // -max denormal ^ 3
+    {0x800fffffffffffff, 0xfff0000000000000, 0, 0xc008000000000000},   // -max denormal ^ -3
+    {0x800fffffffffffff, 0x0000000000000000, 0, 0x7ff0000000000000},   // -max denormal ^ inf
+    {0x800fffffffffffff, 0x7ff0000000000000, 0, 0xfff0000000000000},   // -max denormal ^ -inf
+    {0x800fffffffffffff, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -max denormal ^ nan
+    {0xc000000000000000, 0x7ff8000000000000, 0, 0x3fd3333333333333},   // -2 ^ 0.3
+    {0xc000000000000000, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // -2 ^ -0.3
+    {0xc000000000000000, 0x7ff8000000000000, 0, 0x4004000000000000},   // -2 ^ 2.5
+    {0xc000000000000000, 0xc020000000000000, 0, 0x4008000000000000},   // -2 ^ 3
+    {0xc000000000000000, 0xbfc0000000000000, 0, 0xc008000000000000},   // -2 ^ -3
+    {0xc000000000000000, 0x7ff0000000000000, 0, 0x7ff0000000000000},   // -2 ^ inf
+    {0xc000000000000000, 0x0000000000000000, 0, 0xfff0000000000000},   // -2 ^ -inf
+    {0xc000000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -2 ^ nan
+    {0xfff0000000000000, 0x7ff0000000000000, 0, 0x3fd3333333333333},   // -inf ^ 0.3
+    {0xfff0000000000000, 0x0000000000000000, 0, 0xbfd3333333333333},   // -inf ^ -0.3
+    {0xfff0000000000000, 0x7ff0000000000000, 0, 0x4004000000000000},   // -inf ^ 2.5
+    {0xfff0000000000000, 0xfff0000000000000, 0, 0x4008000000000000},   // -inf ^ 3
+    {0xfff0000000000000, 0x8000000000000000, 0, 0xc008000000000000},   // -inf ^ -3
+    {0xfff0000000000000, 0x7ff0000000000000, 0, 0x7ff0000000000000},   // -inf ^ inf
+    {0xfff0000000000000, 0x0000000000000000, 0, 0xfff0000000000000},   // -inf ^ -inf
+    {0xfff0000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -inf ^ nan
+    {0x7ff0000000000000, 0x7ff0000000000000, 0, 0x3fd3333333333333},   // inf ^ 0.3
+    {0x7ff0000000000000, 0x0000000000000000, 0, 0xbfd3333333333333},   // inf ^ -0.3
+    {0x7ff0000000000000, 0x7ff0000000000000, 0, 0x4004000000000000},   // inf ^ 2.5
+    {0x7ff0000000000000, 0x7ff0000000000000, 0, 0x4008000000000000},   // inf ^ 3
+    {0x7ff0000000000000, 0x0000000000000000, 0, 0xc008000000000000},   // inf ^ -3
+    {0x7ff0000000000000, 0x7ff0000000000000, 0, 0x7ff0000000000000},   // inf ^ inf
+    {0x7ff0000000000000, 0x0000000000000000, 0, 0xfff0000000000000},   // inf ^ -inf
+    {0x7ff0000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // inf ^ nan
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x3fd3333333333333},   // nan ^ 0.3
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // nan ^ -0.3
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x4004000000000000},   // nan ^ 2.5
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x4008000000000000},   // nan ^ 3
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0xc008000000000000},   // nan ^ -3
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x7ff0000000000000},   // nan ^ inf
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0xfff0000000000000},   // nan ^ -inf
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // nan ^ nan
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x3fd3333333333333},   // 1 ^ 0.3
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0xbfd3333333333333},   // 1 ^ -0.3
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x4004000000000000},   // 1 ^ 2.5
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x4008000000000000},   // 1 ^ 3
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0xc008000000000000},   // 1 ^ -3
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x7ff0000000000000},   // 1 ^ inf
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0xfff0000000000000},   // 1 ^ -inf
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x7ff8000000000000},   // 1 ^ nan
+    {0xbff0000000000000, 0x7ff8000000000000, 0, 0x3fd3333333333333},   // -1 ^ 0.3
+    {0xbff0000000000000, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // -1 ^ -0.3
+    {0xbff0000000000000, 0x7ff8000000000000, 0, 0x4004000000000000},   // -1 ^ 2.5
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0x4008000000000000},   // -1 ^ 3
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0xc008000000000000},   // -1 ^ -3
+    {0xbff0000000000000, 0x3ff0000000000000, 0, 0x7ff0000000000000},   // -1 ^ inf
+    {0xbff0000000000000, 0x3ff0000000000000, 0, 0xfff0000000000000},   // -1 ^ -inf
+    {0xbff0000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -1 ^ nan
+    {0x4024000000000000, 0x7ff0000000000000, 0, 0x4079000000000000},   // 10 ^ 400, overflow
+    {0x4024000000000000, 0x0000000000000000, 0, 0xc079000000000000},   // 10 ^ -400, underflow
+    {0x4000000000000000, 0x0000000000000001, 0, 0xc090ca0000000000},   // 2 ^ -1074.5
+    {0x3fe0000000000000, 0x0000000000000001, 0, 0x4090c80000000000},   // 0.5 ^ 1074
+    {0x4000000000000000, 0x7fe6a09e667f3bcd, 0, 0x408ffc0000000000},   // 2 ^ 1023.5
+    {0xc000000000000000, 0x8000000000000000, 0, 0xc090cc0000000000},   // -2 ^ -1075
+    {0x3ff8000000000000, 0x3ff5afbb0fd2812c, 0, 0x3fe8000000000000},   // 1.5 ^ 0.75
+    {0x0000000000000001, 0x6180000000000000, 0, 0xbfe0000000000000},   // 2^-1074 ^ -0.5
+};
+
+TEST(POW, CONFORMANCE_DOUBLE_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_pow_vector_special_data);
+  ConfCheckVec<double>("vrd2_pow", test_pow_vector_special_data, n, 2, 2, test_v2d, maxulp);
+  ConfCheckVec<double>("vrd4_pow", test_pow_vector_special_data, n, 2, 4, test_v4d, maxulp);
+#if defined(__AVX512__)
+  ConfCheckVec<double>("vrd8_pow", test_pow_vector_special_data, n, 2, 8, test_v8d, maxulp);
+#endif
+  ConfCheckVec<double>("vrda_pow", test_pow_vector_special_data, n, 2, 0, test_vad, maxulp);
+}
@@ -25,13 +25,17 @@
  *
  */
 
+#include <algorithm>
+#include <climits>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <stdio.h>
 #include <float.h>
 #include <math.h>
 #include <vector>
+#include <immintrin.h>
 #include "almstruct.h"
 #include "defs.h"
 #include "almtest.h"
@@ -41,6 +45,7 @@
 #include "verify.h"
 #include <external/amdlibm.h>
 #include "func_var_existence.h"
+#include "almtestvec.h"
 
 /* Real Number Function Variants */
 
@@ -291,3 +296,890 @@ TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES) {
   "Vec_Array","Accuracy","vad",count,(count-nfail), nfail, max_ulp_err);
   ptr->tstcnt++;
 }
+
+
+/*
+ * Special values through the vector and array powx variants. The rows come
+ * in groups of 16 bases with the same y, the exponent of a whole vector or
+ * array call. Negative bases with an integer y take the sign of the parity
+ * of y, also for |y| >= 2^53 (even) and y just below it (2^52 + 1, odd),
+ * negative bases with any other y give nan.
+ */
+
+#define POWX_GROUP 16
+
+/* { x, pow(x, y), 0, y }, results of glibc pow */
+static libm_test_special_data_f64
+test_powx_vector_special_data[] = {
+    /* y = 0 */
+    {0x0000000000000000, 0x3ff0000000000000, 0, 0x0000000000000000},   // +0 ^ 0
+    {0x8000000000000000, 0x3ff0000000000000, 0, 0x0000000000000000},   // -0 ^ 0
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x0000000000000000},   // 1 ^ 0
+    {0xbff0000000000000, 0x3ff0000000000000, 0, 0x0000000000000000},   // -1 ^ 0
+    {0x4000000000000000, 0x3ff0000000000000, 0, 0x0000000000000000},   // 2 ^ 0
+    {0xc000000000000000, 0x3ff0000000000000, 0, 0x0000000000000000},   // -2 ^ 0
+    {0xbfe0000000000000, 0x3ff0000000000000, 0, 0x0000000000000000},   // -0.5 ^ 0
+    {0x4008000000000000, 0x3ff0000000000000, 0, 0x0000000000000000},   // 3 ^ 0
+    {0xc008000000000000, 0x3ff0000000000000, 0, 0x0000000000000000},   // -3 ^ 0
+    {0xbff028f5c28f5c29, 0x3ff0000000000000, 0, 0x0000000000000000},   // -1.01 ^ 0
+    {0x0000000000004000, 0x3ff0000000000000, 0, 0x0000000000000000},   // 2^-1060 ^ 0
+    {0x8000000000004000, 0x3ff0000000000000, 0, 0x0000000000000000},   // -2^-1060 ^ 0
+    {0x7e37e43c8800759c, 0x3ff0000000000000, 0, 0x0000000000000000},   // 1e300 ^ 0
+    {0xfe37e43c8800759c, 0x3ff0000000000000, 0, 0x0000000000000000},   // -1e300 ^ 0
+    {0xfff0000000000000, 0x3ff0000000000000, 0, 0x0000000000000000},   // -inf ^ 0
+    {0x7ff8000000000000, 0x3ff0000000000000, 0, 0x0000000000000000},   // nan ^ 0
+    /* y = 1 */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x3ff0000000000000},   // +0 ^ 1
+    {0x8000000000000000, 0x8000000000000000, 0, 0x3ff0000000000000},   // -0 ^ 1
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x3ff0000000000000},   // 1 ^ 1
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0x3ff0000000000000},   // -1 ^ 1
+    {0x4000000000000000, 0x4000000000000000, 0, 0x3ff0000000000000},   // 2 ^ 1
+    {0xc000000000000000, 0xc000000000000000, 0, 0x3ff0000000000000},   // -2 ^ 1
+    {0xbfe0000000000000, 0xbfe0000000000000, 0, 0x3ff0000000000000},   // -0.5 ^ 1
+    {0x4008000000000000, 0x4008000000000000, 0, 0x3ff0000000000000},   // 3 ^ 1
+    {0xc008000000000000, 0xc008000000000000, 0, 0x3ff0000000000000},   // -3 ^ 1
+    {0xbff028f5c28f5c29, 0xbff028f5c28f5c29, 0, 0x3ff0000000000000},   // -1.01 ^ 1
+    {0x0000000000004000, 0x0000000000004000, 0, 0x3ff0000000000000},   // 2^-1060 ^ 1
+    {0x8000000000004000, 0x8000000000004000, 0, 0x3ff0000000000000},   // -2^-1060 ^ 1
+    {0x7e37e43c8800759c, 0x7e37e43c8800759c, 0, 0x3ff0000000000000},   // 1e300 ^ 1
+    {0xfe37e43c8800759c, 0xfe37e43c8800759c, 0, 0x3ff0000000000000},   // -1e300 ^ 1
+    {0xfff0000000000000, 0xfff0000000000000, 0, 0x3ff0000000000000},   // -inf ^ 1
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x3ff0000000000000},   // nan ^ 1
+    /* y = 2 */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x4000000000000000},   // +0 ^ 2
+    {0x8000000000000000, 0x0000000000000000, 0, 0x4000000000000000},   // -0 ^ 2
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x4000000000000000},   // 1 ^ 2
+    {0xbff0000000000000, 0x3ff0000000000000, 0, 0x4000000000000000},   // -1 ^ 2
+    {0x4000000000000000, 0x4010000000000000, 0, 0x4000000000000000},   // 2 ^ 2
+    {0xc000000000000000, 0x4010000000000000, 0, 0x4000000000000000},   // -2 ^ 2
+    {0xbfe0000000000000, 0x3fd0000000000000, 0, 0x4000000000000000},   // -0.5 ^ 2
+    {0x4008000000000000, 0x4022000000000000, 0, 0x4000000000000000},   // 3 ^ 2
+    {0xc008000000000000, 0x4022000000000000, 0, 0x4000000000000000},   // -3 ^ 2
+    {0xbff028f5c28f5c29, 0x3ff0525460aa64c3, 0, 0x4000000000000000},   // -1.01 ^ 2
+    {0x0000000000004000, 0x0000000000000000, 0, 0x4000000000000000},   // 2^-1060 ^ 2
+    {0x8000000000004000, 0x0000000000000000, 0, 0x4000000000000000},   // -2^-1060 ^ 2
+    {0x7e37e43c8800759c, 0x7ff0000000000000, 0, 0x4000000000000000},   // 1e300 ^ 2
+    {0xfe37e43c8800759c, 0x7ff0000000000000, 0, 0x4000000000000000},   // -1e300 ^ 2
+    {0xfff0000000000000, 0x7ff0000000000000, 0, 0x4000000000000000},   // -inf ^ 2
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x4000000000000000},   // nan ^ 2
+    /* y = 3 */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x4008000000000000},   // +0 ^ 3
+    {0x8000000000000000, 0x8000000000000000, 0, 0x4008000000000000},   // -0 ^ 3
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x4008000000000000},   // 1 ^ 3
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0x4008000000000000},   // -1 ^ 3
+    {0x4000000000000000, 0x4020000000000000, 0, 0x4008000000000000},   // 2 ^ 3
+    {0xc000000000000000, 0xc020000000000000, 0, 0x4008000000000000},   // -2 ^ 3
+    {0xbfe0000000000000, 0xbfc0000000000000, 0, 0x4008000000000000},   // -0.5 ^ 3
+    {0x4008000000000000, 0x403b000000000000, 0, 0x4008000000000000},   // 3 ^ 3
+    {0xc008000000000000, 0xc03b000000000000, 0, 0x4008000000000000},   // -3 ^ 3
+    {0xbff028f5c28f5c29, 0xbff07c1ce6c093da, 0, 0x4008000000000000},   // -1.01 ^ 3
+    {0x0000000000004000, 0x0000000000000000, 0, 0x4008000000000000},   // 2^-1060 ^ 3
+    {0x8000000000004000, 0x8000000000000000, 0, 0x4008000000000000},   // -2^-1060 ^ 3
+    {0x7e37e43c8800759c, 0x7ff0000000000000, 0, 0x4008000000000000},   // 1e300 ^ 3
+    {0xfe37e43c8800759c, 0xfff0000000000000, 0, 0x4008000000000000},   // -1e300 ^ 3
+    {0xfff0000000000000, 0xfff0000000000000, 0, 0x4008000000000000},   // -inf ^ 3
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x4008000000000000},   // nan ^ 3
+    /* y = -1 */
+    {0x0000000000000000, 0x7ff0000000000000, 0, 0xbff0000000000000},   // +0 ^ -1
+    {0x8000000000000000, 0xfff0000000000000, 0, 0xbff0000000000000},   // -0 ^ -1
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0xbff0000000000000},   // 1 ^ -1
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0xbff0000000000000},   // -1 ^ -1
+    {0x4000000000000000, 0x3fe0000000000000, 0, 0xbff0000000000000},   // 2 ^ -1
+    {0xc000000000000000, 0xbfe0000000000000, 0, 0xbff0000000000000},   // -2 ^ -1
+    {0xbfe0000000000000, 0xc000000000000000, 0, 0xbff0000000000000},   // -0.5 ^ -1
+    {0x4008000000000000, 0x3fd5555555555555, 0, 0xbff0000000000000},   // 3 ^ -1
+    {0xc008000000000000, 0xbfd5555555555555, 0, 0xbff0000000000000},   // -3 ^ -1
+    {0xbff028f5c28f5c29, 0xbfefaee41e6a7498, 0, 0xbff0000000000000},   // -1.01 ^ -1
+    {0x0000000000004000, 0x7ff0000000000000, 0, 0xbff0000000000000},   // 2^-1060 ^ -1
+    {0x8000000000004000, 0xfff0000000000000, 0, 0xbff0000000000000},   // -2^-1060 ^ -1
+    {0x7e37e43c8800759c, 0x01a56e1fc2f8f359, 0, 0xbff0000000000000},   // 1e300 ^ -1
+    {0xfe37e43c8800759c, 0x81a56e1fc2f8f359, 0, 0xbff0000000000000},   // -1e300 ^ -1
+    {0xfff0000000000000, 0x8000000000000000, 0, 0xbff0000000000000},   // -inf ^ -1
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0xbff0000000000000},   // nan ^ -1
+    /* y = -2 */
+    {0x0000000000000000, 0x7ff0000000000000, 0, 0xc000000000000000},   // +0 ^ -2
+    {0x8000000000000000, 0x7ff0000000000000, 0, 0xc000000000000000},   // -0 ^ -2
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0xc000000000000000},   // 1 ^ -2
+    {0xbff0000000000000, 0x3ff0000000000000, 0, 0xc000000000000000},   // -1 ^ -2
+    {0x4000000000000000, 0x3fd0000000000000, 0, 0xc000000000000000},   // 2 ^ -2
+    {0xc000000000000000, 0x3fd0000000000000, 0, 0xc000000000000000},   // -2 ^ -2
+    {0xbfe0000000000000, 0x4010000000000000, 0, 0xc000000000000000},   // -0.5 ^ -2
+    {0x4008000000000000, 0x3fbc71c71c71c71c, 0, 0xc000000000000000},   // 3 ^ -2
+    {0xc008000000000000, 0x3fbc71c71c71c71c, 0, 0xc000000000000000},   // -3 ^ -2
+    {0xbff028f5c28f5c29, 0x3fef5e95d2133924, 0, 0xc000000000000000},   // -1.01 ^ -2
+    {0x0000000000004000, 0x7ff0000000000000, 0, 0xc000000000000000},   // 2^-1060 ^ -2
+    {0x8000000000004000, 0x7ff0000000000000, 0, 0xc000000000000000},   // -2^-1060 ^ -2
+    {0x7e37e43c8800759c, 0x0000000000000000, 0, 0xc000000000000000},   // 1e300 ^ -2
+    {0xfe37e43c8800759c, 0x0000000000000000, 0, 0xc000000000000000},   // -1e300 ^ -2
+    {0xfff0000000000000, 0x0000000000000000, 0, 0xc000000000000000},   // -inf ^ -2
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0xc000000000000000},   // nan ^ -2
+    /* y = -3 */
+    {0x0000000000000000, 0x7ff0000000000000, 0, 0xc008000000000000},   // +0 ^ -3
+    {0x8000000000000000, 0xfff0000000000000, 0, 0xc008000000000000},   // -0 ^ -3
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0xc008000000000000},   // 1 ^ -3
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0xc008000000000000},   // -1 ^ -3
+    {0x4000000000000000, 0x3fc0000000000000, 0, 0xc008000000000000},   // 2 ^ -3
+    {0xc000000000000000, 0xbfc0000000000000, 0, 0xc008000000000000},   // -2 ^ -3
+    {0xbfe0000000000000, 0xc020000000000000, 0, 0xc008000000000000},   // -0.5 ^ -3
+    {0x4008000000000000, 0x3fa2f684bda12f68, 0, 0xc008000000000000},   // 3 ^ -3
+    {0xc008000000000000, 0xbfa2f684bda12f68, 0, 0xc008000000000000},   // -3 ^ -3
+    {0xbff028f5c28f5c29, 0xbfef0f1311e568bc, 0, 0xc008000000000000},   // -1.01 ^ -3
+    {0x0000000000004000, 0x7ff0000000000000, 0, 0xc008000000000000},   // 2^-1060 ^ -3
+    {0x8000000000004000, 0xfff0000000000000, 0, 0xc008000000000000},   // -2^-1060 ^ -3
+    {0x7e37e43c8800759c, 0x0000000000000000, 0, 0xc008000000000000},   // 1e300 ^ -3
+    {0xfe37e43c8800759c, 0x8000000000000000, 0, 0xc008000000000000},   // -1e300 ^ -3
+    {0xfff0000000000000, 0x8000000000000000, 0, 0xc008000000000000},   // -inf ^ -3
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0xc008000000000000},   // nan ^ -3
+    /* y = 63 */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x404f800000000000},   // +0 ^ 63
+    {0x8000000000000000, 0x8000000000000000, 0, 0x404f800000000000},   // -0 ^ 63
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x404f800000000000},   // 1 ^ 63
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0x404f800000000000},   // -1 ^ 63
+    {0x4000000000000000, 0x43e0000000000000, 0, 0x404f800000000000},   // 2 ^ 63
+    {0xc000000000000000, 0xc3e0000000000000, 0, 0x404f800000000000},   // -2 ^ 63
+    {0xbfe0000000000000, 0xbc00000000000000, 0, 0x404f800000000000},   // -0.5 ^ 63
+    {0x4008000000000000, 0x462ce48dca5fa621, 0, 0x404f800000000000},   // 3 ^ 63
+    {0xc008000000000000, 0xc62ce48dca5fa621, 0, 0x404f800000000000},   // -3 ^ 63
+    {0xbff028f5c28f5c29, 0xbffdf2aa484d24d6, 0, 0x404f800000000000},   // -1.01 ^ 63
+    {0x0000000000004000, 0x0000000000000000, 0, 0x404f800000000000},   // 2^-1060 ^ 63
+    {0x8000000000004000, 0x8000000000000000, 0, 0x404f800000000000},   // -2^-1060 ^ 63
+    {0x7e37e43c8800759c, 0x7ff0000000000000, 0, 0x404f800000000000},   // 1e300 ^ 63
+    {0xfe37e43c8800759c, 0xfff0000000000000, 0, 0x404f800000000000},   // -1e300 ^ 63
+    {0xfff0000000000000, 0xfff0000000000000, 0, 0x404f800000000000},   // -inf ^ 63
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x404f800000000000},   // nan ^ 63
+    /* y = 65 */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x4050400000000000},   // +0 ^ 65
+    {0x8000000000000000, 0x8000000000000000, 0, 0x4050400000000000},   // -0 ^ 65
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x4050400000000000},   // 1 ^ 65
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0x4050400000000000},   // -1 ^ 65
+    {0x4000000000000000, 0x4400000000000000, 0, 0x4050400000000000},   // 2 ^ 65
+    {0xc000000000000000, 0xc400000000000000, 0, 0x4050400000000000},   // -2 ^ 65
+    {0xbfe0000000000000, 0xbbe0000000000000, 0, 0x4050400000000000},   // -0.5 ^ 65
+    {0x4008000000000000, 0x4660408fc1d5cd73, 0, 0x4050400000000000},   // 3 ^ 65
+    {0xc008000000000000, 0xc660408fc1d5cd73, 0, 0x4050400000000000},   // -3 ^ 65
+    {0xbff028f5c28f5c29, 0xbffe8cc3dfec9864, 0, 0x4050400000000000},   // -1.01 ^ 65
+    {0x0000000000004000, 0x0000000000000000, 0, 0x4050400000000000},   // 2^-1060 ^ 65
+    {0x8000000000004000, 0x8000000000000000, 0, 0x4050400000000000},   // -2^-1060 ^ 65
+    {0x7e37e43c8800759c, 0x7ff0000000000000, 0, 0x4050400000000000},   // 1e300 ^ 65
+    {0xfe37e43c8800759c, 0xfff0000000000000, 0, 0x4050400000000000},   // -1e300 ^ 65
+    {0xfff0000000000000, 0xfff0000000000000, 0, 0x4050400000000000},   // -inf ^ 65
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x4050400000000000},   // nan ^ 65
+    /* y = -65 */
+    {0x0000000000000000, 0x7ff0000000000000, 0, 0xc050400000000000},   // +0 ^ -65
+    {0x8000000000000000, 0xfff0000000000000, 0, 0xc050400000000000},   // -0 ^ -65
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0xc050400000000000},   // 1 ^ -65
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0xc050400000000000},   // -1 ^ -65
+    {0x4000000000000000, 0x3be0000000000000, 0, 0xc050400000000000},   // 2 ^ -65
+    {0xc000000000000000, 0xbbe0000000000000, 0, 0xc050400000000000},   // -2 ^ -65
+    {0xbfe0000000000000, 0xc400000000000000, 0, 0xc050400000000000},   // -0.5 ^ -65
+    {0x4008000000000000, 0x397f80e16cc6921a, 0, 0xc050400000000000},   // 3 ^ -65
+    {0xc008000000000000, 0xb97f80e16cc6921a, 0, 0xc050400000000000},   // -3 ^ -65
+    {0xbff028f5c28f5c29, 0xbfe0c26da48598b6, 0, 0xc050400000000000},   // -1.01 ^ -65
+    {0x0000000000004000, 0x7ff0000000000000, 0, 0xc050400000000000},   // 2^-1060 ^ -65
+    {0x8000000000004000, 0xfff0000000000000, 0, 0xc050400000000000},   // -2^-1060 ^ -65
+    {0x7e37e43c8800759c, 0x0000000000000000, 0, 0xc050400000000000},   // 1e300 ^ -65
+    {0xfe37e43c8800759c, 0x8000000000000000, 0, 0xc050400000000000},   // -1e300 ^ -65
+    {0xfff0000000000000, 0x8000000000000000, 0, 0xc050400000000000},   // -inf ^ -65
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0xc050400000000000},   // nan ^ -65
+    /* y = 0.5 */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x3fe0000000000000},   // +0 ^ 0.5
+    {0x8000000000000000, 0x0000000000000000, 0, 0x3fe0000000000000},   // -0 ^ 0.5
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x3fe0000000000000},   // 1 ^ 0.5
+    {0xbff0000000000000, 0x7ff8000000000000, 0, 0x3fe0000000000000},   // -1 ^ 0.5
+    {0x4000000000000000, 0x3ff6a09e667f3bcd, 0, 0x3fe0000000000000},   // 2 ^ 0.5
+    {0xc000000000000000, 0x7ff8000000000000, 0, 0x3fe0000000000000},   // -2 ^ 0.5
+    {0xbfe0000000000000, 0x7ff8000000000000, 0, 0x3fe0000000000000},   // -0.5 ^ 0.5
+    {0x4008000000000000, 0x3ffbb67ae8584caa, 0, 0x3fe0000000000000},   // 3 ^ 0.5
+    {0xc008000000000000, 0x7ff8000000000000, 0, 0x3fe0000000000000},   // -3 ^ 0.5
+    {0xbff028f5c28f5c29, 0x7ff8000000000000, 0, 0x3fe0000000000000},   // -1.01 ^ 0.5
+    {0x0000000000004000, 0x1ed0000000000000, 0, 0x3fe0000000000000},   // 2^-1060 ^ 0.5
+    {0x8000000000004000, 0x7ff8000000000000, 0, 0x3fe0000000000000},   // -2^-1060 ^ 0.5
+    {0x7e37e43c8800759c, 0x5f138d352e5096af, 0, 0x3fe0000000000000},   // 1e300 ^ 0.5
+    {0xfe37e43c8800759c, 0x7ff8000000000000, 0, 0x3fe0000000000000},   // -1e300 ^ 0.5
+    {0xfff0000000000000, 0x7ff0000000000000, 0, 0x3fe0000000000000},   // -inf ^ 0.5
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x3fe0000000000000},   // nan ^ 0.5
+    /* y = 1e-3 */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x3f50624dd2f1a9fc},   // +0 ^ 1e-3
+    {0x8000000000000000, 0x0000000000000000, 0, 0x3f50624dd2f1a9fc},   // -0 ^ 1e-3
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x3f50624dd2f1a9fc},   // 1 ^ 1e-3
+    {0xbff0000000000000, 0x7ff8000000000000, 0, 0x3f50624dd2f1a9fc},   // -1 ^ 1e-3
+    {0x4000000000000000, 0x3ff002d711c79a96, 0, 0x3f50624dd2f1a9fc},   // 2 ^ 1e-3
+    {0xc000000000000000, 0x7ff8000000000000, 0, 0x3f50624dd2f1a9fc},   // -2 ^ 1e-3
+    {0xbfe0000000000000, 0x7ff8000000000000, 0, 0x3f50624dd2f1a9fc},   // -0.5 ^ 1e-3
+    {0x4008000000000000, 0x3ff004809c8b411d, 0, 0x3f50624dd2f1a9fc},   // 3 ^ 1e-3
+    {0xc008000000000000, 0x7ff8000000000000, 0, 0x3f50624dd2f1a9fc},   // -3 ^ 1e-3
+    {0xbff028f5c28f5c29, 0x7ff8000000000000, 0, 0x3f50624dd2f1a9fc},   // -1.01 ^ 1e-3
+    {0x0000000000004000, 0x3fdeb24aaa974dd7, 0, 0x3f50624dd2f1a9fc},   // 2^-1060 ^ 1e-3
+    {0x8000000000004000, 0x7ff8000000000000, 0, 0x3f50624dd2f1a9fc},   // -2^-1060 ^ 1e-3
+    {0x7e37e43c8800759c, 0x3fffec982d5bb8b0, 0, 0x3f50624dd2f1a9fc},   // 1e300 ^ 1e-3
+    {0xfe37e43c8800759c, 0x7ff8000000000000, 0, 0x3f50624dd2f1a9fc},   // -1e300 ^ 1e-3
+    {0xfff0000000000000, 0x7ff0000000000000, 0, 0x3f50624dd2f1a9fc},   // -inf ^ 1e-3
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x3f50624dd2f1a9fc},   // nan ^ 1e-3
+    /* y = -0.3 */
+    {0x0000000000000000, 0x7ff0000000000000, 0, 0xbfd3333333333333},   // +0 ^ -0.3
+    {0x8000000000000000, 0x7ff0000000000000, 0, 0xbfd3333333333333},   // -0 ^ -0.3
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0xbfd3333333333333},   // 1 ^ -0.3
+    {0xbff0000000000000, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // -1 ^ -0.3
+    {0x4000000000000000, 0x3fe9fdf8bcce533e, 0, 0xbfd3333333333333},   // 2 ^ -0.3
+    {0xc000000000000000, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // -2 ^ -0.3
+    {0xbfe0000000000000, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // -0.5 ^ -0.3
+    {0x4008000000000000, 0x3fe703e0260b76c5, 0, 0xbfd3333333333333},   // 3 ^ -0.3
+    {0xc008000000000000, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // -3 ^ -0.3
+    {0xbff028f5c28f5c29, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // -1.01 ^ -0.3
+    {0x0000000000004000, 0x53cfffffffffffb7, 0, 0xbfd3333333333333},   // 2^-1060 ^ -0.3
+    {0x8000000000004000, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // -2^-1060 ^ -0.3
+    {0x7e37e43c8800759c, 0x2d404bd984990e92, 0, 0xbfd3333333333333},   // 1e300 ^ -0.3
+    {0xfe37e43c8800759c, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // -1e300 ^ -0.3
+    {0xfff0000000000000, 0x0000000000000000, 0, 0xbfd3333333333333},   // -inf ^ -0.3
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0xbfd3333333333333},   // nan ^ -0.3
+    /* y = 1e10 */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x4202a05f20000000},   // +0 ^ 1e10
+    {0x8000000000000000, 0x0000000000000000, 0, 0x4202a05f20000000},   // -0 ^ 1e10
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x4202a05f20000000},   // 1 ^ 1e10
+    {0xbff0000000000000, 0x3ff0000000000000, 0, 0x4202a05f20000000},   // -1 ^ 1e10
+    {0x4000000000000000, 0x7ff0000000000000, 0, 0x4202a05f20000000},   // 2 ^ 1e10
+    {0xc000000000000000, 0x7ff0000000000000, 0, 0x4202a05f20000000},   // -2 ^ 1e10
+    {0xbfe0000000000000, 0x0000000000000000, 0, 0x4202a05f20000000},   // -0.5 ^ 1e10
+    {0x4008000000000000, 0x7ff0000000000000, 0, 0x4202a05f20000000},   // 3 ^ 1e10
+    {0xc008000000000000, 0x7ff0000000000000, 0, 0x4202a05f20000000},   // -3 ^ 1e10
+    {0xbff028f5c28f5c29, 0x7ff0000000000000, 0, 0x4202a05f20000000},   // -1.01 ^ 1e10
+    {0x0000000000004000, 0x0000000000000000, 0, 0x4202a05f20000000},   // 2^-1060 ^ 1e10
+    {0x8000000000004000, 0x0000000000000000, 0, 0x4202a05f20000000},   // -2^-1060 ^ 1e10
+    {0x7e37e43c8800759c, 0x7ff0000000000000, 0, 0x4202a05f20000000},   // 1e300 ^ 1e10
+    {0xfe37e43c8800759c, 0x7ff0000000000000, 0, 0x4202a05f20000000},   // -1e300 ^ 1e10
+    {0xfff0000000000000, 0x7ff0000000000000, 0, 0x4202a05f20000000},   // -inf ^ 1e10
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x4202a05f20000000},   // nan ^ 1e10
+    /* y = 2^53 + 2 */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x4340000000000001},   // +0 ^ 2^53 + 2
+    {0x8000000000000000, 0x0000000000000000, 0, 0x4340000000000001},   // -0 ^ 2^53 + 2
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x4340000000000001},   // 1 ^ 2^53 + 2
+    {0xbff0000000000000, 0x3ff0000000000000, 0, 0x4340000000000001},   // -1 ^ 2^53 + 2
+    {0x4000000000000000, 0x7ff0000000000000, 0, 0x4340000000000001},   // 2 ^ 2^53 + 2
+    {0xc000000000000000, 0x7ff0000000000000, 0, 0x4340000000000001},   // -2 ^ 2^53 + 2
+    {0xbfe0000000000000, 0x0000000000000000, 0, 0x4340000000000001},   // -0.5 ^ 2^53 + 2
+    {0x4008000000000000, 0x7ff0000000000000, 0, 0x4340000000000001},   // 3 ^ 2^53 + 2
+    {0xc008000000000000, 0x7ff0000000000000, 0, 0x4340000000000001},   // -3 ^ 2^53 + 2
+    {0xbff028f5c28f5c29, 0x7ff0000000000000, 0, 0x4340000000000001},   // -1.01 ^ 2^53 + 2
+    {0x0000000000004000, 0x0000000000000000, 0, 0x4340000000000001},   // 2^-1060 ^ 2^53 + 2
+    {0x8000000000004000, 0x0000000000000000, 0, 0x4340000000000001},   // -2^-1060 ^ 2^53 + 2
+    {0x7e37e43c8800759c, 0x7ff0000000000000, 0, 0x4340000000000001},   // 1e300 ^ 2^53 + 2
+    {0xfe37e43c8800759c, 0x7ff0000000000000, 0, 0x4340000000000001},   // -1e300 ^ 2^53 + 2
+    {0xfff0000000000000, 0x7ff0000000000000, 0, 0x4340000000000001},   // -inf ^ 2^53 + 2
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x4340000000000001},   // nan ^ 2^53 + 2
+    /* y = 2^52 + 1 */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x4330000000000001},   // +0 ^ 2^52 + 1
+    {0x8000000000000000, 0x8000000000000000, 0, 0x4330000000000001},   // -0 ^ 2^52 + 1
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x4330000000000001},   // 1 ^ 2^52 + 1
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0x4330000000000001},   // -1 ^ 2^52 + 1
+    {0x4000000000000000, 0x7ff0000000000000, 0, 0x4330000000000001},   // 2 ^ 2^52 + 1
+    {0xc000000000000000, 0xfff0000000000000, 0, 0x4330000000000001},   // -2 ^ 2^52 + 1
+    {0xbfe0000000000000, 0x8000000000000000, 0, 0x4330000000000001},   // -0.5 ^ 2^52 + 1
+    {0x4008000000000000, 0x7ff0000000000000, 0, 0x4330000000000001},   // 3 ^ 2^52 + 1
+    {0xc008000000000000, 0xfff0000000000000, 0, 0x4330000000000001},   // -3 ^ 2^52 + 1
+    {0xbff028f5c28f5c29, 0xfff0000000000000, 0, 0x4330000000000001},   // -1.01 ^ 2^52 + 1
+    {0x0000000000004000, 0x0000000000000000, 0, 0x4330000000000001},   // 2^-1060 ^ 2^52 + 1
+    {0x8000000000004000, 0x8000000000000000, 0, 0x4330000000000001},   // -2^-1060 ^ 2^52 + 1
+    {0x7e37e43c8800759c, 0x7ff0000000000000, 0, 0x4330000000000001},   // 1e300 ^ 2^52 + 1
+    {0xfe37e43c8800759c, 0xfff0000000000000, 0, 0x4330000000000001},   // -1e300 ^ 2^52 + 1
+    {0xfff0000000000000, 0xfff0000000000000, 0, 0x4330000000000001},   // -inf ^ 2^52 + 1
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x4330000000000001},   // nan ^ 2^52 + 1
+    /* y = 1075 */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x4090cc0000000000},   // +0 ^ 1075
+    {0x8000000000000000, 0x8000000000000000, 0, 0x4090cc0000000000},   // -0 ^ 1075
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x4090cc0000000000},   // 1 ^ 1075
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0x4090cc0000000000},   // -1 ^ 1075
+    {0x4000000000000000, 0x7ff0000000000000, 0, 0x4090cc0000000000},   // 2 ^ 1075
+    {0xc000000000000000, 0xfff0000000000000, 0, 0x4090cc0000000000},   // -2 ^ 1075
+    {0xbfe0000000000000, 0x8000000000000000, 0, 0x4090cc0000000000},   // -0.5 ^ 1075
+    {0x4008000000000000, 0x7ff0000000000000, 0, 0x4090cc0000000000},   // 3 ^ 1075
+    {0xc008000000000000, 0xfff0000000000000, 0, 0x4090cc0000000000},   // -3 ^ 1075
+    {0xbff028f5c28f5c29, 0xc0e595b1a8941291, 0, 0x4090cc0000000000},   // -1.01 ^ 1075
+    {0x0000000000004000, 0x0000000000000000, 0, 0x4090cc0000000000},   // 2^-1060 ^ 1075
+    {0x8000000000004000, 0x8000000000000000, 0, 0x4090cc0000000000},   // -2^-1060 ^ 1075
+    {0x7e37e43c8800759c, 0x7ff0000000000000, 0, 0x4090cc0000000000},   // 1e300 ^ 1075
+    {0xfe37e43c8800759c, 0xfff0000000000000, 0, 0x4090cc0000000000},   // -1e300 ^ 1075
+    {0xfff0000000000000, 0xfff0000000000000, 0, 0x4090cc0000000000},   // -inf ^ 1075
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x4090cc0000000000},   // nan ^ 1075
+    /* y = -1075 */
+    {0x0000000000000000, 0x7ff0000000000000, 0, 0xc090cc0000000000},   // +0 ^ -1075
+    {0x8000000000000000, 0xfff0000000000000, 0, 0xc090cc0000000000},   // -0 ^ -1075
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0xc090cc0000000000},   // 1 ^ -1075
+    {0xbff0000000000000, 0xbff0000000000000, 0, 0xc090cc0000000000},   // -1 ^ -1075
+    {0x4000000000000000, 0x0000000000000000, 0, 0xc090cc0000000000},   // 2 ^ -1075
+    {0xc000000000000000, 0x8000000000000000, 0, 0xc090cc0000000000},   // -2 ^ -1075
+    {0xbfe0000000000000, 0xfff0000000000000, 0, 0xc090cc0000000000},   // -0.5 ^ -1075
+    {0x4008000000000000, 0x0000000000000000, 0, 0xc090cc0000000000},   // 3 ^ -1075
+    {0xc008000000000000, 0x8000000000000000, 0, 0xc090cc0000000000},   // -3 ^ -1075
+    {0xbff028f5c28f5c29, 0xbef7b87007f5a66d, 0, 0xc090cc0000000000},   // -1.01 ^ -1075
+    {0x0000000000004000, 0x7ff0000000000000, 0, 0xc090cc0000000000},   // 2^-1060 ^ -1075
+    {0x8000000000004000, 0xfff0000000000000, 0, 0xc090cc0000000000},   // -2^-1060 ^ -1075
+    {0x7e37e43c8800759c, 0x0000000000000000, 0, 0xc090cc0000000000},   // 1e300 ^ -1075
+    {0xfe37e43c8800759c, 0x8000000000000000, 0, 0xc090cc0000000000},   // -1e300 ^ -1075
+    {0xfff0000000000000, 0x8000000000000000, 0, 0xc090cc0000000000},   // -inf ^ -1075
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0xc090cc0000000000},   // nan ^ -1075
+    /* y = inf */
+    {0x0000000000000000, 0x0000000000000000, 0, 0x7ff0000000000000},   // +0 ^ inf
+    {0x8000000000000000, 0x0000000000000000, 0, 0x7ff0000000000000},   // -0 ^ inf
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x7ff0000000000000},   // 1 ^ inf
+    {0xbff0000000000000, 0x3ff0000000000000, 0, 0x7ff0000000000000},   // -1 ^ inf
+    {0x4000000000000000, 0x7ff0000000000000, 0, 0x7ff0000000000000},   // 2 ^ inf
+    {0xc000000000000000, 0x7ff0000000000000, 0, 0x7ff0000000000000},   // -2 ^ inf
+    {0xbfe0000000000000, 0x0000000000000000, 0, 0x7ff0000000000000},   // -0.5 ^ inf
+    {0x4008000000000000, 0x7ff0000000000000, 0, 0x7ff0000000000000},   // 3 ^ inf
+    {0xc008000000000000, 0x7ff0000000000000, 0, 0x7ff0000000000000},   // -3 ^ inf
+    {0xbff028f5c28f5c29, 0x7ff0000000000000, 0, 0x7ff0000000000000},   // -1.01 ^ inf
+    {0x0000000000004000, 0x0000000000000000, 0, 0x7ff0000000000000},   // 2^-1060 ^ inf
+    {0x8000000000004000, 0x0000000000000000, 0, 0x7ff0000000000000},   // -2^-1060 ^ inf
+    {0x7e37e43c8800759c, 0x7ff0000000000000, 0, 0x7ff0000000000000},   // 1e300 ^ inf
+    {0xfe37e43c8800759c, 0x7ff0000000000000, 0, 0x7ff0000000000000},   // -1e300 ^ inf
+    {0xfff0000000000000, 0x7ff0000000000000, 0, 0x7ff0000000000000},   // -inf ^ inf
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x7ff0000000000000},   // nan ^ inf
+    /* y = -inf */
+    {0x0000000000000000, 0x7ff0000000000000, 0, 0xfff0000000000000},   // +0 ^ -inf
+    {0x8000000000000000, 0x7ff0000000000000, 0, 0xfff0000000000000},   // -0 ^ -inf
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0xfff0000000000000},   // 1 ^ -inf
+    {0xbff0000000000000, 0x3ff0000000000000, 0, 0xfff0000000000000},   // -1 ^ -inf
+    {0x4000000000000000, 0x0000000000000000, 0, 0xfff0000000000000},   // 2 ^ -inf
+    {0xc000000000000000, 0x0000000000000000, 0, 0xfff0000000000000},   // -2 ^ -inf
+    {0xbfe0000000000000, 0x7ff0000000000000, 0, 0xfff0000000000000},   // -0.5 ^ -inf
+    {0x4008000000000000, 0x0000000000000000, 0, 0xfff0000000000000},   // 3 ^ -inf
+    {0xc008000000000000, 0x0000000000000000, 0, 0xfff0000000000000},   // -3 ^ -inf
+    {0xbff028f5c28f5c29, 0x0000000000000000, 0, 0xfff0000000000000},   // -1.01 ^ -inf
+    {0x0000000000004000, 0x7ff0000000000000, 0, 0xfff0000000000000},   // 2^-1060 ^ -inf
+    {0x8000000000004000, 0x7ff0000000000000, 0, 0xfff0000000000000},   // -2^-1060 ^ -inf
+    {0x7e37e43c8800759c, 0x0000000000000000, 0, 0xfff0000000000000},   // 1e300 ^ -inf
+    {0xfe37e43c8800759c, 0x0000000000000000, 0, 0xfff0000000000000},   // -1e300 ^ -inf
+    {0xfff0000000000000, 0x0000000000000000, 0, 0xfff0000000000000},   // -inf ^ -inf
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0xfff0000000000000},   // nan ^ -inf
+    /* y = nan */
+    {0x0000000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // +0 ^ nan
+    {0x8000000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -0 ^ nan
+    {0x3ff0000000000000, 0x3ff0000000000000, 0, 0x7ff8000000000000},   // 1 ^ nan
+    {0xbff0000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -1 ^ nan
+    {0x4000000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // 2 ^ nan
+    {0xc000000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -2 ^ nan
+    {0xbfe0000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -0.5 ^ nan
+    {0x4008000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // 3 ^ nan
+    {0xc008000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -3 ^ nan
+    {0xbff028f5c28f5c29, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -1.01 ^ nan
+    {0x0000000000004000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // 2^-1060 ^ nan
+    {0x8000000000004000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -2^-1060 ^ nan
+    {0x7e37e43c8800759c, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // 1e300 ^ nan
+    {0xfe37e43c8800759c, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -1e300 ^ nan
+    {0xfff0000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // -inf ^ nan
+    {0x7ff8000000000000, 0x7ff8000000000000, 0, 0x7ff8000000000000},   // nan ^ nan
+};
+
+/* { x, powf(x, y), 0, y }, results of glibc powf */
+static libm_test_special_data_f32
+test_powxf_vector_special_data[] = {
+    /* y = 0 */
+    {0x00000000, 0x3f800000, 0, 0x00000000},   // +0 ^ 0
+    {0x80000000, 0x3f800000, 0, 0x00000000},   // -0 ^ 0
+    {0x3f800000, 0x3f800000, 0, 0x00000000},   // 1 ^ 0
+    {0xbf800000, 0x3f800000, 0, 0x00000000},   // -1 ^ 0
+    {0x40000000, 0x3f800000, 0, 0x00000000},   // 2 ^ 0
+    {0xc0000000, 0x3f800000, 0, 0x00000000},   // -2 ^ 0
+    {0xbf000000, 0x3f800000, 0, 0x00000000},   // -0.5 ^ 0
+    {0x40400000, 0x3f800000, 0, 0x00000000},   // 3 ^ 0
+    {0xc0400000, 0x3f800000, 0, 0x00000000},   // -3 ^ 0
+    {0xbf8147ae, 0x3f800000, 0, 0x00000000},   // -1.01 ^ 0
+    {0x00000200, 0x3f800000, 0, 0x00000000},   // 2^-140 ^ 0
+    {0x80000200, 0x3f800000, 0, 0x00000000},   // -2^-140 ^ 0
+    {0x7149f2ca, 0x3f800000, 0, 0x00000000},   // 1e30 ^ 0
+    {0xf149f2ca, 0x3f800000, 0, 0x00000000},   // -1e30 ^ 0
+    {0xff800000, 0x3f800000, 0, 0x00000000},   // -inf ^ 0
+    {0x7fc00000, 0x3f800000, 0, 0x00000000},   // nan ^ 0
+    /* y = 1 */
+    {0x00000000, 0x00000000, 0, 0x3f800000},   // +0 ^ 1
+    {0x80000000, 0x80000000, 0, 0x3f800000},   // -0 ^ 1
+    {0x3f800000, 0x3f800000, 0, 0x3f800000},   // 1 ^ 1
+    {0xbf800000, 0xbf800000, 0, 0x3f800000},   // -1 ^ 1
+    {0x40000000, 0x40000000, 0, 0x3f800000},   // 2 ^ 1
+    {0xc0000000, 0xc0000000, 0, 0x3f800000},   // -2 ^ 1
+    {0xbf000000, 0xbf000000, 0, 0x3f800000},   // -0.5 ^ 1
+    {0x40400000, 0x40400000, 0, 0x3f800000},   // 3 ^ 1
+    {0xc0400000, 0xc0400000, 0, 0x3f800000},   // -3 ^ 1
+    {0xbf8147ae, 0xbf8147ae, 0, 0x3f800000},   // -1.01 ^ 1
+    {0x00000200, 0x00000200, 0, 0x3f800000},   // 2^-140 ^ 1
+    {0x80000200, 0x80000200, 0, 0x3f800000},   // -2^-140 ^ 1
+    {0x7149f2ca, 0x7149f2ca, 0, 0x3f800000},   // 1e30 ^ 1
+    {0xf149f2ca, 0xf149f2ca, 0, 0x3f800000},   // -1e30 ^ 1
+    {0xff800000, 0xff800000, 0, 0x3f800000},   // -inf ^ 1
+    {0x7fc00000, 0x7fc00000, 0, 0x3f800000},   // nan ^ 1
+    /* y = 2 */
+    {0x00000000, 0x00000000, 0, 0x40000000},   // +0 ^ 2
+    {0x80000000, 0x00000000, 0, 0x40000000},   // -0 ^ 2
+    {0x3f800000, 0x3f800000, 0, 0x40000000},   // 1 ^ 2
+    {0xbf800000, 0x3f800000, 0, 0x40000000},   // -1 ^ 2
+    {0x40000000, 0x40800000, 0, 0x40000000},   // 2 ^ 2
+    {0xc0000000, 0x40800000, 0, 0x40000000},   // -2 ^ 2
+    {0xbf000000, 0x3e800000, 0, 0x40000000},   // -0.5 ^ 2
+    {0x40400000, 0x41100000, 0, 0x40000000},   // 3 ^ 2
+    {0xc0400000, 0x41100000, 0, 0x40000000},   // -3 ^ 2
+    {0xbf8147ae, 0x3f8292a3, 0, 0x40000000},   // -1.01 ^ 2
+    {0x00000200, 0x00000000, 0, 0x40000000},   // 2^-140 ^ 2
+    {0x80000200, 0x00000000, 0, 0x40000000},   // -2^-140 ^ 2
+    {0x7149f2ca, 0x7f800000, 0, 0x40000000},   // 1e30 ^ 2
+    {0xf149f2ca, 0x7f800000, 0, 0x40000000},   // -1e30 ^ 2
+    {0xff800000, 0x7f800000, 0, 0x40000000},   // -inf ^ 2
+    {0x7fc00000, 0x7fc00000, 0, 0x40000000},   // nan ^ 2
+    /* y = 3 */
+    {0x00000000, 0x00000000, 0, 0x40400000},   // +0 ^ 3
+    {0x80000000, 0x80000000, 0, 0x40400000},   // -0 ^ 3
+    {0x3f800000, 0x3f800000, 0, 0x40400000},   // 1 ^ 3
+    {0xbf800000, 0xbf800000, 0, 0x40400000},   // -1 ^ 3
+    {0x40000000, 0x41000000, 0, 0x40400000},   // 2 ^ 3
+    {0xc0000000, 0xc1000000, 0, 0x40400000},   // -2 ^ 3
+    {0xbf000000, 0xbe000000, 0, 0x40400000},   // -0.5 ^ 3
+    {0x40400000, 0x41d80000, 0, 0x40400000},   // 3 ^ 3
+    {0xc0400000, 0xc1d80000, 0, 0x40400000},   // -3 ^ 3
+    {0xbf8147ae, 0xbf83e0e7, 0, 0x40400000},   // -1.01 ^ 3
+    {0x00000200, 0x00000000, 0, 0x40400000},   // 2^-140 ^ 3
+    {0x80000200, 0x80000000, 0, 0x40400000},   // -2^-140 ^ 3
+    {0x7149f2ca, 0x7f800000, 0, 0x40400000},   // 1e30 ^ 3
+    {0xf149f2ca, 0xff800000, 0, 0x40400000},   // -1e30 ^ 3
+    {0xff800000, 0xff800000, 0, 0x40400000},   // -inf ^ 3
+    {0x7fc00000, 0x7fc00000, 0, 0x40400000},   // nan ^ 3
+    /* y = -1 */
+    {0x00000000, 0x7f800000, 0, 0xbf800000},   // +0 ^ -1
+    {0x80000000, 0xff800000, 0, 0xbf800000},   // -0 ^ -1
+    {0x3f800000, 0x3f800000, 0, 0xbf800000},   // 1 ^ -1
+    {0xbf800000, 0xbf800000, 0, 0xbf800000},   // -1 ^ -1
+    {0x40000000, 0x3f000000, 0, 0xbf800000},   // 2 ^ -1
+    {0xc0000000, 0xbf000000, 0, 0xbf800000},   // -2 ^ -1
+    {0xbf000000, 0xc0000000, 0, 0xbf800000},   // -0.5 ^ -1
+    {0x40400000, 0x3eaaaaab, 0, 0xbf800000},   // 3 ^ -1
+    {0xc0400000, 0xbeaaaaab, 0, 0xbf800000},   // -3 ^ -1
+    {0xbf8147ae, 0xbf7d7721, 0, 0xbf800000},   // -1.01 ^ -1
+    {0x00000200, 0x7f800000, 0, 0xbf800000},   // 2^-140 ^ -1
+    {0x80000200, 0xff800000, 0, 0xbf800000},   // -2^-140 ^ -1
+    {0x7149f2ca, 0x0da24260, 0, 0xbf800000},   // 1e30 ^ -1
+    {0xf149f2ca, 0x8da24260, 0, 0xbf800000},   // -1e30 ^ -1
+    {0xff800000, 0x80000000, 0, 0xbf800000},   // -inf ^ -1
+    {0x7fc00000, 0x7fc00000, 0, 0xbf800000},   // nan ^ -1
+    /* y = -2 */
+    {0x00000000, 0x7f800000, 0, 0xc0000000},   // +0 ^ -2
+    {0x80000000, 0x7f800000, 0, 0xc0000000},   // -0 ^ -2
+    {0x3f800000, 0x3f800000, 0, 0xc0000000},   // 1 ^ -2
+    {0xbf800000, 0x3f800000, 0, 0xc0000000},   // -1 ^ -2
+    {0x40000000, 0x3e800000, 0, 0xc0000000},   // 2 ^ -2
+    {0xc0000000, 0x3e800000, 0, 0xc0000000},   // -2 ^ -2
+    {0xbf000000, 0x40800000, 0, 0xc0000000},   // -0.5 ^ -2
+    {0x40400000, 0x3de38e39, 0, 0xc0000000},   // 3 ^ -2
+    {0xc0400000, 0x3de38e39, 0, 0xc0000000},   // -3 ^ -2
+    {0xbf8147ae, 0x3f7af4af, 0, 0xc0000000},   // -1.01 ^ -2
+    {0x00000200, 0x7f800000, 0, 0xc0000000},   // 2^-140 ^ -2
+    {0x80000200, 0x7f800000, 0, 0xc0000000},   // -2^-140 ^ -2
+    {0x7149f2ca, 0x00000000, 0, 0xc0000000},   // 1e30 ^ -2
+    {0xf149f2ca, 0x00000000, 0, 0xc0000000},   // -1e30 ^ -2
+    {0xff800000, 0x00000000, 0, 0xc0000000},   // -inf ^ -2
+    {0x7fc00000, 0x7fc00000, 0, 0xc0000000},   // nan ^ -2
+    /* y = -3 */
+    {0x00000000, 0x7f800000, 0, 0xc0400000},   // +0 ^ -3
+    {0x80000000, 0xff800000, 0, 0xc0400000},   // -0 ^ -3
+    {0x3f800000, 0x3f800000, 0, 0xc0400000},   // 1 ^ -3
+    {0xbf800000, 0xbf800000, 0, 0xc0400000},   // -1 ^ -3
+    {0x40000000, 0x3e000000, 0, 0xc0400000},   // 2 ^ -3
+    {0xc0000000, 0xbe000000, 0, 0xc0400000},   // -2 ^ -3
+    {0xbf000000, 0xc1000000, 0, 0xc0400000},   // -0.5 ^ -3
+    {0x40400000, 0x3d17b426, 0, 0xc0400000},   // 3 ^ -3
+    {0xc0400000, 0xbd17b426, 0, 0xc0400000},   // -3 ^ -3
+    {0xbf8147ae, 0xbf787899, 0, 0xc0400000},   // -1.01 ^ -3
+    {0x00000200, 0x7f800000, 0, 0xc0400000},   // 2^-140 ^ -3
+    {0x80000200, 0xff800000, 0, 0xc0400000},   // -2^-140 ^ -3
+    {0x7149f2ca, 0x00000000, 0, 0xc0400000},   // 1e30 ^ -3
+    {0xf149f2ca, 0x80000000, 0, 0xc0400000},   // -1e30 ^ -3
+    {0xff800000, 0x80000000, 0, 0xc0400000},   // -inf ^ -3
+    {0x7fc00000, 0x7fc00000, 0, 0xc0400000},   // nan ^ -3
+    /* y = 63 */
+    {0x00000000, 0x00000000, 0, 0x427c0000},   // +0 ^ 63
+    {0x80000000, 0x80000000, 0, 0x427c0000},   // -0 ^ 63
+    {0x3f800000, 0x3f800000, 0, 0x427c0000},   // 1 ^ 63
+    {0xbf800000, 0xbf800000, 0, 0x427c0000},   // -1 ^ 63
+    {0x40000000, 0x5f000000, 0, 0x427c0000},   // 2 ^ 63
+    {0xc0000000, 0xdf000000, 0, 0x427c0000},   // -2 ^ 63
+    {0xbf000000, 0xa0000000, 0, 0x427c0000},   // -0.5 ^ 63
+    {0x40400000, 0x7167246e, 0, 0x427c0000},   // 3 ^ 63
+    {0xc0400000, 0xf167246e, 0, 0x427c0000},   // -3 ^ 63
+    {0xbf8147ae, 0xbfef9549, 0, 0x427c0000},   // -1.01 ^ 63
+    {0x00000200, 0x00000000, 0, 0x427c0000},   // 2^-140 ^ 63
+    {0x80000200, 0x80000000, 0, 0x427c0000},   // -2^-140 ^ 63
+    {0x7149f2ca, 0x7f800000, 0, 0x427c0000},   // 1e30 ^ 63
+    {0xf149f2ca, 0xff800000, 0, 0x427c0000},   // -1e30 ^ 63
+    {0xff800000, 0xff800000, 0, 0x427c0000},   // -inf ^ 63
+    {0x7fc00000, 0x7fc00000, 0, 0x427c0000},   // nan ^ 63
+    /* y = 65 */
+    {0x00000000, 0x00000000, 0, 0x42820000},   // +0 ^ 65
+    {0x80000000, 0x80000000, 0, 0x42820000},   // -0 ^ 65
+    {0x3f800000, 0x3f800000, 0, 0x42820000},   // 1 ^ 65
+    {0xbf800000, 0xbf800000, 0, 0x42820000},   // -1 ^ 65
+    {0x40000000, 0x60000000, 0, 0x42820000},   // 2 ^ 65
+    {0xc0000000, 0xe0000000, 0, 0x42820000},   // -2 ^ 65
+    {0xbf000000, 0x9f000000, 0, 0x42820000},   // -0.5 ^ 65
+    {0x40400000, 0x7302047e, 0, 0x42820000},   // 3 ^ 65
+    {0xc0400000, 0xf302047e, 0, 0x42820000},   // -3 ^ 65
+    {0xbf8147ae, 0xbff46615, 0, 0x42820000},   // -1.01 ^ 65
+    {0x00000200, 0x00000000, 0, 0x42820000},   // 2^-140 ^ 65
+    {0x80000200, 0x80000000, 0, 0x42820000},   // -2^-140 ^ 65
+    {0x7149f2ca, 0x7f800000, 0, 0x42820000},   // 1e30 ^ 65
+    {0xf149f2ca, 0xff800000, 0, 0x42820000},   // -1e30 ^ 65
+    {0xff800000, 0xff800000, 0, 0x42820000},   // -inf ^ 65
+    {0x7fc00000, 0x7fc00000, 0, 0x42820000},   // nan ^ 65
+    /* y = -65 */
+    {0x00000000, 0x7f800000, 0, 0xc2820000},   // +0 ^ -65
+    {0x80000000, 0xff800000, 0, 0xc2820000},   // -0 ^ -65
+    {0x3f800000, 0x3f800000, 0, 0xc2820000},   // 1 ^ -65
+    {0xbf800000, 0xbf800000, 0, 0xc2820000},   // -1 ^ -65
+    {0x40000000, 0x1f000000, 0, 0xc2820000},   // 2 ^ -65
+    {0xc0000000, 0x9f000000, 0, 0xc2820000},   // -2 ^ -65
+    {0xbf000000, 0xe0000000, 0, 0xc2820000},   // -0.5 ^ -65
+    {0x40400000, 0x0bfc070b, 0, 0xc2820000},   // 3 ^ -65
+    {0xc0400000, 0x8bfc070b, 0, 0xc2820000},   // -3 ^ -65
+    {0xbf8147ae, 0xbf061373, 0, 0xc2820000},   // -1.01 ^ -65
+    {0x00000200, 0x7f800000, 0, 0xc2820000},   // 2^-140 ^ -65
+    {0x80000200, 0xff800000, 0, 0xc2820000},   // -2^-140 ^ -65
+    {0x7149f2ca, 0x00000000, 0, 0xc2820000},   // 1e30 ^ -65
+    {0xf149f2ca, 0x80000000, 0, 0xc2820000},   // -1e30 ^ -65
+    {0xff800000, 0x80000000, 0, 0xc2820000},   // -inf ^ -65
+    {0x7fc00000, 0x7fc00000, 0, 0xc2820000},   // nan ^ -65
+    /* y = 0.5 */
+    {0x00000000, 0x00000000, 0, 0x3f000000},   // +0 ^ 0.5
+    {0x80000000, 0x00000000, 0, 0x3f000000},   // -0 ^ 0.5
+    {0x3f800000, 0x3f800000, 0, 0x3f000000},   // 1 ^ 0.5
+    {0xbf800000, 0x7fc00000, 0, 0x3f000000},   // -1 ^ 0.5
+    {0x40000000, 0x3fb504f3, 0, 0x3f000000},   // 2 ^ 0.5
+    {0xc0000000, 0x7fc00000, 0, 0x3f000000},   // -2 ^ 0.5
+    {0xbf000000, 0x7fc00000, 0, 0x3f000000},   // -0.5 ^ 0.5
+    {0x40400000, 0x3fddb3d7, 0, 0x3f000000},   // 3 ^ 0.5
+    {0xc0400000, 0x7fc00000, 0, 0x3f000000},   // -3 ^ 0.5
+    {0xbf8147ae, 0x7fc00000, 0, 0x3f000000},   // -1.01 ^ 0.5
+    {0x00000200, 0x1c800000, 0, 0x3f000000},   // 2^-140 ^ 0.5
+    {0x80000200, 0x7fc00000, 0, 0x3f000000},   // -2^-140 ^ 0.5
+    {0x7149f2ca, 0x58635fa9, 0, 0x3f000000},   // 1e30 ^ 0.5
+    {0xf149f2ca, 0x7fc00000, 0, 0x3f000000},   // -1e30 ^ 0.5
+    {0xff800000, 0x7f800000, 0, 0x3f000000},   // -inf ^ 0.5
+    {0x7fc00000, 0x7fc00000, 0, 0x3f000000},   // nan ^ 0.5
+    /* y = 1e-3 */
+    {0x00000000, 0x00000000, 0, 0x3a83126f},   // +0 ^ 1e-3
+    {0x80000000, 0x00000000, 0, 0x3a83126f},   // -0 ^ 1e-3
+    {0x3f800000, 0x3f800000, 0, 0x3a83126f},   // 1 ^ 1e-3
+    {0xbf800000, 0x7fc00000, 0, 0x3a83126f},   // -1 ^ 1e-3
+    {0x40000000, 0x3f8016b9, 0, 0x3a83126f},   // 2 ^ 1e-3
+    {0xc0000000, 0x7fc00000, 0, 0x3a83126f},   // -2 ^ 1e-3
+    {0xbf000000, 0x7fc00000, 0, 0x3a83126f},   // -0.5 ^ 1e-3
+    {0x40400000, 0x3f802405, 0, 0x3a83126f},   // 3 ^ 1e-3
+    {0xc0400000, 0x7fc00000, 0, 0x3a83126f},   // -3 ^ 1e-3
+    {0xbf8147ae, 0x7fc00000, 0, 0x3a83126f},   // -1.01 ^ 1e-3
+    {0x00000200, 0x3f68532d, 0, 0x3a83126f},   // 2^-140 ^ 1e-3
+    {0x80000200, 0x7fc00000, 0, 0x3a83126f},   // -2^-140 ^ 1e-3
+    {0x7149f2ca, 0x3f89278b, 0, 0x3a83126f},   // 1e30 ^ 1e-3
+    {0xf149f2ca, 0x7fc00000, 0, 0x3a83126f},   // -1e30 ^ 1e-3
+    {0xff800000, 0x7f800000, 0, 0x3a83126f},   // -inf ^ 1e-3
+    {0x7fc00000, 0x7fc00000, 0, 0x3a83126f},   // nan ^ 1e-3
+    /* y = -0.3 */
+    {0x00000000, 0x7f800000, 0, 0xbe99999a},   // +0 ^ -0.3
+    {0x80000000, 0x7f800000, 0, 0xbe99999a},   // -0 ^ -0.3
+    {0x3f800000, 0x3f800000, 0, 0xbe99999a},   // 1 ^ -0.3
+    {0xbf800000, 0x7fc00000, 0, 0xbe99999a},   // -1 ^ -0.3
+    {0x40000000, 0x3f4fefc6, 0, 0xbe99999a},   // 2 ^ -0.3
+    {0xc0000000, 0x7fc00000, 0, 0xbe99999a},   // -2 ^ -0.3
+    {0xbf000000, 0x7fc00000, 0, 0xbe99999a},   // -0.5 ^ -0.3
+    {0x40400000, 0x3f381f01, 0, 0xbe99999a},   // 3 ^ -0.3
+    {0xc0400000, 0x7fc00000, 0, 0xbe99999a},   // -3 ^ -0.3
+    {0xbf8147ae, 0x7fc00000, 0, 0xbe99999a},   // -1.01 ^ -0.3
+    {0x00000200, 0x5480000a, 0, 0xbe99999a},   // 2^-140 ^ -0.3
+    {0x80000200, 0x7fc00000, 0, 0xbe99999a},   // -2^-140 ^ -0.3
+    {0x7149f2ca, 0x30897058, 0, 0xbe99999a},   // 1e30 ^ -0.3
+    {0xf149f2ca, 0x7fc00000, 0, 0xbe99999a},   // -1e30 ^ -0.3
+    {0xff800000, 0x00000000, 0, 0xbe99999a},   // -inf ^ -0.3
+    {0x7fc00000, 0x7fc00000, 0, 0xbe99999a},   // nan ^ -0.3
+    /* y = 1e10 */
+    {0x00000000, 0x00000000, 0, 0x501502f9},   // +0 ^ 1e10
+    {0x80000000, 0x00000000, 0, 0x501502f9},   // -0 ^ 1e10
+    {0x3f800000, 0x3f800000, 0, 0x501502f9},   // 1 ^ 1e10
+    {0xbf800000, 0x3f800000, 0, 0x501502f9},   // -1 ^ 1e10
+    {0x40000000, 0x7f800000, 0, 0x501502f9},   // 2 ^ 1e10
+    {0xc0000000, 0x7f800000, 0, 0x501502f9},   // -2 ^ 1e10
+    {0xbf000000, 0x00000000, 0, 0x501502f9},   // -0.5 ^ 1e10
+    {0x40400000, 0x7f800000, 0, 0x501502f9},   // 3 ^ 1e10
+    {0xc0400000, 0x7f800000, 0, 0x501502f9},   // -3 ^ 1e10
+    {0xbf8147ae, 0x7f800000, 0, 0x501502f9},   // -1.01 ^ 1e10
+    {0x00000200, 0x00000000, 0, 0x501502f9},   // 2^-140 ^ 1e10
+    {0x80000200, 0x00000000, 0, 0x501502f9},   // -2^-140 ^ 1e10
+    {0x7149f2ca, 0x7f800000, 0, 0x501502f9},   // 1e30 ^ 1e10
+    {0xf149f2ca, 0x7f800000, 0, 0x501502f9},   // -1e30 ^ 1e10
+    {0xff800000, 0x7f800000, 0, 0x501502f9},   // -inf ^ 1e10
+    {0x7fc00000, 0x7fc00000, 0, 0x501502f9},   // nan ^ 1e10
+    /* y = 2^23 + 1 */
+    {0x00000000, 0x00000000, 0, 0x4b000001},   // +0 ^ 2^23 + 1
+    {0x80000000, 0x80000000, 0, 0x4b000001},   // -0 ^ 2^23 + 1
+    {0x3f800000, 0x3f800000, 0, 0x4b000001},   // 1 ^ 2^23 + 1
+    {0xbf800000, 0xbf800000, 0, 0x4b000001},   // -1 ^ 2^23 + 1
+    {0x40000000, 0x7f800000, 0, 0x4b000001},   // 2 ^ 2^23 + 1
+    {0xc0000000, 0xff800000, 0, 0x4b000001},   // -2 ^ 2^23 + 1
+    {0xbf000000, 0x80000000, 0, 0x4b000001},   // -0.5 ^ 2^23 + 1
+    {0x40400000, 0x7f800000, 0, 0x4b000001},   // 3 ^ 2^23 + 1
+    {0xc0400000, 0xff800000, 0, 0x4b000001},   // -3 ^ 2^23 + 1
+    {0xbf8147ae, 0xff800000, 0, 0x4b000001},   // -1.01 ^ 2^23 + 1
+    {0x00000200, 0x00000000, 0, 0x4b000001},   // 2^-140 ^ 2^23 + 1
+    {0x80000200, 0x80000000, 0, 0x4b000001},   // -2^-140 ^ 2^23 + 1
+    {0x7149f2ca, 0x7f800000, 0, 0x4b000001},   // 1e30 ^ 2^23 + 1
+    {0xf149f2ca, 0xff800000, 0, 0x4b000001},   // -1e30 ^ 2^23 + 1
+    {0xff800000, 0xff800000, 0, 0x4b000001},   // -inf ^ 2^23 + 1
+    {0x7fc00000, 0x7fc00000, 0, 0x4b000001},   // nan ^ 2^23 + 1
+    /* y = 129 */
+    {0x00000000, 0x00000000, 0, 0x43010000},   // +0 ^ 129
+    {0x80000000, 0x80000000, 0, 0x43010000},   // -0 ^ 129
+    {0x3f800000, 0x3f800000, 0, 0x43010000},   // 1 ^ 129
+    {0xbf800000, 0xbf800000, 0, 0x43010000},   // -1 ^ 129
+    {0x40000000, 0x7f800000, 0, 0x43010000},   // 2 ^ 129
+    {0xc0000000, 0xff800000, 0, 0x43010000},   // -2 ^ 129
+    {0xbf000000, 0x80100000, 0, 0x43010000},   // -0.5 ^ 129
+    {0x40400000, 0x7f800000, 0, 0x43010000},   // 3 ^ 129
+    {0xc0400000, 0xff800000, 0, 0x43010000},   // -3 ^ 129
+    {0xbf8147ae, 0xc067035c, 0, 0x43010000},   // -1.01 ^ 129
+    {0x00000200, 0x00000000, 0, 0x43010000},   // 2^-140 ^ 129
+    {0x80000200, 0x80000000, 0, 0x43010000},   // -2^-140 ^ 129
+    {0x7149f2ca, 0x7f800000, 0, 0x43010000},   // 1e30 ^ 129
+    {0xf149f2ca, 0xff800000, 0, 0x43010000},   // -1e30 ^ 129
+    {0xff800000, 0xff800000, 0, 0x43010000},   // -inf ^ 129
+    {0x7fc00000, 0x7fc00000, 0, 0x43010000},   // nan ^ 129
+    /* y = -151 */
+    {0x00000000, 0x7f800000, 0, 0xc3170000},   // +0 ^ -151
+    {0x80000000, 0xff800000, 0, 0xc3170000},   // -0 ^ -151
+    {0x3f800000, 0x3f800000, 0, 0xc3170000},   // 1 ^ -151
+    {0xbf800000, 0xbf800000, 0, 0xc3170000},   // -1 ^ -151
+    {0x40000000, 0x00000000, 0, 0xc3170000},   // 2 ^ -151
+    {0xc0000000, 0x80000000, 0, 0xc3170000},   // -2 ^ -151
+    {0xbf000000, 0xff800000, 0, 0xc3170000},   // -0.5 ^ -151
+    {0x40400000, 0x00000000, 0, 0xc3170000},   // 3 ^ -151
+    {0xc0400000, 0x80000000, 0, 0xc3170000},   // -3 ^ -151
+    {0xbf8147ae, 0xbe63ea45, 0, 0xc3170000},   // -1.01 ^ -151
+    {0x00000200, 0x7f800000, 0, 0xc3170000},   // 2^-140 ^ -151
+    {0x80000200, 0xff800000, 0, 0xc3170000},   // -2^-140 ^ -151
+    {0x7149f2ca, 0x00000000, 0, 0xc3170000},   // 1e30 ^ -151
+    {0xf149f2ca, 0x80000000, 0, 0xc3170000},   // -1e30 ^ -151
+    {0xff800000, 0x80000000, 0, 0xc3170000},   // -inf ^ -151
+    {0x7fc00000, 0x7fc00000, 0, 0xc3170000},   // nan ^ -151
+    /* y = inf */
+    {0x00000000, 0x00000000, 0, 0x7f800000},   // +0 ^ inf
+    {0x80000000, 0x00000000, 0, 0x7f800000},   // -0 ^ inf
+    {0x3f800000, 0x3f800000, 0, 0x7f800000},   // 1 ^ inf
+    {0xbf800000, 0x3f800000, 0, 0x7f800000},   // -1 ^ inf
+    {0x40000000, 0x7f800000, 0, 0x7f800000},   // 2 ^ inf
+    {0xc0000000, 0x7f800000, 0, 0x7f800000},   // -2 ^ inf
+    {0xbf000000, 0x00000000, 0, 0x7f800000},   // -0.5 ^ inf
+    {0x40400000, 0x7f800000, 0, 0x7f800000},   // 3 ^ inf
+    {0xc0400000, 0x7f800000, 0, 0x7f800000},   // -3 ^ inf
+    {0xbf8147ae, 0x7f800000, 0, 0x7f800000},   // -1.01 ^ inf
+    {0x00000200, 0x00000000, 0, 0x7f800000},   // 2^-140 ^ inf
+    {0x80000200, 0x00000000, 0, 0x7f800000},   // -2^-140 ^ inf
+    {0x7149f2ca, 0x7f800000, 0, 0x7f800000},   // 1e30 ^ inf
+    {0xf149f2ca, 0x7f800000, 0, 0x7f800000},   // -1e30 ^ inf
+    {0xff800000, 0x7f800000, 0, 0x7f800000},   // -inf ^ inf
+    {0x7fc00000, 0x7fc00000, 0, 0x7f800000},   // nan ^ inf
+    /* y = -inf */
+    {0x00000000, 0x7f800000, 0, 0xff800000},   // +0 ^ -inf
+    {0x80000000, 0x7f800000, 0, 0xff800000},   // -0 ^ -inf
+    {0x3f800000, 0x3f800000, 0, 0xff800000},   // 1 ^ -inf
+    {0xbf800000, 0x3f800000, 0, 0xff800000},   // -1 ^ -inf
+    {0x40000000, 0x00000000, 0, 0xff800000},   // 2 ^ -inf
+    {0xc0000000, 0x00000000, 0, 0xff800000},   // -2 ^ -inf
+    {0xbf000000, 0x7f800000, 0, 0xff800000},   // -0.5 ^ -inf
+    {0x40400000, 0x00000000, 0, 0xff800000},   // 3 ^ -inf
+    {0xc0400000, 0x00000000, 0, 0xff800000},   // -3 ^ -inf
+    {0xbf8147ae, 0x00000000, 0, 0xff800000},   // -1.01 ^ -inf
+    {0x00000200, 0x7f800000, 0, 0xff800000},   // 2^-140 ^ -inf
+    {0x80000200, 0x7f800000, 0, 0xff800000},   // -2^-140 ^ -inf
+    {0x7149f2ca, 0x00000000, 0, 0xff800000},   // 1e30 ^ -inf
+    {0xf149f2ca, 0x00000000, 0, 0xff800000},   // -1e30 ^ -inf
+    {0xff800000, 0x00000000, 0, 0xff800000},   // -inf ^ -inf
+    {0x7fc00000, 0x7fc00000, 0, 0xff800000},   // nan ^ -inf
+    /* y = nan */
+    {0x00000000, 0x7fc00000, 0, 0x7fc00000},   // +0 ^ nan
+    {0x80000000, 0x7fc00000, 0, 0x7fc00000},   // -0 ^ nan
+    {0x3f800000, 0x3f800000, 0, 0x7fc00000},   // 1 ^ nan
+    {0xbf800000, 0x7fc00000, 0, 0x7fc00000},   // -1 ^ nan
+    {0x40000000, 0x7fc00000, 0, 0x7fc00000},   // 2 ^ nan
+    {0xc0000000, 0x7fc00000, 0, 0x7fc00000},   // -2 ^ nan
+    {0xbf000000, 0x7fc00000, 0, 0x7fc00000},   // -0.5 ^ nan
+    {0x40400000, 0x7fc00000, 0, 0x7fc00000},   // 3 ^ nan
+    {0xc0400000, 0x7fc00000, 0, 0x7fc00000},   // -3 ^ nan
+    {0xbf8147ae, 0x7fc00000, 0, 0x7fc00000},   // -1.01 ^ nan
+    {0x00000200, 0x7fc00000, 0, 0x7fc00000},   // 2^-140 ^ nan
+    {0x80000200, 0x7fc00000, 0, 0x7fc00000},   // -2^-140 ^ nan
+    {0x7149f2ca, 0x7fc00000, 0, 0x7fc00000},   // 1e30 ^ nan
+    {0xf149f2ca, 0x7fc00000, 0, 0x7fc00000},   // -1e30 ^ nan
+    {0xff800000, 0x7fc00000, 0, 0x7fc00000},   // -inf ^ nan
+    {0x7fc00000, 0x7fc00000, 0, 0x7fc00000},   // nan ^ nan
+};
+
+/* the vector kernels are within 2 ulp */
+static const uint64_t powx_maxulp = 2;
+
+TEST(POWX, CONFORMANCE_DOUBLE_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_powx_vector_special_data);
+  for (size_t i = 0; i < n; i += POWX_GROUP) {
+    const libm_test_special_data_f64 *g = &test_powx_vector_special_data[i];
+    ConfCheckVec<double>("vrd2_powx", g, POWX_GROUP, 2, 2, test_v2d, powx_maxulp);
+    ConfCheckVec<double>("vrd4_powx", g, POWX_GROUP, 2, 4, test_v4d, powx_maxulp);
+#if defined(__AVX512__)
+    ConfCheckVec<double>("vrd8_powx", g, POWX_GROUP, 2, 8, test_v8d, powx_maxulp);
+#endif
+    ConfCheckVec<double>("vrda_powx", g, POWX_GROUP, 2, 0, test_vad, powx_maxulp);
+  }
+}
+
+TEST(POWX, CONFORMANCE_FLOAT_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_powxf_vector_special_data);
+  for (size_t i = 0; i < n; i += POWX_GROUP) {
+    const libm_test_special_data_f32 *g = &test_powxf_vector_special_data[i];
+    ConfCheckVec<float>("vrs4_powxf", g, POWX_GROUP, 2, 4, test_v4s, powx_maxulp);
+    ConfCheckVec<float>("vrs8_powxf", g, POWX_GROUP, 2, 8, test_v8s, powx_maxulp);
+#if defined(__AVX512__)
+    ConfCheckVec<float>("vrs16_powxf", g, POWX_GROUP, 2, 16, test_v16s, powx_maxulp);
+#endif
+    ConfCheckVec<float>("vrsa_powxf", g, POWX_GROUP, 2, 0, test_vas, powx_maxulp);
+  }
+}
+
+/*
+ * pown(x, n) and rootn(x, n) = x^(1/n), which have no callbacks of their
+ * own. The special cases are checked bit for bit, random inputs against
+ * pow(x, n) and a long double rootn refined by one Newton step.
+ */
+
+extern "C" {
+  __m256d amd_vrd4_pown(__m256d x, int n);
+  void amd_vrda_pown(int len, double *src, int n, double *dst);
+  void amd_vrda_rootn(int len, double *src, int n, double *dst);
+}
+
+typedef struct {
+  double x;
+  int n;
+  double r;
+} pown_data;
+
+static const pown_data test_pown_special_data[] = {
+  /* n = 0 gives 1 for any x */
+  {0.0, 0, 1.0}, {-0.0, 0, 1.0}, {-2.0, 0, 1.0},
+  {INFINITY, 0, 1.0}, {-INFINITY, 0, 1.0}, {NAN, 0, 1.0},
+  {-2.0, 3, -8.0}, {-2.0, 4, 16.0}, {-2.0, -3, -0.125}, {-2.0, -4, 0.0625},
+  {-1.0, INT_MAX, -1.0}, {-1.0, INT_MIN, 1.0}, {-1.5, 1, -1.5}, {-4.0, -1, -0.25},
+  {0.0, 3, 0.0}, {-0.0, 3, -0.0}, {-0.0, 2, 0.0},
+  {0.0, -2, INFINITY}, {-0.0, -3, -INFINITY}, {-0.0, -2, INFINITY},
+  {-INFINITY, 3, -INFINITY}, {-INFINITY, 2, INFINITY},
+  {-INFINITY, -3, -0.0}, {-INFINITY, -2, 0.0}, {NAN, 3, NAN},
+  /* overflow and underflow */
+  {2.0, 1023, 0x1p1023}, {-2.0, 1023, -0x1p1023}, {2.0, 1024, INFINITY},
+  {10.0, 309, INFINITY}, {-10.0, 309, -INFINITY}, {-10.0, 310, INFINITY},
+  {2.0, -1074, 0x1p-1074}, {-2.0, -1073, -0x1p-1073}, {-2.0, -1075, -0.0},
+  {10.0, -400, 0.0}, {-10.0, -401, -0.0}, {0x1p-1074, 2, 0.0},
+  {-0x1p-1074, -1, -INFINITY},
+};
+
+static const pown_data test_rootn_special_data[] = {
+  /* n = 0 gives nan for any x */
+  {2.0, 0, NAN}, {0.0, 0, NAN}, {-1.0, 0, NAN}, {INFINITY, 0, NAN}, {NAN, 0, NAN},
+  /* odd roots keep the sign of x, even roots of x < 0 are nan */
+  {27.0, 3, 3.0}, {-27.0, 3, -3.0}, {-8.0, -3, -0.5}, {-32.0, 5, -2.0},
+  {16.0, 4, 2.0}, {16.0, -4, 0.5}, {-16.0, 4, NAN}, {-16.0, -2, NAN},
+  {-1.5, 1, -1.5}, {-4.0, -1, -0.25}, {-1.0, 2, NAN}, {-0x1p-1074, 2, NAN},
+  {0.0, 3, 0.0}, {-0.0, 3, -0.0}, {-0.0, 2, 0.0},
+  {0.0, -3, INFINITY}, {-0.0, -3, -INFINITY}, {-0.0, -2, INFINITY},
+  {INFINITY, 3, INFINITY}, {-INFINITY, 3, -INFINITY}, {-INFINITY, 2, NAN},
+  {INFINITY, -2, 0.0}, {-INFINITY, -3, -0.0}, {NAN, 3, NAN}, {NAN, -2, NAN},
+  /* the ends of the range */
+  {0x1p-1074, 2, 0x1p-537}, {-0x1p-1074, 3, -0x1p-358}, {-0x1p-1074, -3, -0x1p358},
+  {0x1p1022, 2, 0x1p511}, {-0x1p1020, -1, -0x1p-1020}, {0x1p-1074, -1, INFINITY},
+};
+
+typedef void (*pown_fn)(int, double *, int, double *);
+
+static void pown_v4(int len, double *src, int n, double *dst) {
+  for (int i = 0; i < len; i += 4) {
+    alignas(32) double x[4] = {src[i], 0.0, 0.0, 0.0}, r[4];
+    memcpy(x, &src[i], std::min(4, len - i) * sizeof(double));
+    _mm256_store_pd(r, amd_vrd4_pown(_mm256_load_pd(x), n));
+    memcpy(&dst[i], r, std::min(4, len - i) * sizeof(double));
+  }
+}
+
+/*
+ * Every case goes through fn at each position of an array of 11, which
+ * covers the full vectors and the masked tail of the array variants.
+ */
+static void PownCheckSpecial(const char *name, pown_fn fn,
+                             const pown_data *tbl, size_t count) {
+  const int len = 11;
+  double x[len], r[len];
+
+  for (size_t i = 0; i < count; i++) {
+    for (int k = 0; k < len; k++) {
+      std::fill(x, x + len, 1.5);
+      x[k] = tbl[i].x;
+      fn(len, x, tbl[i].n, r);
+      if (ConfLaneMatch<double>(tbl[i].r, r[k], 0))
+        continue;
+      ADD_FAILURE() << name << "(" << tbl[i].x << ", " << tbl[i].n
+                    << ") at " << k << " expected " << tbl[i].r
+                    << " actual " << r[k];
+      break;
+    }
+  }
+}
+
+static long double RootnRef(double x, int n) {
+  long double a = fabsl((long double)x);
+  long double r = powl(a, 1.0L / n);
+  r = r - r * (powl(r, n) / a - 1.0L) / n;
+  return x < 0.0 ? -r : r;
+}
+
+/*
+ * Random x over the exponent range that keeps x^n finite, and the whole
+ * range for rootn, negative only for odd n of rootn.
+ */
+static void PownCheckRandom(const char *name, pown_fn fn, bool root) {
+  const int len = 1000;
+  std::vector<double> x(len), r(len);
+  uint64_t s = 0x9e3779b97f4a7c15ULL;
+  int nfail = 0;
+
+  for (int n = -67; n <= 67; n++) {
+    if (n == 0)
+      continue;
+    for (int i = 0; i < len; i++) {
+      s = s * 6364136223846793005ULL + 1442695040888963407ULL;
+      double m = 1.0 + (double)(s >> 11) * 0x1p-53;
+      int e = root ? (int)(s % 2040) - 1020 : (int)(s % (2000 / abs(n) + 1)) - 1000 / abs(n);
+      x[i] = ldexp(((s & 1) && (!root || (n & 1))) ? -m : m, e);
+    }
+    fn(len, x.data(), n, r.data());
+    for (int i = 0; i < len; i++) {
+      double e = root ? (double)RootnRef(x[i], n) : pow(x[i], (double)n);
+      if (ConfLaneMatch<double>(e, r[i], 1))
+        continue;
+      if (nfail++ < 10)
+        ADD_FAILURE() << name << "(" << std::hexfloat << x[i] << ", " << std::dec << n
+                      << ") expected " << std::hexfloat << e << " actual " << r[i];
+    }
+  }
+  EXPECT_EQ(nfail, 0) << name;
+}
+
+TEST(POWN, CONFORMANCE_DOUBLE_VECTORS) {
+  const size_t n = ARRAY_SIZE(test_pown_special_data);
+  PownCheckSpecial("vrd4_pown", pown_v4, test_pown_special_data, n);
+  PownCheckSpecial("vrda_pown", amd_vrda_pown, test_pown_special_data, n);
+  PownCheckRandom("vrd4_pown", pown_v4, false);
+  PownCheckRandom("vrda_pown", amd_vrda_pown, false);
+}
+
+TEST(ROOTN, CONFORMANCE_DOUBLE_VECTORS) {
+  PownCheckSpecial("vrda_rootn", amd_vrda_rootn, test_rootn_special_data,
+                   ARRAY_SIZE(test_rootn_special_data));
+  PownCheckRandom("vrda_rootn", amd_vrda_rootn, true);
+}
@@ -29,6 +29,7 @@
 #include <cstdint>
 #include <stdlib.h>
 #include <cmath>
+#include <limits>
 
 #include "cmdline.h"
 #include "defs.h"
@@ -163,6 +164,33 @@ int Random<T>::fillLinear(T *data, uint32_t nelem, T min, T max) {
   return 0;
 }
 
+/*
+ * Random values in [min, max] with every 16th element replaced by one of
+ * NaN, +/-inf, +/-0, a denormal or +/-max, to exercise the special-case
+ * paths of the vector routines
+ */
+template <typename T>
+int Random<T>::fillSpecial(T *data, uint32_t nelem, T min, T max) {
+  const T specials[] = {
+    std::numeric_limits<T>::quiet_NaN(),
+    std::numeric_limits<T>::infinity(),
+    -std::numeric_limits<T>::infinity(),
+    (T)0.0,
+    (T)-0.0,
+    std::numeric_limits<T>::denorm_min(),
+    std::numeric_limits<T>::max(),
+    -std::numeric_limits<T>::max(),
+  };
+  const uint32_t nspecials = sizeof(specials) / sizeof(specials[0]);
+
+  fillRandom(data, nelem, min, max);
+
+  for (uint32_t i = 0; i < nelem; i += 16)
+    data[i] = specials[(i / 16) % nspecials];
+
+  return 0;
+}
+
 template <typename T>
 int Random<T>::Fill(T *data, uint32_t nelem, T min, T max, ALM::RangeType r) {
   int ret = 0;
@@ -174,6 +202,9 @@ int Random<T>::Fill(T *data, uint32_t nelem, T min, T max, ALM::RangeType r) {
     case ALM::RangeType::E_Random:
       ret = fillRandom(data, nelem, min, max);
       break;
+    case ALM::RangeType::E_Special:
+      ret = fillSpecial(data, nelem, min, max);
+      break;
     case ALM::RangeType::E_Simple:
     default:
       ret = fillSimple(data, nelem, min, max);
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <cmath>
+#include <vector>
+#include "libm_tests.h"
+#include <libm_macros.h>
+
+#define AMD_LIBM_VEC_EXPERIMENTAL
+
+#include <libm_amd.h>
+#include <libm/amd_funcs_internal.h>
+#include <fmaintrin.h>
+#include <immintrin.h>
+#include "callback.h"
+#include "test_scalbn_data.h"
+#include "../libs/mparith/alm_mp_funcs.h"
+
+static uint32_t ipargs = 2;
+bool special_case = false;
+
+uint32_t GetnIpArgs( void )
+{
+	return ipargs;
+}
+
+bool getSpecialCase(void)
+{
+  return special_case;
+}
+
+void ConfSetupf32(SpecParams *specp) {
+  specp->data32 = test_scalbnf_conformance_data;
+  specp->countf = ARRAY_SIZE(test_scalbnf_conformance_data);
+}
+
+void ConfSetupf64(SpecParams *specp) {
+  specp->data64 = test_scalbn_conformance_data;
+  specp->countd = ARRAY_SIZE(test_scalbn_conformance_data);
+}
+
+float getFuncOp(float *data) {
+  return LIBM_FUNC(scalbnf)(data[0], int(data[1]));
+}
+
+double getFuncOp(double *data) {
+  return LIBM_FUNC(scalbn)(data[0], int(data[1]));
+}
+
+/* scalbn is ldexp for a radix 2 format */
+double getExpected(float *data) {
+  auto val = alm_mp_ldexpf(data[0], int(data[1]));
+  return val;
+}
+
+long double getExpected(double *data) {
+  int in_data = int(data[1]);
+  auto val = alm_mp_ldexp(data[0], in_data);
+  return val;
+}
+
+// Used by the Complex Number Functions only!
+double _Complex getExpected(float _Complex *data) {
+  return {0};
+}
+
+long double _Complex getExpected(double _Complex *data) {
+  return {0};
+}
+
+/**********************
+*FUNCTIONS*
+**********************/
+int test_s1s(test_data *data, int idx)  {
+  float *ip1  = (float*)data->ip;
+  float *ip2 = (float*)data->ip1;
+  float *op  = (float*)data->op;
+  op[0] = LIBM_FUNC(scalbnf)(ip1[idx], int(ip2[idx]));
+  return 0;
+}
+
+int test_s1d(test_data *data, int idx)  {
+  double *ip1  = (double*)data->ip;
+  double *ip2 = (double*)data->ip1;
+  double *op  = (double*)data->op;
+  op[0] = LIBM_FUNC(scalbn)(ip1[idx], int(ip2[idx]));
+  return 0;
+}
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__AVX512__)
+  __m512d amd_vrd8_scalbn(__m512d, __m512i);
+  __m512 amd_vrs16_scalbnf(__m512, __m512i);
+#endif
+
+// FIXME: No V2D version available for scalbn
+int test_v2d(test_data *data, int idx)  {
+  return 0;
+}
+
+// FIXME: No V4S version available for scalbn
+int test_v4s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4d(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  double *ip1 = (double*)data->ip;
+  double *ip2 = (double*)data->ip1;
+  double *op  = (double*)data->op;
+  __m256d ip4 = _mm256_set_pd(ip1[idx+3], ip1[idx+2], ip1[idx+1], ip1[idx]);
+  __m256i n4  = _mm256_set_epi64x((long long)ip2[idx+3], (long long)ip2[idx+2],
+                                  (long long)ip2[idx+1], (long long)ip2[idx]);
+  __m256d op4 = amd_vrd4_scalbn(ip4, n4);
+  _mm256_store_pd(&op[0], op4);
+#endif
+  return 0;
+}
+
+int test_v8s(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  float *ip1 = (float*)data->ip;
+  float *ip2 = (float*)data->ip1;
+  float *op  = (float*)data->op;
+  __m256 ip8 = _mm256_set_ps(ip1[idx+7], ip1[idx+6], ip1[idx+5], ip1[idx+4],
+                             ip1[idx+3], ip1[idx+2], ip1[idx+1], ip1[idx]);
+  __m256i n8 = _mm256_cvttps_epi32(_mm256_set_ps(ip2[idx+7], ip2[idx+6], ip2[idx+5], ip2[idx+4],
+                                                 ip2[idx+3], ip2[idx+2], ip2[idx+1], ip2[idx]));
+  __m256 op8 = amd_vrs8_scalbnf(ip8, n8);
+  _mm256_store_ps(&op[0], op8);
+#endif
+  return 0;
+}
+
+int test_v8d(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  #if defined(__AVX512__)
+    double *ip1 = (double*)data->ip;
+    double *ip2 = (double*)data->ip1;
+    double *op  = (double*)data->op;
+    __m512d ip8 = _mm512_set_pd(ip1[idx+7], ip1[idx+6], ip1[idx+5], ip1[idx+4],
+                                ip1[idx+3], ip1[idx+2], ip1[idx+1], ip1[idx]);
+    __m512i n8  = _mm512_cvttpd_epi64(_mm512_set_pd(ip2[idx+7], ip2[idx+6], ip2[idx+5], ip2[idx+4],
+                                                    ip2[idx+3], ip2[idx+2], ip2[idx+1], ip2[idx]));
+    __m512d op8 = amd_vrd8_scalbn(ip8, n8);
+    _mm512_store_pd(&op[0], op8);
+  #endif
+#endif
+  return 0;
+}
+
+int test_v16s(test_data *data, int idx)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  #if defined(__AVX512__)
+    float *ip1 = (float*)data->ip;
+    float *ip2 = (float*)data->ip1;
+    float *op  = (float*)data->op;
+    __m512 ip16 = _mm512_loadu_ps(&ip1[idx]);
+    __m512i n16 = _mm512_cvttps_epi32(_mm512_loadu_ps(&ip2[idx]));
+    __m512 op16 = amd_vrs16_scalbnf(ip16, n16);
+    _mm512_store_ps(&op[0], op16);
+  #endif
+#endif
+  return 0;
+}
+
+int test_vad(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  double *ip1 = (double*)data->ip;
+  double *ip2 = (double*)data->ip1;
+  double *op  = (double*)data->op;
+  std::vector<int> n(count);
+  for (int i = 0; i < count; i++)
+    n[i] = int(ip2[i]);
+  amd_vrda_scalbn(count, ip1, n.data(), op);
+#endif
+  return 0;
+}
+
+int test_vas(test_data *data, int count)  {
+#if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+  float *ip1 = (float*)data->ip;
+  float *ip2 = (float*)data->ip1;
+  float *op  = (float*)data->op;
+  std::vector<int> n(count);
+  for (int i = 0; i < count; i++)
+    n[i] = int(ip2[i]);
+  amd_vrsa_scalbnf(count, ip1, n.data(), op);
+#endif
+  return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
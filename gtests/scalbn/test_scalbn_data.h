@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __TEST_SCALBN_DATA_H__
+#define __TEST_SCALBN_DATA_H__
+
+#include <fenv.h>
+#include <libm_tests.h>
+#include <libm_util_amd.h>
+
+/*
+ * Test cases to check the conformance of the scalbnf() routine,
+ * {x, scalbnf(x, n), exceptions, (float)n}
+ */
+static libm_test_special_data_f32
+test_scalbnf_conformance_data[] = {
+    /* Test Inputs that are signalling and quiet NaNs */
+    {POS_SNAN_F32,    POS_SNAN_Q_F32,    FE_INVALID, 0x40400000},
+    {NEG_SNAN_F32,    NEG_SNAN_Q_F32,    FE_INVALID, 0x40400000},
+    {POS_QNAN_F32,    QNANBITPATT_SP32,  0, 0x40400000},
+    {NEG_QNAN_F32,    INDEFBITPATT_SP32, 0, 0x40400000},
+
+    /* -/+0, -/+inf, normal, denormal, overflow and underflow */
+    {0x00000000,      0x00000000,        0, 0x40a00000}, // scalbnf(0, 5) = 0
+    {0x80000000,      0x80000000,        0, 0xc0800000}, // scalbnf(-0, -4) = -0
+    {0x7f800000,      0x7f800000,        0, 0x40a00000}, // scalbnf(inf, 5) = inf
+    {0xff800000,      0xff800000,        0, 0xc0a00000}, // scalbnf(-inf, -5) = -inf
+    {0x3f800000,      0x3f800000,        0, 0x00000000}, // scalbnf(1, 0) = 1
+    {0x3f800000,      0x7f000000,        0, 0x42fe0000}, // scalbnf(1, 127) = 1.70141e+38
+    {0x3f800000,      0x7f800000,        FE_OVERFLOW|FE_INEXACT, 0x43000000}, // scalbnf(1, 128) = inf
+    {0x3f800000,      0x00800000,        0, 0xc2fc0000}, // scalbnf(1, -126) = 1.17549e-38
+    {0x3f800000,      0x00000001,        0, 0xc3150000}, // scalbnf(1, -149) = 1.4013e-45
+    {0x3f800000,      0x00000000,        FE_UNDERFLOW|FE_INEXACT, 0xc3160000}, // scalbnf(1, -150) = 0
+    {0x3fc00000,      0x00000002,        FE_UNDERFLOW|FE_INEXACT, 0xc3150000}, // scalbnf(1.5, -149) = 2.8026e-45
+    {0x00000001,      0x3f800000,        0, 0x43150000}, // scalbnf(1.4013e-45, 149) = 1
+    {0x007fffff,      0x00fffffe,        0, 0x3f800000}, // scalbnf(1.17549e-38, 1) = 2.35099e-38
+    {0x007fffff,      0x00400000,        FE_UNDERFLOW|FE_INEXACT, 0xbf800000}, // scalbnf(1.17549e-38, -1) = 5.87747e-39
+    {0x7f7fffff,      0x00800000,        FE_UNDERFLOW|FE_INEXACT, 0xc37e0000}, // scalbnf(3.40282e+38, -254) = 1.17549e-38
+    {0x40400000,      0x41400000,        0, 0x40000000}, // scalbnf(3, 2) = 12
+    {0xc0400000,      0xff800000,        FE_OVERFLOW|FE_INEXACT, 0x447a0000}, // scalbnf(-3, 1000) = -inf
+    {0x3f800000,      0x00000000,        FE_UNDERFLOW|FE_INEXACT, 0xce6e6b28}, // scalbnf(1, -1000000000) = 0
+    {0x00000001,      0x7f800000,        FE_OVERFLOW|FE_INEXACT, 0x43960000}, // scalbnf(1.4013e-45, 300) = inf
+    {0x7f7fffff,      0x00000000,        FE_UNDERFLOW|FE_INEXACT, 0xc3960000}, // scalbnf(3.40282e+38, -300) = 0
+    {0x40490fdb,      0x001921fb,        FE_UNDERFLOW|FE_INEXACT, 0xc3020000}, // scalbnf(3.14159, -130) = 2.30808e-39
+};
+
+/*
+ * Test cases to check the conformance of the scalbn() routine,
+ * {x, scalbn(x, n), exceptions, (double)n}
+ */
+static libm_test_special_data_f64
+test_scalbn_conformance_data[] = {
+    /* Test Inputs that are signalling and quiet NaNs */
+    {POS_SNAN_F64,         POS_SNAN_Q_F64,       FE_INVALID, 0x4008000000000000LL},
+    {NEG_SNAN_F64,         NEG_SNAN_Q_F64,       FE_INVALID, 0x4008000000000000LL},
+    {POS_QNAN_F64,         QNANBITPATT_DP64,     0, 0x4008000000000000LL},
+    {NEG_QNAN_F64,         NEG_QNAN_F64,         0, 0x4008000000000000LL},
+
+    /* -/+0, -/+inf, normal, denormal, overflow and underflow */
+    {0x0000000000000000LL, 0x0000000000000000LL, 0, 0x4014000000000000LL}, // scalbn(0, 5) = 0
+    {0x8000000000000000LL, 0x8000000000000000LL, 0, 0xc010000000000000LL}, // scalbn(-0, -4) = -0
+    {0x7ff0000000000000LL, 0x7ff0000000000000LL, 0, 0x4014000000000000LL}, // scalbn(inf, 5) = inf
+    {0xfff0000000000000LL, 0xfff0000000000000LL, 0, 0xc014000000000000LL}, // scalbn(-inf, -5) = -inf
+    {0x3ff0000000000000LL, 0x3ff0000000000000LL, 0, 0x0000000000000000LL}, // scalbn(1, 0) = 1
+    {0x3ff0000000000000LL, 0x7fe0000000000000LL, 0, 0x408ff80000000000LL}, // scalbn(1, 1023) = 8.98847e+307
+    {0x3ff0000000000000LL, 0x7ff0000000000000LL, FE_OVERFLOW|FE_INEXACT, 0x4090000000000000LL}, // scalbn(1, 1024) = inf
+    {0x3ff0000000000000LL, 0x0010000000000000LL, 0, 0xc08ff00000000000LL}, // scalbn(1, -1022) = 2.22507e-308
+    {0x3ff0000000000000LL, 0x0000000000000001LL, 0, 0xc090c80000000000LL}, // scalbn(1, -1074) = 4.94066e-324
+    {0x3ff0000000000000LL, 0x0000000000000000LL, FE_UNDERFLOW|FE_INEXACT, 0xc090cc0000000000LL}, // scalbn(1, -1075) = 0
+    {0x3ff8000000000000LL, 0x0000000000000002LL, FE_UNDERFLOW|FE_INEXACT, 0xc090c80000000000LL}, // scalbn(1.5, -1074) = 9.88131e-324
+    {0x0000000000000001LL, 0x3ff0000000000000LL, 0, 0x4090c80000000000LL}, // scalbn(4.94066e-324, 1074) = 1
+    {0x000fffffffffffffLL, 0x001ffffffffffffeLL, 0, 0x3ff0000000000000LL}, // scalbn(2.22507e-308, 1) = 4.45015e-308
+    {0x000fffffffffffffLL, 0x0008000000000000LL, FE_UNDERFLOW|FE_INEXACT, 0xbff0000000000000LL}, // scalbn(2.22507e-308, -1) = 1.11254e-308
+    {0x7fefffffffffffffLL, 0x0010000000000000LL, FE_UNDERFLOW|FE_INEXACT, 0xc09ff80000000000LL}, // scalbn(1.79769e+308, -2046) = 2.22507e-308
+    {0x4008000000000000LL, 0x4028000000000000LL, 0, 0x4000000000000000LL}, // scalbn(3, 2) = 12
+    {0xc008000000000000LL, 0xfff0000000000000LL, FE_OVERFLOW|FE_INEXACT, 0x40b3880000000000LL}, // scalbn(-3, 5000) = -inf
+    {0x3ff0000000000000LL, 0x0000000000000000LL, FE_UNDERFLOW|FE_INEXACT, 0xc1cdcd6500000000LL}, // scalbn(1, -1000000000) = 0
+    {0x0000000000000001LL, 0x7ff0000000000000LL, FE_OVERFLOW|FE_INEXACT, 0x40a1300000000000LL}, // scalbn(4.94066e-324, 2200) = inf
+    {0x7fefffffffffffffLL, 0x0000000000000000LL, FE_UNDERFLOW|FE_INEXACT, 0xc0a1300000000000LL}, // scalbn(1.79769e+308, -2200) = 0
+    {0x400921fb54442d18LL, 0x00003243f6a8885aLL, FE_UNDERFLOW|FE_INEXACT, 0xc090180000000000LL}, // scalbn(3.14159, -1030) = 2.73058e-310
+};
+
+#endif
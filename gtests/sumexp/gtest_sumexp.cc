@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/*
+ * The array reductions against an mparith-summed reference.
+ *
+ * vrda_sumexp, vrda_logsumexp and vrda_sumlog (and the float variants)
+ * are compared with alm_mp_sumexp, alm_mp_logsumexp and alm_mp_sumlog,
+ * which evaluate and add every term in 256 (128) bits and round once.
+ * Random arrays up to 1 << 18 elements bound the error of the blocked
+ * pairwise sums, the special arrays check empty and length-1 inputs,
+ * all -inf, +inf and NaN, and sums that only stay finite because
+ * logsumexp shifts by the maximum.
+ */
+
+#include <cstdio>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include "gtest.h"
+#define AMD_LIBM_VEC_EXPERIMENTAL
+#include <external/amdlibm_vec.h>
+
+extern "C" {
+#include "alm_mp_funcs.h"
+}
+
+/*
+ * Stated max error in ulps of the result. The float reductions
+ * accumulate in double, the bound covers the final rounding and the
+ * kernel error. sumlog is checked only where all the terms have the
+ * same sign, elsewhere the sum cancels and no ulp bound holds.
+ */
+static const double sumexp_ulp = 4.0, logsumexp_ulp = 2.0, sumlog_ulp = 4.0;
+static const double sumexpf_ulp = 3.0, logsumexpf_ulp = 3.0, sumlogf_ulp = 3.0;
+
+template <typename T> struct Reduce;
+
+template <> struct Reduce<double> {
+  typedef long double ref_t;
+  static double sumexp(std::vector<double> &x) { return amd_vrda_sumexp((int)x.size(), x.data()); }
+  static double logsumexp(std::vector<double> &x) { return amd_vrda_logsumexp((int)x.size(), x.data()); }
+  static double sumlog(std::vector<double> &x) { return amd_vrda_sumlog((int)x.size(), x.data()); }
+  static ref_t mp_sumexp(const std::vector<double> &x) { return alm_mp_sumexp((int)x.size(), x.data()); }
+  static ref_t mp_logsumexp(const std::vector<double> &x) { return alm_mp_logsumexp((int)x.size(), x.data()); }
+  static ref_t mp_sumlog(const std::vector<double> &x) { return alm_mp_sumlog((int)x.size(), x.data()); }
+};
+
+template <> struct Reduce<float> {
+  typedef double ref_t;
+  static float sumexp(std::vector<float> &x) { return amd_vrsa_sumexpf((int)x.size(), x.data()); }
+  static float logsumexp(std::vector<float> &x) { return amd_vrsa_logsumexpf((int)x.size(), x.data()); }
+  static float sumlog(std::vector<float> &x) { return amd_vrsa_sumlogf((int)x.size(), x.data()); }
+  static ref_t mp_sumexp(const std::vector<float> &x) { return alm_mp_sumexpf((int)x.size(), x.data()); }
+  static ref_t mp_logsumexp(const std::vector<float> &x) { return alm_mp_logsumexpf((int)x.size(), x.data()); }
+  static ref_t mp_sumlog(const std::vector<float> &x) { return alm_mp_sumlogf((int)x.size(), x.data()); }
+};
+
+/* Error of a in ulps of T at the reference e, 0 for matching NaN and inf */
+template <typename T>
+static double UlpError(T a, typename Reduce<T>::ref_t e) {
+  T r = (T)e;
+  if (std::isnan(a) || std::isnan(r))
+    return (std::isnan(a) && std::isnan(r)) ? 0.0 : INFINITY;
+  if (std::isinf(a) || std::isinf(r))
+    return (a == r) ? 0.0 : INFINITY;
+  int exp = std::max(std::ilogb(r), std::numeric_limits<T>::min_exponent - 1);
+  long double ulp = std::ldexp((long double)1, exp - std::numeric_limits<T>::digits + 1);
+  if (r == 0)
+    ulp = std::numeric_limits<T>::denorm_min();
+  return (double)(std::fabs((long double)a - (long double)e) / ulp);
+}
+
+template <typename T>
+static std::vector<T> Uniform(int n, T lo, T hi, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<T> dist(lo, hi);
+  std::vector<T> v(n);
+  for (T &x : v)
+    x = dist(gen);
+  return v;
+}
+
+template <typename T>
+static void Check(const char *name, std::vector<T> &x, T a, typename Reduce<T>::ref_t e,
+                  double bound, double &maxulp) {
+  double ulp = UlpError<T>(a, e);
+  maxulp = std::max(maxulp, ulp);
+  EXPECT_LE(ulp, bound) << name << " n=" << x.size() << std::hexfloat
+                        << " expected " << (T)e << " actual " << a;
+}
+
+static const int lengths[] = {1, 2, 3, 4, 5, 7, 8, 15, 16, 17, 31, 33, 255, 256, 257,
+                              1000, 4099, 65537, (1 << 18) + 5};
+
+template <typename T>
+static void CheckRandom(const char *fn, double b_sumexp, double b_logsumexp, double b_sumlog) {
+  typedef Reduce<T> R;
+  double m_sumexp = 0, m_logsumexp = 0, m_sumlog = 0;
+  for (int n : lengths) {
+    /* exp(x) spans sixteen binades, the largest terms dominate the sum */
+    std::vector<T> x = Uniform<T>(n, T(-20), T(20), n);
+    Check<T>("sumexp", x, R::sumexp(x), R::mp_sumexp(x), b_sumexp, m_sumexp);
+    Check<T>("logsumexp", x, R::logsumexp(x), R::mp_logsumexp(x), b_logsumexp, m_logsumexp);
+    /* shifted far from zero, the unshifted sum would overflow */
+    std::vector<T> big = Uniform<T>(n, T(60), T(100), n + 1);
+    Check<T>("logsumexp", big, R::logsumexp(big), R::mp_logsumexp(big), b_logsumexp, m_logsumexp);
+    /* logs of the same sign, no cancellation */
+    std::vector<T> pos = Uniform<T>(n, T(1), T(1e4), n + 2);
+    Check<T>("sumlog", pos, R::sumlog(pos), R::mp_sumlog(pos), b_sumlog, m_sumlog);
+    std::vector<T> neg = Uniform<T>(n, T(1e-30), T(0.9), n + 3);
+    Check<T>("sumlog", neg, R::sumlog(neg), R::mp_sumlog(neg), b_sumlog, m_sumlog);
+  }
+  printf("%s: max ulp sumexp %.3f logsumexp %.3f sumlog %.3f\n", fn, m_sumexp,
+         m_logsumexp, m_sumlog);
+}
+
+template <typename T>
+static void CheckSpecial(double b_sumexp, double b_logsumexp, double b_sumlog) {
+  typedef Reduce<T> R;
+  const T inf = std::numeric_limits<T>::infinity();
+  const T nan = std::numeric_limits<T>::quiet_NaN();
+  const T big = std::numeric_limits<T>::max_exponent * T(0.6931471805599453);
+  double m = 0;
+
+  /* empty: sums are 0, logsumexp is the log of an empty sum */
+  std::vector<T> x;
+  EXPECT_EQ(R::sumexp(x), T(0));
+  EXPECT_EQ(R::sumlog(x), T(0));
+  EXPECT_EQ(R::logsumexp(x), -inf);
+
+  /* length 1: logsumexp is x itself, the others the scalar function */
+  for (T v : {T(0), T(-3.5), T(1.25), T(50), -T(50), T(1e-30)}) {
+    x.assign(1, v);
+    EXPECT_EQ(R::logsumexp(x), v);
+    Check<T>("sumexp", x, R::sumexp(x), R::mp_sumexp(x), b_sumexp, m);
+    if (v > 0)
+      Check<T>("sumlog", x, R::sumlog(x), R::mp_sumlog(x), b_sumlog, m);
+  }
+
+  /* all -inf */
+  for (int n : {1, 5, 17}) {
+    x.assign(n, -inf);
+    EXPECT_EQ(R::sumexp(x), T(0)) << "n=" << n;
+    EXPECT_EQ(R::logsumexp(x), -inf) << "n=" << n;
+    EXPECT_TRUE(std::isnan(R::sumlog(x))) << "n=" << n;
+  }
+
+  for (int n : {1, 6, 17, 300}) {
+    for (int k : {0, n / 2, n - 1}) {
+      /* a second special element, distinct from k when n > 1 */
+      int j = (k + n / 2 + 1) % n;
+      /* +inf anywhere */
+      x = Uniform<T>(n, T(0.5), T(5), n + k);
+      x[k] = inf;
+      EXPECT_EQ(R::sumexp(x), inf) << "n=" << n << " k=" << k;
+      EXPECT_EQ(R::logsumexp(x), inf) << "n=" << n << " k=" << k;
+      EXPECT_EQ(R::sumlog(x), inf) << "n=" << n << " k=" << k;
+      /* +inf and -inf together */
+      x[j] = -inf;
+      if (j != k) {
+        EXPECT_EQ(R::logsumexp(x), inf) << "n=" << n << " k=" << k;
+      }
+      /* NaN anywhere, also next to an inf */
+      x = Uniform<T>(n, T(0.5), T(5), n + k);
+      x[k] = nan;
+      EXPECT_TRUE(std::isnan(R::sumexp(x))) << "n=" << n << " k=" << k;
+      EXPECT_TRUE(std::isnan(R::logsumexp(x))) << "n=" << n << " k=" << k;
+      EXPECT_TRUE(std::isnan(R::sumlog(x))) << "n=" << n << " k=" << k;
+      if (j != k) {
+        x[j] = inf;
+        EXPECT_TRUE(std::isnan(R::logsumexp(x))) << "n=" << n << " k=" << k;
+      }
+      /* log of zero and of a negative element */
+      x = Uniform<T>(n, T(0.5), T(5), n + k);
+      x[k] = T(0);
+      EXPECT_EQ(R::sumlog(x), -inf) << "n=" << n << " k=" << k;
+      x[k] = T(-1);
+      EXPECT_TRUE(std::isnan(R::sumlog(x))) << "n=" << n << " k=" << k;
+    }
+  }
+
+  /*
+   * exp(big) is within a factor of two of the overflow threshold: sumexp
+   * overflows, logsumexp must not since it only adds exp(x - max).
+   */
+  for (int n : {2, 4, 9, 1000}) {
+    x.assign(n, big);
+    EXPECT_EQ(R::sumexp(x), inf) << "n=" << n;
+    Check<T>("logsumexp", x, R::logsumexp(x), R::mp_logsumexp(x), b_logsumexp, m);
+    x.assign(n, T(1000));
+    Check<T>("logsumexp", x, R::logsumexp(x), R::mp_logsumexp(x), b_logsumexp, m);
+    x.assign(n, -T(1000));
+    Check<T>("logsumexp", x, R::logsumexp(x), R::mp_logsumexp(x), b_logsumexp, m);
+    EXPECT_EQ(R::sumexp(x), T(0)) << "n=" << n;
+    x = Uniform<T>(n, big - T(30), big + T(30), n);
+    Check<T>("logsumexp", x, R::logsumexp(x), R::mp_logsumexp(x), b_logsumexp, m);
+  }
+}
+
+TEST(SUMEXP, ACCURACY_DOUBLE) {
+  CheckRandom<double>("vrda", sumexp_ulp, logsumexp_ulp, sumlog_ulp);
+}
+
+TEST(SUMEXP, ACCURACY_FLOAT) {
+  CheckRandom<float>("vrsa", sumexpf_ulp, logsumexpf_ulp, sumlogf_ulp);
+}
+
+TEST(SUMEXP, SPECIAL_DOUBLE) {
+  CheckSpecial<double>(sumexp_ulp, logsumexp_ulp, sumlog_ulp);
+}
+
+TEST(SUMEXP, SPECIAL_FLOAT) {
+  CheckSpecial<float>(sumexpf_ulp, logsumexpf_ulp, sumlogf_ulp);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
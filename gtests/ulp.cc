@@ -219,30 +219,21 @@ double getUlp(double aop, long double exptd) {
 }
 
 /* The calculation of ULP in Complex Numbers is as follows:
- * cabs() is used to compute the complex absolute value (magnitude/modulus) of a complex number.
- * The magnitudes of actual and expected outputs will determine the resultant ULP.
+ * the real and the imaginary parts are compared separately, and the
+ * larger of the two ULP errors is the resultant ULP. Comparing only the
+ * magnitudes would not see an error in the phase.
  */
 
 double getUlp(float _Complex aop, double _Complex exptd) {
-  #if (defined _WIN32 || defined _WIN64 )
-    float f_aop = abs(complex<float> (__real__ aop, __imag__ aop));
-    double d_exptd = abs(complex<double> (__real__ exptd, __imag__ exptd));
-  #else
-    float f_aop = cabs(aop);
-    double d_exptd = cabs(exptd);
-  #endif
-  return ALM::ComputeUlp(f_aop, d_exptd);
+  double ulp_re = ALM::ComputeUlp((float)__real__ aop, (double)__real__ exptd);
+  double ulp_im = ALM::ComputeUlp((float)__imag__ aop, (double)__imag__ exptd);
+  return (ulp_re > ulp_im) ? ulp_re : ulp_im;
 }
 
 double getUlp(double _Complex aop, long double  _Complex exptd) {
-  #if (defined _WIN32 || defined _WIN64 )
-    double d_aop = abs(complex<double>(__real__ aop, __imag__ aop));
-    long double ld_exptd = abs(complex<long double>(__real__ exptd, __imag__ exptd));
-  #else
-    double d_aop = cabs(aop);
-    long double ld_exptd = cabs(exptd);
-  #endif
-  return ALM::ComputeUlp(d_aop, ld_exptd);
+  double ulp_re = ALM::ComputeUlp((double)__real__ aop, (long double)__real__ exptd);
+  double ulp_im = ALM::ComputeUlp((double)__imag__ aop, (long double)__imag__ exptd);
+  return (ulp_re > ulp_im) ? ulp_re : ulp_im;
 }
 
 bool update_ulp(double ulp, double &max_ulp_err, double ulp_threshold)
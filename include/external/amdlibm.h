@@ -183,6 +183,11 @@ agreements with respect to the subject matter of this Agreement.
   typedef    long double _Complex fc128_t;
 #endif
 
+/* IEEE 754 binary16, held as its bit pattern */
+typedef    short               f16_t;
+/* bfloat16, the upper 16 bits of a float */
+typedef    short               bf16_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -386,8 +391,134 @@ extern "C" {
     fc64_t amd_clog  (fc64_t x);
     fc32_t amd_clogf (fc32_t y);
 
+    fc64_t amd_csin  (fc64_t x);
+    fc32_t amd_csinf (fc32_t x);
+
+    fc64_t amd_ccos  (fc64_t x);
+    fc32_t amd_ccosf (fc32_t x);
+
+    fc64_t amd_ctan  (fc64_t x);
+    fc32_t amd_ctanf (fc32_t x);
+
+    fc64_t amd_csqrt  (fc64_t x);
+    fc32_t amd_csqrtf (fc32_t x);
+
+    double amd_cabs  (fc64_t x);
+    float  amd_cabsf (fc32_t x);
+
+    double amd_carg  (fc64_t x);
+    float  amd_cargf (fc32_t x);
+
+    /* Half precision */
+    f16_t  amd_expf16  (f16_t x);
+    f16_t  amd_logf16  (f16_t x);
+    f16_t  amd_sinf16  (f16_t x);
+    f16_t  amd_cosf16  (f16_t x);
+    f16_t  amd_tanhf16 (f16_t x);
+    f16_t  amd_erff16  (f16_t x);
+    f16_t  amd_sqrtf16 (f16_t x);
+    f16_t  amd_powf16  (f16_t x, f16_t y);
+
     double amd_erf  (double x);
     float  amd_erff (float x);
+    double amd_erfc (double x);
+    float  amd_erfcf(float x);
+
+    /* Inverse error functions and the standard normal distribution */
+    double amd_erfinv      (double x);
+    float  amd_erfinvf     (float x);
+    double amd_erfcinv     (double x);
+    float  amd_erfcinvf    (float x);
+    double amd_cdfnorm     (double x);
+    float  amd_cdfnormf    (float x);
+    double amd_cdfnorminv  (double x);
+    float  amd_cdfnorminvf (float x);
+
+    /* Gamma functions, amd_lgamma does not set signgam */
+    double amd_lgamma      (double x);
+    float  amd_lgammaf     (float x);
+    double amd_tgamma      (double x);
+    float  amd_tgammaf     (float x);
+    double amd_digamma     (double x);
+    float  amd_digammaf    (float x);
+
+    /*
+     * Reciprocal roots. The _approx variants trade about 1 ulp of accuracy
+     * for a hardware estimate with a short refinement.
+     */
+    double amd_rsqrt        (double x);
+    float  amd_rsqrtf       (float x);
+    double amd_rsqrt_approx (double x);
+    float  amd_rsqrtf_approx(float x);
+    double amd_invcbrt      (double x);
+    float  amd_invcbrtf     (float x);
+    double amd_rhypot       (double x, double y);
+    float  amd_rhypotf      (float x, float y);
+
+    /*
+     * Finite-math-only variants (libalmfast): no NaN, inf, overflow,
+     * underflow or denormal handling. x must be finite and the result
+     * normal, exp: |x| <= 708, expf: |x| <= 87, log/logf: x normal > 0.
+     * Also exported as __exp_finite, __expf_finite, __log_finite and
+     * __logf_finite.
+     */
+    double amd_exp_finite  (double x);
+    float  amd_expf_finite (float x);
+    double amd_log_finite  (double x);
+    float  amd_logf_finite (float x);
+
+    /*
+     * Slow-path statistics, only counted in a library built with
+     * ALM_STATS (scons use_stats=1, cmake -DALM_STATS=ON), otherwise
+     * amd_libm_stats_get() returns 0.
+     *
+     * One entry per kernel source file or special-case handler, summed
+     * over all threads: checks is the number of slow-path condition tests,
+     * slow_calls how many of them fell back to scalar code and slow_lanes
+     * the lanes recomputed there; special counts alm_*_special() hits.
+     *
+     * amd_libm_stats_get() fills at most max entries and returns the
+     * number there are. Set AMD_LIBM_STATS=1 (or a file name) in the
+     * environment to have them printed at exit.
+     */
+    struct amd_libm_stat {
+        const char         *name;
+        unsigned long long  checks;
+        unsigned long long  slow_calls;
+        unsigned long long  slow_lanes;
+        unsigned long long  special;
+    };
+
+    int  amd_libm_stats_get  (struct amd_libm_stat *stats, int max);
+    void amd_libm_stats_reset(void);
+
+    /*
+     * Dispatch report: the kernel each function and variant resolves to
+     * on a uarch ("zen3", ...; NULL for the host, "all" for every one,
+     * in turn). uarch is the dispatch table column the kernel is taken
+     * from, lanes 1 for scalars and 0 for arrays, avx512 is set for
+     * kernels that need it. symbol is NULL where it cannot be looked up
+     * (Windows, or a static library without -rdynamic).
+     *
+     * amd_libm_dispatch_get() fills at most max entries and returns the
+     * number there are, -1 for an unknown uarch. amd_libm_dump_dispatch()
+     * writes them as JSON to path, stdout for NULL or "-", and returns
+     * the number written or -1.
+     */
+    struct amd_libm_kernel {
+        const char         *sku;        /* uarch looked up */
+        const char         *func;       /* "exp" */
+        const char         *variant;    /* "s1d", "v4s", "vad", ... */
+        const char         *uarch;
+        const char         *symbol;
+        const void         *addr;
+        int                 lanes;
+        int                 avx512;
+    };
+
+    int  amd_libm_dispatch_get (const char *uarch,
+                                struct amd_libm_kernel *k, int max);
+    int  amd_libm_dump_dispatch(const char *uarch, const char *path);
 
 
 #ifdef __cplusplus
@@ -719,12 +850,46 @@ extern "C" {
 #define cexp amd_cexp
 #undef cexpf
 #define cexpf amd_cexpf
+#undef csin
+#define csin amd_csin
+#undef csinf
+#define csinf amd_csinf
+#undef ccos
+#define ccos amd_ccos
+#undef ccosf
+#define ccosf amd_ccosf
+#undef ctan
+#define ctan amd_ctan
+#undef ctanf
+#define ctanf amd_ctanf
+#undef csqrt
+#define csqrt amd_csqrt
+#undef csqrtf
+#define csqrtf amd_csqrtf
+#undef cabs
+#define cabs amd_cabs
+#undef cabsf
+#define cabsf amd_cabsf
+#undef carg
+#define carg amd_carg
+#undef cargf
+#define cargf amd_cargf
 
 /* erf */
 #undef erf
 #define erf amd_erf
 #undef erff
 #define erff amd_erff
+#undef erfc
+#define erfc amd_erfc
+#undef erfcf
+#define erfcf amd_erfcf
+
+/* gamma, lgamma is left to libm for signgam */
+#undef tgamma
+#define tgamma amd_tgamma
+#undef tgammaf
+#define tgammaf amd_tgammaf
 
 #endif
 
@@ -174,6 +174,34 @@ agreements with respect to the subject matter of this Agreement.
 #error "The functionality in this header is experimental, please define AMD_LIBM_VEC_EXPERIMENTAL"
 #endif /* EXPERIMENTAL */
 
+/* Complex array variants take the interleaved (re, im) layout of C99 complex */
+#ifndef __AMDLIBM_H__
+#include <complex.h>
+#if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
+  #ifdef __cplusplus
+    extern "C" {
+  #endif
+  typedef _C_float_complex _Fcomplex;
+  typedef _C_double_complex _Dcomplex;
+  #ifdef __cplusplus
+    }
+  #endif
+#endif
+
+#if (defined (_WIN64) || defined (_WIN32))
+  typedef    _Fcomplex     fc32_t;
+  typedef    _Dcomplex     fc64_t;
+#else
+  typedef    float _Complex       fc32_t;
+  typedef    double _Complex      fc64_t;
+#endif
+
+/* IEEE 754 binary16, held as its bit pattern */
+typedef    short               f16_t;
+/* bfloat16, the upper 16 bits of a float */
+typedef    short               bf16_t;
+#endif /* __AMDLIBM_H__ */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -301,6 +329,32 @@ extern "C" {
     void amd_vrda_sincos    (int len, double *src, double *sin, double *cos);
     void amd_vrsa_sincosf   (int len, float  *src, float  *sin, float  *cos);
 
+    /* cos + i sin, and r * (cos + i sin), into interleaved complex arrays */
+    void amd_vrda_cis       (int len, double *theta, fc64_t *dst);
+    void amd_vrsa_cisf      (int len, float  *theta, fc32_t *dst);
+    void amd_vrda_polar     (int len, double *r, double *theta, fc64_t *dst);
+    void amd_vrsa_polarf    (int len, float  *r, float  *theta, fc32_t *dst);
+
+/* Normal distribution */
+    void amd_vrda_boxmuller (int len, double *u1, double *u2, double *z0, double *z1);
+    void amd_vrsa_boxmullerf(int len, float  *u1, float  *u2, float  *z0, float  *z1);
+    void amd_vrda_cdfnorminv(int len, double *src, double *dst);
+    void amd_vrsa_cdfnorminvf(int len, float *src, float *dst);
+    void amd_vrda_cdfnorm   (int len, double *src, double *dst);
+    void amd_vrsa_cdfnormf  (int len, float  *src, float  *dst);
+    void amd_vrda_erfc      (int len, double *src, double *dst);
+    void amd_vrsa_erfcf     (int len, float  *src, float  *dst);
+    void amd_vrda_erfinv    (int len, double *src, double *dst);
+    void amd_vrsa_erfinvf   (int len, float  *src, float  *dst);
+    void amd_vrda_erfcinv   (int len, double *src, double *dst);
+    void amd_vrsa_erfcinvf  (int len, float  *src, float  *dst);
+    void amd_vrda_lgamma    (int len, double *src, double *dst);
+    void amd_vrsa_lgammaf   (int len, float  *src, float  *dst);
+    void amd_vrda_tgamma    (int len, double *src, double *dst);
+    void amd_vrsa_tgammaf   (int len, float  *src, float  *dst);
+    void amd_vrda_digamma   (int len, double *src, double *dst);
+    void amd_vrsa_digammaf  (int len, float  *src, float  *dst);
+
 /* Inverse Trigonometric */
     __m128  amd_vrs4_asinf  (__m128  x);
     __m128  amd_vrs4_acosf  (__m128  x);
@@ -331,6 +385,32 @@ extern "C" {
     __m128d amd_vrd2_powx   (__m128d x, double y);
     __m256d amd_vrd4_powx   (__m256d, double);
 
+    /* pow with an integer exponent, and its inverse rootn(x, n) = x^(1/n) */
+    __m256d amd_vrd4_pown   (__m256d x, int n);
+    void    amd_vrda_pown   (int len, double *src, int n, double *dst);
+    void    amd_vrda_rootn  (int len, double *src, int n, double *dst);
+
+    /* Fused affine array variants, dst[i] = c * f(a * src[i] + b) + d */
+    void amd_vrda_exp_affine   (int len, double *src, double a, double b, double c, double d, double *dst);
+    void amd_vrda_log_affine   (int len, double *src, double a, double b, double c, double d, double *dst);
+    void amd_vrda_pow_affine   (int len, double *src1, double *src2, double a, double b, double c, double d, double *dst);
+    void amd_vrda_sin_affine   (int len, double *src, double a, double b, double c, double d, double *dst);
+    void amd_vrda_cos_affine   (int len, double *src, double a, double b, double c, double d, double *dst);
+    void amd_vrsa_expf_affine  (int len, float  *src, float  a, float  b, float  c, float  d, float  *dst);
+    void amd_vrsa_logf_affine  (int len, float  *src, float  a, float  b, float  c, float  d, float  *dst);
+    void amd_vrsa_powf_affine  (int len, float  *src1, float  *src2, float  a, float  b, float  c, float  d, float  *dst);
+    void amd_vrsa_sinf_affine  (int len, float  *src, float  a, float  b, float  c, float  d, float  *dst);
+    void amd_vrsa_cosf_affine  (int len, float  *src, float  a, float  b, float  c, float  d, float  *dst);
+    void amd_vrsa_tanhf_affine (int len, float  *src, float  a, float  b, float  c, float  d, float  *dst);
+
+    /* Array reductions, the per-element results are not written to memory */
+    double amd_vrda_sumexp     (int len, double *src);
+    double amd_vrda_logsumexp  (int len, double *src);
+    double amd_vrda_sumlog     (int len, double *src);
+    float  amd_vrsa_sumexpf    (int len, float  *src);
+    float  amd_vrsa_logsumexpf (int len, float  *src);
+    float  amd_vrsa_sumlogf    (int len, float  *src);
+
 
     __m128  amd_vrs4_powxf   (__m128 x, float y);
     __m256  amd_vrs8_powxf   (__m256 x, float y);
@@ -351,6 +431,38 @@ extern "C" {
     __m256d amd_vrd4_erf    (__m256d x);
     __m256  amd_vrs8_erff   (__m256 x);
 
+    __m128d amd_vrd2_erfc    (__m128d x);
+    __m128  amd_vrs4_erfcf   (__m128 x);
+    __m256d amd_vrd4_erfc    (__m256d x);
+    __m256  amd_vrs8_erfcf   (__m256 x);
+
+    __m128d amd_vrd2_erfinv  (__m128d x);
+    __m128  amd_vrs4_erfinvf (__m128 x);
+    __m256d amd_vrd4_erfinv  (__m256d x);
+    __m256  amd_vrs8_erfinvf (__m256 x);
+
+    __m128d amd_vrd2_erfcinv (__m128d x);
+    __m128  amd_vrs4_erfcinvf(__m128 x);
+    __m256d amd_vrd4_erfcinv (__m256d x);
+    __m256  amd_vrs8_erfcinvf(__m256 x);
+
+    __m128d amd_vrd2_cdfnorm (__m128d x);
+    __m128  amd_vrs4_cdfnormf(__m128 x);
+    __m256d amd_vrd4_cdfnorm (__m256d x);
+    __m256  amd_vrs8_cdfnormf(__m256 x);
+
+    __m128d amd_vrd2_cdfnorminv(__m128d x);
+    __m128  amd_vrs4_cdfnorminvf(__m128 x);
+    __m256d amd_vrd4_cdfnorminv(__m256d x);
+    __m256  amd_vrs8_cdfnorminvf(__m256 x);
+
+    __m256d amd_vrd4_lgamma  (__m256d x);
+    __m256  amd_vrs8_lgammaf (__m256 x);
+    __m256d amd_vrd4_tgamma  (__m256d x);
+    __m256  amd_vrs8_tgammaf (__m256 x);
+    __m256d amd_vrd4_digamma (__m256d x);
+    __m256  amd_vrs8_digammaf(__m256 x);
+
 /* sqrt */
     __m128d amd_vrd2_sqrt   (__m128d x);
     __m256d amd_vrd4_sqrt   (__m256d x);
@@ -361,6 +473,36 @@ extern "C" {
     void amd_vrda_sqrt       (int len, double *src, double *dst);
     void amd_vrsa_sqrtf      (int len, float  *src, float  *dst);
 
+/* Reciprocal roots, the _approx variants are accurate to about 1.5 ulp */
+    __m128d amd_vrd2_rsqrt   (__m128d x);
+    __m256d amd_vrd4_rsqrt   (__m256d x);
+    __m128  amd_vrs4_rsqrtf  (__m128 x);
+    __m256  amd_vrs8_rsqrtf  (__m256 x);
+
+    __m128d amd_vrd2_rsqrt_approx (__m128d x);
+    __m256d amd_vrd4_rsqrt_approx (__m256d x);
+    __m128  amd_vrs4_rsqrtf_approx(__m128 x);
+    __m256  amd_vrs8_rsqrtf_approx(__m256 x);
+
+    __m128d amd_vrd2_invcbrt (__m128d x);
+    __m256d amd_vrd4_invcbrt (__m256d x);
+    __m128  amd_vrs4_invcbrtf(__m128 x);
+    __m256  amd_vrs8_invcbrtf(__m256 x);
+
+    __m128d amd_vrd2_rhypot  (__m128d x, __m128d y);
+    __m256d amd_vrd4_rhypot  (__m256d x, __m256d y);
+    __m128  amd_vrs4_rhypotf (__m128 x, __m128 y);
+    __m256  amd_vrs8_rhypotf (__m256 x, __m256 y);
+
+    void amd_vrda_rsqrt         (int len, double *src, double *dst);
+    void amd_vrsa_rsqrtf        (int len, float  *src, float  *dst);
+    void amd_vrda_rsqrt_approx  (int len, double *src, double *dst);
+    void amd_vrsa_rsqrtf_approx (int len, float  *src, float  *dst);
+    void amd_vrda_invcbrt       (int len, double *src, double *dst);
+    void amd_vrsa_invcbrtf      (int len, float  *src, float  *dst);
+    void amd_vrda_rhypot        (int len, double *src1, double *src2, double *dst);
+    void amd_vrsa_rhypotf       (int len, float  *src1, float  *src2, float  *dst);
+
 /* linearfrac */
     __m128d amd_vrd2_linearfrac   (__m128d x, __m128d y, double, double, double, double);
     __m256d amd_vrd4_linearfrac   (__m256d x, __m256d y, double, double, double, double);
@@ -371,6 +513,155 @@ extern "C" {
     void amd_vrda_linearfrac      (int len, double *x, double *y, double scx, double shx, double scy, double shy, double *dst);
     void amd_vrsa_linearfracf     (int len, float *x, float *y, float scx, float shx, float scy, float shy, float *dst);
 
+/* Frexp, Ldexp, Scalbn, Ilogb, Logb
+ * Exponents of double precision vector variants are 64-bit integer lanes */
+    __m256d amd_vrd4_frexp   (__m256d x, __m256i *e);
+    __m256d amd_vrd4_ldexp   (__m256d x, __m256i n);
+    __m256d amd_vrd4_scalbn  (__m256d x, __m256i n);
+    __m256i amd_vrd4_ilogb   (__m256d x);
+    __m256d amd_vrd4_logb    (__m256d x);
+
+    __m256  amd_vrs8_frexpf  (__m256 x, __m256i *e);
+    __m256  amd_vrs8_ldexpf  (__m256 x, __m256i n);
+    __m256  amd_vrs8_scalbnf (__m256 x, __m256i n);
+    __m256i amd_vrs8_ilogbf  (__m256 x);
+    __m256  amd_vrs8_logbf   (__m256 x);
+
+    void amd_vrda_frexp      (int len, double *src, double *mant, int *expo);
+    void amd_vrda_ldexp      (int len, double *src, int *expo, double *dst);
+    void amd_vrda_scalbn     (int len, double *src, int *expo, double *dst);
+    void amd_vrda_ilogb      (int len, double *src, int *dst);
+    void amd_vrda_logb       (int len, double *src, double *dst);
+
+    void amd_vrsa_frexpf     (int len, float *src, float *mant, int *expo);
+    void amd_vrsa_ldexpf     (int len, float *src, int *expo, float *dst);
+    void amd_vrsa_scalbnf    (int len, float *src, int *expo, float *dst);
+    void amd_vrsa_ilogbf     (int len, float *src, int *dst);
+    void amd_vrsa_logbf      (int len, float *src, float *dst);
+
+/* Complex
+ * Register variants take the real and imaginary parts in separate registers */
+    void    amd_vrz4_cexp    (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+    void    amd_vrz4_clog    (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+    void    amd_vrz4_cpow    (__m256d xre, __m256d xim, __m256d yre, __m256d yim, __m256d *rre, __m256d *rim);
+    void    amd_vrz4_csin    (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+    void    amd_vrz4_ccos    (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+    void    amd_vrz4_ctan    (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+    void    amd_vrz4_csqrt   (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+    __m256d amd_vrz4_cabs    (__m256d re, __m256d im);
+    __m256d amd_vrz4_carg    (__m256d re, __m256d im);
+
+    void    amd_vrc8_cexpf   (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+    void    amd_vrc8_clogf   (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+    void    amd_vrc8_cpowf   (__m256 xre, __m256 xim, __m256 yre, __m256 yim, __m256 *rre, __m256 *rim);
+    void    amd_vrc8_csinf   (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+    void    amd_vrc8_ccosf   (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+    void    amd_vrc8_ctanf   (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+    void    amd_vrc8_csqrtf  (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+    __m256  amd_vrc8_cabsf   (__m256 re, __m256 im);
+    __m256  amd_vrc8_cargf   (__m256 re, __m256 im);
+
+    void amd_vrza_cexp       (int len, fc64_t *src, fc64_t *dst);
+    void amd_vrza_clog       (int len, fc64_t *src, fc64_t *dst);
+    void amd_vrza_cpow       (int len, fc64_t *src1, fc64_t *src2, fc64_t *dst);
+    void amd_vrza_csin       (int len, fc64_t *src, fc64_t *dst);
+    void amd_vrza_ccos       (int len, fc64_t *src, fc64_t *dst);
+    void amd_vrza_ctan       (int len, fc64_t *src, fc64_t *dst);
+    void amd_vrza_csqrt      (int len, fc64_t *src, fc64_t *dst);
+    void amd_vrza_cabs       (int len, fc64_t *src, double *dst);
+    void amd_vrza_carg       (int len, fc64_t *src, double *dst);
+
+    void amd_vrca_cexpf      (int len, fc32_t *src, fc32_t *dst);
+    void amd_vrca_clogf      (int len, fc32_t *src, fc32_t *dst);
+    void amd_vrca_cpowf      (int len, fc32_t *src1, fc32_t *src2, fc32_t *dst);
+    void amd_vrca_csinf      (int len, fc32_t *src, fc32_t *dst);
+    void amd_vrca_ccosf      (int len, fc32_t *src, fc32_t *dst);
+    void amd_vrca_ctanf      (int len, fc32_t *src, fc32_t *dst);
+    void amd_vrca_csqrtf     (int len, fc32_t *src, fc32_t *dst);
+    void amd_vrca_cabsf      (int len, fc32_t *src, float *dst);
+    void amd_vrca_cargf      (int len, fc32_t *src, float *dst);
+
+    /* separate arrays of real and imaginary parts */
+    void amd_vrza_cexp_soa   (int len, double *re, double *im, double *rre, double *rim);
+    void amd_vrza_clog_soa   (int len, double *re, double *im, double *rre, double *rim);
+    void amd_vrza_cpow_soa   (int len, double *xre, double *xim, double *yre, double *yim,
+                              double *rre, double *rim);
+
+    void amd_vrca_cexpf_soa  (int len, float *re, float *im, float *rre, float *rim);
+    void amd_vrca_clogf_soa  (int len, float *re, float *im, float *rre, float *rim);
+    void amd_vrca_cpowf_soa  (int len, float *xre, float *xim, float *yre, float *yim,
+                              float *rre, float *rim);
+
+    /* Half precision, IEEE binary16 bit patterns in integer registers */
+    __m128i amd_vrh8_expf16      (__m128i x);
+    __m128i amd_vrh8_logf16      (__m128i x);
+    __m128i amd_vrh8_sinf16      (__m128i x);
+    __m128i amd_vrh8_cosf16      (__m128i x);
+    __m128i amd_vrh8_tanhf16     (__m128i x);
+    __m128i amd_vrh8_erff16      (__m128i x);
+    __m128i amd_vrh8_sqrtf16     (__m128i x);
+    __m128i amd_vrh8_powf16      (__m128i x, __m128i y);
+
+    __m256i amd_vrh16_expf16     (__m256i x);
+    __m256i amd_vrh16_logf16     (__m256i x);
+    __m256i amd_vrh16_sinf16     (__m256i x);
+    __m256i amd_vrh16_cosf16     (__m256i x);
+    __m256i amd_vrh16_tanhf16    (__m256i x);
+    __m256i amd_vrh16_erff16     (__m256i x);
+    __m256i amd_vrh16_sqrtf16    (__m256i x);
+    __m256i amd_vrh16_powf16     (__m256i x, __m256i y);
+
+    void    amd_vrha_expf16      (int len, f16_t *src, f16_t *dst);
+    void    amd_vrha_logf16      (int len, f16_t *src, f16_t *dst);
+    void    amd_vrha_sinf16      (int len, f16_t *src, f16_t *dst);
+    void    amd_vrha_cosf16      (int len, f16_t *src, f16_t *dst);
+    void    amd_vrha_tanhf16     (int len, f16_t *src, f16_t *dst);
+    void    amd_vrha_erff16      (int len, f16_t *src, f16_t *dst);
+    void    amd_vrha_sqrtf16     (int len, f16_t *src, f16_t *dst);
+    void    amd_vrha_powf16      (int len, f16_t *src1, f16_t *src2, f16_t *dst);
+
+    /* bfloat16 input, bfloat16 or float output */
+    void    amd_vrba_expbf16        (int len, bf16_t *src, bf16_t *dst);
+    void    amd_vrba_expbf16_f32    (int len, bf16_t *src, float *dst);
+    void    amd_vrba_logbf16        (int len, bf16_t *src, bf16_t *dst);
+    void    amd_vrba_logbf16_f32    (int len, bf16_t *src, float *dst);
+    void    amd_vrba_tanhbf16       (int len, bf16_t *src, bf16_t *dst);
+    void    amd_vrba_tanhbf16_f32   (int len, bf16_t *src, float *dst);
+    void    amd_vrba_erfbf16        (int len, bf16_t *src, bf16_t *dst);
+    void    amd_vrba_erfbf16_f32    (int len, bf16_t *src, float *dst);
+    void    amd_vrba_sigmoidbf16    (int len, bf16_t *src, bf16_t *dst);
+    void    amd_vrba_sigmoidbf16_f32(int len, bf16_t *src, float *dst);
+
+    /* Activations, float and bfloat16 arrays */
+    void    amd_vrsa_sigmoidf       (int len, float *src, float *dst);
+    void    amd_vrsa_siluf          (int len, float *src, float *dst);
+    void    amd_vrsa_softplusf      (int len, float *src, float *dst);
+    void    amd_vrsa_geluf          (int len, float *src, float *dst);
+    void    amd_vrsa_gelu_tanhf     (int len, float *src, float *dst);
+    void    amd_vrba_silubf16       (int len, bf16_t *src, bf16_t *dst);
+    void    amd_vrba_softplusbf16   (int len, bf16_t *src, bf16_t *dst);
+    void    amd_vrba_gelubf16       (int len, bf16_t *src, bf16_t *dst);
+    void    amd_vrba_gelu_tanhbf16  (int len, bf16_t *src, bf16_t *dst);
+
+    /* Row-wise softmax of a rows x cols row-major matrix, src may equal dst */
+    void    amd_vrsa_softmaxf       (int rows, int cols, float *src, float *dst);
+    void    amd_vrba_softmaxbf16    (int rows, int cols, bf16_t *src, bf16_t *dst);
+
+    /* Finite-math-only variants (libalmfast), see amd_exp_finite() */
+    __m128d amd_vrd2_exp_finite     (__m128d x);
+    __m256d amd_vrd4_exp_finite     (__m256d x);
+    __m128  amd_vrs4_expf_finite    (__m128 x);
+    __m256  amd_vrs8_expf_finite    (__m256 x);
+    __m128d amd_vrd2_log_finite     (__m128d x);
+    __m256d amd_vrd4_log_finite     (__m256d x);
+    __m128  amd_vrs4_logf_finite    (__m128 x);
+    __m256  amd_vrs8_logf_finite    (__m256 x);
+
+    void    amd_vrda_exp_finite     (int len, double *src, double *dst);
+    void    amd_vrsa_expf_finite    (int len, float *src, float *dst);
+    void    amd_vrda_log_finite     (int len, double *src, double *dst);
+    void    amd_vrsa_logf_finite    (int len, float *src, float *dst);
+
 /* AVX512 variants */
 #if defined(__AVX512F__)
 
@@ -429,15 +720,73 @@ extern "C" {
     /* Erf */
     __m512d amd_vrd8_erf    (__m512d x);
     __m512  amd_vrs16_erff  (__m512 x);
+    __m512d amd_vrd8_erfc    (__m512d x);
+    __m512  amd_vrs16_erfcf  (__m512 x);
+    __m512d amd_vrd8_erfinv  (__m512d x);
+    __m512  amd_vrs16_erfinvf(__m512 x);
+    __m512d amd_vrd8_erfcinv (__m512d x);
+    __m512  amd_vrs16_erfcinvf(__m512 x);
+    __m512d amd_vrd8_cdfnorm (__m512d x);
+    __m512  amd_vrs16_cdfnormf(__m512 x);
+    __m512d amd_vrd8_cdfnorminv(__m512d x);
+    __m512  amd_vrs16_cdfnorminvf(__m512 x);
+    __m512d amd_vrd8_lgamma  (__m512d x);
+    __m512  amd_vrs16_lgammaf(__m512 x);
+    __m512d amd_vrd8_tgamma  (__m512d x);
+    __m512  amd_vrs16_tgammaf(__m512 x);
+    __m512d amd_vrd8_digamma (__m512d x);
+    __m512  amd_vrs16_digammaf(__m512 x);
 
     /* Sqrt */
     __m512d amd_vrd8_sqrt   (__m512d x);
     __m512  amd_vrs16_sqrtf  (__m512 x);
 
+    /* Reciprocal roots */
+    __m512d amd_vrd8_rsqrt          (__m512d x);
+    __m512  amd_vrs16_rsqrtf        (__m512 x);
+    __m512d amd_vrd8_rsqrt_approx   (__m512d x);
+    __m512  amd_vrs16_rsqrtf_approx (__m512 x);
+    __m512d amd_vrd8_invcbrt        (__m512d x);
+    __m512  amd_vrs16_invcbrtf      (__m512 x);
+    __m512d amd_vrd8_rhypot         (__m512d x, __m512d y);
+    __m512  amd_vrs16_rhypotf       (__m512 x, __m512 y);
+
     /* Linearfrac */
      __m512d amd_vrd8_linearfrac   (__m512d x, __m512d y, double, double, double, double);
      __m512  amd_vrs16_linearfracf (__m512 x, __m512 y, float, float, float, float);
 
+    /* Frexp, Ldexp, Scalbn, Ilogb, Logb */
+    __m512d amd_vrd8_frexp    (__m512d x, __m512i *e);
+    __m512d amd_vrd8_ldexp    (__m512d x, __m512i n);
+    __m512d amd_vrd8_scalbn   (__m512d x, __m512i n);
+    __m512i amd_vrd8_ilogb    (__m512d x);
+    __m512d amd_vrd8_logb     (__m512d x);
+
+    __m512  amd_vrs16_frexpf  (__m512 x, __m512i *e);
+    __m512  amd_vrs16_ldexpf  (__m512 x, __m512i n);
+    __m512  amd_vrs16_scalbnf (__m512 x, __m512i n);
+    __m512i amd_vrs16_ilogbf  (__m512 x);
+    __m512  amd_vrs16_logbf   (__m512 x);
+
+    /* Complex */
+    void    amd_vrz8_cexp     (__m512d re, __m512d im, __m512d *rre, __m512d *rim);
+    void    amd_vrz8_clog     (__m512d re, __m512d im, __m512d *rre, __m512d *rim);
+    void    amd_vrz8_cpow     (__m512d xre, __m512d xim, __m512d yre, __m512d yim, __m512d *rre, __m512d *rim);
+
+    void    amd_vrc16_cexpf   (__m512 re, __m512 im, __m512 *rre, __m512 *rim);
+    void    amd_vrc16_clogf   (__m512 re, __m512 im, __m512 *rre, __m512 *rim);
+    void    amd_vrc16_cpowf   (__m512 xre, __m512 xim, __m512 yre, __m512 yim, __m512 *rre, __m512 *rim);
+
+    /* Half precision */
+    __m512i amd_vrh32_expf16     (__m512i x);
+    __m512i amd_vrh32_logf16     (__m512i x);
+    __m512i amd_vrh32_sinf16     (__m512i x);
+    __m512i amd_vrh32_cosf16     (__m512i x);
+    __m512i amd_vrh32_tanhf16    (__m512i x);
+    __m512i amd_vrh32_erff16     (__m512i x);
+    __m512i amd_vrh32_sqrtf16    (__m512i x);
+    __m512i amd_vrh32_powf16     (__m512i x, __m512i y);
+
 #endif
 
 #ifdef __cplusplus
@@ -88,11 +88,23 @@ extern double    ALM_PROTO_INTERNAL(sin)                  (double x);
 extern double    ALM_PROTO_INTERNAL(sinh)                 (double x);
 extern double    ALM_PROTO_INTERNAL(sinpi)                (double x);
 extern double    ALM_PROTO_INTERNAL(sqrt)                 (double x);
+extern double    ALM_PROTO_INTERNAL(rsqrt)                (double x);
+extern double    ALM_PROTO_INTERNAL(rsqrt_approx)         (double x);
+extern double    ALM_PROTO_INTERNAL(invcbrt)              (double x);
+extern double    ALM_PROTO_INTERNAL(rhypot)               (double x, double y);
 extern double    ALM_PROTO_INTERNAL(tan)                  (double x);
 extern double    ALM_PROTO_INTERNAL(tanh)                 (double x);
 extern double    ALM_PROTO_INTERNAL(tanpi)                (double x);
 extern double    ALM_PROTO_INTERNAL(trunc)                (double x);
 extern double    ALM_PROTO_INTERNAL(erf)                  (double x);
+extern double    ALM_PROTO_INTERNAL(erfc)                 (double x);
+extern double    ALM_PROTO_INTERNAL(erfinv)               (double x);
+extern double    ALM_PROTO_INTERNAL(erfcinv)              (double x);
+extern double    ALM_PROTO_INTERNAL(cdfnorm)              (double x);
+extern double    ALM_PROTO_INTERNAL(cdfnorminv)           (double x);
+extern double    ALM_PROTO_INTERNAL(lgamma)               (double x);
+extern double    ALM_PROTO_INTERNAL(tgamma)               (double x);
+extern double    ALM_PROTO_INTERNAL(digamma)              (double x);
 extern void      ALM_PROTO_INTERNAL(sincos)               (double x, double *s, double *c);
 /*
  * Single Precision functions
@@ -145,11 +157,23 @@ extern float     ALM_PROTO_INTERNAL(sinf)                 (float x);
 extern float     ALM_PROTO_INTERNAL(sinhf)                (float x);
 extern float     ALM_PROTO_INTERNAL(sinpif)               (float x);
 extern float     ALM_PROTO_INTERNAL(sqrtf)                (float x);
+extern float     ALM_PROTO_INTERNAL(rsqrtf)               (float x);
+extern float     ALM_PROTO_INTERNAL(rsqrtf_approx)        (float x);
+extern float     ALM_PROTO_INTERNAL(invcbrtf)             (float x);
+extern float     ALM_PROTO_INTERNAL(rhypotf)              (float x, float y);
 extern float     ALM_PROTO_INTERNAL(tanf)                 (float x);
 extern float     ALM_PROTO_INTERNAL(tanhf)                (float x);
 extern float     ALM_PROTO_INTERNAL(tanpif)               (float x);
 extern float     ALM_PROTO_INTERNAL(truncf)               (float x);
 extern float     ALM_PROTO_INTERNAL(erff)                 (float x);
+extern float     ALM_PROTO_INTERNAL(erfcf)                (float x);
+extern float     ALM_PROTO_INTERNAL(erfinvf)              (float x);
+extern float     ALM_PROTO_INTERNAL(erfcinvf)             (float x);
+extern float     ALM_PROTO_INTERNAL(cdfnormf)             (float x);
+extern float     ALM_PROTO_INTERNAL(cdfnorminvf)          (float x);
+extern float     ALM_PROTO_INTERNAL(lgammaf)              (float x);
+extern float     ALM_PROTO_INTERNAL(tgammaf)              (float x);
+extern float     ALM_PROTO_INTERNAL(digammaf)             (float x);
 extern void      ALM_PROTO_INTERNAL(sincosf)              (float x, float *s, float *c);
 /*
  * Integer variants
@@ -175,6 +199,80 @@ extern fc64_t   ALM_PROTO_INTERNAL(clog)          (fc64_t f);
 extern fc32_t   ALM_PROTO_INTERNAL(clogf)         (fc32_t f);
 extern fc64_t   ALM_PROTO_INTERNAL(cpow)          (fc64_t x, fc64_t y);
 extern fc32_t   ALM_PROTO_INTERNAL(cpowf)         (fc32_t x, fc32_t y);
+extern fc64_t   ALM_PROTO_INTERNAL(csin)          (fc64_t z);
+extern fc32_t   ALM_PROTO_INTERNAL(csinf)         (fc32_t z);
+extern fc64_t   ALM_PROTO_INTERNAL(ccos)          (fc64_t z);
+extern fc32_t   ALM_PROTO_INTERNAL(ccosf)         (fc32_t z);
+extern fc64_t   ALM_PROTO_INTERNAL(ctan)          (fc64_t z);
+extern fc32_t   ALM_PROTO_INTERNAL(ctanf)         (fc32_t z);
+extern fc64_t   ALM_PROTO_INTERNAL(csqrt)         (fc64_t z);
+extern fc32_t   ALM_PROTO_INTERNAL(csqrtf)        (fc32_t z);
+extern double   ALM_PROTO_INTERNAL(cabs)          (fc64_t z);
+extern float    ALM_PROTO_INTERNAL(cabsf)         (fc32_t z);
+extern double   ALM_PROTO_INTERNAL(carg)          (fc64_t z);
+extern float    ALM_PROTO_INTERNAL(cargf)         (fc32_t z);
+/*
+ * Half precision variants, IEEE binary16 bit patterns held in f16_t
+ */
+extern f16_t    ALM_PROTO_INTERNAL(expf16)           (f16_t x);
+extern f16_t    ALM_PROTO_INTERNAL(logf16)           (f16_t x);
+extern f16_t    ALM_PROTO_INTERNAL(sinf16)           (f16_t x);
+extern f16_t    ALM_PROTO_INTERNAL(cosf16)           (f16_t x);
+extern f16_t    ALM_PROTO_INTERNAL(tanhf16)          (f16_t x);
+extern f16_t    ALM_PROTO_INTERNAL(erff16)           (f16_t x);
+extern f16_t    ALM_PROTO_INTERNAL(sqrtf16)          (f16_t x);
+extern f16_t    ALM_PROTO_INTERNAL(powf16)           (f16_t x, f16_t y);
+extern __m128i  ALM_PROTO_INTERNAL(vrh8_expf16)      (__m128i x);
+extern __m128i  ALM_PROTO_INTERNAL(vrh8_logf16)      (__m128i x);
+extern __m128i  ALM_PROTO_INTERNAL(vrh8_sinf16)      (__m128i x);
+extern __m128i  ALM_PROTO_INTERNAL(vrh8_cosf16)      (__m128i x);
+extern __m128i  ALM_PROTO_INTERNAL(vrh8_tanhf16)     (__m128i x);
+extern __m128i  ALM_PROTO_INTERNAL(vrh8_erff16)      (__m128i x);
+extern __m128i  ALM_PROTO_INTERNAL(vrh8_sqrtf16)     (__m128i x);
+extern __m128i  ALM_PROTO_INTERNAL(vrh8_powf16)      (__m128i x, __m128i y);
+extern __m256i  ALM_PROTO_INTERNAL(vrh16_expf16)     (__m256i x);
+extern __m256i  ALM_PROTO_INTERNAL(vrh16_logf16)     (__m256i x);
+extern __m256i  ALM_PROTO_INTERNAL(vrh16_sinf16)     (__m256i x);
+extern __m256i  ALM_PROTO_INTERNAL(vrh16_cosf16)     (__m256i x);
+extern __m256i  ALM_PROTO_INTERNAL(vrh16_tanhf16)    (__m256i x);
+extern __m256i  ALM_PROTO_INTERNAL(vrh16_erff16)     (__m256i x);
+extern __m256i  ALM_PROTO_INTERNAL(vrh16_sqrtf16)    (__m256i x);
+extern __m256i  ALM_PROTO_INTERNAL(vrh16_powf16)     (__m256i x, __m256i y);
+extern __m512i  ALM_PROTO_INTERNAL(vrh32_expf16)     (__m512i x);
+extern __m512i  ALM_PROTO_INTERNAL(vrh32_logf16)     (__m512i x);
+extern __m512i  ALM_PROTO_INTERNAL(vrh32_sinf16)     (__m512i x);
+extern __m512i  ALM_PROTO_INTERNAL(vrh32_cosf16)     (__m512i x);
+extern __m512i  ALM_PROTO_INTERNAL(vrh32_tanhf16)    (__m512i x);
+extern __m512i  ALM_PROTO_INTERNAL(vrh32_erff16)     (__m512i x);
+extern __m512i  ALM_PROTO_INTERNAL(vrh32_sqrtf16)    (__m512i x);
+extern __m512i  ALM_PROTO_INTERNAL(vrh32_powf16)     (__m512i x, __m512i y);
+extern void     ALM_PROTO_INTERNAL(vrha_expf16)      (int n, f16_t *x, f16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrha_logf16)      (int n, f16_t *x, f16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrha_sinf16)      (int n, f16_t *x, f16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrha_cosf16)      (int n, f16_t *x, f16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrha_tanhf16)     (int n, f16_t *x, f16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrha_erff16)      (int n, f16_t *x, f16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrha_sqrtf16)     (int n, f16_t *x, f16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrha_powf16)      (int n, f16_t *x, f16_t *y, f16_t *z);
+
+/*
+ * bfloat16 array variants, bf16_t in and bf16_t or float out
+ */
+extern void     ALM_PROTO_INTERNAL(vrba_expbf16)        (int n, bf16_t *x, bf16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrba_expbf16_f32)    (int n, bf16_t *x, float *y);
+extern void     ALM_PROTO_INTERNAL(vrba_logbf16)        (int n, bf16_t *x, bf16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrba_logbf16_f32)    (int n, bf16_t *x, float *y);
+extern void     ALM_PROTO_INTERNAL(vrba_tanhbf16)       (int n, bf16_t *x, bf16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrba_tanhbf16_f32)   (int n, bf16_t *x, float *y);
+extern void     ALM_PROTO_INTERNAL(vrba_erfbf16)        (int n, bf16_t *x, bf16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrba_erfbf16_f32)    (int n, bf16_t *x, float *y);
+extern void     ALM_PROTO_INTERNAL(vrba_sigmoidbf16)    (int n, bf16_t *x, bf16_t *y);
+extern void     ALM_PROTO_INTERNAL(vrba_sigmoidbf16_f32) (int n, bf16_t *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrba_silubf16) (int n, bf16_t *x, bf16_t *y);
+extern void      ALM_PROTO_INTERNAL(vrba_softplusbf16) (int n, bf16_t *x, bf16_t *y);
+extern void      ALM_PROTO_INTERNAL(vrba_gelubf16) (int n, bf16_t *x, bf16_t *y);
+extern void      ALM_PROTO_INTERNAL(vrba_gelu_tanhbf16) (int n, bf16_t *x, bf16_t *y);
+extern void      ALM_PROTO_INTERNAL(vrba_softmaxbf16) (int rows, int cols, bf16_t *x, bf16_t *y);
 #include <immintrin.h>
 /*
  * Vector Single precision
@@ -203,6 +301,15 @@ extern __m128    ALM_PROTO_INTERNAL(vrs4_fabsf)           (__m128 x);
 extern __m128    ALM_PROTO_INTERNAL(vrs4_sqrtf)           (__m128 x);
 extern __m128    ALM_PROTO_INTERNAL(vrs4_linearfracf)     (__m128 x, __m128 y, float sca, float sha, float scb, float shb);
 extern void      ALM_PROTO_INTERNAL(vrs4_sincosf)         (__m128 x, __m128 *sin, __m128 *cos);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_erfcf)    (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_erfinvf)  (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_erfcinvf) (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_cdfnormf) (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_cdfnorminvf) (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_rsqrtf)      (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_rsqrtf_approx) (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_invcbrtf)    (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_rhypotf)     (__m128 x, __m128 y);
 /*
  * Vector Single precision, 8 elements
  */
@@ -230,6 +337,31 @@ extern __m256    ALM_PROTO_INTERNAL(vrs8_fabsf)           (__m256 x);
 extern __m256    ALM_PROTO_INTERNAL(vrs8_sqrtf)           (__m256 x);
 extern __m256    ALM_PROTO_INTERNAL(vrs8_linearfracf)     (__m256 x, __m256 y, float sca, float sha, float scb, float shb);
 extern void      ALM_PROTO_INTERNAL(vrs8_sincosf)         (__m256 x, __m256 *sin, __m256 *cos);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_frexpf)   (__m256 x, __m256i *e);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_ldexpf)   (__m256 x, __m256i n);
+extern __m256i   ALM_PROTO_INTERNAL(vrs8_ilogbf)   (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_logbf)    (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_erfcf)    (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_erfinvf)  (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_erfcinvf) (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_cdfnormf) (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_cdfnorminvf) (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_lgammaf)     (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_tgammaf)     (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_digammaf)    (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_rsqrtf)      (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_rsqrtf_approx) (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_invcbrtf)    (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_rhypotf)     (__m256 x, __m256 y);
+extern void      ALM_PROTO_INTERNAL(vrc8_cexpf)    (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+extern void      ALM_PROTO_INTERNAL(vrc8_clogf)    (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+extern void      ALM_PROTO_INTERNAL(vrc8_cpowf)    (__m256 xr, __m256 xi, __m256 yr, __m256 yi, __m256 *rr, __m256 *ri);
+extern void      ALM_PROTO_INTERNAL(vrc8_csinf)    (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+extern void      ALM_PROTO_INTERNAL(vrc8_ccosf)    (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+extern void      ALM_PROTO_INTERNAL(vrc8_ctanf)    (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+extern void      ALM_PROTO_INTERNAL(vrc8_csqrtf)   (__m256 re, __m256 im, __m256 *rre, __m256 *rim);
+extern __m256    ALM_PROTO_INTERNAL(vrc8_cabsf)    (__m256 re, __m256 im);
+extern __m256    ALM_PROTO_INTERNAL(vrc8_cargf)    (__m256 re, __m256 im);
 /*
  * Vector Single precision, 16 elements
  */
@@ -256,6 +388,25 @@ extern __m512    ALM_PROTO_INTERNAL(vrs16_erff)            (__m512 x);
 extern __m512    ALM_PROTO_INTERNAL(vrs16_sqrtf)           (__m512 x);
 extern __m512    ALM_PROTO_INTERNAL(vrs16_linearfracf)     (__m512 x, __m512 y, float sca, float sha, float scb, float shb);
 extern void      ALM_PROTO_INTERNAL(vrs16_sincosf)         (__m512 x, __m512 *sin, __m512 *cos);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_frexpf)  (__m512 x, __m512i *e);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_ldexpf)  (__m512 x, __m512i n);
+extern __m512i   ALM_PROTO_INTERNAL(vrs16_ilogbf)  (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_logbf)   (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_erfcf)   (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_erfinvf) (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_erfcinvf) (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_cdfnormf) (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_cdfnorminvf) (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_lgammaf)     (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_tgammaf)     (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_digammaf)    (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_rsqrtf)      (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_rsqrtf_approx) (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_invcbrtf)    (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_rhypotf)     (__m512 x, __m512 y);
+extern void      ALM_PROTO_INTERNAL(vrc16_cexpf)   (__m512 re, __m512 im, __m512 *rre, __m512 *rim);
+extern void      ALM_PROTO_INTERNAL(vrc16_clogf)   (__m512 re, __m512 im, __m512 *rre, __m512 *rim);
+extern void      ALM_PROTO_INTERNAL(vrc16_cpowf)   (__m512 xr, __m512 xi, __m512 yr, __m512 yi, __m512 *rr, __m512 *ri);
 /*
  * Vector Double precision
  */
@@ -280,6 +431,15 @@ extern __m128d   ALM_PROTO_INTERNAL(vrd2_sqrt)     (__m128d);
 extern __m128d   ALM_PROTO_INTERNAL(vrd2_fabs)     (__m128d);
 extern void      ALM_PROTO_INTERNAL(vrd2_sincos)   (__m128d x, __m128d* ys, __m128d* yc);
 extern __m128d   ALM_PROTO_INTERNAL(vrd2_linearfrac) (__m128d x, __m128d y, double sca, double sha, double scb, double shb);
+extern __m128d   ALM_PROTO_INTERNAL(vrd2_erfc)     (__m128d x);
+extern __m128d   ALM_PROTO_INTERNAL(vrd2_erfinv)   (__m128d x);
+extern __m128d   ALM_PROTO_INTERNAL(vrd2_erfcinv)  (__m128d x);
+extern __m128d   ALM_PROTO_INTERNAL(vrd2_cdfnorm)  (__m128d x);
+extern __m128d   ALM_PROTO_INTERNAL(vrd2_cdfnorminv) (__m128d x);
+extern __m128d   ALM_PROTO_INTERNAL(vrd2_rsqrt)      (__m128d x);
+extern __m128d   ALM_PROTO_INTERNAL(vrd2_rsqrt_approx) (__m128d x);
+extern __m128d   ALM_PROTO_INTERNAL(vrd2_invcbrt)    (__m128d x);
+extern __m128d   ALM_PROTO_INTERNAL(vrd2_rhypot)     (__m128d x, __m128d y);
 /*
  * Vector double precision, 4 element
  */
@@ -296,6 +456,7 @@ extern __m256d   ALM_PROTO_INTERNAL(vrd4_log2)     (__m256d x);
 extern __m256d   ALM_PROTO_INTERNAL(vrd4_log)      (__m256d x);
 extern __m256d   ALM_PROTO_INTERNAL(vrd4_pow)      (__m256d x, __m256d y);
 extern __m256d   ALM_PROTO_INTERNAL(vrd4_powx)     (__m256d x, double y);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_pown)     (__m256d x, int n);
 extern __m256d   ALM_PROTO_INTERNAL(vrd4_sin)      (__m256d x);
 extern __m256d   ALM_PROTO_INTERNAL(vrd4_tan)      (__m256d x);
 extern __m256d   ALM_PROTO_INTERNAL(vrd4_atan)     (__m256d x);
@@ -304,6 +465,31 @@ extern __m256d   ALM_PROTO_INTERNAL(vrd4_sqrt)     (__m256d x);
 extern __m256d   ALM_PROTO_INTERNAL(vrd4_fabs)     (__m256d x);
 extern void      ALM_PROTO_INTERNAL(vrd4_sincos)   (__m256d x, __m256d *s, __m256d *c);
 extern __m256d   ALM_PROTO_INTERNAL(vrd4_linearfrac)  (__m256d x, __m256d y, double sca, double sha, double scb, double shb);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_frexp)    (__m256d x, __m256i *e);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_ldexp)    (__m256d x, __m256i n);
+extern __m256i   ALM_PROTO_INTERNAL(vrd4_ilogb)    (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_logb)     (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_erfc)     (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_erfinv)   (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_erfcinv)  (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_cdfnorm)  (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_cdfnorminv) (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_lgamma)     (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_tgamma)     (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_digamma)    (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_rsqrt)      (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_rsqrt_approx) (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_invcbrt)    (__m256d x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_rhypot)     (__m256d x, __m256d y);
+extern void      ALM_PROTO_INTERNAL(vrz4_cexp)     (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+extern void      ALM_PROTO_INTERNAL(vrz4_clog)     (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+extern void      ALM_PROTO_INTERNAL(vrz4_cpow)     (__m256d xr, __m256d xi, __m256d yr, __m256d yi, __m256d *rr, __m256d *ri);
+extern void      ALM_PROTO_INTERNAL(vrz4_csin)     (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+extern void      ALM_PROTO_INTERNAL(vrz4_ccos)     (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+extern void      ALM_PROTO_INTERNAL(vrz4_ctan)     (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+extern void      ALM_PROTO_INTERNAL(vrz4_csqrt)    (__m256d re, __m256d im, __m256d *rre, __m256d *rim);
+extern __m256d   ALM_PROTO_INTERNAL(vrz4_cabs)     (__m256d re, __m256d im);
+extern __m256d   ALM_PROTO_INTERNAL(vrz4_carg)     (__m256d re, __m256d im);
 /*
  * Vector double precision, 8 elements
  */
@@ -328,6 +514,25 @@ extern __m512d   ALM_PROTO_INTERNAL(vrd8_erf)      (__m512d x);
 extern __m512d   ALM_PROTO_INTERNAL(vrd8_sqrt)     (__m512d x);
 extern void      ALM_PROTO_INTERNAL(vrd8_sincos)   (__m512d x, __m512d *s, __m512d *c);
 extern __m512d   ALM_PROTO_INTERNAL(vrd8_linearfrac)  (__m512d x, __m512d y, double sca, double sha, double scb, double shb);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_frexp)    (__m512d x, __m512i *e);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_ldexp)    (__m512d x, __m512i n);
+extern __m512i   ALM_PROTO_INTERNAL(vrd8_ilogb)    (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_logb)     (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_erfc)     (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_erfinv)   (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_erfcinv)  (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_cdfnorm)  (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_cdfnorminv) (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_lgamma)     (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_tgamma)     (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_digamma)    (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_rsqrt)      (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_rsqrt_approx) (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_invcbrt)    (__m512d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_rhypot)     (__m512d x, __m512d y);
+extern void      ALM_PROTO_INTERNAL(vrz8_cexp)     (__m512d re, __m512d im, __m512d *rre, __m512d *rim);
+extern void      ALM_PROTO_INTERNAL(vrz8_clog)     (__m512d re, __m512d im, __m512d *rre, __m512d *rim);
+extern void      ALM_PROTO_INTERNAL(vrz8_cpow)     (__m512d xr, __m512d xi, __m512d yr, __m512d yi, __m512d *rr, __m512d *ri);
 
 /*
 * Vector Array versions
@@ -389,7 +594,94 @@ extern void      ALM_PROTO_INTERNAL(vrda_fmaxi)    (int len, double *lhs, int in
 extern void      ALM_PROTO_INTERNAL(vrda_fmini)    (int len, double *lhs, int inc_a, double *rhs, int inc_b, double *dst, int inc_res);
 extern void      ALM_PROTO_INTERNAL(vrda_linearfrac)(int len, double *x, double *y, double scx, double shx, double scy, double shy, double *result);
 extern void      ALM_PROTO_INTERNAL(vrsa_linearfracf)(int len, float *x, float *y, float scx, float shx, float scy, float shy, float *result);
+extern void      ALM_PROTO_INTERNAL(vrsa_frexpf)   (int n, float *x, float *m, int *e);
+extern void      ALM_PROTO_INTERNAL(vrsa_ldexpf)   (int n, float *x, int *e, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_ilogbf)   (int n, float *x, int *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_logbf)    (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_expf_affine) (int n, float *x, float a, float b, float c, float d, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_logf_affine) (int n, float *x, float a, float b, float c, float d, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_powf_affine) (int n, float *x, float *y, float a, float b, float c, float d, float *z);
+extern void      ALM_PROTO_INTERNAL(vrsa_sinf_affine) (int n, float *x, float a, float b, float c, float d, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_cosf_affine) (int n, float *x, float a, float b, float c, float d, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_tanhf_affine) (int n, float *x, float a, float b, float c, float d, float *y);
+extern float     ALM_PROTO_INTERNAL(vrsa_sumexpf)  (int n, float *x);
+extern float     ALM_PROTO_INTERNAL(vrsa_logsumexpf) (int n, float *x);
+extern float     ALM_PROTO_INTERNAL(vrsa_sumlogf)  (int n, float *x);
+extern void      ALM_PROTO_INTERNAL(vrsa_sigmoidf) (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_siluf)    (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_softplusf) (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_geluf)    (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_gelu_tanhf) (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_softmaxf) (int rows, int cols, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_cisf)     (int n, float *theta, fc32_t *z);
+extern void      ALM_PROTO_INTERNAL(vrsa_polarf)   (int n, float *r, float *theta, fc32_t *z);
+extern void      ALM_PROTO_INTERNAL(vrsa_boxmullerf) (int n, float *u1, float *u2, float *z0, float *z1);
+extern void      ALM_PROTO_INTERNAL(vrsa_erfcf)    (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_erfinvf)  (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_erfcinvf) (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_cdfnormf) (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_cdfnorminvf) (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_lgammaf)     (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_tgammaf)     (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_digammaf)    (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_rsqrtf)      (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_rsqrtf_approx) (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_invcbrtf)    (int n, float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_rhypotf)     (int n, float *x, float *y, float *z);
+extern void      ALM_PROTO_INTERNAL(vrca_cexpf)    (int n, fc32_t *x, fc32_t *y);
+extern void      ALM_PROTO_INTERNAL(vrca_clogf)    (int n, fc32_t *x, fc32_t *y);
+extern void      ALM_PROTO_INTERNAL(vrca_cpowf)    (int n, fc32_t *x, fc32_t *y, fc32_t *z);
+extern void      ALM_PROTO_INTERNAL(vrca_csinf)    (int n, fc32_t *x, fc32_t *y);
+extern void      ALM_PROTO_INTERNAL(vrca_ccosf)    (int n, fc32_t *x, fc32_t *y);
+extern void      ALM_PROTO_INTERNAL(vrca_ctanf)    (int n, fc32_t *x, fc32_t *y);
+extern void      ALM_PROTO_INTERNAL(vrca_csqrtf)   (int n, fc32_t *x, fc32_t *y);
+extern void      ALM_PROTO_INTERNAL(vrca_cabsf)    (int n, fc32_t *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_cargf)    (int n, fc32_t *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_cexpf_soa) (int n, float *xr, float *xi, float *yr, float *yi);
+extern void      ALM_PROTO_INTERNAL(vrca_clogf_soa) (int n, float *xr, float *xi, float *yr, float *yi);
+extern void      ALM_PROTO_INTERNAL(vrca_cpowf_soa) (int n, float *xr, float *xi, float *yr, float *yi, float *zr, float *zi);
 extern void      ALM_PROTO_INTERNAL(vrda_powx)     (int n, double *s1, double s2, double* d);
+extern void      ALM_PROTO_INTERNAL(vrda_pown)     (int n, double *s1, int s2, double* d);
+extern void      ALM_PROTO_INTERNAL(vrda_rootn)    (int n, double *s1, int s2, double* d);
+extern void      ALM_PROTO_INTERNAL(vrda_frexp)    (int n, double *x, double *m, int *e);
+extern void      ALM_PROTO_INTERNAL(vrda_ldexp)    (int n, double *x, int *e, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_ilogb)    (int n, double *x, int *y);
+extern void      ALM_PROTO_INTERNAL(vrda_logb)     (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_exp_affine) (int n, double *x, double a, double b, double c, double d, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_log_affine) (int n, double *x, double a, double b, double c, double d, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_pow_affine) (int n, double *x, double *y, double a, double b, double c, double d, double *z);
+extern void      ALM_PROTO_INTERNAL(vrda_sin_affine) (int n, double *x, double a, double b, double c, double d, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_cos_affine) (int n, double *x, double a, double b, double c, double d, double *y);
+extern double    ALM_PROTO_INTERNAL(vrda_sumexp)   (int n, double *x);
+extern double    ALM_PROTO_INTERNAL(vrda_logsumexp) (int n, double *x);
+extern double    ALM_PROTO_INTERNAL(vrda_sumlog)   (int n, double *x);
+extern void      ALM_PROTO_INTERNAL(vrda_cis)      (int n, double *theta, fc64_t *z);
+extern void      ALM_PROTO_INTERNAL(vrda_polar)    (int n, double *r, double *theta, fc64_t *z);
+extern void      ALM_PROTO_INTERNAL(vrda_boxmuller) (int n, double *u1, double *u2, double *z0, double *z1);
+extern void      ALM_PROTO_INTERNAL(vrda_cdfnorminv) (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_erfc)     (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_erfinv)   (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_erfcinv)  (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_cdfnorm)  (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_lgamma)   (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_tgamma)   (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_digamma)  (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_rsqrt)    (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_rsqrt_approx) (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_invcbrt)  (int n, double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_rhypot)   (int n, double *x, double *y, double *z);
+extern void      ALM_PROTO_INTERNAL(vrza_cexp)     (int n, fc64_t *x, fc64_t *y);
+extern void      ALM_PROTO_INTERNAL(vrza_clog)     (int n, fc64_t *x, fc64_t *y);
+extern void      ALM_PROTO_INTERNAL(vrza_cpow)     (int n, fc64_t *x, fc64_t *y, fc64_t *z);
+extern void      ALM_PROTO_INTERNAL(vrza_csin)     (int n, fc64_t *x, fc64_t *y);
+extern void      ALM_PROTO_INTERNAL(vrza_ccos)     (int n, fc64_t *x, fc64_t *y);
+extern void      ALM_PROTO_INTERNAL(vrza_ctan)     (int n, fc64_t *x, fc64_t *y);
+extern void      ALM_PROTO_INTERNAL(vrza_csqrt)    (int n, fc64_t *x, fc64_t *y);
+extern void      ALM_PROTO_INTERNAL(vrza_cabs)     (int n, fc64_t *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_carg)     (int n, fc64_t *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_cexp_soa) (int n, double *xr, double *xi, double *yr, double *yi);
+extern void      ALM_PROTO_INTERNAL(vrza_clog_soa) (int n, double *xr, double *xi, double *yr, double *yi);
+extern void      ALM_PROTO_INTERNAL(vrza_cpow_soa) (int n, double *xr, double *xi, double *yr, double *yi, double *zr, double *zi);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Activation functions for the float and bfloat16 array kernels, composed
+ * in registers from the vrs8 (and on AVX-512 the vrs16) exp, log and erf
+ * kernels. Each helper evaluates one register, the array kernels only
+ * load, call and store.
+ *
+ *   sigmoid(x)    = 1 / (1 + exp(-x))
+ *   silu(x)       = x * sigmoid(x)
+ *   softplus(x)   = log(1 + exp(x)) = max(x, 0) + log1p(exp(-|x|))
+ *   gelu(x)       = x / 2 * (1 + erf(x / sqrt(2)))
+ *   gelu_tanh(x)  = x / 2 * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 x^3)))
+ *                 = x * sigmoid(2 * sqrt(2 / pi) * (x + 0.044715 x^3))
+ *
+ * The tanh form of gelu uses 1 + tanh(u) = 2 * sigmoid(2u), which avoids
+ * the cancellation of 1 + tanh(u) for negative u. The erf form is
+ * x / 2 * (1 + erf) rather than x / 2 + x / 2 * erf, which gives +0 for
+ * x = -0.
+ *
+ * Below x = -1 both forms of gelu are evaluated in double for the lanes
+ * that need it: the erf form as x / 2 * erfc(-x / sqrt(2)), with erfc
+ * from a fit of erfc(z) * exp(z^2), and the tanh form with the cubic
+ * argument in double, whose rounding in float is amplified by exp.
+ *
+ * Below x = -80 the sigmoid is denormal and has lost precision while
+ * x * sigmoid(x) is still normal, silu evaluates x * exp(x) in double
+ * for those lanes.
+ *
+ * The v16 variants expect an arch header included with ALM_OVERRIDE so
+ * that ALM_PROTO_ARCH() names the zen4/zen5 vrs16 kernels.
+ */
+
+#ifndef __LIBM_ACTIVATION_VEC_H__
+#define __LIBM_ACTIVATION_VEC_H__
+
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <immintrin.h>
+
+#define ACT_SQRT1_2         0x1.6a09e6p-1f      /* 1 / sqrt(2) */
+#define ACT_GELU_TANH_C0    0x1.988454p+0f      /* 2 * sqrt(2 / pi) */
+#define ACT_GELU_TANH_C1    0x1.2444f2p-4f      /* 2 * sqrt(2 / pi) * 0.044715 */
+#define ACT_GELU_NEG        (-1.0f)             /* double precision path below */
+#define ACT_SILU_NEG        (-80.0f)            /* double precision path below */
+
+/*
+ * x / 2 * erfc(-x / sqrt(2)) for x < 0, erfc(z) = t * exp(-z^2 + P(t))
+ * with t = 1 / (1 + z / 2), fractional error below 1.2e-7 (Numerical
+ * Recipes, erfcc)
+ */
+#define ACT_ERFC_P(t)                                                       \
+    (-1.26551223 + (t) * (1.00002368 + (t) * (0.37409196 + (t) *            \
+    (0.09678418 + (t) * (-0.18628806 + (t) * (0.27886807 + (t) *            \
+    (-1.13520398 + (t) * (1.48851587 + (t) * (-0.82215223 + (t) *           \
+    0.17087277)))))))))
+
+#define ACT_GELU_NEG_D(x, vexp) ({                                          \
+        __typeof__(x) _z = (x) * -0x1.6a09e667f3bcdp-1;                      \
+        __typeof__(x) _t = 1.0 / (1.0 + 0.5 * _z);                          \
+        0.5 * (x) * _t * vexp(ACT_ERFC_P(_t) - _z * _z);                    \
+    })
+
+/* x * sigmoid(x) for x < -80, where 1 + exp(x) rounds to 1 */
+#define ACT_SILU_NEG_D(x, vexp)     ((x) * vexp(x))
+
+/* x * sigmoid(u), u = 2 * sqrt(2 / pi) * (x + 0.044715 x^3), for x < 0 */
+#define ACT_GELU_TANH_NEG_D(x, vexp) ({                                     \
+        __typeof__(x) _u = (x) * (0x1.9884533d43651p+0 +                    \
+                                  0x1.2444f2a4d8b4bp-4 * ((x) * (x)));      \
+        (x) / (1.0 + vexp(-_u));                                            \
+    })
+
+/*
+ * 1 / (1 + exp(-x)), evaluated from e = exp(-|x|) as 1 / (1 + e) for
+ * x >= 0 and e / (1 + e) for x < 0, so that exp never overflows and
+ * results close to zero keep their precision
+ */
+static inline v_f32x8_t
+act_sigmoid_v8(v_f32x8_t x)
+{
+    v_f32x8_t e = ALM_PROTO(vrs8_expf)(as_v8_f32_u32(as_v8_u32_f32(x) | SIGNBIT_SP32));
+    v_f32x8_t r = 1.0f / (1.0f + e);
+
+    return sel_v8_f32((v_u32x8_t)(x < 0.0f), e * r, r);
+}
+
+/* Lanes of x below lim, others set to lim */
+static inline v_u32x8_t
+act_below_v8(v_f32x8_t x, float lim, v_f32x8_t *xn)
+{
+    v_u32x8_t neg = (v_u32x8_t)(x < lim);
+
+    *xn = sel_v8_f32(neg, x, (v_f32x8_t){} + lim);
+
+    return neg;
+}
+
+/* Evaluates the double precision expression f on both halves of xn */
+#define ACT_V8_VIA_F64(f, xn) ({                                            \
+        v_f64x4_t _lo = _mm256_cvtps_pd(_mm256_castps256_ps128(xn));        \
+        v_f64x4_t _hi = _mm256_cvtps_pd(_mm256_extractf128_ps(xn, 1));      \
+        _lo = f(_lo, ALM_PROTO(vrd4_exp));                                  \
+        _hi = f(_hi, ALM_PROTO(vrd4_exp));                                  \
+        _mm256_set_m128(_mm256_cvtpd_ps(_hi), _mm256_cvtpd_ps(_lo));        \
+    })
+
+static inline v_f32x8_t
+act_silu_v8(v_f32x8_t x)
+{
+    v_f32x8_t r = x * act_sigmoid_v8(x);
+    v_f32x8_t xn;
+    v_u32x8_t neg = act_below_v8(x, ACT_SILU_NEG, &xn);
+
+    if (unlikely(_mm256_movemask_ps(as_v8_f32_u32(neg))))
+        r = sel_v8_f32(neg, ACT_V8_VIA_F64(ACT_SILU_NEG_D, xn), r);
+
+    return r;
+}
+
+/*
+ * log1p(e) for e = exp(-|x|) in [0, 1] is log(u) * e / (u - 1) with
+ * u = 1 + e, which cancels the rounding error of u, and e where u
+ * rounds to 1
+ */
+static inline v_f32x8_t
+act_softplus_v8(v_f32x8_t x)
+{
+    v_f32x8_t e = ALM_PROTO(vrs8_expf)(as_v8_f32_u32(as_v8_u32_f32(x) | SIGNBIT_SP32));
+    v_f32x8_t u = 1.0f + e;
+    v_f32x8_t l = ALM_PROTO(vrs8_logf)(u) * (e / (u - 1.0f));
+
+    l = sel_v8_f32((v_u32x8_t)(u == 1.0f), e, l);
+
+    return sel_v8_f32((v_u32x8_t)(x > 0.0f), x + l, l);
+}
+
+static inline v_f32x8_t
+act_gelu_v8(v_f32x8_t x)
+{
+    v_f32x8_t h = 0.5f * x;
+    v_f32x8_t r = h * (1.0f + ALM_PROTO(vrs8_erff)(x * ACT_SQRT1_2));
+    v_f32x8_t xn;
+    v_u32x8_t neg = act_below_v8(x, ACT_GELU_NEG, &xn);
+
+    if (unlikely(_mm256_movemask_ps(as_v8_f32_u32(neg))))
+        r = sel_v8_f32(neg, ACT_V8_VIA_F64(ACT_GELU_NEG_D, xn), r);
+
+    return r;
+}
+
+static inline v_f32x8_t
+act_gelu_tanh_v8(v_f32x8_t x)
+{
+    v_f32x8_t u = x * (ACT_GELU_TANH_C0 + ACT_GELU_TANH_C1 * (x * x));
+    v_f32x8_t r = x * act_sigmoid_v8(u);
+    v_f32x8_t xn;
+    v_u32x8_t neg = act_below_v8(x, ACT_GELU_NEG, &xn);
+
+    if (unlikely(_mm256_movemask_ps(as_v8_f32_u32(neg))))
+        r = sel_v8_f32(neg, ACT_V8_VIA_F64(ACT_GELU_TANH_NEG_D, xn), r);
+
+    return r;
+}
+
+#if defined(__AVX512F__)
+static inline v_f32x16_t
+act_sigmoid_v16(v_f32x16_t x)
+{
+    v_f32x16_t e = ALM_PROTO_ARCH(vrs16_expf)(as_v16_f32_u32(as_v16_u32_f32(x) | SIGNBIT_SP32));
+    v_f32x16_t r = 1.0f / (1.0f + e);
+
+    return sel_v16_f32((v_u32x16_t)(x < 0.0f), e * r, r);
+}
+
+/* Lanes of x below lim, others set to lim */
+static inline __mmask16
+act_below_v16(v_f32x16_t x, float lim, v_f32x16_t *xn)
+{
+    __mmask16 neg = _mm512_cmp_ps_mask(x, _mm512_set1_ps(lim), _CMP_LT_OQ);
+
+    *xn = _mm512_mask_blend_ps(neg, _mm512_set1_ps(lim), x);
+
+    return neg;
+}
+
+/* Evaluates the double precision expression f on both halves of xn */
+#define ACT_V16_VIA_F64(f, xn) ({                                           \
+        v_f64x8_t _lo = _mm512_cvtps_pd(_mm512_castps512_ps256(xn));        \
+        v_f64x8_t _hi = _mm512_cvtps_pd(_mm256_castpd_ps(                   \
+                            _mm512_extractf64x4_pd(_mm512_castps_pd(xn), 1))); \
+        _lo = f(_lo, ALM_PROTO_ARCH(vrd8_exp));                             \
+        _hi = f(_hi, ALM_PROTO_ARCH(vrd8_exp));                             \
+        _mm512_castpd_ps(_mm512_insertf64x4(                                \
+            _mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(_lo))), \
+            _mm256_castps_pd(_mm512_cvtpd_ps(_hi)), 1));                    \
+    })
+
+static inline v_f32x16_t
+act_silu_v16(v_f32x16_t x)
+{
+    v_f32x16_t r = x * act_sigmoid_v16(x);
+    v_f32x16_t xn;
+    __mmask16  neg = act_below_v16(x, ACT_SILU_NEG, &xn);
+
+    if (unlikely(neg))
+        r = _mm512_mask_blend_ps(neg, r, ACT_V16_VIA_F64(ACT_SILU_NEG_D, xn));
+
+    return r;
+}
+
+static inline v_f32x16_t
+act_softplus_v16(v_f32x16_t x)
+{
+    v_f32x16_t e = ALM_PROTO_ARCH(vrs16_expf)(as_v16_f32_u32(as_v16_u32_f32(x) | SIGNBIT_SP32));
+    v_f32x16_t u = 1.0f + e;
+    v_f32x16_t l = ALM_PROTO_ARCH(vrs16_logf)(u) * (e / (u - 1.0f));
+
+    l = sel_v16_f32((v_u32x16_t)(u == 1.0f), e, l);
+
+    return sel_v16_f32((v_u32x16_t)(x > 0.0f), x + l, l);
+}
+
+static inline v_f32x16_t
+act_gelu_v16(v_f32x16_t x)
+{
+    v_f32x16_t h = 0.5f * x;
+    v_f32x16_t r = h * (1.0f + ALM_PROTO_ARCH(vrs16_erff)(x * ACT_SQRT1_2));
+    v_f32x16_t xn;
+    __mmask16  neg = act_below_v16(x, ACT_GELU_NEG, &xn);
+
+    if (unlikely(neg))
+        r = _mm512_mask_blend_ps(neg, r, ACT_V16_VIA_F64(ACT_GELU_NEG_D, xn));
+
+    return r;
+}
+
+static inline v_f32x16_t
+act_gelu_tanh_v16(v_f32x16_t x)
+{
+    v_f32x16_t u = x * (ACT_GELU_TANH_C0 + ACT_GELU_TANH_C1 * (x * x));
+    v_f32x16_t r = x * act_sigmoid_v16(u);
+    v_f32x16_t xn;
+    __mmask16  neg = act_below_v16(x, ACT_GELU_NEG, &xn);
+
+    if (unlikely(neg))
+        r = _mm512_mask_blend_ps(neg, r, ACT_V16_VIA_F64(ACT_GELU_TANH_NEG_D, xn));
+
+    return r;
+}
+#endif  /* __AVX512F__ */
+
+#endif  /* __LIBM_ACTIVATION_VEC_H__ */
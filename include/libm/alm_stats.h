@@ -0,0 +1,101 @@
+
+/*
+ * Copyright (C) 2008-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __LIBM_ALM_STATS_H__
+#define __LIBM_ALM_STATS_H__
+
+/*
+ * Slow-path instrumentation, built only with -DALM_STATS (scons
+ * use_stats=1, cmake -DALM_STATS=ON). Without it every hook below is
+ * an empty statement.
+ *
+ * A site is a static counter slot, named after the kernel source file
+ * for the vector checks and after the special handler for the scalar
+ * ones. Counters are per thread and summed by amd_libm_stats_get().
+ */
+
+#include <stdint.h>
+
+enum {
+    ALM_STATS_CHECKS,                   /* slow-path condition tested */
+    ALM_STATS_SLOW_CALLS,               /* ... and taken */
+    ALM_STATS_SLOW_LANES,               /* lanes recomputed in scalar */
+    ALM_STATS_SPECIAL,                  /* alm_*_special() hits */
+    ALM_STATS_NCOUNTERS,
+};
+
+struct alm_stats_site {
+    const char *name;
+    int         id;                     /* -1 until first use */
+};
+
+#if defined(ALM_STATS)
+
+/* File being compiled, not the header the hook is expanded in */
+#if defined(__GNUC__) || defined(__clang__)
+#define ALM_STATS_TU    __BASE_FILE__
+#else
+#define ALM_STATS_TU    __FILE__
+#endif
+
+void alm_stats_add(struct alm_stats_site *site, int counter, uint64_t n);
+
+#define ALM_STATS_ADD(name, counter, n)                                 \
+    do {                                                                \
+        static struct alm_stats_site __alm_stats_site = {(name), -1};   \
+        alm_stats_add(&__alm_stats_site, (counter), (n));               \
+    } while (0)
+
+/*
+ * One vector condition check: 'any' is its result and 'cond' the
+ * 'n'-lane mask it was computed from.
+ */
+#define ALM_STATS_CHECK(any, cond, n)                                   \
+    do {                                                                \
+        static struct alm_stats_site __alm_stats_site = {ALM_STATS_TU, -1}; \
+        alm_stats_add(&__alm_stats_site, ALM_STATS_CHECKS, 1);          \
+        if (any) {                                                      \
+            uint64_t __alm_stats_lanes = 0;                             \
+            for (int __i = 0; __i < (n); __i++)                         \
+                __alm_stats_lanes += (cond)[__i] != 0;                  \
+            alm_stats_add(&__alm_stats_site, ALM_STATS_SLOW_CALLS, 1);  \
+            alm_stats_add(&__alm_stats_site, ALM_STATS_SLOW_LANES,      \
+                          __alm_stats_lanes);                           \
+        }                                                               \
+    } while (0)
+
+#else
+
+#define ALM_STATS_ADD(name, counter, n)     do { } while (0)
+#define ALM_STATS_CHECK(any, cond, n)       do { } while (0)
+
+#endif  /* ALM_STATS */
+
+#define ALM_STATS_SPECIAL()     ALM_STATS_ADD(__func__, ALM_STATS_SPECIAL, 1)
+
+#endif  /* __LIBM_ALM_STATS_H__ */
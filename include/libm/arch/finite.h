@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __ALM_ARCH_FINITE_H__
+#define __ALM_ARCH_FINITE_H__
+
+/*
+ * Finite-math-only variants, amd_<fn>_finite()
+ *
+ * The optimized kernels are compiled with ALM_FINITE_MATH defined, which
+ * removes all of their special-case checks. Callers must guarantee that
+ * the inputs are finite, inside the domain of the function, and that the
+ * results are normal numbers, as with -ffinite-math-only:
+ *   exp:  |x| <= 708               expf: |x| <= 87
+ *   log:  DBL_MIN <= x < inf       logf: FLT_MIN <= x < inf
+ * Other inputs give unspecified results.
+ */
+#define ALM_ARCH_FINITE         finite
+#define ALM_PREFIX_FINITE       amd
+
+#ifndef ALM_PREFIX
+#define ALM_PREFIX      ALM_PREFIX_FINITE
+#endif
+
+#ifndef ALM_ARCH
+#define ALM_ARCH        ALM_ARCH_FINITE
+#endif
+
+#ifndef ALM_FINITE_MATH
+#define ALM_FINITE_MATH 1
+#endif
+
+/*
+ * Override all previously definded prototypes
+ */
+#if defined(ALM_OVERRIDE)
+
+#include <libm_macros.h>
+
+#define  ALM_PROTO_OPT(x)      ALM_PROTO_ARCH_FINITE(x)
+
+#endif /* ALM_OVERRIDE */
+
+
+#ifndef ALM_PROTO_ARCH
+#define __ALM_PROTO_ARCH(a, x, y)            ALM_MAKE_PROTO_SFX(a, x, y)
+#define  __ALM_MAKE_PROTO_ARCH(a, x, y)      __ALM_PROTO_ARCH(a, x, y)
+#endif
+
+#ifdef   ALM_PROTO_ARCH
+#undef   ALM_PROTO_ARCH
+#define  ALM_PROTO_ARCH(x)        ALM_PROTO_ARCH_FINITE(x)
+#endif
+
+#define  ALM_PROTO_ARCH_FINITE(x)    __ALM_PROTO_ARCH(ALM_PREFIX_FINITE, x, ALM_ARCH_FINITE)
+
+#pragma push_macro("ALM_PROTO_INTERNAL")
+#define ALM_PROTO_INTERNAL ALM_PROTO_ARCH
+#include "../__alm_func_internal.h"
+#undef ALM_PROTO_INTERNAL
+#pragma pop_macro("ALM_PROTO_INTERNAL")
+
+#endif  /* __ALM_ARCH_FINITE_H__ */
@@ -0,0 +1,595 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Helpers shared by the vector complex kernels, complex numbers are
+ * held in split form, one vector of real parts and one of imaginary parts.
+ */
+
+#ifndef __LIBM_CMPLX_VEC_H__
+#define __LIBM_CMPLX_VEC_H__
+
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <immintrin.h>
+
+/* Returns c ? a : b, element wise */
+static inline v_f64x4_t
+cmplx_sel_v4_f64(v_i64x4_t c, v_f64x4_t a, v_f64x4_t b)
+{
+    return as_v4_f64_u64((as_v4_u64_f64(a) & (v_u64x4_t)c) | (as_v4_u64_f64(b) & ~(v_u64x4_t)c));
+}
+
+/* Returns |x| with the sign of y */
+static inline v_f64x4_t
+cmplx_copysign_v4_f64(v_f64x4_t x, v_f64x4_t y)
+{
+    return as_v4_f64_u64((as_v4_u64_f64(x) & ~SIGNBIT_DP64) | (as_v4_u64_f64(y) & SIGNBIT_DP64));
+}
+
+/*
+ * Scale re and im by a common power of two so that re*re + im*im neither
+ * overflows nor underflows, returns the log2 of the scale removed.
+ */
+static inline v_f64x4_t
+cmplx_scale_v4_f64(v_f64x4_t *re, v_f64x4_t *im)
+{
+    v_u64x4_t ua = as_v4_u64_f64(*re) & ~SIGNBIT_DP64;
+    v_u64x4_t ub = as_v4_u64_f64(*im) & ~SIGNBIT_DP64;
+    v_i64x4_t c  = (v_i64x4_t)(ua > ub);
+    v_u64x4_t um = (ua & (v_u64x4_t)c) | (ub & ~(v_u64x4_t)c);
+
+    v_i64x4_t big   = (v_i64x4_t)(um > 0x5f30000000000000ULL);
+    v_i64x4_t small = (v_i64x4_t)(um < 0x20b0000000000000ULL);
+
+    v_f64x4_t s = cmplx_sel_v4_f64(big, _MM_SET1_PD4(0x1p-600),
+                    cmplx_sel_v4_f64(small, _MM_SET1_PD4(0x1p600), _MM_SET1_PD4(1.0)));
+    v_f64x4_t k = cmplx_sel_v4_f64(big, _MM_SET1_PD4(600.0),
+                    cmplx_sel_v4_f64(small, _MM_SET1_PD4(-600.0), _MM_SET1_PD4(0.0)));
+
+    *re = *re * s;
+    *im = *im * s;
+
+    return k;
+}
+
+/*
+ * atan2(y, x) argument reduction, returns t in [0, 1] such that
+ * atan2(y, x) is obtained from atan(t) by cmplx_atan2_fixup
+ */
+static inline v_f64x4_t
+cmplx_atan2_reduce_v4_f64(v_f64x4_t y, v_f64x4_t x, v_i64x4_t *swap)
+{
+    v_u64x4_t uy = as_v4_u64_f64(y) & ~SIGNBIT_DP64;
+    v_u64x4_t ux = as_v4_u64_f64(x) & ~SIGNBIT_DP64;
+    v_f64x4_t ay = as_v4_f64_u64(uy);
+    v_f64x4_t ax = as_v4_f64_u64(ux);
+
+    *swap = ay > ax;
+
+    v_f64x4_t num = cmplx_sel_v4_f64(*swap, ax, ay);
+    v_f64x4_t den = cmplx_sel_v4_f64(*swap, ay, ax);
+    v_f64x4_t t   = num / den;
+
+    /* 0/0 and inf/inf */
+    t = cmplx_sel_v4_f64((v_i64x4_t)((ux == 0) & (uy == 0)), _MM_SET1_PD4(0.0), t);
+    t = cmplx_sel_v4_f64((v_i64x4_t)((ux == PINFBITPATT_DP64) & (uy == PINFBITPATT_DP64)), _MM_SET1_PD4(1.0), t);
+
+    return t;
+}
+
+static inline v_f64x4_t
+cmplx_atan2_fixup_v4_f64(v_f64x4_t r, v_f64x4_t y, v_f64x4_t x, v_i64x4_t swap)
+{
+    v_i64x4_t xneg = (v_i64x4_t)as_v4_u64_f64(x) < 0;
+
+    r = cmplx_sel_v4_f64(swap, (0x1.921fb54442d18p+0 - r) + 0x1.1a62633145c07p-54, r);
+    r = cmplx_sel_v4_f64(xneg, (0x1.921fb54442d18p+1 - r) + 0x1.1a62633145c07p-53, r);
+
+    return cmplx_copysign_v4_f64(r, y);
+}
+
+/*
+ * Argument for log(a*a + b*b), a and b scaled by cmplx_scale, the log of
+ * the return value plus *c is log(a*a + b*b).
+ * Close to 1, log(h) is evaluated as log(1 + t) + (t - ((1 + t) - 1)) / (1 + t)
+ * with t = a*a + b*b - 1 summed exactly from the products, to avoid the
+ * cancellation in log(|z|) for |z| close to 1.
+ */
+static inline v_f64x4_t
+cmplx_loghypot_arg_v4_f64(v_f64x4_t a, v_f64x4_t b, v_f64x4_t *c)
+{
+    v_f64x4_t pa = a * a;
+    v_f64x4_t pb = b * b;
+    v_f64x4_t ea = _mm256_fmsub_pd(a, a, pa);
+    v_f64x4_t eb = _mm256_fmsub_pd(b, b, pb);
+    v_f64x4_t h  = pa + pb;
+
+    /* pa - 1 + pb, error free */
+    v_f64x4_t s1 = pa - 1.0;
+    v_f64x4_t v  = s1 - pa;
+    v_f64x4_t e1 = (pa - (s1 - v)) + (-1.0 - v);
+    v_f64x4_t s2 = s1 + pb;
+    v      = s2 - s1;
+    v_f64x4_t e2 = (s1 - (s2 - v)) + (pb - v);
+
+    v_f64x4_t t = s2 + ((e1 + e2) + (ea + eb));
+    v_f64x4_t u = 1.0 + t;
+
+    v_i64x4_t near = (h > 0.5) & (h < 2.0);
+
+    *c = cmplx_sel_v4_f64(near, (t - (u - 1.0)) / u, _MM_SET1_PD4(0.0));
+    /* log(0) = -inf, h is +0 here */
+    *c = cmplx_sel_v4_f64(h == 0, as_v4_f64_u64(as_v4_u64_f64(h) | NINFBITPATT_DP64), *c);
+
+    return cmplx_sel_v4_f64(near, u, h);
+}
+
+/*
+ * sinh(b) and cosh(b) given e = exp(|b|),
+ * sinh uses a Taylor series for |b| < 0.5 to avoid cancellation
+ */
+static inline void
+cmplx_sinhcosh_v4_f64(v_f64x4_t b, v_f64x4_t e, v_f64x4_t *sh, v_f64x4_t *ch)
+{
+    static const double c[] = {
+        0x1.5555555555555p-3,
+        0x1.1111111111111p-7,
+        0x1.a01a01a01a01ap-13,
+        0x1.71de3a556c734p-19,
+        0x1.ae64567f544e4p-26,
+        0x1.6124613a86d09p-33,
+        0x1.ae7f3e733b81fp-41,
+    };
+
+    v_f64x4_t ab = as_v4_f64_u64(as_v4_u64_f64(b) & ~SIGNBIT_DP64);
+    v_f64x4_t ie = 1.0 / e;
+    v_f64x4_t z  = ab * ab;
+
+    v_f64x4_t sh_small = ab + ab * z * (c[0] + z * (c[1] + z * (c[2] + z * (c[3] + z * (c[4] + z * (c[5] + z * (c[6])))))));
+
+    *ch = 0.5 * (e + ie);
+    *sh = cmplx_copysign_v4_f64(cmplx_sel_v4_f64(ab < 0.5, sh_small, 0.5 * (e - ie)), b);
+}
+
+/* Returns c ? a : b, element wise */
+static inline v_f32x8_t
+cmplx_sel_v8_f32(v_i32x8_t c, v_f32x8_t a, v_f32x8_t b)
+{
+    return as_v8_f32_u32((as_v8_u32_f32(a) & (v_u32x8_t)c) | (as_v8_u32_f32(b) & ~(v_u32x8_t)c));
+}
+
+/* Returns |x| with the sign of y */
+static inline v_f32x8_t
+cmplx_copysign_v8_f32(v_f32x8_t x, v_f32x8_t y)
+{
+    return as_v8_f32_u32((as_v8_u32_f32(x) & ~SIGNBIT_SP32) | (as_v8_u32_f32(y) & SIGNBIT_SP32));
+}
+
+/*
+ * Scale re and im by a common power of two so that re*re + im*im neither
+ * overflows nor underflows, returns the log2 of the scale removed.
+ */
+static inline v_f32x8_t
+cmplx_scale_v8_f32(v_f32x8_t *re, v_f32x8_t *im)
+{
+    v_u32x8_t ua = as_v8_u32_f32(*re) & ~SIGNBIT_SP32;
+    v_u32x8_t ub = as_v8_u32_f32(*im) & ~SIGNBIT_SP32;
+    v_i32x8_t c  = (v_i32x8_t)(ua > ub);
+    v_u32x8_t um = (ua & (v_u32x8_t)c) | (ub & ~(v_u32x8_t)c);
+
+    v_i32x8_t big   = (v_i32x8_t)(um > 0x5d800000U);
+    v_i32x8_t small = (v_i32x8_t)(um < 0x21800000U);
+
+    v_f32x8_t s = cmplx_sel_v8_f32(big, _MM_SET1_PS8(0x1p-70f),
+                    cmplx_sel_v8_f32(small, _MM_SET1_PS8(0x1p90f), _MM_SET1_PS8(1.0f)));
+    v_f32x8_t k = cmplx_sel_v8_f32(big, _MM_SET1_PS8(70.0f),
+                    cmplx_sel_v8_f32(small, _MM_SET1_PS8(-90.0f), _MM_SET1_PS8(0.0f)));
+
+    *re = *re * s;
+    *im = *im * s;
+
+    return k;
+}
+
+/*
+ * atan2(y, x) argument reduction, returns t in [0, 1] such that
+ * atan2(y, x) is obtained from atan(t) by cmplx_atan2_fixup
+ */
+static inline v_f32x8_t
+cmplx_atan2_reduce_v8_f32(v_f32x8_t y, v_f32x8_t x, v_i32x8_t *swap)
+{
+    v_u32x8_t uy = as_v8_u32_f32(y) & ~SIGNBIT_SP32;
+    v_u32x8_t ux = as_v8_u32_f32(x) & ~SIGNBIT_SP32;
+    v_f32x8_t ay = as_v8_f32_u32(uy);
+    v_f32x8_t ax = as_v8_f32_u32(ux);
+
+    *swap = ay > ax;
+
+    v_f32x8_t num = cmplx_sel_v8_f32(*swap, ax, ay);
+    v_f32x8_t den = cmplx_sel_v8_f32(*swap, ay, ax);
+    v_f32x8_t t   = num / den;
+
+    /* 0/0 and inf/inf */
+    t = cmplx_sel_v8_f32((v_i32x8_t)((ux == 0) & (uy == 0)), _MM_SET1_PS8(0.0f), t);
+    t = cmplx_sel_v8_f32((v_i32x8_t)((ux == PINFBITPATT_SP32) & (uy == PINFBITPATT_SP32)), _MM_SET1_PS8(1.0f), t);
+
+    return t;
+}
+
+static inline v_f32x8_t
+cmplx_atan2_fixup_v8_f32(v_f32x8_t r, v_f32x8_t y, v_f32x8_t x, v_i32x8_t swap)
+{
+    v_i32x8_t xneg = (v_i32x8_t)as_v8_u32_f32(x) < 0;
+
+    r = cmplx_sel_v8_f32(swap, (0x1.921fb6p+0f - r) + -0x1.777a5cp-25f, r);
+    r = cmplx_sel_v8_f32(xneg, (0x1.921fb6p+1f - r) + -0x1.777a5cp-24f, r);
+
+    return cmplx_copysign_v8_f32(r, y);
+}
+
+/*
+ * Argument for log(a*a + b*b), a and b scaled by cmplx_scale, the log of
+ * the return value plus *c is log(a*a + b*b).
+ * Close to 1, log(h) is evaluated as log(1 + t) + (t - ((1 + t) - 1)) / (1 + t)
+ * with t = a*a + b*b - 1 summed exactly from the products, to avoid the
+ * cancellation in log(|z|) for |z| close to 1.
+ */
+static inline v_f32x8_t
+cmplx_loghypot_arg_v8_f32(v_f32x8_t a, v_f32x8_t b, v_f32x8_t *c)
+{
+    v_f32x8_t pa = a * a;
+    v_f32x8_t pb = b * b;
+    v_f32x8_t ea = _mm256_fmsub_ps(a, a, pa);
+    v_f32x8_t eb = _mm256_fmsub_ps(b, b, pb);
+    v_f32x8_t h  = pa + pb;
+
+    /* pa - 1 + pb, error free */
+    v_f32x8_t s1 = pa - 1.0f;
+    v_f32x8_t v  = s1 - pa;
+    v_f32x8_t e1 = (pa - (s1 - v)) + (-1.0f - v);
+    v_f32x8_t s2 = s1 + pb;
+    v      = s2 - s1;
+    v_f32x8_t e2 = (s1 - (s2 - v)) + (pb - v);
+
+    v_f32x8_t t = s2 + ((e1 + e2) + (ea + eb));
+    v_f32x8_t u = 1.0f + t;
+
+    v_i32x8_t near = (h > 0.5f) & (h < 2.0f);
+
+    *c = cmplx_sel_v8_f32(near, (t - (u - 1.0f)) / u, _MM_SET1_PS8(0.0f));
+    /* log(0) = -inf, h is +0 here */
+    *c = cmplx_sel_v8_f32(h == 0, as_v8_f32_u32(as_v8_u32_f32(h) | NINFBITPATT_SP32), *c);
+
+    return cmplx_sel_v8_f32(near, u, h);
+}
+
+/*
+ * sinh(b) and cosh(b) given e = exp(|b|),
+ * sinh uses a Taylor series for |b| < 0.5 to avoid cancellation
+ */
+static inline void
+cmplx_sinhcosh_v8_f32(v_f32x8_t b, v_f32x8_t e, v_f32x8_t *sh, v_f32x8_t *ch)
+{
+    static const float c[] = {
+        0x1.555556p-3f,
+        0x1.111112p-7f,
+        0x1.a01a02p-13f,
+        0x1.71de3ap-19f,
+    };
+
+    v_f32x8_t ab = as_v8_f32_u32(as_v8_u32_f32(b) & ~SIGNBIT_SP32);
+    v_f32x8_t ie = 1.0f / e;
+    v_f32x8_t z  = ab * ab;
+
+    v_f32x8_t sh_small = ab + ab * z * (c[0] + z * (c[1] + z * (c[2] + z * (c[3]))));
+
+    *ch = 0.5f * (e + ie);
+    *sh = cmplx_copysign_v8_f32(cmplx_sel_v8_f32(ab < 0.5f, sh_small, 0.5f * (e - ie)), b);
+}
+
+#if defined(__AVX512F__)
+
+/* Returns c ? a : b, element wise */
+static inline v_f64x8_t
+cmplx_sel_v8_f64(v_i64x8_t c, v_f64x8_t a, v_f64x8_t b)
+{
+    return as_v8_f64_u64((as_v8_u64_f64(a) & (v_u64x8_t)c) | (as_v8_u64_f64(b) & ~(v_u64x8_t)c));
+}
+
+/* Returns |x| with the sign of y */
+static inline v_f64x8_t
+cmplx_copysign_v8_f64(v_f64x8_t x, v_f64x8_t y)
+{
+    return as_v8_f64_u64((as_v8_u64_f64(x) & ~SIGNBIT_DP64) | (as_v8_u64_f64(y) & SIGNBIT_DP64));
+}
+
+/*
+ * Scale re and im by a common power of two so that re*re + im*im neither
+ * overflows nor underflows, returns the log2 of the scale removed.
+ */
+static inline v_f64x8_t
+cmplx_scale_v8_f64(v_f64x8_t *re, v_f64x8_t *im)
+{
+    v_u64x8_t ua = as_v8_u64_f64(*re) & ~SIGNBIT_DP64;
+    v_u64x8_t ub = as_v8_u64_f64(*im) & ~SIGNBIT_DP64;
+    v_i64x8_t c  = (v_i64x8_t)(ua > ub);
+    v_u64x8_t um = (ua & (v_u64x8_t)c) | (ub & ~(v_u64x8_t)c);
+
+    v_i64x8_t big   = (v_i64x8_t)(um > 0x5f30000000000000ULL);
+    v_i64x8_t small = (v_i64x8_t)(um < 0x20b0000000000000ULL);
+
+    v_f64x8_t s = cmplx_sel_v8_f64(big, _MM512_SET1_PD8(0x1p-600),
+                    cmplx_sel_v8_f64(small, _MM512_SET1_PD8(0x1p600), _MM512_SET1_PD8(1.0)));
+    v_f64x8_t k = cmplx_sel_v8_f64(big, _MM512_SET1_PD8(600.0),
+                    cmplx_sel_v8_f64(small, _MM512_SET1_PD8(-600.0), _MM512_SET1_PD8(0.0)));
+
+    *re = *re * s;
+    *im = *im * s;
+
+    return k;
+}
+
+/*
+ * atan2(y, x) argument reduction, returns t in [0, 1] such that
+ * atan2(y, x) is obtained from atan(t) by cmplx_atan2_fixup
+ */
+static inline v_f64x8_t
+cmplx_atan2_reduce_v8_f64(v_f64x8_t y, v_f64x8_t x, v_i64x8_t *swap)
+{
+    v_u64x8_t uy = as_v8_u64_f64(y) & ~SIGNBIT_DP64;
+    v_u64x8_t ux = as_v8_u64_f64(x) & ~SIGNBIT_DP64;
+    v_f64x8_t ay = as_v8_f64_u64(uy);
+    v_f64x8_t ax = as_v8_f64_u64(ux);
+
+    *swap = ay > ax;
+
+    v_f64x8_t num = cmplx_sel_v8_f64(*swap, ax, ay);
+    v_f64x8_t den = cmplx_sel_v8_f64(*swap, ay, ax);
+    v_f64x8_t t   = num / den;
+
+    /* 0/0 and inf/inf */
+    t = cmplx_sel_v8_f64((v_i64x8_t)((ux == 0) & (uy == 0)), _MM512_SET1_PD8(0.0), t);
+    t = cmplx_sel_v8_f64((v_i64x8_t)((ux == PINFBITPATT_DP64) & (uy == PINFBITPATT_DP64)), _MM512_SET1_PD8(1.0), t);
+
+    return t;
+}
+
+static inline v_f64x8_t
+cmplx_atan2_fixup_v8_f64(v_f64x8_t r, v_f64x8_t y, v_f64x8_t x, v_i64x8_t swap)
+{
+    v_i64x8_t xneg = (v_i64x8_t)as_v8_u64_f64(x) < 0;
+
+    r = cmplx_sel_v8_f64(swap, (0x1.921fb54442d18p+0 - r) + 0x1.1a62633145c07p-54, r);
+    r = cmplx_sel_v8_f64(xneg, (0x1.921fb54442d18p+1 - r) + 0x1.1a62633145c07p-53, r);
+
+    return cmplx_copysign_v8_f64(r, y);
+}
+
+/*
+ * Argument for log(a*a + b*b), a and b scaled by cmplx_scale, the log of
+ * the return value plus *c is log(a*a + b*b).
+ * Close to 1, log(h) is evaluated as log(1 + t) + (t - ((1 + t) - 1)) / (1 + t)
+ * with t = a*a + b*b - 1 summed exactly from the products, to avoid the
+ * cancellation in log(|z|) for |z| close to 1.
+ */
+static inline v_f64x8_t
+cmplx_loghypot_arg_v8_f64(v_f64x8_t a, v_f64x8_t b, v_f64x8_t *c)
+{
+    v_f64x8_t pa = a * a;
+    v_f64x8_t pb = b * b;
+    v_f64x8_t ea = _mm512_fmsub_pd(a, a, pa);
+    v_f64x8_t eb = _mm512_fmsub_pd(b, b, pb);
+    v_f64x8_t h  = pa + pb;
+
+    /* pa - 1 + pb, error free */
+    v_f64x8_t s1 = pa - 1.0;
+    v_f64x8_t v  = s1 - pa;
+    v_f64x8_t e1 = (pa - (s1 - v)) + (-1.0 - v);
+    v_f64x8_t s2 = s1 + pb;
+    v      = s2 - s1;
+    v_f64x8_t e2 = (s1 - (s2 - v)) + (pb - v);
+
+    v_f64x8_t t = s2 + ((e1 + e2) + (ea + eb));
+    v_f64x8_t u = 1.0 + t;
+
+    v_i64x8_t near = (h > 0.5) & (h < 2.0);
+
+    *c = cmplx_sel_v8_f64(near, (t - (u - 1.0)) / u, _MM512_SET1_PD8(0.0));
+    /* log(0) = -inf, h is +0 here */
+    *c = cmplx_sel_v8_f64(h == 0, as_v8_f64_u64(as_v8_u64_f64(h) | NINFBITPATT_DP64), *c);
+
+    return cmplx_sel_v8_f64(near, u, h);
+}
+
+/*
+ * sinh(b) and cosh(b) given e = exp(|b|),
+ * sinh uses a Taylor series for |b| < 0.5 to avoid cancellation
+ */
+static inline void
+cmplx_sinhcosh_v8_f64(v_f64x8_t b, v_f64x8_t e, v_f64x8_t *sh, v_f64x8_t *ch)
+{
+    static const double c[] = {
+        0x1.5555555555555p-3,
+        0x1.1111111111111p-7,
+        0x1.a01a01a01a01ap-13,
+        0x1.71de3a556c734p-19,
+        0x1.ae64567f544e4p-26,
+        0x1.6124613a86d09p-33,
+        0x1.ae7f3e733b81fp-41,
+    };
+
+    v_f64x8_t ab = as_v8_f64_u64(as_v8_u64_f64(b) & ~SIGNBIT_DP64);
+    v_f64x8_t ie = 1.0 / e;
+    v_f64x8_t z  = ab * ab;
+
+    v_f64x8_t sh_small = ab + ab * z * (c[0] + z * (c[1] + z * (c[2] + z * (c[3] + z * (c[4] + z * (c[5] + z * (c[6])))))));
+
+    *ch = 0.5 * (e + ie);
+    *sh = cmplx_copysign_v8_f64(cmplx_sel_v8_f64(ab < 0.5, sh_small, 0.5 * (e - ie)), b);
+}
+
+/* Returns c ? a : b, element wise */
+static inline v_f32x16_t
+cmplx_sel_v16_f32(v_i32x16_t c, v_f32x16_t a, v_f32x16_t b)
+{
+    return as_v16_f32_u32((as_v16_u32_f32(a) & (v_u32x16_t)c) | (as_v16_u32_f32(b) & ~(v_u32x16_t)c));
+}
+
+/* Returns |x| with the sign of y */
+static inline v_f32x16_t
+cmplx_copysign_v16_f32(v_f32x16_t x, v_f32x16_t y)
+{
+    return as_v16_f32_u32((as_v16_u32_f32(x) & ~SIGNBIT_SP32) | (as_v16_u32_f32(y) & SIGNBIT_SP32));
+}
+
+/*
+ * Scale re and im by a common power of two so that re*re + im*im neither
+ * overflows nor underflows, returns the log2 of the scale removed.
+ */
+static inline v_f32x16_t
+cmplx_scale_v16_f32(v_f32x16_t *re, v_f32x16_t *im)
+{
+    v_u32x16_t ua = as_v16_u32_f32(*re) & ~SIGNBIT_SP32;
+    v_u32x16_t ub = as_v16_u32_f32(*im) & ~SIGNBIT_SP32;
+    v_i32x16_t c  = (v_i32x16_t)(ua > ub);
+    v_u32x16_t um = (ua & (v_u32x16_t)c) | (ub & ~(v_u32x16_t)c);
+
+    v_i32x16_t big   = (v_i32x16_t)(um > 0x5d800000U);
+    v_i32x16_t small = (v_i32x16_t)(um < 0x21800000U);
+
+    v_f32x16_t s = cmplx_sel_v16_f32(big, _MM512_SET1_PS16(0x1p-70f),
+                    cmplx_sel_v16_f32(small, _MM512_SET1_PS16(0x1p90f), _MM512_SET1_PS16(1.0f)));
+    v_f32x16_t k = cmplx_sel_v16_f32(big, _MM512_SET1_PS16(70.0f),
+                    cmplx_sel_v16_f32(small, _MM512_SET1_PS16(-90.0f), _MM512_SET1_PS16(0.0f)));
+
+    *re = *re * s;
+    *im = *im * s;
+
+    return k;
+}
+
+/*
+ * atan2(y, x) argument reduction, returns t in [0, 1] such that
+ * atan2(y, x) is obtained from atan(t) by cmplx_atan2_fixup
+ */
+static inline v_f32x16_t
+cmplx_atan2_reduce_v16_f32(v_f32x16_t y, v_f32x16_t x, v_i32x16_t *swap)
+{
+    v_u32x16_t uy = as_v16_u32_f32(y) & ~SIGNBIT_SP32;
+    v_u32x16_t ux = as_v16_u32_f32(x) & ~SIGNBIT_SP32;
+    v_f32x16_t ay = as_v16_f32_u32(uy);
+    v_f32x16_t ax = as_v16_f32_u32(ux);
+
+    *swap = ay > ax;
+
+    v_f32x16_t num = cmplx_sel_v16_f32(*swap, ax, ay);
+    v_f32x16_t den = cmplx_sel_v16_f32(*swap, ay, ax);
+    v_f32x16_t t   = num / den;
+
+    /* 0/0 and inf/inf */
+    t = cmplx_sel_v16_f32((v_i32x16_t)((ux == 0) & (uy == 0)), _MM512_SET1_PS16(0.0f), t);
+    t = cmplx_sel_v16_f32((v_i32x16_t)((ux == PINFBITPATT_SP32) & (uy == PINFBITPATT_SP32)), _MM512_SET1_PS16(1.0f), t);
+
+    return t;
+}
+
+static inline v_f32x16_t
+cmplx_atan2_fixup_v16_f32(v_f32x16_t r, v_f32x16_t y, v_f32x16_t x, v_i32x16_t swap)
+{
+    v_i32x16_t xneg = (v_i32x16_t)as_v16_u32_f32(x) < 0;
+
+    r = cmplx_sel_v16_f32(swap, (0x1.921fb6p+0f - r) + -0x1.777a5cp-25f, r);
+    r = cmplx_sel_v16_f32(xneg, (0x1.921fb6p+1f - r) + -0x1.777a5cp-24f, r);
+
+    return cmplx_copysign_v16_f32(r, y);
+}
+
+/*
+ * Argument for log(a*a + b*b), a and b scaled by cmplx_scale, the log of
+ * the return value plus *c is log(a*a + b*b).
+ * Close to 1, log(h) is evaluated as log(1 + t) + (t - ((1 + t) - 1)) / (1 + t)
+ * with t = a*a + b*b - 1 summed exactly from the products, to avoid the
+ * cancellation in log(|z|) for |z| close to 1.
+ */
+static inline v_f32x16_t
+cmplx_loghypot_arg_v16_f32(v_f32x16_t a, v_f32x16_t b, v_f32x16_t *c)
+{
+    v_f32x16_t pa = a * a;
+    v_f32x16_t pb = b * b;
+    v_f32x16_t ea = _mm512_fmsub_ps(a, a, pa);
+    v_f32x16_t eb = _mm512_fmsub_ps(b, b, pb);
+    v_f32x16_t h  = pa + pb;
+
+    /* pa - 1 + pb, error free */
+    v_f32x16_t s1 = pa - 1.0f;
+    v_f32x16_t v  = s1 - pa;
+    v_f32x16_t e1 = (pa - (s1 - v)) + (-1.0f - v);
+    v_f32x16_t s2 = s1 + pb;
+    v      = s2 - s1;
+    v_f32x16_t e2 = (s1 - (s2 - v)) + (pb - v);
+
+    v_f32x16_t t = s2 + ((e1 + e2) + (ea + eb));
+    v_f32x16_t u = 1.0f + t;
+
+    v_i32x16_t near = (h > 0.5f) & (h < 2.0f);
+
+    *c = cmplx_sel_v16_f32(near, (t - (u - 1.0f)) / u, _MM512_SET1_PS16(0.0f));
+    /* log(0) = -inf, h is +0 here */
+    *c = cmplx_sel_v16_f32(h == 0, as_v16_f32_u32(as_v16_u32_f32(h) | NINFBITPATT_SP32), *c);
+
+    return cmplx_sel_v16_f32(near, u, h);
+}
+
+/*
+ * sinh(b) and cosh(b) given e = exp(|b|),
+ * sinh uses a Taylor series for |b| < 0.5 to avoid cancellation
+ */
+static inline void
+cmplx_sinhcosh_v16_f32(v_f32x16_t b, v_f32x16_t e, v_f32x16_t *sh, v_f32x16_t *ch)
+{
+    static const float c[] = {
+        0x1.555556p-3f,
+        0x1.111112p-7f,
+        0x1.a01a02p-13f,
+        0x1.71de3ap-19f,
+    };
+
+    v_f32x16_t ab = as_v16_f32_u32(as_v16_u32_f32(b) & ~SIGNBIT_SP32);
+    v_f32x16_t ie = 1.0f / e;
+    v_f32x16_t z  = ab * ab;
+
+    v_f32x16_t sh_small = ab + ab * z * (c[0] + z * (c[1] + z * (c[2] + z * (c[3]))));
+
+    *ch = 0.5f * (e + ie);
+    *sh = cmplx_copysign_v16_f32(cmplx_sel_v16_f32(ab < 0.5f, sh_small, 0.5f * (e - ie)), b);
+}
+
+#endif  /* __AVX512F__ */
+
+#endif  /* __LIBM_CMPLX_VEC_H__ */
@@ -86,11 +86,23 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(sin);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(sinh);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(sinpi);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(sqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(rsqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(rsqrt_approx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(invcbrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(rhypot);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(tan);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(tanh);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(tanpi);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(trunc);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(erf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(erfc);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(erfinv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(erfcinv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cdfnorm);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cdfnorminv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(lgamma);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(tgamma);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(digamma);
 
 /*
  * Single Precision functions
@@ -143,11 +155,23 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(sinf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(sinhf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(sinpif);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(sqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(rsqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(rsqrtf_approx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(invcbrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(rhypotf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(tanf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(tanhf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(tanpif);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(truncf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(erff);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(erfcf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(erfinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(erfcinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cdfnormf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cdfnorminvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(lgammaf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(tgammaf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(digammaf);
 
 /*
  * Complex variants
@@ -158,6 +182,73 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(clog);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(clogf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(cpow);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(cpowf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(csin);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(csinf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ccos);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ccosf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ctan);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ctanf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(csqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(csqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cabs);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cabsf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(carg);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cargf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(expf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(logf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(sinf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cosf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(tanhf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(erff16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(sqrtf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(powf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_expf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_logf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_sinf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_cosf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_tanhf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_erff16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_sqrtf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_powf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_expf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_logf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_sinf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_cosf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_tanhf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_erff16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_sqrtf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_powf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_expf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_logf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_sinf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_cosf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_tanhf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_erff16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_sqrtf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_powf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_expf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_logf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_sinf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_cosf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_tanhf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_erff16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_sqrtf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_powf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_expbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_expbf16_f32);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_logbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_logbf16_f32);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_tanhbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_tanhbf16_f32);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_erfbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_erfbf16_f32);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_sigmoidbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_sigmoidbf16_f32);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_silubf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_softplusbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_gelubf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_gelu_tanhbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_softmaxbf16);
 
 
 /*
@@ -191,6 +282,8 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_pow);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_sqrt);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_linearfrac);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_powx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_pown);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_rootn);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_sincos);
 
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_expf);
@@ -242,7 +335,94 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_fmaxfi);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_fminfi);
 
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_fabs);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_frexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_ldexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_scalbn);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_ilogb);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_logb);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_exp_affine);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_log_affine);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_pow_affine);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_sin_affine);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_cos_affine);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_sumexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_logsumexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_sumlog);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_cis);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_polar);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_boxmuller);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_cdfnorminv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_erfc);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_erfinv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_erfcinv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_cdfnorm);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_lgamma);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_tgamma);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_digamma);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_rsqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_rsqrt_approx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_invcbrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_rhypot);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_cexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_clog);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_cpow);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_csin);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_ccos);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_ctan);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_csqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_cabs);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_carg);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_cexp_soa);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_clog_soa);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_cpow_soa);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_fabsf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_frexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_ldexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_scalbnf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_ilogbf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_logbf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_expf_affine);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_logf_affine);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_powf_affine);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_sinf_affine);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_cosf_affine);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_tanhf_affine);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_sumexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_logsumexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_sumlogf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_sigmoidf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_siluf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_softplusf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_geluf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_gelu_tanhf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_softmaxf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_cisf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_polarf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_boxmullerf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_erfcf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_erfinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_erfcinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_cdfnormf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_cdfnorminvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_lgammaf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_tgammaf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_digammaf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_rsqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_rsqrtf_approx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_invcbrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_rhypotf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_clogf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cpowf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_csinf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_ccosf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_ctanf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_csqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cabsf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cargf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cexpf_soa);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_clogf_soa);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cpowf_soa);
 
 #include <immintrin.h>
 
@@ -270,6 +450,15 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_fabsf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_sqrtf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_linearfracf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_sincosf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_erfcf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_erfinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_erfcinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_cdfnormf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_cdfnorminvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_rsqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_rsqrtf_approx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_invcbrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_rhypotf);
 
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_cosf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_acosf);
@@ -291,6 +480,32 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_fabsf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_sqrtf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_linearfracf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_sincosf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_frexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_ldexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_scalbnf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_ilogbf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_logbf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_erfcf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_erfinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_erfcinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_cdfnormf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_cdfnorminvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_lgammaf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_tgammaf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_digammaf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_rsqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_rsqrtf_approx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_invcbrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_rhypotf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_cexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_clogf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_cpowf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_csinf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_ccosf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_ctanf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_csqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_cabsf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_cargf);
 
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_cbrt);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_cos);
@@ -313,6 +528,15 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_sincos);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_sqrt);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_fabs);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_linearfrac);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_erfc);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_erfinv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_erfcinv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_cdfnorm);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_cdfnorminv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_rsqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_rsqrt_approx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_invcbrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_rhypot);
 
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_cbrt);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_cos);
@@ -327,6 +551,7 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_log10);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_log1p);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_pow);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_powx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_pown);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_sin);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_tan);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_atan);
@@ -335,6 +560,32 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_sincos);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_sqrt);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_fabs);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_linearfrac);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_frexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_ldexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_scalbn);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_ilogb);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_logb);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_erfc);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_erfinv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_erfcinv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_cdfnorm);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_cdfnorminv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_lgamma);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_tgamma);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_digamma);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_rsqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_rsqrt_approx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_invcbrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_rhypot);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_cexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_clog);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_cpow);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_csin);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_ccos);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_ctan);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_csqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_cabs);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_carg);
 
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_cbrt);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_cos);
@@ -357,6 +608,26 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_erf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_sincos);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_linearfrac);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_sqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_frexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_ldexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_scalbn);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_ilogb);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_logb);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_erfc);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_erfinv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_erfcinv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_cdfnorm);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_cdfnorminv);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_lgamma);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_tgamma);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_digamma);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_rsqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_rsqrt_approx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_invcbrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_rhypot);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_cexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_clog);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_cpow);
 
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_expf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_powf);
@@ -376,6 +647,26 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_erff);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_sqrtf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_linearfracf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_sincosf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_frexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_ldexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_scalbnf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_ilogbf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_logbf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_erfcf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_erfinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_erfcinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_cdfnormf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_cdfnorminvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_lgammaf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_tgammaf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_digammaf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_rsqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_rsqrtf_approx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_invcbrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_rhypotf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_cexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_clogf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_cpowf);
 
 
 #endif	/* __AMD_LIBM_ENTRY_PT_PTR_H__ */
@@ -0,0 +1,447 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Complementary error function, normal distribution and their inverses,
+ * shared by the scalar, vector and array kernels of erfc, erfinv,
+ * erfcinv, cdfnorm and cdfnorminv.
+ *
+ * erfc(a), a >= 0:
+ *     erfc(a) = t * exp(-a^2 + S(u)),   t = 2 / (2 + a),
+ *                                       u = (2t - (1 + tmin)) / (1 - tmin)
+ *     with tmin = 2 / 30, so that u covers [-1, 1] for a in [0, 28], and
+ *     S a polynomial of degree 26 (tools/sollya/erfc.sollya). S enters
+ *     exp() directly, so its absolute error is the relative error of erfc.
+ *     a + al is taken as a double-double so that cdfnorm can pass the
+ *     rounding error of -x / sqrt(2). t and a^2 are corrected with their
+ *     rounding errors, and the sum -a^2 + S with its own, before exp.
+ *     erfc(a) = 0 beyond a = 28.
+ *
+ *     erfc(x)    = 2 - erfc(-x)                  for x < 0
+ *     cdfnorm(x) = erfc(-x / sqrt(2)) / 2
+ *
+ * Inverses, Wichura's algorithm AS 241 (PPND16), accurate to about 1 part
+ * in 1e16, computing x with p = cdfnorm(x) from h = p - 0.5 and the tail
+ * probability s = min(p, 1 - p):
+ *     |h| <= 0.425:  x = h * A(r) / B(r),           r = 0.180625 - h^2
+ *     otherwise:     r = sqrt(-log(s))
+ *                    r <= 5:  x = C(r - 1.6) / D(r - 1.6)
+ *                    r >  5:  x = E(r - 5) / F(r - 5)
+ *                    x = -x for h < 0
+ * with A .. F polynomials of degree 7, and
+ *     cdfnorminv(p) = PPND(p - 0.5, min(p, 1 - p))
+ *     erfinv(y)     = PPND(y / 2, (1 - |y|) / 2) / sqrt(2)
+ *     erfcinv(y)    = PPND(0.5 - y / 2, min(y, 2 - y) / 2) / sqrt(2)
+ * where the tail probability is exact for the lanes that use it. The
+ * halving of the tail probability of erfinv and erfcinv is folded into
+ * the log, as log(2s) - log(2), so that it is not lost for denormal y.
+ *
+ * The vector forms evaluate all branches and select, with exp and log
+ * from the vrd4 kernels, and on AVX-512 from the vrd8 kernels named by
+ * ALM_PROTO_ARCH(), so the zen4/zen5 wrappers define ALM_OVERRIDE.
+ * The float kernels are evaluated in double through the same code.
+ */
+
+#ifndef __LIBM_ERFC_COMMON_H__
+#define __LIBM_ERFC_COMMON_H__
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/poly.h>
+#include <immintrin.h>
+
+#define ERFC_BOUND      28.0
+#define ERFC_UA         0x1.1249249249249p+1      /* 2 / (1 - tmin) */
+#define ERFC_UB         -0x1.2492492492492p+0     /* -(1 + tmin) / (1 - tmin) */
+#define ERFC_ISQ2_HI    0x1.6a09e667f3bcdp-1      /* 1 / sqrt(2) */
+#define ERFC_ISQ2_LO    -0x1.bdd3413b26456p-55
+#define ERFC_LN2        0x1.62e42fefa39efp-1
+#define PPND_SPLIT1     0.425
+#define PPND_SPLIT2     5.0
+#define PPND_CONST1     0.180625
+#define PPND_CONST2     1.6
+
+static const struct {
+    double s[27];
+    double a[8], b[8], c[8], d[8], e[8], f[8];
+} erfc_data = {
+    .s = {
+        -0x1.40e60388403bdp-1,  0x1.442574caf43f7p-1,
+         0x1.0d3a9b0417facp-5, -0x1.473520231b211p-5,
+        -0x1.54120723b92d0p-8,  0x1.b01291b37d3ffp-8,
+         0x1.cb10e8a5b9fc2p-12, -0x1.774942b9981ffp-10,
+         0x1.177b9446c6188p-13,  0x1.4340fe4ee4cd3p-12,
+        -0x1.a1a7b2a1d6854p-14, -0x1.ad93dec46806dp-15,
+         0x1.3eea5fc3ef626p-15,  0x1.0c38140673fdfp-19,
+        -0x1.4dd1efca6a58dp-17,  0x1.5b7b07a3ebaa9p-19,
+         0x1.a1e0bde9097e0p-20, -0x1.2e190f27ca514p-20,
+         0x1.bf9ec19e27397p-26,  0x1.0626722b4127ep-22,
+        -0x1.8a91528c6dd4ep-24, -0x1.651e2112fb746p-26,
+         0x1.b0823149cdd77p-26, -0x1.990798c6d6470p-29,
+        -0x1.a01a480869fcap-29,  0x1.915e849682cbap-31,
+         0x1.a9b311f88591fp-34,
+    },
+    .a = {
+        3.3871328727963666080e+00, 1.3314166789178437745e+02,
+        1.9715909503065514427e+03, 1.3731693765509461125e+04,
+        4.5921953931549871457e+04, 6.7265770927008700853e+04,
+        3.3430575583588128105e+04, 2.5090809287301226727e+03,
+    },
+    .b = {
+        1.0,                       4.2313330701600911252e+01,
+        6.8718700749205790830e+02, 5.3941960214247511077e+03,
+        2.1213794301586595867e+04, 3.9307895800092710610e+04,
+        2.8729085735721942674e+04, 5.2264952788528545610e+03,
+    },
+    .c = {
+        1.42343711074968357734e+00, 4.63033784615654529590e+00,
+        5.76949722146069140550e+00, 3.64784832476320460504e+00,
+        1.27045825245236838258e+00, 2.41780725177450611770e-01,
+        2.27238449892691845833e-02, 7.74545014278341407640e-04,
+    },
+    .d = {
+        1.0,                        2.05319162663775882187e+00,
+        1.67638483018380384940e+00, 6.89767334985100004550e-01,
+        1.48103976427480074590e-01, 1.51986665636164571966e-02,
+        5.47593808499534494600e-04, 1.05075007164441684324e-09,
+    },
+    .e = {
+        6.65790464350110377720e+00, 5.46378491116411436990e+00,
+        1.78482653991729133580e+00, 2.96560571828504891230e-01,
+        2.65321895265761230930e-02, 1.24266094738807843860e-03,
+        2.71155556874348757815e-05, 2.01033439929228813265e-07,
+    },
+    .f = {
+        1.0,                        5.99832206555887937690e-01,
+        1.36929880922735805310e-01, 1.48753612908506148525e-02,
+        7.86869131145613259100e-04, 1.84631831751005468180e-05,
+        1.42151175831644588870e-07, 2.04426310338993978564e-15,
+    },
+};
+
+#define PPND_A(i) erfc_data.a[i]
+#define PPND_B(i) erfc_data.b[i]
+#define PPND_C(i) erfc_data.c[i]
+#define PPND_D(i) erfc_data.d[i]
+#define PPND_E(i) erfc_data.e[i]
+#define PPND_F(i) erfc_data.f[i]
+
+/* P(r) / Q(r), r must not be an expression (see POLY_EVAL_HORNER_8) */
+#define PPND_RATIONAL(r, P, Q)                                              \
+    (POLY_EVAL_HORNER_8(r, P(0), P(1), P(2), P(3), P(4), P(5), P(6), P(7)) / \
+     POLY_EVAL_HORNER_8(r, Q(0), Q(1), Q(2), Q(3), Q(4), Q(5), Q(6), Q(7)))
+
+/*
+ * erfc(a + al) for a >= 0 (or NaN), |al| <= ulp(a) / 2, with vexp the
+ * exp kernel, vfma a fused multiply-add and vsel(c, a, b) selecting a
+ * where the comparison c holds
+ */
+#define ERFC_POS(a, al, vexp, vfma, vsel) ({                                \
+        __typeof__(a) _dh, _dl, _bb, _th, _r, _u, _S, _p, _e, _h, _hl, _s;   \
+        int _i;                                                             \
+                                                                            \
+        _dh = (a) + 2.0;                                                    \
+        _bb = _dh - (a);                                                    \
+        _dl = ((a) - (_dh - _bb)) + (2.0 - _bb) + (al);                     \
+                                                                            \
+        /* t = 2 / (dh + dl) = th * (1 + r / 2) */                          \
+        _th = 2.0 / _dh;                                                    \
+        _r  = vfma(-_th, _dh, 2.0 + (__typeof__(a)){0}) - _th * _dl;        \
+                                                                            \
+        _u = _th * ERFC_UA + ERFC_UB;                                       \
+        _S = _u * erfc_data.s[26] + erfc_data.s[25];                        \
+        for (_i = 24; _i >= 1; _i--)                                        \
+            _S = _S * _u + erfc_data.s[_i];                                 \
+                                                                            \
+        /* S = s0 + u * S1 = S + e, the last step cancels near a = 0 */     \
+        _p  = _S * _u;                                                      \
+        _e  = vfma(_S, _u, -_p);                                            \
+        _S  = _p + erfc_data.s[0];                                          \
+        _bb = _S - _p;                                                      \
+        _e += (_p - (_S - _bb)) + (erfc_data.s[0] - _bb);                   \
+                                                                            \
+        _h  = (a) * (a);                                                    \
+        _hl = vfma((a), (a), -_h) + 2.0 * (a) * (al);                       \
+                                                                            \
+        /* S - h = s + e */                                                 \
+        _s  = _S - _h;                                                      \
+        _bb = _s - _S;                                                      \
+        _e += (_S - (_s - _bb)) - (_h + _bb);                               \
+                                                                            \
+        _s = _th * vexp(_s);                                                \
+        _s = vfma(_s, _e - _hl + 0.5 * _r, _s);                             \
+        vsel((a) > ERFC_BOUND, (__typeof__(a)){0}, _s);                     \
+    })
+
+/*
+ * Inverse normal CDF from h = p - 0.5 and the tail probability
+ * min(p, 1 - p) = s * exp(-ls), all three rational functions evaluated
+ * and selected
+ */
+#define PPND_VEC(h, s, ls, vlog, vsqrt, vsel) ({                            \
+        __typeof__(h) _zero = (__typeof__(h)){0};                           \
+        __typeof__(h) _r = PPND_CONST1 - (h) * (h);                         \
+        __typeof__(h) _x = (h) * PPND_RATIONAL(_r, PPND_A, PPND_B);         \
+        __typeof__(h) _t, _t1, _t2, _y;                                     \
+                                                                            \
+        _t  = vsqrt((ls) - vlog(s));                                        \
+        _t1 = _t - PPND_CONST2;                                             \
+        _t2 = _t - PPND_SPLIT2;                                             \
+                                                                            \
+        _y = vsel(_t <= PPND_SPLIT2, PPND_RATIONAL(_t1, PPND_C, PPND_D),     \
+                  PPND_RATIONAL(_t2, PPND_E, PPND_F));                      \
+                                                                            \
+        /* t is +inf for p = 0 and p = 1 */                                 \
+        _y = vsel((s) == _zero, _zero + __builtin_inf(), _y);               \
+        _y = vsel((h) < _zero, -_y, _y);                                    \
+                                                                            \
+        vsel((h) * (h) <= PPND_SPLIT1 * PPND_SPLIT1, _x, _y);               \
+    })
+
+
+/*
+ * Scalar
+ */
+#define ERFC_SEL_S(c, a, b)     ((c) ? (a) : (b))
+
+static inline double
+erfc_pos_s(double a, double al)
+{
+    return ERFC_POS(a, al, ALM_PROTO(exp), __builtin_fma, ERFC_SEL_S);
+}
+
+static inline double
+erfc_s(double x)
+{
+    double r = erfc_pos_s(__builtin_fabs(x), 0.0);
+
+    return x < 0.0 ? 2.0 - r : r;
+}
+
+static inline double
+cdfnorm_s(double x)
+{
+    double zh = -x * ERFC_ISQ2_HI;
+    double zl = __builtin_fma(-x, ERFC_ISQ2_HI, -zh) + -x * ERFC_ISQ2_LO;
+
+    if (zh < 0.0)
+        return 0.5 * (2.0 - erfc_pos_s(-zh, -zl));
+
+    return 0.5 * erfc_pos_s(zh, zl);
+}
+
+static inline double
+ppnd_s(double h, double s, double ls)
+{
+    double r, t, y;
+
+    if (__builtin_fabs(h) <= PPND_SPLIT1) {
+        r = PPND_CONST1 - h * h;
+        return h * PPND_RATIONAL(r, PPND_A, PPND_B);
+    }
+
+    if (s == 0.0) {
+        y = __builtin_inf();
+    } else {
+        _mm_store_sd(&t, _mm_sqrt_sd(_mm_setzero_pd(),
+                                     _mm_set_sd(ls - ALM_PROTO(log)(s))));
+        if (t <= PPND_SPLIT2) {
+            r = t - PPND_CONST2;
+            y = PPND_RATIONAL(r, PPND_C, PPND_D);
+        } else {
+            r = t - PPND_SPLIT2;
+            y = PPND_RATIONAL(r, PPND_E, PPND_F);
+        }
+    }
+
+    return h < 0.0 ? -y : y;
+}
+
+static inline double
+cdfnorminv_s(double p)
+{
+    return ppnd_s(p - 0.5, p < 0.5 ? p : 1.0 - p, 0.0);
+}
+
+static inline double
+erfinv_s(double y)
+{
+    return ERFC_ISQ2_HI * ppnd_s(0.5 * y, 1.0 - __builtin_fabs(y), ERFC_LN2);
+}
+
+static inline double
+erfcinv_s(double y)
+{
+    double s = y < 1.0 ? y : 2.0 - y;
+
+    return ERFC_ISQ2_HI * ppnd_s(0.5 - 0.5 * y, s, ERFC_LN2);
+}
+
+/*
+ * 4 doubles
+ */
+#define ERFC_SEL_V4(c, a, b)    sel_v4_f64((v_u64x4_t)(c), a, b)
+
+static inline v_f64x4_t
+erfc_pos_v4(v_f64x4_t a, v_f64x4_t al)
+{
+    return ERFC_POS(a, al, ALM_PROTO(vrd4_exp), _mm256_fmadd_pd, ERFC_SEL_V4);
+}
+
+static inline v_f64x4_t
+erfc_v4(v_f64x4_t x)
+{
+    v_f64x4_t r = erfc_pos_v4(as_v4_f64_u64(as_v4_u64_f64(x) & ~SIGNBIT_DP64), (v_f64x4_t){});
+
+    return ERFC_SEL_V4(x < 0.0, 2.0 - r, r);
+}
+
+static inline v_f64x4_t
+cdfnorm_v4(v_f64x4_t x)
+{
+    v_f64x4_t zh  = -x * ERFC_ISQ2_HI;
+    v_f64x4_t zl  = _mm256_fmadd_pd(-x, _mm256_set1_pd(ERFC_ISQ2_HI), -zh) + -x * ERFC_ISQ2_LO;
+    v_u64x4_t sgn = (v_u64x4_t)(zh < 0.0) & SIGNBIT_DP64;
+    v_f64x4_t r   = erfc_pos_v4(as_v4_f64_u64(as_v4_u64_f64(zh) ^ sgn),
+                                as_v4_f64_u64(as_v4_u64_f64(zl) ^ sgn));
+
+    return 0.5 * ERFC_SEL_V4(zh < 0.0, 2.0 - r, r);
+}
+
+#define PPND_V4(h, s, ls)  PPND_VEC(h, s, ls, ALM_PROTO(vrd4_log), _mm256_sqrt_pd, ERFC_SEL_V4)
+
+static inline v_f64x4_t
+cdfnorminv_v4(v_f64x4_t p)
+{
+    v_f64x4_t h = p - 0.5;
+    v_f64x4_t s = _mm256_min_pd(p, 1.0 - p);
+
+    return PPND_V4(h, s, 0.0);
+}
+
+static inline v_f64x4_t
+erfinv_v4(v_f64x4_t y)
+{
+    v_f64x4_t h = 0.5 * y;
+    v_f64x4_t s = 1.0 - as_v4_f64_u64(as_v4_u64_f64(y) & ~SIGNBIT_DP64);
+
+    return ERFC_ISQ2_HI * PPND_V4(h, s, ERFC_LN2);
+}
+
+static inline v_f64x4_t
+erfcinv_v4(v_f64x4_t y)
+{
+    v_f64x4_t h = 0.5 - 0.5 * y;
+    v_f64x4_t s = _mm256_min_pd(y, 2.0 - y);
+
+    return ERFC_ISQ2_HI * PPND_V4(h, s, ERFC_LN2);
+}
+
+/* 8 floats as two halves of 4 doubles */
+#define ERFC_V8F_VIA_F64(f, x) ({                                           \
+        v_f64x4_t _lo = f(_mm256_cvtps_pd(_mm256_castps256_ps128(x)));      \
+        v_f64x4_t _hi = f(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));    \
+        (v_f32x8_t)_mm256_set_m128(_mm256_cvtpd_ps(_hi), _mm256_cvtpd_ps(_lo)); \
+    })
+
+#if defined(__AVX512F__)
+/*
+ * 8 doubles
+ */
+#define ERFC_SEL_V8(c, a, b)    sel_v8_f64((v_u64x8_t)(c), a, b)
+
+static inline v_f64x8_t
+erfc_pos_v8(v_f64x8_t a, v_f64x8_t al)
+{
+    return ERFC_POS(a, al, ALM_PROTO_ARCH(vrd8_exp), _mm512_fmadd_pd, ERFC_SEL_V8);
+}
+
+static inline v_f64x8_t
+erfc_v8(v_f64x8_t x)
+{
+    v_f64x8_t r = erfc_pos_v8(_mm512_abs_pd(x), (v_f64x8_t){});
+
+    return ERFC_SEL_V8(x < 0.0, 2.0 - r, r);
+}
+
+static inline v_f64x8_t
+cdfnorm_v8(v_f64x8_t x)
+{
+    v_f64x8_t zh  = -x * ERFC_ISQ2_HI;
+    v_f64x8_t zl  = _mm512_fmadd_pd(-x, _mm512_set1_pd(ERFC_ISQ2_HI), -zh) + -x * ERFC_ISQ2_LO;
+    v_u64x8_t sgn = (v_u64x8_t)(zh < 0.0) & SIGNBIT_DP64;
+    v_f64x8_t r   = erfc_pos_v8(as_v8_f64_u64(as_v8_u64_f64(zh) ^ sgn),
+                                as_v8_f64_u64(as_v8_u64_f64(zl) ^ sgn));
+
+    return 0.5 * ERFC_SEL_V8(zh < 0.0, 2.0 - r, r);
+}
+
+#define PPND_V8(h, s, ls)  PPND_VEC(h, s, ls, ALM_PROTO_ARCH(vrd8_log), _mm512_sqrt_pd, ERFC_SEL_V8)
+
+static inline v_f64x8_t
+cdfnorminv_v8(v_f64x8_t p)
+{
+    v_f64x8_t h = p - 0.5;
+    v_f64x8_t s = _mm512_min_pd(p, 1.0 - p);
+
+    return PPND_V8(h, s, 0.0);
+}
+
+static inline v_f64x8_t
+erfinv_v8(v_f64x8_t y)
+{
+    v_f64x8_t h = 0.5 * y;
+    v_f64x8_t s = 1.0 - _mm512_abs_pd(y);
+
+    return ERFC_ISQ2_HI * PPND_V8(h, s, ERFC_LN2);
+}
+
+static inline v_f64x8_t
+erfcinv_v8(v_f64x8_t y)
+{
+    v_f64x8_t h = 0.5 - 0.5 * y;
+    v_f64x8_t s = _mm512_min_pd(y, 2.0 - y);
+
+    return ERFC_ISQ2_HI * PPND_V8(h, s, ERFC_LN2);
+}
+
+/* 16 floats as two halves of 8 doubles */
+#define ERFC_V16F_VIA_F64(f, x) ({                                          \
+        v_f64x8_t _lo = f(_mm512_cvtps_pd(_mm512_castps512_ps256(x)));      \
+        v_f64x8_t _hi = f(_mm512_cvtps_pd(_mm256_castpd_ps(                 \
+                            _mm512_extractf64x4_pd(_mm512_castps_pd(x), 1)))); \
+        (v_f32x16_t)_mm512_castpd_ps(_mm512_insertf64x4(                    \
+            _mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(_lo))), \
+            _mm256_castps_pd(_mm512_cvtpd_ps(_hi)), 1));                    \
+    })
+#endif  /* __AVX512F__ */
+
+#endif  /* __LIBM_ERFC_COMMON_H__ */
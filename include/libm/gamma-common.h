@@ -0,0 +1,608 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Log-gamma, gamma and digamma functions, shared by the scalar, vector
+ * and array kernels of lgamma, tgamma and digamma.
+ *
+ * The arguments are reduced to a = |x| >= 0.5, with for a < 0.5
+ *     lgamma(x) = lgamma(1 + x) - log|x|
+ *     tgamma(x) = tgamma(1 + x) / x
+ * and x <= -0.5 handled by the reflection formula at the end.
+ *
+ * 0.5 <= a < 1.5, t = a - 1 (exact):
+ *     lgamma(a) = t * B(t),          B of degree 26 on [-0.5, 0.5]
+ * 1.5 <= a < 8, a = z + k, z in [1.5, 3), k < 6, t = z - 2 (exact):
+ *     lgamma(a) = t * A(t) + log(p), A of degree 22 on [-0.5, 1],
+ *     p = z (z + 1) ... (z + k - 1)
+ * a >= 8, Stirling's series with the log kernel:
+ *     lgamma(a) = (a - 0.5) (log(a) - 1) + log(2 pi) / 2 - 0.5
+ *                 + sum B2k / (2k (2k - 1) a^(2k - 1)),   k = 1 .. 10
+ *
+ * A and B take the zeros of lgamma at 1 and 2 out as the factor t, so the
+ * result keeps its relative accuracy there. tgamma is exp() of the same
+ * polynomials times p below 8, and above
+ *     tgamma(a) = pow(a, a - 0.5) * exp(-a) * sqrt(2 pi) * exp(S)
+ * with S the series above, and from a = 140 on with pow(a, (a - 0.5) / 2)
+ * applied twice, so that no intermediate overflows before the result
+ * does.
+ *
+ * digamma is reduced to w = x + 1 for 0 < x < 1 and w = 1 - x for x < 0,
+ * then
+ * 1 <= w < 8, w = z + k, z in [1, 3):
+ *     digamma(w) = (z - x0) * P(z - 2.5) + sum 1 / (z + i),  i < k
+ * with x0 the positive zero of digamma held in double-double and P of
+ * degree 28, and for w >= 8
+ *     digamma(w) = log(w) - 1 / (2w) - sum B2k / (2k w^2k),  k = 1 .. 11
+ *
+ * Negative arguments use the reflection formulas
+ *     lgamma(x)  = log(pi) - log|x sin(pi x)| - lgamma(-x)
+ *     tgamma(x)  = -pi / (x sin(pi x) tgamma(-x))
+ *     digamma(x) = digamma(1 - x) - pi cot(pi x)
+ * with sin(pi r) and cos(pi r) as Taylor polynomials after the exact
+ * reduction of |x| to r in [-0.5, 0.5]. They lose relative accuracy near
+ * the zeros of lgamma and digamma below 0, as do most implementations.
+ * lgamma does not set signgam.
+ *
+ * A, B and P are Chebyshev interpolants computed in quad precision and
+ * rounded to double, with a relative error below 2^-53 over their
+ * intervals.
+ *
+ * The vector forms evaluate all ranges and select, with exp, log and pow
+ * from the vrd4 kernels, and on AVX-512 from the vrd8 kernels named by
+ * ALM_PROTO_ARCH(), so the zen4/zen5 wrappers define ALM_OVERRIDE. The
+ * reflection is only computed when a lane needs it. The float kernels
+ * are evaluated in double through the same code.
+ */
+
+#ifndef __LIBM_GAMMA_COMMON_H__
+#define __LIBM_GAMMA_COMMON_H__
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <immintrin.h>
+
+#define GAMMA_STIRLING_BOUND    8.0
+#define GAMMA_SHIFT             0x1p52                    /* rounds 0 <= a < 2^52 to an integer */
+#define GAMMA_HLOG2PI_M_HALF    0x1.acfe390c97d69p-2      /* log(2 pi) / 2 - 0.5 */
+#define GAMMA_LOGPI             0x1.250d048e7a1bdp+0
+#define GAMMA_SQRT2PI           0x1.40d931ff62706p+1
+#define GAMMA_PI                0x1.921fb54442d18p+1
+#define GAMMA_PI_LO             0x1.1a62633145c07p-53
+#define TGAMMA_OVERFLOW         0x1.573fae561f647p+7      /* 171.62437695630272 */
+#define TGAMMA_UNDERFLOW        190.0                     /* tgamma(x) rounds to 0 below -190 */
+#define TGAMMA_POW_SPLIT        140.0                     /* a^(a - 0.5) overflows above 143 */
+#define DIGAMMA_X0_HI           0x1.762d86356be3fp+0
+#define DIGAMMA_X0_LO           0x1.b86a722197829p-54
+
+static const struct {
+    double b[27], a[23], p[29];
+    double ls[10], ds[11];
+    double sinpi[12], cospi[13];
+} gamma_data = {
+    /* lgamma(1 + t) / t */
+    .b = {
+        -0x1.2788cfc6fb619p-1,  0x1.a51a6625307dep-1,
+        -0x1.9a4d55beab2ecp-2,  0x1.151322ac7ae9ap-2,
+        -0x1.a8b9c17aa107ap-3,  0x1.5b40cb12f7073p-3,
+        -0x1.2703a1dfbe277p-3,  0x1.010b35ed62478p-3,
+        -0x1.c8066ef4fb27cp-4,  0x1.9a021c345d517p-4,
+        -0x1.748c6a0220f9fp-4,  0x1.5565b242dea9cp-4,
+        -0x1.3b189ba4be509p-4,  0x1.24e56c2585839p-4,
+        -0x1.115f563420986p-4,  0x1.f9a2e1a6a7a4cp-5,
+        -0x1.dbb5fb77f48d9p-5,  0x1.f49fa5f1945d8p-5,
+        -0x1.db4381594a2ep-5,  0x1.76b23d342cd58p-6,
+        -0x1.5d74f3ab0a6d6p-6,  0x1.1116ae4a0d662p-3,
+        -0x1.0770e02c9a3fcp-3, -0x1.1239968affa53p-3,
+         0x1.0a5f6b5965e57p-3,  0x1.bdfb119b3a68fp-3,
+        -0x1.af645395fc0ffp-3,
+    },
+    /* lgamma(2 + t) / t */
+    .a = {
+         0x1.b0ee6072093cep-2,  0x1.4a34cc4a60fa6p-2,
+        -0x1.13e001a557602p-4,  0x1.51322ac7d846cp-6,
+        -0x1.e404fc2190c46p-8,  0x1.7add6eadbb989p-9,
+        -0x1.38ac5c2b42613p-10,  0x1.0b36af8314d16p-11,
+        -0x1.d3fd4ccfc4ba8p-13,  0x1.a127b2eb5fefep-14,
+        -0x1.78de51325586dp-15,  0x1.580d7980d769fp-16,
+        -0x1.3cbd06da420fep-17,  0x1.259f8ccc0d66dp-18,
+        -0x1.11bb050a2404dp-19,  0x1.0006cb8ec5c67p-20,
+        -0x1.e02f76391be7cp-22,  0x1.c9b8a6f880782p-23,
+        -0x1.c43a03b00e0ecp-24,  0x1.b76baace3240bp-25,
+        -0x1.6402863555963p-26,  0x1.80c36b5741fb1p-28,
+        -0x1.8846bb442c25dp-31,
+    },
+    /* digamma(z) / (z - x0) in z - 2.5 */
+    .p = {
+         0x1.5ab6aae23d76fp-1, -0x1.7076dd084650ap-3,
+         0x1.e7a7b8bd0025fp-5, -0x1.5e73b6034f772p-6,
+         0x1.0673e56dbee52p-7, -0x1.926b49b04a8dp-9,
+         0x1.38f58fe2daeeap-10, -0x1.eb3d22550f55p-12,
+         0x1.83dcb5b1b599p-13, -0x1.337ad1a6922c5p-14,
+         0x1.e8c02820c23f8p-16, -0x1.85501d08b369fp-17,
+         0x1.395d20af93b97p-18, -0x1.e410ef5f5b128p-20,
+         0x1.332a56c0e6ad8p-21, -0x1.64688cdf718efp-21,
+         0x1.21b361d6a40adp-22,  0x1.4553d02480d5dp-20,
+         0x1.2be8e847928bap-20, -0x1.624a3d272caefp-20,
+        -0x1.cfb32b25016acp-19, -0x1.29d1a2f44afbp-19,
+         0x1.8e05f1d473bfep-20,  0x1.08aef78b758fep-18,
+         0x1.e09508e177b4p-19,  0x1.fa8813bd275abp-20,
+         0x1.4851bff7485e4p-21,  0x1.ea9012286721cp-24,
+         0x1.470ab9594d481p-27,
+    },
+    /* B2k / (2k (2k - 1)) */
+    .ls = {
+         0x1.5555555555555p-4, -0x1.6c16c16c16c17p-9,
+         0x1.a01a01a01a01ap-11, -0x1.3813813813814p-11,
+         0x1.b951e2b18ff23p-11, -0x1.f6ab0d9993c7dp-10,
+         0x1.a41a41a41a41ap-8, -0x1.e4286cb0f5398p-6,
+         0x1.6fe96381e068p-3, -0x1.6476701181f3ap+0,
+    },
+    /* B2k / 2k */
+    .ds = {
+         0x1.5555555555555p-4, -0x1.1111111111111p-7,
+         0x1.041041041041p-8, -0x1.1111111111111p-8,
+         0x1.f07c1f07c1f08p-8, -0x1.5995995995996p-6,
+         0x1.5555555555555p-4, -0x1.c5e5e5e5e5e5ep-2,
+         0x1.86e7f9b9fe6e8p+1, -0x1.a74ca514ca515p+4,
+         0x1.1975cc0ed7304p+8,
+    },
+    /* sin(pi r) and cos(pi r) in r^2 */
+    .sinpi = {
+         0x1.921fb54442d18p+1, -0x1.4abbce625be53p+2,
+         0x1.466bc6775aae2p+1, -0x1.32d2cce62bd86p-1,
+         0x1.50783487ee782p-4, -0x1.e3074fde8871fp-8,
+         0x1.e8f434d018d63p-12, -0x1.6fadb9f155744p-16,
+         0x1.aaec32af93359p-21, -0x1.8a404211f9547p-26,
+         0x1.2877020d52cfp-31, -0x1.7215f879e1ac9p-37,
+    },
+    .cospi = {
+         0x1p+0, -0x1.3bd3cc9be45dep+2,
+         0x1.03c1f081b5ac4p+2, -0x1.55d3c7e3cbffap+0,
+         0x1.e1f506891babbp-3, -0x1.a6d1f2a204a8cp-6,
+         0x1.f9d38a3763cc3p-10, -0x1.b6e24f44b128fp-14,
+         0x1.20c62c2f2d7f5p-18, -0x1.2a0c591af8314p-23,
+         0x1.ef6e308d6d1c4p-29, -0x1.52ae4120fde27p-34,
+         0x1.838d8f43218p-40,
+    },
+};
+
+/* c[0] + c[1] t + ... + c[n] t^n, t must not be an expression */
+#define GAMMA_POLY(t, c, n) ({                                              \
+        __typeof__(t) _pq = (t) * (c)[n] + (c)[(n) - 1];                    \
+        int _pj;                                                            \
+        for (_pj = (n) - 2; _pj >= 0; _pj--)                                \
+            _pq = _pq * (t) + (c)[_pj];                                     \
+        _pq;                                                                \
+    })
+
+/* sin(pi r) for |r| <= 0.5, pi r carried with the low part of pi */
+#define GAMMA_SINPI(r, vfma) ({                                             \
+        __typeof__(r) _sr2 = (r) * (r);                                     \
+        __typeof__(r) _ss  = _sr2 * GAMMA_POLY(_sr2, gamma_data.sinpi + 1, 10); \
+        vfma((r), GAMMA_PI + (__typeof__(r)){0}, (r) * (GAMMA_PI_LO + _ss)); \
+    })
+
+#define GAMMA_COSPI(r) ({                                                   \
+        __typeof__(r) _cr2 = (r) * (r);                                     \
+        GAMMA_POLY(_cr2, gamma_data.cospi, 12);                             \
+    })
+
+/* sum B2k / (2k (2k - 1) a^(2k - 1)), w = 1 / a */
+#define GAMMA_STIRLING(w) ({                                                \
+        __typeof__(w) _sw2 = (w) * (w);                                     \
+        (w) * GAMMA_POLY(_sw2, gamma_data.ls, 9);                           \
+    })
+
+/* exp(s) for |s| <= 1/96 */
+#define GAMMA_EXP_SMALL(s)                                                  \
+    (1.0 + (s) * (1.0 + (s) * (0.5 + (s) * (0x1.5555555555555p-3 +          \
+     (s) * (0x1.5555555555555p-5 + (s) * (0x1.1111111111111p-7 +            \
+     (s) * 0x1.6c16c16c16c17p-10))))))
+
+/*
+ * Reduction of 1.5 <= a < 8 to z in [1.5, 3) (or z in [1, 3) for
+ * digamma), the product p of z .. z + k - 1 and for digamma the sum
+ * n / d of their reciprocals. Lanes below 3 are left alone.
+ */
+#define GAMMA_SHIFT_DOWN(a, z, p, vsel) do {                                \
+        int _gk;                                                            \
+        (z) = (a);                                                          \
+        (p) = 1.0 + (__typeof__(a)){0};                                     \
+        for (_gk = 0; _gk < 5; _gk++) {                                     \
+            __typeof__((z) < 0.0) _gm = (z) >= 3.0;                         \
+            (z) = vsel(_gm, (z) - 1.0, (z));                                \
+            (p) = vsel(_gm, (p) * (z), (p));                                \
+        }                                                                   \
+    } while (0)
+
+#define DIGAMMA_SHIFT_DOWN(w, z, n, d, vfma, vsel) do {                     \
+        int _dk;                                                            \
+        (z) = (w);                                                          \
+        (n) = (__typeof__(w)){0};                                           \
+        (d) = 1.0 + (__typeof__(w)){0};                                     \
+        for (_dk = 0; _dk < 5; _dk++) {                                     \
+            __typeof__((z) < 0.0) _dm = (z) >= 3.0;                         \
+            (z) = vsel(_dm, (z) - 1.0, (z));                                \
+            (n) = vsel(_dm, vfma((n), (z), (d)), (n));                      \
+            (d) = vsel(_dm, (d) * (z), (d));                                \
+        }                                                                   \
+    } while (0)
+
+/* r = a - nearest integer, 0 for a >= 2^52 (and for a = inf) */
+#define GAMMA_FRAC(a, vsel) ({                                              \
+        __typeof__(a) _fr = (a) - (((a) + GAMMA_SHIFT) - GAMMA_SHIFT);      \
+        vsel((a) >= GAMMA_SHIFT, (__typeof__(a)){0}, _fr);                  \
+    })
+
+/*
+ * Vector forms, vsel(c, a, b) selects a where the comparison c holds and
+ * vany(c) is true when it holds for any lane
+ */
+#define LGAMMA_VEC(x, vabs, vlog, vfma, vsel, vany) ({                      \
+        __typeof__(x) _zero = (__typeof__(x)){0};                           \
+        __typeof__(x) _a = vabs(x);                                         \
+        __typeof__(x) _t, _z, _p, _l, _r, _w, _st;                          \
+                                                                            \
+        _t = vsel(_a < 0.5, (x), _a - 1.0);                                 \
+        _t = _t * GAMMA_POLY(_t, gamma_data.b, 26);                         \
+                                                                            \
+        GAMMA_SHIFT_DOWN(_a, _z, _p, vsel);                                 \
+        _z = _z - 2.0;                                                      \
+        _z = _z * GAMMA_POLY(_z, gamma_data.a, 22);                         \
+                                                                            \
+        _l = vlog(vsel((_a < 0.5) | (_a >= GAMMA_STIRLING_BOUND), _a, _p)); \
+        _w  = 1.0 / _a;                                                     \
+        _st = vfma(_a - 0.5, _l - 1.0, GAMMA_HLOG2PI_M_HALF + GAMMA_STIRLING(_w)); \
+                                                                            \
+        _r = vsel(_a < 1.5, _t + 0.0, _z + _l);     /* +0 at a = 1 */       \
+        _r = vsel(_a < 0.5, _t - _l, _r);                                   \
+        _r = vsel(_a >= GAMMA_STIRLING_BOUND, _st, _r);                     \
+                                                                            \
+        if (vany((x) <= -0.5)) {                                            \
+            __typeof__(x) _f = GAMMA_FRAC(_a, vsel);                        \
+            __typeof__(x) _s = _a * GAMMA_SINPI(_f, vfma);                  \
+            _s = GAMMA_LOGPI - vlog(vabs(_s)) - _r;                         \
+            _r = vsel((x) <= -0.5, _s, _r);                                 \
+        }                                                                   \
+                                                                            \
+        vsel(_a == _zero + __builtin_inf(), _a, _r);                        \
+    })
+
+#define TGAMMA_VEC(x, vabs, vexp, vpow, vfma, vsel, vany) ({                \
+        __typeof__(x) _zero = (__typeof__(x)){0};                           \
+        __typeof__(x) _one  = _zero + 1.0;                                  \
+        __typeof__(x) _a = vabs(x);                                         \
+        __typeof__(x) _t, _z, _p, _e, _g1, _g2, _r;                         \
+        __typeof__((x) < 0.0) _big = _a >= GAMMA_STIRLING_BOUND;            \
+                                                                            \
+        _t = vsel(_a < 0.5, (x), _a - 1.0);                                 \
+        _t = _t * GAMMA_POLY(_t, gamma_data.b, 26);                         \
+                                                                            \
+        GAMMA_SHIFT_DOWN(_a, _z, _p, vsel);                                 \
+        _z = _z - 2.0;                                                      \
+        _z = _z * GAMMA_POLY(_z, gamma_data.a, 22);                         \
+                                                                            \
+        _e  = vexp(vsel(_big, -_a, vsel(_a < 1.5, _t, _z)));                \
+        _g1 = _one;                                                         \
+        _g2 = vsel(_a < 1.5, _e, _e * _p);                                  \
+        _g2 = vsel(_a < 0.5, _e / (x), _g2);                                \
+                                                                            \
+        if (vany(_big)) {                                                   \
+            __typeof__(x) _w = 1.0 / _a;                                    \
+            __typeof__(x) _s = GAMMA_STIRLING(_w);                          \
+            __typeof__((x) < 0.0) _split = _a >= TGAMMA_POW_SPLIT;          \
+            __typeof__(x) _y = vpow(_a, vsel(_split, 0.5 * (_a - 0.5), _a - 0.5)); \
+            _g1 = vsel(_split, _y, _one);                                   \
+            _g2 = vsel(_big, _y * (_e * GAMMA_SQRT2PI * GAMMA_EXP_SMALL(_s)), _g2); \
+        }                                                                   \
+                                                                            \
+        _r = _g1 * _g2;                                                     \
+        _r = vsel((x) > TGAMMA_OVERFLOW, _zero + __builtin_inf(), _r);      \
+                                                                            \
+        if (vany((x) <= -0.5)) {                                            \
+            __typeof__(x) _f = GAMMA_FRAC(_a, vsel);                        \
+            __typeof__(x) _q = -GAMMA_PI / (_a * GAMMA_SINPI(_f, vfma));    \
+            __typeof__(x) _h = 0.5 * ((_a + GAMMA_SHIFT) - GAMMA_SHIFT);    \
+                                                                            \
+            /* sin(pi a) = -sin(pi f) for an odd nearest integer */         \
+            _q = vsel(((_h + GAMMA_SHIFT) - GAMMA_SHIFT) != _h, -_q, _q);   \
+            _q = vsel(_a > TGAMMA_UNDERFLOW, _q * 0.0, (_q / _g1) / _g2);   \
+            _q = vsel(_f == _zero, _zero + __builtin_nan(""), _q);          \
+            _r = vsel((x) <= -0.5, _q, _r);                                 \
+        }                                                                   \
+                                                                            \
+        _r;                                                                 \
+    })
+
+#define DIGAMMA_VEC(x, vlog, vfma, vsel, vany) ({                           \
+        __typeof__(x) _zero = (__typeof__(x)){0};                           \
+        __typeof__(x) _w, _z, _n, _d, _l, _v, _r;                           \
+                                                                            \
+        _w = vsel((x) < 1.0, (x) + 1.0, (x));                               \
+        _w = vsel((x) < 0.0, 1.0 - (x), _w);                                \
+                                                                            \
+        DIGAMMA_SHIFT_DOWN(_w, _z, _n, _d, vfma, vsel);                     \
+        _v = _z - 2.5;                                                      \
+        _r = (((_z - DIGAMMA_X0_HI) - DIGAMMA_X0_LO) *                      \
+              GAMMA_POLY(_v, gamma_data.p, 28)) + _n / _d;                  \
+                                                                            \
+        _v = 1.0 / _w;                                                      \
+        _d = _v * _v;                                                       \
+        _l = vlog(_w) - 0.5 * _v - _d * GAMMA_POLY(_d, gamma_data.ds, 10);  \
+        _r = vsel(_w >= GAMMA_STIRLING_BOUND, _l, _r);                      \
+                                                                            \
+        /* -1 / x, +-inf at +-0 */                                          \
+        _r = vsel(((x) < 1.0) & ((x) >= 0.0), _r - 1.0 / (x), _r);          \
+                                                                            \
+        if (vany((x) < 0.0)) {                                              \
+            __typeof__(x) _a = -(x);                                        \
+            __typeof__(x) _f = GAMMA_FRAC(_a, vsel);                        \
+            __typeof__(x) _c;                                               \
+                                                                            \
+            /* -pi cot(pi x) = pi cot(pi f) */                              \
+            _c = GAMMA_PI * GAMMA_COSPI(_f) / GAMMA_SINPI(_f, vfma);        \
+            _c = vsel(_f == _zero, _zero + __builtin_nan(""), _r + _c);     \
+            _r = vsel((x) < 0.0, _c, _r);                                   \
+        }                                                                   \
+                                                                            \
+        _r;                                                                 \
+    })
+
+
+/*
+ * Scalar
+ */
+/* lgamma(a) for a >= 0.5 */
+static inline double
+lgamma_pos_s(double a)
+{
+    double t, p, w;
+
+    if (a < 1.5) {
+        t = a - 1.0;
+        return t * GAMMA_POLY(t, gamma_data.b, 26) + 0.0;     /* +0 at a = 1 */
+    }
+
+    if (a < GAMMA_STIRLING_BOUND) {
+        p = 1.0;
+        while (a >= 3.0) {
+            a -= 1.0;
+            p *= a;
+        }
+        t = a - 2.0;
+        t = t * GAMMA_POLY(t, gamma_data.a, 22);
+
+        return p == 1.0 ? t : t + ALM_PROTO(log)(p);
+    }
+
+    w = 1.0 / a;
+
+    return __builtin_fma(a - 0.5, ALM_PROTO(log)(a) - 1.0,
+                         GAMMA_HLOG2PI_M_HALF + GAMMA_STIRLING(w));
+}
+
+static inline double
+lgamma_s(double x)
+{
+    double a = __builtin_fabs(x), r, f;
+
+    if (!(a < __builtin_inf()))
+        return x * x;                   /* inf or nan */
+
+    if (a < 0.5)
+        return x * GAMMA_POLY(x, gamma_data.b, 26) - ALM_PROTO(log)(a);
+
+    r = lgamma_pos_s(a);
+    if (x > 0.0)
+        return r;
+
+    f = a < GAMMA_SHIFT ? a - ((a + GAMMA_SHIFT) - GAMMA_SHIFT) : 0.0;
+    if (f == 0.0)
+        return __builtin_inf();         /* pole */
+
+    return GAMMA_LOGPI -
+           ALM_PROTO(log)(__builtin_fabs(a * GAMMA_SINPI(f, __builtin_fma))) - r;
+}
+
+static inline double
+tgamma_s(double x)
+{
+    double a = __builtin_fabs(x), g1 = 1.0, g2, t, z, p, f, h, q;
+
+    if (x != x || x == __builtin_inf())
+        return x + x;
+
+    if (a < 0.5) {
+        t = x * GAMMA_POLY(x, gamma_data.b, 26);
+        return ALM_PROTO(exp)(t) / x;
+    }
+
+    if (x > TGAMMA_OVERFLOW)
+        return __builtin_inf();
+
+    if (a < 1.5) {
+        t  = a - 1.0;
+        g2 = ALM_PROTO(exp)(t * GAMMA_POLY(t, gamma_data.b, 26));
+    } else if (a < GAMMA_STIRLING_BOUND) {
+        z = a;
+        p = 1.0;
+        while (z >= 3.0) {
+            z -= 1.0;
+            p *= z;
+        }
+        t  = z - 2.0;
+        g2 = ALM_PROTO(exp)(t * GAMMA_POLY(t, gamma_data.a, 22)) * p;
+    } else {
+        if (x < -TGAMMA_UNDERFLOW)
+            g2 = 0.0;                   /* sign and poles below */
+        else {
+            t  = 1.0 / a;
+            t  = GAMMA_STIRLING(t);
+            if (a < TGAMMA_POW_SPLIT) {
+                g2 = ALM_PROTO(pow)(a, a - 0.5);
+            } else {
+                g1 = ALM_PROTO(pow)(a, 0.5 * (a - 0.5));
+                g2 = g1;
+            }
+            g2 *= ALM_PROTO(exp)(-a) * GAMMA_SQRT2PI * GAMMA_EXP_SMALL(t);
+        }
+    }
+
+    if (x > 0.0)
+        return g1 * g2;
+
+    f = a < GAMMA_SHIFT ? a - ((a + GAMMA_SHIFT) - GAMMA_SHIFT) : 0.0;
+    if (f == 0.0)
+        return __builtin_nan("");       /* pole, or -inf */
+
+    q = -GAMMA_PI / (a * GAMMA_SINPI(f, __builtin_fma));
+    h = 0.5 * ((a + GAMMA_SHIFT) - GAMMA_SHIFT);
+    if (((h + GAMMA_SHIFT) - GAMMA_SHIFT) != h)
+        q = -q;
+
+    return g2 == 0.0 ? q * 0.0 : (q / g1) / g2;
+}
+
+static inline double
+digamma_s(double x)
+{
+    double w = x, r = 0.0, v, n, d, f;
+
+    if (x != x || x == __builtin_inf())
+        return x + x;
+
+    if (x < 0.0) {
+        f = -x < GAMMA_SHIFT ? -x - ((-x + GAMMA_SHIFT) - GAMMA_SHIFT) : 0.0;
+        if (f == 0.0)
+            return __builtin_nan("");   /* pole, or -inf */
+
+        /* -pi cot(pi x) = pi cot(pi f) */
+        r = GAMMA_PI * GAMMA_COSPI(f) / GAMMA_SINPI(f, __builtin_fma);
+        w = 1.0 - x;
+    } else if (x < 1.0) {
+        r = -1.0 / x;
+        w = x + 1.0;
+    }
+
+    if (w >= GAMMA_STIRLING_BOUND) {
+        v = 1.0 / w;
+        d = v * v;
+        return r + (ALM_PROTO(log)(w) - 0.5 * v - d * GAMMA_POLY(d, gamma_data.ds, 10));
+    }
+
+    n = 0.0;
+    d = 1.0;
+    while (w >= 3.0) {
+        w -= 1.0;
+        n  = __builtin_fma(n, w, d);
+        d *= w;
+    }
+    v = w - 2.5;
+
+    return r + (((w - DIGAMMA_X0_HI) - DIGAMMA_X0_LO) * GAMMA_POLY(v, gamma_data.p, 28) + n / d);
+}
+
+/*
+ * 4 doubles
+ */
+#define GAMMA_SEL_V4(c, a, b)   sel_v4_f64((v_u64x4_t)(c), a, b)
+#define GAMMA_ANY_V4(c)         any_v4_u64_loop((v_u64x4_t)(c))
+#define GAMMA_ABS_V4(x)         as_v4_f64_u64(as_v4_u64_f64(x) & ~SIGNBIT_DP64)
+
+static inline v_f64x4_t
+lgamma_v4(v_f64x4_t x)
+{
+    return LGAMMA_VEC(x, GAMMA_ABS_V4, ALM_PROTO(vrd4_log), _mm256_fmadd_pd,
+                      GAMMA_SEL_V4, GAMMA_ANY_V4);
+}
+
+static inline v_f64x4_t
+tgamma_v4(v_f64x4_t x)
+{
+    return TGAMMA_VEC(x, GAMMA_ABS_V4, ALM_PROTO(vrd4_exp), ALM_PROTO(vrd4_pow),
+                      _mm256_fmadd_pd, GAMMA_SEL_V4, GAMMA_ANY_V4);
+}
+
+static inline v_f64x4_t
+digamma_v4(v_f64x4_t x)
+{
+    return DIGAMMA_VEC(x, ALM_PROTO(vrd4_log), _mm256_fmadd_pd,
+                       GAMMA_SEL_V4, GAMMA_ANY_V4);
+}
+
+/* 8 floats as two halves of 4 doubles */
+#define GAMMA_V8F_VIA_F64(f, x) ({                                          \
+        v_f64x4_t _lo = f(_mm256_cvtps_pd(_mm256_castps256_ps128(x)));      \
+        v_f64x4_t _hi = f(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));    \
+        (v_f32x8_t)_mm256_set_m128(_mm256_cvtpd_ps(_hi), _mm256_cvtpd_ps(_lo)); \
+    })
+
+#if defined(__AVX512F__)
+/*
+ * 8 doubles
+ */
+#define GAMMA_SEL_V8(c, a, b)   sel_v8_f64((v_u64x8_t)(c), a, b)
+#define GAMMA_ANY_V8(c)         any_v8_u64_loop((v_u64x8_t)(c))
+
+static inline v_f64x8_t
+lgamma_v8(v_f64x8_t x)
+{
+    return LGAMMA_VEC(x, _mm512_abs_pd, ALM_PROTO_ARCH(vrd8_log), _mm512_fmadd_pd,
+                      GAMMA_SEL_V8, GAMMA_ANY_V8);
+}
+
+static inline v_f64x8_t
+tgamma_v8(v_f64x8_t x)
+{
+    return TGAMMA_VEC(x, _mm512_abs_pd, ALM_PROTO_ARCH(vrd8_exp), ALM_PROTO_ARCH(vrd8_pow),
+                      _mm512_fmadd_pd, GAMMA_SEL_V8, GAMMA_ANY_V8);
+}
+
+static inline v_f64x8_t
+digamma_v8(v_f64x8_t x)
+{
+    return DIGAMMA_VEC(x, ALM_PROTO_ARCH(vrd8_log), _mm512_fmadd_pd,
+                       GAMMA_SEL_V8, GAMMA_ANY_V8);
+}
+
+/* 16 floats as two halves of 8 doubles */
+#define GAMMA_V16F_VIA_F64(f, x) ({                                         \
+        v_f64x8_t _lo = f(_mm512_cvtps_pd(_mm512_castps512_ps256(x)));      \
+        v_f64x8_t _hi = f(_mm512_cvtps_pd(_mm256_castpd_ps(                 \
+                            _mm512_extractf64x4_pd(_mm512_castps_pd(x), 1)))); \
+        (v_f32x16_t)_mm512_castpd_ps(_mm512_insertf64x4(                    \
+            _mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(_lo))), \
+            _mm256_castps_pd(_mm512_cvtpd_ps(_hi)), 1));                    \
+    })
+#endif  /* __AVX512F__ */
+
+#endif  /* __LIBM_GAMMA_COMMON_H__ */
@@ -117,6 +117,44 @@ enum {
     C_AMD_CEXP,
     C_AMD_CPOW,
     C_AMD_CLOG,
+    C_AMD_CSIN,
+    C_AMD_CCOS,
+    C_AMD_CTAN,
+    C_AMD_CSQRT,
+    C_AMD_CABS,
+    C_AMD_CARG,
+    C_AMD_SIGMOID,
+    C_AMD_POWN,
+    C_AMD_ROOTN,
+    C_AMD_EXP_AFFINE,
+    C_AMD_LOG_AFFINE,
+    C_AMD_POW_AFFINE,
+    C_AMD_SIN_AFFINE,
+    C_AMD_COS_AFFINE,
+    C_AMD_TANH_AFFINE,
+    C_AMD_SUMEXP,
+    C_AMD_LOGSUMEXP,
+    C_AMD_SUMLOG,
+    C_AMD_SILU,
+    C_AMD_SOFTPLUS,
+    C_AMD_GELU,
+    C_AMD_GELU_TANH,
+    C_AMD_SOFTMAX,
+    C_AMD_CIS,
+    C_AMD_POLAR,
+    C_AMD_BOXMULLER,
+    C_AMD_CDFNORMINV,
+    C_AMD_ERFC,
+    C_AMD_ERFINV,
+    C_AMD_ERFCINV,
+    C_AMD_CDFNORM,
+    C_AMD_LGAMMA,
+    C_AMD_TGAMMA,
+    C_AMD_DIGAMMA,
+    C_AMD_RSQRT,
+    C_AMD_RSQRT_APPROX,
+    C_AMD_INVCBRT,
+    C_AMD_RHYPOT,
 
     /*
      * This one needs to be last one, REALLY !!!
@@ -196,6 +234,44 @@ extern void LIBM_IFACE_PROTO(erf)(void *arg);
 extern void LIBM_IFACE_PROTO(cexp)(void *arg);
 extern void LIBM_IFACE_PROTO(clog)(void *arg);
 extern void LIBM_IFACE_PROTO(cpow)(void *arg);
+extern void LIBM_IFACE_PROTO(csin)(void *arg);
+extern void LIBM_IFACE_PROTO(ccos)(void *arg);
+extern void LIBM_IFACE_PROTO(ctan)(void *arg);
+extern void LIBM_IFACE_PROTO(csqrt)(void *arg);
+extern void LIBM_IFACE_PROTO(cabs)(void *arg);
+extern void LIBM_IFACE_PROTO(carg)(void *arg);
+extern void LIBM_IFACE_PROTO(sigmoid)(void *arg);
+extern void LIBM_IFACE_PROTO(pown)(void *arg);
+extern void LIBM_IFACE_PROTO(rootn)(void *arg);
+extern void LIBM_IFACE_PROTO(exp_affine)(void *arg);
+extern void LIBM_IFACE_PROTO(log_affine)(void *arg);
+extern void LIBM_IFACE_PROTO(pow_affine)(void *arg);
+extern void LIBM_IFACE_PROTO(sin_affine)(void *arg);
+extern void LIBM_IFACE_PROTO(cos_affine)(void *arg);
+extern void LIBM_IFACE_PROTO(tanh_affine)(void *arg);
+extern void LIBM_IFACE_PROTO(sumexp)(void *arg);
+extern void LIBM_IFACE_PROTO(logsumexp)(void *arg);
+extern void LIBM_IFACE_PROTO(sumlog)(void *arg);
+extern void LIBM_IFACE_PROTO(silu)(void *arg);
+extern void LIBM_IFACE_PROTO(softplus)(void *arg);
+extern void LIBM_IFACE_PROTO(gelu)(void *arg);
+extern void LIBM_IFACE_PROTO(gelu_tanh)(void *arg);
+extern void LIBM_IFACE_PROTO(softmax)(void *arg);
+extern void LIBM_IFACE_PROTO(cis)(void *arg);
+extern void LIBM_IFACE_PROTO(polar)(void *arg);
+extern void LIBM_IFACE_PROTO(boxmuller)(void *arg);
+extern void LIBM_IFACE_PROTO(cdfnorminv)(void *arg);
+extern void LIBM_IFACE_PROTO(erfc)(void *arg);
+extern void LIBM_IFACE_PROTO(erfinv)(void *arg);
+extern void LIBM_IFACE_PROTO(erfcinv)(void *arg);
+extern void LIBM_IFACE_PROTO(cdfnorm)(void *arg);
+extern void LIBM_IFACE_PROTO(lgamma)(void *arg);
+extern void LIBM_IFACE_PROTO(tgamma)(void *arg);
+extern void LIBM_IFACE_PROTO(digamma)(void *arg);
+extern void LIBM_IFACE_PROTO(rsqrt)(void *arg);
+extern void LIBM_IFACE_PROTO(rsqrt_approx)(void *arg);
+extern void LIBM_IFACE_PROTO(invcbrt)(void *arg);
+extern void LIBM_IFACE_PROTO(rhypot)(void *arg);
 extern void LIBM_IFACE_PROTO(add)(void *arg);
 extern void LIBM_IFACE_PROTO(sub)(void *arg);
 extern void LIBM_IFACE_PROTO(mul)(void *arg);
@@ -210,9 +286,13 @@ extern void LIBM_IFACE_PROTO(fmaxi)(void *arg);
 extern void LIBM_IFACE_PROTO(fmini)(void *arg);
 extern void LIBM_IFACE_PROTO(linearfrac)(void *arg);
 
+struct alm_arch_funcs;
+
 struct entry_pt_interface {
     void (*epi_init)(void *arg);
     void *epi_arg;
+    const char *epi_name;                       /* function name, "exp" */
+    const struct alm_arch_funcs *epi_funcs;     /* set by alm_iface_fixup() */
 };
 
 extern struct entry_pt_interface entry_pt_initializers[C_AMD_LAST_ENTRY];
@@ -237,6 +317,9 @@ enum ALM_FUNC_VARIANTS {
     ALM_FUNC_VECT_HP_8,  /* Half Precision */
     ALM_FUNC_VECT_HP_16,
     ALM_FUNC_VECT_HP_32,
+    ALM_FUNC_VECT_HP_ARR,
+    ALM_FUNC_VECT_BF16_ARR,      /* bfloat16 in, bfloat16 out */
+    ALM_FUNC_VECT_BF16_F32_ARR,  /* bfloat16 in, float out */
 
     ALM_FUNC_VECT_SP_16,
     ALM_FUNC_VECT_DP_8,
@@ -244,6 +327,16 @@ enum ALM_FUNC_VARIANTS {
     ALM_FUNC_SCAL_SP_CMPLX, /* Complex variant */
     ALM_FUNC_SCAL_DP_CMPLX,
 
+    ALM_FUNC_VECT_SP_CMPLX_8,   /* Complex, split re/im registers */
+    ALM_FUNC_VECT_SP_CMPLX_16,
+    ALM_FUNC_VECT_DP_CMPLX_4,
+    ALM_FUNC_VECT_DP_CMPLX_8,
+
+    ALM_FUNC_VECT_SP_CMPLX_ARR, /* Complex array, interleaved re/im */
+    ALM_FUNC_VECT_DP_CMPLX_ARR,
+    ALM_FUNC_VECT_SP_CMPLX_SOA, /* Complex array, separate re and im arrays */
+    ALM_FUNC_VECT_DP_CMPLX_SOA,
+
     ALM_FUNC_VAR_MAX,                   /* should be last, always */
 };
 typedef enum ALM_FUNC_VARIANTS alm_func_var_t;
@@ -280,4 +373,21 @@ struct alm_arch_funcs {
 void alm_iface_fixup(alm_ep_wrapper_t *g_ep_wrapper,
                      const struct alm_arch_funcs *alm_funcs);
 
+/*
+ * Dispatch table introspection, for the benchmark driver and other
+ * tools. 'entry' is one of C_AMD_*, the tables are valid once the
+ * library is initialized. Unused entries give NULL.
+ */
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+const char *alm_iface_name(int entry);
+const struct alm_arch_funcs *alm_iface_funcs(int entry);
+alm_uarch_ver_t alm_iface_uarch(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
 #endif  /* __AMD_LIBM_IFACE_H__ */
@@ -0,0 +1,463 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Helpers for pow with an integer or half-integer exponent, shared by the
+ * powx fast path, pown and rootn. Double precision powers are carried as
+ * double-doubles, single precision ones are evaluated in double.
+ */
+
+#ifndef __LIBM_POWN_VEC_H__
+#define __LIBM_POWN_VEC_H__
+
+#include <stdint.h>
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <immintrin.h>
+
+#define POWX_Y_GENERIC  0
+#define POWX_Y_INTEGER  1       /* y = n */
+#define POWX_Y_HALF     2       /* y = n / 2, n odd */
+
+/* Largest |y| taken by the powx fast path */
+#define POWX_SMALL_Y    64
+
+#define POWN_DD_MIN     0x0170000000000000ULL   /* 2^-1000 */
+#define POWN_DD_MAX     0x7e70000000000000ULL   /* 2^1000 */
+
+/*
+ * Classify the scalar exponent of powx once per call, *n receives y for
+ * POWX_Y_INTEGER and 2 * y for POWX_Y_HALF
+ */
+static inline int
+powx_classify_y(double y, int *n)
+{
+    double y2 = y + y;
+    int m;
+
+    /* false for nan */
+    if (!(y2 >= -2.0 * POWX_SMALL_Y && y2 <= 2.0 * POWX_SMALL_Y))
+        return POWX_Y_GENERIC;
+
+    m = (int)y2;
+    if ((double)m != y2)
+        return POWX_Y_GENERIC;
+
+    if (m & 1) {
+        *n = m;
+        return POWX_Y_HALF;
+    }
+
+    *n = m / 2;
+    return POWX_Y_INTEGER;
+}
+
+#define POWX_Y_NOT_INT  0
+#define POWX_Y_EVEN     1
+#define POWX_Y_ODD      2
+
+/*
+ * Parity of the scalar exponent of powx, for x < 0 the generic path
+ * evaluates |x|^y and negates it for an odd integer y; any other y gives
+ * nan, which is left to pow()
+ */
+static inline int
+powx_parity_y(double y)
+{
+    double  a = (y < 0) ? -y : y;
+    int64_t k;
+
+    /* every double from 2^53 up is an even integer, false for nan */
+    if (!(a < 0x1p53))
+        return (a == a) ? POWX_Y_EVEN : POWX_Y_NOT_INT;
+
+    k = (int64_t)a;
+    if ((double)k != a)
+        return POWX_Y_NOT_INT;
+
+    return (k & 1) ? POWX_Y_ODD : POWX_Y_EVEN;
+}
+
+/* (ah + al) * (bh + bl) as a double-double */
+static inline void
+pown_ddmul_v2_f64(v_f64x2_t ah, v_f64x2_t al, v_f64x2_t bh, v_f64x2_t bl, v_f64x2_t *rh, v_f64x2_t *rl)
+{
+    v_f64x2_t p = ah * bh;
+    v_f64x2_t e = _mm_fmsub_pd(ah, bh, p) + (ah * bl + al * bh);
+
+    *rh = p + e;
+    *rl = e - (*rh - p);
+}
+
+/* 1 / (h + l) */
+static inline v_f64x2_t
+pown_ddrcp_v2_f64(v_f64x2_t h, v_f64x2_t l)
+{
+    v_f64x2_t q = 1.0 / h;
+    v_f64x2_t e = _mm_fnmadd_pd(h, q, _MM_SET1_PD2(1.0)) - l * q;
+
+    return q + q * e;
+}
+
+/*
+ * (xh + xl)^n as a double-double for n > 0, left to right binary powering,
+ * every partial power lies between 1 and the result so nothing overflows
+ * or underflows before the result does
+ */
+static inline v_f64x2_t
+pown_dd_v2_f64(v_f64x2_t xh, v_f64x2_t xl, uint32_t n, v_f64x2_t *lo)
+{
+    v_f64x2_t rh = xh, rl = xl;
+
+    for (int k = 30 - __builtin_clz(n); k >= 0; k--) {
+        pown_ddmul_v2_f64(rh, rl, rh, rl, &rh, &rl);
+        if ((n >> k) & 1)
+            pown_ddmul_v2_f64(rh, rl, xh, xl, &rh, &rl);
+    }
+
+    *lo = rl;
+    return rh;
+}
+
+/* Lanes whose double-double head is outside [2^-1000, 2^1000], or nan */
+static inline v_i64x2_t
+pown_dd_spl_v2_f64(v_f64x2_t h)
+{
+    v_u64x2_t uh = as_v2_u64_f64(h) & ~SIGNBIT_DP64;
+
+    return (v_i64x2_t)((uh - POWN_DD_MIN) >= (POWN_DD_MAX - POWN_DD_MIN));
+}
+
+/*
+ * x^n for any integer n, within about 0.5 ulp. Lanes flagged in *spl
+ * (zero, inf, nan, denormal x, or a result near or beyond the limits of the
+ * normal range) must be recomputed with the scalar pow(x, n).
+ */
+static inline v_f64x2_t
+pown_v2_f64(v_f64x2_t x, int n, v_i64x2_t *spl)
+{
+    v_f64x2_t h, l;
+
+    if (n == 0) {
+        *spl = (v_i64x2_t){0};
+        return _MM_SET1_PD2(1.0);
+    }
+
+    h = pown_dd_v2_f64(x, _MM_SET1_PD2(0.0), n < 0 ? -(uint32_t)n : (uint32_t)n, &l);
+
+    *spl = pown_dd_spl_v2_f64(h);
+
+    if (n < 0)
+        return pown_ddrcp_v2_f64(h, l);
+
+    return h + l;
+}
+
+/*
+ * x^(m / 2) for odd m, as x^(|m| / 2) * sqrt(x) or its reciprocal, with
+ * sqrt(x) carried as a double-double. Lanes flagged in *spl, which includes
+ * every x <= 0 or denormal, must be recomputed with the scalar pow(x, m / 2.0).
+ */
+static inline v_f64x2_t
+powx_half_v2_f64(v_f64x2_t x, int m, v_i64x2_t *spl)
+{
+    uint32_t am = m < 0 ? -(uint32_t)m : (uint32_t)m;
+    v_f64x2_t sh = _mm_sqrt_pd(x);
+    v_f64x2_t sl = _mm_fnmadd_pd(sh, sh, x) / (sh + sh);
+    v_f64x2_t h = sh, l = sl;
+
+    if (am >> 1) {
+        v_f64x2_t ph, pl;
+        ph = pown_dd_v2_f64(x, _MM_SET1_PD2(0.0), am >> 1, &pl);
+        pown_ddmul_v2_f64(ph, pl, sh, sl, &h, &l);
+    }
+
+    *spl = pown_dd_spl_v2_f64(h) | (v_i64x2_t)(x < 0x1p-1022);
+
+    if (m < 0)
+        return pown_ddrcp_v2_f64(h, l);
+
+    return h + l;
+}
+
+/* (ah + al) * (bh + bl) as a double-double */
+static inline void
+pown_ddmul_v4_f64(v_f64x4_t ah, v_f64x4_t al, v_f64x4_t bh, v_f64x4_t bl, v_f64x4_t *rh, v_f64x4_t *rl)
+{
+    v_f64x4_t p = ah * bh;
+    v_f64x4_t e = _mm256_fmsub_pd(ah, bh, p) + (ah * bl + al * bh);
+
+    *rh = p + e;
+    *rl = e - (*rh - p);
+}
+
+/* 1 / (h + l) */
+static inline v_f64x4_t
+pown_ddrcp_v4_f64(v_f64x4_t h, v_f64x4_t l)
+{
+    v_f64x4_t q = 1.0 / h;
+    v_f64x4_t e = _mm256_fnmadd_pd(h, q, _MM_SET1_PD4(1.0)) - l * q;
+
+    return q + q * e;
+}
+
+/*
+ * (xh + xl)^n as a double-double for n > 0, left to right binary powering,
+ * every partial power lies between 1 and the result so nothing overflows
+ * or underflows before the result does
+ */
+static inline v_f64x4_t
+pown_dd_v4_f64(v_f64x4_t xh, v_f64x4_t xl, uint32_t n, v_f64x4_t *lo)
+{
+    v_f64x4_t rh = xh, rl = xl;
+
+    for (int k = 30 - __builtin_clz(n); k >= 0; k--) {
+        pown_ddmul_v4_f64(rh, rl, rh, rl, &rh, &rl);
+        if ((n >> k) & 1)
+            pown_ddmul_v4_f64(rh, rl, xh, xl, &rh, &rl);
+    }
+
+    *lo = rl;
+    return rh;
+}
+
+/* Lanes whose double-double head is outside [2^-1000, 2^1000], or nan */
+static inline v_i64x4_t
+pown_dd_spl_v4_f64(v_f64x4_t h)
+{
+    v_u64x4_t uh = as_v4_u64_f64(h) & ~SIGNBIT_DP64;
+
+    return (v_i64x4_t)((uh - POWN_DD_MIN) >= (POWN_DD_MAX - POWN_DD_MIN));
+}
+
+/*
+ * x^n for any integer n, within about 0.5 ulp. Lanes flagged in *spl
+ * (zero, inf, nan, denormal x, or a result near or beyond the limits of the
+ * normal range) must be recomputed with the scalar pow(x, n).
+ */
+static inline v_f64x4_t
+pown_v4_f64(v_f64x4_t x, int n, v_i64x4_t *spl)
+{
+    v_f64x4_t h, l;
+
+    if (n == 0) {
+        *spl = (v_i64x4_t){0};
+        return _MM_SET1_PD4(1.0);
+    }
+
+    h = pown_dd_v4_f64(x, _MM_SET1_PD4(0.0), n < 0 ? -(uint32_t)n : (uint32_t)n, &l);
+
+    *spl = pown_dd_spl_v4_f64(h);
+
+    if (n < 0)
+        return pown_ddrcp_v4_f64(h, l);
+
+    return h + l;
+}
+
+/*
+ * x^(m / 2) for odd m, as x^(|m| / 2) * sqrt(x) or its reciprocal, with
+ * sqrt(x) carried as a double-double. Lanes flagged in *spl, which includes
+ * every x <= 0 or denormal, must be recomputed with the scalar pow(x, m / 2.0).
+ */
+static inline v_f64x4_t
+powx_half_v4_f64(v_f64x4_t x, int m, v_i64x4_t *spl)
+{
+    uint32_t am = m < 0 ? -(uint32_t)m : (uint32_t)m;
+    v_f64x4_t sh = _mm256_sqrt_pd(x);
+    v_f64x4_t sl = _mm256_fnmadd_pd(sh, sh, x) / (sh + sh);
+    v_f64x4_t h = sh, l = sl;
+
+    if (am >> 1) {
+        v_f64x4_t ph, pl;
+        ph = pown_dd_v4_f64(x, _MM_SET1_PD4(0.0), am >> 1, &pl);
+        pown_ddmul_v4_f64(ph, pl, sh, sl, &h, &l);
+    }
+
+    *spl = pown_dd_spl_v4_f64(h) | (v_i64x4_t)(x < 0x1p-1022);
+
+    if (m < 0)
+        return pown_ddrcp_v4_f64(h, l);
+
+    return h + l;
+}
+
+/*
+ * Single precision x^n, x widened to double. Intermediate errors stay far
+ * below a float ulp for |n| <= POWX_SMALL_Y and the double range holds the
+ * float result, so zero, inf and nan come out as pow() gives them.
+ */
+static inline v_f64x4_t
+pownf_v4_f64(v_f64x4_t x, int n)
+{
+    uint32_t an = n < 0 ? -(uint32_t)n : (uint32_t)n;
+    v_f64x4_t r = _MM_SET1_PD4(1.0);
+
+    while (an) {
+        if (an & 1)
+            r = r * x;
+        an >>= 1;
+        if (an)
+            x = x * x;
+    }
+
+    if (n < 0)
+        return 1.0 / r;
+
+    return r;
+}
+
+/*
+ * Single precision x^(m / 2) for odd m, x widened to double. pow() treats
+ * -0 and -inf as +0 and +inf for non-integer y, other x < 0 give nan
+ * from sqrt.
+ */
+static inline v_f64x4_t
+powxf_half_v4_f64(v_f64x4_t x, int m)
+{
+    uint32_t am = m < 0 ? -(uint32_t)m : (uint32_t)m;
+    v_u64x4_t ux = as_v4_u64_f64(x);
+    v_i64x4_t neg_zero_inf = (v_i64x4_t)(((ux & ~SIGNBIT_DP64) == 0) | (ux == NINFBITPATT_DP64));
+    v_f64x4_t r;
+
+    x = as_v4_f64_u64(ux & ~((v_u64x4_t)neg_zero_inf & SIGNBIT_DP64));
+    r = pownf_v4_f64(x, (int)(am >> 1)) * _mm256_sqrt_pd(x);
+
+    if (m < 0)
+        return 1.0 / r;
+
+    return r;
+}
+
+#if defined(__AVX512F__)
+
+/* (ah + al) * (bh + bl) as a double-double */
+static inline void
+pown_ddmul_v8_f64(v_f64x8_t ah, v_f64x8_t al, v_f64x8_t bh, v_f64x8_t bl, v_f64x8_t *rh, v_f64x8_t *rl)
+{
+    v_f64x8_t p = ah * bh;
+    v_f64x8_t e = _mm512_fmsub_pd(ah, bh, p) + (ah * bl + al * bh);
+
+    *rh = p + e;
+    *rl = e - (*rh - p);
+}
+
+/* 1 / (h + l) */
+static inline v_f64x8_t
+pown_ddrcp_v8_f64(v_f64x8_t h, v_f64x8_t l)
+{
+    v_f64x8_t q = 1.0 / h;
+    v_f64x8_t e = _mm512_fnmadd_pd(h, q, _MM512_SET1_PD8(1.0)) - l * q;
+
+    return q + q * e;
+}
+
+/*
+ * (xh + xl)^n as a double-double for n > 0, left to right binary powering,
+ * every partial power lies between 1 and the result so nothing overflows
+ * or underflows before the result does
+ */
+static inline v_f64x8_t
+pown_dd_v8_f64(v_f64x8_t xh, v_f64x8_t xl, uint32_t n, v_f64x8_t *lo)
+{
+    v_f64x8_t rh = xh, rl = xl;
+
+    for (int k = 30 - __builtin_clz(n); k >= 0; k--) {
+        pown_ddmul_v8_f64(rh, rl, rh, rl, &rh, &rl);
+        if ((n >> k) & 1)
+            pown_ddmul_v8_f64(rh, rl, xh, xl, &rh, &rl);
+    }
+
+    *lo = rl;
+    return rh;
+}
+
+/* Lanes whose double-double head is outside [2^-1000, 2^1000], or nan */
+static inline v_i64x8_t
+pown_dd_spl_v8_f64(v_f64x8_t h)
+{
+    v_u64x8_t uh = as_v8_u64_f64(h) & ~SIGNBIT_DP64;
+
+    return (v_i64x8_t)((uh - POWN_DD_MIN) >= (POWN_DD_MAX - POWN_DD_MIN));
+}
+
+/*
+ * x^n for any integer n, within about 0.5 ulp. Lanes flagged in *spl
+ * (zero, inf, nan, denormal x, or a result near or beyond the limits of the
+ * normal range) must be recomputed with the scalar pow(x, n).
+ */
+static inline v_f64x8_t
+pown_v8_f64(v_f64x8_t x, int n, v_i64x8_t *spl)
+{
+    v_f64x8_t h, l;
+
+    if (n == 0) {
+        *spl = (v_i64x8_t){0};
+        return _MM512_SET1_PD8(1.0);
+    }
+
+    h = pown_dd_v8_f64(x, _MM512_SET1_PD8(0.0), n < 0 ? -(uint32_t)n : (uint32_t)n, &l);
+
+    *spl = pown_dd_spl_v8_f64(h);
+
+    if (n < 0)
+        return pown_ddrcp_v8_f64(h, l);
+
+    return h + l;
+}
+
+/*
+ * x^(m / 2) for odd m, as x^(|m| / 2) * sqrt(x) or its reciprocal, with
+ * sqrt(x) carried as a double-double. Lanes flagged in *spl, which includes
+ * every x <= 0 or denormal, must be recomputed with the scalar pow(x, m / 2.0).
+ */
+static inline v_f64x8_t
+powx_half_v8_f64(v_f64x8_t x, int m, v_i64x8_t *spl)
+{
+    uint32_t am = m < 0 ? -(uint32_t)m : (uint32_t)m;
+    v_f64x8_t sh = _mm512_sqrt_pd(x);
+    v_f64x8_t sl = _mm512_fnmadd_pd(sh, sh, x) / (sh + sh);
+    v_f64x8_t h = sh, l = sl;
+
+    if (am >> 1) {
+        v_f64x8_t ph, pl;
+        ph = pown_dd_v8_f64(x, _MM512_SET1_PD8(0.0), am >> 1, &pl);
+        pown_ddmul_v8_f64(ph, pl, sh, sl, &h, &l);
+    }
+
+    *spl = pown_dd_spl_v8_f64(h) | (v_i64x8_t)(x < 0x1p-1022);
+
+    if (m < 0)
+        return pown_ddrcp_v8_f64(h, l);
+
+    return h + l;
+}
+
+#endif  /* __AVX512F__ */
+
+#endif  /* __LIBM_POWN_VEC_H__ */
@@ -0,0 +1,471 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Reciprocal square root, reciprocal cube root and reciprocal hypot,
+ * shared by the scalar, vector and array kernels of rsqrt, rsqrt_approx,
+ * invcbrt and rhypot.
+ *
+ * rsqrt(x), y0 = 1 / sqrt(x) rounded twice:
+ *     e = 1 - x y0^2,  rsqrt(x) = y0 + y0 e / 2
+ * with x y0 split into t + tl by an fma, so that e is exact to the
+ * rounding of the fma and the result is within a few hundredths of an
+ * ulp of correct rounding.
+ *
+ * rsqrt_approx(x), y0 the hardware estimate:
+ *     rsqrt(x) = y0 (1 - e)^(-1/2) = y0 (1 + e/2 + 3e^2/8 + 5e^3/16 + ...)
+ * truncated after the term that brings the error of the estimate below
+ * the rounding of the result:
+ *     vrsqrt14, |e| < 2^-13     float: e,    double: e^3
+ *     vrsqrtps, |e| < 2^-10.4   float: e^2,  double: e^4
+ * Without AVX-512 there is no double estimate, x = m 4^k, m in [0.5, 2)
+ * is reduced exactly and the single precision estimate of m is used.
+ * Zero, subnormal, negative, infinite and NaN arguments take 1 / sqrt(x).
+ *
+ * invcbrt(x) = sign(x) |x|^(-1/3), |x| = m 8^q, m in [1, 8) exact, and
+ * m = f 2^i, f in [1, 2):
+ *     y = C(f) 2^(-i/3),           C of degree 4, relative error 2^-14.4
+ *     e = 1 - m y^3,               m y^3 in double-double
+ *     invcbrt(x) = 2^-q (y + y (e/3 + 2e^2/9 + 14e^3/81))
+ *
+ * rhypot(x, y) = 1 / sqrt(x^2 + y^2), with x and y scaled by a power of
+ * two that brings the larger one to [2, 4), the sum of the squares in
+ * double-double and the correction of rsqrt on its high part.
+ *
+ * The float kernels of rsqrt are evaluated in single precision the same
+ * way, those of invcbrt and rhypot in double precision.
+ */
+
+#ifndef __LIBM_RSQRT_COMMON_H__
+#define __LIBM_RSQRT_COMMON_H__
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <immintrin.h>
+
+#define RSQRT_DBL_MIN           0x1p-1022
+#define RSQRT_FLT_MIN           0x1p-126f
+#define INVCBRT_SHIFT           0x1.8p52                  /* rounds |t| < 2^51 to an integer */
+#define INVCBRT_SHIFT_BITS      0x4338000000000000ULL
+#define INVCBRT_THIRD           0x1.5555555555555p-2
+#define INVCBRT_2_M1_3          0x1.965fea53d6e3dp-1      /* 2^(-1/3) */
+#define INVCBRT_2_M2_3          0x1.428a2f98d728bp-1      /* 2^(-2/3) */
+
+static const struct {
+    double c[5], s[3];
+} invcbrt_data = {
+    /* f^(-1/3) in f - 1.5 on [1, 2] */
+    .c = {
+         0x1.bf45f04cef0b9p-1, -0x1.8cee529e77a9fp-3,
+         0x1.60a2305a4ae7bp-4, -0x1.96db27ed19a7cp-5,
+         0x1.c731837107b28p-6,
+    },
+    /* (1 - e)^(-1/3) = 1 + e/3 + 2e^2/9 + 14e^3/81 + ... */
+    .s = {
+         0x1.5555555555555p-2,  0x1.c71c71c71c71cp-3,
+         0x1.61f9add3c0ca4p-3,
+    },
+};
+
+/* (1 - e)^(-1/2) = 1 + e (c0 + c1 e + ...), by the order of the term kept */
+#define RSQRT_CORR1(e)  (((__typeof__(e)){0} + 1) / 2)
+#define RSQRT_CORR2(e)  ((3 * (e) + 4) / 8)
+#define RSQRT_CORR3(e)  (((5 * (e) + 6) * (e) + 8) / 16)
+#define RSQRT_CORR4(e)  ((((35 * (e) + 40) * (e) + 48) * (e) + 64) / 128)
+
+/*
+ * 1 / sqrt(x) for 0 < x < inf from y0 = 1 / sqrt(x), e from the exact
+ * product x y0 = t + tl
+ */
+#define RSQRT_REFINE(x, y0, vfma) ({                                        \
+        __typeof__(x) _rt  = (x) * (y0);                                    \
+        __typeof__(x) _rtl = vfma((x), (y0), -_rt);                         \
+        __typeof__(x) _re  = vfma(-_rt, (y0), (__typeof__(x)){0} + 1) - _rtl * (y0); \
+        vfma((y0) / 2, _re, (y0));                                          \
+    })
+
+/*
+ * Vector forms, vsel(c, a, b) selects a where the comparison c holds and
+ * vany(c) is true when it holds for any lane
+ */
+#define RSQRT_VEC(x, vsqrt, vfma, vsel) ({                                  \
+        __typeof__(x) _y0 = 1 / vsqrt(x);                                   \
+        vsel(((x) > 0) & (((x) - (x)) == 0),                                \
+             RSQRT_REFINE((x), _y0, vfma), _y0);                            \
+    })
+
+/* refinement of the estimate y0, exact 1 / sqrt(x) outside [tiny, inf) */
+#define RSQRT_APPROX_VEC(x, y0, corr, tiny, vsqrt, vfma, vsel, vany) ({     \
+        __typeof__(x) _ay0 = (y0);                                          \
+        __typeof__(x) _ae  = vfma(-(x) * _ay0, _ay0, (__typeof__(x)){0} + 1); \
+        __typeof__(x) _ar  = vfma(_ay0 * _ae, corr(_ae), _ay0);             \
+        __typeof__((x) < 0) _abad = ((x) < (tiny)) | (((x) - (x)) != 0);    \
+        if (vany(_abad))                                                    \
+            _ar = vsel(_abad, 1 / vsqrt(x), _ar);                           \
+        _ar;                                                                \
+    })
+
+/*
+ * Estimate of 1 / sqrt(x) for normal x > 0 from the single precision
+ * instruction vest(), x = m 4^k, m in [0.5, 2), 1 / sqrt(x) = 2^-k / sqrt(m)
+ */
+#define RSQRT_EST_F32(x, vasu, vasf, vest) ({                               \
+        __typeof__(vasu(x)) _su = vasu(x);                                  \
+        __typeof__(x) _sm = vasf((_su & 0x001fffffffffffffULL) | 0x3fe0000000000000ULL); \
+        __typeof__(x) _sk = vasf(0x5fe0000000000000ULL - ((_su >> 53) << 52)); \
+        vest(_sm) * _sk;                                                    \
+    })
+
+#define INVCBRT_POLY(t) ({                                                  \
+        __typeof__(t) _pt = (t);                                            \
+        (((invcbrt_data.c[4] * _pt + invcbrt_data.c[3]) * _pt +             \
+          invcbrt_data.c[2]) * _pt + invcbrt_data.c[1]) * _pt +             \
+          invcbrt_data.c[0];                                                \
+    })
+
+#define INVCBRT_VEC(x, vabs, vasu, vasf, vfma, vsel) ({                     \
+        __typeof__(x) _zero = (__typeof__(x)){0};                           \
+        __typeof__(x) _one  = _zero + 1.0;                                  \
+        __typeof__(x) _a = vabs(x);                                         \
+        __typeof__((x) < 0.0) _ok  = (_a > 0.0) & (_a < __builtin_inf());   \
+        __typeof__((x) < 0.0) _sub = _a < RSQRT_DBL_MIN;                    \
+        __typeof__(vasu(x)) _u;                                             \
+        __typeof__(x) _e, _q, _k, _m, _f, _y, _h, _hl, _p, _pl, _s, _sl, _r; \
+                                                                            \
+        _a = vsel(_sub, _a * 0x1p54, _a);                                   \
+        _u = vasu(_a);                                                      \
+        _e = vasf((_u >> 52) | 0x4330000000000000ULL) - (0x1p52 + 1023.0);  \
+                                                                            \
+        /* q = floor(e / 3) = round((e - 1) / 3), k = 2^-q, m = a k^3 */    \
+        _q = (_e - 1.0) * INVCBRT_THIRD + INVCBRT_SHIFT;                    \
+        _k = vasf((INVCBRT_SHIFT_BITS + 0x3ff - vasu(_q)) << 52);           \
+        _m = _a * (_k * _k * _k);                                           \
+        _f = vasf((_u & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL);    \
+        _y = INVCBRT_POLY(_f - 1.5) *                                       \
+             vsel(_m >= 4.0, _zero + INVCBRT_2_M2_3,                        \
+                  vsel(_m >= 2.0, _zero + INVCBRT_2_M1_3, _one));           \
+                                                                            \
+        /* e = 1 - m y^3 */                                                 \
+        _h  = _y * _y;                                                      \
+        _hl = vfma(_y, _y, -_h);                                            \
+        _p  = _h * _y;                                                      \
+        _pl = vfma(_h, _y, -_p) + _hl * _y;                                 \
+        _s  = _m * _p;                                                      \
+        _sl = vfma(_m, _p, -_s) + _m * _pl;                                 \
+        _e  = (1.0 - _s) - _sl;                                             \
+                                                                            \
+        _r = _e * ((invcbrt_data.s[2] * _e + invcbrt_data.s[1]) * _e +      \
+                   invcbrt_data.s[0]);                                      \
+        _r = vfma(_y, _r, _y) * _k;                                         \
+        _r = vsel(_sub, _r * 0x1p18, _r);                                   \
+        _r = vsel((x) < 0.0, -_r, _r);                                      \
+                                                                            \
+        /* +-inf at +-0, +-0 at +-inf */                                    \
+        vsel(_ok, _r, 1.0 / (x));                                           \
+    })
+
+#define RHYPOT_VEC(x, y, vabs, vasu, vasf, vsqrt, vfma, vsel) ({            \
+        __typeof__(x) _zero = (__typeof__(x)){0};                           \
+        __typeof__(x) _one  = _zero + 1.0;                                  \
+        __typeof__(x) _ax = vabs(x), _ay = vabs(y);                         \
+        __typeof__(x) _b, _c, _s, _h1, _l1, _h2, _l2, _sh, _sl, _y0, _t, _tl, _r; \
+        __typeof__((x) < 0.0) _ok, _sub;                                    \
+                                                                            \
+        _ok  = (_ax < __builtin_inf()) & (_ay < __builtin_inf()) &          \
+               ((_ax + _ay) > 0.0);                                         \
+        _b   = vsel(_ax > _ay, _ax, _ay);                                   \
+        _c   = vsel(_ax > _ay, _ay, _ax);                                   \
+        _sub = _b < RSQRT_DBL_MIN;                                          \
+        _b   = vsel(_sub, _b * 0x1p54, _b);                                 \
+        _c   = vsel(_sub, _c * 0x1p54, _c);                                 \
+                                                                            \
+        /* s = 2^(1 - ilogb(b)), b s in [2, 4) */                           \
+        _s = vasf(0x7ff0000000000000ULL - (vasu(_b) & 0x7ff0000000000000ULL)); \
+        _b = _b * _s;                                                       \
+        _c = _c * _s;                                                       \
+                                                                            \
+        _h1 = _b * _b;                                                      \
+        _l1 = vfma(_b, _b, -_h1);                                           \
+        _h2 = _c * _c;                                                      \
+        _l2 = vfma(_c, _c, -_h2);                                           \
+        _sh = _h1 + _h2;                                                    \
+        _sl = ((_h1 - _sh) + _h2) + (_l1 + _l2);                            \
+                                                                            \
+        _y0 = 1.0 / vsqrt(_sh);                                             \
+        _t  = _sh * _y0;                                                    \
+        _tl = vfma(_sh, _y0, -_t);                                          \
+        _r  = vfma(-_t, _y0, _one) - (_tl + _sl * _y0) * _y0;               \
+        _r  = vfma(0.5 * _y0, _r, _y0) * _s;                                \
+        _r  = vsel(_sub, _r * 0x1p54, _r);                                  \
+                                                                            \
+        /* 0 if either is infinite, +inf at (0, 0), NaN */                  \
+        vsel(_ok, _r, vsel((_ax == __builtin_inf()) | (_ay == __builtin_inf()), \
+                           _zero, 1.0 / (_ax + _ay)));                      \
+    })
+
+/* float arguments in double, x^2 + y^2 is exact before the addition */
+#define RHYPOTF_VEC(x, y, vsqrt, vsel) ({                                   \
+        __typeof__(x) _xx = (x) * (x), _yy = (y) * (y);                     \
+        vsel((_xx == __builtin_inf()) | (_yy == __builtin_inf()),           \
+             (__typeof__(x)){0}, 1.0 / vsqrt(_xx + _yy));                   \
+    })
+
+
+/*
+ * Scalar
+ */
+#define RSQRT_SEL_S(c, a, b)    ((c) ? (a) : (b))
+#define RSQRT_ANY_S(c)          (c)
+
+static inline double
+rsqrt_s(double x)
+{
+    return RSQRT_VEC(x, __builtin_sqrt, __builtin_fma, RSQRT_SEL_S);
+}
+
+static inline float
+rsqrtf_s(float x)
+{
+    return RSQRT_VEC(x, __builtin_sqrtf, __builtin_fmaf, RSQRT_SEL_S);
+}
+
+#if defined(__AVX512F__)
+#define RSQRT_EST_S(x)          _mm_cvtsd_f64(_mm_rsqrt14_sd(_mm_setzero_pd(), _mm_set_sd(x)))
+#define RSQRT_CORR_S            RSQRT_CORR3
+#define RSQRTF_EST_S(x)         _mm_cvtss_f32(_mm_rsqrt14_ss(_mm_setzero_ps(), _mm_set_ss(x)))
+#define RSQRTF_CORR_S           RSQRT_CORR1
+#else
+#define RSQRT_EST_F32_S(m)      (double)_mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss((float)(m))))
+#define RSQRT_EST_S(x)          RSQRT_EST_F32(x, asuint64, asdouble, RSQRT_EST_F32_S)
+#define RSQRT_CORR_S            RSQRT_CORR4
+#define RSQRTF_EST_S(x)         _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)))
+#define RSQRTF_CORR_S           RSQRT_CORR2
+#endif
+
+static inline double
+rsqrt_approx_s(double x)
+{
+    return RSQRT_APPROX_VEC(x, RSQRT_EST_S(x), RSQRT_CORR_S, RSQRT_DBL_MIN,
+                            __builtin_sqrt, __builtin_fma, RSQRT_SEL_S, RSQRT_ANY_S);
+}
+
+static inline float
+rsqrtf_approx_s(float x)
+{
+    return RSQRT_APPROX_VEC(x, RSQRTF_EST_S(x), RSQRTF_CORR_S, RSQRT_FLT_MIN,
+                            __builtin_sqrtf, __builtin_fmaf, RSQRT_SEL_S, RSQRT_ANY_S);
+}
+
+static inline double
+invcbrt_s(double x)
+{
+    return INVCBRT_VEC(x, __builtin_fabs, asuint64, asdouble, __builtin_fma, RSQRT_SEL_S);
+}
+
+static inline double
+rhypot_s(double x, double y)
+{
+    return RHYPOT_VEC(x, y, __builtin_fabs, asuint64, asdouble, __builtin_sqrt,
+                      __builtin_fma, RSQRT_SEL_S);
+}
+
+static inline double
+rhypotf_s(double x, double y)
+{
+    return RHYPOTF_VEC(x, y, __builtin_sqrt, RSQRT_SEL_S);
+}
+
+/*
+ * 4 doubles and 8 floats
+ */
+#define RSQRT_SEL_V4(c, a, b)   sel_v4_f64((v_u64x4_t)(c), a, b)
+#define RSQRT_ANY_V4(c)         any_v4_u64_loop((v_u64x4_t)(c))
+#define RSQRT_ABS_V4(x)         as_v4_f64_u64(as_v4_u64_f64(x) & ~SIGNBIT_DP64)
+#define RSQRT_SEL_V8F(c, a, b)  sel_v8_f32((v_u32x8_t)(c), a, b)
+#define RSQRT_ANY_V8F(c)        any_v8_u32_loop((v_u32x8_t)(c))
+
+#if defined(__AVX512VL__)
+#define RSQRT_EST_V4(x)         _mm256_rsqrt14_pd(x)
+#define RSQRT_CORR_V4           RSQRT_CORR3
+#define RSQRTF_EST_V8(x)        _mm256_rsqrt14_ps(x)
+#define RSQRTF_CORR_V8          RSQRT_CORR1
+#elif defined(__AVX512F__)
+#define RSQRT_EST_V4(x)         _mm512_castpd512_pd256(_mm512_rsqrt14_pd(_mm512_castpd256_pd512(x)))
+#define RSQRT_CORR_V4           RSQRT_CORR3
+#define RSQRTF_EST_V8(x)        _mm512_castps512_ps256(_mm512_rsqrt14_ps(_mm512_castps256_ps512(x)))
+#define RSQRTF_CORR_V8          RSQRT_CORR1
+#else
+#define RSQRT_EST_F32_V4(m)     _mm256_cvtps_pd(_mm_rsqrt_ps(_mm256_cvtpd_ps(m)))
+#define RSQRT_EST_V4(x)         RSQRT_EST_F32(x, as_v4_u64_f64, as_v4_f64_u64, RSQRT_EST_F32_V4)
+#define RSQRT_CORR_V4           RSQRT_CORR4
+#define RSQRTF_EST_V8(x)        _mm256_rsqrt_ps(x)
+#define RSQRTF_CORR_V8          RSQRT_CORR2
+#endif
+
+static inline v_f64x4_t
+rsqrt_v4(v_f64x4_t x)
+{
+    return RSQRT_VEC(x, _mm256_sqrt_pd, _mm256_fmadd_pd, RSQRT_SEL_V4);
+}
+
+static inline v_f32x8_t
+rsqrtf_v8(v_f32x8_t x)
+{
+    return RSQRT_VEC(x, _mm256_sqrt_ps, _mm256_fmadd_ps, RSQRT_SEL_V8F);
+}
+
+static inline v_f64x4_t
+rsqrt_approx_v4(v_f64x4_t x)
+{
+    return RSQRT_APPROX_VEC(x, RSQRT_EST_V4(x), RSQRT_CORR_V4, RSQRT_DBL_MIN,
+                            _mm256_sqrt_pd, _mm256_fmadd_pd, RSQRT_SEL_V4, RSQRT_ANY_V4);
+}
+
+static inline v_f32x8_t
+rsqrtf_approx_v8(v_f32x8_t x)
+{
+    return RSQRT_APPROX_VEC(x, RSQRTF_EST_V8(x), RSQRTF_CORR_V8, RSQRT_FLT_MIN,
+                            _mm256_sqrt_ps, _mm256_fmadd_ps, RSQRT_SEL_V8F, RSQRT_ANY_V8F);
+}
+
+static inline v_f64x4_t
+invcbrt_v4(v_f64x4_t x)
+{
+    return INVCBRT_VEC(x, RSQRT_ABS_V4, as_v4_u64_f64, as_v4_f64_u64,
+                       _mm256_fmadd_pd, RSQRT_SEL_V4);
+}
+
+static inline v_f64x4_t
+rhypot_v4(v_f64x4_t x, v_f64x4_t y)
+{
+    return RHYPOT_VEC(x, y, RSQRT_ABS_V4, as_v4_u64_f64, as_v4_f64_u64,
+                      _mm256_sqrt_pd, _mm256_fmadd_pd, RSQRT_SEL_V4);
+}
+
+static inline v_f64x4_t
+rhypotf_v4(v_f64x4_t x, v_f64x4_t y)
+{
+    return RHYPOTF_VEC(x, y, _mm256_sqrt_pd, RSQRT_SEL_V4);
+}
+
+/* 8 floats as two halves of 4 doubles */
+#define RSQRT_V8F_VIA_F64(f, x) ({                                          \
+        v_f64x4_t _lo = f(_mm256_cvtps_pd(_mm256_castps256_ps128(x)));      \
+        v_f64x4_t _hi = f(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));    \
+        (v_f32x8_t)_mm256_set_m128(_mm256_cvtpd_ps(_hi), _mm256_cvtpd_ps(_lo)); \
+    })
+
+#define RSQRT_V8F2_VIA_F64(f, x, y) ({                                      \
+        v_f64x4_t _lo = f(_mm256_cvtps_pd(_mm256_castps256_ps128(x)),       \
+                          _mm256_cvtps_pd(_mm256_castps256_ps128(y)));      \
+        v_f64x4_t _hi = f(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)),     \
+                          _mm256_cvtps_pd(_mm256_extractf128_ps(y, 1)));    \
+        (v_f32x8_t)_mm256_set_m128(_mm256_cvtpd_ps(_hi), _mm256_cvtpd_ps(_lo)); \
+    })
+
+#if defined(__AVX512F__)
+/*
+ * 8 doubles and 16 floats
+ */
+#define RSQRT_SEL_V8(c, a, b)   sel_v8_f64((v_u64x8_t)(c), a, b)
+#define RSQRT_ANY_V8(c)         any_v8_u64_loop((v_u64x8_t)(c))
+#define RSQRT_SEL_V16F(c, a, b) sel_v16_f32((v_u32x16_t)(c), a, b)
+#define RSQRT_ANY_V16F(c)       any_v16_u32_loop((v_u32x16_t)(c))
+
+static inline v_f64x8_t
+rsqrt_v8(v_f64x8_t x)
+{
+    return RSQRT_VEC(x, _mm512_sqrt_pd, _mm512_fmadd_pd, RSQRT_SEL_V8);
+}
+
+static inline v_f32x16_t
+rsqrtf_v16(v_f32x16_t x)
+{
+    return RSQRT_VEC(x, _mm512_sqrt_ps, _mm512_fmadd_ps, RSQRT_SEL_V16F);
+}
+
+static inline v_f64x8_t
+rsqrt_approx_v8(v_f64x8_t x)
+{
+    return RSQRT_APPROX_VEC(x, _mm512_rsqrt14_pd(x), RSQRT_CORR3, RSQRT_DBL_MIN,
+                            _mm512_sqrt_pd, _mm512_fmadd_pd, RSQRT_SEL_V8, RSQRT_ANY_V8);
+}
+
+static inline v_f32x16_t
+rsqrtf_approx_v16(v_f32x16_t x)
+{
+    return RSQRT_APPROX_VEC(x, _mm512_rsqrt14_ps(x), RSQRT_CORR1, RSQRT_FLT_MIN,
+                            _mm512_sqrt_ps, _mm512_fmadd_ps, RSQRT_SEL_V16F, RSQRT_ANY_V16F);
+}
+
+static inline v_f64x8_t
+invcbrt_v8(v_f64x8_t x)
+{
+    return INVCBRT_VEC(x, _mm512_abs_pd, as_v8_u64_f64, as_v8_f64_u64,
+                       _mm512_fmadd_pd, RSQRT_SEL_V8);
+}
+
+static inline v_f64x8_t
+rhypot_v8(v_f64x8_t x, v_f64x8_t y)
+{
+    return RHYPOT_VEC(x, y, _mm512_abs_pd, as_v8_u64_f64, as_v8_f64_u64,
+                      _mm512_sqrt_pd, _mm512_fmadd_pd, RSQRT_SEL_V8);
+}
+
+static inline v_f64x8_t
+rhypotf_v8(v_f64x8_t x, v_f64x8_t y)
+{
+    return RHYPOTF_VEC(x, y, _mm512_sqrt_pd, RSQRT_SEL_V8);
+}
+
+/* 16 floats as two halves of 8 doubles */
+#define RSQRT_F32X16_LO(x)      _mm512_cvtps_pd(_mm512_castps512_ps256(x))
+#define RSQRT_F32X16_HI(x)      _mm512_cvtps_pd(_mm256_castpd_ps(                  \
+                                    _mm512_extractf64x4_pd(_mm512_castps_pd(x), 1)))
+#define RSQRT_F32X16_JOIN(lo, hi)                                           \
+        (v_f32x16_t)_mm512_castpd_ps(_mm512_insertf64x4(                    \
+            _mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(lo))),  \
+            _mm256_castps_pd(_mm512_cvtpd_ps(hi)), 1))
+
+#define RSQRT_V16F_VIA_F64(f, x) ({                                         \
+        v_f64x8_t _lo = f(RSQRT_F32X16_LO(x));                              \
+        v_f64x8_t _hi = f(RSQRT_F32X16_HI(x));                              \
+        RSQRT_F32X16_JOIN(_lo, _hi);                                        \
+    })
+
+#define RSQRT_V16F2_VIA_F64(f, x, y) ({                                     \
+        v_f64x8_t _lo = f(RSQRT_F32X16_LO(x), RSQRT_F32X16_LO(y));          \
+        v_f64x8_t _hi = f(RSQRT_F32X16_HI(x), RSQRT_F32X16_HI(y));          \
+        RSQRT_F32X16_JOIN(_lo, _hi);                                        \
+    })
+#endif  /* __AVX512F__ */
+
+#endif  /* __LIBM_RSQRT_COMMON_H__ */
@@ -29,6 +29,7 @@
 #define __LIBM_TYPEHELPER_VEC_H__
 
 #include <libm/types.h>
+#include <libm/alm_stats.h>
 
 #include <emmintrin.h>
 #if defined(_WIN64) || defined(_WIN32)
@@ -436,6 +437,138 @@ cvt_v4_f64_to_f32(v_f64x4_t _xf64 /* cond */)
     return _mm256_cvtpd_ps(_xf64);
 }
 
+#if defined(__F16C__)
+/* v8 half (IEEE binary16 bit patterns) <-> float, round to nearest even */
+static inline v_f32x8_t
+cvt_v8_f16_to_f32(__m128i _xf16)
+{
+    return _mm256_cvtph_ps(_xf16);
+}
+
+static inline __m128i
+cvt_v8_f32_to_f16(v_f32x8_t _xf32)
+{
+    return _mm256_cvtps_ph(_xf32, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+#endif
+
+#if defined(__AVX512F__)
+/* v16 half (IEEE binary16 bit patterns) <-> float, round to nearest even */
+static inline v_f32x16_t
+cvt_v16_f16_to_f32(__m256i _xf16)
+{
+    return _mm512_cvtph_ps(_xf16);
+}
+
+static inline __m256i
+cvt_v16_f32_to_f16(v_f32x16_t _xf32)
+{
+    return _mm512_cvtps_ph(_xf32, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+#endif
+
+#if defined(__AVX2__)
+/*
+ * v8 bfloat16 <-> float, bfloat16 is the upper half of a float so widening
+ * is a shift, narrowing rounds to nearest even on the bit pattern and
+ * keeps nan quiet instead of letting the rounding carry turn it into inf
+ */
+static inline v_f32x8_t
+cvt_v8_bf16_to_f32(__m128i _xbf16)
+{
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_xbf16), 16));
+}
+
+static inline __m128i
+cvt_v8_f32_to_bf16(v_f32x8_t _xf32)
+{
+    v_u32x8_t ux  = as_v8_u32_f32(_xf32);
+    v_u32x8_t rnd = (ux + 0x7fff + ((ux >> 16) & 1)) >> 16;
+    v_u32x8_t qn  = (ux >> 16) | 0x40;
+    v_i32x8_t nan = (v_i32x8_t)((ux & 0x7fffffff) > 0x7f800000);
+    __m256i   r   = (__m256i)(((v_u32x8_t)nan & qn) | (~(v_u32x8_t)nan & rnd));
+
+    return _mm_packus_epi32(_mm256_castsi256_si128(r),
+                            _mm256_extracti128_si256(r, 1));
+}
+#endif
+
+#if defined(__AVX512F__)
+/* v16 bfloat16 <-> float, as the v8 variants above */
+static inline v_f32x16_t
+cvt_v16_bf16_to_f32(__m256i _xbf16)
+{
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_xbf16), 16));
+}
+
+static inline __m256i
+cvt_v16_f32_to_bf16(v_f32x16_t _xf32)
+{
+    v_u32x16_t ux  = as_v16_u32_f32(_xf32);
+#if defined(__AVX512BF16__)
+    /*
+     * VCVTNEPS2BF16 rounds to nearest even but reads denormals as zero,
+     * vectors with a denormal lane take the integer path below so the
+     * result is the same with and without AVX512_BF16
+     */
+    if (_mm512_cmplt_epu32_mask((__m512i)((ux & 0x7fffffff) - 1),
+                                _mm512_set1_epi32(0x007fffff)) == 0)
+        return (__m256i)_mm512_cvtneps_pbh(_xf32);
+#endif
+    v_u32x16_t rnd = (ux + 0x7fff + ((ux >> 16) & 1)) >> 16;
+    v_u32x16_t qn  = (ux >> 16) | 0x40;
+    v_i32x16_t nan = (v_i32x16_t)((ux & 0x7fffffff) > 0x7f800000);
+
+    return _mm512_cvtepi32_epi16((__m512i)(((v_u32x16_t)nan & qn) |
+                                           (~(v_u32x16_t)nan & rnd)));
+}
+#endif
+
+/*
+ * Lane select
+ *    sel_vN_A(cond, a, b) returns cond ? a : b per element, 'cond' is
+ *    a vector compare result (all 0's or all 1's per element). Used by
+ *    the special case paths to blend fixed results without leaving
+ *    the vector unit.
+ */
+static inline v_f64x2_t
+sel_v2_f64(v_u64x2_t cond, v_f64x2_t a, v_f64x2_t b)
+{
+    return as_v2_f64_u64((as_v2_u64_f64(a) & cond) | (as_v2_u64_f64(b) & ~cond));
+}
+
+static inline v_f64x4_t
+sel_v4_f64(v_u64x4_t cond, v_f64x4_t a, v_f64x4_t b)
+{
+    return as_v4_f64_u64((as_v4_u64_f64(a) & cond) | (as_v4_u64_f64(b) & ~cond));
+}
+
+static inline v_f32x4_t
+sel_v4_f32(v_u32x4_t cond, v_f32x4_t a, v_f32x4_t b)
+{
+    return as_v4_f32_u32((as_v4_u32_f32(a) & cond) | (as_v4_u32_f32(b) & ~cond));
+}
+
+static inline v_f32x8_t
+sel_v8_f32(v_u32x8_t cond, v_f32x8_t a, v_f32x8_t b)
+{
+    return as_v8_f32_u32((as_v8_u32_f32(a) & cond) | (as_v8_u32_f32(b) & ~cond));
+}
+
+#if defined(__AVX512F__)
+static inline v_f64x8_t
+sel_v8_f64(v_u64x8_t cond, v_f64x8_t a, v_f64x8_t b)
+{
+    return as_v8_f64_u64((as_v8_u64_f64(a) & cond) | (as_v8_u64_f64(b) & ~cond));
+}
+
+static inline v_f32x16_t
+sel_v16_f32(v_u32x16_t cond, v_f32x16_t a, v_f32x16_t b)
+{
+    return as_v16_f32_u32((as_v16_u32_f32(a) & cond) | (as_v16_u32_f32(b) & ~cond));
+}
+#endif
+
 /*
  * Condition Check
  *    check if any of the vector elements are set
@@ -450,35 +583,50 @@ static inline int
 any_v4_u32(v_i32x4_t cond)
 {
     const v_i32x4_t zero = _MM_SET1_I32(0);
-    return ! _mm_testz_si128((__m128i)cond, (__m128i)zero);
+    int ret = ! _mm_testz_si128((__m128i)cond, (__m128i)zero);
+
+    ALM_STATS_CHECK(ret, cond, 4);
+    return ret;
 }
 
 static inline int
 any_v8_u32(v_i32x8_t cond)
 {
     const v_i32x8_t zero = {0,};
-    return ! _mm256_testz_si256((__m256i)cond, (__m256i)zero);
+    int ret = ! _mm256_testz_si256((__m256i)cond, (__m256i)zero);
+
+    ALM_STATS_CHECK(ret, cond, 8);
+    return ret;
 }
 
 static inline int
 any_v16_u32(v_i32x16_t cond)
 {
     const v_i32x16_t zero = {0,};
-    return _mm512_cmpneq_epi32_mask((__m512i)cond, (__m512i)zero);
+    int ret = _mm512_cmpneq_epi32_mask((__m512i)cond, (__m512i)zero);
+
+    ALM_STATS_CHECK(ret, cond, 16);
+    return ret;
 }
 
 static inline int
 any_v4_u64(v_i64x4_t cond)
 {
     const v_i64x4_t zero = _MM_SET1_I64(0);
-    return ! _mm256_testz_si256((__m256i)cond, (__m256i)zero);
+    int ret = ! _mm256_testz_si256((__m256i)cond, (__m256i)zero);
+
+    ALM_STATS_CHECK(ret, cond, 4);
+    return ret;
 }
 
 static inline int
 any_v2_u64(v_i64x2_t cond)
 {
     const v_i64x2_t zero = _MM_SET1_I64x2(0);
-    return ! _mm_testz_si128((__m128i)cond, (__m128i)zero);
+    int ret = ! _mm_testz_si128((__m128i)cond, (__m128i)zero);
+
+    ALM_STATS_CHECK(ret, cond, 2);
+    return ret;
 }
 
 // Condition check with for loop for better performance
@@ -494,6 +642,7 @@ any_v4_u32_loop(v_u32x4_t cond)
         }
     }
 
+    ALM_STATS_CHECK(ret, cond, 4);
     return ret;
 }
 
@@ -510,6 +659,7 @@ any_v2_u64_loop(v_u64x2_t cond)
         }
     }
 
+    ALM_STATS_CHECK(ret, cond, 2);
     return ret;
 }
 
@@ -525,6 +675,7 @@ any_v4_u64_loop(v_u64x4_t cond)
         }
     }
 
+    ALM_STATS_CHECK(ret, cond, 4);
     return ret;
 }
 
@@ -541,6 +692,7 @@ any_v8_u64_loop(v_u64x8_t cond)
         }
     }
 
+    ALM_STATS_CHECK(ret, cond, 8);
     return ret;
 }
 
@@ -555,6 +707,7 @@ any_v16_u32_loop(v_u32x16_t cond)
         }
     }
 
+    ALM_STATS_CHECK(ret, cond, 16);
     return ret;
 }
 
@@ -849,6 +1002,7 @@ any_v8_u32_loop(v_u32x8_t cond)
         }
     }
 
+    ALM_STATS_CHECK(ret, cond, 8);
     return ret;
 }
 
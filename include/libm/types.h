@@ -43,6 +43,8 @@ typedef    short               f16_t;
 #else
 typedef    short               f16_t;
 #endif
+/* bfloat16, the upper 16 bits of a float */
+typedef    short               bf16_t;
 typedef    float               f32_t;
 typedef    double              f64_t;
 typedef    long double         f80_t;
@@ -381,6 +381,28 @@ void FN_PROTOTYPE(vrsa_linearfracf)(int len, float *x, float *y, float scx, floa
 /* Array variants of Powx */
 void FN_PROTOTYPE(vrda_powx)(int len, double *x, double y, double *result);
 
+/* Frexp, Ldexp, Scalbn, Ilogb, Logb */
+__m256d FN_PROTOTYPE(vrd4_frexp)(__m256d x, __m256i *e);
+__m256d FN_PROTOTYPE(vrd4_ldexp)(__m256d x, __m256i n);
+__m256d FN_PROTOTYPE(vrd4_scalbn)(__m256d x, __m256i n);
+__m256i FN_PROTOTYPE(vrd4_ilogb)(__m256d x);
+__m256d FN_PROTOTYPE(vrd4_logb)(__m256d x);
+__m256 FN_PROTOTYPE(vrs8_frexpf)(__m256 x, __m256i *e);
+__m256 FN_PROTOTYPE(vrs8_ldexpf)(__m256 x, __m256i n);
+__m256 FN_PROTOTYPE(vrs8_scalbnf)(__m256 x, __m256i n);
+__m256i FN_PROTOTYPE(vrs8_ilogbf)(__m256 x);
+__m256 FN_PROTOTYPE(vrs8_logbf)(__m256 x);
+void FN_PROTOTYPE(vrda_frexp)(int len, double *x, double *mant, int *expo);
+void FN_PROTOTYPE(vrsa_frexpf)(int len, float *x, float *mant, int *expo);
+void FN_PROTOTYPE(vrda_ldexp)(int len, double *x, int *expo, double *result);
+void FN_PROTOTYPE(vrsa_ldexpf)(int len, float *x, int *expo, float *result);
+void FN_PROTOTYPE(vrda_scalbn)(int len, double *x, int *expo, double *result);
+void FN_PROTOTYPE(vrsa_scalbnf)(int len, float *x, int *expo, float *result);
+void FN_PROTOTYPE(vrda_ilogb)(int len, double *x, int *result);
+void FN_PROTOTYPE(vrsa_ilogbf)(int len, float *x, int *result);
+void FN_PROTOTYPE(vrda_logb)(int len, double *x, double *result);
+void FN_PROTOTYPE(vrsa_logbf)(int len, float *x, float *result);
+
 #ifdef __cplusplus
 }
 #endif
@@ -274,7 +274,11 @@ static const float VAL_2PMMULTIPLIER_SP = 5.9604645e-8F;
 
 /*
  * The below macros are useful for masked load and store operations on 256-bit registers.
+ * A count of 0 gives an empty mask, so the tail of a zero length array is a no-op.
  */
+#define HALF_ELEMENTS_128_BIT 8
+#define BF16_ELEMENTS_128_BIT 8
+#define BF16_ELEMENTS_256_BIT 16
 #define FLOAT_ELEMENTS_128_BIT 4
 #define DOUBLE_ELEMENTS_128_BIT 2
 
@@ -291,11 +295,13 @@ static const float VAL_2PMMULTIPLIER_SP = 5.9604645e-8F;
     (rem_ele == 4 ? _mm256_set_epi32(0, 0, 0, 0, -1, -1, -1, -1) : \
     (rem_ele == 5 ? _mm256_set_epi32(0, 0, 0, -1, -1, -1, -1, -1) : \
     (rem_ele == 6 ? _mm256_set_epi32(0, 0, -1, -1, -1, -1, -1, -1) : \
-    _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1)))))))
+    (rem_ele == 7 ? _mm256_set_epi32(0, -1, -1, -1, -1, -1, -1, -1) : \
+    _mm256_setzero_si256())))))))
 
 #define GET_MASK_DOUBLE_256_BIT(rem_ele) \
     (rem_ele == 1 ? _mm256_set_epi64x(0, 0, 0, -1) : \
     (rem_ele == 2 ? _mm256_set_epi64x(0, 0, -1, -1) : \
-    _mm256_set_epi64x(0, -1, -1, -1)))
+    (rem_ele == 3 ? _mm256_set_epi64x(0, -1, -1, -1) : \
+    _mm256_setzero_si256())))
 
 #endif /* LIBM_UTIL_AMD_H_INCLUDED */
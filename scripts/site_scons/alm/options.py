@@ -117,6 +117,14 @@ class AlmOptions(object):
                         help = "Compile to use address sanitizer"
         )
 
+        #slow-path statistics, see amd_libm_stats_get()
+        self.add_option('use_stats',
+                        nargs = 1,
+                        default = 0,
+                        type =  int,
+                        help = "Compile with slow-path statistics counters"
+        )
+
         #provide libau_cpuid install path
         self.add_option('aocl_utils_install_path',
                         nargs = 1,
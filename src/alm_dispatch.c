@@ -0,0 +1,212 @@
+
+/*
+ * Copyright (C) 2008-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Dispatch table report, see amd_libm_dispatch_get() in amdlibm.h.
+ *
+ * The kernel a function and variant resolve to on a uarch is found the
+ * way alm_iface_fixup() finds it: the first non-NULL entry from that
+ * uarch's column down to the default one. Symbol names come from
+ * dladdr(), so they are known for the shared library and for programs
+ * linked to the static one with -rdynamic.
+ */
+
+#if !defined(_WIN64) && !defined(_WIN32)
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <external/amdlibm.h>
+#include <libm/entry_pt.h>
+#include <libm/iface.h>
+
+static const char *alm_uarch_names[ALM_UARCH_MAX] = {
+    "default", "base64", "fma3", "zen", "zen2", "zen3", "zen4", "zen5",
+};
+
+/* s1 scalar, vN N lanes, va array; then s, d, h, b (bfloat16), c complex */
+static const struct {
+    const char *name;
+    int         lanes;                  /* 0 for arrays */
+    int         is512;                  /* 512-bit registers */
+} alm_variants[ALM_FUNC_VAR_MAX] = {
+    [ALM_FUNC_SCAL_SP]           = {"s1s",    1,  0},
+    [ALM_FUNC_SCAL_DP]           = {"s1d",    1,  0},
+    [ALM_FUNC_VECT_SP_4]         = {"v4s",    4,  0},
+    [ALM_FUNC_VECT_SP_8]         = {"v8s",    8,  0},
+    [ALM_FUNC_VECT_DP_2]         = {"v2d",    2,  0},
+    [ALM_FUNC_VECT_DP_4]         = {"v4d",    4,  0},
+    [ALM_FUNC_VECT_SP_ARR]       = {"vas",    0,  0},
+    [ALM_FUNC_VECT_DP_ARR]       = {"vad",    0,  0},
+    [ALM_FUNC_SCAL_HP]           = {"s1h",    1,  0},
+    [ALM_FUNC_VECT_HP_8]         = {"v8h",    8,  0},
+    [ALM_FUNC_VECT_HP_16]        = {"v16h",   16, 0},
+    [ALM_FUNC_VECT_HP_32]        = {"v32h",   32, 1},
+    [ALM_FUNC_VECT_HP_ARR]       = {"vah",    0,  0},
+    [ALM_FUNC_VECT_BF16_ARR]     = {"vab",    0,  0},
+    [ALM_FUNC_VECT_BF16_F32_ARR] = {"vabf",   0,  0},
+    [ALM_FUNC_VECT_SP_16]        = {"v16s",   16, 1},
+    [ALM_FUNC_VECT_DP_8]         = {"v8d",    8,  1},
+    [ALM_FUNC_SCAL_SP_CMPLX]     = {"s1cs",   1,  0},
+    [ALM_FUNC_SCAL_DP_CMPLX]     = {"s1cd",   1,  0},
+    [ALM_FUNC_VECT_SP_CMPLX_8]   = {"v8cs",   8,  0},
+    [ALM_FUNC_VECT_SP_CMPLX_16]  = {"v16cs",  16, 1},
+    [ALM_FUNC_VECT_DP_CMPLX_4]   = {"v4cd",   4,  0},
+    [ALM_FUNC_VECT_DP_CMPLX_8]   = {"v8cd",   8,  1},
+    [ALM_FUNC_VECT_SP_CMPLX_ARR] = {"vacs",   0,  0},
+    [ALM_FUNC_VECT_DP_CMPLX_ARR] = {"vacd",   0,  0},
+    [ALM_FUNC_VECT_SP_CMPLX_SOA] = {"vacs2",  0,  0},
+    [ALM_FUNC_VECT_DP_CMPLX_SOA] = {"vacd2",  0,  0},
+};
+
+/* Column of a uarch name, the host's for NULL, ALM_UARCH_MAX for "all" */
+static int
+alm_uarch_lookup(const char *uarch)
+{
+    if (!uarch)
+        return (int)alm_iface_uarch();
+    if (strcmp(uarch, "all") == 0)
+        return ALM_UARCH_MAX;
+
+    for (int u = 0; u < ALM_UARCH_MAX; u++)
+        if (strcmp(uarch, alm_uarch_names[u]) == 0)
+            return u;
+
+    return -1;
+}
+
+static const char *
+alm_symbol(const void *addr)
+{
+#if defined(_WIN64) || defined(_WIN32)
+    return NULL;
+#else
+    Dl_info info;
+
+    if (!dladdr(addr, &info) || info.dli_saddr != addr)
+        return NULL;
+
+    return info.dli_sname;
+#endif
+}
+
+int
+amd_libm_dispatch_get(const char *uarch, struct amd_libm_kernel *k, int max)
+{
+    int u = alm_uarch_lookup(uarch);
+    int first = u == ALM_UARCH_MAX ? 0 : u;
+    int last = u == ALM_UARCH_MAX ? ALM_UARCH_MAX - 1 : u;
+    int n = 0;
+
+    if (u < 0)
+        return -1;
+
+    for (int sku = first; sku <= last; sku++) {
+        for (int e = 1; e < C_AMD_LAST_ENTRY; e++) {
+            const struct alm_arch_funcs *t = alm_iface_funcs(e);
+
+            if (!t)
+                continue;
+
+            for (int v = 0; v < ALM_FUNC_VAR_MAX; v++) {
+                const void *fn;
+                int row;
+
+                for (row = sku; row >= 0 && !t->funcs[row][v]; row--)
+                    ;
+                if (row < 0)
+                    continue;
+
+                if (n < max) {
+                    fn = t->funcs[row][v];
+
+                    k[n].sku = alm_uarch_names[sku];
+                    k[n].func = alm_iface_name(e);
+                    k[n].variant = alm_variants[v].name;
+                    k[n].uarch = alm_uarch_names[row];
+                    k[n].symbol = alm_symbol(fn);
+                    k[n].addr = fn;
+                    k[n].lanes = alm_variants[v].lanes;
+
+                    /* zen4 and zen5 kernels are built with -mavx512f */
+                    k[n].avx512 = alm_variants[v].is512 ||
+                                  fn == t->funcs[ALM_UARCH_VER_ZEN4][v] ||
+                                  fn == t->funcs[ALM_UARCH_VER_ZEN5][v];
+                }
+                n++;
+            }
+        }
+    }
+
+    return n;
+}
+
+int
+amd_libm_dump_dispatch(const char *uarch, const char *path)
+{
+    struct amd_libm_kernel *k;
+    int n = amd_libm_dispatch_get(uarch, NULL, 0);
+    FILE *f = stdout;
+
+    if (n < 0)
+        return -1;
+
+    if (!(k = malloc((size_t)(n ? n : 1) * sizeof(*k))))
+        return -1;
+    n = amd_libm_dispatch_get(uarch, k, n);
+
+    if (path && strcmp(path, "-") != 0 && !(f = fopen(path, "w"))) {
+        free(k);
+        return -1;
+    }
+
+    fprintf(f, "{\n  \"host\": \"%s\",\n  \"kernels\": [",
+            alm_uarch_names[alm_iface_uarch()]);
+    for (int i = 0; i < n; i++) {
+        fprintf(f, "%s\n    {\"sku\": \"%s\", \"function\": \"%s\", "
+                   "\"variant\": \"%s\", \"uarch\": \"%s\", ",
+                i ? "," : "", k[i].sku, k[i].func, k[i].variant, k[i].uarch);
+        if (k[i].symbol)
+            fprintf(f, "\"symbol\": \"%s\", ", k[i].symbol);
+        else
+            fprintf(f, "\"symbol\": null, ");
+        fprintf(f, "\"lanes\": %d, \"avx512\": %s}", k[i].lanes,
+                k[i].avx512 ? "true" : "false");
+    }
+    fprintf(f, "\n  ]\n}\n");
+
+    if (f != stdout)
+        fclose(f);
+    free(k);
+
+    return n;
+}
@@ -28,6 +28,7 @@
 #include <libm_util_amd.h>
 #include <libm/alm_special.h>
 #include <libm/types.h>
+#include <libm/alm_stats.h>
 
 /*#if defined(WIN64) | defined(WINDOWS)
   #else            */
@@ -76,6 +77,7 @@ float __alm_handle_errorf(uint64_t value, int flags)
 
 
 double alm_log_special(double y, U32 error_code) {
+    ALM_STATS_SPECIAL();
     flt64_t ym = {.d = y};
 
     switch (error_code) {
@@ -110,6 +112,7 @@ double alm_log_special(double y, U32 error_code) {
 float
 alm_acosf_special(float x, uint32_t code)
 {
+    ALM_STATS_SPECIAL();
     flt32_t fl = {.f = x};
     if (code == ALM_E_IN_X_NAN)
     {
@@ -130,6 +133,7 @@ alm_acosf_special(float x, uint32_t code)
 double
 alm_acos_special(double x, uint32_t code)
 {
+    ALM_STATS_SPECIAL();
     flt64_t fl = {.d = x};
     if (code == ALM_E_IN_X_NAN)
     {
@@ -150,6 +154,7 @@ alm_acos_special(double x, uint32_t code)
 float
 alm_asinf_special(float x, uint32_t code)
 {
+    ALM_STATS_SPECIAL();
     flt32_t fl = {.f = x};
     if (code == ALM_E_IN_X_NAN)
     {
@@ -169,6 +174,7 @@ alm_asinf_special(float x, uint32_t code)
 
 float _atanf_special_overflow(float x)
 {
+    ALM_STATS_SPECIAL();
     UT32 xu;
     xu.f32 = x;
     return __alm_handle_errorf(xu.u32, AMD_F_OVERFLOW);
@@ -176,6 +182,7 @@ float _atanf_special_overflow(float x)
 
 double
 alm_atan_special(double x) {
+    ALM_STATS_SPECIAL();
     flt64_t fl = {.d = x};
     return __alm_handle_error(fl.u, AMD_F_INVALID);
 }
@@ -183,6 +190,7 @@ alm_atan_special(double x) {
 double
 alm_asin_special(double x, uint32_t code)
 {
+    ALM_STATS_SPECIAL();
     flt64_t fl = {.d = x};
     if (code == ALM_E_IN_X_NAN)
     {
@@ -279,6 +287,7 @@ double _sin_cos_special(double x, char *name, uint32_t code)
 
 void _sincosf_special(float x, float *sy, float *cy)
 {
+    ALM_STATS_SPECIAL();
     float xu = _sinf_cosf_special(x, "sincosf", __amd_sin);
     *sy = xu;
     *cy = xu;
@@ -287,6 +296,7 @@ void _sincosf_special(float x, float *sy, float *cy)
 
 void _sincos_special(double x, double *sy, double *cy)
 {
+    ALM_STATS_SPECIAL();
     double xu = _sin_cos_special(x, "sincos", __amd_sin);
     *sy = xu;
     *cy = xu;
@@ -296,36 +306,43 @@ void _sincos_special(double x, double *sy, double *cy)
 /* trig functions */
 double _sin_special_underflow(double x)
 {
+    ALM_STATS_SPECIAL();
     return _sincos_special_underflow(x, "sin", __amd_sin);
 }
 
 float _sinf_special(float x)
 {
+    ALM_STATS_SPECIAL();
     return _sinf_cosf_special(x, "sinf", __amd_sin);
 }
 
 double _sin_special(double x)
 {
+    ALM_STATS_SPECIAL();
     return _sin_cos_special(x, "sin", __amd_sin);
 }
 
 float _cosf_special(float x)
 {
+    ALM_STATS_SPECIAL();
     return _sinf_cosf_special(x, "cosf",__amd_cos);
 }
 
 double _cos_special(double x)
 {
+    ALM_STATS_SPECIAL();
     return _sin_cos_special(x, "cos",__amd_cos);
 }
 
 double _tan_special(double x)
 {
+    ALM_STATS_SPECIAL();
     return _sin_cos_special(x, "tan", __amd_tan);
 }
 
 float _tanf_special(float x)
 {
+    ALM_STATS_SPECIAL();
 
     UT32 xu = {.f32 = x};
     if ((xu.u32 & ~SIGNBIT_SP32) < 0x39000000) {
@@ -336,6 +353,7 @@ float _tanf_special(float x)
 
 float _tanhf_special(float x)
 {
+    ALM_STATS_SPECIAL();
     UT32 xu = {.f32 = x};
     return __alm_handle_errorf(xu.u32, AMD_F_INEXACT|AMD_F_UNDERFLOW);
 }
@@ -343,6 +361,7 @@ float _tanhf_special(float x)
 /*fabs*/
 double _fabs_special(double x)
 {
+    ALM_STATS_SPECIAL();
     UT64 xu;
     xu.f64 = x;
 
@@ -362,6 +381,7 @@ double _fabs_special(double x)
 
 float _fabsf_special(float x)
 {
+    ALM_STATS_SPECIAL();
     UT32 xu;
     xu.f32 = x;
 
@@ -381,6 +401,7 @@ float _fabsf_special(float x)
 
 double _cbrt_special(double x)
 {
+    ALM_STATS_SPECIAL();
     UT64 xu;
     xu.f64 = x;
 
@@ -390,6 +411,7 @@ double _cbrt_special(double x)
 
 float _cbrtf_special(float x)
 {
+    ALM_STATS_SPECIAL();
     UT32 xu;
     xu.f32 = x;
 
@@ -400,6 +422,7 @@ float _cbrtf_special(float x)
 
 /* exp, log, pow*/
 float alm_expf_special(float y, U32 code) {
+    ALM_STATS_SPECIAL();
     flt32_t ym = {.f = y};
 
     switch (code) {
@@ -425,6 +448,7 @@ float alm_expf_special(float y, U32 code) {
 }
 
 double alm_exp_special(double y, U32 code) {
+    ALM_STATS_SPECIAL();
     flt64_t ym = {.d = y};
 
     switch (code) {
@@ -444,6 +468,7 @@ double alm_exp_special(double y, U32 code) {
 }
 
 double alm_expm1_special(double y, U32 code) {
+    ALM_STATS_SPECIAL();
     flt64_t ym = {.d = y};
 
     switch (code)
@@ -462,6 +487,7 @@ double alm_expm1_special(double y, U32 code) {
 }
 
 double alm_nextafter_special(double y, U32 code) {
+    ALM_STATS_SPECIAL();
     flt64_t ym = {.d = y};
 
     switch (code)
@@ -488,6 +514,7 @@ double alm_nextafter_special(double y, U32 code) {
 }
 
 float alm_nextafterf_special(float y, U32 code) {
+    ALM_STATS_SPECIAL();
     flt32_t ym = {.f = y};
 
     switch (code)
@@ -525,6 +552,7 @@ float alm_nextafterf_special(float y, U32 code) {
 #define POW_Z_INF                   9
 
 double alm_pow_special(double z, U32 code) {
+    ALM_STATS_SPECIAL();
     flt64_t zu = {.d = z};
 
     switch (code) {
@@ -556,6 +584,7 @@ double alm_pow_special(double z, U32 code) {
 }
 
 float alm_powf_special(float z, U32 code) {
+    ALM_STATS_SPECIAL();
     flt32_t zu = {.f = z};
 
     switch (code) {
@@ -590,6 +619,7 @@ float alm_powf_special(float z, U32 code) {
 #define LOG_X_NEG       2
 #define LOG_X_NAN       3
 float alm_logf_special(float y, U32 errorCode) {
+    ALM_STATS_SPECIAL();
     flt32_t ym = {.f = y};
 
     switch (errorCode) {
@@ -619,6 +649,7 @@ float alm_logf_special(float y, U32 errorCode) {
 
 /* coshf */
 float alm_coshf_special(float y, U32 errorCode) {
+    ALM_STATS_SPECIAL();
     flt32_t ym = {.f = y};
 
     switch (errorCode) {
@@ -633,6 +664,7 @@ float alm_coshf_special(float y, U32 errorCode) {
 
 double _nearbyint_special(double x)
 {
+    ALM_STATS_SPECIAL();
     UT64 checkbits;
     checkbits.f64 = x;
 
@@ -663,6 +695,7 @@ double _nearbyint_special(double x)
 
 float _truncf_special(float x, float r)
 {
+    ALM_STATS_SPECIAL();
     UT64 rm;
     rm.u64 = 0;
     rm.f32[0] = r;
@@ -672,6 +705,7 @@ float _truncf_special(float x, float r)
 
 double _trunc_special(double x, double r)
 {
+    ALM_STATS_SPECIAL();
     UT64 rm;
     rm.f64 = r;
     __alm_handle_error(rm.u64, 0);
@@ -680,6 +714,7 @@ double _trunc_special(double x, double r)
 
 double _round_special(double x, double r)
 {
+    ALM_STATS_SPECIAL();
     UT64 rm;
     rm.f64 = r;
     __alm_handle_error(rm.u64, 0);
@@ -688,6 +723,7 @@ double _round_special(double x, double r)
 
 float _fdimf_special(float x, float y, float r)
 {
+    ALM_STATS_SPECIAL();
     UT64 rm;
     rm.u64 = 0;
     rm.f32[0] = r;
@@ -697,6 +733,7 @@ float _fdimf_special(float x, float y, float r)
 
 double _fdim_special(double x, double y, double r)
 {
+    ALM_STATS_SPECIAL();
     UT64 rm;
     rm.f64 = r;
     __alm_handle_error(rm.u64, 0);
@@ -705,6 +742,7 @@ double _fdim_special(double x, double y, double r)
 
 double _fmax_special(double x, double y)
 {
+    ALM_STATS_SPECIAL();
     UT64 xu, yu;
     xu.f64 = x;
     yu.f64 = y;
@@ -725,6 +763,7 @@ double _fmax_special(double x, double y)
 
 float _fmaxf_special(float x, float y)
 {
+    ALM_STATS_SPECIAL();
     UT32 xu, yu;
     xu.f32 = x;
     yu.f32 = y;
@@ -745,6 +784,7 @@ float _fmaxf_special(float x, float y)
 
 double _fmin_special(double x, double y)
 {
+    ALM_STATS_SPECIAL();
     UT64 xu, yu;
     xu.f64 = x;
     yu.f64 = y;
@@ -765,6 +805,7 @@ double _fmin_special(double x, double y)
 
 float _fminf_special(float x, float y)
 {
+    ALM_STATS_SPECIAL();
     UT32 xu, yu;
     xu.f32 = x;
     yu.f32 = y;
@@ -788,6 +829,7 @@ float _fminf_special(float x, float y)
 #define REMAINDER_X_DIVIDEND_INF      3
 float _remainderf_special(float x, float y, U32 errorCode)
 {
+    ALM_STATS_SPECIAL();
     switch (errorCode) {
         /*All the three conditions are considered to be the same
            for Windows. It might be different for Linux.
@@ -819,6 +861,7 @@ float _remainderf_special(float x, float y, U32 errorCode)
 
 double _remainder_special(double x, double y, U32 errorCode)
 {
+    ALM_STATS_SPECIAL();
     switch (errorCode) {
         /*All the three conditions are considered to be the same
            for Windows. It might be different for Linux.
@@ -850,6 +893,7 @@ double _remainder_special(double x, double y, U32 errorCode)
 
 double _fmod_special(double x, double y, U32 errorCode)
 {
+    ALM_STATS_SPECIAL();
     switch (errorCode) {
         /*All the three conditions are considered to be the same
            for Windows. It might be different for Linux.
@@ -881,6 +925,7 @@ double _fmod_special(double x, double y, U32 errorCode)
 
 float _fmodf_special(float x, float y, U32 errorCode)
 {
+    ALM_STATS_SPECIAL();
     switch (errorCode) {
         /*All the three conditions are considered to be the same
            for Windows. It might be different for Linux.
@@ -912,6 +957,7 @@ float _fmodf_special(float x, float y, U32 errorCode)
 }
 
 double alm_ldexp_special(double y, U32 code) {
+    ALM_STATS_SPECIAL();
     flt64_t ym = {.d = y};
 
     switch (code) {
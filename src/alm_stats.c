@@ -0,0 +1,253 @@
+
+/*
+ * Copyright (C) 2008-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Slow-path statistics, see <libm/alm_stats.h>.
+ *
+ * Sites get a process-wide id on first use; each thread counts into its
+ * own block indexed by that id, so the hot path is a TLS load and an add.
+ * Blocks are never freed: the counts of a thread that has exited are
+ * still reported.
+ *
+ * With AMD_LIBM_STATS set in the environment the totals are written at
+ * exit, to stderr for "1" or "stderr", to the named file otherwise.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <external/amdlibm.h>
+#include <libm/alm_stats.h>
+
+#if defined(ALM_STATS)
+
+#if defined(_WIN64) || defined(_WIN32)
+#define ALM_TLS         __declspec(thread)
+#else
+#define ALM_TLS         __thread
+#endif
+
+#define ALM_STATS_MAX_SITES     512
+
+struct alm_stats_block {
+    uint64_t                counters[ALM_STATS_MAX_SITES][ALM_STATS_NCOUNTERS];
+    struct alm_stats_block *next;
+};
+
+static struct alm_stats_site  *alm_stats_sites[ALM_STATS_MAX_SITES];
+static int                     alm_stats_nsites;
+static struct alm_stats_block *alm_stats_blocks;
+static ALM_TLS struct alm_stats_block *alm_stats_self;
+
+static void alm_stats_atexit(void);
+
+/* Strip the build directory, "src/arch/zen4/vrd4_exp.c" -> "arch/zen4/vrd4_exp.c" */
+static const char *
+alm_stats_short_name(const char *name)
+{
+    const char *p, *s = name;
+
+    while ((p = strstr(s, "src/")) != NULL || (p = strstr(s, "src\\")) != NULL)
+        s = p + 4;
+
+    return s;
+}
+
+static int
+alm_stats_register(struct alm_stats_site *site)
+{
+    int id = __atomic_fetch_add(&alm_stats_nsites, 1, __ATOMIC_RELAXED);
+    int expected = -1;
+
+    if (id == 0 && getenv("AMD_LIBM_STATS"))
+        atexit(alm_stats_atexit);
+
+    if (id >= ALM_STATS_MAX_SITES) {
+        /* Out of slots, the site stays uncounted */
+        __atomic_store_n(&alm_stats_nsites, ALM_STATS_MAX_SITES, __ATOMIC_RELAXED);
+        id = ALM_STATS_MAX_SITES;
+    } else {
+        alm_stats_sites[id] = site;
+    }
+
+    /* Another thread may have registered the same site meanwhile */
+    if (!__atomic_compare_exchange_n(&site->id, &expected, id, 0,
+                                     __ATOMIC_RELEASE, __ATOMIC_ACQUIRE)) {
+        if (id < ALM_STATS_MAX_SITES)
+            __atomic_store_n(&alm_stats_sites[id], NULL, __ATOMIC_RELEASE);
+        id = expected;
+    }
+
+    return id;
+}
+
+static struct alm_stats_block *
+alm_stats_block_new(void)
+{
+    struct alm_stats_block *b = calloc(1, sizeof(*b));
+
+    if (!b)
+        return NULL;
+
+    b->next = __atomic_load_n(&alm_stats_blocks, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&alm_stats_blocks, &b->next, b, 1,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+
+    return b;
+}
+
+void
+alm_stats_add(struct alm_stats_site *site, int counter, uint64_t n)
+{
+    struct alm_stats_block *b = alm_stats_self;
+    int id = __atomic_load_n(&site->id, __ATOMIC_ACQUIRE);
+
+    if (__builtin_expect(id < 0, 0))
+        id = alm_stats_register(site);
+    if (__builtin_expect(id >= ALM_STATS_MAX_SITES, 0))
+        return;
+
+    if (__builtin_expect(!b, 0)) {
+        b = alm_stats_self = alm_stats_block_new();
+        if (!b)
+            return;
+    }
+
+    b->counters[id][counter] += n;
+}
+
+int
+amd_libm_stats_get(struct amd_libm_stat *stats, int max)
+{
+    struct amd_libm_stat all[ALM_STATS_MAX_SITES];
+    int nsites = __atomic_load_n(&alm_stats_nsites, __ATOMIC_ACQUIRE);
+    int count = 0;
+
+    if (nsites > ALM_STATS_MAX_SITES)
+        nsites = ALM_STATS_MAX_SITES;
+
+    for (int id = 0; id < nsites; id++) {
+        struct alm_stats_site *site = __atomic_load_n(&alm_stats_sites[id],
+                                                      __ATOMIC_ACQUIRE);
+        struct alm_stats_block *b;
+        uint64_t sum[ALM_STATS_NCOUNTERS] = {0};
+        const char *name;
+        int i;
+
+        if (!site)
+            continue;
+
+        for (b = __atomic_load_n(&alm_stats_blocks, __ATOMIC_ACQUIRE); b; b = b->next)
+            for (int c = 0; c < ALM_STATS_NCOUNTERS; c++)
+                sum[c] += b->counters[id][c];
+
+        if (!sum[ALM_STATS_CHECKS] && !sum[ALM_STATS_SPECIAL])
+            continue;
+
+        /* Every check helper inlined in a kernel is a site of its own */
+        name = alm_stats_short_name(site->name);
+        for (i = 0; i < count; i++)
+            if (strcmp(all[i].name, name) == 0)
+                break;
+
+        if (i == count) {
+            memset(&all[count], 0, sizeof(all[count]));
+            all[count++].name = name;
+        }
+
+        all[i].checks     += sum[ALM_STATS_CHECKS];
+        all[i].slow_calls += sum[ALM_STATS_SLOW_CALLS];
+        all[i].slow_lanes += sum[ALM_STATS_SLOW_LANES];
+        all[i].special    += sum[ALM_STATS_SPECIAL];
+    }
+
+    if (stats && max > 0)
+        memcpy(stats, all, (size_t)(count < max ? count : max) * sizeof(*stats));
+
+    return count;
+}
+
+void
+amd_libm_stats_reset(void)
+{
+    struct alm_stats_block *b;
+
+    for (b = __atomic_load_n(&alm_stats_blocks, __ATOMIC_ACQUIRE); b; b = b->next)
+        memset(b->counters, 0, sizeof(b->counters));
+}
+
+static void
+alm_stats_atexit(void)
+{
+    const char *path = getenv("AMD_LIBM_STATS");
+    struct amd_libm_stat *stats;
+    FILE *fp = stderr;
+    int n;
+
+    if (!path || !*path || strcmp(path, "0") == 0)
+        return;
+
+    n = amd_libm_stats_get(NULL, 0);
+    stats = calloc(n ? (size_t)n : 1, sizeof(*stats));
+    if (!stats)
+        return;
+    n = amd_libm_stats_get(stats, n);
+
+    if (strcmp(path, "1") != 0 && strcmp(path, "stderr") != 0 &&
+        (fp = fopen(path, "w")) == NULL)
+        fp = stderr;
+
+    fprintf(fp, "%-40s %14s %14s %14s %14s\n",
+            "site", "checks", "slow_calls", "slow_lanes", "special");
+    for (int i = 0; i < n; i++)
+        fprintf(fp, "%-40s %14llu %14llu %14llu %14llu\n", stats[i].name,
+                stats[i].checks, stats[i].slow_calls, stats[i].slow_lanes,
+                stats[i].special);
+
+    if (fp != stderr)
+        fclose(fp);
+    free(stats);
+}
+
+#else
+
+int
+amd_libm_stats_get(struct amd_libm_stat *stats, int max)
+{
+    return 0;
+}
+
+void
+amd_libm_stats_reset(void)
+{
+}
+
+#endif  /* ALM_STATS */
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrba_erfbf16(int length, bf16_t *input, bf16_t *result)
+ *
+ * vrba_erfbf16() computes the error function of x, for each x of the 'length'
+ * number of bfloat16 elements present in the 'input' array.
+ * The bfloat16 output is stored in the 'result' array.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Widen 16 elements of input array to float in a 512-bit register,
+ *     bfloat16 is the upper 16 bits of a float
+ *         call vrs16_erff()
+ *     Round the float results to nearest even bf16.
+ *     Store the output into result array.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Copy them into a zero filled buffer, compute as above
+ *     Copy the output of the remaining elements into result array.
+ * Return
+ *
+ * With AVX-512 BF16 the results are rounded by VCVTNEPS2BF16, except
+ * for vectors with a denormal result, which are rounded with integer
+ * arithmetic on the float bit patterns as without it, so denormals are
+ * kept either way.
+ *
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+#include <libm/arch/zen4.h>
+
+void ALM_PROTO_ARCH_ZN4(vrba_erfbf16)(int length, bf16_t *input, bf16_t *result)
+{
+    int j = 0;
+
+    for (j = 0; j <= length - BF16_ELEMENTS_256_BIT; j += BF16_ELEMENTS_256_BIT)
+    {
+        v_f32x16_t x = cvt_v16_bf16_to_f32(_mm256_loadu_si256((__m256i *)&input[j]));
+        _mm256_storeu_si256((__m256i *)&result[j], cvt_v16_f32_to_bf16(ALM_PROTO_ARCH_ZN4(vrs16_erff)(x)));
+    }
+
+    if (length - j)
+    {
+        bf16_t buf[BF16_ELEMENTS_256_BIT] = { 0 };
+
+        for (int i = 0; i < length - j; i++)
+            buf[i] = input[j + i];
+
+        v_f32x16_t x = cvt_v16_bf16_to_f32(_mm256_loadu_si256((__m256i *)buf));
+        _mm256_storeu_si256((__m256i *)buf, cvt_v16_f32_to_bf16(ALM_PROTO_ARCH_ZN4(vrs16_erff)(x)));
+
+        for (int i = 0; i < length - j; i++)
+            result[j + i] = buf[i];
+    }
+}
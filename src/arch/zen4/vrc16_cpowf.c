@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * void amd_vrc16_cpowf(__m512 xre, __m512 xim, __m512 yre, __m512 yim,
+ *                        __m512 *rre, __m512 *rim)
+ *
+ * Implementation Notes:
+ *  Computes x^y for 16 pairs of complex numbers held in split form.
+ *
+ *  Let x = r*e^(I*theta), y = c + I*d
+ *  x^y = e^(c*log(r) - d*theta) * e^(I*(c*theta + d*log(r)))
+ *
+ *  log(r) and theta are computed as in clog. As for the scalar cpow, the
+ *  error grows with |y * log(x)|.
+ *
+ *  if x is 0 and c > 0, return 0 + 0i
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+#include <libm/arch/zen4.h>
+
+void
+ALM_PROTO_ARCH_ZN4(vrc16_cpowf)(v_f32x16_t xre, v_f32x16_t xim, v_f32x16_t yre, v_f32x16_t yim, v_f32x16_t *rre, v_f32x16_t *rim)
+{
+    v_i32x16_t swap;
+    v_f32x16_t s, c, a = xre, b = xim;
+    v_f32x16_t k = cmplx_scale_v16_f32(&a, &b);
+    v_f32x16_t h = cmplx_loghypot_arg_v16_f32(a, b, &c);
+    v_f32x16_t t = cmplx_atan2_reduce_v16_f32(xim, xre, &swap);
+
+    /* log(|x|) and arg(x) */
+    v_f32x16_t lr = 0.5f * (ALM_PROTO_ARCH_ZN4(vrs16_logf)(h) + c) + (k * 0x1.62e4p-1f + k * 0x1.7f7d1cp-20f);
+    v_f32x16_t th = cmplx_atan2_fixup_v16_f32(ALM_PROTO_ARCH_ZN4(vrs16_atanf)(t), xim, xre, swap);
+
+    v_f32x16_t r     = ALM_PROTO_ARCH_ZN4(vrs16_expf)(yre * lr - yim * th);
+    v_f32x16_t theta = yre * th + yim * lr;
+
+    ALM_PROTO_ARCH_ZN4(vrs16_sincosf)(theta, &s, &c);
+
+    v_f32x16_t yr = r * c;
+    v_f32x16_t yi = r * s;
+
+    /* real result, avoids inf * 0 */
+    yi = cmplx_sel_v16_f32(theta == 0, theta, yi);
+
+    /* x is 0 and re(y) > 0 */
+    v_i32x16_t zero = (v_i32x16_t)(((as_v16_u32_f32(xre) | as_v16_u32_f32(xim)) & ~SIGNBIT_SP32) == 0) & (yre > 0);
+    yr = cmplx_sel_v16_f32(zero, _MM512_SET1_PS16(0.0f), yr);
+    yi = cmplx_sel_v16_f32(zero, _MM512_SET1_PS16(0.0f), yi);
+
+    *rre = yr;
+    *rim = yi;
+}
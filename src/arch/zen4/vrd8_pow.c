@@ -274,6 +274,11 @@ ALM_PROTO_ARCH_ZN4(vrd8_pow)(__m512d _x,__m512d _y)
     /* check if y*log(x) > 1024*ln(2) */
     v_i64x8_t condition2 = (v_i64x8_t)(v >= EXP_MAX);
 
+    /* x <= 0, denormal, inf or nan, and y inf or nan, are left to the scalar pow */
+    v_u64x8_t uy = as_v8_u64_f64(_y);
+    condition2 |= (v_i64x8_t)(ux - IMPBIT_DP64 >= PINFBITPATT_DP64 - IMPBIT_DP64) |
+                  (v_i64x8_t)((uy & SIGN_MASK) >= PINFBITPATT_DP64);
+
     z = ylogx_h * INVLN2_EXP;
 
     v_f64x8_t dn = z + EXP_HUGE;
@@ -34,6 +34,7 @@
 #include <libm/typehelper.h>
 #include <libm/typehelper-vec.h>
 #include <libm/compiler.h>
+#include <libm/pown-vec.h>
 
 #define AMD_LIBM_FMA_USABLE 1           /* needed for poly-vec.h */
 #include <libm/poly-vec.h>
@@ -174,6 +175,14 @@ static struct {
  *
  *  2. Computation of e^(y * log(x)) then proceeds similarly to vrd4_exp
  *
+ *  3. For integer y, and half-integer y = n/2, with |y| <= POWX_SMALL_Y, which is
+ *     checked once per call, x^n or x^((n-1)/2) * sqrt(x) is evaluated by a
+ *     double-double multiply chain instead (see pown-vec.h). Lanes the chain can't
+ *     handle (zero, inf, nan, x < 0 for half-integers, results near the limits of
+ *     the normal range) fall back to pow().
+ *  4. Otherwise x < 0 with an integer y, of any size, is evaluated on |x| and the
+ *     result negated for an odd y (powx_parity_y()), without leaving the vector path.
+ *
  */
 
 __m512d
@@ -181,8 +190,43 @@ ALM_PROTO_ARCH_ZN4(vrd8_powx)(__m512d _x, double _y)
 {
     __m512d result;
 
+    /* Small integer and half-integer y */
+    int yn, kind = powx_classify_y(_y, &yn);
+
+    if (kind != POWX_Y_GENERIC) {
+        v_i64x8_t spl;
+
+        if (kind == POWX_Y_INTEGER)
+            result = pown_v8_f64(_x, yn, &spl);
+        else
+            result = powx_half_v8_f64(_x, yn, &spl);
+
+        for (int i = 0; i < VECTOR_LENGTH; i++) {
+            if (unlikely(spl[i]))
+                result[i] = ALM_PROTO(pow)(_x[i], _y);
+        }
+
+        return result;
+    }
+
     v_u64x8_t ux = as_v8_u64_f64(_x);
 
+    /*
+     * Negative x with an integer y is evaluated on |x| and negated for an
+     * odd y. Zero, denormal, inf and nan x, and negative x with any other
+     * y, are left to pow().
+     */
+    int parity = powx_parity_y(_y);
+
+    v_u64x8_t sign = ux & SIGNBIT_DP64;
+
+    if (parity != POWX_Y_NOT_INT)
+        ux ^= sign;
+
+    sign &= (parity == POWX_Y_ODD) ? SIGNBIT_DP64 : 0;
+
+    v_i64x8_t spl = (v_i64x8_t)((ux - IMPBIT_DP64) >= (PINFBITPATT_DP64 - IMPBIT_DP64));
+
     /* This portion of the code is a vectorized version of the scalar log.c, with some checks removed */
 
     v_i32x8_t int32_exponent;
@@ -293,7 +337,9 @@ ALM_PROTO_ARCH_ZN4(vrd8_powx)(__m512d _x, double _y)
     v_f64x8_t poly2 = POLY_EVAL_11(r, B1, B1, B3, B4, B5, B6,
                                   B7, B8, B9, B10, B11, B12);
 
-    result = poly2 * as_v8_f64_i64(m);
+    result = as_v8_f64_u64(as_v8_u64_f64(poly2 * as_v8_f64_i64(m)) | sign);
+
+    condition2 |= spl;
 
     for(int i = 0; i < VECTOR_LENGTH; i++) {
         if(unlikely((condition2)[i])){
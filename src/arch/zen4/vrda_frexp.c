@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+#include <libm/arch/zen4.h>
+
+/*
+ * Signature:
+ *    void amd_vrda_frexp(int length, double *input, double *mant, int *expo)
+ *
+ * Implementation Notes:
+ *    Processes 8 elements per iteration with vrd8_frexp(), the 64-bit
+ *    exponents are narrowed to int while storing.
+ *    Remaining elements are handled with masked loads and stores,
+ *    so that 'input' and 'mant' can be the same array.
+ */
+
+void
+ALM_PROTO_ARCH_ZN4(vrda_frexp)(int length, double *input, double *mant, int *expo)
+{
+    int j = 0;
+    __m512i e8;
+
+    for (j = 0; j <= length - DOUBLE_ELEMENTS_512_BIT; j += DOUBLE_ELEMENTS_512_BIT)
+    {
+        __m512d ip8 = _mm512_loadu_pd(&input[j]);
+        __m512d op8 = ALM_PROTO_ARCH_ZN4(vrd8_frexp)(ip8, &e8);
+        _mm512_storeu_pd(&mant[j], op8);
+        _mm256_storeu_si256((__m256i *)&expo[j], _mm512_cvtepi64_epi32(e8));
+    }
+
+    if (length - j)
+    {
+        __mmask8 mask = (__mmask8)((1U << (length - j)) - 1);
+        __m512d ip8 = _mm512_maskz_loadu_pd(mask, &input[j]);
+        __m512d op8 = ALM_PROTO_ARCH_ZN4(vrd8_frexp)(ip8, &e8);
+        _mm512_mask_storeu_pd(&mant[j], mask, op8);
+        _mm512_mask_cvtepi64_storeu_epi32(&expo[j], mask, e8);
+    }
+}
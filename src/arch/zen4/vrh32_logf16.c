@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * __m512i amd_vrh32_logf16(__m512i x)
+ *
+ * Implementation Notes:
+ *  Computes the natural logarithm of x for 32 half precision elements held as IEEE
+ *  binary16 bit patterns in a 512-bit register.
+ *
+ *  Each 256-bit half of the register is widened to float,
+ *  evaluated by vrs16_logf() and rounded to nearest even half precision.
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/arch/zen4.h>
+
+__m512i
+ALM_PROTO_ARCH_ZN4(vrh32_logf16)(__m512i x)
+{
+    v_f32x16_t xlo = cvt_v16_f16_to_f32(_mm512_castsi512_si256(x));
+    v_f32x16_t xhi = cvt_v16_f16_to_f32(_mm512_extracti64x4_epi64(x, 1));
+
+    v_f32x16_t rlo = ALM_PROTO_ARCH_ZN4(vrs16_logf)(xlo);
+    v_f32x16_t rhi = ALM_PROTO_ARCH_ZN4(vrs16_logf)(xhi);
+
+    return _mm512_inserti64x4(_mm512_castsi256_si512(cvt_v16_f32_to_f16(rlo)),
+                              cvt_v16_f32_to_f16(rhi), 1);
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libm_macros.h>
+#include <libm/compiler.h>
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+
+#include <libm/arch/zen4.h>
+
+/*
+ * Signature:
+ *    __m512i amd_vrs16_ilogbf(v_f32x16_t x)
+ *
+ * Implementation Notes:
+ *    Extracts the unbiased exponent of each element of x as a signed
+ *    integer (32-bit elements), using vgetexpps.
+ *
+ *    if x is +/-0 or nan, return INT_MIN
+ *    if x is +/-inf, return INT_MAX
+ */
+
+/* QNaN, +0, -0, SNaN */
+#define ILOGBF_FPCLASS_ZERO_NAN 0x87
+/* +Inf, -Inf */
+#define ILOGBF_FPCLASS_INF      0x18
+
+__m512i
+ALM_PROTO_ARCH_ZN4(vrs16_ilogbf)(v_f32x16_t x)
+{
+    __mmask16 zero_nan = _mm512_fpclass_ps_mask(x, ILOGBF_FPCLASS_ZERO_NAN);
+    __mmask16 inf      = _mm512_fpclass_ps_mask(x, ILOGBF_FPCLASS_INF);
+
+    __m512i ret = _mm512_cvttps_epi32(_mm512_getexp_ps(x));
+
+    ret = _mm512_mask_blend_epi32(zero_nan, ret, _mm512_set1_epi32(INT_MIN));
+    ret = _mm512_mask_blend_epi32(inf, ret, _mm512_set1_epi32(INT_MAX));
+
+    return ret;
+}
@@ -234,13 +234,25 @@ update_condition(v_i32x8_t* cond1, v_i64x8_t cond2)
 }
 
 
+/*
+ * x negative, zero, denormal, inf or nan, and y * log(x) out of range.
+ * x and y are exact in double, both halves are recomputed by vrd4_pow,
+ * whose special cases are blended in the vector unit, rounded to float
+ * once and blended into the flagged lanes
+ */
 static inline v_f32x8_t
 powf_specialcase(v_f32x8_t _x,
                  v_f32x8_t _y,
                  v_f32x8_t result,
                  v_i32x8_t cond)
 {
-    return call2_v8_f32(ALM_PROTO(powf), _x, _y, result, cond);
+    v_f64x4_t lo = ALM_PROTO(vrd4_pow)(_mm256_cvtps_pd(_mm256_castps256_ps128(_x)),
+                                       _mm256_cvtps_pd(_mm256_castps256_ps128(_y)));
+    v_f64x4_t hi = ALM_PROTO(vrd4_pow)(_mm256_cvtps_pd(_mm256_extractf128_ps(_x, 1)),
+                                       _mm256_cvtps_pd(_mm256_extractf128_ps(_y, 1)));
+
+    return sel_v8_f32((v_u32x8_t)(cond != 0),
+                      _mm256_setr_m128(_mm256_cvtpd_ps(lo), _mm256_cvtpd_ps(hi)), result);
 }
 
 static inline v_f64x8_t
@@ -265,7 +277,7 @@ ALM_PROTO_ARCH_ZN4(vrs8_powf)(__m256 x,__m256 y) {
 
     u = as_v8_u32_f32(x);
 
-    v_i32x8_t condition = (u >= V_MAX);
+    v_i32x8_t condition = ((u - V_MIN) >= (V_MAX - V_MIN));
 
     v_i32x8_t int_exponent = (((v_i32x8_t)u) >> 23) - SP_BIAS;
 
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+#include <libm/arch/zen4.h>
+
+/*
+ * Signature:
+ *    void amd_vrsa_ilogbf(int length, float *input, int *result)
+ *
+ * Implementation Notes:
+ *    Processes 16 elements per iteration with vrs16_ilogbf().
+ *    Remaining elements are handled with masked loads and stores.
+ */
+
+void
+ALM_PROTO_ARCH_ZN4(vrsa_ilogbf)(int length, float *input, int *result)
+{
+    int j = 0;
+
+    for (j = 0; j <= length - FLOAT_ELEMENTS_512_BIT; j += FLOAT_ELEMENTS_512_BIT)
+    {
+        __m512 ip16 = _mm512_loadu_ps(&input[j]);
+        __m512i op16 = ALM_PROTO_ARCH_ZN4(vrs16_ilogbf)(ip16);
+        _mm512_storeu_si512(&result[j], op16);
+    }
+
+    if (length - j)
+    {
+        __mmask16 mask = (__mmask16)((1U << (length - j)) - 1);
+        __m512 ip16 = _mm512_maskz_loadu_ps(mask, &input[j]);
+        __m512i op16 = ALM_PROTO_ARCH_ZN4(vrs16_ilogbf)(ip16);
+        _mm512_mask_storeu_epi32(&result[j], mask, op16);
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * void amd_vrz8_clog(__m512d re, __m512d im, __m512d *rre, __m512d *rim)
+ *
+ * Implementation Notes:
+ *  Computes log(z) for 8 complex numbers z = re + I*im held in split form.
+ *
+ *  log(z) = log(|z|) + I*arg(z)
+ *
+ *  re and im are scaled by a common power of two 2^-k before squaring, so
+ *  log(|z|) = 0.5 * log(re'^2 + im'^2) + k*log(2) neither overflows nor
+ *  underflows. Close to |z| = 1, re'^2 + im'^2 - 1 is summed exactly and
+ *  log(1 + t) is corrected to first order, so there is no cancellation.
+ *  arg(z) is computed as atan2(im, re) from atan of the ratio of the
+ *  smaller to the larger component.
+ *
+ *  clog(+-0 + 0i)  = -inf + (0 or pi)i
+ *  clog(+-inf + yi) = inf + ..., for any y including nan
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+#include <libm/arch/zen4.h>
+
+void
+ALM_PROTO_ARCH_ZN4(vrz8_clog)(v_f64x8_t re, v_f64x8_t im, v_f64x8_t *rre, v_f64x8_t *rim)
+{
+    v_i64x8_t swap;
+    v_f64x8_t c, a = re, b = im;
+    v_f64x8_t k = cmplx_scale_v8_f64(&a, &b);
+    v_f64x8_t h = cmplx_loghypot_arg_v8_f64(a, b, &c);
+    v_f64x8_t t = cmplx_atan2_reduce_v8_f64(im, re, &swap);
+
+    v_f64x8_t yr = 0.5 * (ALM_PROTO_ARCH_ZN4(vrd8_log)(h) + c) + (k * 0x1.62e42fefa3800p-1 + k * 0x1.ef35793c76730p-45);
+    v_f64x8_t yi = cmplx_atan2_fixup_v8_f64(ALM_PROTO_ARCH_ZN4(vrd8_atan)(t), im, re, swap);
+
+    /* +/-inf in either part */
+    v_u64x8_t inf = (v_u64x8_t)(((as_v8_u64_f64(re) & ~SIGNBIT_DP64) == PINFBITPATT_DP64) |
+                   ((as_v8_u64_f64(im) & ~SIGNBIT_DP64) == PINFBITPATT_DP64));
+    yr = as_v8_f64_u64((as_v8_u64_f64(yr) & ~inf) | (inf & PINFBITPATT_DP64));
+
+    *rre = yr;
+    *rim = yi;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libm_macros.h>
+#include <libm/compiler.h>
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+
+#include <libm/arch/zen5.h>
+
+/*
+ * Signature:
+ *    v_f64x8_t amd_vrd8_frexp(v_f64x8_t x, __m512i *e)
+ *
+ * Implementation Notes:
+ *    Breaks each element of x into a normalized fraction m and an
+ *    integral power of two e (64-bit elements) such that x = m * 2^e,
+ *    0.5 <= |m| < 1.
+ *
+ *    vgetmantpd gives the fraction normalized to [0.5, 1) keeping the sign
+ *    of x, vgetexppd gives floor(log2(|x|)) for normals and denormals alike.
+ *
+ *    if x is +/-0, +/-inf or nan, return x and e = 0
+ */
+
+/* QNaN, +0, -0, +Inf, -Inf, SNaN */
+#define FREXP_FPCLASS_SPECIAL 0x9f
+
+v_f64x8_t
+ALM_PROTO_ARCH_ZN5(vrd8_frexp)(v_f64x8_t x, __m512i *e)
+{
+    __mmask8 special = _mm512_fpclass_pd_mask(x, FREXP_FPCLASS_SPECIAL);
+
+    v_f64x8_t m  = _mm512_getmant_pd(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    v_f64x8_t ex = _mm512_getexp_pd(x);
+
+    m = _mm512_mask_add_pd(m, special, x, x);
+
+    *e = _mm512_maskz_cvttpd_epi64((__mmask8)~special,
+                                   _mm512_add_pd(ex, _MM512_SET1_PD8(1.0)));
+
+    return m;
+}
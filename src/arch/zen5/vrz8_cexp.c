@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * void amd_vrz8_cexp(__m512d re, __m512d im, __m512d *rre, __m512d *rim)
+ *
+ * Implementation Notes:
+ *  Computes exp(z) for 8 complex numbers z = re + I*im held in split form.
+ *
+ *  exp(z) = exp(re) * (cos(im) + I*sin(im))
+ *
+ *  If exp(re) overflows, the result is evaluated as
+ *  (trig(im) * exp(MAX_ARG)) * exp(re - MAX_ARG) so that results which are
+ *  still representable are not lost.
+ *
+ *  cexp(x + 0i)    = exp(x) + 0i, sign of zero retained
+ *  cexp(-inf + yi) = 0 +/- 0i, for y inf or nan, with the sign of y
+ *  cexp(+inf + yi) = inf + nan i, for y inf or nan
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+#include <libm/arch/zen5.h>
+
+void
+ALM_PROTO_ARCH_ZN5(vrz8_cexp)(v_f64x8_t re, v_f64x8_t im, v_f64x8_t *rre, v_f64x8_t *rim)
+{
+    v_f64x8_t s, c;
+    v_i64x8_t big = re > 0x1.62e42fefa39efp+9;
+
+    v_f64x8_t e = ALM_PROTO_ARCH_ZN5(vrd8_exp)(cmplx_sel_v8_f64(big, _MM512_SET1_PD8(0x1.62e42fefa39efp+9), re));
+
+    ALM_PROTO_ARCH_ZN5(vrd8_sincos)(im, &s, &c);
+
+    v_f64x8_t yr = c * e;
+    v_f64x8_t yi = s * e;
+
+    /* exp(re) overflows, scale by exp(re - MAX_ARG) last, a tiny trig(im)
+     * times exp(re - MAX_ARG) would be rounded as a denormal */
+    if (unlikely(any_v8_u64_loop((v_u64x8_t)big))) {
+        v_f64x8_t t = ALM_PROTO_ARCH_ZN5(vrd8_exp)(cmplx_sel_v8_f64(big, re - 0x1.62e42fefa39efp+9, _MM512_SET1_PD8(0.0)));
+        yr = yr * t;
+        yi = yi * t;
+    }
+
+    v_u64x8_t uim  = as_v8_u64_f64(im) & ~SIGNBIT_DP64;
+    v_i64x8_t nfin = (v_i64x8_t)(uim >= PINFBITPATT_DP64);
+    v_i64x8_t pinf = (v_i64x8_t)(as_v8_u64_f64(re) == PINFBITPATT_DP64) & nfin;
+    v_i64x8_t ninf = (v_i64x8_t)(as_v8_u64_f64(re) == NINFBITPATT_DP64) & nfin;
+
+    yi = cmplx_sel_v8_f64(im == 0, im, yi);
+    yr = cmplx_sel_v8_f64(pinf, re, yr);
+    yr = cmplx_sel_v8_f64(ninf, _MM512_SET1_PD8(0.0), yr);
+    yi = cmplx_sel_v8_f64(ninf, as_v8_f64_u64(as_v8_u64_f64(im) & SIGNBIT_DP64), yi);
+
+    *rre = yr;
+    *rim = yi;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * void amd_vrz8_cpow(__m512d xre, __m512d xim, __m512d yre, __m512d yim,
+ *                        __m512d *rre, __m512d *rim)
+ *
+ * Implementation Notes:
+ *  Computes x^y for 8 pairs of complex numbers held in split form.
+ *
+ *  Let x = r*e^(I*theta), y = c + I*d
+ *  x^y = e^(c*log(r) - d*theta) * e^(I*(c*theta + d*log(r)))
+ *
+ *  log(r) and theta are computed as in clog. As for the scalar cpow, the
+ *  error grows with |y * log(x)|.
+ *
+ *  if x is 0 and c > 0, return 0 + 0i
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+#include <libm/arch/zen5.h>
+
+void
+ALM_PROTO_ARCH_ZN5(vrz8_cpow)(v_f64x8_t xre, v_f64x8_t xim, v_f64x8_t yre, v_f64x8_t yim, v_f64x8_t *rre, v_f64x8_t *rim)
+{
+    v_i64x8_t swap;
+    v_f64x8_t s, c, a = xre, b = xim;
+    v_f64x8_t k = cmplx_scale_v8_f64(&a, &b);
+    v_f64x8_t h = cmplx_loghypot_arg_v8_f64(a, b, &c);
+    v_f64x8_t t = cmplx_atan2_reduce_v8_f64(xim, xre, &swap);
+
+    /* log(|x|) and arg(x) */
+    v_f64x8_t lr = 0.5 * (ALM_PROTO_ARCH_ZN5(vrd8_log)(h) + c) + (k * 0x1.62e42fefa3800p-1 + k * 0x1.ef35793c76730p-45);
+    v_f64x8_t th = cmplx_atan2_fixup_v8_f64(ALM_PROTO_ARCH_ZN5(vrd8_atan)(t), xim, xre, swap);
+
+    v_f64x8_t r     = ALM_PROTO_ARCH_ZN5(vrd8_exp)(yre * lr - yim * th);
+    v_f64x8_t theta = yre * th + yim * lr;
+
+    ALM_PROTO_ARCH_ZN5(vrd8_sincos)(theta, &s, &c);
+
+    v_f64x8_t yr = r * c;
+    v_f64x8_t yi = r * s;
+
+    /* real result, avoids inf * 0 */
+    yi = cmplx_sel_v8_f64(theta == 0, theta, yi);
+
+    /* x is 0 and re(y) > 0 */
+    v_i64x8_t zero = (v_i64x8_t)(((as_v8_u64_f64(xre) | as_v8_u64_f64(xim)) & ~SIGNBIT_DP64) == 0) & (yre > 0);
+    yr = cmplx_sel_v8_f64(zero, _MM512_SET1_PD8(0.0), yr);
+    yi = cmplx_sel_v8_f64(zero, _MM512_SET1_PD8(0.0), yi);
+
+    *rre = yr;
+    *rim = yi;
+}
@@ -85,11 +85,23 @@ alm_func_t        G_ENTRY_PT_PTR(sin);
 alm_func_t        G_ENTRY_PT_PTR(sinh);
 alm_func_t        G_ENTRY_PT_PTR(sinpi);
 alm_func_t        G_ENTRY_PT_PTR(sqrt);
+alm_func_t        G_ENTRY_PT_PTR(rsqrt);
+alm_func_t        G_ENTRY_PT_PTR(rsqrt_approx);
+alm_func_t        G_ENTRY_PT_PTR(invcbrt);
+alm_func_t        G_ENTRY_PT_PTR(rhypot);
 alm_func_t        G_ENTRY_PT_PTR(tan);
 alm_func_t        G_ENTRY_PT_PTR(tanh);
 alm_func_t        G_ENTRY_PT_PTR(tanpi);
 alm_func_t        G_ENTRY_PT_PTR(trunc);
 alm_func_t        G_ENTRY_PT_PTR(erf);
+alm_func_t        G_ENTRY_PT_PTR(erfc);
+alm_func_t        G_ENTRY_PT_PTR(erfinv);
+alm_func_t        G_ENTRY_PT_PTR(erfcinv);
+alm_func_t        G_ENTRY_PT_PTR(cdfnorm);
+alm_func_t        G_ENTRY_PT_PTR(cdfnorminv);
+alm_func_t        G_ENTRY_PT_PTR(lgamma);
+alm_func_t        G_ENTRY_PT_PTR(tgamma);
+alm_func_t        G_ENTRY_PT_PTR(digamma);
 alm_func_t        G_ENTRY_PT_PTR(linearfrac);
 
 /*
@@ -149,11 +161,23 @@ alm_func_t        G_ENTRY_PT_PTR(sinf);
 alm_func_t        G_ENTRY_PT_PTR(sinhf);
 alm_func_t        G_ENTRY_PT_PTR(sinpif);
 alm_func_t        G_ENTRY_PT_PTR(sqrtf);
+alm_func_t        G_ENTRY_PT_PTR(rsqrtf);
+alm_func_t        G_ENTRY_PT_PTR(rsqrtf_approx);
+alm_func_t        G_ENTRY_PT_PTR(invcbrtf);
+alm_func_t        G_ENTRY_PT_PTR(rhypotf);
 alm_func_t        G_ENTRY_PT_PTR(tanf);
 alm_func_t        G_ENTRY_PT_PTR(tanhf);
 alm_func_t        G_ENTRY_PT_PTR(tanpif);
 alm_func_t        G_ENTRY_PT_PTR(truncf);
 alm_func_t        G_ENTRY_PT_PTR(erff);
+alm_func_t        G_ENTRY_PT_PTR(erfcf);
+alm_func_t        G_ENTRY_PT_PTR(erfinvf);
+alm_func_t        G_ENTRY_PT_PTR(erfcinvf);
+alm_func_t        G_ENTRY_PT_PTR(cdfnormf);
+alm_func_t        G_ENTRY_PT_PTR(cdfnorminvf);
+alm_func_t        G_ENTRY_PT_PTR(lgammaf);
+alm_func_t        G_ENTRY_PT_PTR(tgammaf);
+alm_func_t        G_ENTRY_PT_PTR(digammaf);
 
 /*
  * Complex variants
@@ -163,6 +187,73 @@ alm_func_t        G_ENTRY_PT_PTR(cexp);
 alm_func_t        G_ENTRY_PT_PTR(clogf);
 alm_func_t        G_ENTRY_PT_PTR(clog);
 alm_func_t        G_ENTRY_PT_PTR(cpowf);
+alm_func_t        G_ENTRY_PT_PTR(csin);
+alm_func_t        G_ENTRY_PT_PTR(csinf);
+alm_func_t        G_ENTRY_PT_PTR(ccos);
+alm_func_t        G_ENTRY_PT_PTR(ccosf);
+alm_func_t        G_ENTRY_PT_PTR(ctan);
+alm_func_t        G_ENTRY_PT_PTR(ctanf);
+alm_func_t        G_ENTRY_PT_PTR(csqrt);
+alm_func_t        G_ENTRY_PT_PTR(csqrtf);
+alm_func_t        G_ENTRY_PT_PTR(cabs);
+alm_func_t        G_ENTRY_PT_PTR(cabsf);
+alm_func_t        G_ENTRY_PT_PTR(carg);
+alm_func_t        G_ENTRY_PT_PTR(cargf);
+alm_func_t        G_ENTRY_PT_PTR(expf16);
+alm_func_t        G_ENTRY_PT_PTR(logf16);
+alm_func_t        G_ENTRY_PT_PTR(sinf16);
+alm_func_t        G_ENTRY_PT_PTR(cosf16);
+alm_func_t        G_ENTRY_PT_PTR(tanhf16);
+alm_func_t        G_ENTRY_PT_PTR(erff16);
+alm_func_t        G_ENTRY_PT_PTR(sqrtf16);
+alm_func_t        G_ENTRY_PT_PTR(powf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_expf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_logf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_sinf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_cosf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_tanhf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_erff16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_sqrtf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_powf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_expf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_logf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_sinf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_cosf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_tanhf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_erff16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_sqrtf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_powf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_expf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_logf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_sinf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_cosf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_tanhf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_erff16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_sqrtf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_powf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_expf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_logf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_sinf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_cosf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_tanhf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_erff16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_sqrtf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_powf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_expbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_expbf16_f32);
+alm_func_t        G_ENTRY_PT_PTR(vrba_logbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_logbf16_f32);
+alm_func_t        G_ENTRY_PT_PTR(vrba_tanhbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_tanhbf16_f32);
+alm_func_t        G_ENTRY_PT_PTR(vrba_erfbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_erfbf16_f32);
+alm_func_t        G_ENTRY_PT_PTR(vrba_sigmoidbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_sigmoidbf16_f32);
+alm_func_t        G_ENTRY_PT_PTR(vrba_silubf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_softplusbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_gelubf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_gelu_tanhbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_softmaxbf16);
 alm_func_t        G_ENTRY_PT_PTR(cpow);
 
 /*
@@ -212,6 +303,48 @@ alm_func_t        G_ENTRY_PT_PTR(vrda_divi);
 alm_func_t        G_ENTRY_PT_PTR(vrda_fmaxi);
 alm_func_t        G_ENTRY_PT_PTR(vrda_fmini);
 alm_func_t        G_ENTRY_PT_PTR(vrda_powx);
+alm_func_t        G_ENTRY_PT_PTR(vrda_pown);
+alm_func_t        G_ENTRY_PT_PTR(vrda_rootn);
+alm_func_t        G_ENTRY_PT_PTR(vrda_frexp);
+alm_func_t        G_ENTRY_PT_PTR(vrda_ldexp);
+alm_func_t        G_ENTRY_PT_PTR(vrda_scalbn);
+alm_func_t        G_ENTRY_PT_PTR(vrda_ilogb);
+alm_func_t        G_ENTRY_PT_PTR(vrda_logb);
+alm_func_t        G_ENTRY_PT_PTR(vrda_exp_affine);
+alm_func_t        G_ENTRY_PT_PTR(vrda_log_affine);
+alm_func_t        G_ENTRY_PT_PTR(vrda_pow_affine);
+alm_func_t        G_ENTRY_PT_PTR(vrda_sin_affine);
+alm_func_t        G_ENTRY_PT_PTR(vrda_cos_affine);
+alm_func_t        G_ENTRY_PT_PTR(vrda_sumexp);
+alm_func_t        G_ENTRY_PT_PTR(vrda_logsumexp);
+alm_func_t        G_ENTRY_PT_PTR(vrda_sumlog);
+alm_func_t        G_ENTRY_PT_PTR(vrda_cis);
+alm_func_t        G_ENTRY_PT_PTR(vrda_polar);
+alm_func_t        G_ENTRY_PT_PTR(vrda_boxmuller);
+alm_func_t        G_ENTRY_PT_PTR(vrda_cdfnorminv);
+alm_func_t        G_ENTRY_PT_PTR(vrda_erfc);
+alm_func_t        G_ENTRY_PT_PTR(vrda_erfinv);
+alm_func_t        G_ENTRY_PT_PTR(vrda_erfcinv);
+alm_func_t        G_ENTRY_PT_PTR(vrda_cdfnorm);
+alm_func_t        G_ENTRY_PT_PTR(vrda_lgamma);
+alm_func_t        G_ENTRY_PT_PTR(vrda_tgamma);
+alm_func_t        G_ENTRY_PT_PTR(vrda_digamma);
+alm_func_t        G_ENTRY_PT_PTR(vrda_rsqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrda_rsqrt_approx);
+alm_func_t        G_ENTRY_PT_PTR(vrda_invcbrt);
+alm_func_t        G_ENTRY_PT_PTR(vrda_rhypot);
+alm_func_t        G_ENTRY_PT_PTR(vrza_cexp);
+alm_func_t        G_ENTRY_PT_PTR(vrza_clog);
+alm_func_t        G_ENTRY_PT_PTR(vrza_cpow);
+alm_func_t        G_ENTRY_PT_PTR(vrza_csin);
+alm_func_t        G_ENTRY_PT_PTR(vrza_ccos);
+alm_func_t        G_ENTRY_PT_PTR(vrza_ctan);
+alm_func_t        G_ENTRY_PT_PTR(vrza_csqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrza_cabs);
+alm_func_t        G_ENTRY_PT_PTR(vrza_carg);
+alm_func_t        G_ENTRY_PT_PTR(vrza_cexp_soa);
+alm_func_t        G_ENTRY_PT_PTR(vrza_clog_soa);
+alm_func_t        G_ENTRY_PT_PTR(vrza_cpow_soa);
 
 alm_func_t        G_ENTRY_PT_PTR(vrsa_cosf);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_expf);
@@ -244,6 +377,53 @@ alm_func_t        G_ENTRY_PT_PTR(vrsa_divfi);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_fmaxfi);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_fminfi);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_powxf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_frexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_ldexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_scalbnf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_ilogbf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_logbf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_expf_affine);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_logf_affine);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_powf_affine);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_sinf_affine);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_cosf_affine);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_tanhf_affine);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_sumexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_logsumexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_sumlogf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_sigmoidf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_siluf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_softplusf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_geluf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_gelu_tanhf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_softmaxf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_cisf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_polarf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_boxmullerf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_erfcf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_erfinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_erfcinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_cdfnormf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_cdfnorminvf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_lgammaf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_tgammaf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_digammaf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_rsqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_rsqrtf_approx);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_invcbrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_rhypotf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_clogf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cpowf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_csinf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_ccosf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_ctanf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_csqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cabsf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cargf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cexpf_soa);
+alm_func_t        G_ENTRY_PT_PTR(vrca_clogf_soa);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cpowf_soa);
 
 alm_func_t        G_ENTRY_PT_PTR(sincos);
 alm_func_t        G_ENTRY_PT_PTR(sincosf);
@@ -272,6 +452,15 @@ alm_func_t        G_ENTRY_PT_PTR(vrs4_fabsf);
 alm_func_t        G_ENTRY_PT_PTR(vrs4_sqrtf);
 alm_func_t        G_ENTRY_PT_PTR(vrs4_linearfracf);
 alm_func_t        G_ENTRY_PT_PTR(vrs4_sincosf);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_erfcf);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_erfinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_erfcinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_cdfnormf);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_cdfnorminvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_rsqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_rsqrtf_approx);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_invcbrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_rhypotf);
 
 alm_func_t        G_ENTRY_PT_PTR(vrs8_logf);
 alm_func_t        G_ENTRY_PT_PTR(vrs8_log10f);
@@ -293,6 +482,32 @@ alm_func_t        G_ENTRY_PT_PTR(vrs8_fabsf);
 alm_func_t        G_ENTRY_PT_PTR(vrs8_sqrtf);
 alm_func_t        G_ENTRY_PT_PTR(vrs8_linearfracf);
 alm_func_t        G_ENTRY_PT_PTR(vrs8_sincosf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_frexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_ldexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_scalbnf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_ilogbf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_logbf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_erfcf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_erfinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_erfcinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_cdfnormf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_cdfnorminvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_lgammaf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_tgammaf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_digammaf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_rsqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_rsqrtf_approx);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_invcbrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_rhypotf);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_cexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_clogf);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_cpowf);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_csinf);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_ccosf);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_ctanf);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_csqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_cabsf);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_cargf);
 
 alm_func_t        G_ENTRY_PT_PTR(vrs16_logf);
 alm_func_t        G_ENTRY_PT_PTR(vrs16_expf);
@@ -313,6 +528,26 @@ alm_func_t        G_ENTRY_PT_PTR(vrs16_log10f);
 alm_func_t        G_ENTRY_PT_PTR(vrs16_sqrtf);
 alm_func_t        G_ENTRY_PT_PTR(vrs16_linearfracf);
 alm_func_t        G_ENTRY_PT_PTR(vrs16_sincosf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_frexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_ldexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_scalbnf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_ilogbf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_logbf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_erfcf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_erfinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_erfcinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_cdfnormf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_cdfnorminvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_lgammaf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_tgammaf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_digammaf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_rsqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_rsqrtf_approx);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_invcbrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_rhypotf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_cexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_clogf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_cpowf);
 
 alm_func_t        G_ENTRY_PT_PTR(vrd2_cbrt);
 alm_func_t        G_ENTRY_PT_PTR(vrd2_cos);
@@ -334,6 +569,15 @@ alm_func_t        G_ENTRY_PT_PTR(vrd2_sincos);
 alm_func_t        G_ENTRY_PT_PTR(vrd2_sqrt);
 alm_func_t        G_ENTRY_PT_PTR(vrd2_fabs);
 alm_func_t        G_ENTRY_PT_PTR(vrd2_linearfrac);
+alm_func_t        G_ENTRY_PT_PTR(vrd2_erfc);
+alm_func_t        G_ENTRY_PT_PTR(vrd2_erfinv);
+alm_func_t        G_ENTRY_PT_PTR(vrd2_erfcinv);
+alm_func_t        G_ENTRY_PT_PTR(vrd2_cdfnorm);
+alm_func_t        G_ENTRY_PT_PTR(vrd2_cdfnorminv);
+alm_func_t        G_ENTRY_PT_PTR(vrd2_rsqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrd2_rsqrt_approx);
+alm_func_t        G_ENTRY_PT_PTR(vrd2_invcbrt);
+alm_func_t        G_ENTRY_PT_PTR(vrd2_rhypot);
 
 alm_func_t        G_ENTRY_PT_PTR(vrd4_cbrt);
 alm_func_t        G_ENTRY_PT_PTR(vrd4_cos);
@@ -346,6 +590,7 @@ alm_func_t        G_ENTRY_PT_PTR(vrd4_log10);
 alm_func_t        G_ENTRY_PT_PTR(vrd4_log1p);
 alm_func_t        G_ENTRY_PT_PTR(vrd4_pow);
 alm_func_t        G_ENTRY_PT_PTR(vrd4_powx);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_pown);
 alm_func_t        G_ENTRY_PT_PTR(vrd4_sin);
 alm_func_t        G_ENTRY_PT_PTR(vrd4_tan);
 alm_func_t        G_ENTRY_PT_PTR(vrd4_atan);
@@ -354,6 +599,32 @@ alm_func_t        G_ENTRY_PT_PTR(vrd4_sincos);
 alm_func_t        G_ENTRY_PT_PTR(vrd4_sqrt);
 alm_func_t        G_ENTRY_PT_PTR(vrd4_fabs);
 alm_func_t        G_ENTRY_PT_PTR(vrd4_linearfrac);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_frexp);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_ldexp);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_scalbn);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_ilogb);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_logb);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_erfc);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_erfinv);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_erfcinv);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_cdfnorm);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_cdfnorminv);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_lgamma);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_tgamma);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_digamma);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_rsqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_rsqrt_approx);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_invcbrt);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_rhypot);
+alm_func_t        G_ENTRY_PT_PTR(vrz4_cexp);
+alm_func_t        G_ENTRY_PT_PTR(vrz4_clog);
+alm_func_t        G_ENTRY_PT_PTR(vrz4_cpow);
+alm_func_t        G_ENTRY_PT_PTR(vrz4_csin);
+alm_func_t        G_ENTRY_PT_PTR(vrz4_ccos);
+alm_func_t        G_ENTRY_PT_PTR(vrz4_ctan);
+alm_func_t        G_ENTRY_PT_PTR(vrz4_csqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrz4_cabs);
+alm_func_t        G_ENTRY_PT_PTR(vrz4_carg);
 
 //alm_func_t        G_ENTRY_PT_PTR(vrd8_cbrt);
 alm_func_t        G_ENTRY_PT_PTR(vrd8_cos);
@@ -375,6 +646,26 @@ alm_func_t        G_ENTRY_PT_PTR(vrd8_erf);
 alm_func_t        G_ENTRY_PT_PTR(vrd8_sincos);
 alm_func_t        G_ENTRY_PT_PTR(vrd8_linearfrac);
 alm_func_t        G_ENTRY_PT_PTR(vrd8_sqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_frexp);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_ldexp);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_scalbn);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_ilogb);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_logb);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_erfc);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_erfinv);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_erfcinv);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_cdfnorm);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_cdfnorminv);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_lgamma);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_tgamma);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_digamma);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_rsqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_rsqrt_approx);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_invcbrt);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_rhypot);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_cexp);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_clog);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_cpow);
 
 #ifdef __cplusplus
 }
@@ -63,7 +63,15 @@ LIBM_DECL_FN_MAP(powf);
 LIBM_DECL_FN_MAP(pow);
 
 LIBM_DECL_FN_MAP(sqrt);
+LIBM_DECL_FN_MAP(rsqrt);
+LIBM_DECL_FN_MAP(rsqrt_approx);
+LIBM_DECL_FN_MAP(invcbrt);
+LIBM_DECL_FN_MAP(rhypot);
 LIBM_DECL_FN_MAP(sqrtf);
+LIBM_DECL_FN_MAP(rsqrtf);
+LIBM_DECL_FN_MAP(rsqrtf_approx);
+LIBM_DECL_FN_MAP(invcbrtf);
+LIBM_DECL_FN_MAP(rhypotf);
 
 LIBM_DECL_FN_MAP(cbrtf);
 LIBM_DECL_FN_MAP(cbrt);
@@ -231,7 +239,23 @@ LIBM_DECL_FN_MAP(atan2f);
 /* Scalar Error Functions */
 
 LIBM_DECL_FN_MAP(erf);
+LIBM_DECL_FN_MAP(erfc);
+LIBM_DECL_FN_MAP(erfinv);
+LIBM_DECL_FN_MAP(erfcinv);
+LIBM_DECL_FN_MAP(cdfnorm);
+LIBM_DECL_FN_MAP(cdfnorminv);
+LIBM_DECL_FN_MAP(lgamma);
+LIBM_DECL_FN_MAP(tgamma);
+LIBM_DECL_FN_MAP(digamma);
 LIBM_DECL_FN_MAP(erff);
+LIBM_DECL_FN_MAP(erfcf);
+LIBM_DECL_FN_MAP(erfinvf);
+LIBM_DECL_FN_MAP(erfcinvf);
+LIBM_DECL_FN_MAP(cdfnormf);
+LIBM_DECL_FN_MAP(cdfnorminvf);
+LIBM_DECL_FN_MAP(lgammaf);
+LIBM_DECL_FN_MAP(tgammaf);
+LIBM_DECL_FN_MAP(digammaf);
 
 
 /* Scalar Complex Number Variant Functions */
@@ -240,6 +264,73 @@ LIBM_DECL_FN_MAP(cexp);
 LIBM_DECL_FN_MAP(cexpf);
 
 LIBM_DECL_FN_MAP(cpowf);
+LIBM_DECL_FN_MAP(csin);
+LIBM_DECL_FN_MAP(csinf);
+LIBM_DECL_FN_MAP(ccos);
+LIBM_DECL_FN_MAP(ccosf);
+LIBM_DECL_FN_MAP(ctan);
+LIBM_DECL_FN_MAP(ctanf);
+LIBM_DECL_FN_MAP(csqrt);
+LIBM_DECL_FN_MAP(csqrtf);
+LIBM_DECL_FN_MAP(cabs);
+LIBM_DECL_FN_MAP(cabsf);
+LIBM_DECL_FN_MAP(carg);
+LIBM_DECL_FN_MAP(cargf);
+LIBM_DECL_FN_MAP(expf16);
+LIBM_DECL_FN_MAP(logf16);
+LIBM_DECL_FN_MAP(sinf16);
+LIBM_DECL_FN_MAP(cosf16);
+LIBM_DECL_FN_MAP(tanhf16);
+LIBM_DECL_FN_MAP(erff16);
+LIBM_DECL_FN_MAP(sqrtf16);
+LIBM_DECL_FN_MAP(powf16);
+LIBM_DECL_FN_MAP(vrh8_expf16);
+LIBM_DECL_FN_MAP(vrh8_logf16);
+LIBM_DECL_FN_MAP(vrh8_sinf16);
+LIBM_DECL_FN_MAP(vrh8_cosf16);
+LIBM_DECL_FN_MAP(vrh8_tanhf16);
+LIBM_DECL_FN_MAP(vrh8_erff16);
+LIBM_DECL_FN_MAP(vrh8_sqrtf16);
+LIBM_DECL_FN_MAP(vrh8_powf16);
+LIBM_DECL_FN_MAP(vrh16_expf16);
+LIBM_DECL_FN_MAP(vrh16_logf16);
+LIBM_DECL_FN_MAP(vrh16_sinf16);
+LIBM_DECL_FN_MAP(vrh16_cosf16);
+LIBM_DECL_FN_MAP(vrh16_tanhf16);
+LIBM_DECL_FN_MAP(vrh16_erff16);
+LIBM_DECL_FN_MAP(vrh16_sqrtf16);
+LIBM_DECL_FN_MAP(vrh16_powf16);
+LIBM_DECL_FN_MAP(vrh32_expf16);
+LIBM_DECL_FN_MAP(vrh32_logf16);
+LIBM_DECL_FN_MAP(vrh32_sinf16);
+LIBM_DECL_FN_MAP(vrh32_cosf16);
+LIBM_DECL_FN_MAP(vrh32_tanhf16);
+LIBM_DECL_FN_MAP(vrh32_erff16);
+LIBM_DECL_FN_MAP(vrh32_sqrtf16);
+LIBM_DECL_FN_MAP(vrh32_powf16);
+LIBM_DECL_FN_MAP(vrha_expf16);
+LIBM_DECL_FN_MAP(vrha_logf16);
+LIBM_DECL_FN_MAP(vrha_sinf16);
+LIBM_DECL_FN_MAP(vrha_cosf16);
+LIBM_DECL_FN_MAP(vrha_tanhf16);
+LIBM_DECL_FN_MAP(vrha_erff16);
+LIBM_DECL_FN_MAP(vrha_sqrtf16);
+LIBM_DECL_FN_MAP(vrha_powf16);
+LIBM_DECL_FN_MAP(vrba_expbf16);
+LIBM_DECL_FN_MAP(vrba_expbf16_f32);
+LIBM_DECL_FN_MAP(vrba_logbf16);
+LIBM_DECL_FN_MAP(vrba_logbf16_f32);
+LIBM_DECL_FN_MAP(vrba_tanhbf16);
+LIBM_DECL_FN_MAP(vrba_tanhbf16_f32);
+LIBM_DECL_FN_MAP(vrba_erfbf16);
+LIBM_DECL_FN_MAP(vrba_erfbf16_f32);
+LIBM_DECL_FN_MAP(vrba_sigmoidbf16);
+LIBM_DECL_FN_MAP(vrba_sigmoidbf16_f32);
+LIBM_DECL_FN_MAP(vrba_silubf16);
+LIBM_DECL_FN_MAP(vrba_softplusbf16);
+LIBM_DECL_FN_MAP(vrba_gelubf16);
+LIBM_DECL_FN_MAP(vrba_gelu_tanhbf16);
+LIBM_DECL_FN_MAP(vrba_softmaxbf16);
 LIBM_DECL_FN_MAP(cpow);
 
 LIBM_DECL_FN_MAP(clog);
@@ -279,6 +370,53 @@ LIBM_DECL_FN_MAP(vrsa_mulfi);
 LIBM_DECL_FN_MAP(vrsa_divfi);
 LIBM_DECL_FN_MAP(vrsa_fmaxfi);
 LIBM_DECL_FN_MAP(vrsa_fminfi);
+LIBM_DECL_FN_MAP(vrsa_frexpf);
+LIBM_DECL_FN_MAP(vrsa_ldexpf);
+LIBM_DECL_FN_MAP(vrsa_scalbnf);
+LIBM_DECL_FN_MAP(vrsa_ilogbf);
+LIBM_DECL_FN_MAP(vrsa_logbf);
+LIBM_DECL_FN_MAP(vrsa_expf_affine);
+LIBM_DECL_FN_MAP(vrsa_logf_affine);
+LIBM_DECL_FN_MAP(vrsa_powf_affine);
+LIBM_DECL_FN_MAP(vrsa_sinf_affine);
+LIBM_DECL_FN_MAP(vrsa_cosf_affine);
+LIBM_DECL_FN_MAP(vrsa_tanhf_affine);
+LIBM_DECL_FN_MAP(vrsa_sumexpf);
+LIBM_DECL_FN_MAP(vrsa_logsumexpf);
+LIBM_DECL_FN_MAP(vrsa_sumlogf);
+LIBM_DECL_FN_MAP(vrsa_sigmoidf);
+LIBM_DECL_FN_MAP(vrsa_siluf);
+LIBM_DECL_FN_MAP(vrsa_softplusf);
+LIBM_DECL_FN_MAP(vrsa_geluf);
+LIBM_DECL_FN_MAP(vrsa_gelu_tanhf);
+LIBM_DECL_FN_MAP(vrsa_softmaxf);
+LIBM_DECL_FN_MAP(vrsa_cisf);
+LIBM_DECL_FN_MAP(vrsa_polarf);
+LIBM_DECL_FN_MAP(vrsa_boxmullerf);
+LIBM_DECL_FN_MAP(vrsa_erfcf);
+LIBM_DECL_FN_MAP(vrsa_erfinvf);
+LIBM_DECL_FN_MAP(vrsa_erfcinvf);
+LIBM_DECL_FN_MAP(vrsa_cdfnormf);
+LIBM_DECL_FN_MAP(vrsa_cdfnorminvf);
+LIBM_DECL_FN_MAP(vrsa_lgammaf);
+LIBM_DECL_FN_MAP(vrsa_tgammaf);
+LIBM_DECL_FN_MAP(vrsa_digammaf);
+LIBM_DECL_FN_MAP(vrsa_rsqrtf);
+LIBM_DECL_FN_MAP(vrsa_rsqrtf_approx);
+LIBM_DECL_FN_MAP(vrsa_invcbrtf);
+LIBM_DECL_FN_MAP(vrsa_rhypotf);
+LIBM_DECL_FN_MAP(vrca_cexpf);
+LIBM_DECL_FN_MAP(vrca_clogf);
+LIBM_DECL_FN_MAP(vrca_cpowf);
+LIBM_DECL_FN_MAP(vrca_csinf);
+LIBM_DECL_FN_MAP(vrca_ccosf);
+LIBM_DECL_FN_MAP(vrca_ctanf);
+LIBM_DECL_FN_MAP(vrca_csqrtf);
+LIBM_DECL_FN_MAP(vrca_cabsf);
+LIBM_DECL_FN_MAP(vrca_cargf);
+LIBM_DECL_FN_MAP(vrca_cexpf_soa);
+LIBM_DECL_FN_MAP(vrca_clogf_soa);
+LIBM_DECL_FN_MAP(vrca_cpowf_soa);
 
 LIBM_DECL_FN_MAP(vrda_pow);
 LIBM_DECL_FN_MAP(vrda_cbrt);
@@ -311,6 +449,48 @@ LIBM_DECL_FN_MAP(vrda_divi);
 LIBM_DECL_FN_MAP(vrda_fmaxi);
 LIBM_DECL_FN_MAP(vrda_fmini);
 LIBM_DECL_FN_MAP(vrda_powx);
+LIBM_DECL_FN_MAP(vrda_pown);
+LIBM_DECL_FN_MAP(vrda_rootn);
+LIBM_DECL_FN_MAP(vrda_frexp);
+LIBM_DECL_FN_MAP(vrda_ldexp);
+LIBM_DECL_FN_MAP(vrda_scalbn);
+LIBM_DECL_FN_MAP(vrda_ilogb);
+LIBM_DECL_FN_MAP(vrda_logb);
+LIBM_DECL_FN_MAP(vrda_exp_affine);
+LIBM_DECL_FN_MAP(vrda_log_affine);
+LIBM_DECL_FN_MAP(vrda_pow_affine);
+LIBM_DECL_FN_MAP(vrda_sin_affine);
+LIBM_DECL_FN_MAP(vrda_cos_affine);
+LIBM_DECL_FN_MAP(vrda_sumexp);
+LIBM_DECL_FN_MAP(vrda_logsumexp);
+LIBM_DECL_FN_MAP(vrda_sumlog);
+LIBM_DECL_FN_MAP(vrda_cis);
+LIBM_DECL_FN_MAP(vrda_polar);
+LIBM_DECL_FN_MAP(vrda_boxmuller);
+LIBM_DECL_FN_MAP(vrda_cdfnorminv);
+LIBM_DECL_FN_MAP(vrda_erfc);
+LIBM_DECL_FN_MAP(vrda_erfinv);
+LIBM_DECL_FN_MAP(vrda_erfcinv);
+LIBM_DECL_FN_MAP(vrda_cdfnorm);
+LIBM_DECL_FN_MAP(vrda_lgamma);
+LIBM_DECL_FN_MAP(vrda_tgamma);
+LIBM_DECL_FN_MAP(vrda_digamma);
+LIBM_DECL_FN_MAP(vrda_rsqrt);
+LIBM_DECL_FN_MAP(vrda_rsqrt_approx);
+LIBM_DECL_FN_MAP(vrda_invcbrt);
+LIBM_DECL_FN_MAP(vrda_rhypot);
+LIBM_DECL_FN_MAP(vrza_cexp);
+LIBM_DECL_FN_MAP(vrza_clog);
+LIBM_DECL_FN_MAP(vrza_cpow);
+LIBM_DECL_FN_MAP(vrza_csin);
+LIBM_DECL_FN_MAP(vrza_ccos);
+LIBM_DECL_FN_MAP(vrza_ctan);
+LIBM_DECL_FN_MAP(vrza_csqrt);
+LIBM_DECL_FN_MAP(vrza_cabs);
+LIBM_DECL_FN_MAP(vrza_carg);
+LIBM_DECL_FN_MAP(vrza_cexp_soa);
+LIBM_DECL_FN_MAP(vrza_clog_soa);
+LIBM_DECL_FN_MAP(vrza_cpow_soa);
 
 /* Vector Functions */
 
@@ -334,9 +514,19 @@ LIBM_DECL_FN_MAP(vrd2_erf);
 LIBM_DECL_FN_MAP(vrd2_sqrt);
 LIBM_DECL_FN_MAP(vrd2_fabs);
 LIBM_DECL_FN_MAP(vrd2_linearfrac);
+LIBM_DECL_FN_MAP(vrd2_erfc);
+LIBM_DECL_FN_MAP(vrd2_erfinv);
+LIBM_DECL_FN_MAP(vrd2_erfcinv);
+LIBM_DECL_FN_MAP(vrd2_cdfnorm);
+LIBM_DECL_FN_MAP(vrd2_cdfnorminv);
+LIBM_DECL_FN_MAP(vrd2_rsqrt);
+LIBM_DECL_FN_MAP(vrd2_rsqrt_approx);
+LIBM_DECL_FN_MAP(vrd2_invcbrt);
+LIBM_DECL_FN_MAP(vrd2_rhypot);
 
 LIBM_DECL_FN_MAP(vrd4_pow);
 LIBM_DECL_FN_MAP(vrd4_powx);
+LIBM_DECL_FN_MAP(vrd4_pown);
 LIBM_DECL_FN_MAP(vrd4_exp);
 LIBM_DECL_FN_MAP(vrd4_exp2);
 LIBM_DECL_FN_MAP(vrd4_log);
@@ -350,6 +540,32 @@ LIBM_DECL_FN_MAP(vrd4_erf);
 LIBM_DECL_FN_MAP(vrd4_sqrt);
 LIBM_DECL_FN_MAP(vrd4_fabs);
 LIBM_DECL_FN_MAP(vrd4_linearfrac);
+LIBM_DECL_FN_MAP(vrd4_frexp);
+LIBM_DECL_FN_MAP(vrd4_ldexp);
+LIBM_DECL_FN_MAP(vrd4_scalbn);
+LIBM_DECL_FN_MAP(vrd4_ilogb);
+LIBM_DECL_FN_MAP(vrd4_logb);
+LIBM_DECL_FN_MAP(vrd4_erfc);
+LIBM_DECL_FN_MAP(vrd4_erfinv);
+LIBM_DECL_FN_MAP(vrd4_erfcinv);
+LIBM_DECL_FN_MAP(vrd4_cdfnorm);
+LIBM_DECL_FN_MAP(vrd4_cdfnorminv);
+LIBM_DECL_FN_MAP(vrd4_lgamma);
+LIBM_DECL_FN_MAP(vrd4_tgamma);
+LIBM_DECL_FN_MAP(vrd4_digamma);
+LIBM_DECL_FN_MAP(vrd4_rsqrt);
+LIBM_DECL_FN_MAP(vrd4_rsqrt_approx);
+LIBM_DECL_FN_MAP(vrd4_invcbrt);
+LIBM_DECL_FN_MAP(vrd4_rhypot);
+LIBM_DECL_FN_MAP(vrz4_cexp);
+LIBM_DECL_FN_MAP(vrz4_clog);
+LIBM_DECL_FN_MAP(vrz4_cpow);
+LIBM_DECL_FN_MAP(vrz4_csin);
+LIBM_DECL_FN_MAP(vrz4_ccos);
+LIBM_DECL_FN_MAP(vrz4_ctan);
+LIBM_DECL_FN_MAP(vrz4_csqrt);
+LIBM_DECL_FN_MAP(vrz4_cabs);
+LIBM_DECL_FN_MAP(vrz4_carg);
 
 LIBM_DECL_FN_MAP(vrd8_pow);
 LIBM_DECL_FN_MAP(vrd8_powx);
@@ -366,6 +582,26 @@ LIBM_DECL_FN_MAP(vrd8_sincos);
 LIBM_DECL_FN_MAP(vrd8_erf);
 LIBM_DECL_FN_MAP(vrd8_linearfrac);
 LIBM_DECL_FN_MAP(vrd8_sqrt);
+LIBM_DECL_FN_MAP(vrd8_frexp);
+LIBM_DECL_FN_MAP(vrd8_ldexp);
+LIBM_DECL_FN_MAP(vrd8_scalbn);
+LIBM_DECL_FN_MAP(vrd8_ilogb);
+LIBM_DECL_FN_MAP(vrd8_logb);
+LIBM_DECL_FN_MAP(vrd8_erfc);
+LIBM_DECL_FN_MAP(vrd8_erfinv);
+LIBM_DECL_FN_MAP(vrd8_erfcinv);
+LIBM_DECL_FN_MAP(vrd8_cdfnorm);
+LIBM_DECL_FN_MAP(vrd8_cdfnorminv);
+LIBM_DECL_FN_MAP(vrd8_lgamma);
+LIBM_DECL_FN_MAP(vrd8_tgamma);
+LIBM_DECL_FN_MAP(vrd8_digamma);
+LIBM_DECL_FN_MAP(vrd8_rsqrt);
+LIBM_DECL_FN_MAP(vrd8_rsqrt_approx);
+LIBM_DECL_FN_MAP(vrd8_invcbrt);
+LIBM_DECL_FN_MAP(vrd8_rhypot);
+LIBM_DECL_FN_MAP(vrz8_cexp);
+LIBM_DECL_FN_MAP(vrz8_clog);
+LIBM_DECL_FN_MAP(vrz8_cpow);
 
 LIBM_DECL_FN_MAP(vrs4_powf);
 LIBM_DECL_FN_MAP(vrs4_powxf);
@@ -391,6 +627,15 @@ LIBM_DECL_FN_MAP(vrs4_fabsf);
 LIBM_DECL_FN_MAP(vrs4_sqrtf);
 LIBM_DECL_FN_MAP(vrs4_linearfracf);
 LIBM_DECL_FN_MAP(vrs4_sincosf);
+LIBM_DECL_FN_MAP(vrs4_erfcf);
+LIBM_DECL_FN_MAP(vrs4_erfinvf);
+LIBM_DECL_FN_MAP(vrs4_erfcinvf);
+LIBM_DECL_FN_MAP(vrs4_cdfnormf);
+LIBM_DECL_FN_MAP(vrs4_cdfnorminvf);
+LIBM_DECL_FN_MAP(vrs4_rsqrtf);
+LIBM_DECL_FN_MAP(vrs4_rsqrtf_approx);
+LIBM_DECL_FN_MAP(vrs4_invcbrtf);
+LIBM_DECL_FN_MAP(vrs4_rhypotf);
 
 LIBM_DECL_FN_MAP(vrs8_powf);
 LIBM_DECL_FN_MAP(vrs8_powxf);
@@ -412,6 +657,32 @@ LIBM_DECL_FN_MAP(vrs8_fabsf);
 LIBM_DECL_FN_MAP(vrs8_sqrtf);
 LIBM_DECL_FN_MAP(vrs8_linearfracf);
 LIBM_DECL_FN_MAP(vrs8_sincosf);
+LIBM_DECL_FN_MAP(vrs8_frexpf);
+LIBM_DECL_FN_MAP(vrs8_ldexpf);
+LIBM_DECL_FN_MAP(vrs8_scalbnf);
+LIBM_DECL_FN_MAP(vrs8_ilogbf);
+LIBM_DECL_FN_MAP(vrs8_logbf);
+LIBM_DECL_FN_MAP(vrs8_erfcf);
+LIBM_DECL_FN_MAP(vrs8_erfinvf);
+LIBM_DECL_FN_MAP(vrs8_erfcinvf);
+LIBM_DECL_FN_MAP(vrs8_cdfnormf);
+LIBM_DECL_FN_MAP(vrs8_cdfnorminvf);
+LIBM_DECL_FN_MAP(vrs8_lgammaf);
+LIBM_DECL_FN_MAP(vrs8_tgammaf);
+LIBM_DECL_FN_MAP(vrs8_digammaf);
+LIBM_DECL_FN_MAP(vrs8_rsqrtf);
+LIBM_DECL_FN_MAP(vrs8_rsqrtf_approx);
+LIBM_DECL_FN_MAP(vrs8_invcbrtf);
+LIBM_DECL_FN_MAP(vrs8_rhypotf);
+LIBM_DECL_FN_MAP(vrc8_cexpf);
+LIBM_DECL_FN_MAP(vrc8_clogf);
+LIBM_DECL_FN_MAP(vrc8_cpowf);
+LIBM_DECL_FN_MAP(vrc8_csinf);
+LIBM_DECL_FN_MAP(vrc8_ccosf);
+LIBM_DECL_FN_MAP(vrc8_ctanf);
+LIBM_DECL_FN_MAP(vrc8_csqrtf);
+LIBM_DECL_FN_MAP(vrc8_cabsf);
+LIBM_DECL_FN_MAP(vrc8_cargf);
 
 LIBM_DECL_FN_MAP(vrs16_powf);
 LIBM_DECL_FN_MAP(vrs16_powxf);
@@ -431,6 +702,26 @@ LIBM_DECL_FN_MAP(vrs16_erff);
 LIBM_DECL_FN_MAP(vrs16_sqrtf);
 LIBM_DECL_FN_MAP(vrs16_linearfracf);
 LIBM_DECL_FN_MAP(vrs16_sincosf);
+LIBM_DECL_FN_MAP(vrs16_frexpf);
+LIBM_DECL_FN_MAP(vrs16_ldexpf);
+LIBM_DECL_FN_MAP(vrs16_scalbnf);
+LIBM_DECL_FN_MAP(vrs16_ilogbf);
+LIBM_DECL_FN_MAP(vrs16_logbf);
+LIBM_DECL_FN_MAP(vrs16_erfcf);
+LIBM_DECL_FN_MAP(vrs16_erfinvf);
+LIBM_DECL_FN_MAP(vrs16_erfcinvf);
+LIBM_DECL_FN_MAP(vrs16_cdfnormf);
+LIBM_DECL_FN_MAP(vrs16_cdfnorminvf);
+LIBM_DECL_FN_MAP(vrs16_lgammaf);
+LIBM_DECL_FN_MAP(vrs16_tgammaf);
+LIBM_DECL_FN_MAP(vrs16_digammaf);
+LIBM_DECL_FN_MAP(vrs16_rsqrtf);
+LIBM_DECL_FN_MAP(vrs16_rsqrtf_approx);
+LIBM_DECL_FN_MAP(vrs16_invcbrtf);
+LIBM_DECL_FN_MAP(vrs16_rhypotf);
+LIBM_DECL_FN_MAP(vrc16_cexpf);
+LIBM_DECL_FN_MAP(vrc16_clogf);
+LIBM_DECL_FN_MAP(vrc16_cpowf);
 
 /*
  * WEAK_LIBM_ALIAS is used to map "amd_<func_name>" to "<func_name>".
@@ -458,7 +749,15 @@ WEAK_LIBM_ALIAS(fmin, FN_PROTOTYPE(fmin));
 WEAK_LIBM_ALIAS(powf, FN_PROTOTYPE(powf));
 WEAK_LIBM_ALIAS(pow, FN_PROTOTYPE(pow));
 WEAK_LIBM_ALIAS(sqrtf, FN_PROTOTYPE(sqrtf));
+WEAK_LIBM_ALIAS(rsqrtf, FN_PROTOTYPE(rsqrtf));
+WEAK_LIBM_ALIAS(rsqrtf_approx, FN_PROTOTYPE(rsqrtf_approx));
+WEAK_LIBM_ALIAS(invcbrtf, FN_PROTOTYPE(invcbrtf));
+WEAK_LIBM_ALIAS(rhypotf, FN_PROTOTYPE(rhypotf));
 WEAK_LIBM_ALIAS(sqrt, FN_PROTOTYPE(sqrt));
+WEAK_LIBM_ALIAS(rsqrt, FN_PROTOTYPE(rsqrt));
+WEAK_LIBM_ALIAS(rsqrt_approx, FN_PROTOTYPE(rsqrt_approx));
+WEAK_LIBM_ALIAS(invcbrt, FN_PROTOTYPE(invcbrt));
+WEAK_LIBM_ALIAS(rhypot, FN_PROTOTYPE(rhypot));
 WEAK_LIBM_ALIAS(cbrtf, FN_PROTOTYPE(cbrtf));
 WEAK_LIBM_ALIAS(cbrt, FN_PROTOTYPE(cbrt));
 
@@ -598,7 +897,23 @@ WEAK_LIBM_ALIAS(atan2, FN_PROTOTYPE(atan2));
 /* Scalar Error Functions */
 
 WEAK_LIBM_ALIAS(erff, FN_PROTOTYPE(erff));
+WEAK_LIBM_ALIAS(erfcf, FN_PROTOTYPE(erfcf));
+WEAK_LIBM_ALIAS(erfinvf, FN_PROTOTYPE(erfinvf));
+WEAK_LIBM_ALIAS(erfcinvf, FN_PROTOTYPE(erfcinvf));
+WEAK_LIBM_ALIAS(cdfnormf, FN_PROTOTYPE(cdfnormf));
+WEAK_LIBM_ALIAS(cdfnorminvf, FN_PROTOTYPE(cdfnorminvf));
+WEAK_LIBM_ALIAS(lgammaf, FN_PROTOTYPE(lgammaf));
+WEAK_LIBM_ALIAS(tgammaf, FN_PROTOTYPE(tgammaf));
+WEAK_LIBM_ALIAS(digammaf, FN_PROTOTYPE(digammaf));
 WEAK_LIBM_ALIAS(erf, FN_PROTOTYPE(erf));
+WEAK_LIBM_ALIAS(erfc, FN_PROTOTYPE(erfc));
+WEAK_LIBM_ALIAS(erfinv, FN_PROTOTYPE(erfinv));
+WEAK_LIBM_ALIAS(erfcinv, FN_PROTOTYPE(erfcinv));
+WEAK_LIBM_ALIAS(cdfnorm, FN_PROTOTYPE(cdfnorm));
+WEAK_LIBM_ALIAS(cdfnorminv, FN_PROTOTYPE(cdfnorminv));
+WEAK_LIBM_ALIAS(lgamma, FN_PROTOTYPE(lgamma));
+WEAK_LIBM_ALIAS(tgamma, FN_PROTOTYPE(tgamma));
+WEAK_LIBM_ALIAS(digamma, FN_PROTOTYPE(digamma));
 
 
 /* Scalar Complex Number Variant Functions */
@@ -606,6 +921,73 @@ WEAK_LIBM_ALIAS(erf, FN_PROTOTYPE(erf));
 WEAK_LIBM_ALIAS(cexpf, FN_PROTOTYPE(cexpf));
 WEAK_LIBM_ALIAS(cexp, FN_PROTOTYPE(cexp));
 WEAK_LIBM_ALIAS(cpowf, FN_PROTOTYPE(cpowf));
+WEAK_LIBM_ALIAS(csin, FN_PROTOTYPE(csin));
+WEAK_LIBM_ALIAS(csinf, FN_PROTOTYPE(csinf));
+WEAK_LIBM_ALIAS(ccos, FN_PROTOTYPE(ccos));
+WEAK_LIBM_ALIAS(ccosf, FN_PROTOTYPE(ccosf));
+WEAK_LIBM_ALIAS(ctan, FN_PROTOTYPE(ctan));
+WEAK_LIBM_ALIAS(ctanf, FN_PROTOTYPE(ctanf));
+WEAK_LIBM_ALIAS(csqrt, FN_PROTOTYPE(csqrt));
+WEAK_LIBM_ALIAS(csqrtf, FN_PROTOTYPE(csqrtf));
+WEAK_LIBM_ALIAS(cabs, FN_PROTOTYPE(cabs));
+WEAK_LIBM_ALIAS(cabsf, FN_PROTOTYPE(cabsf));
+WEAK_LIBM_ALIAS(carg, FN_PROTOTYPE(carg));
+WEAK_LIBM_ALIAS(cargf, FN_PROTOTYPE(cargf));
+WEAK_LIBM_ALIAS(expf16, FN_PROTOTYPE(expf16));
+WEAK_LIBM_ALIAS(logf16, FN_PROTOTYPE(logf16));
+WEAK_LIBM_ALIAS(sinf16, FN_PROTOTYPE(sinf16));
+WEAK_LIBM_ALIAS(cosf16, FN_PROTOTYPE(cosf16));
+WEAK_LIBM_ALIAS(tanhf16, FN_PROTOTYPE(tanhf16));
+WEAK_LIBM_ALIAS(erff16, FN_PROTOTYPE(erff16));
+WEAK_LIBM_ALIAS(sqrtf16, FN_PROTOTYPE(sqrtf16));
+WEAK_LIBM_ALIAS(powf16, FN_PROTOTYPE(powf16));
+WEAK_LIBM_ALIAS(vrh8_expf16, FN_PROTOTYPE(vrh8_expf16));
+WEAK_LIBM_ALIAS(vrh8_logf16, FN_PROTOTYPE(vrh8_logf16));
+WEAK_LIBM_ALIAS(vrh8_sinf16, FN_PROTOTYPE(vrh8_sinf16));
+WEAK_LIBM_ALIAS(vrh8_cosf16, FN_PROTOTYPE(vrh8_cosf16));
+WEAK_LIBM_ALIAS(vrh8_tanhf16, FN_PROTOTYPE(vrh8_tanhf16));
+WEAK_LIBM_ALIAS(vrh8_erff16, FN_PROTOTYPE(vrh8_erff16));
+WEAK_LIBM_ALIAS(vrh8_sqrtf16, FN_PROTOTYPE(vrh8_sqrtf16));
+WEAK_LIBM_ALIAS(vrh8_powf16, FN_PROTOTYPE(vrh8_powf16));
+WEAK_LIBM_ALIAS(vrh16_expf16, FN_PROTOTYPE(vrh16_expf16));
+WEAK_LIBM_ALIAS(vrh16_logf16, FN_PROTOTYPE(vrh16_logf16));
+WEAK_LIBM_ALIAS(vrh16_sinf16, FN_PROTOTYPE(vrh16_sinf16));
+WEAK_LIBM_ALIAS(vrh16_cosf16, FN_PROTOTYPE(vrh16_cosf16));
+WEAK_LIBM_ALIAS(vrh16_tanhf16, FN_PROTOTYPE(vrh16_tanhf16));
+WEAK_LIBM_ALIAS(vrh16_erff16, FN_PROTOTYPE(vrh16_erff16));
+WEAK_LIBM_ALIAS(vrh16_sqrtf16, FN_PROTOTYPE(vrh16_sqrtf16));
+WEAK_LIBM_ALIAS(vrh16_powf16, FN_PROTOTYPE(vrh16_powf16));
+WEAK_LIBM_ALIAS(vrh32_expf16, FN_PROTOTYPE(vrh32_expf16));
+WEAK_LIBM_ALIAS(vrh32_logf16, FN_PROTOTYPE(vrh32_logf16));
+WEAK_LIBM_ALIAS(vrh32_sinf16, FN_PROTOTYPE(vrh32_sinf16));
+WEAK_LIBM_ALIAS(vrh32_cosf16, FN_PROTOTYPE(vrh32_cosf16));
+WEAK_LIBM_ALIAS(vrh32_tanhf16, FN_PROTOTYPE(vrh32_tanhf16));
+WEAK_LIBM_ALIAS(vrh32_erff16, FN_PROTOTYPE(vrh32_erff16));
+WEAK_LIBM_ALIAS(vrh32_sqrtf16, FN_PROTOTYPE(vrh32_sqrtf16));
+WEAK_LIBM_ALIAS(vrh32_powf16, FN_PROTOTYPE(vrh32_powf16));
+WEAK_LIBM_ALIAS(vrha_expf16, FN_PROTOTYPE(vrha_expf16));
+WEAK_LIBM_ALIAS(vrha_logf16, FN_PROTOTYPE(vrha_logf16));
+WEAK_LIBM_ALIAS(vrha_sinf16, FN_PROTOTYPE(vrha_sinf16));
+WEAK_LIBM_ALIAS(vrha_cosf16, FN_PROTOTYPE(vrha_cosf16));
+WEAK_LIBM_ALIAS(vrha_tanhf16, FN_PROTOTYPE(vrha_tanhf16));
+WEAK_LIBM_ALIAS(vrha_erff16, FN_PROTOTYPE(vrha_erff16));
+WEAK_LIBM_ALIAS(vrha_sqrtf16, FN_PROTOTYPE(vrha_sqrtf16));
+WEAK_LIBM_ALIAS(vrha_powf16, FN_PROTOTYPE(vrha_powf16));
+WEAK_LIBM_ALIAS(vrba_expbf16, FN_PROTOTYPE(vrba_expbf16));
+WEAK_LIBM_ALIAS(vrba_expbf16_f32, FN_PROTOTYPE(vrba_expbf16_f32));
+WEAK_LIBM_ALIAS(vrba_logbf16, FN_PROTOTYPE(vrba_logbf16));
+WEAK_LIBM_ALIAS(vrba_logbf16_f32, FN_PROTOTYPE(vrba_logbf16_f32));
+WEAK_LIBM_ALIAS(vrba_tanhbf16, FN_PROTOTYPE(vrba_tanhbf16));
+WEAK_LIBM_ALIAS(vrba_tanhbf16_f32, FN_PROTOTYPE(vrba_tanhbf16_f32));
+WEAK_LIBM_ALIAS(vrba_erfbf16, FN_PROTOTYPE(vrba_erfbf16));
+WEAK_LIBM_ALIAS(vrba_erfbf16_f32, FN_PROTOTYPE(vrba_erfbf16_f32));
+WEAK_LIBM_ALIAS(vrba_sigmoidbf16, FN_PROTOTYPE(vrba_sigmoidbf16));
+WEAK_LIBM_ALIAS(vrba_sigmoidbf16_f32, FN_PROTOTYPE(vrba_sigmoidbf16_f32));
+WEAK_LIBM_ALIAS(vrba_silubf16, FN_PROTOTYPE(vrba_silubf16));
+WEAK_LIBM_ALIAS(vrba_softplusbf16, FN_PROTOTYPE(vrba_softplusbf16));
+WEAK_LIBM_ALIAS(vrba_gelubf16, FN_PROTOTYPE(vrba_gelubf16));
+WEAK_LIBM_ALIAS(vrba_gelu_tanhbf16, FN_PROTOTYPE(vrba_gelu_tanhbf16));
+WEAK_LIBM_ALIAS(vrba_softmaxbf16, FN_PROTOTYPE(vrba_softmaxbf16));
 WEAK_LIBM_ALIAS(cpow, FN_PROTOTYPE(cpow));
 WEAK_LIBM_ALIAS(clogf, FN_PROTOTYPE(clogf));
 WEAK_LIBM_ALIAS(clog, FN_PROTOTYPE(clog));
@@ -645,6 +1027,53 @@ WEAK_LIBM_ALIAS(vrsa_fmaxfi, FN_PROTOTYPE(vrsa_fmaxfi));
 WEAK_LIBM_ALIAS(vrsa_fminfi, FN_PROTOTYPE(vrsa_fminfi));
 
 WEAK_LIBM_ALIAS(vrsa_powxf, FN_PROTOTYPE(vrsa_powxf));
+WEAK_LIBM_ALIAS(vrsa_frexpf, FN_PROTOTYPE(vrsa_frexpf));
+WEAK_LIBM_ALIAS(vrsa_ldexpf, FN_PROTOTYPE(vrsa_ldexpf));
+WEAK_LIBM_ALIAS(vrsa_scalbnf, FN_PROTOTYPE(vrsa_scalbnf));
+WEAK_LIBM_ALIAS(vrsa_ilogbf, FN_PROTOTYPE(vrsa_ilogbf));
+WEAK_LIBM_ALIAS(vrsa_logbf, FN_PROTOTYPE(vrsa_logbf));
+WEAK_LIBM_ALIAS(vrsa_expf_affine, FN_PROTOTYPE(vrsa_expf_affine));
+WEAK_LIBM_ALIAS(vrsa_logf_affine, FN_PROTOTYPE(vrsa_logf_affine));
+WEAK_LIBM_ALIAS(vrsa_powf_affine, FN_PROTOTYPE(vrsa_powf_affine));
+WEAK_LIBM_ALIAS(vrsa_sinf_affine, FN_PROTOTYPE(vrsa_sinf_affine));
+WEAK_LIBM_ALIAS(vrsa_cosf_affine, FN_PROTOTYPE(vrsa_cosf_affine));
+WEAK_LIBM_ALIAS(vrsa_tanhf_affine, FN_PROTOTYPE(vrsa_tanhf_affine));
+WEAK_LIBM_ALIAS(vrsa_sumexpf, FN_PROTOTYPE(vrsa_sumexpf));
+WEAK_LIBM_ALIAS(vrsa_logsumexpf, FN_PROTOTYPE(vrsa_logsumexpf));
+WEAK_LIBM_ALIAS(vrsa_sumlogf, FN_PROTOTYPE(vrsa_sumlogf));
+WEAK_LIBM_ALIAS(vrsa_sigmoidf, FN_PROTOTYPE(vrsa_sigmoidf));
+WEAK_LIBM_ALIAS(vrsa_siluf, FN_PROTOTYPE(vrsa_siluf));
+WEAK_LIBM_ALIAS(vrsa_softplusf, FN_PROTOTYPE(vrsa_softplusf));
+WEAK_LIBM_ALIAS(vrsa_geluf, FN_PROTOTYPE(vrsa_geluf));
+WEAK_LIBM_ALIAS(vrsa_gelu_tanhf, FN_PROTOTYPE(vrsa_gelu_tanhf));
+WEAK_LIBM_ALIAS(vrsa_softmaxf, FN_PROTOTYPE(vrsa_softmaxf));
+WEAK_LIBM_ALIAS(vrsa_cisf, FN_PROTOTYPE(vrsa_cisf));
+WEAK_LIBM_ALIAS(vrsa_polarf, FN_PROTOTYPE(vrsa_polarf));
+WEAK_LIBM_ALIAS(vrsa_boxmullerf, FN_PROTOTYPE(vrsa_boxmullerf));
+WEAK_LIBM_ALIAS(vrsa_erfcf, FN_PROTOTYPE(vrsa_erfcf));
+WEAK_LIBM_ALIAS(vrsa_erfinvf, FN_PROTOTYPE(vrsa_erfinvf));
+WEAK_LIBM_ALIAS(vrsa_erfcinvf, FN_PROTOTYPE(vrsa_erfcinvf));
+WEAK_LIBM_ALIAS(vrsa_cdfnormf, FN_PROTOTYPE(vrsa_cdfnormf));
+WEAK_LIBM_ALIAS(vrsa_cdfnorminvf, FN_PROTOTYPE(vrsa_cdfnorminvf));
+WEAK_LIBM_ALIAS(vrsa_lgammaf, FN_PROTOTYPE(vrsa_lgammaf));
+WEAK_LIBM_ALIAS(vrsa_tgammaf, FN_PROTOTYPE(vrsa_tgammaf));
+WEAK_LIBM_ALIAS(vrsa_digammaf, FN_PROTOTYPE(vrsa_digammaf));
+WEAK_LIBM_ALIAS(vrsa_rsqrtf, FN_PROTOTYPE(vrsa_rsqrtf));
+WEAK_LIBM_ALIAS(vrsa_rsqrtf_approx, FN_PROTOTYPE(vrsa_rsqrtf_approx));
+WEAK_LIBM_ALIAS(vrsa_invcbrtf, FN_PROTOTYPE(vrsa_invcbrtf));
+WEAK_LIBM_ALIAS(vrsa_rhypotf, FN_PROTOTYPE(vrsa_rhypotf));
+WEAK_LIBM_ALIAS(vrca_cexpf, FN_PROTOTYPE(vrca_cexpf));
+WEAK_LIBM_ALIAS(vrca_clogf, FN_PROTOTYPE(vrca_clogf));
+WEAK_LIBM_ALIAS(vrca_cpowf, FN_PROTOTYPE(vrca_cpowf));
+WEAK_LIBM_ALIAS(vrca_csinf, FN_PROTOTYPE(vrca_csinf));
+WEAK_LIBM_ALIAS(vrca_ccosf, FN_PROTOTYPE(vrca_ccosf));
+WEAK_LIBM_ALIAS(vrca_ctanf, FN_PROTOTYPE(vrca_ctanf));
+WEAK_LIBM_ALIAS(vrca_csqrtf, FN_PROTOTYPE(vrca_csqrtf));
+WEAK_LIBM_ALIAS(vrca_cabsf, FN_PROTOTYPE(vrca_cabsf));
+WEAK_LIBM_ALIAS(vrca_cargf, FN_PROTOTYPE(vrca_cargf));
+WEAK_LIBM_ALIAS(vrca_cexpf_soa, FN_PROTOTYPE(vrca_cexpf_soa));
+WEAK_LIBM_ALIAS(vrca_clogf_soa, FN_PROTOTYPE(vrca_clogf_soa));
+WEAK_LIBM_ALIAS(vrca_cpowf_soa, FN_PROTOTYPE(vrca_cpowf_soa));
 
 WEAK_LIBM_ALIAS(vrda_pow, FN_PROTOTYPE(vrda_pow));
 WEAK_LIBM_ALIAS(vrda_cbrt, FN_PROTOTYPE(vrda_cbrt));
@@ -678,6 +1107,48 @@ WEAK_LIBM_ALIAS(vrda_fmaxi, FN_PROTOTYPE(vrda_fmaxi));
 WEAK_LIBM_ALIAS(vrda_fmini, FN_PROTOTYPE(vrda_fmini));
 
 WEAK_LIBM_ALIAS(vrda_powx, FN_PROTOTYPE(vrda_powx));
+WEAK_LIBM_ALIAS(vrda_pown, FN_PROTOTYPE(vrda_pown));
+WEAK_LIBM_ALIAS(vrda_rootn, FN_PROTOTYPE(vrda_rootn));
+WEAK_LIBM_ALIAS(vrda_frexp, FN_PROTOTYPE(vrda_frexp));
+WEAK_LIBM_ALIAS(vrda_ldexp, FN_PROTOTYPE(vrda_ldexp));
+WEAK_LIBM_ALIAS(vrda_scalbn, FN_PROTOTYPE(vrda_scalbn));
+WEAK_LIBM_ALIAS(vrda_ilogb, FN_PROTOTYPE(vrda_ilogb));
+WEAK_LIBM_ALIAS(vrda_logb, FN_PROTOTYPE(vrda_logb));
+WEAK_LIBM_ALIAS(vrda_exp_affine, FN_PROTOTYPE(vrda_exp_affine));
+WEAK_LIBM_ALIAS(vrda_log_affine, FN_PROTOTYPE(vrda_log_affine));
+WEAK_LIBM_ALIAS(vrda_pow_affine, FN_PROTOTYPE(vrda_pow_affine));
+WEAK_LIBM_ALIAS(vrda_sin_affine, FN_PROTOTYPE(vrda_sin_affine));
+WEAK_LIBM_ALIAS(vrda_cos_affine, FN_PROTOTYPE(vrda_cos_affine));
+WEAK_LIBM_ALIAS(vrda_sumexp, FN_PROTOTYPE(vrda_sumexp));
+WEAK_LIBM_ALIAS(vrda_logsumexp, FN_PROTOTYPE(vrda_logsumexp));
+WEAK_LIBM_ALIAS(vrda_sumlog, FN_PROTOTYPE(vrda_sumlog));
+WEAK_LIBM_ALIAS(vrda_cis, FN_PROTOTYPE(vrda_cis));
+WEAK_LIBM_ALIAS(vrda_polar, FN_PROTOTYPE(vrda_polar));
+WEAK_LIBM_ALIAS(vrda_boxmuller, FN_PROTOTYPE(vrda_boxmuller));
+WEAK_LIBM_ALIAS(vrda_cdfnorminv, FN_PROTOTYPE(vrda_cdfnorminv));
+WEAK_LIBM_ALIAS(vrda_erfc, FN_PROTOTYPE(vrda_erfc));
+WEAK_LIBM_ALIAS(vrda_erfinv, FN_PROTOTYPE(vrda_erfinv));
+WEAK_LIBM_ALIAS(vrda_erfcinv, FN_PROTOTYPE(vrda_erfcinv));
+WEAK_LIBM_ALIAS(vrda_cdfnorm, FN_PROTOTYPE(vrda_cdfnorm));
+WEAK_LIBM_ALIAS(vrda_lgamma, FN_PROTOTYPE(vrda_lgamma));
+WEAK_LIBM_ALIAS(vrda_tgamma, FN_PROTOTYPE(vrda_tgamma));
+WEAK_LIBM_ALIAS(vrda_digamma, FN_PROTOTYPE(vrda_digamma));
+WEAK_LIBM_ALIAS(vrda_rsqrt, FN_PROTOTYPE(vrda_rsqrt));
+WEAK_LIBM_ALIAS(vrda_rsqrt_approx, FN_PROTOTYPE(vrda_rsqrt_approx));
+WEAK_LIBM_ALIAS(vrda_invcbrt, FN_PROTOTYPE(vrda_invcbrt));
+WEAK_LIBM_ALIAS(vrda_rhypot, FN_PROTOTYPE(vrda_rhypot));
+WEAK_LIBM_ALIAS(vrza_cexp, FN_PROTOTYPE(vrza_cexp));
+WEAK_LIBM_ALIAS(vrza_clog, FN_PROTOTYPE(vrza_clog));
+WEAK_LIBM_ALIAS(vrza_cpow, FN_PROTOTYPE(vrza_cpow));
+WEAK_LIBM_ALIAS(vrza_csin, FN_PROTOTYPE(vrza_csin));
+WEAK_LIBM_ALIAS(vrza_ccos, FN_PROTOTYPE(vrza_ccos));
+WEAK_LIBM_ALIAS(vrza_ctan, FN_PROTOTYPE(vrza_ctan));
+WEAK_LIBM_ALIAS(vrza_csqrt, FN_PROTOTYPE(vrza_csqrt));
+WEAK_LIBM_ALIAS(vrza_cabs, FN_PROTOTYPE(vrza_cabs));
+WEAK_LIBM_ALIAS(vrza_carg, FN_PROTOTYPE(vrza_carg));
+WEAK_LIBM_ALIAS(vrza_cexp_soa, FN_PROTOTYPE(vrza_cexp_soa));
+WEAK_LIBM_ALIAS(vrza_clog_soa, FN_PROTOTYPE(vrza_clog_soa));
+WEAK_LIBM_ALIAS(vrza_cpow_soa, FN_PROTOTYPE(vrza_cpow_soa));
 
 
 /* Vector Functions */
@@ -702,9 +1173,19 @@ WEAK_LIBM_ALIAS(vrd2_erf, FN_PROTOTYPE(vrd2_erf));
 WEAK_LIBM_ALIAS(vrd2_sqrt, FN_PROTOTYPE(vrd2_sqrt));
 WEAK_LIBM_ALIAS(vrd2_fabs, FN_PROTOTYPE(vrd2_fabs));
 WEAK_LIBM_ALIAS(vrd2_linearfrac, FN_PROTOTYPE(vrd2_linearfrac));
+WEAK_LIBM_ALIAS(vrd2_erfc, FN_PROTOTYPE(vrd2_erfc));
+WEAK_LIBM_ALIAS(vrd2_erfinv, FN_PROTOTYPE(vrd2_erfinv));
+WEAK_LIBM_ALIAS(vrd2_erfcinv, FN_PROTOTYPE(vrd2_erfcinv));
+WEAK_LIBM_ALIAS(vrd2_cdfnorm, FN_PROTOTYPE(vrd2_cdfnorm));
+WEAK_LIBM_ALIAS(vrd2_cdfnorminv, FN_PROTOTYPE(vrd2_cdfnorminv));
+WEAK_LIBM_ALIAS(vrd2_rsqrt, FN_PROTOTYPE(vrd2_rsqrt));
+WEAK_LIBM_ALIAS(vrd2_rsqrt_approx, FN_PROTOTYPE(vrd2_rsqrt_approx));
+WEAK_LIBM_ALIAS(vrd2_invcbrt, FN_PROTOTYPE(vrd2_invcbrt));
+WEAK_LIBM_ALIAS(vrd2_rhypot, FN_PROTOTYPE(vrd2_rhypot));
 
 WEAK_LIBM_ALIAS(vrd4_pow, FN_PROTOTYPE(vrd4_pow));
 WEAK_LIBM_ALIAS(vrd4_powx, FN_PROTOTYPE(vrd4_powx));
+WEAK_LIBM_ALIAS(vrd4_pown, FN_PROTOTYPE(vrd4_pown));
 WEAK_LIBM_ALIAS(vrd4_exp, FN_PROTOTYPE(vrd4_exp));
 WEAK_LIBM_ALIAS(vrd4_exp2, FN_PROTOTYPE(vrd4_exp2));
 WEAK_LIBM_ALIAS(vrd4_log, FN_PROTOTYPE(vrd4_log));
@@ -718,6 +1199,32 @@ WEAK_LIBM_ALIAS(vrd4_erf, FN_PROTOTYPE(vrd4_erf));
 WEAK_LIBM_ALIAS(vrd4_sqrt, FN_PROTOTYPE(vrd4_sqrt));
 WEAK_LIBM_ALIAS(vrd4_fabs, FN_PROTOTYPE(vrd4_fabs));
 WEAK_LIBM_ALIAS(vrd4_linearfrac, FN_PROTOTYPE(vrd4_linearfrac));
+WEAK_LIBM_ALIAS(vrd4_frexp, FN_PROTOTYPE(vrd4_frexp));
+WEAK_LIBM_ALIAS(vrd4_ldexp, FN_PROTOTYPE(vrd4_ldexp));
+WEAK_LIBM_ALIAS(vrd4_scalbn, FN_PROTOTYPE(vrd4_scalbn));
+WEAK_LIBM_ALIAS(vrd4_ilogb, FN_PROTOTYPE(vrd4_ilogb));
+WEAK_LIBM_ALIAS(vrd4_logb, FN_PROTOTYPE(vrd4_logb));
+WEAK_LIBM_ALIAS(vrd4_erfc, FN_PROTOTYPE(vrd4_erfc));
+WEAK_LIBM_ALIAS(vrd4_erfinv, FN_PROTOTYPE(vrd4_erfinv));
+WEAK_LIBM_ALIAS(vrd4_erfcinv, FN_PROTOTYPE(vrd4_erfcinv));
+WEAK_LIBM_ALIAS(vrd4_cdfnorm, FN_PROTOTYPE(vrd4_cdfnorm));
+WEAK_LIBM_ALIAS(vrd4_cdfnorminv, FN_PROTOTYPE(vrd4_cdfnorminv));
+WEAK_LIBM_ALIAS(vrd4_lgamma, FN_PROTOTYPE(vrd4_lgamma));
+WEAK_LIBM_ALIAS(vrd4_tgamma, FN_PROTOTYPE(vrd4_tgamma));
+WEAK_LIBM_ALIAS(vrd4_digamma, FN_PROTOTYPE(vrd4_digamma));
+WEAK_LIBM_ALIAS(vrd4_rsqrt, FN_PROTOTYPE(vrd4_rsqrt));
+WEAK_LIBM_ALIAS(vrd4_rsqrt_approx, FN_PROTOTYPE(vrd4_rsqrt_approx));
+WEAK_LIBM_ALIAS(vrd4_invcbrt, FN_PROTOTYPE(vrd4_invcbrt));
+WEAK_LIBM_ALIAS(vrd4_rhypot, FN_PROTOTYPE(vrd4_rhypot));
+WEAK_LIBM_ALIAS(vrz4_cexp, FN_PROTOTYPE(vrz4_cexp));
+WEAK_LIBM_ALIAS(vrz4_clog, FN_PROTOTYPE(vrz4_clog));
+WEAK_LIBM_ALIAS(vrz4_cpow, FN_PROTOTYPE(vrz4_cpow));
+WEAK_LIBM_ALIAS(vrz4_csin, FN_PROTOTYPE(vrz4_csin));
+WEAK_LIBM_ALIAS(vrz4_ccos, FN_PROTOTYPE(vrz4_ccos));
+WEAK_LIBM_ALIAS(vrz4_ctan, FN_PROTOTYPE(vrz4_ctan));
+WEAK_LIBM_ALIAS(vrz4_csqrt, FN_PROTOTYPE(vrz4_csqrt));
+WEAK_LIBM_ALIAS(vrz4_cabs, FN_PROTOTYPE(vrz4_cabs));
+WEAK_LIBM_ALIAS(vrz4_carg, FN_PROTOTYPE(vrz4_carg));
 
 WEAK_LIBM_ALIAS(vrd8_pow, FN_PROTOTYPE(vrd8_pow));
 WEAK_LIBM_ALIAS(vrd8_powx, FN_PROTOTYPE(vrd8_powx));
@@ -734,6 +1241,26 @@ WEAK_LIBM_ALIAS(vrd8_sincos, FN_PROTOTYPE(vrd8_sincos));
 WEAK_LIBM_ALIAS(vrd8_erf, FN_PROTOTYPE(vrd8_erf));
 WEAK_LIBM_ALIAS(vrd8_linearfrac, FN_PROTOTYPE(vrd8_linearfrac));
 WEAK_LIBM_ALIAS(vrd8_sqrt, FN_PROTOTYPE(vrd8_sqrt));
+WEAK_LIBM_ALIAS(vrd8_frexp, FN_PROTOTYPE(vrd8_frexp));
+WEAK_LIBM_ALIAS(vrd8_ldexp, FN_PROTOTYPE(vrd8_ldexp));
+WEAK_LIBM_ALIAS(vrd8_scalbn, FN_PROTOTYPE(vrd8_scalbn));
+WEAK_LIBM_ALIAS(vrd8_ilogb, FN_PROTOTYPE(vrd8_ilogb));
+WEAK_LIBM_ALIAS(vrd8_logb, FN_PROTOTYPE(vrd8_logb));
+WEAK_LIBM_ALIAS(vrd8_erfc, FN_PROTOTYPE(vrd8_erfc));
+WEAK_LIBM_ALIAS(vrd8_erfinv, FN_PROTOTYPE(vrd8_erfinv));
+WEAK_LIBM_ALIAS(vrd8_erfcinv, FN_PROTOTYPE(vrd8_erfcinv));
+WEAK_LIBM_ALIAS(vrd8_cdfnorm, FN_PROTOTYPE(vrd8_cdfnorm));
+WEAK_LIBM_ALIAS(vrd8_cdfnorminv, FN_PROTOTYPE(vrd8_cdfnorminv));
+WEAK_LIBM_ALIAS(vrd8_lgamma, FN_PROTOTYPE(vrd8_lgamma));
+WEAK_LIBM_ALIAS(vrd8_tgamma, FN_PROTOTYPE(vrd8_tgamma));
+WEAK_LIBM_ALIAS(vrd8_digamma, FN_PROTOTYPE(vrd8_digamma));
+WEAK_LIBM_ALIAS(vrd8_rsqrt, FN_PROTOTYPE(vrd8_rsqrt));
+WEAK_LIBM_ALIAS(vrd8_rsqrt_approx, FN_PROTOTYPE(vrd8_rsqrt_approx));
+WEAK_LIBM_ALIAS(vrd8_invcbrt, FN_PROTOTYPE(vrd8_invcbrt));
+WEAK_LIBM_ALIAS(vrd8_rhypot, FN_PROTOTYPE(vrd8_rhypot));
+WEAK_LIBM_ALIAS(vrz8_cexp, FN_PROTOTYPE(vrz8_cexp));
+WEAK_LIBM_ALIAS(vrz8_clog, FN_PROTOTYPE(vrz8_clog));
+WEAK_LIBM_ALIAS(vrz8_cpow, FN_PROTOTYPE(vrz8_cpow));
 
 WEAK_LIBM_ALIAS(vrs4_powf, FN_PROTOTYPE(vrs4_powf));
 WEAK_LIBM_ALIAS(vrs4_powxf, FN_PROTOTYPE(vrs4_powxf));
@@ -759,6 +1286,15 @@ WEAK_LIBM_ALIAS(vrs4_fabsf, FN_PROTOTYPE(vrs4_fabsf));
 WEAK_LIBM_ALIAS(vrs4_sqrtf, FN_PROTOTYPE(vrs4_sqrtf));
 WEAK_LIBM_ALIAS(vrs4_linearfracf, FN_PROTOTYPE(vrs4_linearfracf));
 WEAK_LIBM_ALIAS(vrs4_sincosf, FN_PROTOTYPE(vrs4_sincosf));
+WEAK_LIBM_ALIAS(vrs4_erfcf, FN_PROTOTYPE(vrs4_erfcf));
+WEAK_LIBM_ALIAS(vrs4_erfinvf, FN_PROTOTYPE(vrs4_erfinvf));
+WEAK_LIBM_ALIAS(vrs4_erfcinvf, FN_PROTOTYPE(vrs4_erfcinvf));
+WEAK_LIBM_ALIAS(vrs4_cdfnormf, FN_PROTOTYPE(vrs4_cdfnormf));
+WEAK_LIBM_ALIAS(vrs4_cdfnorminvf, FN_PROTOTYPE(vrs4_cdfnorminvf));
+WEAK_LIBM_ALIAS(vrs4_rsqrtf, FN_PROTOTYPE(vrs4_rsqrtf));
+WEAK_LIBM_ALIAS(vrs4_rsqrtf_approx, FN_PROTOTYPE(vrs4_rsqrtf_approx));
+WEAK_LIBM_ALIAS(vrs4_invcbrtf, FN_PROTOTYPE(vrs4_invcbrtf));
+WEAK_LIBM_ALIAS(vrs4_rhypotf, FN_PROTOTYPE(vrs4_rhypotf));
 
 WEAK_LIBM_ALIAS(vrs8_powf, FN_PROTOTYPE(vrs8_powf));
 WEAK_LIBM_ALIAS(vrs8_powxf, FN_PROTOTYPE(vrs8_powxf));
@@ -780,6 +1316,32 @@ WEAK_LIBM_ALIAS(vrs8_fabsf, FN_PROTOTYPE(vrs8_fabsf));
 WEAK_LIBM_ALIAS(vrs8_sqrtf, FN_PROTOTYPE(vrs8_sqrtf));
 WEAK_LIBM_ALIAS(vrs8_linearfracf, FN_PROTOTYPE(vrs8_linearfracf));
 WEAK_LIBM_ALIAS(vrs8_sincosf, FN_PROTOTYPE(vrs8_sincosf));
+WEAK_LIBM_ALIAS(vrs8_frexpf, FN_PROTOTYPE(vrs8_frexpf));
+WEAK_LIBM_ALIAS(vrs8_ldexpf, FN_PROTOTYPE(vrs8_ldexpf));
+WEAK_LIBM_ALIAS(vrs8_scalbnf, FN_PROTOTYPE(vrs8_scalbnf));
+WEAK_LIBM_ALIAS(vrs8_ilogbf, FN_PROTOTYPE(vrs8_ilogbf));
+WEAK_LIBM_ALIAS(vrs8_logbf, FN_PROTOTYPE(vrs8_logbf));
+WEAK_LIBM_ALIAS(vrs8_erfcf, FN_PROTOTYPE(vrs8_erfcf));
+WEAK_LIBM_ALIAS(vrs8_erfinvf, FN_PROTOTYPE(vrs8_erfinvf));
+WEAK_LIBM_ALIAS(vrs8_erfcinvf, FN_PROTOTYPE(vrs8_erfcinvf));
+WEAK_LIBM_ALIAS(vrs8_cdfnormf, FN_PROTOTYPE(vrs8_cdfnormf));
+WEAK_LIBM_ALIAS(vrs8_cdfnorminvf, FN_PROTOTYPE(vrs8_cdfnorminvf));
+WEAK_LIBM_ALIAS(vrs8_lgammaf, FN_PROTOTYPE(vrs8_lgammaf));
+WEAK_LIBM_ALIAS(vrs8_tgammaf, FN_PROTOTYPE(vrs8_tgammaf));
+WEAK_LIBM_ALIAS(vrs8_digammaf, FN_PROTOTYPE(vrs8_digammaf));
+WEAK_LIBM_ALIAS(vrs8_rsqrtf, FN_PROTOTYPE(vrs8_rsqrtf));
+WEAK_LIBM_ALIAS(vrs8_rsqrtf_approx, FN_PROTOTYPE(vrs8_rsqrtf_approx));
+WEAK_LIBM_ALIAS(vrs8_invcbrtf, FN_PROTOTYPE(vrs8_invcbrtf));
+WEAK_LIBM_ALIAS(vrs8_rhypotf, FN_PROTOTYPE(vrs8_rhypotf));
+WEAK_LIBM_ALIAS(vrc8_cexpf, FN_PROTOTYPE(vrc8_cexpf));
+WEAK_LIBM_ALIAS(vrc8_clogf, FN_PROTOTYPE(vrc8_clogf));
+WEAK_LIBM_ALIAS(vrc8_cpowf, FN_PROTOTYPE(vrc8_cpowf));
+WEAK_LIBM_ALIAS(vrc8_csinf, FN_PROTOTYPE(vrc8_csinf));
+WEAK_LIBM_ALIAS(vrc8_ccosf, FN_PROTOTYPE(vrc8_ccosf));
+WEAK_LIBM_ALIAS(vrc8_ctanf, FN_PROTOTYPE(vrc8_ctanf));
+WEAK_LIBM_ALIAS(vrc8_csqrtf, FN_PROTOTYPE(vrc8_csqrtf));
+WEAK_LIBM_ALIAS(vrc8_cabsf, FN_PROTOTYPE(vrc8_cabsf));
+WEAK_LIBM_ALIAS(vrc8_cargf, FN_PROTOTYPE(vrc8_cargf));
 
 WEAK_LIBM_ALIAS(vrs16_powf, FN_PROTOTYPE(vrs16_powf));
 WEAK_LIBM_ALIAS(vrs16_powxf, FN_PROTOTYPE(vrs16_powxf));
@@ -799,6 +1361,26 @@ WEAK_LIBM_ALIAS(vrs16_erff, FN_PROTOTYPE(vrs16_erff));
 WEAK_LIBM_ALIAS(vrs16_sqrtf, FN_PROTOTYPE(vrs16_sqrtf));
 WEAK_LIBM_ALIAS(vrs16_linearfracf, FN_PROTOTYPE(vrs16_linearfracf));
 WEAK_LIBM_ALIAS(vrs16_sincosf, FN_PROTOTYPE(vrs16_sincosf));
+WEAK_LIBM_ALIAS(vrs16_frexpf, FN_PROTOTYPE(vrs16_frexpf));
+WEAK_LIBM_ALIAS(vrs16_ldexpf, FN_PROTOTYPE(vrs16_ldexpf));
+WEAK_LIBM_ALIAS(vrs16_scalbnf, FN_PROTOTYPE(vrs16_scalbnf));
+WEAK_LIBM_ALIAS(vrs16_ilogbf, FN_PROTOTYPE(vrs16_ilogbf));
+WEAK_LIBM_ALIAS(vrs16_logbf, FN_PROTOTYPE(vrs16_logbf));
+WEAK_LIBM_ALIAS(vrs16_erfcf, FN_PROTOTYPE(vrs16_erfcf));
+WEAK_LIBM_ALIAS(vrs16_erfinvf, FN_PROTOTYPE(vrs16_erfinvf));
+WEAK_LIBM_ALIAS(vrs16_erfcinvf, FN_PROTOTYPE(vrs16_erfcinvf));
+WEAK_LIBM_ALIAS(vrs16_cdfnormf, FN_PROTOTYPE(vrs16_cdfnormf));
+WEAK_LIBM_ALIAS(vrs16_cdfnorminvf, FN_PROTOTYPE(vrs16_cdfnorminvf));
+WEAK_LIBM_ALIAS(vrs16_lgammaf, FN_PROTOTYPE(vrs16_lgammaf));
+WEAK_LIBM_ALIAS(vrs16_tgammaf, FN_PROTOTYPE(vrs16_tgammaf));
+WEAK_LIBM_ALIAS(vrs16_digammaf, FN_PROTOTYPE(vrs16_digammaf));
+WEAK_LIBM_ALIAS(vrs16_rsqrtf, FN_PROTOTYPE(vrs16_rsqrtf));
+WEAK_LIBM_ALIAS(vrs16_rsqrtf_approx, FN_PROTOTYPE(vrs16_rsqrtf_approx));
+WEAK_LIBM_ALIAS(vrs16_invcbrtf, FN_PROTOTYPE(vrs16_invcbrtf));
+WEAK_LIBM_ALIAS(vrs16_rhypotf, FN_PROTOTYPE(vrs16_rhypotf));
+WEAK_LIBM_ALIAS(vrc16_cexpf, FN_PROTOTYPE(vrc16_cexpf));
+WEAK_LIBM_ALIAS(vrc16_clogf, FN_PROTOTYPE(vrc16_clogf));
+WEAK_LIBM_ALIAS(vrc16_cpowf, FN_PROTOTYPE(vrc16_cpowf));
 
 /*
  * SWLCSG-2283 & CPUPL-4422 - Weak Aliases with "__" prefix in order
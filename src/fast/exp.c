@@ -242,6 +242,5 @@ ALM_PROTO_FAST(exp)(double x) {
     return q1.d;
 }
 
-strong_alias (__exp_finite, ALM_PROTO_FAST(exp))
 weak_alias (amd_exp, ALM_PROTO_FAST(exp))
 weak_alias (exp, ALM_PROTO_FAST(exp))
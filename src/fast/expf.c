@@ -162,6 +162,5 @@ ALM_PROTO_FAST(expf)(float x) {
 }
 
 
-strong_alias (__expf_finite, ALM_PROTO_FAST(expf))
 weak_alias (amd_expf, ALM_PROTO_FAST(expf))
 weak_alias (expf, ALM_PROTO_FAST(expf))
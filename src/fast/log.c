@@ -306,6 +306,5 @@ ALM_PROTO_FAST(log)(double x) {
     return q;
 }
 
-strong_alias (__log_finite, ALM_PROTO_FAST(log))
 weak_alias (amd_log, ALM_PROTO_FAST(log))
 weak_alias (log, ALM_PROTO_FAST(log))
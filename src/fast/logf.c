@@ -117,7 +117,6 @@ ALM_PROTO_FAST(logf)(float x)
     return r;
 }
 
-strong_alias (__logf_finite, ALM_PROTO_FAST(logf))
 weak_alias (logf, ALM_PROTO_FAST(logf))
 weak_alias (amd_logf, ALM_PROTO_FAST(logf))
 strong_alias (__ieee754_logf, ALM_PROTO_FAST(logf))
@@ -35,96 +35,137 @@
 
 
 struct entry_pt_interface entry_pt_initializers[C_AMD_LAST_ENTRY] = {
-    [C_AMD_ACOS]       = {LIBM_IFACE_PROTO(acos), NULL},
-    [C_AMD_ACOSH]      = {LIBM_IFACE_PROTO(acosh), NULL},
-    [C_AMD_ASIN]       = {LIBM_IFACE_PROTO(asin), NULL},
-    [C_AMD_ASINH]      = {LIBM_IFACE_PROTO(asinh), NULL},
-    [C_AMD_ATAN2]      = {LIBM_IFACE_PROTO(atan2), NULL},
-    [C_AMD_ATAN]       = {LIBM_IFACE_PROTO(atan), NULL},
-    [C_AMD_ATANH]      = {LIBM_IFACE_PROTO(atanh), NULL},
-    [C_AMD_CBRT]       = {LIBM_IFACE_PROTO(cbrt), NULL},
-    [C_AMD_CEIL]       = {LIBM_IFACE_PROTO(ceil), NULL},
-    [C_AMD_COPYSIGN]   = {LIBM_IFACE_PROTO(copysign), NULL},
-    [C_AMD_COS]        = {LIBM_IFACE_PROTO(cos), NULL},
-    [C_AMD_COSH]       = {LIBM_IFACE_PROTO(cosh), NULL},
-    [C_AMD_COSPI]      = {LIBM_IFACE_PROTO(cospi), NULL},
-    [C_AMD_EXP10]      = {LIBM_IFACE_PROTO(exp10), NULL},
-    [C_AMD_EXP2]       = {LIBM_IFACE_PROTO(exp2), NULL},
-    [C_AMD_EXP]        = {LIBM_IFACE_PROTO(exp), NULL},
-    [C_AMD_EXPM1]      = {LIBM_IFACE_PROTO(expm1), NULL},
-    [C_AMD_FABS]       = {LIBM_IFACE_PROTO(fabs), NULL},
-    [C_AMD_FDIM]       = {LIBM_IFACE_PROTO(fdim), NULL},
-    [C_AMD_FLOOR]      = {LIBM_IFACE_PROTO(floor), NULL},
-    [C_AMD_FMA]        = {LIBM_IFACE_PROTO(fma), NULL},
-    [C_AMD_FMOD]       = {LIBM_IFACE_PROTO(fmod), NULL},
-    [C_AMD_FREXP]      = {LIBM_IFACE_PROTO(frexp), NULL},
-    [C_AMD_HYPOT]      = {LIBM_IFACE_PROTO(hypot), NULL},
-    [C_AMD_LDEXP]      = {LIBM_IFACE_PROTO(ldexp), NULL},
-    [C_AMD_LOG10]      = {LIBM_IFACE_PROTO(log10), NULL},
-    [C_AMD_LOG1P]      = {LIBM_IFACE_PROTO(log1p), NULL},
-    [C_AMD_LOG2]       = {LIBM_IFACE_PROTO(log2), NULL},
-    [C_AMD_LOGB]       = {LIBM_IFACE_PROTO(logb), NULL},
-    [C_AMD_LOG]        = {LIBM_IFACE_PROTO(log), NULL},
-    [C_AMD_MODF]       = {LIBM_IFACE_PROTO(modf), NULL},
-    [C_AMD_NAN]        = {LIBM_IFACE_PROTO(nan), NULL},
-    [C_AMD_NEARBYINT]  = {LIBM_IFACE_PROTO(nearbyint), NULL},
-    [C_AMD_NEXTAFTER]  = {LIBM_IFACE_PROTO(nextafter), NULL},
-    [C_AMD_NEXTTOWARD] = {LIBM_IFACE_PROTO(nexttoward), NULL},
-    [C_AMD_POW]        = {LIBM_IFACE_PROTO(pow), NULL},
-    [C_AMD_POWX]       = {LIBM_IFACE_PROTO(powx), NULL},
-    [C_AMD_REMAINDER]  = {LIBM_IFACE_PROTO(remainder), NULL},
-    [C_AMD_REMQUO]     = {LIBM_IFACE_PROTO(remquo), NULL},
-    [C_AMD_RINT]       = {LIBM_IFACE_PROTO(rint), NULL},
-    [C_AMD_ROUND]      = {LIBM_IFACE_PROTO(round), NULL},
-    [C_AMD_SCALBLN]    = {LIBM_IFACE_PROTO(scalbln), NULL},
-    [C_AMD_SCALBN]     = {LIBM_IFACE_PROTO(scalbn), NULL},
-    [C_AMD_SIN]        = {LIBM_IFACE_PROTO(sin), NULL},
-    [C_AMD_SINH]       = {LIBM_IFACE_PROTO(sinh), NULL},
-    [C_AMD_SINPI]      = {LIBM_IFACE_PROTO(sinpi), NULL},
-    [C_AMD_SQRT]       = {LIBM_IFACE_PROTO(sqrt), NULL},
-    [C_AMD_TAN]        = {LIBM_IFACE_PROTO(tan), NULL},
-    [C_AMD_TANH]       = {LIBM_IFACE_PROTO(tanh), NULL},
-    [C_AMD_TANPI]      = {LIBM_IFACE_PROTO(tanpi), NULL},
-    [C_AMD_TRUNC]      = {LIBM_IFACE_PROTO(trunc), NULL},
-    [C_AMD_ERF]      =   {LIBM_IFACE_PROTO(erf), NULL},
-
-    [C_AMD_SINCOS]     = {LIBM_IFACE_PROTO(sincos), NULL},
+    [C_AMD_ACOS]       = {LIBM_IFACE_PROTO(acos), NULL, "acos"},
+    [C_AMD_ACOSH]      = {LIBM_IFACE_PROTO(acosh), NULL, "acosh"},
+    [C_AMD_ASIN]       = {LIBM_IFACE_PROTO(asin), NULL, "asin"},
+    [C_AMD_ASINH]      = {LIBM_IFACE_PROTO(asinh), NULL, "asinh"},
+    [C_AMD_ATAN2]      = {LIBM_IFACE_PROTO(atan2), NULL, "atan2"},
+    [C_AMD_ATAN]       = {LIBM_IFACE_PROTO(atan), NULL, "atan"},
+    [C_AMD_ATANH]      = {LIBM_IFACE_PROTO(atanh), NULL, "atanh"},
+    [C_AMD_CBRT]       = {LIBM_IFACE_PROTO(cbrt), NULL, "cbrt"},
+    [C_AMD_CEIL]       = {LIBM_IFACE_PROTO(ceil), NULL, "ceil"},
+    [C_AMD_COPYSIGN]   = {LIBM_IFACE_PROTO(copysign), NULL, "copysign"},
+    [C_AMD_COS]        = {LIBM_IFACE_PROTO(cos), NULL, "cos"},
+    [C_AMD_COSH]       = {LIBM_IFACE_PROTO(cosh), NULL, "cosh"},
+    [C_AMD_COSPI]      = {LIBM_IFACE_PROTO(cospi), NULL, "cospi"},
+    [C_AMD_EXP10]      = {LIBM_IFACE_PROTO(exp10), NULL, "exp10"},
+    [C_AMD_EXP2]       = {LIBM_IFACE_PROTO(exp2), NULL, "exp2"},
+    [C_AMD_EXP]        = {LIBM_IFACE_PROTO(exp), NULL, "exp"},
+    [C_AMD_EXPM1]      = {LIBM_IFACE_PROTO(expm1), NULL, "expm1"},
+    [C_AMD_FABS]       = {LIBM_IFACE_PROTO(fabs), NULL, "fabs"},
+    [C_AMD_FDIM]       = {LIBM_IFACE_PROTO(fdim), NULL, "fdim"},
+    [C_AMD_FLOOR]      = {LIBM_IFACE_PROTO(floor), NULL, "floor"},
+    [C_AMD_FMA]        = {LIBM_IFACE_PROTO(fma), NULL, "fma"},
+    [C_AMD_FMOD]       = {LIBM_IFACE_PROTO(fmod), NULL, "fmod"},
+    [C_AMD_FREXP]      = {LIBM_IFACE_PROTO(frexp), NULL, "frexp"},
+    [C_AMD_HYPOT]      = {LIBM_IFACE_PROTO(hypot), NULL, "hypot"},
+    [C_AMD_LDEXP]      = {LIBM_IFACE_PROTO(ldexp), NULL, "ldexp"},
+    [C_AMD_LOG10]      = {LIBM_IFACE_PROTO(log10), NULL, "log10"},
+    [C_AMD_LOG1P]      = {LIBM_IFACE_PROTO(log1p), NULL, "log1p"},
+    [C_AMD_LOG2]       = {LIBM_IFACE_PROTO(log2), NULL, "log2"},
+    [C_AMD_LOGB]       = {LIBM_IFACE_PROTO(logb), NULL, "logb"},
+    [C_AMD_LOG]        = {LIBM_IFACE_PROTO(log), NULL, "log"},
+    [C_AMD_MODF]       = {LIBM_IFACE_PROTO(modf), NULL, "modf"},
+    [C_AMD_NAN]        = {LIBM_IFACE_PROTO(nan), NULL, "nan"},
+    [C_AMD_NEARBYINT]  = {LIBM_IFACE_PROTO(nearbyint), NULL, "nearbyint"},
+    [C_AMD_NEXTAFTER]  = {LIBM_IFACE_PROTO(nextafter), NULL, "nextafter"},
+    [C_AMD_NEXTTOWARD] = {LIBM_IFACE_PROTO(nexttoward), NULL, "nexttoward"},
+    [C_AMD_POW]        = {LIBM_IFACE_PROTO(pow), NULL, "pow"},
+    [C_AMD_POWX]       = {LIBM_IFACE_PROTO(powx), NULL, "powx"},
+    [C_AMD_REMAINDER]  = {LIBM_IFACE_PROTO(remainder), NULL, "remainder"},
+    [C_AMD_REMQUO]     = {LIBM_IFACE_PROTO(remquo), NULL, "remquo"},
+    [C_AMD_RINT]       = {LIBM_IFACE_PROTO(rint), NULL, "rint"},
+    [C_AMD_ROUND]      = {LIBM_IFACE_PROTO(round), NULL, "round"},
+    [C_AMD_SCALBLN]    = {LIBM_IFACE_PROTO(scalbln), NULL, "scalbln"},
+    [C_AMD_SCALBN]     = {LIBM_IFACE_PROTO(scalbn), NULL, "scalbn"},
+    [C_AMD_SIN]        = {LIBM_IFACE_PROTO(sin), NULL, "sin"},
+    [C_AMD_SINH]       = {LIBM_IFACE_PROTO(sinh), NULL, "sinh"},
+    [C_AMD_SINPI]      = {LIBM_IFACE_PROTO(sinpi), NULL, "sinpi"},
+    [C_AMD_SQRT]       = {LIBM_IFACE_PROTO(sqrt), NULL, "sqrt"},
+    [C_AMD_TAN]        = {LIBM_IFACE_PROTO(tan), NULL, "tan"},
+    [C_AMD_TANH]       = {LIBM_IFACE_PROTO(tanh), NULL, "tanh"},
+    [C_AMD_TANPI]      = {LIBM_IFACE_PROTO(tanpi), NULL, "tanpi"},
+    [C_AMD_TRUNC]      = {LIBM_IFACE_PROTO(trunc), NULL, "trunc"},
+    [C_AMD_ERF]      =   {LIBM_IFACE_PROTO(erf), NULL, "erf"},
+
+    [C_AMD_SINCOS]     = {LIBM_IFACE_PROTO(sincos), NULL, "sincos"},
 
     /* Integer variants */
-    [C_AMD_FINITE]     = {LIBM_IFACE_PROTO(finite), NULL},
-    [C_AMD_ILOGB]      = {LIBM_IFACE_PROTO(ilogb), NULL},
-    [C_AMD_LRINT]      = {LIBM_IFACE_PROTO(lrint), NULL},
-    [C_AMD_LROUND]     = {LIBM_IFACE_PROTO(lround), NULL},
-    [C_AMD_LLRINT]     = {LIBM_IFACE_PROTO(llrint), NULL},
-    [C_AMD_LLROUND]    = {LIBM_IFACE_PROTO(llround), NULL},
+    [C_AMD_FINITE]     = {LIBM_IFACE_PROTO(finite), NULL, "finite"},
+    [C_AMD_ILOGB]      = {LIBM_IFACE_PROTO(ilogb), NULL, "ilogb"},
+    [C_AMD_LRINT]      = {LIBM_IFACE_PROTO(lrint), NULL, "lrint"},
+    [C_AMD_LROUND]     = {LIBM_IFACE_PROTO(lround), NULL, "lround"},
+    [C_AMD_LLRINT]     = {LIBM_IFACE_PROTO(llrint), NULL, "llrint"},
+    [C_AMD_LLROUND]    = {LIBM_IFACE_PROTO(llround), NULL, "llround"},
 
     /*complex*/
-    [C_AMD_CEXP]       = {LIBM_IFACE_PROTO(cexp), NULL},
-    [C_AMD_CPOW]       = {LIBM_IFACE_PROTO(cpow), NULL},
-    [C_AMD_CLOG]       = {LIBM_IFACE_PROTO(clog), NULL},
+    [C_AMD_CEXP]       = {LIBM_IFACE_PROTO(cexp), NULL, "cexp"},
+    [C_AMD_CPOW]       = {LIBM_IFACE_PROTO(cpow), NULL, "cpow"},
+    [C_AMD_CLOG]       = {LIBM_IFACE_PROTO(clog), NULL, "clog"},
+    [C_AMD_CSIN]       = {LIBM_IFACE_PROTO(csin), NULL, "csin"},
+    [C_AMD_CCOS]       = {LIBM_IFACE_PROTO(ccos), NULL, "ccos"},
+    [C_AMD_CTAN]       = {LIBM_IFACE_PROTO(ctan), NULL, "ctan"},
+    [C_AMD_CSQRT]      = {LIBM_IFACE_PROTO(csqrt), NULL, "csqrt"},
+    [C_AMD_CABS]       = {LIBM_IFACE_PROTO(cabs), NULL, "cabs"},
+    [C_AMD_CARG]       = {LIBM_IFACE_PROTO(carg), NULL, "carg"},
+    [C_AMD_SIGMOID]    = {LIBM_IFACE_PROTO(sigmoid), NULL, "sigmoid"},
+    [C_AMD_POWN]       = {LIBM_IFACE_PROTO(pown), NULL, "pown"},
+    [C_AMD_ROOTN]      = {LIBM_IFACE_PROTO(rootn), NULL, "rootn"},
+    [C_AMD_EXP_AFFINE] = {LIBM_IFACE_PROTO(exp_affine), NULL, "exp_affine"},
+    [C_AMD_LOG_AFFINE] = {LIBM_IFACE_PROTO(log_affine), NULL, "log_affine"},
+    [C_AMD_POW_AFFINE] = {LIBM_IFACE_PROTO(pow_affine), NULL, "pow_affine"},
+    [C_AMD_SIN_AFFINE] = {LIBM_IFACE_PROTO(sin_affine), NULL, "sin_affine"},
+    [C_AMD_COS_AFFINE] = {LIBM_IFACE_PROTO(cos_affine), NULL, "cos_affine"},
+    [C_AMD_TANH_AFFINE] = {LIBM_IFACE_PROTO(tanh_affine), NULL, "tanh_affine"},
+    [C_AMD_SUMEXP]     = {LIBM_IFACE_PROTO(sumexp), NULL, "sumexp"},
+    [C_AMD_LOGSUMEXP]  = {LIBM_IFACE_PROTO(logsumexp), NULL, "logsumexp"},
+    [C_AMD_SUMLOG]     = {LIBM_IFACE_PROTO(sumlog), NULL, "sumlog"},
+    [C_AMD_SILU]       = {LIBM_IFACE_PROTO(silu), NULL, "silu"},
+    [C_AMD_SOFTPLUS]   = {LIBM_IFACE_PROTO(softplus), NULL, "softplus"},
+    [C_AMD_GELU]       = {LIBM_IFACE_PROTO(gelu), NULL, "gelu"},
+    [C_AMD_GELU_TANH]  = {LIBM_IFACE_PROTO(gelu_tanh), NULL, "gelu_tanh"},
+    [C_AMD_SOFTMAX]    = {LIBM_IFACE_PROTO(softmax), NULL, "softmax"},
+    [C_AMD_CIS]        = {LIBM_IFACE_PROTO(cis), NULL, "cis"},
+    [C_AMD_POLAR]      = {LIBM_IFACE_PROTO(polar), NULL, "polar"},
+    [C_AMD_BOXMULLER]  = {LIBM_IFACE_PROTO(boxmuller), NULL, "boxmuller"},
+    [C_AMD_CDFNORMINV] = {LIBM_IFACE_PROTO(cdfnorminv), NULL, "cdfnorminv"},
+    [C_AMD_ERFC]       = {LIBM_IFACE_PROTO(erfc), NULL, "erfc"},
+    [C_AMD_ERFINV]     = {LIBM_IFACE_PROTO(erfinv), NULL, "erfinv"},
+    [C_AMD_ERFCINV]    = {LIBM_IFACE_PROTO(erfcinv), NULL, "erfcinv"},
+    [C_AMD_CDFNORM]    = {LIBM_IFACE_PROTO(cdfnorm), NULL, "cdfnorm"},
+    [C_AMD_LGAMMA]     = {LIBM_IFACE_PROTO(lgamma), NULL, "lgamma"},
+    [C_AMD_TGAMMA]     = {LIBM_IFACE_PROTO(tgamma), NULL, "tgamma"},
+    [C_AMD_DIGAMMA]    = {LIBM_IFACE_PROTO(digamma), NULL, "digamma"},
+    [C_AMD_RSQRT]      = {LIBM_IFACE_PROTO(rsqrt), NULL, "rsqrt"},
+    [C_AMD_RSQRT_APPROX] = {LIBM_IFACE_PROTO(rsqrt_approx), NULL, "rsqrt_approx"},
+    [C_AMD_INVCBRT]    = {LIBM_IFACE_PROTO(invcbrt), NULL, "invcbrt"},
+    [C_AMD_RHYPOT]     = {LIBM_IFACE_PROTO(rhypot), NULL, "rhypot"},
 
     /* Arithmetic */
-    [C_AMD_ADD]       = {LIBM_IFACE_PROTO(add), NULL},
-    [C_AMD_SUB]       = {LIBM_IFACE_PROTO(sub), NULL},
-    [C_AMD_MUL]       = {LIBM_IFACE_PROTO(mul), NULL},
-    [C_AMD_DIV]       = {LIBM_IFACE_PROTO(div), NULL},
-    [C_AMD_FMAX]      = {LIBM_IFACE_PROTO(fmax), NULL},
-    [C_AMD_FMIN]       = {LIBM_IFACE_PROTO(fmin), NULL},
-
-    [C_AMD_ADDI]       = {LIBM_IFACE_PROTO(addi), NULL},
-    [C_AMD_SUBI]       = {LIBM_IFACE_PROTO(subi), NULL},
-    [C_AMD_MULI]       = {LIBM_IFACE_PROTO(muli), NULL},
-    [C_AMD_DIVI]       = {LIBM_IFACE_PROTO(divi), NULL},
-    [C_AMD_FMAXI]      = {LIBM_IFACE_PROTO(fmaxi), NULL},
-    [C_AMD_FMINI]      = {LIBM_IFACE_PROTO(fmini), NULL},
-
-    [C_AMD_LINEARFRAC]      = {LIBM_IFACE_PROTO(linearfrac), NULL},
+    [C_AMD_ADD]       = {LIBM_IFACE_PROTO(add), NULL, "add"},
+    [C_AMD_SUB]       = {LIBM_IFACE_PROTO(sub), NULL, "sub"},
+    [C_AMD_MUL]       = {LIBM_IFACE_PROTO(mul), NULL, "mul"},
+    [C_AMD_DIV]       = {LIBM_IFACE_PROTO(div), NULL, "div"},
+    [C_AMD_FMAX]      = {LIBM_IFACE_PROTO(fmax), NULL, "fmax"},
+    [C_AMD_FMIN]       = {LIBM_IFACE_PROTO(fmin), NULL, "fmin"},
+
+    [C_AMD_ADDI]       = {LIBM_IFACE_PROTO(addi), NULL, "addi"},
+    [C_AMD_SUBI]       = {LIBM_IFACE_PROTO(subi), NULL, "subi"},
+    [C_AMD_MULI]       = {LIBM_IFACE_PROTO(muli), NULL, "muli"},
+    [C_AMD_DIVI]       = {LIBM_IFACE_PROTO(divi), NULL, "divi"},
+    [C_AMD_FMAXI]      = {LIBM_IFACE_PROTO(fmaxi), NULL, "fmaxi"},
+    [C_AMD_FMINI]      = {LIBM_IFACE_PROTO(fmini), NULL, "fmini"},
+
+    [C_AMD_LINEARFRAC]      = {LIBM_IFACE_PROTO(linearfrac), NULL, "linearfrac"},
 };
 
 #ifndef ARRAY_SIZE
 #define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
 #endif
 
+/* Entry being initialized, alm_iface_fixup() records its table here */
+static struct entry_pt_interface *alm_iface_cur;
+
 void
 libm_iface_init(void)
 {
@@ -134,9 +175,12 @@ libm_iface_init(void)
     for (int i = 0; i < n; i++) {
         ptr = &entry_pt_initializers[i];
         if (ptr && ptr->epi_init) {
+            alm_iface_cur = ptr;
             ptr->epi_init(ptr->epi_arg);
         }
     }
+
+    alm_iface_cur = NULL;
 }
 
 
@@ -228,6 +272,9 @@ alm_iface_fixup(alm_ep_wrapper_t *g_ep_wrapper,
     if (!alm_funcs)
         return;
 
+    if (alm_iface_cur)
+        alm_iface_cur->epi_funcs = alm_funcs;
+
     arch_ver = alm_get_uach();
 
     for (int i = ((int)ALM_FUNC_VAR_MAX-1); i >=0 ; i--) {
@@ -241,3 +288,27 @@ alm_iface_fixup(alm_ep_wrapper_t *g_ep_wrapper,
         }
     }
 }
+
+const char *
+alm_iface_name(int entry)
+{
+    if (entry <= 0 || entry >= C_AMD_LAST_ENTRY)
+        return NULL;
+
+    return entry_pt_initializers[entry].epi_name;
+}
+
+const struct alm_arch_funcs *
+alm_iface_funcs(int entry)
+{
+    if (entry <= 0 || entry >= C_AMD_LAST_ENTRY)
+        return NULL;
+
+    return entry_pt_initializers[entry].epi_funcs;
+}
+
+alm_uarch_ver_t
+alm_iface_uarch(void)
+{
+    return alm_get_uach();
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/iface.h>
+#include <libm/entry_pt.h>
+#include <libm/arch/all.h>
+
+
+static const
+struct alm_arch_funcs __arch_funcs_carg = {
+    .def_arch = ALM_UARCH_VER_DEFAULT,
+    .funcs = {
+        [ALM_UARCH_VER_DEFAULT] = {
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_AVX2(cargf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_AVX2(carg),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_AVX2(vrc8_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_AVX2(vrz4_carg),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_AVX2(vrca_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_AVX2(vrza_carg),
+        },
+
+        [ALM_UARCH_VER_ZEN] = {
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN(cargf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN(carg),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN(vrc8_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN(vrz4_carg),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN(vrca_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN(vrza_carg),
+        },
+
+        [ALM_UARCH_VER_ZEN2] = {
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN2(cargf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN2(carg),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN2(vrc8_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN2(vrz4_carg),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN2(vrca_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN2(vrza_carg),
+        },
+
+        [ALM_UARCH_VER_ZEN3] = {
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN3(cargf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN3(carg),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN3(vrc8_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN3(vrz4_carg),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN3(vrca_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN3(vrza_carg),
+        },
+
+        [ALM_UARCH_VER_ZEN4] = {
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN4(cargf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN4(carg),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN4(vrc8_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN4(vrz4_carg),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN4(vrca_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN4(vrza_carg),
+        },
+
+        [ALM_UARCH_VER_ZEN5] = {
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN5(cargf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN5(carg),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN5(vrc8_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN5(vrz4_carg),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN5(vrca_cargf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN5(vrza_carg),
+        },
+    },
+};
+
+void
+LIBM_IFACE_PROTO(carg)(void *arg) {
+    alm_ep_wrapper_t g_entry_carg = {
+       .g_ep = {
+           [ALM_FUNC_SCAL_SP_CMPLX]     = &G_ENTRY_PT_PTR(cargf),
+           [ALM_FUNC_SCAL_DP_CMPLX]     = &G_ENTRY_PT_PTR(carg),
+           [ALM_FUNC_VECT_SP_CMPLX_8]   = &G_ENTRY_PT_PTR(vrc8_cargf),
+           [ALM_FUNC_VECT_DP_CMPLX_4]   = &G_ENTRY_PT_PTR(vrz4_carg),
+           [ALM_FUNC_VECT_SP_CMPLX_ARR] = &G_ENTRY_PT_PTR(vrca_cargf),
+           [ALM_FUNC_VECT_DP_CMPLX_ARR] = &G_ENTRY_PT_PTR(vrza_carg),
+        },
+    };
+
+    alm_iface_fixup(&g_entry_carg, &__arch_funcs_carg);
+}
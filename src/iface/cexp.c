@@ -37,33 +37,75 @@ struct alm_arch_funcs __arch_funcs_cexp = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
     .funcs = {
         [ALM_UARCH_VER_DEFAULT] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_AVX2(cexpf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_AVX2(cexp),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_AVX2(cexpf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_AVX2(cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_AVX2(vrc8_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_AVX2(vrz4_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_16]  = &ALM_PROTO_ARCH_ZN4(vrc16_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN4(vrz8_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_AVX2(vrca_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_AVX2(vrza_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_AVX2(vrca_cexpf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_AVX2(vrza_cexp_soa),
         },
 
         [ALM_UARCH_VER_ZEN] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_ZN(cexpf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_ZN(cexp),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN(cexpf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN(cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN(vrc8_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN(vrz4_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN(vrca_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN(vrza_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN(vrca_cexpf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN(vrza_cexp_soa),
         },
 
         [ALM_UARCH_VER_ZEN2] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_ZN2(cexpf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_ZN2(cexp),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN2(cexpf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN2(cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN2(vrc8_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN2(vrz4_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN2(vrca_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN2(vrza_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN2(vrca_cexpf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN2(vrza_cexp_soa),
         },
 
         [ALM_UARCH_VER_ZEN3] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_ZN3(cexpf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_ZN3(cexp),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN3(cexpf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN3(cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN3(vrc8_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN3(vrz4_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN3(vrca_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN3(vrza_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN3(vrca_cexpf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN3(vrza_cexp_soa),
         },
 
         [ALM_UARCH_VER_ZEN4] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_ZN4(cexpf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_ZN4(cexp),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN4(cexpf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN4(cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN4(vrc8_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN4(vrz4_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_16]  = &ALM_PROTO_ARCH_ZN4(vrc16_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN4(vrz8_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN4(vrca_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN4(vrza_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN4(vrca_cexpf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN4(vrza_cexp_soa),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_ZN5(cexpf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_ZN5(cexp),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN5(cexpf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN5(cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN5(vrc8_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN5(vrz4_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_16]  = &ALM_PROTO_ARCH_ZN5(vrc16_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN5(vrz8_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN5(vrca_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN5(vrza_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN5(vrca_cexpf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN5(vrza_cexp_soa),
         },
     },
 };
@@ -72,11 +114,18 @@ void
 LIBM_IFACE_PROTO(cexp)(void *arg) {
     alm_ep_wrapper_t g_entry_cexp = {
        .g_ep = {
-           [ALM_FUNC_SCAL_SP_CMPLX] = &G_ENTRY_PT_PTR(cexpf),
-           [ALM_FUNC_SCAL_DP_CMPLX] = &G_ENTRY_PT_PTR(cexp),
+           [ALM_FUNC_SCAL_SP_CMPLX]     = &G_ENTRY_PT_PTR(cexpf),
+           [ALM_FUNC_SCAL_DP_CMPLX]     = &G_ENTRY_PT_PTR(cexp),
+           [ALM_FUNC_VECT_SP_CMPLX_8]   = &G_ENTRY_PT_PTR(vrc8_cexpf),
+           [ALM_FUNC_VECT_DP_CMPLX_4]   = &G_ENTRY_PT_PTR(vrz4_cexp),
+           [ALM_FUNC_VECT_SP_CMPLX_16]  = &G_ENTRY_PT_PTR(vrc16_cexpf),
+           [ALM_FUNC_VECT_DP_CMPLX_8]   = &G_ENTRY_PT_PTR(vrz8_cexp),
+           [ALM_FUNC_VECT_SP_CMPLX_ARR] = &G_ENTRY_PT_PTR(vrca_cexpf),
+           [ALM_FUNC_VECT_DP_CMPLX_ARR] = &G_ENTRY_PT_PTR(vrza_cexp),
+           [ALM_FUNC_VECT_SP_CMPLX_SOA] = &G_ENTRY_PT_PTR(vrca_cexpf_soa),
+           [ALM_FUNC_VECT_DP_CMPLX_SOA] = &G_ENTRY_PT_PTR(vrza_cexp_soa),
         },
     };
 
     alm_iface_fixup(&g_entry_cexp, &__arch_funcs_cexp);
 }
-
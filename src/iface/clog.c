@@ -37,33 +37,75 @@ struct alm_arch_funcs __arch_funcs_clog = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
     .funcs = {
         [ALM_UARCH_VER_DEFAULT] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_AVX2(clogf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_AVX2(clog),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_AVX2(clogf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_AVX2(clog),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_AVX2(vrc8_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_AVX2(vrz4_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_16]  = &ALM_PROTO_ARCH_ZN4(vrc16_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN4(vrz8_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_AVX2(vrca_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_AVX2(vrza_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_AVX2(vrca_clogf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_AVX2(vrza_clog_soa),
         },
 
         [ALM_UARCH_VER_ZEN] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_ZN(clogf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_ZN(clog),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN(clogf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN(clog),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN(vrc8_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN(vrz4_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN(vrca_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN(vrza_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN(vrca_clogf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN(vrza_clog_soa),
         },
 
         [ALM_UARCH_VER_ZEN2] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_ZN2(clogf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_ZN2(clog),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN2(clogf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN2(clog),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN2(vrc8_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN2(vrz4_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN2(vrca_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN2(vrza_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN2(vrca_clogf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN2(vrza_clog_soa),
         },
 
         [ALM_UARCH_VER_ZEN3] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_ZN3(clogf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_ZN3(clog),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN3(clogf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN3(clog),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN3(vrc8_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN3(vrz4_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN3(vrca_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN3(vrza_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN3(vrca_clogf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN3(vrza_clog_soa),
         },
 
         [ALM_UARCH_VER_ZEN4] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_ZN4(clogf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_ZN4(clog),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN4(clogf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN4(clog),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN4(vrc8_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN4(vrz4_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_16]  = &ALM_PROTO_ARCH_ZN4(vrc16_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN4(vrz8_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN4(vrca_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN4(vrza_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN4(vrca_clogf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN4(vrza_clog_soa),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
-            [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_ZN5(clogf),
-            [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_ZN5(clog),
+            [ALM_FUNC_SCAL_SP_CMPLX]     = &ALM_PROTO_ARCH_ZN5(clogf),
+            [ALM_FUNC_SCAL_DP_CMPLX]     = &ALM_PROTO_ARCH_ZN5(clog),
+            [ALM_FUNC_VECT_SP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN5(vrc8_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_4]   = &ALM_PROTO_ARCH_ZN5(vrz4_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_16]  = &ALM_PROTO_ARCH_ZN5(vrc16_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_8]   = &ALM_PROTO_ARCH_ZN5(vrz8_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN5(vrca_clogf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN5(vrza_clog),
+            [ALM_FUNC_VECT_SP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN5(vrca_clogf_soa),
+            [ALM_FUNC_VECT_DP_CMPLX_SOA] = &ALM_PROTO_ARCH_ZN5(vrza_clog_soa),
         },
     },
 };
@@ -72,11 +114,18 @@ void
 LIBM_IFACE_PROTO(clog)(void *arg) {
     alm_ep_wrapper_t g_entry_clog = {
        .g_ep = {
-           [ALM_FUNC_SCAL_SP_CMPLX] = &G_ENTRY_PT_PTR(clogf),
-           [ALM_FUNC_SCAL_DP_CMPLX] = &G_ENTRY_PT_PTR(clog),
+           [ALM_FUNC_SCAL_SP_CMPLX]     = &G_ENTRY_PT_PTR(clogf),
+           [ALM_FUNC_SCAL_DP_CMPLX]     = &G_ENTRY_PT_PTR(clog),
+           [ALM_FUNC_VECT_SP_CMPLX_8]   = &G_ENTRY_PT_PTR(vrc8_clogf),
+           [ALM_FUNC_VECT_DP_CMPLX_4]   = &G_ENTRY_PT_PTR(vrz4_clog),
+           [ALM_FUNC_VECT_SP_CMPLX_16]  = &G_ENTRY_PT_PTR(vrc16_clogf),
+           [ALM_FUNC_VECT_DP_CMPLX_8]   = &G_ENTRY_PT_PTR(vrz8_clog),
+           [ALM_FUNC_VECT_SP_CMPLX_ARR] = &G_ENTRY_PT_PTR(vrca_clogf),
+           [ALM_FUNC_VECT_DP_CMPLX_ARR] = &G_ENTRY_PT_PTR(vrza_clog),
+           [ALM_FUNC_VECT_SP_CMPLX_SOA] = &G_ENTRY_PT_PTR(vrca_clogf_soa),
+           [ALM_FUNC_VECT_DP_CMPLX_SOA] = &G_ENTRY_PT_PTR(vrza_clog_soa),
         },
     };
 
     alm_iface_fixup(&g_entry_clog, &__arch_funcs_clog);
 }
-
@@ -45,6 +45,13 @@ struct alm_arch_funcs __arch_funcs_erf = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_AVX2(vrd4_erf),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_erff),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_erf),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_AVX2(erff16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_AVX2(vrh8_erff16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_AVX2(vrh16_erff16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_erff16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_erff16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_erfbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_erfbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN] = {
@@ -54,6 +61,12 @@ struct alm_arch_funcs __arch_funcs_erf = {
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN(vrs8_erff),
             [ALM_FUNC_VECT_DP_2] = &ALM_PROTO_ARCH_ZN(vrd2_erf),
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN(vrd4_erf),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN(erff16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN(vrh8_erff16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN(vrh16_erff16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN(vrha_erff16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN(vrba_erfbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN(vrba_erfbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN2] = {
@@ -63,6 +76,12 @@ struct alm_arch_funcs __arch_funcs_erf = {
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN2(vrs8_erff),
             [ALM_FUNC_VECT_DP_2] = &ALM_PROTO_ARCH_ZN2(vrd2_erf),
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN2(vrd4_erf),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN2(erff16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN2(vrh8_erff16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN2(vrh16_erff16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN2(vrha_erff16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN2(vrba_erfbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN2(vrba_erfbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN3] = {
@@ -72,6 +91,12 @@ struct alm_arch_funcs __arch_funcs_erf = {
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN3(vrs8_erff),
             [ALM_FUNC_VECT_DP_2] = &ALM_PROTO_ARCH_ZN3(vrd2_erf),
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN3(vrd4_erf),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN3(erff16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN3(vrh8_erff16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN3(vrh16_erff16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN3(vrha_erff16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN3(vrba_erfbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN3(vrba_erfbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN4] = {
@@ -83,6 +108,13 @@ struct alm_arch_funcs __arch_funcs_erf = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN4(vrd4_erf),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_erff),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_erf),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN4(erff16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN4(vrh8_erff16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN4(vrh16_erff16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_erff16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_erff16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_erfbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_erfbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -94,6 +126,13 @@ struct alm_arch_funcs __arch_funcs_erf = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN5(vrd4_erf),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN5(vrs16_erff),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_erf),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN5(erff16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN5(vrh8_erff16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN5(vrh16_erff16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN5(vrh32_erff16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN5(vrha_erff16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN5(vrba_erfbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN5(vrba_erfbf16_f32),
         },
     },
 };
@@ -111,6 +150,13 @@ LIBM_IFACE_PROTO(erf)(void *arg)
         [ALM_FUNC_VECT_DP_4] = &G_ENTRY_PT_PTR(vrd4_erf),
         [ALM_FUNC_VECT_SP_16] = &G_ENTRY_PT_PTR(vrs16_erff),
         [ALM_FUNC_VECT_DP_8] = &G_ENTRY_PT_PTR(vrd8_erf),
+        [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(erff16),
+        [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_erff16),
+        [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_erff16),
+        [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_erff16),
+        [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_erff16),
+        [ALM_FUNC_VECT_BF16_ARR] = &G_ENTRY_PT_PTR(vrba_erfbf16),
+        [ALM_FUNC_VECT_BF16_F32_ARR] = &G_ENTRY_PT_PTR(vrba_erfbf16_f32),
         },
     };
 
@@ -47,6 +47,13 @@ struct alm_arch_funcs __arch_funcs_exp = {
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_exp),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_expf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_exp),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_AVX2(expf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_AVX2(vrh8_expf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_AVX2(vrh16_expf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_expf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_expf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_expbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_expbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN] = {
@@ -58,6 +65,12 @@ struct alm_arch_funcs __arch_funcs_exp = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN(vrd4_exp),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN(vrsa_expf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN(vrda_exp),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN(expf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN(vrh8_expf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN(vrh16_expf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN(vrha_expf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN(vrba_expbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN(vrba_expbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN2] = {
@@ -69,6 +82,12 @@ struct alm_arch_funcs __arch_funcs_exp = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN2(vrd4_exp),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN2(vrsa_expf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN2(vrda_exp),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN2(expf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN2(vrh8_expf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN2(vrh16_expf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN2(vrha_expf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN2(vrba_expbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN2(vrba_expbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN3] = {
@@ -80,6 +99,12 @@ struct alm_arch_funcs __arch_funcs_exp = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN3(vrd4_exp),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN3(vrsa_expf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN3(vrda_exp),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN3(expf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN3(vrh8_expf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN3(vrh16_expf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN3(vrha_expf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN3(vrba_expbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN3(vrba_expbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN4] = {
@@ -93,6 +118,13 @@ struct alm_arch_funcs __arch_funcs_exp = {
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_exp),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_expf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_exp),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN4(expf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN4(vrh8_expf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN4(vrh16_expf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_expf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_expf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_expbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_expbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -106,6 +138,13 @@ struct alm_arch_funcs __arch_funcs_exp = {
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN5(vrda_exp),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN5(vrs16_expf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_exp),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN5(expf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN5(vrh8_expf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN5(vrh16_expf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN5(vrh32_expf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN5(vrha_expf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN5(vrba_expbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN5(vrba_expbf16_f32),
         },
     },
 };
@@ -124,6 +163,13 @@ LIBM_IFACE_PROTO(exp)(void *arg) {
         [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_exp),
         [ALM_FUNC_VECT_SP_16]  = &G_ENTRY_PT_PTR(vrs16_expf),
         [ALM_FUNC_VECT_DP_8] = &G_ENTRY_PT_PTR(vrd8_exp),
+        [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(expf16),
+        [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_expf16),
+        [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_expf16),
+        [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_expf16),
+        [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_expf16),
+        [ALM_FUNC_VECT_BF16_ARR] = &G_ENTRY_PT_PTR(vrba_expbf16),
+        [ALM_FUNC_VECT_BF16_F32_ARR] = &G_ENTRY_PT_PTR(vrba_expbf16_f32),
         },
     };
 
@@ -33,30 +33,61 @@
 //
 #include <libm/arch/all.h>
 
-
 static const
 struct alm_arch_funcs __arch_funcs_frexp = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
     .funcs = {
         [ALM_UARCH_VER_DEFAULT] = {
-            &ALM_PROTO_REF(frexpf),
-            &ALM_PROTO_REF(frexp),
-            NULL,                           /* vrs4 ? */
-            NULL,                           /* vrs8 ? */
-            NULL,                           /* vrd2 ? */
-            NULL,                           /* vrd4 ? */
+            [ALM_FUNC_SCAL_SP] = &ALM_PROTO_REF(frexpf),
+            [ALM_FUNC_SCAL_DP] = &ALM_PROTO_REF(frexp),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_AVX2(vrs8_frexpf),
+            [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_frexpf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_AVX2(vrd4_frexp),
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_frexp),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_frexpf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_frexp),
         },
-#if 0
+
         [ALM_UARCH_VER_ZEN] = {
-            &ALM_PROTO_FMA3(frexpf),
-            &ALM_PROTO_FMA3(frexp),
-            NULL,                           /* vrs4 ? */
-            NULL,                           /* vrs8 ? */
-            NULL,                           /* vrd2 ? */
-            NULL,                           /* vrd4 ? */
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN(vrs8_frexpf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN(vrd4_frexp),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN(vrsa_frexpf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN(vrda_frexp),
+        },
+
+        [ALM_UARCH_VER_ZEN2] = {
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN2(vrs8_frexpf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN2(vrd4_frexp),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN2(vrsa_frexpf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN2(vrda_frexp),
+        },
+
+        [ALM_UARCH_VER_ZEN3] = {
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN3(vrs8_frexpf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN3(vrd4_frexp),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN3(vrsa_frexpf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN3(vrda_frexp),
         },
-#endif
-    }
+
+        [ALM_UARCH_VER_ZEN4] = {
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN4(vrs8_frexpf),
+            [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_frexpf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN4(vrd4_frexp),
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_frexp),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN4(vrsa_frexpf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_frexp),
+        },
+
+        [ALM_UARCH_VER_ZEN5] = {
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN5(vrs8_frexpf),
+            [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN5(vrs16_frexpf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN5(vrd4_frexp),
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_frexp),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN5(vrsa_frexpf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN5(vrda_frexp),
+        },
+
+    },
 };
 
 void
@@ -64,17 +95,16 @@ LIBM_IFACE_PROTO(frexp)(void *arg)
 {
     alm_ep_wrapper_t g_entry_frexp = {
        .g_ep = {
-        [ALM_FUNC_SCAL_SP]   = &G_ENTRY_PT_PTR(frexpf),
-        [ALM_FUNC_SCAL_DP]   = &G_ENTRY_PT_PTR(frexp),
-#if 0
-        [ALM_FUNC_VECT_SP_4] = &G_ENTRY_PT_PTR(vrs4_frexpf),
-        [ALM_FUNC_VECT_SP_8] = &G_ENTRY_PT_PTR(vrs8_frexpf),
-        [ALM_FUNC_VECT_DP_2] = &G_ENTRY_PT_PTR(vrd2_frexp),
-        [ALM_FUNC_VECT_DP_4] = &G_ENTRY_PT_PTR(vrd4_frexp),
-#endif
+            [ALM_FUNC_SCAL_SP]     = &G_ENTRY_PT_PTR(frexpf),
+            [ALM_FUNC_SCAL_DP]     = &G_ENTRY_PT_PTR(frexp),
+            [ALM_FUNC_VECT_SP_8]   = &G_ENTRY_PT_PTR(vrs8_frexpf),
+            [ALM_FUNC_VECT_SP_16]  = &G_ENTRY_PT_PTR(vrs16_frexpf),
+            [ALM_FUNC_VECT_DP_4]   = &G_ENTRY_PT_PTR(vrd4_frexp),
+            [ALM_FUNC_VECT_DP_8]   = &G_ENTRY_PT_PTR(vrd8_frexp),
+            [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_frexpf),
+            [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_frexp),
         },
     };
 
     alm_iface_fixup(&g_entry_frexp, &__arch_funcs_frexp);
 }
-
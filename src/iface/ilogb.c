@@ -39,44 +39,81 @@ struct alm_arch_funcs __arch_funcs_ilogb = {
         [ALM_UARCH_VER_DEFAULT] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_AVX2(ilogbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_AVX2(ilogb),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_AVX2(vrs8_ilogbf),
+            [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_ilogbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_AVX2(vrd4_ilogb),
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_ilogb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_ilogbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_ilogb),
         },
 
         [ALM_UARCH_VER_ZEN] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_ZN(ilogbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN(ilogb),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN(vrs8_ilogbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN(vrd4_ilogb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN(vrsa_ilogbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN(vrda_ilogb),
         },
 
         [ALM_UARCH_VER_ZEN2] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_ZN2(ilogbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN2(ilogb),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN2(vrs8_ilogbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN2(vrd4_ilogb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN2(vrsa_ilogbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN2(vrda_ilogb),
         },
 
         [ALM_UARCH_VER_ZEN3] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_ZN3(ilogbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN3(ilogb),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN3(vrs8_ilogbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN3(vrd4_ilogb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN3(vrsa_ilogbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN3(vrda_ilogb),
         },
 
         [ALM_UARCH_VER_ZEN4] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_ZN4(ilogbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN4(ilogb),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN4(vrs8_ilogbf),
+            [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_ilogbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN4(vrd4_ilogb),
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_ilogb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN4(vrsa_ilogbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_ilogb),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_ZN5(ilogbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN5(ilogb),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN5(vrs8_ilogbf),
+            [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN5(vrs16_ilogbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN5(vrd4_ilogb),
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_ilogb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN5(vrsa_ilogbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN5(vrda_ilogb),
         },
+
     },
 };
 
 void
-LIBM_IFACE_PROTO(ilogb)(void *arg) {
+LIBM_IFACE_PROTO(ilogb)(void *arg)
+{
     alm_ep_wrapper_t g_entry_ilogb = {
        .g_ep = {
-            [ALM_FUNC_SCAL_SP]   = &G_ENTRY_PT_PTR(ilogbf),
-            [ALM_FUNC_SCAL_DP]   = &G_ENTRY_PT_PTR(ilogb),
+            [ALM_FUNC_SCAL_SP]     = &G_ENTRY_PT_PTR(ilogbf),
+            [ALM_FUNC_SCAL_DP]     = &G_ENTRY_PT_PTR(ilogb),
+            [ALM_FUNC_VECT_SP_8]   = &G_ENTRY_PT_PTR(vrs8_ilogbf),
+            [ALM_FUNC_VECT_SP_16]  = &G_ENTRY_PT_PTR(vrs16_ilogbf),
+            [ALM_FUNC_VECT_DP_4]   = &G_ENTRY_PT_PTR(vrd4_ilogb),
+            [ALM_FUNC_VECT_DP_8]   = &G_ENTRY_PT_PTR(vrd8_ilogb),
+            [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_ilogbf),
+            [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_ilogb),
         },
     };
 
     alm_iface_fixup(&g_entry_ilogb, &__arch_funcs_ilogb);
 }
-
@@ -48,7 +48,14 @@ struct alm_arch_funcs __arch_funcs_log = {
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_logf),  /*vector array variants*/
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_log),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_logf),
-            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_log)
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_log),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_AVX2(logf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_AVX2(vrh8_logf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_AVX2(vrh16_logf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_logf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_logf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_logbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_logbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN] = {
@@ -60,6 +67,12 @@ struct alm_arch_funcs __arch_funcs_log = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN(vrd4_log),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN(vrsa_logf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN(vrda_log),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN(logf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN(vrh8_logf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN(vrh16_logf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN(vrha_logf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN(vrba_logbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN(vrba_logbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN2] = {
@@ -71,6 +84,12 @@ struct alm_arch_funcs __arch_funcs_log = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN2(vrd4_log),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN2(vrsa_logf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN2(vrda_log),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN2(logf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN2(vrh8_logf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN2(vrh16_logf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN2(vrha_logf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN2(vrba_logbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN2(vrba_logbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN3] = {
@@ -82,6 +101,12 @@ struct alm_arch_funcs __arch_funcs_log = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN3(vrd4_log),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN3(vrsa_logf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN3(vrda_log),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN3(logf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN3(vrh8_logf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN3(vrh16_logf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN3(vrha_logf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN3(vrba_logbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN3(vrba_logbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN4] = {
@@ -96,6 +121,13 @@ struct alm_arch_funcs __arch_funcs_log = {
 
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_logf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_log),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN4(logf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN4(vrh8_logf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN4(vrh16_logf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_logf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_logf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_logbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_logbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -110,6 +142,13 @@ struct alm_arch_funcs __arch_funcs_log = {
 
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN5(vrs16_logf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_log),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN5(logf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN5(vrh8_logf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN5(vrh16_logf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN5(vrh32_logf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN5(vrha_logf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN5(vrba_logbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN5(vrba_logbf16_f32),
         },
     },
 };
@@ -128,6 +167,13 @@ LIBM_IFACE_PROTO(log)(void *arg) {
             [ALM_FUNC_VECT_DP_8] = &G_ENTRY_PT_PTR(vrd8_log),
             [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_logf),
             [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_log),
+            [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(logf16),
+            [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_logf16),
+            [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_logf16),
+            [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_logf16),
+            [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_logf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &G_ENTRY_PT_PTR(vrba_logbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &G_ENTRY_PT_PTR(vrba_logbf16_f32),
         },
     };
 
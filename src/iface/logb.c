@@ -31,7 +31,6 @@
 #include <libm/entry_pt.h>
 #include <libm/arch/all.h>
 
-
 static const
 struct alm_arch_funcs __arch_funcs_logb = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
@@ -39,35 +38,61 @@ struct alm_arch_funcs __arch_funcs_logb = {
         [ALM_UARCH_VER_DEFAULT] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_AVX2(logbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_AVX2(logb),
-            NULL,                           /* vrs4 ? */
-            NULL,                           /* vrs8 ? */
-            NULL,                           /* vrd2 ? */
-            NULL,                           /* vrd4 ? */
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_AVX2(vrs8_logbf),
+            [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_logbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_AVX2(vrd4_logb),
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_logb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_logbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_logb),
         },
 
         [ALM_UARCH_VER_ZEN] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_ZN(logbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN(logb),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN(vrs8_logbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN(vrd4_logb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN(vrsa_logbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN(vrda_logb),
         },
 
         [ALM_UARCH_VER_ZEN2] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_ZN2(logbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN2(logb),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN2(vrs8_logbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN2(vrd4_logb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN2(vrsa_logbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN2(vrda_logb),
         },
 
         [ALM_UARCH_VER_ZEN3] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_ZN3(logbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN3(logb),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN3(vrs8_logbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN3(vrd4_logb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN3(vrsa_logbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN3(vrda_logb),
         },
 
         [ALM_UARCH_VER_ZEN4] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_ZN4(logbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN4(logb),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN4(vrs8_logbf),
+            [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_logbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN4(vrd4_logb),
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_logb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN4(vrsa_logbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_logb),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_ARCH_ZN5(logbf),
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN5(logb),
+            [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN5(vrs8_logbf),
+            [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN5(vrs16_logbf),
+            [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN5(vrd4_logb),
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_logb),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN5(vrsa_logbf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN5(vrda_logb),
         },
 
     },
@@ -78,11 +103,16 @@ LIBM_IFACE_PROTO(logb)(void *arg)
 {
     alm_ep_wrapper_t g_entry_logb = {
        .g_ep = {
-        [ALM_FUNC_SCAL_SP]   = &G_ENTRY_PT_PTR(logbf),
-        [ALM_FUNC_SCAL_DP]   = &G_ENTRY_PT_PTR(logb),
+            [ALM_FUNC_SCAL_SP]     = &G_ENTRY_PT_PTR(logbf),
+            [ALM_FUNC_SCAL_DP]     = &G_ENTRY_PT_PTR(logb),
+            [ALM_FUNC_VECT_SP_8]   = &G_ENTRY_PT_PTR(vrs8_logbf),
+            [ALM_FUNC_VECT_SP_16]  = &G_ENTRY_PT_PTR(vrs16_logbf),
+            [ALM_FUNC_VECT_DP_4]   = &G_ENTRY_PT_PTR(vrd4_logb),
+            [ALM_FUNC_VECT_DP_8]   = &G_ENTRY_PT_PTR(vrd8_logb),
+            [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_logbf),
+            [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_logb),
         },
     };
 
     alm_iface_fixup(&g_entry_logb, &__arch_funcs_logb);
 }
-
@@ -48,7 +48,12 @@ struct alm_arch_funcs __arch_funcs_pow = {
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_powf),  /*vector array variants*/
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_pow),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_powf),
-            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_pow)
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_pow),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_AVX2(powf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_AVX2(vrh8_powf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_AVX2(vrh16_powf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_powf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_powf16),
         },
 
         [ALM_UARCH_VER_ZEN] = {
@@ -60,6 +65,10 @@ struct alm_arch_funcs __arch_funcs_pow = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN(vrd4_pow),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN(vrsa_powf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN(vrda_pow),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN(powf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN(vrh8_powf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN(vrh16_powf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN(vrha_powf16),
         },
 
         [ALM_UARCH_VER_ZEN2] = {
@@ -71,6 +80,10 @@ struct alm_arch_funcs __arch_funcs_pow = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN2(vrd4_pow),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN2(vrsa_powf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN2(vrda_pow),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN2(powf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN2(vrh8_powf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN2(vrh16_powf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN2(vrha_powf16),
         },
 
         [ALM_UARCH_VER_ZEN3] = {
@@ -82,6 +95,10 @@ struct alm_arch_funcs __arch_funcs_pow = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN3(vrd4_pow),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN3(vrsa_powf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN3(vrda_pow),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN3(powf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN3(vrh8_powf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN3(vrh16_powf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN3(vrha_powf16),
         },
 
         [ALM_UARCH_VER_ZEN4] = {
@@ -96,6 +113,11 @@ struct alm_arch_funcs __arch_funcs_pow = {
 
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_powf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_pow),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN4(powf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN4(vrh8_powf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN4(vrh16_powf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_powf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_powf16),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -110,6 +132,11 @@ struct alm_arch_funcs __arch_funcs_pow = {
 
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN5(vrs16_powf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_pow),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN5(powf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN5(vrh8_powf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN5(vrh16_powf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN5(vrh32_powf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN5(vrha_powf16),
         },
     },
 };
@@ -128,6 +155,11 @@ LIBM_IFACE_PROTO(pow)(void *arg) {
             [ALM_FUNC_VECT_DP_8] = &G_ENTRY_PT_PTR(vrd8_pow),
             [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_powf),
             [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_pow),
+            [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(powf16),
+            [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_powf16),
+            [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_powf16),
+            [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_powf16),
+            [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_powf16),
         },
     };
 
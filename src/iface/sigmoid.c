@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/iface.h>
+#include <libm/entry_pt.h>
+#include <libm/arch/all.h>
+
+
+static const
+struct alm_arch_funcs __arch_funcs_sigmoid = {
+    .def_arch = ALM_UARCH_VER_DEFAULT,
+    .funcs = {
+        [ALM_UARCH_VER_DEFAULT] = {
+            [ALM_FUNC_VECT_SP_ARR]       = &ALM_PROTO_ARCH_AVX2(vrsa_sigmoidf),
+            [ALM_FUNC_VECT_BF16_ARR]     = &ALM_PROTO_ARCH_AVX2(vrba_sigmoidbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_sigmoidbf16_f32),
+        },
+
+        [ALM_UARCH_VER_ZEN] = {
+            [ALM_FUNC_VECT_SP_ARR]       = &ALM_PROTO_ARCH_ZN(vrsa_sigmoidf),
+            [ALM_FUNC_VECT_BF16_ARR]     = &ALM_PROTO_ARCH_ZN(vrba_sigmoidbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN(vrba_sigmoidbf16_f32),
+        },
+
+        [ALM_UARCH_VER_ZEN2] = {
+            [ALM_FUNC_VECT_SP_ARR]       = &ALM_PROTO_ARCH_ZN2(vrsa_sigmoidf),
+            [ALM_FUNC_VECT_BF16_ARR]     = &ALM_PROTO_ARCH_ZN2(vrba_sigmoidbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN2(vrba_sigmoidbf16_f32),
+        },
+
+        [ALM_UARCH_VER_ZEN3] = {
+            [ALM_FUNC_VECT_SP_ARR]       = &ALM_PROTO_ARCH_ZN3(vrsa_sigmoidf),
+            [ALM_FUNC_VECT_BF16_ARR]     = &ALM_PROTO_ARCH_ZN3(vrba_sigmoidbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN3(vrba_sigmoidbf16_f32),
+        },
+
+        [ALM_UARCH_VER_ZEN4] = {
+            [ALM_FUNC_VECT_SP_ARR]       = &ALM_PROTO_ARCH_ZN4(vrsa_sigmoidf),
+            [ALM_FUNC_VECT_BF16_ARR]     = &ALM_PROTO_ARCH_ZN4(vrba_sigmoidbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_sigmoidbf16_f32),
+        },
+
+        [ALM_UARCH_VER_ZEN5] = {
+            [ALM_FUNC_VECT_SP_ARR]       = &ALM_PROTO_ARCH_ZN5(vrsa_sigmoidf),
+            [ALM_FUNC_VECT_BF16_ARR]     = &ALM_PROTO_ARCH_ZN5(vrba_sigmoidbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN5(vrba_sigmoidbf16_f32),
+        },
+    },
+};
+
+void
+LIBM_IFACE_PROTO(sigmoid)(void *arg) {
+    alm_ep_wrapper_t g_entry_sigmoid = {
+       .g_ep = {
+           [ALM_FUNC_VECT_SP_ARR]       = &G_ENTRY_PT_PTR(vrsa_sigmoidf),
+           [ALM_FUNC_VECT_BF16_ARR]     = &G_ENTRY_PT_PTR(vrba_sigmoidbf16),
+           [ALM_FUNC_VECT_BF16_F32_ARR] = &G_ENTRY_PT_PTR(vrba_sigmoidbf16_f32),
+        },
+    };
+
+    alm_iface_fixup(&g_entry_sigmoid, &__arch_funcs_sigmoid);
+}
@@ -48,7 +48,12 @@ struct alm_arch_funcs __arch_funcs_sin = {
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_sinf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_sin),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_sinf),
-            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_sin)
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_sin),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_AVX2(sinf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_AVX2(vrh8_sinf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_AVX2(vrh16_sinf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_sinf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_sinf16),
         },
 
         [ALM_UARCH_VER_ZEN] = {
@@ -60,6 +65,10 @@ struct alm_arch_funcs __arch_funcs_sin = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN(vrd4_sin),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN(vrsa_sinf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN(vrda_sin),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN(sinf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN(vrh8_sinf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN(vrh16_sinf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN(vrha_sinf16),
         },
 
         [ALM_UARCH_VER_ZEN2] = {
@@ -71,6 +80,10 @@ struct alm_arch_funcs __arch_funcs_sin = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN2(vrd4_sin),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN2(vrsa_sinf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN2(vrda_sin),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN2(sinf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN2(vrh8_sinf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN2(vrh16_sinf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN2(vrha_sinf16),
         },
 
         [ALM_UARCH_VER_ZEN3] = {
@@ -82,6 +95,10 @@ struct alm_arch_funcs __arch_funcs_sin = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN3(vrd4_sin),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN3(vrsa_sinf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN3(vrda_sin),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN3(sinf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN3(vrh8_sinf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN3(vrh16_sinf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN3(vrha_sinf16),
         },
 
         [ALM_UARCH_VER_ZEN4] = {
@@ -96,6 +113,11 @@ struct alm_arch_funcs __arch_funcs_sin = {
 
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_sinf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_sin),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN4(sinf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN4(vrh8_sinf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN4(vrh16_sinf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_sinf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_sinf16),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -110,6 +132,11 @@ struct alm_arch_funcs __arch_funcs_sin = {
 
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN5(vrs16_sinf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_sin),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN5(sinf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN5(vrh8_sinf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN5(vrh16_sinf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN5(vrh32_sinf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN5(vrha_sinf16),
         },
 
     },
@@ -129,6 +156,11 @@ LIBM_IFACE_PROTO(sin)(void *arg) {
             [ALM_FUNC_VECT_DP_8] = &G_ENTRY_PT_PTR(vrd8_sin),
             [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_sinf),
             [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_sin),
+            [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(sinf16),
+            [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_sinf16),
+            [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_sinf16),
+            [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_sinf16),
+            [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_sinf16),
         },
     };
 
@@ -48,6 +48,11 @@ struct alm_arch_funcs __arch_funcs_sqrt = {
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_sqrtf),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_sqrtf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_sqrt),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_AVX2(sqrtf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_AVX2(vrh8_sqrtf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_AVX2(vrh16_sqrtf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_sqrtf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_sqrtf16),
         },
         [ALM_UARCH_VER_ZEN] = {
             [ALM_FUNC_SCAL_SP] = &ALM_PROTO_OPT(sqrtf),
@@ -58,6 +63,10 @@ struct alm_arch_funcs __arch_funcs_sqrt = {
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN(vrs8_sqrtf),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN(vrsa_sqrtf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN(vrda_sqrt),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN(sqrtf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN(vrh8_sqrtf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN(vrh16_sqrtf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN(vrha_sqrtf16),
         },
 
         [ALM_UARCH_VER_ZEN2] = {
@@ -69,6 +78,10 @@ struct alm_arch_funcs __arch_funcs_sqrt = {
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN2(vrs8_sqrtf),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN2(vrsa_sqrtf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN2(vrda_sqrt),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN2(sqrtf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN2(vrh8_sqrtf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN2(vrh16_sqrtf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN2(vrha_sqrtf16),
         },
 
         [ALM_UARCH_VER_ZEN3] = {
@@ -80,6 +93,10 @@ struct alm_arch_funcs __arch_funcs_sqrt = {
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN3(vrs8_sqrtf),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN3(vrsa_sqrtf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN3(vrda_sqrt),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN3(sqrtf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN3(vrh8_sqrtf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN3(vrh16_sqrtf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN3(vrha_sqrtf16),
         },
 
         [ALM_UARCH_VER_ZEN4] = {
@@ -93,6 +110,11 @@ struct alm_arch_funcs __arch_funcs_sqrt = {
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_sqrtf),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN4(vrsa_sqrtf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_sqrt),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN4(sqrtf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN4(vrh8_sqrtf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN4(vrh16_sqrtf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_sqrtf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_sqrtf16),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -106,6 +128,11 @@ struct alm_arch_funcs __arch_funcs_sqrt = {
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN5(vrs16_sqrtf),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN5(vrsa_sqrtf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN5(vrda_sqrt),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN5(sqrtf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN5(vrh8_sqrtf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN5(vrh16_sqrtf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN5(vrh32_sqrtf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN5(vrha_sqrtf16),
         },
     },
 };
@@ -124,6 +151,11 @@ LIBM_IFACE_PROTO(sqrt)(void *arg) {
             [ALM_FUNC_VECT_SP_16] = &G_ENTRY_PT_PTR(vrs16_sqrtf),
             [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_sqrtf),
             [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_sqrt),
+            [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(sqrtf16),
+            [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_sqrtf16),
+            [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_sqrtf16),
+            [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_sqrtf16),
+            [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_sqrtf16),
         },
     };
 
@@ -44,6 +44,13 @@ struct alm_arch_funcs __arch_funcs_tanh = {
             [ALM_FUNC_VECT_SP_4] = &ALM_PROTO_ARCH_AVX2(vrs4_tanhf), /* v4s */
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_AVX2(vrs8_tanhf), /* v8s ? */
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_tanhf), /* v16s */
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_AVX2(tanhf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_AVX2(vrh8_tanhf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_AVX2(vrh16_tanhf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_tanhf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_tanhf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_tanhbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_tanhbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN] = {
@@ -51,6 +58,12 @@ struct alm_arch_funcs __arch_funcs_tanh = {
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN(tanh),
             [ALM_FUNC_VECT_SP_4] = &ALM_PROTO_ARCH_ZN(vrs4_tanhf),
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN(vrs8_tanhf),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN(tanhf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN(vrh8_tanhf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN(vrh16_tanhf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN(vrha_tanhf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN(vrba_tanhbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN(vrba_tanhbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN2] = {
@@ -58,6 +71,12 @@ struct alm_arch_funcs __arch_funcs_tanh = {
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN2(tanh),
             [ALM_FUNC_VECT_SP_4] = &ALM_PROTO_ARCH_ZN2(vrs4_tanhf),
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN2(vrs8_tanhf),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN2(tanhf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN2(vrh8_tanhf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN2(vrh16_tanhf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN2(vrha_tanhf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN2(vrba_tanhbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN2(vrba_tanhbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN3] = {
@@ -65,6 +84,12 @@ struct alm_arch_funcs __arch_funcs_tanh = {
             [ALM_FUNC_SCAL_DP] = &ALM_PROTO_ARCH_ZN3(tanh),
             [ALM_FUNC_VECT_SP_4] = &ALM_PROTO_ARCH_ZN3(vrs4_tanhf),
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN3(vrs8_tanhf),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN3(tanhf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN3(vrh8_tanhf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN3(vrh16_tanhf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN3(vrha_tanhf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN3(vrba_tanhbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN3(vrba_tanhbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN4] = {
@@ -73,6 +98,13 @@ struct alm_arch_funcs __arch_funcs_tanh = {
             [ALM_FUNC_VECT_SP_4] = &ALM_PROTO_ARCH_ZN4(vrs4_tanhf),
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN4(vrs8_tanhf),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_tanhf),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN4(tanhf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN4(vrh8_tanhf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN4(vrh16_tanhf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN4(vrh32_tanhf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_tanhf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_tanhbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_tanhbf16_f32),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -81,6 +113,13 @@ struct alm_arch_funcs __arch_funcs_tanh = {
             [ALM_FUNC_VECT_SP_4] = &ALM_PROTO_ARCH_ZN5(vrs4_tanhf),
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN5(vrs8_tanhf),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN5(vrs16_tanhf),
+            [ALM_FUNC_SCAL_HP] = &ALM_PROTO_ARCH_ZN5(tanhf16),
+            [ALM_FUNC_VECT_HP_8] = &ALM_PROTO_ARCH_ZN5(vrh8_tanhf16),
+            [ALM_FUNC_VECT_HP_16] = &ALM_PROTO_ARCH_ZN5(vrh16_tanhf16),
+            [ALM_FUNC_VECT_HP_32] = &ALM_PROTO_ARCH_ZN5(vrh32_tanhf16),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN5(vrha_tanhf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN5(vrba_tanhbf16),
+            [ALM_FUNC_VECT_BF16_F32_ARR] = &ALM_PROTO_ARCH_ZN5(vrba_tanhbf16_f32),
         },
 
     },
@@ -95,6 +134,13 @@ LIBM_IFACE_PROTO(tanh)(void *arg) {
           [ALM_FUNC_VECT_SP_4] = &G_ENTRY_PT_PTR(vrs4_tanhf),
           [ALM_FUNC_VECT_SP_8] = &G_ENTRY_PT_PTR(vrs8_tanhf),
           [ALM_FUNC_VECT_SP_16] = &G_ENTRY_PT_PTR(vrs16_tanhf),
+          [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(tanhf16),
+          [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_tanhf16),
+          [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_tanhf16),
+          [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_tanhf16),
+          [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_tanhf16),
+          [ALM_FUNC_VECT_BF16_ARR] = &G_ENTRY_PT_PTR(vrba_tanhbf16),
+          [ALM_FUNC_VECT_BF16_F32_ARR] = &G_ENTRY_PT_PTR(vrba_tanhbf16_f32),
         },
     };
 
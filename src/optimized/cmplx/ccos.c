@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Implementation Notes
+ * --------------------
+ * Signature:
+ *   double complex ccos(double complex x)
+ *
+ *   Let x = a + I*b
+ *
+ *   cos(x) = cos(a)*cosh(b) - I*sin(a)*sinh(b)
+ *
+ *   If cosh(b) overflows, exp(|b|/2) is applied twice so that results
+ *   which are still representable are not lost.
+ *
+ *   ccos(+-0 + I*b) = cosh(b) -+ I*0, sign of zero is -(sign(a)*sign(b))
+ *   ccos(a +- I*0)  = nan +- I*0, for a inf or nan
+ *   ccos(a +- I*inf) = inf + I*nan, for a inf or nan
+ *
+ */
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+#include <libm/constants.h>
+#include <libm/typehelper.h>
+#if defined(__clang__)
+#define CMPLX(X, Y) __builtin_complex ((double) (X), (double) (Y))
+#endif
+
+fc64_t
+ALM_PROTO_OPT(ccos)(fc64_t z)
+{
+    double re, im, s, c;
+    double zy_re, zy_im;
+    const double MAX_ARG = 0x1.62e42fefa39efp+9;
+
+    re = creal(z);
+    im = cimag(z);
+
+    ALM_PROTO(sincos)(re, &s, &c);
+
+    if (asdouble(asuint64(im) & ~ALM_F64_SIGN_MASK) > MAX_ARG) {
+        double eh = ALM_PROTO(exp)(0.5 * asdouble(asuint64(im) & ~ALM_F64_SIGN_MASK));
+        zy_re = (0.5 * c * eh) * eh;
+        zy_im = -((0.5 * s * (im < 0 ? -eh : eh)) * eh);
+    }
+    else {
+        zy_re = c * ALM_PROTO(cosh)(im);
+        zy_im = -(s * ALM_PROTO(sinh)(im));
+    }
+
+    if ((asuint64(re) & ~ALM_F64_SIGN_MASK) == 0)
+        zy_im = asdouble(((asuint64(re) ^ asuint64(im)) & ALM_F64_SIGN_MASK) ^ ALM_F64_SIGN_MASK);
+
+    /* re is inf or nan, im is retained if +/-0, real part is +inf if im is +/-inf */
+    if ((asuint64(re) & ~ALM_F64_SIGN_MASK) >= ALM_F64_EXPO_MASK) {
+        if ((asuint64(im) & ~ALM_F64_SIGN_MASK) == 0)
+            zy_im = im;
+        else if ((asuint64(im) & ~ALM_F64_SIGN_MASK) == ALM_F64_EXPO_MASK)
+            zy_re = asdouble(asuint64(im) & ~ALM_F64_SIGN_MASK);
+    }
+
+    #if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
+        return (fc64_t) { zy_re, zy_im };
+    #else
+        return CMPLX(zy_re, zy_im);
+    #endif
+}
@@ -30,7 +30,8 @@
  * Signature:
  *   double complex clog(double complex x)
  *
- *   High ULP errors for values where absolute value of the complex input is close to 1.
+ *   Close to |x| = 1, log(r) is evaluated as 0.5 * log1p(a*a + b*b - 1), with
+ *   a*a + b*b - 1 summed exactly from the squares and their fma rounding errors.
  *
  *   IEEE SPEC:
  *
@@ -74,44 +75,58 @@
 fc64_t
 ALM_PROTO_OPT(clog)(fc64_t x) {
 
-    double theta, p, a, b, ah, al, bh, bl;
+    double theta, p, a, b, k;
 
-    double asquare, bsquare, abs_h, abs_t;
+    double asquare, bsquare, ea, eb, abs_h, s1, s2, e1, e2, v;
 
     a = creal(x);
 
     b = cimag(x);
 
-    if(a < b) {
-
-        double t = a;
-        a = b;
-        b = t;
+    /* scale by a power of two so that a * a + b * b neither overflows nor underflows */
+    k = 0.0;
 
+    if (fmax(fabs(a), fabs(b)) > 0x1p500) {
+        a *= 0x1p-600;
+        b *= 0x1p-600;
+        k = 600.0;
+    }
+    else if (fmax(fabs(a), fabs(b)) < 0x1p-500) {
+        a *= 0x1p600;
+        b *= 0x1p600;
+        k = -600.0;
     }
 
-    /*FIRST split a and b */
-
-    ah = asdouble(asuint64(a) & 0xfffffffff8000000UL);
-
-    al = a - ah;
-
-    bh = asdouble(asuint64(b) & 0xfffffffff8000000UL);
-
-    bl = b - bh;
-
-    /*compute a * a + b * b using high precision two double word numbers */
+    /* the squares and their rounding errors, fma keeps the errors exact under contraction */
 
     asquare = a * a;
 
     bsquare = b * b;
 
+    ea = fma(a, a, -asquare);
+
+    eb = fma(b, b, -bsquare);
+
     abs_h = asquare + bsquare;
 
-    abs_t = (((asquare - abs_h) + bsquare) + ((ah * ah - asquare) + 2 * ah * al) + al * al) +
-            ((bh * bh - bsquare) + 2 * bh * bl) + bl * bl;
+    if (abs_h > 0.5 && abs_h < 2.0) {
+        /* close to |x| = 1, a * a + b * b - 1 is summed exactly for log1p */
+        s1 = asquare - 1.0;
+        v  = s1 - asquare;
+        e1 = (asquare - (s1 - v)) + (-1.0 - v);
+        s2 = s1 + bsquare;
+        v  = s2 - s1;
+        e2 = (s1 - (s2 - v)) + (bsquare - v);
+
+        p = 0.5 * log1p(s2 + ((e1 + e2) + (ea + eb)));
+    }
+    else {
+        p = 0.5 * log(abs_h + (ea + eb)) + k * 0x1.62e42fefa39efp-1;
+    }
 
-    p= 0.5 * log(abs_h + abs_t);
+    /* clog(+-inf + yi) = inf + ..., for any y including nan */
+    if (isinf(a) || isinf(b))
+        p = INFINITY;
 
     theta = atan2(cimag(x), creal(x));
 
@@ -56,6 +56,8 @@
  *
  *   log(x) = log(r) + (I * theta)
  *
+ *   log(r) = 0.5 * log(a*a + b*b), evaluated in double, and close to |x| = 1
+ *   as 0.5 * log1p(a*a - 1 + b*b)
  *
  */
 #include <math.h>
@@ -71,11 +73,29 @@ ALM_PROTO_OPT(clogf)(fc32_t x) {
 
     float theta, p;
 
-    double abs_x;
+    double a, b, s;
 
-    abs_x = (double)cabsf(x);
+    a = fabs((double)crealf(x));
 
-    p = (float)log(abs_x);
+    b = fabs((double)cimagf(x));
+
+    if (a < b) {
+        double t = a;
+        a = b;
+        b = t;
+    }
+
+    /* a*a and b*b are exact in double */
+    s = a * a + b * b;
+
+    if (s >= 0.5 && s <= 2.0)
+        /* a*a - 1 is exact, the sum is rounded once */
+        p = (float)(0.5 * log1p((a * a - 1.0) + b * b));
+    else if (s <= DBL_MAX)
+        p = (float)(0.5 * log(s));
+    else
+        /* inf or nan parts */
+        p = (float)log((double)cabsf(x));
 
     theta = atan2f(cimagf(x), crealf(x));
 
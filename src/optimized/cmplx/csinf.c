@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Implementation Notes
+ * --------------------
+ * Signature:
+ *   float complex csinf(float complex x)
+ *
+ *   Let x = a + I*b
+ *
+ *   sinf(x) = sinf(a)*coshf(b) + I*cosf(a)*sinhf(b)
+ *
+ *   Computed in double precision, cosh(b) cannot overflow for any b for
+ *   which the result is representable as a float.
+ *
+ *   csinf(+-0 + I*b) = +-0 + I*sinhf(b)
+ *   csinf(a +- I*0)  = nan +- I*0, for a inf or nan
+ *   csinf(a +- I*inf) = nan + I*inf, for a inf or nan
+ *
+ */
+
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+#include <libm/constants.h>
+#include <libm/typehelper.h>
+
+#if defined(__clang__)
+#define CMPLX(X, Y) __builtin_complex ((double) (X), (double) (Y))
+#define CMPLXF(X, Y) __builtin_complex ((float) (X), (float) (Y))
+#endif
+
+fc32_t
+ALM_PROTO_OPT(csinf)(fc32_t z)
+{
+    float    re, im;
+    float    zy_re, zy_im;
+    double   s, c;
+
+    re = crealf(z);
+    im = cimagf(z);
+
+    ALM_PROTO(sincos)((double)re, &s, &c);
+
+    zy_re = (float)(s * ALM_PROTO(cosh)((double)im));
+    zy_im = (float)(c * ALM_PROTO(sinh)((double)im));
+
+    if ((asuint32(re) & ~ALM_F32_SIGN_MASK) == 0)
+        zy_re = re;
+
+    /* re is inf or nan, im is retained if +/-0, +inf if im is +/-inf */
+    if ((asuint32(re) & ~ALM_F32_SIGN_MASK) >= ALM_F32_EXPO_MASK) {
+        if ((asuint32(im) & ~ALM_F32_SIGN_MASK) == 0)
+            zy_im = im;
+        else if ((asuint32(im) & ~ALM_F32_SIGN_MASK) == ALM_F32_EXPO_MASK)
+            zy_im = asfloat((uint32_t)(asuint32(im) & ~ALM_F32_SIGN_MASK));
+    }
+
+    #if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
+        return (fc32_t) { zy_re, zy_im };
+    #else
+        return CMPLXF(zy_re, zy_im);
+    #endif
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Implementation Notes
+ * --------------------
+ * Signature:
+ *   double complex csqrt(double complex x)
+ *
+ *   Let x = a + I*b
+ *
+ *   t = ALM_PROTO(sqrt)((|a| + |x|) / 2), u = |b| / (2*t)
+ *
+ *   a >= 0: ALM_PROTO(sqrt)(x) = t + I*copysign(u, b)
+ *   a <  0: ALM_PROTO(sqrt)(x) = u + I*copysign(t, b)
+ *
+ *   |a| + |x| can overflow for large inputs and lose precision for
+ *   denormal inputs, both are first scaled by an even power of two.
+ *
+ *   csqrt(+-0 + I*0)   = +0 + I*0, sign of zero of b retained
+ *   csqrt(a + I*inf)   = inf + I*inf, for any a including nan
+ *   csqrt(inf + I*nan)  = inf + I*nan
+ *   csqrt(-inf + I*nan) = nan + I*inf
+ *
+ */
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+#include <libm/constants.h>
+#include <libm/typehelper.h>
+#if defined(__clang__)
+#define CMPLX(X, Y) __builtin_complex ((double) (X), (double) (Y))
+#endif
+
+fc64_t
+ALM_PROTO_OPT(csqrt)(fc64_t z)
+{
+    double re, im, a, b, t, u, scale = 1.0;
+    double zy_re, zy_im;
+
+    re = creal(z);
+    im = cimag(z);
+
+    a = asdouble(asuint64(re) & ~ALM_F64_SIGN_MASK);
+    b = asdouble(asuint64(im) & ~ALM_F64_SIGN_MASK);
+
+    if ((asuint64(a) | asuint64(b)) == 0 || asuint64(b) == ALM_F64_EXPO_MASK) {
+        zy_re = b;
+        zy_im = im;
+    }
+    else if (asuint64(a) == ALM_F64_EXPO_MASK && asuint64(b) > ALM_F64_EXPO_MASK) {
+        /* re is +/-inf and im is nan */
+        zy_re = re < 0 ? im : re;
+        zy_im = re < 0 ? a : im;
+    }
+    else {
+        if (a > 0x1p1020 || b > 0x1p1020) {
+            a *= 0x1p-2;
+            b *= 0x1p-2;
+            scale = 2.0;
+        }
+        else if (a < 0x1p-1020 && b < 0x1p-1020) {
+            a *= 0x1p54;
+            b *= 0x1p54;
+            scale = 0x1p-27;
+        }
+
+        t = ALM_PROTO(sqrt)(0.5 * (a + ALM_PROTO(hypot)(a, b)));
+        u = b / (t + t);
+        t *= scale;
+        u *= scale;
+
+        if (re < 0) {
+            zy_re = u;
+            zy_im = (asuint64(im) & ALM_F64_SIGN_MASK) ? -t : t;
+        }
+        else {
+            zy_re = t;
+            zy_im = (asuint64(im) & ALM_F64_SIGN_MASK) ? -u : u;
+        }
+    }
+
+    #if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
+        return (fc64_t) { zy_re, zy_im };
+    #else
+        return CMPLX(zy_re, zy_im);
+    #endif
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Implementation Notes
+ * --------------------
+ * Signature:
+ *   float complex csqrtf(float complex x)
+ *
+ *   Let x = a + I*b
+ *
+ *   t = ALM_PROTO(sqrt)((|a| + |x|) / 2), u = |b| / (2*t)
+ *
+ *   a >= 0: sqrtf(x) = t + I*copysign(u, b)
+ *   a <  0: sqrtf(x) = u + I*copysign(t, b)
+ *
+ *   Computed in double precision, where |a| + |x| neither overflows nor
+ *   loses precision for any float input.
+ *
+ *   csqrtf(+-0 + I*0)   = +0 + I*0, sign of zero of b retained
+ *   csqrtf(a + I*inf)   = inf + I*inf, for any a including nan
+ *   csqrtf(inf + I*nan)  = inf + I*nan
+ *   csqrtf(-inf + I*nan) = nan + I*inf
+ *
+ */
+
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+#include <libm/constants.h>
+#include <libm/typehelper.h>
+
+#if defined(__clang__)
+#define CMPLX(X, Y) __builtin_complex ((double) (X), (double) (Y))
+#define CMPLXF(X, Y) __builtin_complex ((float) (X), (float) (Y))
+#endif
+
+fc32_t
+ALM_PROTO_OPT(csqrtf)(fc32_t z)
+{
+    float    re, im;
+    float    zy_re, zy_im;
+    double   a, b, t, u;
+
+    re = crealf(z);
+    im = cimagf(z);
+
+    a = (double)asfloat((uint32_t)(asuint32(re) & ~ALM_F32_SIGN_MASK));
+    b = (double)asfloat((uint32_t)(asuint32(im) & ~ALM_F32_SIGN_MASK));
+
+    if ((a == 0 && b == 0) || (asuint32(im) & ~ALM_F32_SIGN_MASK) == ALM_F32_EXPO_MASK) {
+        zy_re = (float)b;
+        zy_im = im;
+    }
+    else if ((asuint32(re) & ~ALM_F32_SIGN_MASK) == ALM_F32_EXPO_MASK &&
+             (asuint32(im) & ~ALM_F32_SIGN_MASK) > ALM_F32_EXPO_MASK) {
+        /* re is +/-inf and im is nan */
+        zy_re = re < 0 ? im : re;
+        zy_im = re < 0 ? (float)a : im;
+    }
+    else {
+        t = ALM_PROTO(sqrt)(0.5 * (a + ALM_PROTO(sqrt)(a * a + b * b)));
+        u = b / (t + t);
+
+        if (re < 0) {
+            zy_re = (float)u;
+            zy_im = (float)((asuint32(im) & ALM_F32_SIGN_MASK) ? -t : t);
+        }
+        else {
+            zy_re = (float)t;
+            zy_im = (float)((asuint32(im) & ALM_F32_SIGN_MASK) ? -u : u);
+        }
+    }
+
+    #if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
+        return (fc32_t) { zy_re, zy_im };
+    #else
+        return CMPLXF(zy_re, zy_im);
+    #endif
+}
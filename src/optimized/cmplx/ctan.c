@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Implementation Notes
+ * --------------------
+ * Signature:
+ *   double complex ctan(double complex x)
+ *
+ *   Let x = a + I*b
+ *
+ *   tan(x) = (sin(a)*cos(a) + I*sinh(b)*cosh(b)) / (cos(a)^2 + sinh(b)^2)
+ *
+ *   The denominator is a sum of squares, so there is no cancellation close
+ *   to the poles on the real axis.
+ *
+ *   For |b| > 20, cosh(b)^2 and sinh(b)^2 are equal to working precision
+ *   tan(x) = sin(a)*cos(a)/sinh(b)^2 + I*sign(b)
+ *
+ *   ctan(+-0 + I*b) = +-0 + I*tanh(b)
+ *   ctan(a +- I*0) = nan +- I*0, for a inf or nan
+ *   ctan(a +- I*inf) = +-0 +- I*1, for any a
+ *   ctan(a + I*b) = nan + I*nan, for a inf or nan and b finite nonzero
+ *
+ */
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+#include <libm/constants.h>
+#include <libm/typehelper.h>
+#if defined(__clang__)
+#define CMPLX(X, Y) __builtin_complex ((double) (X), (double) (Y))
+#endif
+
+fc64_t
+ALM_PROTO_OPT(ctan)(fc64_t z)
+{
+    double re, im, s, c, sh;
+    double zy_re, zy_im;
+
+    re = creal(z);
+    im = cimag(z);
+
+    ALM_PROTO(sincos)(re, &s, &c);
+    sh = ALM_PROTO(sinh)(im);
+
+    if (asdouble(asuint64(im) & ~ALM_F64_SIGN_MASK) > 20.0) {
+        zy_re = ((s * c) / sh) / sh;
+        /* s is nan for re inf or nan, which gives nan + nan i */
+        zy_im = (s != s) ? s : (im < 0 ? -1.0 : 1.0);
+    }
+    else {
+        double d = c * c + sh * sh;
+        zy_re = (s * c) / d;
+        zy_im = (sh * ALM_PROTO(cosh)(im)) / d;
+    }
+
+    /* im is +/-0 and re is inf or nan */
+    if ((asuint64(im) & ~ALM_F64_SIGN_MASK) == 0 && (asuint64(re) & ~ALM_F64_SIGN_MASK) >= ALM_F64_EXPO_MASK)
+        zy_im = im;
+
+    if ((asuint64(re) & ~ALM_F64_SIGN_MASK) == 0)
+        zy_re = re;
+
+    /* im is +/-inf, tan(z) = +-0 +- 1i for any re */
+    if ((asuint64(im) & ~ALM_F64_SIGN_MASK) == ALM_F64_EXPO_MASK) {
+        zy_re = asdouble(asuint64(re) & ALM_F64_SIGN_MASK);
+        zy_im = im < 0 ? -1.0 : 1.0;
+    }
+
+    #if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
+        return (fc64_t) { zy_re, zy_im };
+    #else
+        return CMPLX(zy_re, zy_im);
+    #endif
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Implementation Notes
+ * --------------------
+ * Signature:
+ *   float complex ctanf(float complex x)
+ *
+ *   Let x = a + I*b
+ *
+ *   tanf(x) = (sinf(a)*cosf(a) + I*sinhf(b)*coshf(b)) / (cosf(a)^2 + sinhf(b)^2)
+ *
+ *   Computed in double precision. For |b| > 10, coshf(b)^2 and sinhf(b)^2
+ *   are equal to working precision
+ *   tanf(x) = sinf(a)*cosf(a)/sinhf(b)^2 + I*sign(b)
+ *
+ *   ctanf(+-0 + I*b) = +-0 + I*tanhf(b)
+ *   ctanf(a +- I*0) = nan +- I*0, for a inf or nan
+ *   ctanf(a +- I*inf) = +-0 +- I*1, for any a
+ *   ctanf(a + I*b) = nan + I*nan, for a inf or nan and b finite nonzero
+ *
+ */
+
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+#include <libm/constants.h>
+#include <libm/typehelper.h>
+
+#if defined(__clang__)
+#define CMPLX(X, Y) __builtin_complex ((double) (X), (double) (Y))
+#define CMPLXF(X, Y) __builtin_complex ((float) (X), (float) (Y))
+#endif
+
+fc32_t
+ALM_PROTO_OPT(ctanf)(fc32_t z)
+{
+    float    re, im;
+    float    zy_re, zy_im;
+    double   s, c, sh;
+
+    re = crealf(z);
+    im = cimagf(z);
+
+    ALM_PROTO(sincos)((double)re, &s, &c);
+    sh = ALM_PROTO(sinh)((double)im);
+
+    if (asfloat((uint32_t)(asuint32(im) & ~ALM_F32_SIGN_MASK)) > 10.0f) {
+        zy_re = (float)(((s * c) / sh) / sh);
+        /* s is nan for re inf or nan, which gives nan + nan i */
+        zy_im = (s != s) ? (float)s : (im < 0 ? -1.0f : 1.0f);
+    }
+    else {
+        double d = c * c + sh * sh;
+        zy_re = (float)((s * c) / d);
+        zy_im = (float)((sh * ALM_PROTO(cosh)((double)im)) / d);
+    }
+
+    /* im is +/-0 and re is inf or nan */
+    if ((asuint32(im) & ~ALM_F32_SIGN_MASK) == 0 && (asuint32(re) & ~ALM_F32_SIGN_MASK) >= ALM_F32_EXPO_MASK)
+        zy_im = im;
+
+    if ((asuint32(re) & ~ALM_F32_SIGN_MASK) == 0)
+        zy_re = re;
+
+    /* im is +/-inf, tan(z) = +-0 +- 1i for any re */
+    if ((asuint32(im) & ~ALM_F32_SIGN_MASK) == ALM_F32_EXPO_MASK) {
+        zy_re = asfloat((uint32_t)(asuint32(re) & ALM_F32_SIGN_MASK));
+        zy_im = im < 0 ? -1.0f : 1.0f;
+    }
+
+    #if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
+        return (fc32_t) { zy_re, zy_im };
+    #else
+        return CMPLXF(zy_re, zy_im);
+    #endif
+}
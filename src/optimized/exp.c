@@ -119,7 +119,7 @@ ALM_PROTO_OPT(exp)(double x)
     int64_t     m, n, j;
     flt64_t     q1 = {.i = 0,};
 
-
+#if !defined(ALM_FINITE_MATH)
     /*
      * Top 11 bits, ignoring sign bit
      * this is with BIAS
@@ -156,6 +156,7 @@ ALM_PROTO_OPT(exp)(double x)
         exponent = 0xfff;
 
     }
+#endif
 
     double_t a = x * EXP_TBLSZ_BY_LN2;
 
@@ -238,6 +239,7 @@ ALM_PROTO_OPT(exp)(double x)
     const struct exp_table *tbl = &((const struct exp_table*)EXP_TABLE_DATA)[j];
     q = q * tbl->main + tbl->head + tbl->tail;
 
+#if !defined(ALM_FINITE_MATH)
     /*
      * Processing denormals
      */
@@ -258,6 +260,7 @@ ALM_PROTO_OPT(exp)(double x)
            }
        }
     }
+#endif
 
     q1.d =  asdouble((uint64_t)m + asuint64(q));
 
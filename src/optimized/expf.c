@@ -110,7 +110,7 @@ static const struct expf_data expf_v2_data = {
 #define EXPF_FARG_MAX  0x1.62e42ep6f    /* log(0x1p128)  ~=   88.72  */
 
 
-static uint32_t
+static inline uint32_t
 top12f(float x)
 {
     flt32_t f = {.f = x};
@@ -137,6 +137,7 @@ ALM_PROTO_OPT(expf)(float x)
     double_t  q, dn, r, z;
     uint64_t n, j;
 
+#if !defined(ALM_FINITE_MATH)
     uint32_t top = top12f(x);
 
     if (unlikely (top > top12f(88.0f))) {
@@ -158,6 +159,7 @@ ALM_PROTO_OPT(expf)(float x)
             return alm_expf_special(0.0, ALM_E_IN_X_ZERO);
         }
     }
+#endif
 
     z = (double_t)x * EXPF_TBLSZ_BY_LN2;
 
@@ -169,6 +169,7 @@ ALM_PROTO_OPT(log)(double x)
 
     flt64_t mant  = {.u = ux & MANTBITS_DP64};
 
+#if !defined(ALM_FINITE_MATH)
     /* The following line relies on (ux - LOW) underflowing if x is 0 or denormal, 
        which would make the equality true for this case, as well as for x being inf or NaN. */
     if (unlikely ((ux - LOW) >= (HIGH - LOW))){
@@ -198,7 +199,9 @@ ALM_PROTO_OPT(log)(double x)
         ux        = mant.u;
         dexpo    = cast_i64_to_double((int64_t) expo);
     }
-    else {
+    else
+#endif
+    {
 
         expo    -= EXPBIAS_DP64;
         dexpo    = cast_i64_to_double((int64_t) expo);
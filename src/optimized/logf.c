@@ -145,6 +145,7 @@ ALM_PROTO_OPT(logf)(float x)
 {
     uint32_t ux = asuint32(x);
 
+#if !defined(ALM_FINITE_MATH)
     /* The following line relies on (ux - 0x00800000) underflowing if x is 0 or denormal, 
        which would make the equality true for this case, as well as for x being inf or NaN. */
     if (unlikely (ux - 0x00800000 >= 0x7f800000 - 0x00800000)) {
@@ -175,6 +176,7 @@ ALM_PROTO_OPT(logf)(float x)
         ux = asuint32(x * 0x1p23f);
         ux -= 23 << 23;
     }
+#endif
 
     int32_t expo = (((int32_t)ux) >> EXPSHIFTBITS_SP32) - EMAX_SP32;
     float_t f_expo = (float_t)expo;
@@ -393,11 +393,11 @@ compute_exp(double_t v, double_t vt, uint64_t result_sign) {
 
             if((m2 < -1022) || (result < 1.0)) {
 
-                m2 += 1074;
+                /* scale by 2^m2 in two steps, m2 goes below -1074 where
+                 * no single denormal factor exists */
+                dn = asdouble((uint64_t)(m2 + 64 + L__exp_bias) << EXPSHIFTBITS_DP64);
 
-                dn = asdouble( 1ULL << m2);
-
-                n = (int64_t)asuint64(result * dn);
+                n = (int64_t)asuint64(result * dn * 0x1p-64);
 
                 result = asdouble((uint64_t)n | result_sign);
 
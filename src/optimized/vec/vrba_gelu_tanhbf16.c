@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrba_gelu_tanhbf16(int length, bf16_t *input, bf16_t *result)
+ *
+ * vrba_gelu_tanhbf16() computes the tanh approximation of gelu,
+ * x / 2 * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 x^3))), for each x of the 'length'
+ * number of bfloat16 elements present in the 'input' array.
+ * The bfloat16 output is stored in the 'result' array.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Widen 8 elements of input array to float in a 256-bit register,
+ *     bfloat16 is the upper 16 bits of a float
+ *         call act_gelu_tanh_v8(), built on vrs8_expf()
+ *     Round the float results to nearest even bf16.
+ *     Store the output into result array.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Copy them into a zero filled buffer, compute as above
+ *     Copy the output of the remaining elements into result array.
+ * Return
+ *
+ * On zen4/zen5 the same is done 16 elements at a time with act_gelu_tanh_v16(),
+ * built on vrs16_expf().
+ *
+ * Refer include/libm/activation-vec.h for the formulas.
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+#include <libm/activation-vec.h>
+
+#if defined(__AVX512F__)
+#define ACT_BF16_ELEMENTS   BF16_ELEMENTS_256_BIT
+#define ACT_LOAD(p)         cvt_v16_bf16_to_f32(_mm256_loadu_si256((__m256i *)(p)))
+#define ACT_STORE(p, v)     _mm256_storeu_si256((__m256i *)(p), cvt_v16_f32_to_bf16(v))
+#define ACT_FN(x)           act_gelu_tanh_v16(x)
+#else
+#define ACT_BF16_ELEMENTS   BF16_ELEMENTS_128_BIT
+#define ACT_LOAD(p)         cvt_v8_bf16_to_f32(_mm_loadu_si128((__m128i *)(p)))
+#define ACT_STORE(p, v)     _mm_storeu_si128((__m128i *)(p), cvt_v8_f32_to_bf16(v))
+#define ACT_FN(x)           act_gelu_tanh_v8(x)
+#endif
+
+void ALM_PROTO_OPT(vrba_gelu_tanhbf16)(int length, bf16_t *input, bf16_t *result)
+{
+    int j = 0;
+
+    for (j = 0; j <= length - ACT_BF16_ELEMENTS; j += ACT_BF16_ELEMENTS)
+        ACT_STORE(&result[j], ACT_FN(ACT_LOAD(&input[j])));
+
+    if (length - j)
+    {
+        bf16_t buf[ACT_BF16_ELEMENTS] = { 0 };
+
+        for (int i = 0; i < length - j; i++)
+            buf[i] = input[j + i];
+
+        ACT_STORE(buf, ACT_FN(ACT_LOAD(buf)));
+
+        for (int i = 0; i < length - j; i++)
+            result[j + i] = buf[i];
+    }
+}
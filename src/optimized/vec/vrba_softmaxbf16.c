@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrba_softmaxbf16(int rows, int cols, bf16_t *input, bf16_t *result)
+ *
+ * vrba_softmaxbf16() computes the softmax of each of the 'rows' rows of
+ * 'cols' bfloat16 elements of the row-major 'input' matrix,
+ *     result[i][j] = exp(input[i][j]) / sum_k(exp(input[i][k]))
+ * The bfloat16 output is stored in the 'result' matrix, which may be the
+ * same as 'input'.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For each row,
+ *     Find the maximum m of the row
+ *     Accumulate e = exp(x - m) in float, 8 elements at a time with
+ *     vrs8_expf()
+ *     Compute e again, scale it by 1 / sum and round it to bf16
+ *
+ * e is recomputed rather than stored so that it is rounded to bf16 only
+ * once. The remaining elements of each pass are copied into a buffer
+ * filled with -inf, which contributes neither to the maximum nor to the
+ * sum.
+ *
+ * On zen4/zen5 the same is done 16 elements at a time with vrs16_expf().
+ *
+ * A row holding a NaN or +inf, or only -inf, gives a row of NaN.
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+#include <math.h>
+
+#define BF16_NINF   ((bf16_t)0xff80)
+
+#if defined(__AVX512F__)
+#define SMX_ELEMENTS        BF16_ELEMENTS_256_BIT
+#define SMX_LOAD(p)         cvt_v16_bf16_to_f32(_mm256_loadu_si256((__m256i *)(p)))
+#define SMX_STORE(p, v)     _mm256_storeu_si256((__m256i *)(p), cvt_v16_f32_to_bf16(v))
+#define SMX_EXP(v)          ALM_PROTO_ARCH(vrs16_expf)(v)
+#define SMX_MAX(a, b)       _mm512_max_ps(a, b)
+typedef v_f32x16_t smx_vec_t;
+
+static inline float
+smx_hmax(v_f32x16_t v)
+{
+    return _mm512_reduce_max_ps(v);
+}
+
+static inline float
+smx_hadd(v_f32x16_t v)
+{
+    return _mm512_reduce_add_ps(v);
+}
+#else
+#define SMX_ELEMENTS        BF16_ELEMENTS_128_BIT
+#define SMX_LOAD(p)         cvt_v8_bf16_to_f32(_mm_loadu_si128((__m128i *)(p)))
+#define SMX_STORE(p, v)     _mm_storeu_si128((__m128i *)(p), cvt_v8_f32_to_bf16(v))
+#define SMX_EXP(v)          ALM_PROTO(vrs8_expf)(v)
+#define SMX_MAX(a, b)       _mm256_max_ps(a, b)
+typedef v_f32x8_t smx_vec_t;
+
+static inline float
+smx_hmax(v_f32x8_t v)
+{
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+
+    return _mm_cvtss_f32(_mm_max_ss(m, _mm_shuffle_ps(m, m, 1)));
+}
+
+static inline float
+smx_hadd(v_f32x8_t v)
+{
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+}
+#endif
+
+static void
+vrba_softmaxbf16_row(bf16_t *x, bf16_t *y, int n)
+{
+    bf16_t buf[SMX_ELEMENTS];
+    smx_vec_t vmax, sum, vm, vinv;
+    int rem = n % SMX_ELEMENTS;
+    int j;
+
+    /* tail of the row, padded with -inf */
+    for (int i = 0; i < SMX_ELEMENTS; i++)
+        buf[i] = (i < rem) ? x[n - rem + i] : BF16_NINF;
+
+    vmax = SMX_LOAD(buf);
+    for (j = 0; j <= n - SMX_ELEMENTS; j += SMX_ELEMENTS)
+        vmax = SMX_MAX(vmax, SMX_LOAD(&x[j]));
+
+    vm  = (smx_vec_t){} + smx_hmax(vmax);
+
+    sum = SMX_EXP(SMX_LOAD(buf) - vm);
+    for (j = 0; j <= n - SMX_ELEMENTS; j += SMX_ELEMENTS)
+        sum += SMX_EXP(SMX_LOAD(&x[j]) - vm);
+
+    vinv = (smx_vec_t){} + 1.0f / smx_hadd(sum);
+
+    for (j = 0; j <= n - SMX_ELEMENTS; j += SMX_ELEMENTS)
+        SMX_STORE(&y[j], SMX_EXP(SMX_LOAD(&x[j]) - vm) * vinv);
+
+    if (rem)
+    {
+        SMX_STORE(buf, SMX_EXP(SMX_LOAD(buf) - vm) * vinv);
+
+        for (int i = 0; i < rem; i++)
+            y[j + i] = buf[i];
+    }
+}
+
+void ALM_PROTO_OPT(vrba_softmaxbf16)(int rows, int cols, bf16_t *input, bf16_t *result)
+{
+    for (int i = 0; i < rows; i++, input += cols, result += cols)
+        vrba_softmaxbf16_row(input, result, cols);
+}
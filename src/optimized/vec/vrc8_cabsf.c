@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * __m256 amd_vrc8_cabsf(__m256 re, __m256 im)
+ *
+ * Implementation Notes:
+ *  Computes |z| for 8 complex numbers z = re + I*im held in split form.
+ *
+ *  re and im are scaled by a common power of two before squaring, so that
+ *  the result neither overflows nor underflows unless it is not representable.
+ *
+ *  if re or im is +/-inf, return +inf, even if the other is nan
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+
+v_f32x8_t
+ALM_PROTO_OPT(vrc8_cabsf)(v_f32x8_t re, v_f32x8_t im)
+{
+    v_f32x8_t a = re, b = im;
+    v_f32x8_t k = cmplx_scale_v8_f32(&a, &b);
+
+    v_f32x8_t r = _mm256_sqrt_ps(a * a + b * b) * cmplx_sel_v8_f32(k > 0, _MM_SET1_PS8(0x1p70f),
+                                         cmplx_sel_v8_f32(k < 0, _MM_SET1_PS8(0x1p-90f), _MM_SET1_PS8(1.0f)));
+
+    /* +/-inf in either part */
+    v_u32x8_t inf = (v_u32x8_t)(((as_v8_u32_f32(re) & ~SIGNBIT_SP32) == PINFBITPATT_SP32) |
+                   ((as_v8_u32_f32(im) & ~SIGNBIT_SP32) == PINFBITPATT_SP32));
+
+    return as_v8_f32_u32((as_v8_u32_f32(r) & ~inf) | (inf & PINFBITPATT_SP32));
+}
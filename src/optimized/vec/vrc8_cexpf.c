@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * void amd_vrc8_cexpf(__m256 re, __m256 im, __m256 *rre, __m256 *rim)
+ *
+ * Implementation Notes:
+ *  Computes exp(z) for 8 complex numbers z = re + I*im held in split form.
+ *
+ *  exp(z) = exp(re) * (cos(im) + I*sin(im))
+ *
+ *  If exp(re) overflows, the result is evaluated as
+ *  (trig(im) * exp(MAX_ARG)) * exp(re - MAX_ARG) so that results which are
+ *  still representable are not lost.
+ *
+ *  cexp(x + 0i)    = exp(x) + 0i, sign of zero retained
+ *  cexp(-inf + yi) = 0 +/- 0i, for y inf or nan, with the sign of y
+ *  cexp(+inf + yi) = inf + nan i, for y inf or nan
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+
+void
+ALM_PROTO_OPT(vrc8_cexpf)(v_f32x8_t re, v_f32x8_t im, v_f32x8_t *rre, v_f32x8_t *rim)
+{
+    v_f32x8_t s, c;
+    v_i32x8_t big = re > 0x1.62e42ep+6f;
+
+    v_f32x8_t e = ALM_PROTO(vrs8_expf)(cmplx_sel_v8_f32(big, _MM_SET1_PS8(0x1.62e42ep+6f), re));
+
+    ALM_PROTO(vrs8_sincosf)(im, &s, &c);
+
+    v_f32x8_t yr = c * e;
+    v_f32x8_t yi = s * e;
+
+    /* exp(re) overflows, scale by exp(re - MAX_ARG) last, a tiny trig(im)
+     * times exp(re - MAX_ARG) would be rounded as a denormal */
+    if (unlikely(any_v8_u32_loop((v_u32x8_t)big))) {
+        v_f32x8_t t = ALM_PROTO(vrs8_expf)(cmplx_sel_v8_f32(big, re - 0x1.62e42ep+6f, _MM_SET1_PS8(0.0f)));
+        yr = yr * t;
+        yi = yi * t;
+    }
+
+    v_u32x8_t uim  = as_v8_u32_f32(im) & ~SIGNBIT_SP32;
+    v_i32x8_t nfin = (v_i32x8_t)(uim >= PINFBITPATT_SP32);
+    v_i32x8_t pinf = (v_i32x8_t)(as_v8_u32_f32(re) == PINFBITPATT_SP32) & nfin;
+    v_i32x8_t ninf = (v_i32x8_t)(as_v8_u32_f32(re) == NINFBITPATT_SP32) & nfin;
+
+    yi = cmplx_sel_v8_f32(im == 0, im, yi);
+    yr = cmplx_sel_v8_f32(pinf, re, yr);
+    yr = cmplx_sel_v8_f32(ninf, _MM_SET1_PS8(0.0f), yr);
+    yi = cmplx_sel_v8_f32(ninf, as_v8_f32_u32(as_v8_u32_f32(im) & SIGNBIT_SP32), yi);
+
+    *rre = yr;
+    *rim = yi;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * void amd_vrc8_csqrtf(__m256 re, __m256 im, __m256 *rre, __m256 *rim)
+ *
+ * Implementation Notes:
+ *  Computes the principal square root of 8 complex numbers z = re + I*im
+ *  held in split form.
+ *
+ *  t = sqrt((|re| + |z|) / 2), u = |im| / (2*t)
+ *  re >= 0: sqrt(z) = t + I*copysign(u, im)
+ *  re <  0: sqrt(z) = u + I*copysign(t, im)
+ *
+ *  re and im are scaled by an even power of two before squaring.
+ *
+ *  csqrt(+-0 + 0i)  = +0 + 0i, sign of zero of im retained
+ *  csqrt(x + inf i) = inf + inf i, for any x including nan
+ *  csqrt(inf + nan i)  = inf + nan i
+ *  csqrt(-inf + nan i) = nan + inf i
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+
+void
+ALM_PROTO_OPT(vrc8_csqrtf)(v_f32x8_t re, v_f32x8_t im, v_f32x8_t *rre, v_f32x8_t *rim)
+{
+    v_f32x8_t a = re, b = im;
+    v_f32x8_t k = cmplx_scale_v8_f32(&a, &b);
+
+    v_f32x8_t aa = as_v8_f32_u32(as_v8_u32_f32(a) & ~SIGNBIT_SP32);
+    v_f32x8_t ab = as_v8_f32_u32(as_v8_u32_f32(b) & ~SIGNBIT_SP32);
+    v_f32x8_t t  = _mm256_sqrt_ps(0.5f * (aa + _mm256_sqrt_ps(a * a + b * b)));
+    v_f32x8_t u  = ab / (t + t);
+
+    /* scale back by 2^(k/2) */
+    v_f32x8_t sk = cmplx_sel_v8_f32(k > 0, _MM_SET1_PS8(0x1p35f),
+                         cmplx_sel_v8_f32(k < 0, _MM_SET1_PS8(0x1p-45f), _MM_SET1_PS8(1.0f)));
+    t = t * sk;
+    u = u * sk;
+
+    v_i32x8_t neg = (v_i32x8_t)as_v8_u32_f32(re) < 0;
+
+    v_f32x8_t yr = cmplx_sel_v8_f32(neg, u, t);
+    v_f32x8_t yi = cmplx_copysign_v8_f32(cmplx_sel_v8_f32(neg, t, u), im);
+
+    /* z is +/-0, or im is +/-inf */
+    v_u32x8_t uim = as_v8_u32_f32(im) & ~SIGNBIT_SP32;
+    v_i32x8_t spl = (v_i32x8_t)(((as_v8_u32_f32(re) & ~SIGNBIT_SP32) | uim) == 0) | (v_i32x8_t)(uim == PINFBITPATT_SP32);
+    yr = cmplx_sel_v8_f32(spl, as_v8_f32_u32(uim), yr);
+    yi = cmplx_sel_v8_f32(spl, im, yi);
+
+    /* re is +/-inf and im is nan */
+    v_i32x8_t ire = (v_i32x8_t)((as_v8_u32_f32(re) & ~SIGNBIT_SP32) == PINFBITPATT_SP32) & (v_i32x8_t)(uim > PINFBITPATT_SP32);
+    yr = cmplx_sel_v8_f32(ire & ~neg, re, yr);
+    yi = cmplx_sel_v8_f32(ire & neg, as_v8_f32_u32(as_v8_u32_f32(re) & ~SIGNBIT_SP32), yi);
+
+    *rre = yr;
+    *rim = yi;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * void amd_vrc8_ctanf(__m256 re, __m256 im, __m256 *rre, __m256 *rim)
+ *
+ * Implementation Notes:
+ *  Computes tan(z) for 8 complex numbers z = re + I*im held in split form.
+ *
+ *  tan(z) = (sin(re)*cos(re) + I*sinh(im)*cosh(im)) / (cos(re)^2 + sinh(im)^2)
+ *
+ *  The denominator is a sum of squares, so there is no cancellation close
+ *  to the poles on the real axis.
+ *  For |im| > 10.0f, tan(z) = sin(re)*cos(re)/sinh(im)^2 + I*sign(im)
+ *
+ *  ctan(+-0 + yi)   = +-0 + I*tanh(y)
+ *  ctan(x +- 0i)   = nan +- 0i, for x inf or nan
+ *  ctan(x +- inf i) = +-0 +- 1i, for any x
+ *  ctan(x + yi)     = nan + nan i, for x inf or nan and y finite nonzero
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+
+void
+ALM_PROTO_OPT(vrc8_ctanf)(v_f32x8_t re, v_f32x8_t im, v_f32x8_t *rre, v_f32x8_t *rim)
+{
+    v_f32x8_t s, c, sh, ch;
+    v_f32x8_t ab = as_v8_f32_u32(as_v8_u32_f32(im) & ~SIGNBIT_SP32);
+
+    ALM_PROTO(vrs8_sincosf)(re, &s, &c);
+    cmplx_sinhcosh_v8_f32(im, ALM_PROTO(vrs8_expf)(ab), &sh, &ch);
+
+    v_f32x8_t d  = c * c + sh * sh;
+    v_f32x8_t yr = (s * c) / d;
+    v_f32x8_t yi = (sh * ch) / d;
+
+    v_i32x8_t big = ab > 10.0f;
+    if (unlikely(any_v8_u32_loop((v_u32x8_t)big))) {
+        yr = cmplx_sel_v8_f32(big, ((s * c) / sh) / sh, yr);
+        /* s is nan for re inf or nan, those lanes keep nan + nan i */
+        yi = cmplx_sel_v8_f32(big & (s == s), cmplx_copysign_v8_f32(_MM_SET1_PS8(1.0f), im), yi);
+    }
+
+    /* im is +/-0 and re is inf or nan */
+    v_u32x8_t uim = as_v8_u32_f32(im) & ~SIGNBIT_SP32;
+    v_i32x8_t nfre = (v_i32x8_t)((as_v8_u32_f32(re) & ~SIGNBIT_SP32) >= PINFBITPATT_SP32);
+    yi = cmplx_sel_v8_f32(nfre & (v_i32x8_t)(uim == 0), im, yi);
+
+    /* tan(+-0 + yi) = +-0 + I*tanh(y) */
+    yr = cmplx_sel_v8_f32(re == 0, re, yr);
+
+    /* im is +/-inf, tan(z) = +-0 +- 1i for any re */
+    yr = cmplx_sel_v8_f32((v_i32x8_t)(uim == PINFBITPATT_SP32), as_v8_f32_u32(as_v8_u32_f32(re) & SIGNBIT_SP32), yr);
+    yi = cmplx_sel_v8_f32((v_i32x8_t)(uim == PINFBITPATT_SP32), cmplx_copysign_v8_f32(_MM_SET1_PS8(1.0f), im), yi);
+
+    *rre = yr;
+    *rim = yi;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrca_cexpf(int length, fc32_t *x, fc32_t *y)
+ *
+ * vrca_cexpf() computes exp(z) for 'length' number of complex numbers
+ * present in the 'x' array, and stores the results in the 'y' array.
+ * The arrays hold complex numbers in the interleaved (re, im) layout.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Load 8 complex numbers into a pair of 256-bit registers
+ *     Split them into vectors of real and imaginary parts
+ *         call vrc8_cexpf()
+ *     Interleave the results and store them.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Load them with a mask, the inputs which are not needed are 0.
+ *         call vrc8_cexpf()
+ *     Store the results of unmasked elements.
+ * Return
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+/* Split 8 interleaved complex numbers into real and imaginary parts */
+static inline void
+vrca_deinterleave(__m256 lo, __m256 hi, __m256 *re, __m256 *im)
+{
+    /* elements are in the order 0, 1, 4, 5, 2, 3, 6, 7 */
+    *re = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+    *im = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+/* Reverse of vrca_deinterleave() */
+static inline void
+vrca_interleave(__m256 re, __m256 im, __m256 *lo, __m256 *hi)
+{
+    *lo = _mm256_unpacklo_ps(re, im);
+    *hi = _mm256_unpackhi_ps(re, im);
+}
+
+/* Masks for the first n of the 16 floats held in a pair of registers */
+static inline void
+vrca_tail_mask(int n, __m256i *mlo, __m256i *mhi)
+{
+    __m256i vn = _mm256_set1_epi32(n);
+    *mlo = _mm256_cmpgt_epi32(vn, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    *mhi = _mm256_cmpgt_epi32(vn, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+}
+
+void ALM_PROTO_OPT(vrca_cexpf)(int length, fc32_t *x, fc32_t *y)
+{
+    int j = 0;
+    float *px = (float *)x;
+    float *py = (float *)y;
+    __m256 xr, xi, rr, ri, lo, hi;
+
+    for (j = 0; j <= length - 8; j += 8)
+    {
+        vrca_deinterleave(_mm256_loadu_ps(&px[2 * j]), _mm256_loadu_ps(&px[2 * j + 8]), &xr, &xi);
+        ALM_PROTO(vrc8_cexpf)(xr, xi, &rr, &ri);
+        vrca_interleave(rr, ri, &lo, &hi);
+        _mm256_storeu_ps(&py[2 * j], lo);
+        _mm256_storeu_ps(&py[2 * j + 8], hi);
+    }
+
+    if (length - j)
+    {
+        __m256i mlo, mhi;
+        vrca_tail_mask(2 * (length - j), &mlo, &mhi);
+        vrca_deinterleave(_mm256_maskload_ps(&px[2 * j], mlo), _mm256_maskload_ps(&px[2 * j + 8], mhi), &xr, &xi);
+        ALM_PROTO(vrc8_cexpf)(xr, xi, &rr, &ri);
+        vrca_interleave(rr, ri, &lo, &hi);
+        _mm256_maskstore_ps(&py[2 * j], mlo, lo);
+        _mm256_maskstore_ps(&py[2 * j + 8], mhi, hi);
+    }
+}
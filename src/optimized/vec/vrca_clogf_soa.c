@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrca_clogf_soa(int length, float *xr, float *xi, float *yr, float *yi)
+ *
+ * vrca_clogf_soa() computes log(z) for 'length' number of complex numbers
+ * held in the 'xr' and 'xi' arrays of real and imaginary parts, and
+ * stores the real and imaginary parts of the results in the 'yr' and
+ * 'yi' arrays.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Pack 8 elements of each input array into a 256-bit register
+ *         call vrc8_clogf()
+ *     Store the outputs into the result arrays.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Pack the elements of each input array into a 256-bit register
+ *     Mask the inputs which are not needed to be computed with a 0.
+ *         call vrc8_clogf()
+ *     Store the output of unmasked elements into the result arrays.
+ * Return
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+void ALM_PROTO_OPT(vrca_clogf_soa)(int length, float *xr, float *xi, float *yr, float *yi)
+{
+    int j = 0;
+    __m256 rr, ri;
+
+    for (j = 0; j <= length - 8; j += 8)
+    {
+        ALM_PROTO(vrc8_clogf)(_mm256_loadu_ps(&xr[j]), _mm256_loadu_ps(&xi[j]), &rr, &ri);
+        _mm256_storeu_ps(&yr[j], rr);
+        _mm256_storeu_ps(&yi[j], ri);
+    }
+
+    if (length - j)
+    {
+        __m256i mask = GET_MASK_FLOAT_256_BIT(length - j);
+        ALM_PROTO(vrc8_clogf)(_mm256_maskload_ps(&xr[j], mask), _mm256_maskload_ps(&xi[j], mask), &rr, &ri);
+        _mm256_maskstore_ps(&yr[j], mask, rr);
+        _mm256_maskstore_ps(&yi[j], mask, ri);
+    }
+}
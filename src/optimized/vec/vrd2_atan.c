@@ -114,24 +114,33 @@ ALM_PROTO_OPT(vrd2_atan)(v_f64x2_t x)
     /* Get absolute value of input */
     ux = ux & SIGN_MASK;
     aux = as_v2_f64_u64(ux);
-    double F = UNIT / RANGE;
-    /* loop over the 2 elements of the vector */
-    for(int i = 0; i < 2; ++i){
-        unsigned int n = 0;
-        if(aux[i] >= F){
-            aux[i] = UNIT / aux[i];
-            n = 2;
-        }else if(aux[i] > UNIT){
-            aux[i] = UNIT / aux[i];
-            aux[i] = (aux[i] * SQRT3 - UNIT) / (SQRT3 + aux[i]);
-            n = 3;
-        }else if(aux[i] > RANGE){
-            aux[i]= (aux[i] * SQRT3 - UNIT) / (SQRT3 + aux[i]);
-            n = 1;
-        }
-        pival[i] = PI[n];
-        polysign[i] = n > 1 ? NEG : POS;
-    }
+    /*
+     * Pick the reduction per lane with masks, each case is written as
+     * num / den so that a single division serves all of them
+     *   n = 2: 1 / xi
+     *   n = 3: (sqrt(3) - xi) / (sqrt(3) * xi + 1)
+     *   n = 1: (sqrt(3) * xi - 1) / (sqrt(3) + xi)
+     *   n = 0: xi
+     */
+    v_u64x2_t n2 = (v_u64x2_t)(aux >= UNIT / RANGE);
+    v_u64x2_t n3 = (v_u64x2_t)(aux > UNIT) & ~n2;
+    v_u64x2_t n1 = (v_u64x2_t)(aux > RANGE) & ~(v_u64x2_t)(aux > UNIT);
+
+    v_f64x2_t num = sel_v2_f64(n1, aux * SQRT3 - UNIT, aux);
+    v_f64x2_t den = sel_v2_f64(n1, SQRT3 + aux, _MM_SET1_PD2(UNIT));
+
+    num = sel_v2_f64(n3, SQRT3 - aux, num);
+    den = sel_v2_f64(n3, SQRT3 * aux + UNIT, den);
+    num = sel_v2_f64(n2, _MM_SET1_PD2(UNIT), num);
+    den = sel_v2_f64(n2, aux, den);
+
+    aux = num / den;
+
+    pival = sel_v2_f64(n1, _MM_SET1_PD2(PI[1]), _MM_SET1_PD2(PI[0]));
+    pival = sel_v2_f64(n2, _MM_SET1_PD2(PI[2]), pival);
+    pival = sel_v2_f64(n3, _MM_SET1_PD2(PI[3]), pival);
+
+    polysign = (n2 | n3) & NEG;
     v_f64x2_t poly = POLY_EVAL_ODD_19(aux, C0, C1, C2, C3, C4, C5, C6, C7, C8);
     poly = as_v2_f64_u64(as_v2_u64_f64(poly) ^ polysign);
     result = pival + poly;
@@ -125,7 +125,27 @@ static struct {
 #define V2_ALM_HUGE      v2_cos_data.alm_huge
 
 #define COS_MAX 0x4160000000000000
-#define SCALAR_COS ALM_PROTO(cos)
+
+/*
+ * |x| > ARG_MAX
+ * inf and nan give nan without leaving the vector path, only the finite
+ * arguments too large for the vector reduction go to the scalar cos
+ */
+static inline v_f64x2_t
+cos_specialcase(v_f64x2_t _x,
+                v_f64x2_t result,
+                v_u64x2_t cond)
+{
+    v_u64x2_t nonfinite = (v_u64x2_t)((as_v2_u64_f64(_x) & ~SIGNBIT_DP64) >= PINFBITPATT_DP64);
+
+    result = sel_v2_f64(nonfinite, _x - _x, result);
+    cond  &= ~nonfinite;
+
+    if (any_v2_u64_loop(cond))
+        result = call_v2_f64(ALM_PROTO(cos), _x, result, cond);
+
+    return result;
+}
 
 v_f64x2_t
 ALM_PROTO_OPT(vrd2_cos)(v_f64x2_t x)
@@ -165,13 +185,13 @@ ALM_PROTO_OPT(vrd2_cos)(v_f64x2_t x)
     result = as_v2_f64_u64( as_v2_u64_f64(poly) ^ odd);
 
     /* Check for special cases */
-    /* If input value is outside valid range, call scalar cos(value) */
+    /* If input value is outside valid range, fix up those lanes */
     /* Otherwise, return the above computed result */
-    for(int i = 0; i < 2; i++)
-    {
-        if(unlikely(ixd[i] > COS_MAX))
-            result[i] = SCALAR_COS(x[i]);
-    }
+    v_u64x2_t cond = (v_u64x2_t)(ixd > COS_MAX);
+
+    if (unlikely(any_v2_u64_loop(cond)))
+        result = cos_specialcase(x, result, cond);
+
     return result;
 
 }
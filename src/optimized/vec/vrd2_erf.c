@@ -150,7 +150,6 @@ static const struct {
 #define B21  v_erf_data.poly_2[20]
 #define B22  v_erf_data.poly_2[21]
 
-#define SCALAR_ERF ALM_PROTO_OPT(erf)
 
 static inline int test_condition_for_all(v_u64x2_t cond) {
     for(int i = 0; i < 2; i++) {
@@ -188,15 +187,24 @@ ALM_PROTO_OPT(vrd2_erf)(v_f64x2_t _x) {
       return result;
     }
     
-    v_u64x2_t cond3 = uvx > BOUND2;
+    /* nan is left to the blend below */
+    v_u64x2_t cond3 = (uvx > BOUND2) & (uvx <= PINFBITPATT_DP64);
     if(test_condition_for_all(cond3)) {
         return as_v2_f64_u64(sign | ONE);
     }
 
     /* For the remaining cases, where the vector spans more than one region,
-       call the scalar function. */
-    for(uint64_t i = 0; i < 2; i++) {
-        result[i] = SCALAR_ERF(_x[i]);
-    }
-    return result;
+       evaluate each region and blend, lanes beyond BOUND2 are +/-1 and nan
+       returns nan. */
+    v_f64x2_t x2 = x*x;
+    v_f64x2_t result1 = (((((((((((A12 * x2 + A11) * x2 + A10) * x2 + A9)  * x2 + A8)  * x2 + A7)  * x2 + A6)  * x2 + A5)  * x2 + A4)  * x2 + A3)  * x2 + A2)  * x2 + A1) * x;
+    v_f64x2_t result2 = (((((((((((((((((((((B22 * x + B21) * x + B20) * x + B19) * x + B18) * x + B17) * x + B16) * x + B15) * x + B14) * x + B13) * x + B12) * x + B11) * x + B10) * x + B9)  * x + B8)  * x + B7)  * x + B6)  * x + B5)  * x + B4)  * x + B3)  * x + B2)  * x + B1) * x;
+
+    result2 = fONE - amd_vrd2_exp(result2);
+
+    result = sel_v2_f64(cond2, result2, fONE);
+    result = sel_v2_f64(cond1, result1, result);
+    result = as_v2_f64_u64(sign | as_v2_u64_f64(result));
+
+    return sel_v2_f64((v_u64x2_t)(uvx > PINFBITPATT_DP64), _x + _x, result);
 }
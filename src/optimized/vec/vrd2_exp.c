@@ -81,6 +81,7 @@ static const struct {
     v_f64x2_t tblsz_ln2;
     v_f64x2_t ln2_tblsz_head, ln2_tblsz_tail;
     v_f64x2_t Huge;
+    v_f64x2_t clamp_max, clamp_min;
     v_i64x2_t exp_bias;
     v_f64x2_t exp_maxd;
     v_f64x2_t exp_mind;
@@ -93,6 +94,8 @@ static const struct {
                     .ln2_tblsz_head = _MM_SET1_PD2(0x1.63p-1),
                     .ln2_tblsz_tail = _MM_SET1_PD2(-0x1.bd0105c610ca8p-13),
                     .Huge           = _MM_SET1_PD2(0x1.8000000000000p+52),
+                    .clamp_max      = _MM_SET1_PD2(0x1.63p+9),
+                    .clamp_min      = _MM_SET1_PD2(-0x1.75p+9),
                     .exp_bias       = _MM_SET1_I64x2(DOUBLE_PRECISION_BIAS),
                     .exp_maxd       = _MM_SET1_PD2(0x1.62e42fefa39efp+9),
                     .exp_mind       = _MM_SET1_PD2(-0x1.62e42fefa39efp+9),
@@ -120,6 +123,8 @@ static const struct {
 #define INVLN2           exp_data.tblsz_ln2
 #define EXP_HUGE         exp_data.Huge
 #define MASK             exp_data.mask
+#define CLAMP_MAX        exp_data.clamp_max
+#define CLAMP_MIN        exp_data.clamp_min
 #define EXP_MAX          exp_data.exp_maxd
 #define EXP_LOW          exp_data.exp_mind
 #define INF              exp_data.infinity
@@ -139,7 +144,35 @@ static const struct {
 
 #define ARG_MAX 0x4086200000000000
 
-#define SCALAR_EXP ALM_PROTO(exp)
+
+/*
+ * |x| > ARG_MAX, nan and inf
+ * x is clamped to [-746, 710] so that n stays within 11 bits, and 2^n is
+ * applied as 2^(n/2) * 2^(n - n/2), both factors normal. The last multiply
+ * rounds once and gives inf on overflow, 0 or a subnormal on underflow.
+ * nan is left alone by the clamp and propagates through the polynomial.
+ */
+static inline v_f64x2_t
+exp_specialcase(v_f64x2_t x, v_f64x2_t ret, v_u64x2_t cond)
+{
+    v_f64x2_t xc = sel_v2_f64((v_u64x2_t)(x > CLAMP_MAX), CLAMP_MAX, x);
+    xc = sel_v2_f64((v_u64x2_t)(x < CLAMP_MIN), CLAMP_MIN, xc);
+
+    v_f64x2_t dn = xc * INVLN2 + EXP_HUGE;
+    v_i64x2_t n  = as_v2_i64_f64(dn) - as_v2_i64_f64(EXP_HUGE);
+    dn = dn - EXP_HUGE;
+
+    v_f64x2_t r = (xc - dn * LN2_HEAD) - dn * LN2_TAIL;
+
+    v_f64x2_t poly = POLY_EVAL_11(r, C1, C1, C3, C4, C5, C6,
+                                  C7, C8, C9, C10, C11, C12);
+
+    v_i64x2_t n1 = n >> 1;
+    v_f64x2_t s1 = as_v2_f64_i64((n1 + DP64_BIAS) << 52);
+    v_f64x2_t s2 = as_v2_f64_i64((n - n1 + DP64_BIAS) << 52);
+
+    return sel_v2_f64(cond, (poly * s1) * s2, ret);
+}
 
 v_f64x2_t
 ALM_PROTO_OPT(vrd2_exp)(v_f64x2_t x)
@@ -183,13 +216,14 @@ ALM_PROTO_OPT(vrd2_exp)(v_f64x2_t x)
     // result = polynomial * 2^m
     v_f64x2_t ret = poly * as_v2_f64_i64(m);
 
-    // If input value is outside valid range, call scalar exp(value)
+#if !defined(ALM_FINITE_MATH)
+    // If input value is outside valid range, fix up those lanes
     // Else, return the above computed result
-    for(int i = 0; i < 2; i++)
-    {
-        if(unlikely(vx[i] > ARG_MAX))
-            ret[i] = SCALAR_EXP(x[i]);
-    }
+    v_u64x2_t cond = (v_u64x2_t)(vx > ARG_MAX);
+
+    if (unlikely(any_v2_u64_loop(cond)))
+        ret = exp_specialcase(x, ret, cond);
+#endif
 
     return ret;
 }
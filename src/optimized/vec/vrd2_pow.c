@@ -141,35 +141,64 @@ static struct {
 #define B4  v_exp_data.poly[3]
 
 #define EXP_MAX 0x4086200000000000
-#define SCALAR_POW ALM_PROTO(pow)
+#define CLAMP_MAX _MM_SET1_PD2(0x1.63p+9)
+#define CLAMP_MIN _MM_SET1_PD2(-0x1.75p+9)
 /*
- *   __m128d ALM_PROTO_OPT(vrd2_pow)(__m128d, __m128d);
- *
- * Spec:
- *   - A slightly relaxed version of the scalar pow.
- *   - Maximum ULP is expected to be less than 3.
- *
- *
- * Implementation Notes:
- * pow(x,y) = e^(y * log(x))
- * 
- *  1. Calculation of log(x) proceeds using a vectorized version of the scalar log algorithm
- *     which returns both head and tail portions for increased accuracy.
- *
- *  2. Computation of e^(y * log(x)) then proceeds similarly
- *
+ * y * log(x) outside (-EXP_MAX, EXP_MAX), inf and nan.
+ * ylogx_h is clamped to [-746, 710] so that the exponent k stays within 11
+ * bits, and 2^k is applied as 2^(k/2) * 2^(k - k/2), both factors normal.
+ * The last multiply rounds once and gives inf on overflow, 0 or a
+ * subnormal on underflow.
  */
-
-__m128d
-ALM_PROTO_OPT(vrd2_pow)(__m128d _x,__m128d _y)
+static inline v_f64x2_t
+pow_exp_specialcase(v_f64x2_t ylogx_h, v_f64x2_t ylogx_t, v_f64x2_t result,
+                    v_u64x2_t cond)
 {
-    __m128d result;
+    v_u64x2_t hi = (v_u64x2_t)(ylogx_h > CLAMP_MAX);
+    v_u64x2_t lo = (v_u64x2_t)(ylogx_h < CLAMP_MIN);
 
-    v_u64x2_t ux = as_v2_u64_f64(_x);
+    v_f64x2_t xc = sel_v2_f64(hi, CLAMP_MAX, sel_v2_f64(lo, CLAMP_MIN, ylogx_h));
+    v_f64x2_t xt = sel_v2_f64(hi | lo, _MM_SET1_PD2(0.0), ylogx_t);
+
+    v_f64x2_t dn = xc * INVLN2 + EXP_HUGE;
+    v_i64x2_t n  = as_v2_i64_f64(dn) - as_v2_i64_f64(EXP_HUGE);
+    dn = dn - EXP_HUGE;
+
+    v_i64x2_t index = n & DP64_BIAS;
+    v_i64x2_t k  = (n - index) >> N;
+
+    v_f64x2_t r = ((xc - dn * LN2_BY_N_HEAD) - LN2_BY_N_TAIL * dn) + xt;
+
+    v_f64x2_t r2 = r * r;
+
+    v_f64x2_t poly = POLY_EVAL_1(r, B1, B2) + r2 * r2  * B3;
+
+    v_f64x2_t j_by_N;
+
+    for (int i = 0; i < VECTOR_LENGTH; i++)
+        j_by_N[i] = TWO_POWER_J_BY_N[(int32_t)index[i]];
+
+    v_f64x2_t z = poly * j_by_N + j_by_N;
+
+    v_i64x2_t k1 = k >> 1;
+    v_f64x2_t s1 = as_v2_f64_i64((k1 + DOUBLE_PRECISION_BIAS) << 52);
+    v_f64x2_t s2 = as_v2_f64_i64((k - k1 + DOUBLE_PRECISION_BIAS) << 52);
+
+    return sel_v2_f64(cond, (z * s1) * s2, result);
+}
+
+/*
+ * e^(y * log(x)) for positive normal x, given as its bits ux. esub is
+ * taken off the exponent of x, 52 for a denormal x scaled by 2^52.
+ */
+static inline v_f64x2_t
+pow_v2_f64(v_u64x2_t ux, v_f64x2_t esub, v_f64x2_t _y)
+{
+    v_f64x2_t result;
 
     /* This portion of the code is a vectorized version of the scalar log.c, with some checks removed */
 
-    v_u64x2_t int_exponent = (ux >> 52) - DP64_BIAS ;
+    v_i64x2_t int_exponent = (v_i64x2_t)(ux >> 52) - DP64_BIAS ;
 
     v_u64x2_t mant  = ((ux & MANTISSA_BITS) | DP_HALF);
 
@@ -207,6 +236,8 @@ ALM_PROTO_OPT(vrd2_pow)(__m128d _x,__m128d _y)
 
     }
 
+    exponent = exponent - esub;
+
     r = f * F_INV_TAIL;
 
     r1 = f * F_INV_HEAD;
@@ -251,6 +282,9 @@ ALM_PROTO_OPT(vrd2_pow)(__m128d _x,__m128d _y)
 
     v_u64x2_t v = as_v2_u64_f64(ylogx_h) & SIGN_MASK;
 
+    /* check if y*log(x) > 1024*ln(2) */
+    v_u64x2_t condition2 = (v_u64x2_t)(v >= EXP_MAX);
+
     z = ylogx_h * INVLN2;
 
     v_f64x2_t dn = z + EXP_HUGE;
@@ -287,14 +321,94 @@ ALM_PROTO_OPT(vrd2_pow)(__m128d _x,__m128d _y)
 
     result = z * as_v2_f64_i64(m);
 
-    /* Check for special cases */
-    /* If y*log(x) is outside valid range, call scalar pow(value) */
-    /* Otherwise, return the above computed result */
-    for(int i = 0; i < VECTOR_LENGTH; i++) {
-        if(unlikely(v[i] >= EXP_MAX)){
-            result[i] = SCALAR_POW(_x[i], _y[i]);
-         }
-    }
+    if (unlikely(any_v2_u64_loop(condition2)))
+        result = pow_exp_specialcase(ylogx_h, ylogx_t, result, condition2);
+
+    return result;
+}
+
+/*
+ * x <= 0, denormal, inf or nan, and y inf or nan.
+ * Denormal and negative x go through pow_v2_f64() on |x|, denormals scaled
+ * by 2^52. The fixed results are then blended in, in increasing order of
+ * precedence:
+ *   x < 0, y not an integer      nan
+ *   x = +/-0                     y < 0 ? inf : 0
+ *   x = +/-inf                   y < 0 ? 0 : inf
+ *   |x| = 1, y = +/-inf          1
+ *   x < 0 (and -0), y odd        the sign of x
+ *   x or y nan                   nan
+ *   y = 0 or x = 1               1
+ */
+static inline v_f64x2_t
+pow_specialcase(v_f64x2_t x, v_f64x2_t y, v_f64x2_t result, v_u64x2_t cond)
+{
+    v_u64x2_t ux  = as_v2_u64_f64(x);
+    v_u64x2_t uax = ux & ~SIGNBIT_DP64;
+    v_u64x2_t uay = as_v2_u64_f64(y) & ~SIGNBIT_DP64;
+    v_u64x2_t denorm = (v_u64x2_t)(uax - 1 < IMPBIT_DP64 - 1);
+
+    v_f64x2_t ax = as_v2_f64_u64(uax);
+    v_f64x2_t xs = sel_v2_f64(denorm, ax * 0x1p52, ax);
+    v_f64x2_t r  = pow_v2_f64(as_v2_u64_f64(xs), as_v2_f64_u64(denorm & as_v2_u64_f64(_MM_SET1_PD2(52.0))), y);
+
+    v_f64x2_t yt = _mm_round_pd(y, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    v_f64x2_t yh = y * 0.5;
+    v_u64x2_t yint = (v_u64x2_t)(yt == y);
+    v_u64x2_t yodd = yint & (v_u64x2_t)(_mm_round_pd(yh, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC) != yh);
+
+    v_f64x2_t inf  = _MM_SET1_PD2((double)INFINITY);
+    v_f64x2_t zero = _MM_SET1_PD2(0.0);
+    v_f64x2_t one  = _MM_SET1_PD2(1.0);
+
+    r = sel_v2_f64((v_u64x2_t)(ux > SIGNBIT_DP64) & ~yint, _MM_SET1_PD2((double)NAN), r);
+    r = sel_v2_f64((v_u64x2_t)(uax == 0), sel_v2_f64((v_u64x2_t)(y < 0.0), inf, zero), r);
+    r = sel_v2_f64((v_u64x2_t)(uax == PINFBITPATT_DP64), sel_v2_f64((v_u64x2_t)(y < 0.0), zero, inf), r);
+    r = sel_v2_f64((v_u64x2_t)(uax == as_v2_u64_f64(one)) & (v_u64x2_t)(uay == PINFBITPATT_DP64), one, r);
+    r = as_v2_f64_u64(as_v2_u64_f64(r) | (ux & yodd & SIGNBIT_DP64));
+    r = sel_v2_f64((v_u64x2_t)(uax > PINFBITPATT_DP64) | (v_u64x2_t)(uay > PINFBITPATT_DP64), x + y, r);
+    r = sel_v2_f64((v_u64x2_t)(uay == 0) | (v_u64x2_t)(ux == as_v2_u64_f64(one)), one, r);
+
+    return sel_v2_f64(cond, r, result);
+}
+
+/*
+ *   __m128d ALM_PROTO_OPT(vrd2_pow)(__m128d, __m128d);
+ *
+ * Spec:
+ *   - A slightly relaxed version of the scalar pow.
+ *   - Maximum ULP is expected to be less than 3.
+ *
+ *
+ * Implementation Notes:
+ * pow(x,y) = e^(y * log(x))
+ * 
+ *  1. Calculation of log(x) proceeds using a vectorized version of the scalar log algorithm
+ *     which returns both head and tail portions for increased accuracy.
+ *
+ *  2. Computation of e^(y * log(x)) then proceeds similarly
+ *
+ *  3. Special cases are handled in the vector unit: lanes with y * log(x) out of
+ *     range are recomputed with a clamped argument (pow_exp_specialcase), lanes
+ *     with x <= 0, denormal, inf or nan, or y inf or nan, on |x| with the fixed
+ *     results blended in (pow_specialcase).
+ *
+ */
+
+__m128d
+ALM_PROTO_OPT(vrd2_pow)(__m128d _x,__m128d _y)
+{
+    v_u64x2_t ux = as_v2_u64_f64(_x);
+
+    v_u64x2_t uy = as_v2_u64_f64(_y);
+
+    __m128d result = pow_v2_f64(ux, _MM_SET1_PD2(0.0), _y);
+
+    v_u64x2_t cond = (v_u64x2_t)(ux - IMPBIT_DP64 >= PINFBITPATT_DP64 - IMPBIT_DP64) |
+                     (v_u64x2_t)((uy & SIGN_MASK) >= PINFBITPATT_DP64);
+
+    if (unlikely(any_v2_u64_loop(cond)))
+        result = pow_specialcase(_x, _y, result, cond);
 
     return result;
-}
\ No newline at end of file
+}
@@ -46,6 +46,7 @@ static const struct {
     v_f64x4_t tblsz_ln2;
     v_f64x4_t ln2_tblsz_head, ln2_tblsz_tail;
     v_f64x4_t huge;
+    v_f64x4_t clamp_max, clamp_min;
     v_i64x4_t exp_bias;
     v_i64x4_t mask;
     v_f64x4_t poly[12];
@@ -54,6 +55,8 @@ static const struct {
                 .ln2_tblsz_head = _MM_SET1_PD4(0x1.63p-1),
                 .ln2_tblsz_tail = _MM_SET1_PD4(-0x1.bd0105c610ca8p-13),
                 .huge           = _MM_SET1_PD4(0x1.8000000000000p+52),
+                .clamp_max      = _MM_SET1_PD4(0x1.63p+9),
+                .clamp_min      = _MM_SET1_PD4(-0x1.75p+9),
                 .exp_bias       = _MM_SET1_I64(DOUBLE_PRECISION_BIAS),
                 .mask           = _MM_SET1_I64(0x7FFFFFFFFFFFFFFF),
                 .poly           = {
@@ -77,6 +80,8 @@ static const struct {
 #define INVLN2           exp_data.tblsz_ln2
 #define EXP_HUGE         exp_data.huge
 #define MASK             exp_data.mask
+#define CLAMP_MAX        exp_data.clamp_max
+#define CLAMP_MIN        exp_data.clamp_min
 
 
 #define C1  exp_data.poly[0]
@@ -93,7 +98,35 @@ static const struct {
 
 #define ARG_MAX  0x4086200000000000
 
-#define SCALAR_EXP ALM_PROTO(exp)
+
+/*
+ * |x| > ARG_MAX, nan and inf
+ * x is clamped to [-746, 710] so that n stays within 11 bits, and 2^n is
+ * applied as 2^(n/2) * 2^(n - n/2), both factors normal. The last multiply
+ * rounds once and gives inf on overflow, 0 or a subnormal on underflow.
+ * nan is left alone by the clamp and propagates through the polynomial.
+ */
+static inline v_f64x4_t
+exp_specialcase(v_f64x4_t x, v_f64x4_t ret, v_u64x4_t cond)
+{
+    v_f64x4_t xc = sel_v4_f64((v_u64x4_t)(x > CLAMP_MAX), CLAMP_MAX, x);
+    xc = sel_v4_f64((v_u64x4_t)(x < CLAMP_MIN), CLAMP_MIN, xc);
+
+    v_f64x4_t dn = xc * INVLN2 + EXP_HUGE;
+    v_i64x4_t n  = as_v4_i64_f64(dn) - as_v4_i64_f64(EXP_HUGE);
+    dn = dn - EXP_HUGE;
+
+    v_f64x4_t r = (xc - dn * LN2_HEAD) - dn * LN2_TAIL;
+
+    v_f64x4_t poly = POLY_EVAL_11(r, C1, C1, C3, C4, C5, C6,
+                                  C7, C8, C9, C10, C11, C12);
+
+    v_i64x4_t n1 = n >> 1;
+    v_f64x4_t s1 = as_v4_f64_i64((n1 + DP64_BIAS) << 52);
+    v_f64x4_t s2 = as_v4_f64_i64((n - n1 + DP64_BIAS) << 52);
+
+    return sel_v4_f64(cond, (poly * s1) * s2, ret);
+}
 
 
 /*
@@ -174,13 +207,14 @@ ALM_PROTO_OPT(vrd4_exp)(v_f64x4_t x)
     // result = poly * 2^m
     v_f64x4_t ret = poly * as_v4_f64_i64(m);
 
-    // If input value is outside valid range, call scalar exp(value)
+#if !defined(ALM_FINITE_MATH)
+    // If input value is outside valid range, fix up those lanes
     // Else, return the above computed result
-    for(int i =0; i<4; i++)
-    {
-        if(unlikely(vx[i] > ARG_MAX))
-            ret[i] = SCALAR_EXP(x[i]);
-    }
+    v_u64x4_t cond = (v_u64x4_t)(vx > ARG_MAX);
+
+    if (unlikely(any_v4_u64_loop(cond)))
+        ret = exp_specialcase(x, ret, cond);
+#endif
 
     return ret;
 }
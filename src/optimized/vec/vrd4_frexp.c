@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * v_f64x4_t amd_vrd4_frexp(v_f64x4_t x, __m256i *e)
+ *
+ * Implementation Notes:
+ *  Breaks each element of x into a normalized fraction m and an
+ *  integral power of two e such that x = m * 2^e, 0.5 <= |m| < 1.
+ *
+ *  The exponent field is read directly from the bit pattern, denormals
+ *  are first scaled by 2^64 to bring them to the normal range.
+ *
+ *  if x is +/-0, +/-inf or nan, return x and e = 0
+ *  No FP exceptions are raised, except for signalling nan inputs.
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+
+#define FREXP_MIN_NORMAL    0x0010000000000000ULL
+#define FREXP_HALF_EXPBITS  0x3fe0000000000000ULL
+/* 2^64 - 1.0 in exponent field */
+#define FREXP_DENORM_SCALE  0x0400000000000000ULL
+#define FREXP_DENORM_BIAS   64
+
+v_f64x4_t
+ALM_PROTO_OPT(vrd4_frexp)(v_f64x4_t x, __m256i *e)
+{
+    v_u64x4_t ux = as_v4_u64_f64(x);
+    v_u64x4_t ax = ux & ~SIGNBIT_DP64;
+
+    v_u64x4_t denorm  = (v_u64x4_t)((ax != 0) & (ax < FREXP_MIN_NORMAL));
+    v_u64x4_t special = (v_u64x4_t)((ax == 0) | (ax >= EXPBITS_DP64));
+
+    /* Scale denormals by 2^64, rest of the elements by 1.0 */
+    v_f64x4_t scale = as_v4_f64_u64(ONEEXPBITS_DP64 + (denorm & FREXP_DENORM_SCALE));
+    v_u64x4_t uxs = as_v4_u64_f64(x * scale);
+
+    v_i64x4_t expo = (v_i64x4_t)((uxs & EXPBITS_DP64) >> 52) - (EXPBIAS_DP64 - 1)
+                     - (v_i64x4_t)(denorm & FREXP_DENORM_BIAS);
+
+    v_u64x4_t um = (uxs & ~EXPBITS_DP64) | FREXP_HALF_EXPBITS;
+
+    um = (um & ~special) | (as_v4_u64_f64(x + x) & special);
+
+    *e = (__m256i)(expo & ~(v_i64x4_t)special);
+
+    return as_v4_f64_u64(um);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * __m256i amd_vrd4_ilogb(v_f64x4_t x)
+ *
+ * Implementation Notes:
+ *  Extracts the unbiased exponent of each element of x as a signed integer.
+ *
+ *  The exponent field is read directly from the bit pattern, denormals
+ *  are first scaled by 2^64 to bring them to the normal range.
+ *
+ *  if x is +/-0 or nan, return INT_MIN
+ *  if x is +/-inf, return INT_MAX
+ *  No FP exceptions are raised, except for signalling nan inputs.
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+
+#define ILOGB_MIN_NORMAL    0x0010000000000000ULL
+/* 2^64 - 1.0 in exponent field */
+#define ILOGB_DENORM_SCALE  0x0400000000000000ULL
+#define ILOGB_DENORM_BIAS   64
+
+__m256i
+ALM_PROTO_OPT(vrd4_ilogb)(v_f64x4_t x)
+{
+    v_u64x4_t ux = as_v4_u64_f64(x);
+    v_u64x4_t ax = ux & ~SIGNBIT_DP64;
+
+    v_i64x4_t denorm = (ax != 0) & (ax < ILOGB_MIN_NORMAL);
+
+    /* Scale denormals by 2^64, rest of the elements by 1.0 */
+    v_f64x4_t scale = as_v4_f64_u64(ONEEXPBITS_DP64 + ((v_u64x4_t)denorm & ILOGB_DENORM_SCALE));
+    v_u64x4_t uxs = as_v4_u64_f64(x * scale);
+
+    v_i64x4_t expo = (v_i64x4_t)((uxs & EXPBITS_DP64) >> 52) - EXPBIAS_DP64
+                     - (denorm & ILOGB_DENORM_BIAS);
+
+    /* +/-0 and nan */
+    v_i64x4_t cond = (ax == 0) | (ax > EXPBITS_DP64);
+    expo = (expo & ~cond) | (INT_MIN & cond);
+
+    /* +/-inf */
+    cond = ax == EXPBITS_DP64;
+    expo = (expo & ~cond) | (INT_MAX & cond);
+
+    return (__m256i)expo;
+}
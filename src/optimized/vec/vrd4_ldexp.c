@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * v_f64x4_t amd_vrd4_ldexp(v_f64x4_t x, __m256i n)
+ *
+ * Implementation Notes:
+ *  Computes x * 2^n for each element.
+ *
+ *  The result exponent k = exponent(x) + n is computed in integer domain
+ *  and inserted directly into the bit pattern of x, denormal inputs are
+ *  first scaled by 2^64 to bring them to the normal range.
+ *  If k falls outside the normal range, the exponent is biased by 1000
+ *  and the result is fixed up with a single multiplication by 2^-1000
+ *  or 2^1000, so that underflow/overflow are correctly rounded.
+ *
+ *  if x is +/-0, +/-inf or nan, return x
+ *  if the result overflows, return +/-inf
+ *  if the result underflows, return denormal/+-0
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+
+#define LDEXP_MIN_NORMAL    0x0010000000000000ULL
+/* 2^64 - 1.0 in exponent field */
+#define LDEXP_DENORM_SCALE  0x0400000000000000ULL
+#define LDEXP_DENORM_BIAS   64
+/* Any n beyond this flushes all finite inputs to 0 or inf */
+#define LDEXP_N_MAX         4096
+#define LDEXP_EXP_MAX       2046
+#define LDEXP_EXP_MIN       (-100)
+#define LDEXP_EXP_ADJ       1000
+#define LDEXP_TWO_M1000     0x0170000000000000ULL  /* 2^-1000 */
+#define LDEXP_TWO_P1000     0x7e70000000000000ULL  /* 2^1000  */
+
+v_f64x4_t
+ALM_PROTO_OPT(vrd4_ldexp)(v_f64x4_t x, __m256i nv)
+{
+    v_i64x4_t n = (v_i64x4_t)nv;
+    v_u64x4_t ux = as_v4_u64_f64(x);
+    v_u64x4_t ax = ux & ~SIGNBIT_DP64;
+
+    v_i64x4_t denorm  = (ax != 0) & (ax < LDEXP_MIN_NORMAL);
+    v_u64x4_t special = (v_u64x4_t)((ax == 0) | (ax >= EXPBITS_DP64));
+    v_i64x4_t cond;
+
+    /* Clamp n to [-LDEXP_N_MAX, LDEXP_N_MAX] */
+    cond = n > LDEXP_N_MAX;
+    n = (n & ~cond) | (LDEXP_N_MAX & cond);
+    cond = n < -LDEXP_N_MAX;
+    n = (n & ~cond) | (-LDEXP_N_MAX & cond);
+
+    /* Scale denormals by 2^64, rest of the elements by 1.0 */
+    v_f64x4_t scale = as_v4_f64_u64(ONEEXPBITS_DP64 + ((v_u64x4_t)denorm & LDEXP_DENORM_SCALE));
+    v_u64x4_t uxs = as_v4_u64_f64(x * scale);
+
+    /* Biased exponent of the result */
+    v_i64x4_t k = (v_i64x4_t)((uxs & EXPBITS_DP64) >> 52) + n - (denorm & LDEXP_DENORM_BIAS);
+
+    v_u64x4_t fix = _MM_SET1_I64(ONEEXPBITS_DP64);
+
+    /* Result is denormal or zero */
+    cond = k < 1;
+    if (unlikely(any_v4_u64_loop((v_u64x4_t)cond))) {
+        v_i64x4_t kmin = k < LDEXP_EXP_MIN;
+        v_i64x4_t kadj = ((k & ~kmin) | (LDEXP_EXP_MIN & kmin)) + LDEXP_EXP_ADJ;
+        k   = (k & ~cond) | (kadj & cond);
+        fix = (fix & ~(v_u64x4_t)cond) | (LDEXP_TWO_M1000 & (v_u64x4_t)cond);
+    }
+
+    /* Result overflows */
+    cond = k > LDEXP_EXP_MAX;
+    if (unlikely(any_v4_u64_loop((v_u64x4_t)cond))) {
+        k   = (k & ~cond) | (LDEXP_EXP_MAX & cond);
+        fix = (fix & ~(v_u64x4_t)cond) | (LDEXP_TWO_P1000 & (v_u64x4_t)cond);
+    }
+
+    v_u64x4_t uy = (uxs & ~EXPBITS_DP64) | ((v_u64x4_t)k << 52);
+    v_f64x4_t y = as_v4_f64_u64(uy) * as_v4_f64_u64(fix);
+
+    uy = (as_v4_u64_f64(y) & ~special) | (as_v4_u64_f64(x + x) & special);
+
+    return as_v4_f64_u64(uy);
+}
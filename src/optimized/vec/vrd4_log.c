@@ -98,8 +98,6 @@ static struct {
     },
 };
 
-#define LOG_ARG_MAX 0x7ff0000000000000
-#define SCALAR_LOG ALM_PROTO(log)
 
 #define EXPSHIFTBITS_SP64 52
 #define ln2 log_data.ln2
@@ -129,6 +127,45 @@ static struct {
 #define C19 _MM_SET1_PD4(log_data.poly_log[18])
 #define C20 _MM_SET1_PD4(log_data.poly_log[19])
 
+#define LOG_ARG_MAX 0x7ff0000000000000
+#define LOG_MIN_NORMAL 0x0010000000000000
+
+/*
+ * +/-0, denormals, negatives, inf and nan
+ * Denormals are scaled by 2^52 and go through the main path with the
+ * exponent adjusted, the rest get their fixed results blended in.
+ */
+static inline v_f64x4_t
+log_specialcase(v_f64x4_t x, v_f64x4_t r, v_u64x4_t cond)
+{
+    v_u64x4_t ux = as_v4_u64_f64(x);
+    v_u64x4_t denorm = (v_u64x4_t)(ux - 1 < LOG_MIN_NORMAL - 1);
+
+    if (any_v4_u64_loop(denorm)) {
+        v_f64x4_t xs = x * 0x1p52;
+        v_u64x4_t ix = (as_v4_u64_f64(xs) - TWO_BY_THREE) & INF;
+
+        /* small signed integer to double, through 1.5 * 2^52 */
+        v_f64x4_t n = as_v4_f64_u64((v_u64x4_t)((v_i64x4_t)ix >> EXPSHIFTBITS_SP64) + 0x4338000000000000)
+                    - 0x1.8p52 - 52.0;
+
+        v_f64x4_t f = as_v4_f64_u64(as_v4_u64_f64(xs) - ix) - C1;
+
+        v_f64x4_t p = POLY_EVAL_20(f, C0, C1, C2, C3, C4, C5, C6, C7,
+                                C8, C9, C10, C11, C12, C13, C14,
+                                C15, C16, C17, C18, C19, C20);
+
+        r = sel_v4_f64(denorm, n * ln2_head + (n * ln2_tail + p), r);
+    }
+
+    r = sel_v4_f64((v_u64x4_t)((ux << 1) == 0), _MM_SET1_PD4(-(double)INFINITY), r);
+    r = sel_v4_f64((v_u64x4_t)(ux > SIGNBIT_DP64), _MM_SET1_PD4((double)NAN), r);
+    r = sel_v4_f64((v_u64x4_t)(ux == PINFBITPATT_DP64), x, r);
+    r = sel_v4_f64((v_u64x4_t)((ux & ~SIGNBIT_DP64) > PINFBITPATT_DP64), x + x, r);
+
+    return r;
+}
+
 __m256d
 ALM_PROTO_OPT(vrd4_log) (__m256d x)
 {
@@ -173,16 +210,17 @@ ALM_PROTO_OPT(vrd4_log) (__m256d x)
 
     r = n * ln2_head + (n * ln2_tail + r);
 
+#if !defined(ALM_FINITE_MATH)
     v_u64x4_t ux = as_v4_u64_f64(x);
 
     /* Check for special cases */
-    /* If input value is outside valid range, call scalar log(value) */
+    /* +/-0, denormals, negatives, inf and nan are fixed up in log_specialcase */
     /* Otherwise, return the above computed result */
-    for(int i = 0; i < 4; i++)
-    {
-        if(unlikely(ux[i] > LOG_ARG_MAX))
-            r[i] = SCALAR_LOG(x[i]);
-    }
+    v_u64x4_t cond = (v_u64x4_t)(ux - LOG_MIN_NORMAL >= LOG_ARG_MAX - LOG_MIN_NORMAL);
+
+    if (unlikely(any_v4_u64_loop(cond)))
+        r = log_specialcase(x, r, cond);
+#endif
 
     return r;
 }
@@ -91,6 +91,7 @@ static struct {
     v_f64x4_t ln2by_tblsz, Huge, ln2_tblsz_head, ln2_tblsz_tail;
     v_f64x4_t tblsz_ln2;
     v_f64x4_t poly[11];
+    v_f64x4_t clamp_max, clamp_min;
     v_i64x4_t exp_bias;
     v_u64x4_t exp_max;
 } v_exp_data  = {
@@ -99,6 +100,8 @@ static struct {
     .tblsz_ln2 = _MM_SET1_PD4(0x1.71547652b82fep+0),
     .Huge = _MM_SET1_PD4(0x1.8000000000000p+52),
     .exp_max = _MM_SET1_I64(0x4086200000000000),
+    .clamp_max = _MM_SET1_PD4(0x1.63p+9),
+    .clamp_min = _MM_SET1_PD4(-0x1.75p+9),
     .exp_bias = _MM_SET1_I64(DOUBLE_PRECISION_BIAS),
     .poly = {
 		_MM_SET1_PD4(0x1.0p0),
@@ -128,6 +131,8 @@ static struct {
 #define EXP_HUGE        v_exp_data.Huge
 #define EXP_MAX         v_exp_data.exp_max
 #define EXP_BIAS        v_exp_data.exp_bias
+#define CLAMP_MAX       v_exp_data.clamp_max
+#define CLAMP_MIN       v_exp_data.clamp_min
 
 /*
  * Short names for polynomial coefficients
@@ -151,33 +156,49 @@ static struct {
 #define B12 v_exp_data.poly[10]
 
 /*
- *   __m256d ALM_PROTO_OPT(vrd4_pow)(__m256d, __m256d);
- *
- * Spec:
- *   - A slightly relaxed version of the scalar pow.
- *   - Maximum ULP is expected to be less than 3.
- *
- *
- * Implementation Notes:
- * pow(x,y) = e^(y * log(x))
- * 
- *  1. Calculation of log(x) proceeds using a vectorized version of the scalar log algorithm
- *     which returns both head and tail portions for increased accuracy.
- *
- *  2. Computation of e^(y * log(x)) then proceeds similarly to vrd4_exp
- *
+ * y * log(x) outside (-EXP_MAX, EXP_MAX), inf and nan.
+ * ylogx_h is clamped to [-746, 710] so that n stays within 11 bits, and 2^n
+ * is applied as 2^(n/2) * 2^(n - n/2), both factors normal. The last multiply
+ * rounds once and gives inf on overflow, 0 or a subnormal on underflow.
  */
-
-__m256d
-ALM_PROTO_OPT(vrd4_pow)(__m256d _x,__m256d _y)
+static inline v_f64x4_t
+pow_exp_specialcase(v_f64x4_t ylogx_h, v_f64x4_t ylogx_t, v_f64x4_t result,
+                    v_u64x4_t cond)
 {
-    __m256d result;
+    v_u64x4_t hi = (v_u64x4_t)(ylogx_h > CLAMP_MAX);
+    v_u64x4_t lo = (v_u64x4_t)(ylogx_h < CLAMP_MIN);
 
-    v_u64x4_t ux = as_v4_u64_f64(_x);
+    v_f64x4_t xc = sel_v4_f64(hi, CLAMP_MAX, sel_v4_f64(lo, CLAMP_MIN, ylogx_h));
+    v_f64x4_t xt = sel_v4_f64(hi | lo, _MM_SET1_PD4(0.0), ylogx_t);
+
+    v_f64x4_t dn = xc * INVLN2_EXP + EXP_HUGE;
+    v_i64x4_t n  = as_v4_i64_f64(dn) - as_v4_i64_f64(EXP_HUGE);
+    dn = dn - EXP_HUGE;
+
+    v_f64x4_t r = ((xc - dn * LN2_HEAD_EXP) - LN2_TAIL_EXP * dn) + xt;
+
+    v_f64x4_t poly = POLY_EVAL_11(r, B1, B1, B3, B4, B5, B6,
+                                  B7, B8, B9, B10, B11, B12);
+
+    v_i64x4_t n1 = n >> 1;
+    v_f64x4_t s1 = as_v4_f64_i64((n1 + EXP_BIAS) << 52);
+    v_f64x4_t s2 = as_v4_f64_i64((n - n1 + EXP_BIAS) << 52);
+
+    return sel_v4_f64(cond, (poly * s1) * s2, result);
+}
+
+/*
+ * e^(y * log(x)) for positive normal x, given as its bits ux. esub is
+ * taken off the exponent of x, 52 for a denormal x scaled by 2^52.
+ */
+static inline v_f64x4_t
+pow_v4_f64(v_u64x4_t ux, v_f64x4_t esub, v_f64x4_t _y)
+{
+    v_f64x4_t result;
 
     /* This portion of the code is a vectorized version of the scalar log.c, with some checks removed */
 
-    v_u64x4_t int_exponent = (ux >> 52) - DP64_BIAS ;
+    v_i64x4_t int_exponent = (v_i64x4_t)(ux >> 52) - DP64_BIAS ;
 
     v_u64x4_t mant  = ((ux & MANTISSA_BITS) | DP_HALF);
 
@@ -215,6 +236,8 @@ ALM_PROTO_OPT(vrd4_pow)(__m256d _x,__m256d _y)
 
     }
 
+    exponent = exponent - esub;
+
     r = f * F_INV_TAIL;
 
     r1 = f * F_INV_HEAD;
@@ -260,7 +283,7 @@ ALM_PROTO_OPT(vrd4_pow)(__m256d _x,__m256d _y)
     v_u64x4_t v = as_v4_u64_f64(ylogx_h) & SIGN_MASK;
 
     /* check if y*log(x) > 1024*ln(2) */
-    v_i64x4_t condition2 = (v_i64x4_t)(v >= EXP_MAX);
+    v_u64x4_t condition2 = (v_u64x4_t)(v >= EXP_MAX);
 
     z = ylogx_h * INVLN2_EXP;
 
@@ -281,11 +304,94 @@ ALM_PROTO_OPT(vrd4_pow)(__m256d _x,__m256d _y)
 
     result = poly2 * as_v4_f64_i64(m);
 
-    for(int i = 0; i < VECTOR_LENGTH; i++) {
-        if(unlikely((condition2)[i])){
-            result[i] = ALM_PROTO(pow)(_x[i], _y[i]);
-         }
-    }
+    if (unlikely(any_v4_u64_loop(condition2)))
+        result = pow_exp_specialcase(ylogx_h, ylogx_t, result, condition2);
+
+    return result;
+}
+
+/*
+ * x <= 0, denormal, inf or nan, and y inf or nan.
+ * Denormal and negative x go through pow_v4_f64() on |x|, denormals scaled
+ * by 2^52. The fixed results are then blended in, in increasing order of
+ * precedence:
+ *   x < 0, y not an integer      nan
+ *   x = +/-0                     y < 0 ? inf : 0
+ *   x = +/-inf                   y < 0 ? 0 : inf
+ *   |x| = 1, y = +/-inf          1
+ *   x < 0 (and -0), y odd        the sign of x
+ *   x or y nan                   nan
+ *   y = 0 or x = 1               1
+ */
+static inline v_f64x4_t
+pow_specialcase(v_f64x4_t x, v_f64x4_t y, v_f64x4_t result, v_u64x4_t cond)
+{
+    v_u64x4_t ux  = as_v4_u64_f64(x);
+    v_u64x4_t uax = ux & ~SIGNBIT_DP64;
+    v_u64x4_t uay = as_v4_u64_f64(y) & ~SIGNBIT_DP64;
+    v_u64x4_t denorm = (v_u64x4_t)(uax - 1 < IMPBIT_DP64 - 1);
+
+    v_f64x4_t ax = as_v4_f64_u64(uax);
+    v_f64x4_t xs = sel_v4_f64(denorm, ax * 0x1p52, ax);
+    v_f64x4_t r  = pow_v4_f64(as_v4_u64_f64(xs), as_v4_f64_u64(denorm & as_v4_u64_f64(_MM_SET1_PD4(52.0))), y);
+
+    v_f64x4_t yt = _mm256_round_pd(y, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    v_f64x4_t yh = y * 0.5;
+    v_u64x4_t yint = (v_u64x4_t)(yt == y);
+    v_u64x4_t yodd = yint & (v_u64x4_t)(_mm256_round_pd(yh, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC) != yh);
+
+    v_f64x4_t inf  = _MM_SET1_PD4((double)INFINITY);
+    v_f64x4_t zero = _MM_SET1_PD4(0.0);
+    v_f64x4_t one  = _MM_SET1_PD4(1.0);
+
+    r = sel_v4_f64((v_u64x4_t)(ux > SIGNBIT_DP64) & ~yint, _MM_SET1_PD4((double)NAN), r);
+    r = sel_v4_f64((v_u64x4_t)(uax == 0), sel_v4_f64((v_u64x4_t)(y < 0.0), inf, zero), r);
+    r = sel_v4_f64((v_u64x4_t)(uax == PINFBITPATT_DP64), sel_v4_f64((v_u64x4_t)(y < 0.0), zero, inf), r);
+    r = sel_v4_f64((v_u64x4_t)(uax == as_v4_u64_f64(one)) & (v_u64x4_t)(uay == PINFBITPATT_DP64), one, r);
+    r = as_v4_f64_u64(as_v4_u64_f64(r) | (ux & yodd & SIGNBIT_DP64));
+    r = sel_v4_f64((v_u64x4_t)(uax > PINFBITPATT_DP64) | (v_u64x4_t)(uay > PINFBITPATT_DP64), x + y, r);
+    r = sel_v4_f64((v_u64x4_t)(uay == 0) | (v_u64x4_t)(ux == as_v4_u64_f64(one)), one, r);
+
+    return sel_v4_f64(cond, r, result);
+}
+
+/*
+ *   __m256d ALM_PROTO_OPT(vrd4_pow)(__m256d, __m256d);
+ *
+ * Spec:
+ *   - A slightly relaxed version of the scalar pow.
+ *   - Maximum ULP is expected to be less than 3.
+ *
+ *
+ * Implementation Notes:
+ * pow(x,y) = e^(y * log(x))
+ * 
+ *  1. Calculation of log(x) proceeds using a vectorized version of the scalar log algorithm
+ *     which returns both head and tail portions for increased accuracy.
+ *
+ *  2. Computation of e^(y * log(x)) then proceeds similarly to vrd4_exp
+ *
+ *  3. Special cases are handled in the vector unit: lanes with y * log(x) out of
+ *     range are recomputed with a clamped argument (pow_exp_specialcase), lanes
+ *     with x <= 0, denormal, inf or nan, or y inf or nan, on |x| with the fixed
+ *     results blended in (pow_specialcase).
+ *
+ */
+
+__m256d
+ALM_PROTO_OPT(vrd4_pow)(__m256d _x,__m256d _y)
+{
+    v_u64x4_t ux = as_v4_u64_f64(_x);
+
+    v_u64x4_t uy = as_v4_u64_f64(_y);
+
+    __m256d result = pow_v4_f64(ux, _MM_SET1_PD4(0.0), _y);
+
+    v_u64x4_t cond = (v_u64x4_t)(ux - IMPBIT_DP64 >= PINFBITPATT_DP64 - IMPBIT_DP64) |
+                     (v_u64x4_t)((uy & SIGN_MASK) >= PINFBITPATT_DP64);
+
+    if (unlikely(any_v4_u64_loop(cond)))
+        result = pow_specialcase(_x, _y, result, cond);
 
     return result;
-}
\ No newline at end of file
+}
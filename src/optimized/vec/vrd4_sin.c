@@ -104,7 +104,27 @@ static struct {
 #define C14 v4_sin_data.poly_sin[7]
 
 #define SIN_ARG_MAX 0x4160000000000000
-#define SCALAR_SIN ALM_PROTO(sin)
+
+/*
+ * |x| > ARG_MAX
+ * inf and nan give nan without leaving the vector path, only the finite
+ * arguments too large for the vector reduction go to the scalar sin
+ */
+static inline v_f64x4_t
+sin_specialcase(v_f64x4_t _x,
+                v_f64x4_t result,
+                v_u64x4_t cond)
+{
+    v_u64x4_t nonfinite = (v_u64x4_t)((as_v4_u64_f64(_x) & ~SIGNBIT_DP64) >= PINFBITPATT_DP64);
+
+    result = sel_v4_f64(nonfinite, _x - _x, result);
+    cond  &= ~nonfinite;
+
+    if (any_v4_u64_loop(cond))
+        result = call_v4_f64(ALM_PROTO(sin), _x, result, cond);
+
+    return result;
+}
 
 v_f64x4_t
 ALM_PROTO_OPT(vrd4_sin)(v_f64x4_t x)
@@ -150,12 +170,12 @@ ALM_PROTO_OPT(vrd4_sin)(v_f64x4_t x)
     result = as_v4_f64_u64(as_v4_u64_f64(poly) ^ sign ^ odd);
 
     /* Check for special cases */
-    /* If input value is outside valid range, call scalar sin(value) */
+    /* If input value is outside valid range, fix up those lanes */
     /* Otherwise, return the above computed result */
-    for(int i = 0; i < 4; i++)
-    {
-        if(unlikely(ux[i] > SIN_ARG_MAX))
-            result[i] = SCALAR_SIN(x[i]);
-    }
+    v_u64x4_t cond = (v_u64x4_t)(ux > SIN_ARG_MAX);
+
+    if (unlikely(any_v4_u64_loop(cond)))
+        result = sin_specialcase(x, result, cond);
+
     return result;
 }
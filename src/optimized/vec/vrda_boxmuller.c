@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrda_boxmuller(int length, double *u1, double *u2, double *z0, double *z1)
+ *
+ * vrda_boxmuller() turns 'length' pairs of uniform deviates from the 'u1' and
+ * 'u2' arrays into pairs of independent standard normal deviates with
+ * the Box-Muller transform,
+ *     z0 = sqrt(-2 log(u1)) * cos(2 pi u2)
+ *     z1 = sqrt(-2 log(u1)) * sin(2 pi u2)
+ * and stores them in the 'z0' and 'z1' arrays.
+ *
+ * u1 is expected in (0, 1] and u2 in [0, 1). u1 = 0 gives infinite
+ * results.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Load 4 elements of u1 and u2 into 256-bit registers
+ *         call vrd4_log() and vrd4_sincos()
+ *     Compute the radius with a square root and scale cos and sin by it
+ *     Store z0 and z1.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Load them with a mask, the u1 lanes which are not needed are 1
+ *     and the u2 ones 0, so that log() does not raise FE_DIVBYZERO.
+ *     Store the results of unmasked elements.
+ * Return
+ *
+ * On zen4/zen5 the same is done 8 elements at a time with vrd8_log()
+ * and vrd8_sincos().
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+#define BOXMULLER_TWO_PI    0x1.921fb54442d18p+2
+
+#if defined(__AVX512F__)
+static inline void
+vrda_boxmuller_v8(__m512d u1, __m512d u2, __m512d *z0, __m512d *z1)
+{
+    __m512d r = _mm512_sqrt_pd(_mm512_mul_pd(_mm512_set1_pd(-2.0), ALM_PROTO_ARCH(vrd8_log)(u1)));
+    __m512d s, c;
+
+    ALM_PROTO_ARCH(vrd8_sincos)(_mm512_mul_pd(u2, _mm512_set1_pd(BOXMULLER_TWO_PI)), &s, &c);
+
+    *z0 = _mm512_mul_pd(r, c);
+    *z1 = _mm512_mul_pd(r, s);
+}
+
+void ALM_PROTO_OPT(vrda_boxmuller)(int length, double *u1, double *u2, double *z0, double *z1)
+{
+    int j = 0;
+    __m512d r0, r1;
+
+    for (j = 0; j <= length - DOUBLE_ELEMENTS_512_BIT; j += DOUBLE_ELEMENTS_512_BIT)
+    {
+        vrda_boxmuller_v8(_mm512_loadu_pd(&u1[j]), _mm512_loadu_pd(&u2[j]), &r0, &r1);
+        _mm512_storeu_pd(&z0[j], r0);
+        _mm512_storeu_pd(&z1[j], r1);
+    }
+
+    if (length - j)
+    {
+        __mmask8 mask = (__mmask8)((1U << (length - j)) - 1);
+
+        vrda_boxmuller_v8(_mm512_mask_loadu_pd(_mm512_set1_pd(1.0), mask, &u1[j]),
+                          _mm512_maskz_loadu_pd(mask, &u2[j]), &r0, &r1);
+        _mm512_mask_storeu_pd(&z0[j], mask, r0);
+        _mm512_mask_storeu_pd(&z1[j], mask, r1);
+    }
+}
+#else
+static inline void
+vrda_boxmuller_v4(__m256d u1, __m256d u2, __m256d *z0, __m256d *z1)
+{
+    __m256d r = _mm256_sqrt_pd(_mm256_mul_pd(_mm256_set1_pd(-2.0), ALM_PROTO(vrd4_log)(u1)));
+    __m256d s, c;
+
+    ALM_PROTO(vrd4_sincos)(_mm256_mul_pd(u2, _mm256_set1_pd(BOXMULLER_TWO_PI)), &s, &c);
+
+    *z0 = _mm256_mul_pd(r, c);
+    *z1 = _mm256_mul_pd(r, s);
+}
+
+void ALM_PROTO_OPT(vrda_boxmuller)(int length, double *u1, double *u2, double *z0, double *z1)
+{
+    int j = 0;
+    __m256d r0, r1;
+
+    for (j = 0; j <= length - DOUBLE_ELEMENTS_256_BIT; j += DOUBLE_ELEMENTS_256_BIT)
+    {
+        vrda_boxmuller_v4(_mm256_loadu_pd(&u1[j]), _mm256_loadu_pd(&u2[j]), &r0, &r1);
+        _mm256_storeu_pd(&z0[j], r0);
+        _mm256_storeu_pd(&z1[j], r1);
+    }
+
+    if (length - j)
+    {
+        __m256i mask = GET_MASK_DOUBLE_256_BIT(length - j);
+        __m256d v1 = _mm256_blendv_pd(_mm256_set1_pd(1.0), _mm256_maskload_pd(&u1[j], mask),
+                                      _mm256_castsi256_pd(mask));
+
+        vrda_boxmuller_v4(v1, _mm256_maskload_pd(&u2[j], mask), &r0, &r1);
+        _mm256_maskstore_pd(&z0[j], mask, r0);
+        _mm256_maskstore_pd(&z1[j], mask, r1);
+    }
+}
+#endif
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrda_cis(int length, double *theta, fc64_t *z)
+ *
+ * vrda_cis() computes cos(theta) + i sin(theta) for 'length' number
+ * of elements present in the 'theta' array,
+ * and stores the results in the 'z' array of interleaved (re, im)
+ * complex numbers.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Load 4 elements of theta into 256-bit registers
+ *         call vrd4_sincos()
+ *     Interleave cos and sin into 4 complex numbers and store them.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Load them with a mask, the inputs which are not needed are 0.
+ *         call vrd4_sincos()
+ *     Store the results of unmasked elements.
+ * Return
+ *
+ * On zen4/zen5 the same is done 8 elements at a time with vrd8_sincos().
+ *
+ * This replaces vrda_sincos() followed by interleaving
+ * with a single pass over memory.
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+#if defined(__AVX512F__)
+/* Interleave 8 cos and sin values into 8 complex numbers */
+static inline void
+vrda_cis_interleave(__m512d c, __m512d s, __m512d *lo, __m512d *hi)
+{
+    *lo = _mm512_permutex2var_pd(c, _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11), s);
+    *hi = _mm512_permutex2var_pd(c, _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15), s);
+}
+
+void ALM_PROTO_OPT(vrda_cis)(int length, double *theta, fc64_t *z)
+{
+    int j = 0;
+    double *pz = (double *)z;
+    __m512d s, c, lo, hi;
+
+    for (j = 0; j <= length - DOUBLE_ELEMENTS_512_BIT; j += DOUBLE_ELEMENTS_512_BIT)
+    {
+        ALM_PROTO_ARCH(vrd8_sincos)(_mm512_loadu_pd(&theta[j]), &s, &c);
+        vrda_cis_interleave(c, s, &lo, &hi);
+        _mm512_storeu_pd(&pz[2 * j], lo);
+        _mm512_storeu_pd(&pz[2 * j + 8], hi);
+    }
+
+    if (length - j)
+    {
+        __mmask8  mask = (__mmask8)((1U << (length - j)) - 1);
+        __mmask16 mout = (__mmask16)((1U << (2 * (length - j))) - 1);
+
+        ALM_PROTO_ARCH(vrd8_sincos)(_mm512_maskz_loadu_pd(mask, &theta[j]), &s, &c);
+        vrda_cis_interleave(c, s, &lo, &hi);
+        _mm512_mask_storeu_pd(&pz[2 * j], (__mmask8)mout, lo);
+        _mm512_mask_storeu_pd(&pz[2 * j + 8], (__mmask8)(mout >> 8), hi);
+    }
+}
+#else
+/* Interleave 4 cos and sin values into 4 complex numbers */
+static inline void
+vrda_cis_interleave(__m256d c, __m256d s, __m256d *lo, __m256d *hi)
+{
+    __m256d a = _mm256_unpacklo_pd(c, s);
+    __m256d b = _mm256_unpackhi_pd(c, s);
+
+    *lo = _mm256_permute2f128_pd(a, b, 0x20);
+    *hi = _mm256_permute2f128_pd(a, b, 0x31);
+}
+
+/* Masks for the first n of the 8 doubles held in a pair of registers */
+static inline void
+vrda_cis_tail_mask(int n, __m256i *mlo, __m256i *mhi)
+{
+    __m256i vn = _mm256_set1_epi64x(n);
+    *mlo = _mm256_cmpgt_epi64(vn, _mm256_setr_epi64x(0, 1, 2, 3));
+    *mhi = _mm256_cmpgt_epi64(vn, _mm256_setr_epi64x(4, 5, 6, 7));
+}
+
+void ALM_PROTO_OPT(vrda_cis)(int length, double *theta, fc64_t *z)
+{
+    int j = 0;
+    double *pz = (double *)z;
+    __m256d s, c, lo, hi;
+
+    for (j = 0; j <= length - DOUBLE_ELEMENTS_256_BIT; j += DOUBLE_ELEMENTS_256_BIT)
+    {
+        ALM_PROTO(vrd4_sincos)(_mm256_loadu_pd(&theta[j]), &s, &c);
+        vrda_cis_interleave(c, s, &lo, &hi);
+        _mm256_storeu_pd(&pz[2 * j], lo);
+        _mm256_storeu_pd(&pz[2 * j + 4], hi);
+    }
+
+    if (length - j)
+    {
+        __m256i mask = GET_MASK_DOUBLE_256_BIT(length - j);
+        __m256i mlo, mhi;
+
+        vrda_cis_tail_mask(2 * (length - j), &mlo, &mhi);
+        ALM_PROTO(vrd4_sincos)(_mm256_maskload_pd(&theta[j], mask), &s, &c);
+        vrda_cis_interleave(c, s, &lo, &hi);
+        _mm256_maskstore_pd(&pz[2 * j], mlo, lo);
+        _mm256_maskstore_pd(&pz[2 * j + 4], mhi, hi);
+    }
+}
+#endif
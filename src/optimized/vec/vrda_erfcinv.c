@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrda_erfcinv(int length, double *input, double *result)
+ *
+ * vrda_erfcinv() computes the inverse complementary error function for
+ * 'length' number of elements present in the 'input' array.
+ * The corresponding output is stored in the 'result' array.
+ *
+ * y = 0 gives +inf, y = 2 gives -inf, y outside [0, 2] gives NaN.
+ * NaN gives NaN.
+ *
+ * Maximum ULP is 5.60
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * See libm/erfc-common.h for the algorithm.
+ *
+ * The elements are evaluated 4 at a time with the vrd4 kernel, and on
+ * zen4/zen5 8 at a time with the vrd8 kernel. The remaining elements
+ * are loaded and stored with a mask.
+ */
+#include <libm/erfc-common.h>
+
+#if defined(__AVX512F__)
+void ALM_PROTO_OPT(vrda_erfcinv)(int length, double *input, double *result)
+{
+    int j = 0;
+
+    for (j = 0; j <= length - DOUBLE_ELEMENTS_512_BIT; j += DOUBLE_ELEMENTS_512_BIT)
+        _mm512_storeu_pd(&result[j], erfcinv_v8(_mm512_loadu_pd(&input[j])));
+
+    if (length - j) {
+        __mmask8 mask = (__mmask8)((1U << (length - j)) - 1);
+
+        _mm512_mask_storeu_pd(&result[j], mask,
+                              erfcinv_v8(_mm512_maskz_loadu_pd(mask, &input[j])));
+    }
+}
+#else
+void ALM_PROTO_OPT(vrda_erfcinv)(int length, double *input, double *result)
+{
+    int j = 0;
+
+    for (j = 0; j <= length - DOUBLE_ELEMENTS_256_BIT; j += DOUBLE_ELEMENTS_256_BIT)
+        _mm256_storeu_pd(&result[j], erfcinv_v4(_mm256_loadu_pd(&input[j])));
+
+    if (length - j) {
+        __m256i mask = GET_MASK_DOUBLE_256_BIT(length - j);
+
+        _mm256_maskstore_pd(&result[j], mask,
+                            erfcinv_v4(_mm256_maskload_pd(&input[j], mask)));
+    }
+}
+#endif
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrda_frexp(int length, double *input, double *mant, int *expo)
+ *
+ * vrda_frexp() breaks 'length' number of elements present in the 'input'
+ * array into normalized fractions, stored in the 'mant' array, and
+ * integral powers of two, stored in the 'expo' array.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Pack 4 elements of input array into a 256-bit register
+ *         call vrd4_frexp()
+ *     Store the outputs into mant and expo arrays.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Pack the elements of input array into a 256-bit register
+ *     Mask the inputs which are not needed to be computed with a 0.
+ *         call vrd4_frexp()
+ *     Store the output of unmasked elements into mant and expo arrays.
+ * Return
+ *
+ * Remaining elements are masked rather than recomputed, so that 'input'
+ * and 'mant' can be the same array.
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+/* Narrow 4 x int64 to 4 x int32, every element fits in 32 bits */
+static inline __m128i
+vrd4_frexp_narrow(__m256i v)
+{
+    const __m256i idx = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(v, idx));
+}
+
+void ALM_PROTO_OPT(vrda_frexp)(int length, double *input, double *mant, int *expo)
+{
+    int j = 0;
+    __m256i e4;
+
+    for (j = 0; j <= length - DOUBLE_ELEMENTS_256_BIT; j += DOUBLE_ELEMENTS_256_BIT)
+    {
+        __m256d ip4 = _mm256_loadu_pd(&input[j]);
+        __m256d op4 = ALM_PROTO(vrd4_frexp)(ip4, &e4);
+        _mm256_storeu_pd(&mant[j], op4);
+        _mm_storeu_si128((__m128i *)&expo[j], vrd4_frexp_narrow(e4));
+    }
+
+    if (length - j)
+    {
+        __m256i mask = GET_MASK_DOUBLE_256_BIT(length - j);
+        __m256d ip4 = _mm256_maskload_pd(&input[j], mask);
+        __m256d op4 = ALM_PROTO(vrd4_frexp)(ip4, &e4);
+        _mm256_maskstore_pd(&mant[j], mask, op4);
+        _mm_maskstore_epi32(&expo[j], vrd4_frexp_narrow(mask), vrd4_frexp_narrow(e4));
+    }
+}
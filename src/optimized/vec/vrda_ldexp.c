@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrda_ldexp(int length, double *input, int *expo, double *result)
+ *
+ * vrda_ldexp() computes input[i] * 2^expo[i] for 'length' number of
+ * elements present in the 'input' and 'expo' arrays.
+ * The corresponding ouput is stored in the 'result' array.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Pack 4 elements of input and expo arrays into 256-bit registers
+ *         call vrd4_ldexp()
+ *     Store the output into result array.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Pack the elements of input and expo arrays into 256-bit registers
+ *     Mask the inputs which are not needed to be computed with a 0.
+ *         call vrd4_ldexp()
+ *     Store the output of unmasked elements into result array.
+ * Return
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+void ALM_PROTO_OPT(vrda_ldexp)(int length, double *input, int *expo, double *result)
+{
+    int j = 0;
+
+    for (j = 0; j <= length - DOUBLE_ELEMENTS_256_BIT; j += DOUBLE_ELEMENTS_256_BIT)
+    {
+        __m256d ip4 = _mm256_loadu_pd(&input[j]);
+        __m256i n4 = _mm256_cvtepi32_epi64(_mm_loadu_si128((__m128i *)&expo[j]));
+        __m256d op4 = ALM_PROTO(vrd4_ldexp)(ip4, n4);
+        _mm256_storeu_pd(&result[j], op4);
+    }
+
+    if (length - j)
+    {
+        __m256i mask = GET_MASK_DOUBLE_256_BIT(length - j);
+        __m128i mask32 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(mask,
+                                                _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+        __m256d ip4 = _mm256_maskload_pd(&input[j], mask);
+        __m256i n4 = _mm256_cvtepi32_epi64(_mm_maskload_epi32(&expo[j], mask32));
+        __m256d op4 = ALM_PROTO(vrd4_ldexp)(ip4, n4);
+        _mm256_maskstore_pd(&result[j], mask, op4);
+    }
+}
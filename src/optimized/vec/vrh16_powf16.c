@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * __m256i amd_vrh16_powf16(__m256i x, __m256i y)
+ *
+ * Implementation Notes:
+ *  Computes x raised to the power y for 16 half precision elements held as IEEE
+ *  binary16 bit patterns in a 256-bit register.
+ *
+ *  Each 128-bit half of the register is widened to float with F16C,
+ *  evaluated by vrs8_powf() and rounded to nearest even half precision.
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+
+__m256i
+ALM_PROTO_OPT(vrh16_powf16)(__m256i x, __m256i y)
+{
+    v_f32x8_t xlo = cvt_v8_f16_to_f32(_mm256_castsi256_si128(x));
+    v_f32x8_t xhi = cvt_v8_f16_to_f32(_mm256_extracti128_si256(x, 1));
+    v_f32x8_t ylo = cvt_v8_f16_to_f32(_mm256_castsi256_si128(y));
+    v_f32x8_t yhi = cvt_v8_f16_to_f32(_mm256_extracti128_si256(y, 1));
+
+    v_f32x8_t rlo = ALM_PROTO(vrs8_powf)(xlo, ylo);
+    v_f32x8_t rhi = ALM_PROTO(vrs8_powf)(xhi, yhi);
+
+    return _mm256_set_m128i(cvt_v8_f32_to_f16(rhi), cvt_v8_f32_to_f16(rlo));
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrha_expf16(int length, f16_t *input, f16_t *result)
+ *
+ * vrha_expf16() computes e raised to the power x, for each x of the 'length' number
+ * of elements present in the 'input' array of half precision values.
+ * The corresponding output is stored in the 'result' array.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Pack 8 elements of input array into a 128-bit register
+ *         call vrh8_expf16()
+ *     Store the output into result array.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Copy them into a zero filled 8 element buffer
+ *         call vrh8_expf16()
+ *     Copy the output of the remaining elements into result array.
+ * Return
+ *
+ * There is no masked load or store for 16-bit elements in AVX2, the
+ * buffer keeps the remaining elements from reading or writing past the
+ * end of the arrays.
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/types.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+void ALM_PROTO_OPT(vrha_expf16)(int length, f16_t *input, f16_t *result)
+{
+    int j = 0;
+
+    for (j = 0; j <= length - HALF_ELEMENTS_128_BIT; j += HALF_ELEMENTS_128_BIT)
+    {
+        __m128i ip8 = _mm_loadu_si128((__m128i *)&input[j]);
+        __m128i op8 = ALM_PROTO(vrh8_expf16)(ip8);
+        _mm_storeu_si128((__m128i *)&result[j], op8);
+    }
+
+    if (length - j)
+    {
+        f16_t x[HALF_ELEMENTS_128_BIT] = { 0 };
+
+        for (int i = 0; i < length - j; i++)
+            x[i] = input[j + i];
+
+        __m128i op8 = ALM_PROTO(vrh8_expf16)(_mm_loadu_si128((__m128i *)x));
+        _mm_storeu_si128((__m128i *)x, op8);
+
+        for (int i = 0; i < length - j; i++)
+            result[j + i] = x[i];
+    }
+}
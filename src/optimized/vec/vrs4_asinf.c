@@ -54,7 +54,6 @@
 #include <libm/amd_funcs_internal.h>
 #include <libm/compiler.h>
 #include <libm/poly.h>
-#include "kern/sqrtf_pos.c" 
 
 static struct {
     v_f32x4_t THEEPS, HALF, ONE, poly_asinf[5];
@@ -112,16 +111,12 @@ ALM_PROTO_OPT(vrs4_asinf)(v_f32x4_t x)
 
     v_u32x4_t cmp = (v_u32x4_t)(r > V4_ASINF_HALF);
 
-    for (int i = 0; i < 4; i++) {
-        if (cmp[i]) {
-            G[i] = F_HALF *(F_ONE - r[i]);
-            r[i] = -TWO *ALM_PROTO_KERN(sqrtf)(G[i]);
-        } else {
-            n[i] = 0.0f;
-            G[i] = r[i] * r[i];
+    /* |x| > 0.5 uses asin(x) = pi/2 - 2*asin(sqrt((1 - x)/2)) */
+    v_f32x4_t Gh = V4_ASINF_HALF * (V4_ASINF_ONE - r);
 
-        }
-    }
+    G = sel_v4_f32(cmp, Gh, r * r);
+    r = sel_v4_f32(cmp, -TWO * _mm_sqrt_ps(Gh), r);
+    n = sel_v4_f32(cmp, n, _MM_SET1_PS4(0.0f));
 
     poly = r + r*G*POLY_EVAL_5(G,C1,C2,C3,C4,C5);
 
@@ -112,10 +112,25 @@ static struct {
 #define C4 v4_cosf_data.poly_cosf[4]
 
 
+/*
+ * |x| > ARG_MAX
+ * inf and nan give nan without leaving the vector path, only the finite
+ * arguments too large for the vector reduction go to the scalar cosf
+ */
 static inline v_f32x4_t
-cosf_specialcase(v_f32x4_t _x, v_f32x4_t result, v_u32x4_t cond)
+cosf_specialcase(v_f32x4_t _x,
+                 v_f32x4_t result,
+                 v_u32x4_t cond)
 {
-    return call_v4_f32(ALM_PROTO(cosf), _x, result, cond);
+    v_u32x4_t nonfinite = (v_u32x4_t)((as_v4_u32_f32(_x) & ~SIGNBIT_SP32) >= PINFBITPATT_SP32);
+
+    result = sel_v4_f32(nonfinite, _x - _x, result);
+    cond  &= ~nonfinite;
+
+    if (any_v4_u32_loop(cond))
+        result = call_v4_f32(ALM_PROTO(cosf), _x, result, cond);
+
+    return result;
 }
 
 
@@ -123,14 +123,6 @@ v_f32x4_t
 ALM_PROTO_OPT(vrs4_expf)(v_f32x4_t _x)
 {
 
-    v_u32x4_t vx = as_v4_u32_f32(_x);
-
-    // Get absolute value of vx
-    vx = vx & MASK;
-
-    // Check if -103 < vx < 88
-    v_u32x4_t cond = ((vx > ARG_MAX));
-
     // Convert _x to double precision
     v_f64x4_t x = cvt_v4_f32_to_f64(_x);
 
@@ -157,6 +149,15 @@ ALM_PROTO_OPT(vrs4_expf)(v_f32x4_t _x)
 
     v_f32x4_t ret = cvt_v4_f64_to_f32(result);
 
+#if !defined(ALM_FINITE_MATH)
+    v_u32x4_t vx = as_v4_u32_f32(_x);
+
+    // Get absolute value of vx
+    vx = vx & MASK;
+
+    // Check if -103 < vx < 88
+    v_u32x4_t cond = ((vx > ARG_MAX));
+
     if(unlikely(any_v4_u32_loop(cond))) {
 
         v_i32x4_t inf_condition = (v_i32x4_t)(_x > EXPF_MAX);
@@ -177,7 +178,7 @@ ALM_PROTO_OPT(vrs4_expf)(v_f32x4_t _x)
 
         return vy.f32x4;
     }
-
+#endif
 
     return ret;
 
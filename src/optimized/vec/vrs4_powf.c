@@ -99,18 +99,12 @@ static struct {
     v_f64x4_t ln2by_tblsz, tblsz_byln2, Huge;
     double_t ALIGN(16) poly[MAX_POLYDEGREE];
     v_u64x4_t expf_max, mask;
-    v_f32x4_t   expf_maxf, expf_minf;
-    v_i32x4_t   infinity;
 } expf_v4_data  = {
     .ln2by_tblsz = _MM_SET1_PD4(0x1.62e42fefa39efp-7),
     .tblsz_byln2 = _MM_SET1_PD4(0x1.71547652b82fep+0),
     .Huge = _MM_SET1_PD4(0x1.8000000000000p+52),
     .mask = _MM_SET1_I64(0x7fffffffffffffff),
     .expf_max = _MM_SET1_I64(0x4056000000000000),
-    .infinity    =  _MM_SET1_I32(0x7f800000),
-    .expf_minf    =  _MM_SET1_PS4(-0x1.9fe368p6f),
-
-    .expf_maxf    =  _MM_SET1_PS4(88.7228393f),
     .poly = {
         0x1.0000014439a91p0,
         0x1.62e43170e3344p-1,
@@ -136,9 +130,6 @@ static struct {
 #define INVLN2      expf_v4_data.tblsz_byln2
 #define EXPF_HUGE   expf_v4_data.Huge
 #define EXPF_MAX    expf_v4_data.expf_max
-#define EXPF_MAXF   expf_v4_data.expf_maxf
-#define EXPF_MINF   expf_v4_data.expf_minf
-#define INF         expf_v4_data.infinity
 #define DP64_MASK       expf_v4_data.mask
 /*
  * Short names for polynomial coefficients
@@ -273,7 +264,8 @@ ALM_PROTO_OPT(vrs4_powf)(__m128 _x,__m128 _y)
 
     u = as_v4_u32_f32(_x);
 
-    v_u32x4_t condition = (u >= V_MAX);
+    /* x negative, zero, denormal, inf or nan, and y nan (pow(1, nan) is 1) */
+    v_u32x4_t condition = ((u - V_MIN) >= (V_MAX - V_MIN)) | (v_u32x4_t)(_y != _y);
     
     v_f64x4_t yd = _mm256_cvtps_pd(_y);
 
@@ -337,42 +329,14 @@ ALM_PROTO_OPT(vrs4_powf)(__m128 _x,__m128 _y)
 
     ret = _mm256_cvtpd_ps(as_v4_f64_u64(as_v4_u64_f64(result) + (n << 52)));
 
-    if(check_corner_case(condition2, condition)) {
-
-        v_u32x4_t negative = (v_u32x4_t)(_x < ZERO);
-
-        /*call scalar powf for all inputs */
-        if(any_v4_u32_loop(negative)) {
-
-            return (v_f32x4_t) {powf(_x[0], _y[0]),
-                                powf(_x[1], _y[1]),
-                                powf(_x[2], _y[2]),
-                                powf(_x[3], _y[3])};
-
-        }
-
-        v_f32x4_t x = _mm256_cvtpd_ps(ylogx);
-
-        v_i32x4_t inf_condition = (v_i32x4_t)(x > EXPF_MAXF);
-
-        /* set infinity to values of x greater than infinity */
-        inf_condition |= condition; 
-
-        v_i32x4_t zero_condition = (v_i32x4_t)(x < EXPF_MINF);
-
-        v_32x4 vx = {.f32x4 = ret};
-
-        /* Zero out the elements that have to be set to infinity */
-        vx.i32x4 = vx.i32x4 & (~inf_condition);
-
-        inf_condition = inf_condition & INF;
-
-        vx.i32x4 = vx.i32x4 | inf_condition;
-
-        vx.i32x4 = vx.i32x4 & (~zero_condition);
-
-        ret = vx.f32x4;
-    }
+    /*
+     * x negative, zero, denormal, inf or nan, y nan, and y * log(x) out of
+     * range: x and y are exact in double, the whole vector is recomputed
+     * by vrd4_pow, whose special cases are blended in the vector unit, and
+     * rounded to float once
+     */
+    if(unlikely(check_corner_case(condition2, condition)))
+        ret = _mm256_cvtpd_ps(ALM_PROTO(vrd4_pow)(_mm256_cvtps_pd(_x), yd));
 
     return ret;
 
@@ -54,7 +54,6 @@
 #include <libm/amd_funcs_internal.h>
 #include <libm/compiler.h>
 #include <libm/poly.h>
-#include "kern/sqrtf_pos.c"
 
 static struct {
     v_f32x8_t THEEPS, HALF, ONE, poly_asinf[5], PI_BY_TWO;
@@ -99,9 +98,6 @@ static struct {
 #define C4 v8_asinf_data.poly_asinf[3]
 #define C5 v8_asinf_data.poly_asinf[4]
 
-#define ZERO        0
-#define EIGHT       8
-
 v_f32x8_t
 ALM_PROTO_OPT(vrs8_asinf)(v_f32x8_t x)
 {
@@ -117,15 +113,12 @@ ALM_PROTO_OPT(vrs8_asinf)(v_f32x8_t x)
 
     v_u32x8_t cmp = (v_u32x8_t)((r) > (V8_ASINF_HALF));
 
-    for (int i = ZERO; i < EIGHT; i++) {
-        if (cmp[i]) {
-            G[i] = F_HALF *(F_ONE - r[i]);
-            r[i] = -TWO *ALM_PROTO_KERN(sqrtf)(G[i]);
-        } else {
-            n[i] = 0.0f;
-            G[i] = r[i] * r[i];
-        }
-    }
+    /* |x| > 0.5 uses asin(x) = pi/2 - 2*asin(sqrt((1 - x)/2)) */
+    v_f32x8_t Gh = V8_ASINF_HALF * (V8_ASINF_ONE - r);
+
+    G = sel_v8_f32(cmp, Gh, r * r);
+    r = sel_v8_f32(cmp, -TWO * _mm256_sqrt_ps(Gh), r);
+    n = sel_v8_f32(cmp, n, _MM_SET1_PS8(0.0f));
 
     poly = r + r*G*POLY_EVAL_5(G,C1,C2,C3,C4,C5);
 
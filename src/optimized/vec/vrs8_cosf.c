@@ -110,7 +110,27 @@ static struct {
 #define C4 v8_cosf_data.poly_cosf[4]
 
 #define COSF_ARG_MAX 0x4A989680
-#define SCALAR_COSF ALM_PROTO(cosf)
+
+/*
+ * |x| > ARG_MAX
+ * inf and nan give nan without leaving the vector path, only the finite
+ * arguments too large for the vector reduction go to the scalar cosf
+ */
+static inline v_f32x8_t
+cosf_specialcase(v_f32x8_t _x,
+                 v_f32x8_t result,
+                 v_u32x8_t cond)
+{
+    v_u32x8_t nonfinite = (v_u32x8_t)((as_v8_u32_f32(_x) & ~SIGNBIT_SP32) >= PINFBITPATT_SP32);
+
+    result = sel_v8_f32(nonfinite, _x - _x, result);
+    cond  &= ~nonfinite;
+
+    if (any_v8_u32_loop(cond))
+        result = call_v8_f32(ALM_PROTO(cosf), _x, result, cond);
+
+    return result;
+}
 
 v_f32x8_t
 ALM_PROTO_OPT(vrs8_cosf)(v_f32x8_t x)
@@ -147,13 +167,13 @@ ALM_PROTO_OPT(vrs8_cosf)(v_f32x8_t x)
     result = as_v8_f32_u32(as_v8_u32_f32(poly) ^ odd);
 
     /* Check for special cases */
-    /* If input value is outside valid range, call scalar cosf(value) */
+    /* If input value is outside valid range, fix up those lanes */
     /* Otherwise, return the above computed result */
-    for(int i = 0; i < 8; i++)
-    {
-        if(unlikely(ux[i] > COSF_ARG_MAX))
-            result[i] = SCALAR_COSF(x[i]);
-    }
+    v_u32x8_t cond = (v_u32x8_t)(ux > COSF_ARG_MAX);
+
+    if (unlikely(any_v8_u32_loop(cond)))
+        result = cosf_specialcase(x, result, cond);
+
     return result;
 }
 
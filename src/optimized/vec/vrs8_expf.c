@@ -73,6 +73,7 @@ static const struct {
     v_f32x8_t   tblsz_byln2;
     v_f32x8_t   ln2_tbl_head, ln2_tbl_tail;
     v_f32x8_t   huge;
+    v_f32x8_t   clamp_max, clamp_min;
     v_i32x8_t   mask;
     v_i32x8_t   expf_bias;
     v_f32x8_t   poly_expf_5[5];
@@ -82,6 +83,8 @@ static const struct {
               .ln2_tbl_head = _MM256_SET1_PS8(0x1.63p-1),
               .ln2_tbl_tail = _MM256_SET1_PS8(-0x1.bd0104p-13),
               .huge        =  _MM256_SET1_PS8(0x1.8p+23) ,
+              .clamp_max   =  _MM256_SET1_PS8(0x1.64p+6f),
+              .clamp_min   =  _MM256_SET1_PS8(-0x1.ap+6f),
               .mask        =  _MM256_SET1_I32(0x7FFFFFFF),
               .expf_bias   =  _MM256_SET1_I32(127),
 
@@ -114,6 +117,8 @@ static const struct {
 #define EXPF_BIAS v_expf_data.expf_bias
 #define EXP_HUGE  v_expf_data.huge
 #define MASK      v_expf_data.mask
+#define CLAMP_MAX v_expf_data.clamp_max
+#define CLAMP_MIN v_expf_data.clamp_min
 
 // Coefficients for 5-degree polynomial
 #define A0 v_expf_data.poly_expf_5[0]
@@ -135,6 +140,34 @@ static const struct {
 
 #define SCALAR_EXPF ALM_PROTO_OPT(expf)
 
+/*
+ * |x| > ARG_MAX, nan and inf
+ * x is clamped to [-104, 89] so that n stays within 8 bits, and 2^n is
+ * applied as 2^(n/2) * 2^(n - n/2), both factors normal. The last multiply
+ * rounds once and gives inf on overflow, 0 or a subnormal on underflow.
+ * nan is left alone by the clamp and propagates through the polynomial.
+ */
+static inline v_f32x8_t
+expf_specialcase(v_f32x8_t x, v_f32x8_t ret, v_u32x8_t cond)
+{
+    v_f32x8_t xc = sel_v8_f32((v_u32x8_t)(x > CLAMP_MAX), CLAMP_MAX, x);
+    xc = sel_v8_f32((v_u32x8_t)(x < CLAMP_MIN), CLAMP_MIN, xc);
+
+    v_f32x8_t dn = xc * TBL_LN2 + EXP_HUGE;
+    v_i32x8_t n  = (v_i32x8_t)(as_v8_u32_f32(dn) - as_v8_u32_f32(EXP_HUGE));
+    dn = dn - EXP_HUGE;
+
+    v_f32x8_t r = (xc - dn * LN2_TBL_H) - dn * LN2_TBL_T;
+
+    v_f32x8_t poly = POLY_EVAL_5(r, A0, A0, A1, A2, A3, A4);
+
+    v_i32x8_t n1 = n >> 1;
+    v_f32x8_t s1 = as_v8_f32_u32((v_u32x8_t)((n1 + EXPF_BIAS) << 23));
+    v_f32x8_t s2 = as_v8_f32_u32((v_u32x8_t)((n - n1 + EXPF_BIAS) << 23));
+
+    return sel_v8_f32(cond, (poly * s1) * s2, ret);
+}
+
 /* this macro may be delted after converting macro*/
 v_f32x8_t ALM_PROTO_OPT(vrs8_expf_experimental)(v_f32x8_t _x);
 
@@ -259,13 +292,15 @@ ALM_PROTO_OPT(vrs8_expf)(v_f32x8_t _x)
     // result = polynomial * 2^m
     v_f32x8_t result = poly * as_v8_f32_u32(m);
 
-    // If input value is outside valid range, call scalar expf(value)
+#if !defined(ALM_FINITE_MATH)
+    // If input value is outside valid range, fix up those lanes
     // Else, return the above computed result
-    for(int i = 0 ; i < 8 ; i++)
-    {
-        if(unlikely(vx[i]) > ARG_MAX)
-            result[i] = SCALAR_EXPF(_x[i]);
-    }
+    v_u32x8_t cond = (v_u32x8_t)(vx > ARG_MAX);
+
+    if (unlikely(any_v8_u32_loop(cond)))
+        result = expf_specialcase(_x, result, cond);
+#endif
+
     return result;
 
 }
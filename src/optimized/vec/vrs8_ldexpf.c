@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * v_f32x8_t amd_vrs8_ldexpf(v_f32x8_t x, __m256i n)
+ *
+ * Implementation Notes:
+ *  Computes x * 2^n for each element.
+ *
+ *  The result exponent k = exponent(x) + n is computed in integer domain
+ *  and inserted directly into the bit pattern of x, denormal inputs are
+ *  first scaled by 2^32 to bring them to the normal range.
+ *  If k falls outside the normal range, the exponent is biased by 100
+ *  and the result is fixed up with a single multiplication by 2^-100
+ *  or 2^100, so that underflow/overflow are correctly rounded.
+ *
+ *  if x is +/-0, +/-inf or nan, return x
+ *  if the result overflows, return +/-inf
+ *  if the result underflows, return denormal/+-0
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+
+#define LDEXPF_MIN_NORMAL    0x00800000U
+/* 2^32 - 1.0 in exponent field */
+#define LDEXPF_DENORM_SCALE  0x10000000U
+#define LDEXPF_DENORM_BIAS   32
+/* Any n beyond this flushes all finite inputs to 0 or inf */
+#define LDEXPF_N_MAX         512
+#define LDEXPF_EXP_MAX       254
+#define LDEXPF_EXP_MIN       (-40)
+#define LDEXPF_EXP_ADJ       100
+#define LDEXPF_TWO_M100      0x0d800000U  /* 2^-100 */
+#define LDEXPF_TWO_P100      0x71800000U  /* 2^100  */
+
+v_f32x8_t
+ALM_PROTO_OPT(vrs8_ldexpf)(v_f32x8_t x, __m256i nv)
+{
+    v_i32x8_t n = (v_i32x8_t)nv;
+    v_u32x8_t ux = as_v8_u32_f32(x);
+    v_u32x8_t ax = ux & ~SIGNBIT_SP32;
+
+    v_i32x8_t denorm  = (ax != 0) & (ax < LDEXPF_MIN_NORMAL);
+    v_u32x8_t special = (v_u32x8_t)((ax == 0) | (ax >= EXPBITS_SP32));
+    v_i32x8_t cond;
+
+    /* Clamp n to [-LDEXPF_N_MAX, LDEXPF_N_MAX] */
+    cond = n > LDEXPF_N_MAX;
+    n = (n & ~cond) | (LDEXPF_N_MAX & cond);
+    cond = n < -LDEXPF_N_MAX;
+    n = (n & ~cond) | (-LDEXPF_N_MAX & cond);
+
+    /* Scale denormals by 2^32, rest of the elements by 1.0 */
+    v_f32x8_t scale = as_v8_f32_u32(ONEEXPBITS_SP32 + ((v_u32x8_t)denorm & LDEXPF_DENORM_SCALE));
+    v_u32x8_t uxs = as_v8_u32_f32(x * scale);
+
+    /* Biased exponent of the result */
+    v_i32x8_t k = (v_i32x8_t)((uxs & EXPBITS_SP32) >> 23) + n - (denorm & LDEXPF_DENORM_BIAS);
+
+    v_u32x8_t fix = _MM256_SET1_I32(ONEEXPBITS_SP32);
+
+    /* Result is denormal or zero */
+    cond = k < 1;
+    if (unlikely(any_v8_u32_loop((v_u32x8_t)cond))) {
+        v_i32x8_t kmin = k < LDEXPF_EXP_MIN;
+        v_i32x8_t kadj = ((k & ~kmin) | (LDEXPF_EXP_MIN & kmin)) + LDEXPF_EXP_ADJ;
+        k   = (k & ~cond) | (kadj & cond);
+        fix = (fix & ~(v_u32x8_t)cond) | (LDEXPF_TWO_M100 & (v_u32x8_t)cond);
+    }
+
+    /* Result overflows */
+    cond = k > LDEXPF_EXP_MAX;
+    if (unlikely(any_v8_u32_loop((v_u32x8_t)cond))) {
+        k   = (k & ~cond) | (LDEXPF_EXP_MAX & cond);
+        fix = (fix & ~(v_u32x8_t)cond) | (LDEXPF_TWO_P100 & (v_u32x8_t)cond);
+    }
+
+    v_u32x8_t uy = (uxs & ~EXPBITS_SP32) | ((v_u32x8_t)k << 23);
+    v_f32x8_t y = as_v8_f32_u32(uy) * as_v8_f32_u32(fix);
+
+    uy = (as_v8_u32_f32(y) & ~special) | (as_v8_u32_f32(x + x) & special);
+
+    return as_v8_f32_u32(uy);
+}
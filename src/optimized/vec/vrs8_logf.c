@@ -112,7 +112,7 @@ static const struct {
 #define V_F32(x) x.f32x8
 
 #define LOGF_MAX 0x7f800000
-#define SCALAR_LOGF ALM_PROTO(logf)
+#define LOGF_MIN_NORMAL 0x00800000
 
 /*
  * ISO-IEC-10967-2: Elementary Numerical Functions
@@ -167,6 +167,59 @@ static const struct {
  *
  */
 
+/* log(1 + r), r in [-1/3, 1/3] */
+static inline v_f32x8_t
+logf_poly(v_f32x8_t r)
+{
+    v_f32x8_t q;
+
+#if VRS4_LOGF_POLY_DEGREE == 7
+    /* n*ln2 + r + r2*(C1, + r*C2 + r2*(C3 + r*C4 + r2*(C5 + r*C6 + r2*(C7)))) */
+    q = POLY_EVAL_7(r, C0, C1, C2, C3, C4, C5, C6, C7);
+#elif VRS4_LOGF_POLY_DEGREE == 8
+    q = POLY_EVAL_8(r, C0, C1, C2, C3, C4, C5, C6, C7, C8);
+#elif VRS4_LOGF_POLY_DEGREE == 10
+    q = POLY_EVAL_10(r, C0, C1, C2, C3, C4, C5, C6, C7, C8, C9, C10);
+#endif
+
+    return q;
+}
+
+
+/*
+ * +/-0, denormals, negatives, inf and nan
+ * Denormals are scaled by 2^23 and go through the main path with the
+ * exponent adjusted, the rest get their fixed results blended in.
+ */
+static inline v_f32x8_t
+logf_specialcase(v_f32x8_t _x,
+                 v_f32x8_t result,
+                 v_u32x8_t cond)
+{
+    v_u32x8_t ux = as_v8_u32_f32(_x);
+    v_u32x8_t denorm = (v_u32x8_t)(ux - 1 < LOGF_MIN_NORMAL - 1);
+
+    if (any_v8_u32_loop(denorm)) {
+        v_u32x8_t vx = as_v8_u32_f32(_x * 0x1p23f) - V_OFF;
+
+        v_f32x8_t n = cast_v8_i32_to_f32(((v_i32x8_t)vx) >> 23) - 23.0f;
+
+        vx = (vx & V_MASK) + V_OFF;
+
+        v_f32x8_t q = logf_poly(as_v8_f32_u32(vx) - V_ONE);
+
+        result = sel_v8_f32(denorm, n * LN2 + q, result);
+    }
+
+    result = sel_v8_f32((v_u32x8_t)((ux << 1) == 0), _MM_SET1_PS8(-(float)INFINITY), result);
+    result = sel_v8_f32((v_u32x8_t)(ux > SIGNBIT_SP32), _MM_SET1_PS8((float)NAN), result);
+    result = sel_v8_f32((v_u32x8_t)(ux == PINFBITPATT_SP32), _x, result);
+    result = sel_v8_f32((v_u32x8_t)((ux & ~SIGNBIT_SP32) > PINFBITPATT_SP32), _x + _x, result);
+
+    return result;
+}
+
+
 v_f32x8_t
 ALM_PROTO_OPT(vrs8_logf)(v_f32x8_t _x)
 {
@@ -184,23 +237,21 @@ ALM_PROTO_OPT(vrs8_logf)(v_f32x8_t _x)
 
     r = as_v8_f32_u32(vx) - V_ONE;
 
-#if VRS4_LOGF_POLY_DEGREE == 7
-    /* n*ln2 + r + r2*(C1, + r*C2 + r2*(C3 + r*C4 + r2*(C5 + r*C6 + r2*(C7)))) */
-    q = POLY_EVAL_7(r, C0, C1, C2, C3, C4, C5, C6, C7);
-#elif VRS4_LOGF_POLY_DEGREE == 8
-    q = POLY_EVAL_8(r, C0, C1, C2, C3, C4, C5, C6, C7, C8);
-#elif VRS4_LOGF_POLY_DEGREE == 10
-    q = POLY_EVAL_10(r, C0, C1, C2, C3, C4, C5, C6, C7, C8, C9, C10);
-#endif
+    q = logf_poly(r);
 
     q = n * LN2 + q;
 
+    /* +/-0, denormals, negatives, inf and nan */
     vx =  as_v8_u32_f32(_x);
-    for(int i = 0; i < 8; i++)
-    {
-        if(unlikely(vx[i] > LOGF_MAX))
-            q[i] = SCALAR_LOGF(_x[i]);
+
+#if !defined(ALM_FINITE_MATH)
+    v_u32x8_t cond = (v_u32x8_t)(vx - LOGF_MIN_NORMAL >= LOGF_MAX - LOGF_MIN_NORMAL);
+
+    if (unlikely(any_v8_u32_loop(cond))) {
+        return logf_specialcase(_x, q, cond);
     }
+#endif
+
     return q;
 }
 
@@ -100,14 +100,25 @@ static struct {
 #define C9  v8_sinf_data.poly_sinf[4]
 
 
+/*
+ * |x| > ARG_MAX
+ * inf and nan give nan without leaving the vector path, only the finite
+ * arguments too large for the vector reduction go to the scalar sinf
+ */
 static inline v_f32x8_t
 sinf_specialcase(v_f32x8_t _x,
                  v_f32x8_t result,
                  v_u32x8_t cond)
 {
+    v_u32x8_t nonfinite = (v_u32x8_t)((as_v8_u32_f32(_x) & ~SIGNBIT_SP32) >= PINFBITPATT_SP32);
 
-    return call_v8_f32(ALM_PROTO(sinf), _x, result, cond);
+    result = sel_v8_f32(nonfinite, _x - _x, result);
+    cond  &= ~nonfinite;
 
+    if (any_v8_u32_loop(cond))
+        result = call_v8_f32(ALM_PROTO(sinf), _x, result, cond);
+
+    return result;
 }
 
 v_f32x8_t
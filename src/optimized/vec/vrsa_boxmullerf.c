@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrsa_boxmullerf(int length, float *u1, float *u2, float *z0, float *z1)
+ *
+ * vrsa_boxmullerf() turns 'length' pairs of uniform deviates from the 'u1' and
+ * 'u2' arrays into pairs of independent standard normal deviates with
+ * the Box-Muller transform,
+ *     z0 = sqrt(-2 log(u1)) * cos(2 pi u2)
+ *     z1 = sqrt(-2 log(u1)) * sin(2 pi u2)
+ * and stores them in the 'z0' and 'z1' arrays.
+ *
+ * u1 is expected in (0, 1] and u2 in [0, 1). u1 = 0 gives infinite
+ * results.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Load 8 elements of u1 and u2 into 256-bit registers
+ *         call vrs8_logf() and vrs8_sincosf()
+ *     Compute the radius with a square root and scale cos and sin by it
+ *     Store z0 and z1.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Load them with a mask, the u1 lanes which are not needed are 1
+ *     and the u2 ones 0, so that log() does not raise FE_DIVBYZERO.
+ *     Store the results of unmasked elements.
+ * Return
+ *
+ * On zen4/zen5 the same is done 16 elements at a time with vrs16_logf()
+ * and vrs16_sincosf().
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+#define BOXMULLER_TWO_PI    0x1.921fb6p+2f
+
+#if defined(__AVX512F__)
+static inline void
+vrsa_boxmullerf_v16(__m512 u1, __m512 u2, __m512 *z0, __m512 *z1)
+{
+    __m512 r = _mm512_sqrt_ps(_mm512_mul_ps(_mm512_set1_ps(-2.0f), ALM_PROTO_ARCH(vrs16_logf)(u1)));
+    __m512 s, c;
+
+    ALM_PROTO_ARCH(vrs16_sincosf)(_mm512_mul_ps(u2, _mm512_set1_ps(BOXMULLER_TWO_PI)), &s, &c);
+
+    *z0 = _mm512_mul_ps(r, c);
+    *z1 = _mm512_mul_ps(r, s);
+}
+
+void ALM_PROTO_OPT(vrsa_boxmullerf)(int length, float *u1, float *u2, float *z0, float *z1)
+{
+    int j = 0;
+    __m512 r0, r1;
+
+    for (j = 0; j <= length - FLOAT_ELEMENTS_512_BIT; j += FLOAT_ELEMENTS_512_BIT)
+    {
+        vrsa_boxmullerf_v16(_mm512_loadu_ps(&u1[j]), _mm512_loadu_ps(&u2[j]), &r0, &r1);
+        _mm512_storeu_ps(&z0[j], r0);
+        _mm512_storeu_ps(&z1[j], r1);
+    }
+
+    if (length - j)
+    {
+        __mmask16 mask = (__mmask16)((1U << (length - j)) - 1);
+
+        vrsa_boxmullerf_v16(_mm512_mask_loadu_ps(_mm512_set1_ps(1.0f), mask, &u1[j]),
+                            _mm512_maskz_loadu_ps(mask, &u2[j]), &r0, &r1);
+        _mm512_mask_storeu_ps(&z0[j], mask, r0);
+        _mm512_mask_storeu_ps(&z1[j], mask, r1);
+    }
+}
+#else
+static inline void
+vrsa_boxmullerf_v8(__m256 u1, __m256 u2, __m256 *z0, __m256 *z1)
+{
+    __m256 r = _mm256_sqrt_ps(_mm256_mul_ps(_mm256_set1_ps(-2.0f), ALM_PROTO(vrs8_logf)(u1)));
+    __m256 s, c;
+
+    ALM_PROTO(vrs8_sincosf)(_mm256_mul_ps(u2, _mm256_set1_ps(BOXMULLER_TWO_PI)), &s, &c);
+
+    *z0 = _mm256_mul_ps(r, c);
+    *z1 = _mm256_mul_ps(r, s);
+}
+
+void ALM_PROTO_OPT(vrsa_boxmullerf)(int length, float *u1, float *u2, float *z0, float *z1)
+{
+    int j = 0;
+    __m256 r0, r1;
+
+    for (j = 0; j <= length - FLOAT_ELEMENTS_256_BIT; j += FLOAT_ELEMENTS_256_BIT)
+    {
+        vrsa_boxmullerf_v8(_mm256_loadu_ps(&u1[j]), _mm256_loadu_ps(&u2[j]), &r0, &r1);
+        _mm256_storeu_ps(&z0[j], r0);
+        _mm256_storeu_ps(&z1[j], r1);
+    }
+
+    if (length - j)
+    {
+        __m256i mask = GET_MASK_FLOAT_256_BIT(length - j);
+        __m256 v1 = _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_maskload_ps(&u1[j], mask),
+                                     _mm256_castsi256_ps(mask));
+
+        vrsa_boxmullerf_v8(v1, _mm256_maskload_ps(&u2[j], mask), &r0, &r1);
+        _mm256_maskstore_ps(&z0[j], mask, r0);
+        _mm256_maskstore_ps(&z1[j], mask, r1);
+    }
+}
+#endif
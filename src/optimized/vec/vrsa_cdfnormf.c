@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrsa_cdfnormf(int length, float *input, float *result)
+ *
+ * vrsa_cdfnormf() computes the standard normal cumulative distribution
+ * function for 'length' number of elements present in the 'input' array.
+ * The corresponding output is stored in the 'result' array.
+ *
+ * x = -inf gives 0, +inf gives 1.
+ * NaN gives NaN.
+ *
+ * Maximum ULP is 0.50
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * See libm/erfc-common.h for the algorithm.
+ *
+ * The elements are evaluated in double precision, 8 at a time as two
+ * halves with the vrd4 kernel, and on zen4/zen5 16 at a time as two
+ * halves with the vrd8 kernel. The remaining elements are loaded and
+ * stored with a mask.
+ */
+#include <libm/erfc-common.h>
+
+#if defined(__AVX512F__)
+void ALM_PROTO_OPT(vrsa_cdfnormf)(int length, float *input, float *result)
+{
+    int j = 0;
+
+    for (j = 0; j <= length - FLOAT_ELEMENTS_512_BIT; j += FLOAT_ELEMENTS_512_BIT)
+        _mm512_storeu_ps(&result[j], ERFC_V16F_VIA_F64(cdfnorm_v8, _mm512_loadu_ps(&input[j])));
+
+    if (length - j) {
+        __mmask16 mask = (__mmask16)((1U << (length - j)) - 1);
+        v_f32x16_t x = _mm512_maskz_loadu_ps(mask, &input[j]);
+
+        _mm512_mask_storeu_ps(&result[j], mask, ERFC_V16F_VIA_F64(cdfnorm_v8, x));
+    }
+}
+#else
+void ALM_PROTO_OPT(vrsa_cdfnormf)(int length, float *input, float *result)
+{
+    int j = 0;
+
+    for (j = 0; j <= length - FLOAT_ELEMENTS_256_BIT; j += FLOAT_ELEMENTS_256_BIT)
+        _mm256_storeu_ps(&result[j], ERFC_V8F_VIA_F64(cdfnorm_v4, _mm256_loadu_ps(&input[j])));
+
+    if (length - j) {
+        __m256i mask = GET_MASK_FLOAT_256_BIT(length - j);
+        v_f32x8_t x = _mm256_maskload_ps(&input[j], mask);
+
+        _mm256_maskstore_ps(&result[j], mask, ERFC_V8F_VIA_F64(cdfnorm_v4, x));
+    }
+}
+#endif
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrsa_gelu_tanhf(int length, float *input, float *result)
+ *
+ * vrsa_gelu_tanhf() computes the tanh approximation of gelu,
+ * x / 2 * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 x^3))), for each x of the 'length'
+ * number of elements present in the 'input' array.
+ * The corresponding output is stored in the 'result' array.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Pack 8 elements of input array into a 256-bit register
+ *         call act_gelu_tanh_v8(), built on vrs8_expf()
+ *     Store the output into result array.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Load them with a mask, compute as above and store the unmasked
+ *     elements into result array.
+ * Return
+ *
+ * On zen4/zen5 the same is done 16 elements at a time with act_gelu_tanh_v16(),
+ * built on vrs16_expf().
+ *
+ * Refer include/libm/activation-vec.h for the formulas.
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+#include <libm/activation-vec.h>
+
+void ALM_PROTO_OPT(vrsa_gelu_tanhf)(int length, float *input, float *result)
+{
+    int j = 0;
+
+#if defined(__AVX512F__)
+    for (j = 0; j <= length - FLOAT_ELEMENTS_512_BIT; j += FLOAT_ELEMENTS_512_BIT)
+    {
+        v_f32x16_t x = _mm512_loadu_ps(&input[j]);
+        _mm512_storeu_ps(&result[j], act_gelu_tanh_v16(x));
+    }
+
+    if (length - j)
+    {
+        __mmask16 mask = (__mmask16)((1U << (length - j)) - 1);
+        v_f32x16_t x = _mm512_maskz_loadu_ps(mask, &input[j]);
+        _mm512_mask_storeu_ps(&result[j], mask, act_gelu_tanh_v16(x));
+    }
+#else
+    for (j = 0; j <= length - FLOAT_ELEMENTS_256_BIT; j += FLOAT_ELEMENTS_256_BIT)
+    {
+        v_f32x8_t x = _mm256_loadu_ps(&input[j]);
+        _mm256_storeu_ps(&result[j], act_gelu_tanh_v8(x));
+    }
+
+    if (length - j)
+    {
+        __m256i mask = GET_MASK_FLOAT_256_BIT(length - j);
+        v_f32x8_t x = _mm256_maskload_ps(&input[j], mask);
+        _mm256_maskstore_ps(&result[j], mask, act_gelu_tanh_v8(x));
+    }
+#endif
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrsa_polarf(int length, float *r, float *theta, fc32_t *z)
+ *
+ * vrsa_polarf() computes r * (cos(theta) + i sin(theta)) for 'length'
+ * number of elements of the 'r' and 'theta' arrays,
+ * and stores the results in the 'z' array of interleaved (re, im)
+ * complex numbers.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Load 8 elements of theta and r into 256-bit registers
+ *         call vrs8_sincosf()
+ *     Scale cos and sin by r
+ *     Interleave cos and sin into 8 complex numbers and store them.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Load them with a mask, the inputs which are not needed are 0.
+ *         call vrs8_sincosf()
+ *     Store the results of unmasked elements.
+ * Return
+ *
+ * On zen4/zen5 the same is done 16 elements at a time with vrs16_sincosf().
+ *
+ * This replaces vrsa_sincosf() followed by scaling and interleaving
+ * with a single pass over memory.
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+#if defined(__AVX512F__)
+/* Interleave 16 cos and sin values into 16 complex numbers */
+static inline void
+vrsa_polarf_interleave(__m512 c, __m512 s, __m512 *lo, __m512 *hi)
+{
+    *lo = _mm512_permutex2var_ps(c, _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19,
+                                                      4, 20, 5, 21, 6, 22, 7, 23), s);
+    *hi = _mm512_permutex2var_ps(c, _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27,
+                                                      12, 28, 13, 29, 14, 30, 15, 31), s);
+}
+
+void ALM_PROTO_OPT(vrsa_polarf)(int length, float *r, float *theta, fc32_t *z)
+{
+    int j = 0;
+    float *pz = (float *)z;
+    __m512 s, c, lo, hi;
+
+    for (j = 0; j <= length - FLOAT_ELEMENTS_512_BIT; j += FLOAT_ELEMENTS_512_BIT)
+    {
+        __m512 vr = _mm512_loadu_ps(&r[j]);
+        ALM_PROTO_ARCH(vrs16_sincosf)(_mm512_loadu_ps(&theta[j]), &s, &c);
+        vrsa_polarf_interleave(_mm512_mul_ps(vr, c), _mm512_mul_ps(vr, s), &lo, &hi);
+        _mm512_storeu_ps(&pz[2 * j], lo);
+        _mm512_storeu_ps(&pz[2 * j + 16], hi);
+    }
+
+    if (length - j)
+    {
+        __mmask16 mask = (__mmask16)((1U << (length - j)) - 1);
+        uint32_t  mout = (1U << (2 * (length - j))) - 1;
+
+        __m512 vr = _mm512_maskz_loadu_ps(mask, &r[j]);
+        ALM_PROTO_ARCH(vrs16_sincosf)(_mm512_maskz_loadu_ps(mask, &theta[j]), &s, &c);
+        vrsa_polarf_interleave(_mm512_mul_ps(vr, c), _mm512_mul_ps(vr, s), &lo, &hi);
+        _mm512_mask_storeu_ps(&pz[2 * j], (__mmask16)mout, lo);
+        _mm512_mask_storeu_ps(&pz[2 * j + 16], (__mmask16)(mout >> 16), hi);
+    }
+}
+#else
+/* Interleave 8 cos and sin values into 8 complex numbers */
+static inline void
+vrsa_polarf_interleave(__m256 c, __m256 s, __m256 *lo, __m256 *hi)
+{
+    __m256 a = _mm256_unpacklo_ps(c, s);
+    __m256 b = _mm256_unpackhi_ps(c, s);
+
+    *lo = _mm256_permute2f128_ps(a, b, 0x20);
+    *hi = _mm256_permute2f128_ps(a, b, 0x31);
+}
+
+/* Masks for the first n of the 16 floats held in a pair of registers */
+static inline void
+vrsa_polarf_tail_mask(int n, __m256i *mlo, __m256i *mhi)
+{
+    __m256i vn = _mm256_set1_epi32(n);
+    *mlo = _mm256_cmpgt_epi32(vn, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    *mhi = _mm256_cmpgt_epi32(vn, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15));
+}
+
+void ALM_PROTO_OPT(vrsa_polarf)(int length, float *r, float *theta, fc32_t *z)
+{
+    int j = 0;
+    float *pz = (float *)z;
+    __m256 s, c, lo, hi;
+
+    for (j = 0; j <= length - FLOAT_ELEMENTS_256_BIT; j += FLOAT_ELEMENTS_256_BIT)
+    {
+        __m256 vr = _mm256_loadu_ps(&r[j]);
+        ALM_PROTO(vrs8_sincosf)(_mm256_loadu_ps(&theta[j]), &s, &c);
+        vrsa_polarf_interleave(_mm256_mul_ps(vr, c), _mm256_mul_ps(vr, s), &lo, &hi);
+        _mm256_storeu_ps(&pz[2 * j], lo);
+        _mm256_storeu_ps(&pz[2 * j + 8], hi);
+    }
+
+    if (length - j)
+    {
+        __m256i mask = GET_MASK_FLOAT_256_BIT(length - j);
+        __m256i mlo, mhi;
+
+        vrsa_polarf_tail_mask(2 * (length - j), &mlo, &mhi);
+        __m256 vr = _mm256_maskload_ps(&r[j], mask);
+        ALM_PROTO(vrs8_sincosf)(_mm256_maskload_ps(&theta[j], mask), &s, &c);
+        vrsa_polarf_interleave(_mm256_mul_ps(vr, c), _mm256_mul_ps(vr, s), &lo, &hi);
+        _mm256_maskstore_ps(&pz[2 * j], mlo, lo);
+        _mm256_maskstore_ps(&pz[2 * j + 8], mhi, hi);
+    }
+}
+#endif
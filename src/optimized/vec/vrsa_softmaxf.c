@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrsa_softmaxf(int rows, int cols, float *input, float *result)
+ *
+ * vrsa_softmaxf() computes the softmax of each of the 'rows' rows of
+ * 'cols' elements of the row-major 'input' matrix,
+ *     result[i][j] = exp(input[i][j]) / sum_k(exp(input[i][k]))
+ * The corresponding output is stored in the 'result' matrix, which may
+ * be the same as 'input'.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For each row,
+ *     Find the maximum m of the row
+ *     Compute e = exp(x - m) 8 elements at a time with vrs8_expf(), store
+ *     e into result and accumulate it in double
+ *     Scale result by 1 / sum
+ *
+ * Subtracting m keeps exp from overflowing, the largest term is 1. The
+ * rounding error r of x - m is recovered with TwoSum and folded back in
+ * as exp(x - m) ~ e + e * r, since exp amplifies it by |x - m|. The
+ * remaining elements of each pass are loaded with a mask, the masked
+ * lanes are set to -inf so that they contribute neither to the maximum
+ * nor to the sum.
+ *
+ * On zen4/zen5 the same is done 16 elements at a time with vrs16_expf().
+ *
+ * A row holding a NaN or +inf, or only -inf, gives a row of NaN.
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+#include <math.h>
+
+#if defined(__AVX512F__)
+/* exp(x - m), with the rounding error of x - m added back */
+static inline __m512
+vrsa_softmaxf_exp(__m512 x, __m512 vm)
+{
+    __m512 d  = _mm512_sub_ps(x, vm);
+    __m512 bb = _mm512_sub_ps(d, x);
+    __m512 r  = _mm512_sub_ps(_mm512_sub_ps(x, _mm512_sub_ps(d, bb)), _mm512_add_ps(vm, bb));
+    __m512 e  = ALM_PROTO_ARCH(vrs16_expf)(d);
+
+    /* r is NaN when x is -inf */
+    r = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(r, r, _CMP_ORD_Q), r);
+
+    return _mm512_fmadd_ps(e, r, e);
+}
+
+static void
+vrsa_softmaxf_row(const float *x, float *y, int n)
+{
+    __m512 ninf = _mm512_set1_ps(-INFINITY);
+    __m512 vmax = ninf;
+    __m512d s0 = _mm512_setzero_pd();
+    __m512d s1 = _mm512_setzero_pd();
+    __m512 vm, e, vinv;
+    __mmask16 mask = (__mmask16)((1U << (n % FLOAT_ELEMENTS_512_BIT)) - 1);
+    int j;
+
+    for (j = 0; j <= n - FLOAT_ELEMENTS_512_BIT; j += FLOAT_ELEMENTS_512_BIT)
+        vmax = _mm512_max_ps(vmax, _mm512_loadu_ps(&x[j]));
+
+    if (n - j)
+        vmax = _mm512_max_ps(vmax, _mm512_mask_loadu_ps(ninf, mask, &x[j]));
+
+    vm = _mm512_set1_ps(_mm512_reduce_max_ps(vmax));
+
+    for (j = 0; j <= n - FLOAT_ELEMENTS_512_BIT; j += FLOAT_ELEMENTS_512_BIT) {
+        e = vrsa_softmaxf_exp(_mm512_loadu_ps(&x[j]), vm);
+        _mm512_storeu_ps(&y[j], e);
+        s0 = _mm512_add_pd(s0, _mm512_cvtps_pd(_mm512_castps512_ps256(e)));
+        s1 = _mm512_add_pd(s1, _mm512_cvtps_pd(_mm256_castpd_ps(
+                                   _mm512_extractf64x4_pd(_mm512_castps_pd(e), 1))));
+    }
+
+    if (n - j) {
+        e = vrsa_softmaxf_exp(_mm512_mask_loadu_ps(ninf, mask, &x[j]), vm);
+        _mm512_mask_storeu_ps(&y[j], mask, e);
+        s0 = _mm512_add_pd(s0, _mm512_cvtps_pd(_mm512_castps512_ps256(e)));
+        s1 = _mm512_add_pd(s1, _mm512_cvtps_pd(_mm256_castpd_ps(
+                                   _mm512_extractf64x4_pd(_mm512_castps_pd(e), 1))));
+    }
+
+    vinv = _mm512_set1_ps((float)(1.0 / _mm512_reduce_add_pd(_mm512_add_pd(s0, s1))));
+
+    for (j = 0; j <= n - FLOAT_ELEMENTS_512_BIT; j += FLOAT_ELEMENTS_512_BIT)
+        _mm512_storeu_ps(&y[j], _mm512_mul_ps(_mm512_loadu_ps(&y[j]), vinv));
+
+    if (n - j)
+        _mm512_mask_storeu_ps(&y[j], mask, _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, &y[j]), vinv));
+}
+#else
+/* exp(x - m), with the rounding error of x - m added back */
+static inline __m256
+vrsa_softmaxf_exp(__m256 x, __m256 vm)
+{
+    __m256 d  = _mm256_sub_ps(x, vm);
+    __m256 bb = _mm256_sub_ps(d, x);
+    __m256 r  = _mm256_sub_ps(_mm256_sub_ps(x, _mm256_sub_ps(d, bb)), _mm256_add_ps(vm, bb));
+    __m256 e  = ALM_PROTO(vrs8_expf)(d);
+
+    /* r is NaN when x is -inf */
+    r = _mm256_and_ps(r, _mm256_cmp_ps(r, r, _CMP_ORD_Q));
+
+    return _mm256_fmadd_ps(e, r, e);
+}
+
+static void
+vrsa_softmaxf_row(const float *x, float *y, int n)
+{
+    __m256 ninf = _mm256_set1_ps(-INFINITY);
+    __m256 vmax = ninf;
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+    __m256i mask = GET_MASK_FLOAT_256_BIT(n % FLOAT_ELEMENTS_256_BIT);
+    __m256 vm, e, vinv;
+    __m128 m4;
+    __m128d s;
+    int j;
+
+    for (j = 0; j <= n - FLOAT_ELEMENTS_256_BIT; j += FLOAT_ELEMENTS_256_BIT)
+        vmax = _mm256_max_ps(vmax, _mm256_loadu_ps(&x[j]));
+
+    if (n - j)
+        vmax = _mm256_max_ps(vmax, _mm256_blendv_ps(ninf, _mm256_maskload_ps(&x[j], mask),
+                                                     _mm256_castsi256_ps(mask)));
+
+    m4 = _mm_max_ps(_mm256_castps256_ps128(vmax), _mm256_extractf128_ps(vmax, 1));
+    m4 = _mm_max_ps(m4, _mm_movehl_ps(m4, m4));
+    m4 = _mm_max_ss(m4, _mm_shuffle_ps(m4, m4, 1));
+    vm = _mm256_broadcastss_ps(m4);
+
+    for (j = 0; j <= n - FLOAT_ELEMENTS_256_BIT; j += FLOAT_ELEMENTS_256_BIT) {
+        e = vrsa_softmaxf_exp(_mm256_loadu_ps(&x[j]), vm);
+        _mm256_storeu_ps(&y[j], e);
+        s0 = _mm256_add_pd(s0, _mm256_cvtps_pd(_mm256_castps256_ps128(e)));
+        s1 = _mm256_add_pd(s1, _mm256_cvtps_pd(_mm256_extractf128_ps(e, 1)));
+    }
+
+    if (n - j) {
+        e = _mm256_blendv_ps(ninf, _mm256_maskload_ps(&x[j], mask), _mm256_castsi256_ps(mask));
+        e = vrsa_softmaxf_exp(e, vm);
+        _mm256_maskstore_ps(&y[j], mask, e);
+        s0 = _mm256_add_pd(s0, _mm256_cvtps_pd(_mm256_castps256_ps128(e)));
+        s1 = _mm256_add_pd(s1, _mm256_cvtps_pd(_mm256_extractf128_ps(e, 1)));
+    }
+
+    s0 = _mm256_add_pd(s0, s1);
+    s  = _mm_add_pd(_mm256_castpd256_pd128(s0), _mm256_extractf128_pd(s0, 1));
+    s  = _mm_add_sd(s, _mm_unpackhi_pd(s, s));
+    vinv = _mm256_set1_ps((float)(1.0 / _mm_cvtsd_f64(s)));
+
+    for (j = 0; j <= n - FLOAT_ELEMENTS_256_BIT; j += FLOAT_ELEMENTS_256_BIT)
+        _mm256_storeu_ps(&y[j], _mm256_mul_ps(_mm256_loadu_ps(&y[j]), vinv));
+
+    if (n - j)
+        _mm256_maskstore_ps(&y[j], mask, _mm256_mul_ps(_mm256_maskload_ps(&y[j], mask), vinv));
+}
+#endif
+
+void ALM_PROTO_OPT(vrsa_softmaxf)(int rows, int cols, float *input, float *result)
+{
+    for (int i = 0; i < rows; i++, input += cols, result += cols)
+        vrsa_softmaxf_row(input, result, cols);
+}
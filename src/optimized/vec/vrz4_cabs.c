@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * __m256d amd_vrz4_cabs(__m256d re, __m256d im)
+ *
+ * Implementation Notes:
+ *  Computes |z| for 4 complex numbers z = re + I*im held in split form.
+ *
+ *  re and im are scaled by a common power of two before squaring, so that
+ *  the result neither overflows nor underflows unless it is not representable.
+ *
+ *  if re or im is +/-inf, return +inf, even if the other is nan
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+
+v_f64x4_t
+ALM_PROTO_OPT(vrz4_cabs)(v_f64x4_t re, v_f64x4_t im)
+{
+    v_f64x4_t a = re, b = im;
+    v_f64x4_t k = cmplx_scale_v4_f64(&a, &b);
+
+    v_f64x4_t r = _mm256_sqrt_pd(a * a + b * b) * cmplx_sel_v4_f64(k > 0, _MM_SET1_PD4(0x1p600),
+                                         cmplx_sel_v4_f64(k < 0, _MM_SET1_PD4(0x1p-600), _MM_SET1_PD4(1.0)));
+
+    /* +/-inf in either part */
+    v_u64x4_t inf = (v_u64x4_t)(((as_v4_u64_f64(re) & ~SIGNBIT_DP64) == PINFBITPATT_DP64) |
+                   ((as_v4_u64_f64(im) & ~SIGNBIT_DP64) == PINFBITPATT_DP64));
+
+    return as_v4_f64_u64((as_v4_u64_f64(r) & ~inf) | (inf & PINFBITPATT_DP64));
+}
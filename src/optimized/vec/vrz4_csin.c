@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * void amd_vrz4_csin(__m256d re, __m256d im, __m256d *rre, __m256d *rim)
+ *
+ * Implementation Notes:
+ *  Computes sin(z) for 4 complex numbers z = re + I*im held in split form.
+ *
+ *  sin(z) = sin(re)*cosh(im) + I*cos(re)*sinh(im)
+ *
+ *  sinh and cosh are derived from a single exp(|im|), with a Taylor series
+ *  for sinh of small arguments. If cosh(im) overflows, the result is
+ *  evaluated as (0.5 * trig(re) * exp(|im|/2)) * exp(|im|/2).
+ *
+ *  csin(+-0 + yi)   = +-0 + I*sinh(y)
+ *  csin(x +- 0i)    = nan +- 0i, for x inf or nan
+ *  csin(x +- inf i) = nan + inf i, for x inf or nan
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+
+void
+ALM_PROTO_OPT(vrz4_csin)(v_f64x4_t re, v_f64x4_t im, v_f64x4_t *rre, v_f64x4_t *rim)
+{
+    v_f64x4_t s, c, sh, ch;
+    v_f64x4_t ab = as_v4_f64_u64(as_v4_u64_f64(im) & ~SIGNBIT_DP64);
+
+    ALM_PROTO(vrd4_sincos)(re, &s, &c);
+    cmplx_sinhcosh_v4_f64(im, ALM_PROTO(vrd4_exp)(ab), &sh, &ch);
+
+    v_f64x4_t yr = s * ch;
+    v_f64x4_t yi = c * sh;
+
+    /* cosh(im) overflows */
+    v_i64x4_t big = ab > 0x1.62e42fefa39efp+9;
+    if (unlikely(any_v4_u64_loop((v_u64x4_t)big))) {
+        v_f64x4_t eh = ALM_PROTO(vrd4_exp)(0.5 * ab);
+        yr = cmplx_sel_v4_f64(big, (0.5 * s * eh) * eh, yr);
+        yi = cmplx_sel_v4_f64(big, (0.5 * c * cmplx_copysign_v4_f64(eh, im)) * eh, yi);
+    }
+
+    yr = cmplx_sel_v4_f64(re == 0, re, yr);
+
+    /* re is inf or nan, im is retained if +/-0, +inf if im is +/-inf */
+    v_u64x4_t uim = as_v4_u64_f64(im) & ~SIGNBIT_DP64;
+    v_i64x4_t nfre = (v_i64x4_t)((as_v4_u64_f64(re) & ~SIGNBIT_DP64) >= PINFBITPATT_DP64);
+    yi = cmplx_sel_v4_f64(nfre & (v_i64x4_t)(uim == 0), im, yi);
+    yi = cmplx_sel_v4_f64(nfre & (v_i64x4_t)(uim == PINFBITPATT_DP64), ab, yi);
+
+    *rre = yr;
+    *rim = yi;
+}
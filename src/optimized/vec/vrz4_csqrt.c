@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * void amd_vrz4_csqrt(__m256d re, __m256d im, __m256d *rre, __m256d *rim)
+ *
+ * Implementation Notes:
+ *  Computes the principal square root of 4 complex numbers z = re + I*im
+ *  held in split form.
+ *
+ *  t = sqrt((|re| + |z|) / 2), u = |im| / (2*t)
+ *  re >= 0: sqrt(z) = t + I*copysign(u, im)
+ *  re <  0: sqrt(z) = u + I*copysign(t, im)
+ *
+ *  re and im are scaled by an even power of two before squaring.
+ *
+ *  csqrt(+-0 + 0i)  = +0 + 0i, sign of zero of im retained
+ *  csqrt(x + inf i) = inf + inf i, for any x including nan
+ *  csqrt(inf + nan i)  = inf + nan i
+ *  csqrt(-inf + nan i) = nan + inf i
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+
+void
+ALM_PROTO_OPT(vrz4_csqrt)(v_f64x4_t re, v_f64x4_t im, v_f64x4_t *rre, v_f64x4_t *rim)
+{
+    v_f64x4_t a = re, b = im;
+    v_f64x4_t k = cmplx_scale_v4_f64(&a, &b);
+
+    v_f64x4_t aa = as_v4_f64_u64(as_v4_u64_f64(a) & ~SIGNBIT_DP64);
+    v_f64x4_t ab = as_v4_f64_u64(as_v4_u64_f64(b) & ~SIGNBIT_DP64);
+    v_f64x4_t t  = _mm256_sqrt_pd(0.5 * (aa + _mm256_sqrt_pd(a * a + b * b)));
+    v_f64x4_t u  = ab / (t + t);
+
+    /* scale back by 2^(k/2) */
+    v_f64x4_t sk = cmplx_sel_v4_f64(k > 0, _MM_SET1_PD4(0x1p300),
+                         cmplx_sel_v4_f64(k < 0, _MM_SET1_PD4(0x1p-300), _MM_SET1_PD4(1.0)));
+    t = t * sk;
+    u = u * sk;
+
+    v_i64x4_t neg = (v_i64x4_t)as_v4_u64_f64(re) < 0;
+
+    v_f64x4_t yr = cmplx_sel_v4_f64(neg, u, t);
+    v_f64x4_t yi = cmplx_copysign_v4_f64(cmplx_sel_v4_f64(neg, t, u), im);
+
+    /* z is +/-0, or im is +/-inf */
+    v_u64x4_t uim = as_v4_u64_f64(im) & ~SIGNBIT_DP64;
+    v_i64x4_t spl = (v_i64x4_t)(((as_v4_u64_f64(re) & ~SIGNBIT_DP64) | uim) == 0) | (v_i64x4_t)(uim == PINFBITPATT_DP64);
+    yr = cmplx_sel_v4_f64(spl, as_v4_f64_u64(uim), yr);
+    yi = cmplx_sel_v4_f64(spl, im, yi);
+
+    /* re is +/-inf and im is nan */
+    v_i64x4_t ire = (v_i64x4_t)((as_v4_u64_f64(re) & ~SIGNBIT_DP64) == PINFBITPATT_DP64) & (v_i64x4_t)(uim > PINFBITPATT_DP64);
+    yr = cmplx_sel_v4_f64(ire & ~neg, re, yr);
+    yi = cmplx_sel_v4_f64(ire & neg, as_v4_f64_u64(as_v4_u64_f64(re) & ~SIGNBIT_DP64), yi);
+
+    *rre = yr;
+    *rim = yi;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ * void amd_vrz4_ctan(__m256d re, __m256d im, __m256d *rre, __m256d *rim)
+ *
+ * Implementation Notes:
+ *  Computes tan(z) for 4 complex numbers z = re + I*im held in split form.
+ *
+ *  tan(z) = (sin(re)*cos(re) + I*sinh(im)*cosh(im)) / (cos(re)^2 + sinh(im)^2)
+ *
+ *  The denominator is a sum of squares, so there is no cancellation close
+ *  to the poles on the real axis.
+ *  For |im| > 20.0, tan(z) = sin(re)*cos(re)/sinh(im)^2 + I*sign(im)
+ *
+ *  ctan(+-0 + yi)   = +-0 + I*tanh(y)
+ *  ctan(x +- 0i)   = nan +- 0i, for x inf or nan
+ *  ctan(x +- inf i) = +-0 +- 1i, for any x
+ *  ctan(x + yi)     = nan + nan i, for x inf or nan and y finite nonzero
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/compiler.h>
+#include <libm/cmplx-vec.h>
+
+void
+ALM_PROTO_OPT(vrz4_ctan)(v_f64x4_t re, v_f64x4_t im, v_f64x4_t *rre, v_f64x4_t *rim)
+{
+    v_f64x4_t s, c, sh, ch;
+    v_f64x4_t ab = as_v4_f64_u64(as_v4_u64_f64(im) & ~SIGNBIT_DP64);
+
+    ALM_PROTO(vrd4_sincos)(re, &s, &c);
+    cmplx_sinhcosh_v4_f64(im, ALM_PROTO(vrd4_exp)(ab), &sh, &ch);
+
+    v_f64x4_t d  = c * c + sh * sh;
+    v_f64x4_t yr = (s * c) / d;
+    v_f64x4_t yi = (sh * ch) / d;
+
+    v_i64x4_t big = ab > 20.0;
+    if (unlikely(any_v4_u64_loop((v_u64x4_t)big))) {
+        yr = cmplx_sel_v4_f64(big, ((s * c) / sh) / sh, yr);
+        /* s is nan for re inf or nan, those lanes keep nan + nan i */
+        yi = cmplx_sel_v4_f64(big & (s == s), cmplx_copysign_v4_f64(_MM_SET1_PD4(1.0), im), yi);
+    }
+
+    /* im is +/-0 and re is inf or nan */
+    v_u64x4_t uim = as_v4_u64_f64(im) & ~SIGNBIT_DP64;
+    v_i64x4_t nfre = (v_i64x4_t)((as_v4_u64_f64(re) & ~SIGNBIT_DP64) >= PINFBITPATT_DP64);
+    yi = cmplx_sel_v4_f64(nfre & (v_i64x4_t)(uim == 0), im, yi);
+
+    /* tan(+-0 + yi) = +-0 + I*tanh(y) */
+    yr = cmplx_sel_v4_f64(re == 0, re, yr);
+
+    /* im is +/-inf, tan(z) = +-0 +- 1i for any re */
+    yr = cmplx_sel_v4_f64((v_i64x4_t)(uim == PINFBITPATT_DP64), as_v4_f64_u64(as_v4_u64_f64(re) & SIGNBIT_DP64), yr);
+    yi = cmplx_sel_v4_f64((v_i64x4_t)(uim == PINFBITPATT_DP64), cmplx_copysign_v4_f64(_MM_SET1_PD4(1.0), im), yi);
+
+    *rre = yr;
+    *rim = yi;
+}
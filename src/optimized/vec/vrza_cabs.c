@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrza_cabs(int length, fc64_t *x, double *y)
+ *
+ * vrza_cabs() computes |z| for 'length' number of complex numbers
+ * present in the 'x' array, and stores the real results in the 'y' array.
+ * The arrays hold complex numbers in the interleaved (re, im) layout.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Load 4 complex numbers into a pair of 256-bit registers
+ *     Split them into vectors of real and imaginary parts
+ *         call vrz4_cabs()
+ *     Interleave the results and store them.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Load them with a mask, the inputs which are not needed are 0.
+ *         call vrz4_cabs()
+ *     Store the results of unmasked elements.
+ * Return
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+/* Split 4 interleaved complex numbers into real and imaginary parts */
+static inline void
+vrza_deinterleave(__m256d lo, __m256d hi, __m256d *re, __m256d *im)
+{
+    /* elements are in the order 0, 2, 1, 3 */
+    *re = _mm256_unpacklo_pd(lo, hi);
+    *im = _mm256_unpackhi_pd(lo, hi);
+}
+
+/* Reverse of vrza_deinterleave() */
+static inline void
+vrza_interleave(__m256d re, __m256d im, __m256d *lo, __m256d *hi)
+{
+    *lo = _mm256_unpacklo_pd(re, im);
+    *hi = _mm256_unpackhi_pd(re, im);
+}
+
+/* Masks for the first n of the 8 doubles held in a pair of registers */
+static inline void
+vrza_tail_mask(int n, __m256i *mlo, __m256i *mhi)
+{
+    __m256i vn = _mm256_set1_epi64x(n);
+    *mlo = _mm256_cmpgt_epi64(vn, _mm256_setr_epi64x(0, 1, 2, 3));
+    *mhi = _mm256_cmpgt_epi64(vn, _mm256_setr_epi64x(4, 5, 6, 7));
+}
+
+/* Restore the element order of a result computed on deinterleaved input */
+static inline __m256d
+vrza_reorder(__m256d v)
+{
+    return _mm256_permute4x64_pd(v, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+void ALM_PROTO_OPT(vrza_cabs)(int length, fc64_t *x, double *y)
+{
+    int j = 0;
+    double *px = (double *)x;
+    __m256d xr, xi, r;
+
+    for (j = 0; j <= length - 4; j += 4)
+    {
+        vrza_deinterleave(_mm256_loadu_pd(&px[2 * j]), _mm256_loadu_pd(&px[2 * j + 4]), &xr, &xi);
+        r = ALM_PROTO(vrz4_cabs)(xr, xi);
+        _mm256_storeu_pd(&y[j], vrza_reorder(r));
+    }
+
+    if (length - j)
+    {
+        __m256i mlo, mhi;
+        vrza_tail_mask(2 * (length - j), &mlo, &mhi);
+        vrza_deinterleave(_mm256_maskload_pd(&px[2 * j], mlo), _mm256_maskload_pd(&px[2 * j + 4], mhi), &xr, &xi);
+        r = ALM_PROTO(vrz4_cabs)(xr, xi);
+        _mm256_maskstore_pd(&y[j], GET_MASK_DOUBLE_256_BIT(length - j), vrza_reorder(r));
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/********************************************
+ * ---------------------
+ * Signature
+ * ---------------------
+ * void vrza_clog_soa(int length, double *xr, double *xi, double *yr, double *yi)
+ *
+ * vrza_clog_soa() computes log(z) for 'length' number of complex numbers
+ * held in the 'xr' and 'xi' arrays of real and imaginary parts, and
+ * stores the real and imaginary parts of the results in the 'yr' and
+ * 'yi' arrays.
+ *
+ * ---------------------
+ * Implementation Notes
+ * ---------------------
+ *
+ * For any given length,
+ *     Pack 4 elements of each input array into a 256-bit register
+ *         call vrz4_clog()
+ *     Store the outputs into the result arrays.
+ *     Repeat
+ *
+ *     For the remaining element/s,
+ *     Pack the elements of each input array into a 256-bit register
+ *     Mask the inputs which are not needed to be computed with a 0.
+ *         call vrz4_clog()
+ *     Store the output of unmasked elements into the result arrays.
+ * Return
+ */
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+void ALM_PROTO_OPT(vrza_clog_soa)(int length, double *xr, double *xi, double *yr, double *yi)
+{
+    int j = 0;
+    __m256d rr, ri;
+
+    for (j = 0; j <= length - 4; j += 4)
+    {
+        ALM_PROTO(vrz4_clog)(_mm256_loadu_pd(&xr[j]), _mm256_loadu_pd(&xi[j]), &rr, &ri);
+        _mm256_storeu_pd(&yr[j], rr);
+        _mm256_storeu_pd(&yi[j], ri);
+    }
+
+    if (length - j)
+    {
+        __m256i mask = GET_MASK_DOUBLE_256_BIT(length - j);
+        ALM_PROTO(vrz4_clog)(_mm256_maskload_pd(&xr[j], mask), _mm256_maskload_pd(&xi[j], mask), &rr, &ri);
+        _mm256_maskstore_pd(&yr[j], mask, rr);
+        _mm256_maskstore_pd(&yi[j], mask, ri);
+    }
+}
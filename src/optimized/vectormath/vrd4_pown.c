@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <libm_util_amd.h>
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+#include <libm/compiler.h>
+#include <libm/pown-vec.h>
+
+#define VECTOR_LENGTH 4
+
+/*
+ *   __m256d ALM_PROTO_OPT(vrd4_pown)(__m256d, int);
+ *
+ * Spec:
+ *   - pow() with an integer exponent, x^n for each element of x
+ *   - pown(x, 0) is 1 for any x, including nan
+ *
+ * Implementation Notes:
+ *   x^|n| is computed by left to right binary powering, at most 62 multiplies,
+ *   on double-doubles so that the error does not grow with n, and inverted for
+ *   n < 0 (see pown-vec.h). The result is within about 0.5 ulp.
+ *
+ *   Lanes with zero, inf, nan or denormal x, or a result close to or beyond the
+ *   limits of the normal range, are computed by the scalar pow(x, n), which gives
+ *   the same result for integer n.
+ */
+__m256d
+ALM_PROTO_OPT(vrd4_pown)(__m256d x, int n)
+{
+    v_i64x4_t spl;
+    v_f64x4_t result = pown_v4_f64(x, n, &spl);
+
+    for (int i = 0; i < VECTOR_LENGTH; i++) {
+        if (unlikely(spl[i]))
+            result[i] = ALM_PROTO(pow)(x[i], (double)n);
+    }
+
+    return result;
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+C implementation of array logsumexp
+
+Signature:
+    double vrda_logsumexp(int length, double *x)
+
+Implementation notes:
+
+    log(sum(exp(x[i]))) without writing the exponentials to memory.
+
+    The maximum m of the array is found in a first pass and the sum is
+    taken over exp(x[i] - m) in a second one, so no term overflows and
+    the largest one is exactly 1:
+        logsumexp(x) = m + log(sum(exp(x[i] - m)))
+    The second pass uses four independent accumulators per block of up to
+    SUM_BLOCK elements and combines the block sums pairwise, as in
+    vrda_sumexp(), so the result is reproducible for a given length.
+
+    Special cases:
+        length <= 0       -> -inf (log of an empty sum)
+        any x[i] is NaN   -> NaN
+        m = +inf          -> +inf
+        m = -inf          -> -inf
+
+*/
+
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+#include <math.h>
+
+#define SUM_BLOCK       256
+
+static inline double
+hsum_pd(__m256d v)
+{
+    __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+
+/* Sum of exp(x[i] - m) over n elements, four independent accumulators */
+static double
+vrda_logsumexp_block(const double *x, int n, __m256d m)
+{
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    __m256d acc2 = _mm256_setzero_pd();
+    __m256d acc3 = _mm256_setzero_pd();
+    int j = 0;
+
+    for (; j <= n - 4 * DOUBLE_ELEMENTS_256_BIT; j += 4 * DOUBLE_ELEMENTS_256_BIT) {
+        acc0 = _mm256_add_pd(acc0, ALM_PROTO(vrd4_exp)(_mm256_sub_pd(_mm256_loadu_pd(&x[j]), m)));
+        acc1 = _mm256_add_pd(acc1, ALM_PROTO(vrd4_exp)(_mm256_sub_pd(_mm256_loadu_pd(&x[j + 4]), m)));
+        acc2 = _mm256_add_pd(acc2, ALM_PROTO(vrd4_exp)(_mm256_sub_pd(_mm256_loadu_pd(&x[j + 8]), m)));
+        acc3 = _mm256_add_pd(acc3, ALM_PROTO(vrd4_exp)(_mm256_sub_pd(_mm256_loadu_pd(&x[j + 12]), m)));
+    }
+
+    for (; j <= n - DOUBLE_ELEMENTS_256_BIT; j += DOUBLE_ELEMENTS_256_BIT)
+        acc0 = _mm256_add_pd(acc0, ALM_PROTO(vrd4_exp)(_mm256_sub_pd(_mm256_loadu_pd(&x[j]), m)));
+
+    if (n - j) {
+        __m256i mask = GET_MASK_DOUBLE_256_BIT(n - j);
+        /* masked lanes are set to m, their exp(0) is cleared below */
+        __m256d ip4 = _mm256_blendv_pd(m, _mm256_maskload_pd(&x[j], mask),
+                                       _mm256_castsi256_pd(mask));
+        __m256d op4 = _mm256_and_pd(ALM_PROTO(vrd4_exp)(_mm256_sub_pd(ip4, m)),
+                                    _mm256_castsi256_pd(mask));
+        acc1 = _mm256_add_pd(acc1, op4);
+    }
+
+    return hsum_pd(_mm256_add_pd(_mm256_add_pd(acc0, acc1),
+                                 _mm256_add_pd(acc2, acc3)));
+}
+
+static double
+vrda_logsumexp_pairwise(const double *x, int n, __m256d m)
+{
+    int h;
+
+    if (n <= SUM_BLOCK)
+        return vrda_logsumexp_block(x, n, m);
+
+    h = (n / 2) & ~(4 * DOUBLE_ELEMENTS_256_BIT - 1);
+
+    return vrda_logsumexp_pairwise(x, h, m) + vrda_logsumexp_pairwise(x + h, n - h, m);
+}
+
+double ALM_PROTO_OPT(vrda_logsumexp)(int length, double *x)
+{
+    __m256d vmax = _mm256_set1_pd(-INFINITY);
+    __m256d vnan = _mm256_setzero_pd();
+    __m128d s;
+    double m;
+    int j = 0;
+
+    if (length <= 0)
+        return -INFINITY;
+
+    for (; j <= length - DOUBLE_ELEMENTS_256_BIT; j += DOUBLE_ELEMENTS_256_BIT) {
+        __m256d ip4 = _mm256_loadu_pd(&x[j]);
+        vnan = _mm256_or_pd(vnan, _mm256_cmp_pd(ip4, ip4, _CMP_UNORD_Q));
+        vmax = _mm256_max_pd(vmax, ip4);
+    }
+
+    if (length - j) {
+        __m256i mask = GET_MASK_DOUBLE_256_BIT(length - j);
+        __m256d ip4 = _mm256_blendv_pd(vmax, _mm256_maskload_pd(&x[j], mask),
+                                       _mm256_castsi256_pd(mask));
+        vnan = _mm256_or_pd(vnan, _mm256_cmp_pd(ip4, ip4, _CMP_UNORD_Q));
+        vmax = _mm256_max_pd(vmax, ip4);
+    }
+
+    if (unlikely(_mm256_movemask_pd(vnan))) {
+        /* return the first NaN of the array */
+        for (j = 0; x[j] == x[j]; j++)
+            ;
+        return x[j];
+    }
+
+    s = _mm_max_pd(_mm256_castpd256_pd128(vmax), _mm256_extractf128_pd(vmax, 1));
+    m = _mm_cvtsd_f64(_mm_max_sd(s, _mm_unpackhi_pd(s, s)));
+
+    if (isinf(m))
+        return m;
+
+    return m + ALM_PROTO(log)(vrda_logsumexp_pairwise(x, length, _mm256_set1_pd(m)));
+}
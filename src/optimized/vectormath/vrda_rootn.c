@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+C implementation of vector array version of rootn
+
+Signature:
+    void vrda_rootn(int length, double *x, int n, double *result)
+
+Implementation notes:
+
+    rootn(x, n) = x^(1/n), for odd n the sign of x is kept, for even n
+    a negative x gives nan. rootn(x, 0) is nan.
+
+    r = powx(|x|, 1/n) is off by up to |log(x) / n| * 2^-53 relative from
+    rounding 1/n, it is corrected by one Newton step on r^n = |x|
+        r = r - r * (r^n / |x| - 1) / n
+    with r^n evaluated as a double-double (see pown-vec.h).
+    |x| outside [2^-900, 2^900] is first scaled by 2^(|n| * k) toward 1 so
+    that r^n stays in the normal range, and the result by 2^(k / n).
+
+*/
+
+#include <stdint.h>
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <libm/typehelper.h>
+#include <libm/typehelper-vec.h>
+#include <libm/pown-vec.h>
+
+#define ROOTN_SCALE_LO      0x07b0000000000000ULL   /* 2^-900 */
+#define ROOTN_SCALE_HI      0x7830000000000000ULL   /* 2^900 */
+#define ROOTN_SCALE_BITS    128
+#define ROOTN_SCALE_MAX_N   894     /* keeps |n| * k <= 1021 */
+#define DP64_NORMAL_MIN     0x0010000000000000ULL
+
+struct rootn_data {
+    int      n;
+    uint32_t an;
+    double   rn;                    /* 1 / n */
+    double   in_lo, out_lo;         /* scale factors for |x| < 2^-900 */
+    double   in_hi, out_hi;         /* and for |x| > 2^900 */
+    double   zero_res, inf_res;
+};
+
+static inline double
+rootn_pow2(int e)
+{
+    return asdouble((uint64_t)(e + 1023) << 52);
+}
+
+static inline v_f64x4_t
+rootn_sel(v_i64x4_t c, v_f64x4_t a, v_f64x4_t b)
+{
+    return as_v4_f64_u64((as_v4_u64_f64(a) & (v_u64x4_t)c) |
+                         (as_v4_u64_f64(b) & ~(v_u64x4_t)c));
+}
+
+static inline v_f64x4_t
+rootn_v4_f64(v_f64x4_t x, const struct rootn_data *d)
+{
+    v_u64x4_t ux  = as_v4_u64_f64(x);
+    v_u64x4_t uax = ux & ~SIGNBIT_DP64;
+    v_i64x4_t lo  = (v_i64x4_t)(uax < ROOTN_SCALE_LO);
+    v_i64x4_t hi  = (v_i64x4_t)(uax > ROOTN_SCALE_HI);
+    v_f64x4_t one = _MM_SET1_PD4(1.0);
+    v_f64x4_t ax  = as_v4_f64_u64(uax);
+    v_f64x4_t r, t, ph, pl;
+
+    ax = ax * rootn_sel(lo, _MM_SET1_PD4(d->in_lo), rootn_sel(hi, _MM_SET1_PD4(d->in_hi), one));
+
+    r = ALM_PROTO(vrd4_powx)(ax, d->rn);
+
+    /* Newton step on r^n = ax, skipped for zero, inf and nan */
+    ph = pown_dd_v4_f64(r, _MM_SET1_PD4(0.0), d->an, &pl);
+
+    if (d->n > 0)
+        t = ((ph - ax) + pl) / ax;
+    else
+        t = -(_mm256_fmsub_pd(ph, ax, one) + pl * ax);
+
+    v_i64x4_t normal = (v_i64x4_t)(((as_v4_u64_f64(ph) & ~SIGNBIT_DP64) - DP64_NORMAL_MIN) <
+                                   (PINFBITPATT_DP64 - DP64_NORMAL_MIN));
+
+    r = rootn_sel(normal, r - r * t * d->rn, r);
+
+    r = r * rootn_sel(lo, _MM_SET1_PD4(d->out_lo), rootn_sel(hi, _MM_SET1_PD4(d->out_hi), one));
+
+    r = rootn_sel((v_i64x4_t)(uax == 0), _MM_SET1_PD4(d->zero_res), r);
+    r = rootn_sel((v_i64x4_t)(uax == PINFBITPATT_DP64), _MM_SET1_PD4(d->inf_res), r);
+    r = rootn_sel((v_i64x4_t)(uax > PINFBITPATT_DP64), x, r);
+
+    /* odd n keeps the sign of x, even n has no real root of x < 0 */
+    if (d->an & 1)
+        return as_v4_f64_u64(as_v4_u64_f64(r) | (ux & SIGNBIT_DP64));
+
+    return rootn_sel((v_i64x4_t)(x < 0.0), _MM_SET1_PD4(asdouble(QNANBITPATT_DP64)), r);
+}
+
+void ALM_PROTO_OPT(vrda_rootn)(int length, double *x, int n, double *result)
+{
+    struct rootn_data d;
+    int j = 0;
+    int remainder;
+
+    if (unlikely(n == 0)) {
+        for (j = 0; j < length; j++)
+            result[j] = asdouble(QNANBITPATT_DP64);
+        return;
+    }
+
+    d.n  = n;
+    d.an = n < 0 ? -(uint32_t)n : (uint32_t)n;
+    d.rn = 1.0 / n;
+    d.in_lo = d.out_lo = d.in_hi = d.out_hi = 1.0;
+    d.zero_res = n > 0 ? 0.0 : asdouble(PINFBITPATT_DP64);
+    d.inf_res  = n > 0 ? asdouble(PINFBITPATT_DP64) : 0.0;
+
+    /*
+     * Beyond ROOTN_SCALE_MAX_N the error of powx is already below an ulp
+     * over the whole range
+     */
+    if (d.an <= ROOTN_SCALE_MAX_N) {
+        int k = (int)((ROOTN_SCALE_BITS + d.an - 1) / d.an);
+        int e = (int)d.an * k;
+
+        d.in_lo  = rootn_pow2(e);
+        d.in_hi  = rootn_pow2(-e);
+        d.out_lo = rootn_pow2(n > 0 ? -k : k);
+        d.out_hi = rootn_pow2(n > 0 ? k : -k);
+    }
+
+    if(likely(length >= DOUBLE_ELEMENTS_256_BIT))
+    {
+        for (j = 0; j <= length - DOUBLE_ELEMENTS_256_BIT; j += DOUBLE_ELEMENTS_256_BIT)
+        {
+            __m256d ip4 = _mm256_loadu_pd(&x[j]);
+            __m256d op4 = rootn_v4_f64(ip4, &d);
+            _mm256_storeu_pd(&result[j], op4);
+        }
+    }
+    remainder = length - j;
+
+    if(remainder)
+    {
+        __m256i mask = GET_MASK_DOUBLE_256_BIT(remainder);
+        __m256d ip4 = _mm256_maskload_pd(&x[j], mask);
+        __m256d op4 = rootn_v4_f64(ip4, &d);
+        _mm256_maskstore_pd(&result[j], mask, op4);
+    }
+}
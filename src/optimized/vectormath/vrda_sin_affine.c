@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+C implementation of fused affine array version of sin
+
+Signature:
+    void vrda_sin_affine(int length, double *x, double a, double b, double c, double d, double *result)
+
+Implementation notes:
+
+    Affine prologue and epilogue fused into the array pass,
+    result[i] = c * sin(a * x[i] + b) + d,
+    a * x + b and c * r + d are each a single FMA held in registers,
+    so the data is read and written only once.
+    refer vrd4_sin() for the accuracy of the kernel
+
+*/
+
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+void ALM_PROTO_OPT(vrda_sin_affine)(int length, double *x, double a, double b, double c, double d, double *result)
+{
+    int j = 0;
+    int remainder;
+    __m256d a_v = _mm256_broadcast_sd(&a);
+    __m256d b_v = _mm256_broadcast_sd(&b);
+    __m256d c_v = _mm256_broadcast_sd(&c);
+    __m256d d_v = _mm256_broadcast_sd(&d);
+
+    if(likely(length >= DOUBLE_ELEMENTS_256_BIT))
+    {
+        for (j = 0; j <= length - DOUBLE_ELEMENTS_256_BIT; j += DOUBLE_ELEMENTS_256_BIT)
+        {
+            __m256d ip4 = _mm256_fmadd_pd(a_v, _mm256_loadu_pd(&x[j]), b_v);
+            __m256d op4 = ALM_PROTO(vrd4_sin)(ip4);
+            _mm256_storeu_pd(&result[j], _mm256_fmadd_pd(c_v, op4, d_v));
+        }
+    }
+    remainder = length - j;
+
+    if(remainder)
+    {
+        __m256i mask = GET_MASK_DOUBLE_256_BIT(remainder);
+        __m256d ip4 = _mm256_fmadd_pd(a_v, _mm256_maskload_pd(&x[j], mask), b_v);
+        __m256d op4 = ALM_PROTO(vrd4_sin)(ip4);
+        _mm256_maskstore_pd(&result[j], mask, _mm256_fmadd_pd(c_v, op4, d_v));
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+C implementation of array sum of exp
+
+Signature:
+    double vrda_sumexp(int length, double *x)
+
+Implementation notes:
+
+    Sum of exp(x[i]) over the array without writing the exponentials
+    to memory. Blocks of up to SUM_BLOCK elements are accumulated in four
+    independent vector accumulators to hide the add latency, the block
+    sums are then combined pairwise. The order of additions depends only
+    on length, so the result is reproducible and the rounding error grows
+    as O(log(length)) rather than O(length).
+    refer vrd4_exp() for the accuracy of the kernel
+
+*/
+
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+#define SUM_BLOCK       256
+
+static inline double
+hsum_pd(__m256d v)
+{
+    __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+
+/* Sum of exp(x[i]) over n elements, four independent accumulators */
+static double
+vrda_sumexp_block(const double *x, int n)
+{
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    __m256d acc2 = _mm256_setzero_pd();
+    __m256d acc3 = _mm256_setzero_pd();
+    int j = 0;
+
+    for (; j <= n - 4 * DOUBLE_ELEMENTS_256_BIT; j += 4 * DOUBLE_ELEMENTS_256_BIT) {
+        acc0 = _mm256_add_pd(acc0, ALM_PROTO(vrd4_exp)(_mm256_loadu_pd(&x[j])));
+        acc1 = _mm256_add_pd(acc1, ALM_PROTO(vrd4_exp)(_mm256_loadu_pd(&x[j + 4])));
+        acc2 = _mm256_add_pd(acc2, ALM_PROTO(vrd4_exp)(_mm256_loadu_pd(&x[j + 8])));
+        acc3 = _mm256_add_pd(acc3, ALM_PROTO(vrd4_exp)(_mm256_loadu_pd(&x[j + 12])));
+    }
+
+    for (; j <= n - DOUBLE_ELEMENTS_256_BIT; j += DOUBLE_ELEMENTS_256_BIT)
+        acc0 = _mm256_add_pd(acc0, ALM_PROTO(vrd4_exp)(_mm256_loadu_pd(&x[j])));
+
+    if (n - j) {
+        __m256i mask = GET_MASK_DOUBLE_256_BIT(n - j);
+        __m256d ip4 = _mm256_maskload_pd(&x[j], mask);
+        /* exp(0) of the masked lanes is cleared before accumulating */
+        __m256d op4 = _mm256_and_pd(ALM_PROTO(vrd4_exp)(ip4), _mm256_castsi256_pd(mask));
+        acc1 = _mm256_add_pd(acc1, op4);
+    }
+
+    return hsum_pd(_mm256_add_pd(_mm256_add_pd(acc0, acc1),
+                                 _mm256_add_pd(acc2, acc3)));
+}
+
+static double
+vrda_sumexp_pairwise(const double *x, int n)
+{
+    int h;
+
+    if (n <= SUM_BLOCK)
+        return vrda_sumexp_block(x, n);
+
+    h = (n / 2) & ~(4 * DOUBLE_ELEMENTS_256_BIT - 1);
+
+    return vrda_sumexp_pairwise(x, h) + vrda_sumexp_pairwise(x + h, n - h);
+}
+
+double ALM_PROTO_OPT(vrda_sumexp)(int length, double *x)
+{
+    if (length <= 0)
+        return 0.0;
+
+    return vrda_sumexp_pairwise(x, length);
+}
@@ -34,6 +34,7 @@
 #include <libm/typehelper.h>
 #include <libm/typehelper-vec.h>
 #include <libm/compiler.h>
+#include <libm/pown-vec.h>
 
 #define AMD_LIBM_FMA_USABLE 0           /* needed for poly.h */
 #include <libm/poly-vec.h>
@@ -222,6 +223,11 @@ static struct {
  *      Polynomial Approximation:
  *      For More information refer to tools/sollya/vrs4_expf.sollya
  *
+ *  3. For integer y, and half-integer y = n/2, with |y| <= POWX_SMALL_Y, which is
+ *     checked once per call, x is widened to double and x^n or x^((n-1)/2) * sqrt(x)
+ *     is evaluated by a multiply chain instead (see pown-vec.h).
+ *  4. Otherwise x < 0 with an integer y, of any size, is evaluated on |x| and the
+ *     result negated for an odd y (powx_parity_y()), without leaving the vector path.
  *
  */
 
@@ -257,6 +263,19 @@ static inline int check_corner_case(v_u64x4_t condition2, v_u32x4_t condition1)
 __m128
 ALM_PROTO_OPT(vrs4_powxf)(__m128 _x,float _y)
 {
+    /* Small integer and half-integer y, evaluated in double */
+    int yn, kind = powx_classify_y((double)_y, &yn);
+
+    if (kind != POWX_Y_GENERIC) {
+        v_f64x4_t xd = _mm256_cvtps_pd(_x);
+
+        if (kind == POWX_Y_INTEGER)
+            xd = pownf_v4_f64(xd, yn);
+        else
+            xd = powxf_half_v4_f64(xd, yn);
+
+        return _mm256_cvtpd_ps(xd);
+    }
 
     v_u32x4_t u;
 
@@ -264,7 +283,20 @@ ALM_PROTO_OPT(vrs4_powxf)(__m128 _x,float _y)
 
     u = as_v4_u32_f32(_x);
 
-    v_u32x4_t condition = (u >= V_MAX);
+    /*
+     * Negative x with an integer y is evaluated on |x| and negated for an
+     * odd y, other negative x are left to powf() with the special values
+     */
+    int parity = powx_parity_y((double)_y);
+
+    v_u32x4_t sign = u & SIGNBIT_SP32;
+
+    if (parity != POWX_Y_NOT_INT)
+        u ^= sign;
+
+    sign &= (parity == POWX_Y_ODD) ? SIGNBIT_SP32 : 0;
+
+    v_u32x4_t condition = ((u - V_MIN) >= (V_MAX - V_MIN));
 
     v_i32x4_t int_exponent =  ((((v_i32x4_t)u) >> 23) - SP_BIAS);
 
@@ -330,10 +362,11 @@ ALM_PROTO_OPT(vrs4_powxf)(__m128 _x,float _y)
 
     if(check_corner_case(condition2, condition)) {
 
-        v_u32x4_t negative = (v_u32x4_t)(_x < ZERO);
-
-        /*call scalar powf for all inputs */
-        if(any_v4_u32_loop(negative)) {
+        /*
+         * call scalar powf for all inputs when any x is negative, zero,
+         * denormal, inf or nan
+         */
+        if(any_v4_u32_loop(condition)) {
 
             return (v_f32x4_t) {powf(_x[0], _y),
                                 powf(_x[1], _y),
@@ -346,9 +379,6 @@ ALM_PROTO_OPT(vrs4_powxf)(__m128 _x,float _y)
 
         v_i32x4_t inf_condition = (v_i32x4_t)(x > EXPF_MAXF);
 
-        /* set infinity to values of x greater than infinity */
-        inf_condition |= condition; 
-
         v_i32x4_t zero_condition = (v_i32x4_t)(x < EXPF_MINF);
 
         v_32x4 vx = {.f32x4 = ret};
@@ -365,7 +395,7 @@ ALM_PROTO_OPT(vrs4_powxf)(__m128 _x,float _y)
         ret = vx.f32x4;
     }
 
-    return ret;
+    return as_v4_f32_u32(as_v4_u32_f32(ret) | sign);
 
 }
 
@@ -34,6 +34,7 @@
 #include <libm/typehelper.h>
 #include <libm/typehelper-vec.h>
 #include <libm/compiler.h>
+#include <libm/pown-vec.h>
 #define AMD_LIBM_FMA_USABLE 1           /* needed for poly.h */
 #include <libm/poly-vec.h>
 
@@ -205,6 +206,11 @@ static struct {
  *      Polynomial Approximation:
  *      For More information refer to tools/sollya/vrs4_expf.sollya
  *
+ *  3. For integer y, and half-integer y = n/2, with |y| <= POWX_SMALL_Y, which is
+ *     checked once per call, x is widened to double and x^n or x^((n-1)/2) * sqrt(x)
+ *     is evaluated by a multiply chain instead (see pown-vec.h).
+ *  4. Otherwise x < 0 with an integer y, of any size, is evaluated on |x| and the
+ *     result negated for an odd y (powx_parity_y()), without leaving the vector path.
  *
  */
 
@@ -258,6 +264,23 @@ look_table_access(const double* table,
 __m256
 ALM_PROTO_OPT(vrs8_powxf)(__m256 x,float y)
 {
+    /* Small integer and half-integer y, evaluated in double */
+    int yn, kind = powx_classify_y((double)y, &yn);
+
+    if (kind != POWX_Y_GENERIC) {
+        v_f64x4_t lo = _mm256_cvtps_pd(_mm256_castps256_ps128(x));
+        v_f64x4_t hi = _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1));
+
+        if (kind == POWX_Y_INTEGER) {
+            lo = pownf_v4_f64(lo, yn);
+            hi = pownf_v4_f64(hi, yn);
+        } else {
+            lo = powxf_half_v4_f64(lo, yn);
+            hi = powxf_half_v4_f64(hi, yn);
+        }
+
+        return _mm256_setr_m128(_mm256_cvtpd_ps(lo), _mm256_cvtpd_ps(hi));
+    }
 
     v_u32x8_t u;
 
@@ -267,7 +290,20 @@ ALM_PROTO_OPT(vrs8_powxf)(__m256 x,float y)
 
     u = as_v8_u32_f32(x);
 
-    v_i32x8_t condition = (v_i32x8_t)(u >= V_MAX);
+    /*
+     * Negative x with an integer y is evaluated on |x| and negated for an
+     * odd y, other negative x are left to powf() with the special values
+     */
+    int parity = powx_parity_y((double)y);
+
+    v_u32x8_t sign = u & SIGNBIT_SP32;
+
+    if (parity != POWX_Y_NOT_INT)
+        u ^= sign;
+
+    sign &= (parity == POWX_Y_ODD) ? SIGNBIT_SP32 : 0;
+
+    v_i32x8_t condition = (v_i32x8_t)((u - V_MIN) >= (V_MAX - V_MIN));
 
     v_i32x8_t int_exponent = (((v_i32x8_t)u) >> 23) - SP_BIAS;
 
@@ -357,7 +393,7 @@ ALM_PROTO_OPT(vrs8_powxf)(__m256 x,float y)
 
     }
 
-    ret =  _mm256_setr_m128(ret_array[0], ret_array[1]);
+    ret =  as_v8_f32_u32(as_v8_u32_f32(_mm256_setr_m128(ret_array[0], ret_array[1])) | sign);
 
     if (unlikely(v_any_u32(condition))) {
 
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+C implementation of array logsumexpf
+
+Signature:
+    float vrsa_logsumexpf(int length, float *x)
+
+Implementation notes:
+
+    logf(sum(expf(x[i]))) without writing the exponentials to memory,
+    using the max-shift of vrda_logsumexp():
+        logsumexpf(x) = m + log(sum(expf(x[i] - m)))
+    The float exponentials are widened and accumulated in double with
+    four independent accumulators per block of up to SUM_BLOCK elements,
+    the block sums are combined pairwise, so the result is reproducible
+    for a given length. The final m + log(sum) is rounded once to float.
+
+    Special cases:
+        length <= 0       -> -inf (log of an empty sum)
+        any x[i] is NaN   -> NaN
+        m = +inf          -> +inf
+        m = -inf          -> -inf
+
+*/
+
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+#include <math.h>
+
+#define SUM_BLOCK       512
+
+static inline double
+hsum_pd(__m256d v)
+{
+    __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+
+/* Widen eight float results and add them to two double accumulators */
+#define ACC_PS(lo, hi, v) do {                                              \
+        lo = _mm256_add_pd(lo, _mm256_cvtps_pd(_mm256_castps256_ps128(v))); \
+        hi = _mm256_add_pd(hi, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1))); \
+    } while (0)
+
+/* Sum of expf(x[i] - m) over n elements */
+static double
+vrsa_logsumexpf_block(const float *x, int n, __m256 m)
+{
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    __m256d acc2 = _mm256_setzero_pd();
+    __m256d acc3 = _mm256_setzero_pd();
+    int j = 0;
+
+    for (; j <= n - 2 * FLOAT_ELEMENTS_256_BIT; j += 2 * FLOAT_ELEMENTS_256_BIT) {
+        __m256 op0 = ALM_PROTO(vrs8_expf)(_mm256_sub_ps(_mm256_loadu_ps(&x[j]), m));
+        __m256 op1 = ALM_PROTO(vrs8_expf)(_mm256_sub_ps(_mm256_loadu_ps(&x[j + 8]), m));
+        ACC_PS(acc0, acc1, op0);
+        ACC_PS(acc2, acc3, op1);
+    }
+
+    for (; j <= n - FLOAT_ELEMENTS_256_BIT; j += FLOAT_ELEMENTS_256_BIT) {
+        __m256 op0 = ALM_PROTO(vrs8_expf)(_mm256_sub_ps(_mm256_loadu_ps(&x[j]), m));
+        ACC_PS(acc0, acc1, op0);
+    }
+
+    if (n - j) {
+        __m256i mask = GET_MASK_FLOAT_256_BIT(n - j);
+        /* masked lanes are set to m, their expf(0) is cleared below */
+        __m256 ip8 = _mm256_blendv_ps(m, _mm256_maskload_ps(&x[j], mask),
+                                      _mm256_castsi256_ps(mask));
+        __m256 op0 = _mm256_and_ps(ALM_PROTO(vrs8_expf)(_mm256_sub_ps(ip8, m)),
+                                   _mm256_castsi256_ps(mask));
+        ACC_PS(acc2, acc3, op0);
+    }
+
+    return hsum_pd(_mm256_add_pd(_mm256_add_pd(acc0, acc1),
+                                 _mm256_add_pd(acc2, acc3)));
+}
+
+static double
+vrsa_logsumexpf_pairwise(const float *x, int n, __m256 m)
+{
+    int h;
+
+    if (n <= SUM_BLOCK)
+        return vrsa_logsumexpf_block(x, n, m);
+
+    h = (n / 2) & ~(2 * FLOAT_ELEMENTS_256_BIT - 1);
+
+    return vrsa_logsumexpf_pairwise(x, h, m) + vrsa_logsumexpf_pairwise(x + h, n - h, m);
+}
+
+float ALM_PROTO_OPT(vrsa_logsumexpf)(int length, float *x)
+{
+    __m256 vmax = _mm256_set1_ps(-INFINITY);
+    __m256 vnan = _mm256_setzero_ps();
+    __m128 s;
+    float m;
+    int j = 0;
+
+    if (length <= 0)
+        return -INFINITY;
+
+    for (; j <= length - FLOAT_ELEMENTS_256_BIT; j += FLOAT_ELEMENTS_256_BIT) {
+        __m256 ip8 = _mm256_loadu_ps(&x[j]);
+        vnan = _mm256_or_ps(vnan, _mm256_cmp_ps(ip8, ip8, _CMP_UNORD_Q));
+        vmax = _mm256_max_ps(vmax, ip8);
+    }
+
+    if (length - j) {
+        __m256i mask = GET_MASK_FLOAT_256_BIT(length - j);
+        __m256 ip8 = _mm256_blendv_ps(vmax, _mm256_maskload_ps(&x[j], mask),
+                                      _mm256_castsi256_ps(mask));
+        vnan = _mm256_or_ps(vnan, _mm256_cmp_ps(ip8, ip8, _CMP_UNORD_Q));
+        vmax = _mm256_max_ps(vmax, ip8);
+    }
+
+    if (unlikely(_mm256_movemask_ps(vnan))) {
+        /* return the first NaN of the array */
+        for (j = 0; x[j] == x[j]; j++)
+            ;
+        return x[j];
+    }
+
+    s = _mm_max_ps(_mm256_castps256_ps128(vmax), _mm256_extractf128_ps(vmax, 1));
+    s = _mm_max_ps(s, _mm_movehl_ps(s, s));
+    m = _mm_cvtss_f32(_mm_max_ss(s, _mm_shuffle_ps(s, s, 1)));
+
+    if (isinf(m))
+        return m;
+
+    return (float)((double)m + ALM_PROTO(log)(vrsa_logsumexpf_pairwise(x, length, _mm256_set1_ps(m))));
+}
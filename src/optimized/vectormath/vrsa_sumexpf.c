@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+C implementation of array sum of expf
+
+Signature:
+    float vrsa_sumexpf(int length, float *x)
+
+Implementation notes:
+
+    Sum of expf(x[i]) over the array without writing the exponentials
+    to memory. The float results are widened and accumulated in double
+    with four independent accumulators, blocks of up to SUM_BLOCK elements
+    are combined pairwise, so the order of additions depends only on
+    length and the result is reproducible. The final sum is rounded once
+    to float.
+    refer vrs8_expf() for the accuracy of the kernel
+
+*/
+
+#include <libm_macros.h>
+#include <immintrin.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+#define SUM_BLOCK       512
+
+static inline double
+hsum_pd(__m256d v)
+{
+    __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+
+/* Widen eight float results and add them to two double accumulators */
+#define ACC_PS(lo, hi, v) do {                                              \
+        lo = _mm256_add_pd(lo, _mm256_cvtps_pd(_mm256_castps256_ps128(v))); \
+        hi = _mm256_add_pd(hi, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1))); \
+    } while (0)
+
+static double
+vrsa_sumexpf_block(const float *x, int n)
+{
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    __m256d acc2 = _mm256_setzero_pd();
+    __m256d acc3 = _mm256_setzero_pd();
+    int j = 0;
+
+    for (; j <= n - 2 * FLOAT_ELEMENTS_256_BIT; j += 2 * FLOAT_ELEMENTS_256_BIT) {
+        __m256 op0 = ALM_PROTO(vrs8_expf)(_mm256_loadu_ps(&x[j]));
+        __m256 op1 = ALM_PROTO(vrs8_expf)(_mm256_loadu_ps(&x[j + 8]));
+        ACC_PS(acc0, acc1, op0);
+        ACC_PS(acc2, acc3, op1);
+    }
+
+    for (; j <= n - FLOAT_ELEMENTS_256_BIT; j += FLOAT_ELEMENTS_256_BIT) {
+        __m256 op0 = ALM_PROTO(vrs8_expf)(_mm256_loadu_ps(&x[j]));
+        ACC_PS(acc0, acc1, op0);
+    }
+
+    if (n - j) {
+        __m256i mask = GET_MASK_FLOAT_256_BIT(n - j);
+        __m256 ip8 = _mm256_maskload_ps(&x[j], mask);
+        /* expf(0) of the masked lanes is cleared before accumulating */
+        __m256 op0 = _mm256_and_ps(ALM_PROTO(vrs8_expf)(ip8), _mm256_castsi256_ps(mask));
+        ACC_PS(acc2, acc3, op0);
+    }
+
+    return hsum_pd(_mm256_add_pd(_mm256_add_pd(acc0, acc1),
+                                 _mm256_add_pd(acc2, acc3)));
+}
+
+static double
+vrsa_sumexpf_pairwise(const float *x, int n)
+{
+    int h;
+
+    if (n <= SUM_BLOCK)
+        return vrsa_sumexpf_block(x, n);
+
+    h = (n / 2) & ~(2 * FLOAT_ELEMENTS_256_BIT - 1);
+
+    return vrsa_sumexpf_pairwise(x, h) + vrsa_sumexpf_pairwise(x + h, n - h);
+}
+
+float ALM_PROTO_OPT(vrsa_sumexpf)(int length, float *x)
+{
+    if (length <= 0)
+        return 0.0f;
+
+    return (float)vrsa_sumexpf_pairwise(x, length);
+}